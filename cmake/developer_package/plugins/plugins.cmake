@@ -96,6 +96,9 @@ function(ie_add_plugin)
         if(TARGET ir_ngraph_frontend)
             add_dependencies(${IE_PLUGIN_NAME} ir_ngraph_frontend)
         endif()
+        if(TARGET binary_ir_ngraph_frontend)
+            add_dependencies(${IE_PLUGIN_NAME} binary_ir_ngraph_frontend)
+        endif()
         if(TARGET inference_engine_ir_v7_reader)
             add_dependencies(${IE_PLUGIN_NAME} inference_engine_ir_v7_reader)
         endif()
@@ -16,6 +16,8 @@ ie_dependent_option (ENABLE_CLDNN "clDnn based plugin for inference engine" ON "
 
 ie_option (ENABLE_PROFILING_ITT "Build with ITT tracing. Optionally configure pre-built ittnotify library though INTEL_VTUNE_DIR variable." OFF)
 
+ie_option (ENABLE_PROFILING_TRACE "Build with the built-in collector of ITT tasks writing Chrome trace event JSON. Enabled at runtime with OPENVINO_TRACE_FILE variable." OFF)
+
 ie_option_enum(ENABLE_PROFILING_FILTER "Enable or disable ITT counter groups.\
 Supported values:\
  ALL - enable all ITT counters (default value)\
@@ -114,6 +116,8 @@ ie_dependent_option (ENABLE_GPU_DEBUG_CAPS "enable GPU debug capabilities at run
 
 ie_dependent_option (ENABLE_CPU_DEBUG_CAPS "enable CPU debug capabilities at runtime" ON "ENABLE_DEBUG_CAPS" OFF)
 
+ie_option (ENABLE_CPU_CONV_TUNING "enable measured selection of CPU convolution implementations stored in the tuning cache file" OFF)
+
 if(ANDROID OR WINDOWS_STORE OR (MSVC AND (ARM OR AARCH64)))
     set(protoc_available OFF)
 else()
@@ -123,6 +127,7 @@ endif()
 ie_dependent_option(NGRAPH_ONNX_FRONTEND_ENABLE "Enable ONNX FrontEnd" ON "protoc_available" OFF)
 ie_dependent_option(NGRAPH_PDPD_FRONTEND_ENABLE "Enable PaddlePaddle FrontEnd" ON "protoc_available" OFF)
 ie_option(NGRAPH_IR_FRONTEND_ENABLE "Enable IR FrontEnd" ON)
+ie_option(NGRAPH_BINARY_IR_FRONTEND_ENABLE "Enable binary IR FrontEnd" ON)
 ie_dependent_option(NGRAPH_TF_FRONTEND_ENABLE "Enable TensorFlow FrontEnd" ON "protoc_available" OFF)
 ie_dependent_option(NGRAPH_USE_PROTOBUF_LITE "Compiles and links with protobuf-lite" ON
     "NGRAPH_ONNX_FRONTEND_ENABLE" OFF)
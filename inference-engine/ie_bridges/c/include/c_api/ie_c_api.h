@@ -53,6 +53,7 @@ typedef struct ie_network ie_network_t;
 typedef struct ie_executable ie_executable_network_t;
 typedef struct ie_infer_request ie_infer_request_t;
 typedef struct ie_blob ie_blob_t;
+typedef struct ie_completion_queue ie_completion_queue_t;
 
 /**
  * @struct ie_version
@@ -298,6 +299,16 @@ typedef struct ie_complete_call_back {
     void *args;
 } ie_complete_call_back_t;
 
+/**
+ * @struct ie_completion
+ * @brief Represents a finished asynchronous infer request dequeued from ie_completion_queue_t
+ */
+typedef struct ie_completion {
+    ie_infer_request_t *request;  //!< The finished infer request
+    void *user_data;              //!< User data passed to ie_infer_request_set_completion_queue
+    IEStatusCode status;          //!< Status of the inference: OK(0) for success
+} ie_completion_t;
+
 /**
  * @struct ie_available_devices
  * @brief Represent all available devices.
@@ -659,6 +670,52 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_wait(ie_infer
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_batch(ie_infer_request_t *infer_request, const size_t size);
 
+/**
+ * @brief Creates a completion queue collecting finished asynchronous infer requests, so many requests
+ * can be submitted and then waited at once instead of handling a callback per request.
+ * Use the ie_completion_queue_free() method to free memory.
+ * @ingroup InferRequest
+ * @param queue A pointer to the newly created ie_completion_queue_t.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_create(ie_completion_queue_t **queue);
+
+/**
+ * @brief Releases memory occupied by ie_completion_queue_t instance.
+ * Requests attached to the queue may still be running, the queue memory is released when the last of them finishes.
+ * @ingroup InferRequest
+ * @param queue A pointer to the ie_completion_queue_t to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_completion_queue_free(ie_completion_queue_t **queue);
+
+/**
+ * @brief Makes the infer request to put itself into the queue on success or failure of each asynchronous inference.
+ * Replaces the completion callback set by ie_infer_set_completion_callback().
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param user_data Data returned with the completions of this request, e.g. its index.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_completion_queue(ie_infer_request_t *infer_request, \
+        ie_completion_queue_t *queue, void *user_data);
+
+/**
+ * @brief Waits until at least min_count requests are completed or the timeout elapses, then dequeues up to
+ * max_count completions in the order of completion.
+ * @ingroup InferRequest
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param min_count Number of completions to wait for, 0 to poll without blocking.
+ * @param timeout Maximum duration in milliseconds to block for, -1 to wait without timeout.
+ * @param completions An array of at least max_count elements to be filled.
+ * @param max_count Maximal number of completions to dequeue.
+ * @param count A pointer to the number of dequeued completions.
+ * @return Status code of the operation: OK(0) if at least min_count completions are dequeued,
+ * RESULT_NOT_READY if the timeout elapsed before (available completions are dequeued anyway).
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_wait(ie_completion_queue_t *queue, const size_t min_count, \
+        const int64_t timeout, ie_completion_t *completions, const size_t max_count, size_t *count);
+
 /** @} */ // end of InferRequest
 
 // Network
@@ -13,6 +13,9 @@
 #include <chrono>
 #include <tuple>
 #include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
 #include <ie_extension.h>
 #include "inference_engine.hpp"
 #include "ie_compound_blob.h"
@@ -44,6 +47,19 @@ struct ie_infer_request {
     IE::InferRequest object;
 };
 
+/**
+ * @struct ie_completion_queue
+ * @brief This is a queue of finished asynchronous infer requests, shared with the requests attached to it
+ */
+struct ie_completion_queue {
+    struct Impl {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque<ie_completion_t> completions;
+    };
+    std::shared_ptr<Impl> object;
+};
+
 /**
  * @struct ie_blob
  * @brief This struct represents a universal container in the Inference Engine
@@ -1228,6 +1244,83 @@ IEStatusCode ie_infer_request_wait(ie_infer_request_t *infer_request, const int6
     return status;
 }
 
+IEStatusCode ie_completion_queue_create(ie_completion_queue_t **queue) {
+    if (queue == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    IEStatusCode status = IEStatusCode::OK;
+    try {
+        std::unique_ptr<ie_completion_queue_t> tmp(new ie_completion_queue_t);
+        tmp->object = std::make_shared<ie_completion_queue_t::Impl>();
+        *queue = tmp.release();
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
+void ie_completion_queue_free(ie_completion_queue_t **queue) {
+    if (queue) {
+        delete *queue;
+        *queue = NULL;
+    }
+}
+
+IEStatusCode ie_infer_request_set_completion_queue(ie_infer_request_t *infer_request, ie_completion_queue_t *queue, void *user_data) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr || queue == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        auto impl = queue->object;
+        auto fun = [=](IE::InferRequest, IE::StatusCode code) {
+            // status_map is not modified here as the callbacks of different requests run concurrently
+            auto it = status_map.find(code);
+            ie_completion_t completion = {infer_request, user_data,
+                                          it != status_map.end() ? it->second : IEStatusCode::GENERAL_ERROR};
+            {
+                std::lock_guard<std::mutex> lock(impl->mutex);
+                impl->completions.push_back(completion);
+            }
+            impl->cv.notify_all();
+        };
+        infer_request->object.SetCompletionCallback<std::function<void(IE::InferRequest, IE::StatusCode)>>(fun);
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
+IEStatusCode ie_completion_queue_wait(ie_completion_queue_t *queue, const size_t min_count, const int64_t timeout,
+        ie_completion_t *completions, const size_t max_count, size_t *count) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (queue == nullptr || count == nullptr || (completions == nullptr && max_count != 0) || min_count > max_count) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        auto& impl = *queue->object;
+        std::unique_lock<std::mutex> lock(impl.mutex);
+        const auto ready = [&] {
+            return impl.completions.size() >= min_count;
+        };
+        if (timeout < 0) {
+            impl.cv.wait(lock, ready);
+        } else if (!impl.cv.wait_for(lock, std::chrono::milliseconds(timeout), ready)) {
+            status = IEStatusCode::RESULT_NOT_READY;
+        }
+        *count = std::min(max_count, impl.completions.size());
+        std::copy_n(impl.completions.begin(), *count, completions);
+        impl.completions.erase(impl.completions.begin(), impl.completions.begin() + *count);
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
 IEStatusCode ie_infer_request_set_batch(ie_infer_request_t *infer_request, const size_t size) {
     IEStatusCode status = IEStatusCode::OK;
 
@@ -1183,6 +1183,90 @@ TEST(ie_infer_request_infer_async, inferAsyncWaitTime) {
     ie_core_free(&core);
 }
 
+TEST(ie_infer_request_infer_async, inferAsyncCompletionQueue) {
+    ie_core_t *core = nullptr;
+    IE_ASSERT_OK(ie_core_create("", &core));
+    ASSERT_NE(nullptr, core);
+
+    ie_network_t *network = nullptr;
+    IE_EXPECT_OK(ie_core_read_network(core, xml, bin, &network));
+    EXPECT_NE(nullptr, network);
+
+    IE_EXPECT_OK(ie_network_set_input_precision(network, "data", precision_e::U8));
+
+    const char *device_name = "CPU";
+    ie_config_t config = {nullptr, nullptr, nullptr};
+    ie_executable_network_t *exe_network = nullptr;
+    IE_EXPECT_OK(ie_core_load_network(core, network, device_name, &config, &exe_network));
+    EXPECT_NE(nullptr, exe_network);
+
+    ie_completion_queue_t *queue = nullptr;
+    IE_EXPECT_OK(ie_completion_queue_create(&queue));
+    EXPECT_NE(nullptr, queue);
+
+    constexpr size_t num_requests = 2;
+    ie_infer_request_t *infer_requests[num_requests] = {};
+    size_t ids[num_requests] = {};
+    cv::Mat image = cv::imread(input_image);
+    for (size_t i = 0; i < num_requests; ++i) {
+        IE_EXPECT_OK(ie_exec_network_create_infer_request(exe_network, &infer_requests[i]));
+        EXPECT_NE(nullptr, infer_requests[i]);
+
+        ie_blob_t *blob = nullptr;
+        IE_EXPECT_OK(ie_infer_request_get_blob(infer_requests[i], "data", &blob));
+        Mat2Blob(image, blob);
+        ie_blob_free(&blob);
+
+        ids[i] = i;
+        IE_EXPECT_OK(ie_infer_request_set_completion_queue(infer_requests[i], queue, &ids[i]));
+    }
+
+    ie_completion_t completions[num_requests];
+    size_t count = 0;
+    IE_EXPECT_OK(ie_completion_queue_wait(queue, 0, 0, completions, num_requests, &count));
+    EXPECT_EQ(0, count);
+
+    if (!HasFatalFailure()) {
+        for (size_t i = 0; i < num_requests; ++i) {
+            IE_EXPECT_OK(ie_infer_request_infer_async(infer_requests[i]));
+        }
+        IE_EXPECT_OK(ie_completion_queue_wait(queue, num_requests, -1, completions, num_requests, &count));
+        EXPECT_EQ(num_requests, count);
+
+        bool seen[num_requests] = {};
+        for (size_t i = 0; i < count; ++i) {
+            IE_EXPECT_OK(completions[i].status);
+            size_t id = *static_cast<size_t *>(completions[i].user_data);
+            ASSERT_LT(id, num_requests);
+            EXPECT_EQ(infer_requests[id], completions[i].request);
+            seen[id] = true;
+
+            ie_blob_t *output_blob = nullptr;
+            IE_EXPECT_OK(ie_infer_request_get_blob(completions[i].request, "fc_out", &output_blob));
+            ie_blob_buffer_t buffer;
+            IE_EXPECT_OK(ie_blob_get_buffer(output_blob, &buffer));
+            float *output_data = (float *)(buffer.buffer);
+            EXPECT_NEAR(output_data[9], 0.f, 1.e-5);
+            ie_blob_free(&output_blob);
+        }
+        for (size_t i = 0; i < num_requests; ++i) {
+            EXPECT_TRUE(seen[i]);
+        }
+
+        EXPECT_EQ(IEStatusCode::RESULT_NOT_READY, ie_completion_queue_wait(queue, 1, 10, completions, num_requests, &count));
+        EXPECT_EQ(0, count);
+    }
+
+    for (size_t i = 0; i < num_requests; ++i) {
+        ie_infer_request_free(&infer_requests[i]);
+    }
+    ie_completion_queue_free(&queue);
+    EXPECT_EQ(nullptr, queue);
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+}
+
 TEST(ie_infer_request_set_batch, setBatch) {
     ie_core_t *core = nullptr;
     IE_ASSERT_OK(ie_core_create("", &core));
@@ -10,6 +10,7 @@ from libcpp.vector cimport vector
 from libcpp cimport bool
 from libcpp.map cimport map
 from libcpp.memory cimport unique_ptr
+from libcpp.utility cimport pair
 from libc.stdlib cimport malloc, free
 from libc.stdint cimport int64_t, uint8_t, int8_t, int32_t, uint16_t, int16_t, uint32_t, uint64_t
 from libc.stddef cimport size_t
@@ -879,6 +880,7 @@ cdef class ExecutableNetwork:
     #  Wraps `infer()` method of the `InferRequest` class
     #  @param inputs:  A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
     #                  input data for the layer
+    #  @param share_inputs: If True, the arrays are used as input blobs without a copy, see `InferRequest.infer()`
     #  @return A dictionary that maps output layer names to `numpy.ndarray` objects with output data of the layer
     #
     #  Usage example:\n
@@ -895,9 +897,9 @@ cdef class ExecutableNetwork:
     #                  ......
     #                 ]])}
     #  ```
-    def infer(self, inputs=None):
+    def infer(self, inputs=None, share_inputs=False):
         current_request = self.requests[0]
-        current_request.infer(inputs)
+        current_request.infer(inputs, share_inputs)
         res = {}
         for name, value in current_request.output_blobs.items():
             res[name] = deepcopy(value.buffer)
@@ -908,6 +910,7 @@ cdef class ExecutableNetwork:
     #  @param request_id: Index of infer request to start inference
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper
     #                 shape with input data for the layer
+    #  @param share_inputs: If True, the arrays are used as input blobs without a copy, see `InferRequest.infer()`
     #  @return A handler of specified infer request, which is an instance of the `InferRequest` class.
     #
     #  Usage example:\n
@@ -916,11 +919,11 @@ cdef class ExecutableNetwork:
     #  infer_status = infer_request_handle.wait()
     #  res = infer_request_handle.output_blobs[out_blob_name]
     #  ```
-    def start_async(self, request_id, inputs=None):
+    def start_async(self, request_id, inputs=None, share_inputs=False):
         if request_id not in list(range(len(self.requests))):
             raise ValueError("Incorrect request_id specified!")
         current_request = self.requests[request_id]
-        current_request.async_infer(inputs)
+        current_request.async_infer(inputs, share_inputs)
         return current_request
 
     ## A tuple of `InferRequest` instances
@@ -1058,6 +1061,40 @@ cdef class ExecutableNetwork:
             request_id = deref(self.impl).getIdleRequestId()
         return request_id
 
+    ## Starts collecting the completions of asynchronous requests in C++, to be read by `get_completed_requests()`.
+    #  Collecting doesn't acquire the GIL, so it is cheaper than a completion callback per request
+    #  @return None
+    cpdef enable_completion_queue(self):
+        deref(self.impl).enableCompletionQueue()
+
+    ## Gets the asynchronous requests completed since the previous call, in completion order.
+    #  Available after `enable_completion_queue()` is called.
+    #  @param timeout: Time to wait in milliseconds for at least one completion or special (0, -1) cases,
+    #                  see `wait()`. If not specified, `timeout` value is set to -1 by default.
+    #  @return List of (request index, status code) tuples, empty if none completed within the timeout
+    #
+    #  Usage example:\n
+    #  ```python
+    #  exec_net = ie_core.load_network(network=net, device_name="CPU", num_requests=4)
+    #  exec_net.enable_completion_queue()
+    #  for req in exec_net.requests:
+    #      req.async_infer({input_blob: image})
+    #  done = 0
+    #  while done < len(exec_net.requests):
+    #      for request_id, status in exec_net.get_completed_requests():
+    #          res = exec_net.requests[request_id].output_blobs['prob']
+    #          done += 1
+    #  ```
+    cpdef get_completed_requests(self, timeout=None):
+        cdef vector[pair[int, int]] c_completed
+        cdef int64_t c_timeout
+        if timeout is None:
+            timeout = WaitMode.RESULT_READY
+        c_timeout = <int64_t> timeout
+        with nogil:
+            c_completed = deref(self.impl).getCompletedRequests(c_timeout)
+        return [(c.first, c.second) for c in c_completed]
+
 ctypedef extern void (*cb_type)(void*, int) with gil
 
 ## This class provides an interface to infer requests of `ExecutableNetwork` and serves to handle infer requests execution
@@ -1073,6 +1110,7 @@ cdef class InferRequest:
         self._py_callback = lambda *args, **kwargs: None
         self._py_data = None
         self._inputs_is_dynamic = {}
+        self._shared_inputs = set()
 
     cdef void user_callback(self, int status) with gil:
         if self._py_callback:
@@ -1183,6 +1221,8 @@ cdef class InferRequest:
     #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
     #                 input data for the layer
+    #  @param share_inputs: If True, C-contiguous arrays of the input precision are set as input blobs without a copy.
+    #                       The arrays must not be changed until the inference is finished. Other arrays are copied
     #  @return None
     #
     #  Usage example:\n
@@ -1195,15 +1235,16 @@ cdef class InferRequest:
     #         5.45198545e-02, 2.44456064e-02, 5.41366823e-03, 3.42589128e-03,
     #         2.26027006e-03, 2.12283316e-03 ...])
     #  ```
-    cpdef infer(self, inputs=None):
+    cpdef infer(self, inputs=None, share_inputs=False):
         if inputs is not None:
-            self._fill_inputs(inputs)
+            self._fill_inputs(inputs, share_inputs)
         with nogil:
             deref(self.impl).infer()
 
     ## Starts asynchronous inference of the infer request and fill outputs array
     #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with input data for the layer
+    #  @param share_inputs: If True, the arrays are used as input blobs without a copy, see `infer()`
     #  @return: None
     #
     #  Usage example:\n
@@ -1213,9 +1254,9 @@ cdef class InferRequest:
     #  request_status = exec_net.requests[0].wait()
     #  res = exec_net.requests[0].output_blobs['prob']
     #  ```
-    cpdef async_infer(self, inputs=None):
+    cpdef async_infer(self, inputs=None, share_inputs=False):
         if inputs is not None:
-            self._fill_inputs(inputs)
+            self._fill_inputs(inputs, share_inputs)
         with nogil:
             deref(self.impl).infer_async()
 
@@ -1307,9 +1348,16 @@ cdef class InferRequest:
             raise ValueError(f"Batch size should be positive integer number but {size} specified")
         deref(self.impl).setBatch(size)
 
-    def _fill_inputs(self, inputs):
+    def _fill_inputs(self, inputs, share_inputs=False):
         for k, v in inputs.items():
             assert k in self._inputs_list, f"No input with name {k} found in network"
+            if share_inputs and self._share_input(k, v):
+                continue
+            if k in self._shared_inputs:
+                # don't write to the array shared by the previous call, give the request its own memory back
+                tensor_desc = self.input_blobs[k].tensor_desc
+                self.set_blob(k, Blob(TensorDesc(tensor_desc.precision, tensor_desc.dims, tensor_desc.layout)))
+                self._shared_inputs.discard(k)
             if self._inputs_is_dynamic[k]:
                 shape = expand_dims_to_corresponding_layout(v.shape, self.input_blobs[k].tensor_desc.layout)
                 self.input_blobs[k].set_shape(shape)
@@ -1318,6 +1366,23 @@ cdef class InferRequest:
             else:
                 self.input_blobs[k].buffer[:] = v
 
+    def _share_input(self, name, array):
+        if not isinstance(array, np.ndarray) or not array.flags["C_CONTIGUOUS"]:
+            return False
+        tensor_desc = self.input_blobs[name].tensor_desc
+        if array.dtype != format_map.get(tensor_desc.precision):
+            return False
+        if self._inputs_is_dynamic[name]:
+            dims = expand_dims_to_corresponding_layout(array.shape, tensor_desc.layout)
+        elif tuple(array.shape) == tuple(tensor_desc.dims):
+            dims = tensor_desc.dims
+        else:
+            return False
+        # the blob keeps the array alive while it is set to the request
+        self.set_blob(name, Blob(TensorDesc(tensor_desc.precision, dims, tensor_desc.layout), array))
+        self._shared_inputs.add(name)
+        return True
+
 
 ## This class contains the information about the network model read from IR and allows you to manipulate with
 #  some model parameters such as layers affinity and output layers.
@@ -493,6 +493,14 @@ int InferenceEnginePython::IEExecNetwork::getIdleRequestId() {
     return request_queue_ptr->getIdleRequestId();
 }
 
+void InferenceEnginePython::IEExecNetwork::enableCompletionQueue() {
+    request_queue_ptr->enableCompletionQueue();
+}
+
+std::vector<std::pair<int, int>> InferenceEnginePython::IEExecNetwork::getCompletedRequests(int64_t timeout) {
+    return request_queue_ptr->getCompletedRequests(timeout);
+}
+
 int InferenceEnginePython::IdleInferRequestQueue::wait(int num_requests, int64_t timeout) {
     std::unique_lock<std::mutex> lock(mutex);
     if (timeout > 0) {
@@ -513,6 +521,36 @@ void InferenceEnginePython::IdleInferRequestQueue::setRequestIdle(int index) {
     cv.notify_all();
 }
 
+void InferenceEnginePython::IdleInferRequestQueue::setRequestCompleted(int index, int status) {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle_ids.emplace_back(index);
+    if (completion_queue_enabled) {
+        completed.emplace_back(index, status);
+    }
+    cv.notify_all();
+}
+
+void InferenceEnginePython::IdleInferRequestQueue::enableCompletionQueue() {
+    std::lock_guard<std::mutex> lock(mutex);
+    completion_queue_enabled = true;
+}
+
+std::vector<std::pair<int, int>> InferenceEnginePython::IdleInferRequestQueue::getCompletedRequests(int64_t timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (timeout > 0) {
+        cv.wait_for(lock, std::chrono::milliseconds(timeout), [this]() {
+            return !completed.empty();
+        });
+    } else if (timeout < 0) {
+        cv.wait(lock, [this]() {
+            return !completed.empty();
+        });
+    }
+    std::vector<std::pair<int, int>> result;
+    result.swap(completed);
+    return result;
+}
+
 void InferenceEnginePython::IdleInferRequestQueue::setRequestBusy(int index) {
     std::lock_guard<std::mutex> lock(mutex);
     idle_ids.remove(index);
@@ -554,7 +592,7 @@ void InferenceEnginePython::IEExecNetwork::createInferRequests(int num_requests)
                     if (infer_request.user_callback) {
                         infer_request.user_callback(infer_request.user_data, code);
                     }
-                    infer_request.request_queue_ptr->setRequestIdle(infer_request.index);
+                    infer_request.request_queue_ptr->setRequestCompleted(infer_request.index, code);
                 });
     }
 }
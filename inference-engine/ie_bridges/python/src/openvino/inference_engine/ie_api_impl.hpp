@@ -77,16 +77,23 @@ struct IENetwork {
 
 struct IdleInferRequestQueue {
     std::list<size_t> idle_ids;
+    // (request index, status) of the finished async requests, collected only when enabled
+    std::vector<std::pair<int, int>> completed;
+    bool completion_queue_enabled = false;
     std::mutex mutex;
     std::condition_variable cv;
 
     void setRequestIdle(int index);
     void setRequestBusy(int index);
+    void setRequestCompleted(int index, int status);
 
     int wait(int num_requests, int64_t timeout);
 
     int getIdleRequestId();
 
+    void enableCompletionQueue();
+    std::vector<std::pair<int, int>> getCompletedRequests(int64_t timeout);
+
     using Ptr = std::shared_ptr<IdleInferRequestQueue>;
 };
 
@@ -148,6 +155,9 @@ struct IEExecNetwork {
     int wait(int num_requests, int64_t timeout);
     int getIdleRequestId();
 
+    void enableCompletionQueue();
+    std::vector<std::pair<int, int>> getCompletedRequests(int64_t timeout);
+
     void createInferRequests(int num_requests);
 
     // binds plugin to InputInfo and Data, so that they can be destroyed before plugin (ussue 28996)
@@ -7,6 +7,7 @@ from libcpp.string cimport string
 from libcpp.vector cimport vector
 from libcpp.map cimport map
 from libcpp.memory cimport unique_ptr, shared_ptr, weak_ptr
+from libcpp.utility cimport pair
 from libc.stdint cimport int64_t, uint8_t
 
 
@@ -163,6 +164,8 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         object getConfig(const string & metric_name) except +
         int wait(int num_requests, int64_t timeout) nogil
         int getIdleRequestId() nogil
+        void enableCompletionQueue() nogil
+        vector[pair[int, int]] getCompletedRequests(int64_t timeout) nogil
         shared_ptr[CExecutableNetwork] getPluginLink() except +
 
     cdef cppclass IENetwork:
@@ -194,6 +194,25 @@ def test_wait_for_callback(device):
     assert callbacks_info['finished'] == num_requests
 
 
+def test_get_completed_requests(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(model=test_net_xml, weights=test_net_bin)
+    num_requests = 3
+    exec_net = ie_core.load_network(net, device, num_requests=num_requests)
+    exec_net.enable_completion_queue()
+    img = read_image()
+    for id in range(num_requests):
+        exec_net.start_async(request_id=id, inputs={'data': img})
+    completed = []
+    while len(completed) < num_requests:
+        completed += exec_net.get_completed_requests()
+    assert sorted(id for id, _ in completed) == list(range(num_requests))
+    assert all(status == ie.StatusCode.OK for _, status in completed)
+    assert exec_net.get_completed_requests(timeout=0) == []
+    del exec_net
+    del ie_core
+
+
 def test_wrong_request_id(device):
     ie_core = ie.IECore()
     net = ie_core.read_network(model=test_net_xml, weights=test_net_bin)
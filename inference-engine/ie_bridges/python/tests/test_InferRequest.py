@@ -155,6 +155,25 @@ def test_infer(device):
     del net
 
 
+def test_infer_share_inputs(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    img = np.ascontiguousarray(read_image())
+    request = exec_net.requests[0]
+    request.infer({'data': img}, share_inputs=True)
+    assert np.argmax(request.output_blobs['fc_out'].buffer) == 2
+    assert np.shares_memory(request.input_blobs['data'].buffer, img)
+    # the next copying call must not write to the array shared before
+    img_copy = img.copy()
+    request.infer({'data': np.zeros_like(img)})
+    assert not np.shares_memory(request.input_blobs['data'].buffer, img)
+    assert np.array_equal(img, img_copy)
+    del exec_net
+    del ie_core
+    del net
+
+
 def test_async_infer_default_timeout(device):
     ie_core = ie.IECore()
     net = ie_core.read_network(test_net_xml, test_net_bin)
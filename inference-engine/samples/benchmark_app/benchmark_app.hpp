@@ -78,6 +78,11 @@ static const char infer_latency_percentile_message[] =
     "Optional. Defines the percentile to be reported in latency metric. The valid range is [1, 100]. The default value "
     "is 50 (median).";
 
+/// @brief message for additional latency percentiles settings
+static const char infer_latency_percentiles_message[] =
+    "Optional. Comma separated list of additional percentiles to be reported in latency metric, "
+    "for example \"50,90,99,99.9\". The valid range of each value is (0, 100].";
+
 /// @brief message for enforcing of BF16 execution where it is possible
 static const char enforce_bf16_message[] =
     "Optional. By default floating point operations execution in bfloat16 precision are enforced "
@@ -128,6 +133,11 @@ static const char report_folder_message[] = "Optional. Path to a folder where st
 static const char exec_graph_path_message[] =
     "Optional. Path to a file where to store executable graph information serialized.";
 
+// @brief message for latency_report option
+static const char latency_report_message[] =
+    "Optional. Path to a .json file where to store latency percentiles, histogram and start/end timestamps "
+    "of each executed infer request.";
+
 // @brief message for progress bar option
 static const char progress_message[] =
     "Optional. Show progress bar (can affect performance measurement). Default values is "
@@ -171,6 +181,28 @@ static const char cache_dir_message[] = "Optional. Enables caching of loaded mod
 static const char load_from_file_message[] = "Optional. Loads model from file directly without ReadNetwork."
                                              "All CNNNetwork options (like re-shape) will be ignored";
 
+// @brief message for open-loop load generation
+static const char rate_message[] =
+    "Optional. Number of requests per second to start regardless of the requests completion (open-loop load). "
+    "Requests wait in a queue if all infer requests are busy; the queueing time is reported separately from the "
+    "inference time. By default as many requests are started as -nireq allows (closed-loop load).";
+
+// @brief message for arrival distribution
+static const char arrival_message[] =
+    "Optional. Distribution of the time between the request arrivals for -rate and -rate_sweep: \"fixed\" "
+    "(default) or \"poisson\" (exponentially distributed inter-arrival times).";
+
+// @brief message for rate sweep
+static const char rate_sweep_message[] =
+    "Optional. Comma separated list of rates, for example \"50,100,200,400\". The open-loop measurement is repeated "
+    "for -t seconds with each rate and a latency-vs-load table is reported.";
+
+// @brief message for multi-model benchmarking
+static const char multi_model_config_message[] =
+    "Optional. Path to a config file to benchmark several models concurrently on one Core instead of -m. "
+    "Each line of the file describes a model as \"<path> [d=<device>] [nireq=<integer>] [nstreams=<integer>] "
+    "[fps=<number>]\", where fps limits the rate of the model inferences. Lines starting with # are ignored.";
+
 // @brief message for quantization bits
 static const char gna_qb_message[] = "Optional. Weight bits for quantization:  8 or 16 (default)";
 
@@ -248,6 +280,9 @@ DEFINE_string(nstreams, "", infer_num_streams_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint32(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Additional percentiles which will be reported in latency metric
+DEFINE_string(latency_percentiles, "", infer_latency_percentiles_message);
+
 /// @brief Enforces bf16 execution with bfloat16 precision on systems having this capability
 DEFINE_bool(enforcebf16, false, enforce_bf16_message);
 
@@ -270,6 +305,9 @@ DEFINE_string(report_folder, "", report_folder_message);
 /// @brief Path to a file where to store executable graph information serialized
 DEFINE_string(exec_graph_path, "", exec_graph_path_message);
 
+/// @brief Path to a file where to store latency distribution and requests timeline
+DEFINE_string(latency_report, "", latency_report_message);
+
 /// @brief Define flag for showing progress bar <br>
 DEFINE_bool(progress, false, progress_message);
 
@@ -316,6 +354,18 @@ DEFINE_string(cache_dir, "", cache_dir_message);
 /// @brief Define flag for load network from model file by name without ReadNetwork <br>
 DEFINE_bool(load_from_file, false, load_from_file_message);
 
+/// @brief Define parameter for the open-loop requests rate <br>
+DEFINE_double(rate, 0, rate_message);
+
+/// @brief Define parameter for the distribution of the request arrivals <br>
+DEFINE_string(arrival, "fixed", arrival_message);
+
+/// @brief Define parameter for the list of rates to sweep <br>
+DEFINE_string(rate_sweep, "", rate_sweep_message);
+
+/// @brief Define parameter for the multi-model benchmarking config <br>
+DEFINE_string(multi_model_config, "", multi_model_config_message);
+
 /// @brief Define flag for using input image scale <br>
 DEFINE_string(iscale, "", input_image_scale_message);
 
@@ -350,6 +400,11 @@ static void showUsage() {
     std::cout << "    -cache_dir \"<path>\"        " << cache_dir_message << std::endl;
     std::cout << "    -load_from_file           " << load_from_file_message << std::endl;
     std::cout << "    -latency_percentile       " << infer_latency_percentile_message << std::endl;
+    std::cout << "    -latency_percentiles \"<list>\"  " << infer_latency_percentiles_message << std::endl;
+    std::cout << "    -multi_model_config \"<path>\"  " << multi_model_config_message << std::endl;
+    std::cout << "    -rate \"<number>\"          " << rate_message << std::endl;
+    std::cout << "    -arrival \"<fixed/poisson>\"  " << arrival_message << std::endl;
+    std::cout << "    -rate_sweep \"<list>\"      " << rate_sweep_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
@@ -362,6 +417,7 @@ static void showUsage() {
     std::cout << "    -report_type \"<type>\"     " << report_type_message << std::endl;
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
+    std::cout << "    -latency_report \"<path>\"  " << latency_report_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
 #ifdef USE_OPENCV
     std::cout << "    -dump_config              " << dump_config_message << std::endl;
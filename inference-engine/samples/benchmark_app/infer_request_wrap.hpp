@@ -42,7 +42,13 @@ public:
     }
 
     void startAsync() {
+        startAsync(Time::now());
+    }
+
+    /// @brief Starts the request arrived at `arrivalTime`, the time between them is reported as the queueing time
+    void startAsync(Time::time_point arrivalTime) {
         _startTime = Time::now();
+        _arrivalTime = std::min(arrivalTime, _startTime);
         _request.StartAsync();
     }
 
@@ -52,6 +58,7 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.Infer();
         _endTime = Time::now();
         _callbackQueue(_id, getExecutionTimeInMilliseconds());
@@ -69,13 +76,27 @@ public:
         _request.SetBlob(name, data);
     }
 
+    Time::time_point getStartTime() const {
+        return _startTime;
+    }
+
+    Time::time_point getEndTime() const {
+        return _endTime;
+    }
+
     double getExecutionTimeInMilliseconds() const {
         auto execTime = std::chrono::duration_cast<ns>(_endTime - _startTime);
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double getQueueingTimeInMilliseconds() const {
+        auto queueingTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(queueingTime.count()) * 0.000001;
+    }
+
 private:
     InferenceEngine::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -108,6 +129,8 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queueingTimes.clear();
+        _executions.clear();
     }
 
     double getDurationInMilliseconds() {
@@ -117,6 +140,8 @@ public:
     void putIdleRequest(size_t id, const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        _queueingTimes.push_back(requests.at(id)->getQueueingTimeInMilliseconds());
+        _executions.push_back({id, requests.at(id)->getStartTime(), requests.at(id)->getEndTime()});
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -144,13 +169,41 @@ public:
         return _latencies;
     }
 
+    /// @brief Returns the time each completed execution waited for an idle request, in the order of getLatencies()
+    std::vector<double> getQueueingTimes() {
+        return _queueingTimes;
+    }
+
+    /// @brief Returns start and end of each completed execution relatively to the first started one
+    std::vector<RequestTimestamps> getTimeline() {
+        std::vector<RequestTimestamps> timeline;
+        timeline.reserve(_executions.size());
+        for (const auto& execution : _executions) {
+            timeline.push_back({execution.id, toMilliseconds(execution.start - _startTime),
+                                toMilliseconds(execution.end - _startTime)});
+        }
+        return timeline;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
+    struct Execution {
+        size_t id;
+        Time::time_point start;
+        Time::time_point end;
+    };
+
+    static double toMilliseconds(Time::duration duration) {
+        return std::chrono::duration_cast<ns>(duration).count() * 0.000001;
+    }
+
     std::queue<size_t> _idleIds;
     std::mutex _mutex;
     std::condition_variable _cv;
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queueingTimes;
+    std::vector<Execution> _executions;
 };
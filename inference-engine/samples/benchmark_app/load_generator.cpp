@@ -0,0 +1,148 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "load_generator.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "utils.hpp"
+
+ns ArrivalTimes::next() {
+    if (_first) {
+        _first = false;
+    } else {
+        _arrivalSeconds += _poisson ? _interval(_generator) : 1.0 / _rate;
+    }
+    return std::chrono::duration_cast<ns>(std::chrono::duration<double>(_arrivalSeconds));
+}
+
+size_t runOpenLoop(InferRequestsQueue& queue, ArrivalTimes& arrivals, size_t niter, uint64_t durationNanoseconds) {
+    size_t iteration = 0;
+    const auto startTime = Time::now();
+    while (true) {
+        const auto arrivalTime = startTime + arrivals.next();
+        const auto arrivalNanoseconds =
+            static_cast<uint64_t>(std::chrono::duration_cast<ns>(arrivalTime - startTime).count());
+        const bool iterationsDone = niter == 0 || iteration >= niter;
+        const bool durationDone = durationNanoseconds == 0 || arrivalNanoseconds >= durationNanoseconds;
+        if (iterationsDone && durationDone) {
+            break;
+        }
+
+        std::this_thread::sleep_until(arrivalTime);
+        auto inferRequest = queue.getIdleRequest();
+        if (!inferRequest) {
+            IE_THROW() << "No idle Infer Requests!";
+        }
+        // rethrows the exception of the previous execution, if any
+        inferRequest->wait();
+        inferRequest->startAsync(arrivalTime);
+        iteration++;
+    }
+    queue.waitAll();
+    return iteration;
+}
+
+std::vector<double> parseRates(const std::string& rates_string) {
+    std::vector<double> rates;
+    for (auto& item : split(rates_string, ',')) {
+        double rate = 0.0;
+        try {
+            rate = std::stod(item);
+        } catch (const std::exception&) {
+            throw std::logic_error("Can't parse rate value '" + item + "'");
+        }
+        if (rate <= 0.0) {
+            throw std::logic_error("The rate value " + item + " is incorrect. The rate should be positive.");
+        }
+        rates.push_back(rate);
+    }
+    return rates;
+}
+
+std::vector<double> getResponseTimes(const std::vector<double>& latencies, const std::vector<double>& queueingTimes) {
+    std::vector<double> responseTimes(latencies.size());
+    std::transform(latencies.begin(), latencies.end(), queueingTimes.begin(), responseTimes.begin(),
+                   [](double latency, double queueingTime) {
+                       return latency + queueingTime;
+                   });
+    return responseTimes;
+}
+
+void runRateSweep(InferRequestsQueue& queue,
+                  const std::vector<double>& rates,
+                  bool poisson,
+                  uint64_t durationNanoseconds,
+                  size_t batchSize,
+                  const std::vector<double>& percentiles,
+                  const std::shared_ptr<StatisticsReport>& statistics) {
+    auto reportedPercentiles = percentiles;
+    if (reportedPercentiles.empty()) {
+        reportedPercentiles = {50, 99};
+    }
+
+    std::stringstream header;
+    header << std::setw(12) << "rate" << std::setw(14) << "throughput" << std::setw(14) << "queueing";
+    for (auto percentile : reportedPercentiles) {
+        std::stringstream label;
+        label << "p" << percentile;
+        header << std::setw(12) << label.str();
+    }
+
+    std::vector<std::string> rows;
+    for (auto rate : rates) {
+        slog::info << "Measuring " << (poisson ? "Poisson" : "fixed") << " arrivals with rate " << rate
+                   << " requests/s" << slog::endl;
+        queue.resetTimes();
+        ArrivalTimes arrivals(rate, poisson);
+        const auto iterations = runOpenLoop(queue, arrivals, 0, durationNanoseconds);
+
+        const auto latencies = queue.getLatencies();
+        const auto queueingTimes = queue.getQueueingTimes();
+        const auto responseTimes = getResponseTimes(latencies, queueingTimes);
+        const double fps = batchSize * 1000.0 * iterations / queue.getDurationInMilliseconds();
+
+        std::stringstream row;
+        row << std::fixed << std::setprecision(2) << std::setw(12) << rate << std::setw(14) << fps << std::setw(14)
+            << getPercentile(queueingTimes, 50);
+        for (auto percentile : reportedPercentiles) {
+            row << std::setw(12) << getPercentile(responseTimes, percentile);
+        }
+        rows.push_back(row.str());
+
+        if (statistics) {
+            std::stringstream prefix;
+            prefix << "rate " << rate << " ";
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                      {
+                                          {prefix.str() + "throughput", double_to_string(fps)},
+                                          {prefix.str() + "queueing time (ms)",
+                                           double_to_string(getPercentile(queueingTimes, 50))},
+                                      });
+            for (auto percentile : reportedPercentiles) {
+                std::stringstream label;
+                label << prefix.str() << "latency (" << percentile << " percentile) (ms)";
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {{label.str(), double_to_string(getPercentile(responseTimes, percentile))}});
+            }
+        }
+    }
+
+    std::cout << "Latency vs load (rate in requests/s, throughput in FPS, median queueing time and "
+                 "end-to-end latency percentiles in ms):"
+              << std::endl;
+    std::cout << header.str() << std::endl;
+    for (const auto& row : rows) {
+        std::cout << row << std::endl;
+    }
+}
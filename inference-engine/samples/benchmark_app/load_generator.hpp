@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "infer_request_wrap.hpp"
+#include "statistics_report.hpp"
+
+/// @brief Generates arrival times of the requests with the fixed or exponentially distributed intervals
+class ArrivalTimes final {
+public:
+    ArrivalTimes(double rate, bool poisson) : _rate(rate), _poisson(poisson), _interval(rate) {}
+
+    /// @brief Returns arrival time of the next request relatively to the first one
+    ns next();
+
+private:
+    double _rate;
+    bool _poisson;
+    // the fixed seed makes the arrival times of the runs the same
+    std::mt19937 _generator;
+    std::exponential_distribution<double> _interval;
+    double _arrivalSeconds = 0.0;
+    bool _first = true;
+};
+
+/// @brief Starts the requests at the arrival times regardless of completion of the previous ones, until `niter`
+/// requests are completed or `durationNanoseconds` elapsed (the one of them which is not 0, both if both are set).
+/// Requests arrived when all infer requests are busy wait for the idle one. Returns number of started requests.
+size_t runOpenLoop(InferRequestsQueue& queue, ArrivalTimes& arrivals, size_t niter, uint64_t durationNanoseconds);
+
+/// @brief Measures the open-loop load with each of the rates for `durationNanoseconds` and prints latency-vs-load
+/// table: achieved throughput, queueing time and end-to-end latency percentiles for every rate
+void runRateSweep(InferRequestsQueue& queue,
+                  const std::vector<double>& rates,
+                  bool poisson,
+                  uint64_t durationNanoseconds,
+                  size_t batchSize,
+                  const std::vector<double>& percentiles,
+                  const std::shared_ptr<StatisticsReport>& statistics);
+
+/// @brief Parses comma separated list of positive rates
+std::vector<double> parseRates(const std::string& rates_string);
+
+/// @brief Returns the time from arrival to completion of every request: the queueing time and the inference latency
+std::vector<double> getResponseTimes(const std::vector<double>& latencies, const std::vector<double>& queueingTimes);
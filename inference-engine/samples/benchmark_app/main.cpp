@@ -20,6 +20,8 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "load_generator.hpp"
+#include "multi_model.hpp"
 #include "progress_bar.hpp"
 #include "remote_blobs_filling.hpp"
 #include "statistics_report.hpp"
@@ -48,15 +50,21 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
+    if (FLAGS_m.empty() && FLAGS_multi_model_config.empty()) {
         showUsage();
-        throw std::logic_error("Model is required but not set. Please set -m option.");
+        throw std::logic_error("Model is required but not set. Please set -m or -multi_model_config option.");
+    }
+
+    if (!FLAGS_multi_model_config.empty() && (!FLAGS_m.empty() || FLAGS_api == "sync" || FLAGS_niter != 0)) {
+        throw std::logic_error("-multi_model_config option can't be used with -m, -niter or sync API. "
+                               "Models are benchmarked asynchronously for -t seconds.");
     }
 
     if (FLAGS_latency_percentile > 100 || FLAGS_latency_percentile < 1) {
         showUsage();
         throw std::logic_error("The percentile value is incorrect. The applicable values range is [1, 100].");
     }
+    parseLatencyPercentiles(FLAGS_latency_percentiles);
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
@@ -76,6 +84,24 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if (FLAGS_rate < 0) {
+        throw std::logic_error("The rate value is incorrect. The rate should be positive.");
+    }
+    if (FLAGS_arrival != "fixed" && FLAGS_arrival != "poisson") {
+        throw std::logic_error("Incorrect arrival distribution. Please set -arrival option to `fixed` or `poisson` "
+                               "value.");
+    }
+    if ((FLAGS_rate > 0 || !FLAGS_rate_sweep.empty()) && FLAGS_api != "async") {
+        throw std::logic_error("-rate and -rate_sweep options can be used with async API only.");
+    }
+    if (FLAGS_rate > 0 && !FLAGS_rate_sweep.empty()) {
+        throw std::logic_error("-rate and -rate_sweep options can't be used together.");
+    }
+    if (!FLAGS_rate_sweep.empty() && FLAGS_niter != 0) {
+        throw std::logic_error("-rate_sweep option measures each rate for -t seconds and can't be used with -niter.");
+    }
+    parseRates(FLAGS_rate_sweep);
+
     bool isNetworkCompiled = fileExt(FLAGS_m) == "blob";
     bool isPrecisionSet = !(FLAGS_ip.empty() && FLAGS_op.empty() && FLAGS_iop.empty());
     if (isNetworkCompiled && isPrecisionSet) {
@@ -111,13 +137,6 @@ static void next_step(const std::string additional_info = "") {
               << (additional_info.empty() ? "" : " (" + additional_info + ")") << std::endl;
 }
 
-template <typename T>
-T getMedianValue(const std::vector<T>& vec, std::size_t percentile) {
-    std::vector<T> sortedVec(vec);
-    std::sort(sortedVec.begin(), sortedVec.end());
-    return sortedVec[(sortedVec.size() / 100) * percentile];
-}
-
 /**
  * @brief The entry point of the benchmark application
  */
@@ -209,6 +228,25 @@ int main(int argc, char* argv[]) {
         slog::info << "Device info: " << slog::endl;
         std::cout << ie.GetVersions(device_name) << std::endl;
 
+        if (!FLAGS_multi_model_config.empty()) {
+            // the models and their settings are described by the config, the single model steps are skipped
+            const auto configs = parseMultiModelConfig(FLAGS_multi_model_config);
+            uint32_t duration_seconds = FLAGS_t;
+            if (duration_seconds == 0) {
+                for (const auto& model_config : configs)
+                    duration_seconds = std::max(duration_seconds,
+                                                deviceDefaultDeviceDurationInSeconds(model_config.device));
+            }
+            benchmarkMultipleModels(ie,
+                                    configs,
+                                    duration_seconds,
+                                    parseLatencyPercentiles(FLAGS_latency_percentiles),
+                                    statistics);
+            if (statistics)
+                statistics->dump();
+            return 0;
+        }
+
         // ----------------- 3. Setting device configuration
         // -----------------------------------------------------------
         next_step();
@@ -549,7 +587,8 @@ int main(int argc, char* argv[]) {
 
         // Iteration limit
         uint32_t niter = FLAGS_niter;
-        if ((niter > 0) && (FLAGS_api == "async")) {
+        // the open-loop load starts requests at the given rate, so the iterations are not aligned
+        if ((niter > 0) && (FLAGS_api == "async") && (FLAGS_rate == 0)) {
             niter = ((niter + nireq - 1) / nireq) * nireq;
             if (FLAGS_niter != niter) {
                 slog::warn << "Number of iterations was aligned by request number from " << FLAGS_niter << " to "
@@ -672,48 +711,72 @@ int main(int argc, char* argv[]) {
          * executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.getIdleRequest();
-            if (!inferRequest) {
-                IE_THROW() << "No idle Infer Requests!";
-            }
+        const bool poisson = FLAGS_arrival == "poisson";
+        if (!FLAGS_rate_sweep.empty()) {
+            progressBar.finish();
+            runRateSweep(inferRequestsQueue,
+                         parseRates(FLAGS_rate_sweep),
+                         poisson,
+                         duration_nanoseconds,
+                         batchSize,
+                         parseLatencyPercentiles(FLAGS_latency_percentiles),
+                         statistics);
+            if (statistics)
+                statistics->dump();
+            return 0;
+        }
 
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
-            } else {
-                // As the inference request is currently idle, the wait() adds no
-                // additional overhead (and should return immediately). The primary
-                // reason for calling the method is exception checking/re-throwing.
-                // Callback, that governs the actual execution can handle errors as
-                // well, but as it uses just error codes it has no details like ‘what()’
-                // method of `std::exception` So, rechecking for any exceptions here.
-                inferRequest->wait();
-                inferRequest->startAsync();
-            }
-            iteration++;
+        if (FLAGS_rate > 0) {
+            ArrivalTimes arrivals(FLAGS_rate, poisson);
+            iteration = runOpenLoop(inferRequestsQueue, arrivals, niter, duration_nanoseconds);
+        } else {
+            while ((niter != 0LL && iteration < niter) ||
+                   (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                   (FLAGS_api == "async" && iteration % nireq != 0)) {
+                inferRequest = inferRequestsQueue.getIdleRequest();
+                if (!inferRequest) {
+                    IE_THROW() << "No idle Infer Requests!";
+                }
 
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+                if (FLAGS_api == "sync") {
+                    inferRequest->infer();
+                } else {
+                    // As the inference request is currently idle, the wait() adds no
+                    // additional overhead (and should return immediately). The primary
+                    // reason for calling the method is exception checking/re-throwing.
+                    // Callback, that governs the actual execution can handle errors as
+                    // well, but as it uses just error codes it has no details like ‘what()’
+                    // method of `std::exception` So, rechecking for any exceptions here.
+                    inferRequest->wait();
+                    inferRequest->startAsync();
+                }
+                iteration++;
 
-            if (niter > 0) {
-                progressBar.addProgress(1);
-            } else {
-                // calculate how many progress intervals are covered by current
-                // iteration. depends on the current iteration time and time of each
-                // progress interval. Previously covered progress intervals must be
-                // skipped.
-                auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
-                size_t newProgress = execTime / progressIntervalTime - progressCnt;
-                progressBar.addProgress(newProgress);
-                progressCnt += newProgress;
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+
+                if (niter > 0) {
+                    progressBar.addProgress(1);
+                } else {
+                    // calculate how many progress intervals are covered by current
+                    // iteration. depends on the current iteration time and time of each
+                    // progress interval. Previously covered progress intervals must be
+                    // skipped.
+                    auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
+                    size_t newProgress = execTime / progressIntervalTime - progressCnt;
+                    progressBar.addProgress(newProgress);
+                    progressCnt += newProgress;
+                }
             }
         }
 
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies(), FLAGS_latency_percentile);
+        const auto latencies = inferRequestsQueue.getLatencies();
+        const auto queueingTimes = inferRequestsQueue.getQueueingTimes();
+        const auto responseTimes = getResponseTimes(latencies, queueingTimes);
+        double latency = getPercentile(latencies, FLAGS_latency_percentile);
+        const auto percentiles = parseLatencyPercentiles(FLAGS_latency_percentiles);
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
         double fps =
             (FLAGS_api == "sync") ? batchSize * 1000.0 / latency : batchSize * 1000.0 * iteration / totalDuration;
@@ -735,6 +798,28 @@ int main(int argc, char* argv[]) {
                                           {
                                               {latency_label, double_to_string(latency)},
                                           });
+                for (auto percentile : percentiles) {
+                    std::stringstream label;
+                    label << "latency (" << percentile << " percentile) (ms)";
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {{label.str(), double_to_string(getPercentile(latencies, percentile))}});
+                }
+            }
+            if (FLAGS_rate > 0) {
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {
+                                              {"queueing time (ms)",
+                                               double_to_string(getPercentile(queueingTimes, 50))},
+                                              {"response latency (ms)",
+                                               double_to_string(getPercentile(responseTimes, 50))},
+                                          });
+                for (auto percentile : percentiles) {
+                    std::stringstream label;
+                    label << "response latency (" << percentile << " percentile) (ms)";
+                    statistics->addParameters(
+                        StatisticsReport::Category::EXECUTION_RESULTS,
+                        {{label.str(), double_to_string(getPercentile(responseTimes, percentile))}});
+                }
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {{"throughput", double_to_string(fps)}});
@@ -763,6 +848,13 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        if (!FLAGS_latency_report.empty()) {
+            // the full distribution is stored even if no additional percentiles are requested
+            const std::vector<double> default_percentiles = {50, 90, 99, 99.9};
+            LatencyReport(latencies, inferRequestsQueue.getTimeline())
+                .dump(FLAGS_latency_report, percentiles.empty() ? default_percentiles : percentiles);
+        }
+
         if (perf_counts) {
             std::vector<std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>> perfCounts;
             for (size_t ireq = 0; ireq < nireq; ireq++) {
@@ -791,6 +883,21 @@ int main(int argc, char* argv[]) {
                 std::cout << " (" << FLAGS_latency_percentile << " percentile):    ";
             }
             std::cout << double_to_string(latency) << " ms" << std::endl;
+            for (auto percentile : percentiles) {
+                std::cout << "Latency (" << percentile << " percentile):    "
+                          << double_to_string(getPercentile(latencies, percentile)) << " ms" << std::endl;
+            }
+        }
+        if (FLAGS_rate > 0) {
+            // the time from the request arrival to its completion is the latency observed by the client
+            std::cout << "Queueing time:    " << double_to_string(getPercentile(queueingTimes, 50)) << " ms"
+                      << std::endl;
+            std::cout << "Response latency:    " << double_to_string(getPercentile(responseTimes, 50)) << " ms"
+                      << std::endl;
+            for (auto percentile : percentiles) {
+                std::cout << "Response latency (" << percentile << " percentile):    "
+                          << double_to_string(getPercentile(responseTimes, percentile)) << " ms" << std::endl;
+            }
         }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
     } catch (const std::exception& ex) {
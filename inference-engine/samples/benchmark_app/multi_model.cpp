@@ -0,0 +1,240 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "multi_model.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <inference_engine.hpp>
+#include <map>
+#include <memory>
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "infer_request_wrap.hpp"
+#include "inputs_filling.hpp"
+#include "utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+struct ModelBenchmark {
+    ModelBenchmarkConfig config;
+    std::string name;
+    ExecutableNetwork exeNetwork;
+    std::unique_ptr<InferRequestsQueue> queue;
+    size_t batchSize = 1;
+    size_t iterations = 0;
+    std::string error;
+};
+
+void runModel(ModelBenchmark& benchmark, uint64_t durationNanoseconds) {
+    try {
+        auto& queue = *benchmark.queue;
+        const auto nireq = queue.requests.size();
+        const auto startTime = Time::now();
+        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+        // the last requests are executed in the same conditions as the other ones
+        while ((uint64_t)execTime < durationNanoseconds || benchmark.iterations % nireq != 0) {
+            if (benchmark.config.fpsLimit > 0) {
+                const auto plannedStart =
+                    std::chrono::duration<double>(benchmark.iterations / benchmark.config.fpsLimit);
+                std::this_thread::sleep_until(startTime + std::chrono::duration_cast<ns>(plannedStart));
+            }
+            auto inferRequest = queue.getIdleRequest();
+            if (!inferRequest) {
+                IE_THROW() << "No idle Infer Requests!";
+            }
+            // rethrows the exception of the previous execution, if any
+            inferRequest->wait();
+            inferRequest->startAsync();
+            benchmark.iterations++;
+            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+        }
+        queue.waitAll();
+    } catch (const std::exception& ex) {
+        benchmark.error = ex.what();
+        benchmark.queue->waitAll();
+    }
+}
+
+void reportResults(const std::string& label,
+                   size_t iterations,
+                   double durationMs,
+                   double fps,
+                   const std::vector<double>& latencies,
+                   const std::vector<double>& percentiles,
+                   const std::shared_ptr<StatisticsReport>& statistics) {
+    std::cout << label << ":" << std::endl;
+    std::cout << "    Count:      " << iterations << " iterations" << std::endl;
+    std::cout << "    Duration:   " << double_to_string(durationMs) << " ms" << std::endl;
+    std::cout << "    Latency:    " << double_to_string(getPercentile(latencies, 50)) << " ms" << std::endl;
+    for (auto percentile : percentiles) {
+        std::cout << "    Latency (" << percentile << " percentile):    "
+                  << double_to_string(getPercentile(latencies, percentile)) << " ms" << std::endl;
+    }
+    std::cout << "    Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+
+    if (statistics) {
+        statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                  {
+                                      {label + " total execution time (ms)", double_to_string(durationMs)},
+                                      {label + " total number of iterations", std::to_string(iterations)},
+                                      {label + " latency (ms)", double_to_string(getPercentile(latencies, 50))},
+                                  });
+        for (auto percentile : percentiles) {
+            std::stringstream key;
+            key << label << " latency (" << percentile << " percentile) (ms)";
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                      {{key.str(), double_to_string(getPercentile(latencies, percentile))}});
+        }
+        statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                  {{label + " throughput", double_to_string(fps)}});
+    }
+}
+
+}  // namespace
+
+std::vector<ModelBenchmarkConfig> parseMultiModelConfig(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::logic_error("Can't open multi-model config file: " + path);
+    }
+
+    std::vector<ModelBenchmarkConfig> configs;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream tokens(line);
+        std::string token;
+        if (!(tokens >> token) || token.front() == '#')
+            continue;
+
+        ModelBenchmarkConfig config;
+        config.model = token;
+        while (tokens >> token) {
+            auto pos = token.find('=');
+            if (pos == std::string::npos) {
+                throw std::logic_error("Can't parse multi-model config option '" + token + "', key=value is expected");
+            }
+            const auto key = token.substr(0, pos);
+            const auto value = token.substr(pos + 1);
+            try {
+                if (key == "d") {
+                    config.device = value;
+                } else if (key == "nireq") {
+                    config.nireq = static_cast<uint32_t>(std::stoul(value));
+                } else if (key == "nstreams") {
+                    std::stoul(value);
+                    config.nstreams = value;
+                } else if (key == "fps") {
+                    config.fpsLimit = std::stod(value);
+                } else {
+                    throw std::logic_error("Unknown multi-model config option '" + key + "'");
+                }
+            } catch (const std::invalid_argument&) {
+                throw std::logic_error("Can't parse multi-model config option '" + token + "'");
+            }
+        }
+        configs.push_back(config);
+    }
+    if (configs.empty()) {
+        throw std::logic_error("No models are described in multi-model config file: " + path);
+    }
+    return configs;
+}
+
+void benchmarkMultipleModels(Core& ie,
+                             const std::vector<ModelBenchmarkConfig>& configs,
+                             uint32_t durationSeconds,
+                             const std::vector<double>& percentiles,
+                             const std::shared_ptr<StatisticsReport>& statistics) {
+    std::vector<ModelBenchmark> benchmarks(configs.size());
+    for (size_t i = 0; i < configs.size(); i++) {
+        auto& benchmark = benchmarks[i];
+        benchmark.config = configs[i];
+        const auto& device = benchmark.config.device;
+
+        CNNNetwork cnnNetwork = ie.ReadNetwork(benchmark.config.model);
+        benchmark.name = "[" + std::to_string(i) + "] " + cnnNetwork.getName() + " on " + device;
+        benchmark.batchSize = cnnNetwork.getBatchSize() != 0 ? cnnNetwork.getBatchSize() : 1;
+        auto appInputsInfo = getInputsInfo<InputInfo::Ptr>("", "", 0, "", "", cnnNetwork.getInputsInfo());
+        for (auto& item : cnnNetwork.getInputsInfo()) {
+            if (appInputsInfo.at(item.first).isImage()) {
+                appInputsInfo.at(item.first).precision = Precision::U8;
+                item.second->setPrecision(Precision::U8);
+            }
+        }
+
+        // streams are set per network, so the models loaded to the same device may use different numbers of them
+        std::map<std::string, std::string> networkConfig;
+        if (!benchmark.config.nstreams.empty()) {
+            if (parseDevices(device).size() != 1 || device.find(':') != std::string::npos) {
+                throw std::logic_error("nstreams can be set for the models loaded to a single device only, got " +
+                                       device);
+            }
+            networkConfig[device + "_THROUGHPUT_STREAMS"] = benchmark.config.nstreams;
+        }
+
+        auto startTime = Time::now();
+        benchmark.exeNetwork = ie.LoadNetwork(cnnNetwork, device, networkConfig);
+        slog::info << "Load network " << benchmark.name << " took " << double_to_string(get_total_ms_time(startTime))
+                   << " ms" << slog::endl;
+
+        uint32_t nireq = benchmark.config.nireq;
+        if (nireq == 0) {
+            nireq = benchmark.exeNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        }
+        benchmark.queue.reset(new InferRequestsQueue(benchmark.exeNetwork, nireq));
+        fillBlobs({}, benchmark.batchSize, appInputsInfo, benchmark.queue->requests);
+
+        // warming up - out of scope
+        benchmark.queue->getIdleRequest()->startAsync();
+        benchmark.queue->waitAll();
+        benchmark.queue->resetTimes();
+
+        slog::info << "Model " << benchmark.name << ": " << nireq << " inference requests"
+                   << (benchmark.config.nstreams.empty() ? "" : ", " + benchmark.config.nstreams + " streams")
+                   << (benchmark.config.fpsLimit > 0 ? ", limited to " + double_to_string(benchmark.config.fpsLimit) +
+                                                           " FPS"
+                                                     : "")
+                   << slog::endl;
+    }
+
+    slog::info << "Start inference of " << benchmarks.size() << " models concurrently, limits: "
+               << durationSeconds * 1000LL << " ms duration" << slog::endl;
+    std::vector<std::thread> threads;
+    for (auto& benchmark : benchmarks) {
+        threads.emplace_back(runModel, std::ref(benchmark), durationSeconds * 1000000000ULL);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& benchmark : benchmarks) {
+        if (!benchmark.error.empty()) {
+            throw std::runtime_error("Inference of " + benchmark.name + " failed: " + benchmark.error);
+        }
+    }
+
+    size_t totalIterations = 0;
+    double totalFps = 0, totalDuration = 0;
+    std::vector<double> allLatencies;
+    for (auto& benchmark : benchmarks) {
+        const auto latencies = benchmark.queue->getLatencies();
+        const double duration = benchmark.queue->getDurationInMilliseconds();
+        const double fps = benchmark.batchSize * 1000.0 * benchmark.iterations / duration;
+        reportResults(benchmark.name, benchmark.iterations, duration, fps, latencies, percentiles, statistics);
+
+        totalIterations += benchmark.iterations;
+        totalFps += fps;
+        totalDuration = std::max(totalDuration, duration);
+        allLatencies.insert(allLatencies.end(), latencies.begin(), latencies.end());
+    }
+    reportResults("All models", totalIterations, totalDuration, totalFps, allLatencies, percentiles, statistics);
+}
@@ -0,0 +1,36 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <inference_engine.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "statistics_report.hpp"
+
+/// @brief Settings of one model benchmarked concurrently with the others
+struct ModelBenchmarkConfig {
+    std::string model;
+    std::string device = "CPU";
+    /// @brief 0 means the number optimal for the device
+    uint32_t nireq = 0;
+    /// @brief empty means the device default
+    std::string nstreams;
+    /// @brief maximum number of inferences per second, 0 means unlimited
+    double fpsLimit = 0;
+};
+
+/// @brief Parses the models description lines "<path> [d=<device>] [nireq=<integer>] [nstreams=<integer>]
+/// [fps=<number>]", lines starting with # are skipped
+std::vector<ModelBenchmarkConfig> parseMultiModelConfig(const std::string& path);
+
+/// @brief Loads all models to the same Core and infers them concurrently, each model from its own thread with its
+/// own infer requests, for the given duration. Prints throughput and latency for every model and aggregated ones.
+void benchmarkMultipleModels(InferenceEngine::Core& ie,
+                             const std::vector<ModelBenchmarkConfig>& configs,
+                             uint32_t durationSeconds,
+                             const std::vector<double>& percentiles,
+                             const std::shared_ptr<StatisticsReport>& statistics);
@@ -5,7 +5,12 @@
 #include "statistics_report.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
 #include <map>
+#include <numeric>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -141,3 +146,72 @@ void StatisticsReport::dumpPerformanceCounters(const std::vector<PerformaceCount
     }
     slog::info << "Performance counters report is stored to " << dumper.getFilename() << slog::endl;
 }
+
+double getPercentile(std::vector<double> latencies, double percentile) {
+    if (latencies.empty())
+        return 0.0;
+    std::sort(latencies.begin(), latencies.end());
+    auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * latencies.size()));
+    return latencies[std::min(std::max<size_t>(rank, 1), latencies.size()) - 1];
+}
+
+std::map<uint64_t, size_t> LatencyReport::getHistogram() const {
+    std::map<uint64_t, size_t> histogram;
+    for (auto latency : _latencies) {
+        auto value = static_cast<uint64_t>(latency * 1000.0);
+        uint64_t bucket_width = 1;
+        while (value >= 100 * bucket_width)
+            bucket_width *= 10;
+        histogram[value - value % bucket_width]++;
+    }
+    return histogram;
+}
+
+void LatencyReport::dump(const std::string& path, const std::vector<double>& percentiles) const {
+    std::ofstream file(path);
+    if (!file.is_open())
+        throw std::runtime_error("Can't open file " + path + " to store the latency report");
+    file << std::fixed << std::setprecision(3);
+
+    file << "{" << std::endl;
+    file << "    \"count\": " << _latencies.size() << "," << std::endl;
+    if (!_latencies.empty()) {
+        auto minmax = std::minmax_element(_latencies.begin(), _latencies.end());
+        auto avg = std::accumulate(_latencies.begin(), _latencies.end(), 0.0) / _latencies.size();
+        file << "    \"min_ms\": " << *minmax.first << "," << std::endl;
+        file << "    \"max_ms\": " << *minmax.second << "," << std::endl;
+        file << "    \"avg_ms\": " << avg << "," << std::endl;
+    }
+
+    file << "    \"percentiles_ms\": {";
+    for (size_t i = 0; i < percentiles.size(); i++) {
+        std::ostringstream key;
+        key << percentiles[i];
+        file << (i ? ", " : "") << "\"" << key.str() << "\": " << getPercentile(_latencies, percentiles[i]);
+    }
+    file << "}," << std::endl;
+
+    file << "    \"histogram\": [";
+    bool first = true;
+    for (const auto& bucket : getHistogram()) {
+        uint64_t bucket_width = 1;
+        while (bucket.first >= 100 * bucket_width)
+            bucket_width *= 10;
+        file << (first ? "" : ",") << std::endl
+             << "        {\"lower_ms\": " << bucket.first / 1000.0 << ", \"upper_ms\": "
+             << (bucket.first + bucket_width) / 1000.0 << ", \"count\": " << bucket.second << "}";
+        first = false;
+    }
+    file << std::endl << "    ]," << std::endl;
+
+    file << "    \"requests\": [";
+    for (size_t i = 0; i < _timeline.size(); i++) {
+        file << (i ? "," : "") << std::endl
+             << "        {\"request_id\": " << _timeline[i].request_id << ", \"start_ms\": " << _timeline[i].start_ms
+             << ", \"end_ms\": " << _timeline[i].end_ms << "}";
+    }
+    file << std::endl << "    ]" << std::endl;
+    file << "}" << std::endl;
+
+    slog::info << "Latency report is stored to " << path << slog::endl;
+}
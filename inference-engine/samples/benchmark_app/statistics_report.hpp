@@ -68,3 +68,31 @@ private:
     // csv separator
     std::string _separator;
 };
+
+/// @brief Start and end of the infer request execution relatively to the beginning of the measurements
+struct RequestTimestamps {
+    size_t request_id;
+    double start_ms;
+    double end_ms;
+};
+
+/// @brief Returns the nearest-rank percentile of the latencies
+double getPercentile(std::vector<double> latencies, double percentile);
+
+/// @brief Responsible for dumping of the latency distribution and the requests timeline to .json file
+class LatencyReport {
+public:
+    LatencyReport(std::vector<double> latencies, std::vector<RequestTimestamps> timeline)
+        : _latencies(std::move(latencies)),
+          _timeline(std::move(timeline)) {}
+
+    void dump(const std::string& path, const std::vector<double>& percentiles) const;
+
+private:
+    // buckets of the histogram keep two significant digits of the latency in microseconds,
+    // so the relative error does not depend on the latency magnitude
+    std::map<uint64_t, size_t> getHistogram() const;
+
+    std::vector<double> _latencies;
+    std::vector<RequestTimestamps> _timeline;
+};
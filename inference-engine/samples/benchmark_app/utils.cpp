@@ -105,6 +105,23 @@ std::vector<float> splitFloat(const std::string& s, char delim) {
     return result;
 }
 
+std::vector<double> parseLatencyPercentiles(const std::string& percentiles_string) {
+    std::vector<double> percentiles;
+    for (auto& item : split(percentiles_string, ',')) {
+        double percentile = 0.0;
+        try {
+            percentile = std::stod(item);
+        } catch (const std::exception&) {
+            throw std::logic_error("Can't parse latency percentile value '" + item + "'");
+        }
+        if (percentile <= 0.0 || percentile > 100.0) {
+            throw std::logic_error("The percentile value " + item + " is incorrect. The applicable values range is (0, 100].");
+        }
+        percentiles.push_back(percentile);
+    }
+    return percentiles;
+}
+
 std::vector<std::string> parseDevices(const std::string& device_string) {
     std::string comma_separated_devices = device_string;
     if (comma_separated_devices.find(":") != std::string::npos) {
@@ -0,0 +1,590 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <blob_factory.hpp>
+#include <ie_icore.hpp>
+#include <ie_metric_helpers.hpp>
+#include <ie_ngraph_utils.hpp>
+#include <ie_plugin_config.hpp>
+#include "auto_batch.hpp"
+
+namespace AutoBatchPlugin {
+using namespace InferenceEngine;
+
+namespace {
+
+std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
+                                                const std::map<std::string, std::string>& local) {
+    for (auto&& kvp : local) {
+        config[kvp.first] = kvp.second;
+    }
+    return config;
+}
+
+const std::vector<std::string> supported_configKeys = {
+    CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
+    CONFIG_KEY(AUTO_BATCH_TIMEOUT)
+};
+
+// the not full batch is executed request by request after this time since the first request of the batch came
+constexpr auto defaultTimeout = "1000";
+
+unsigned int ParseTimeoutValue(const std::string& value) {
+    int timeout = 0;
+    try {
+        timeout = std::stoi(value);
+    } catch (const std::logic_error&) {
+        IE_THROW() << "Unsupported " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " value: " << value;
+    }
+    if (timeout < 0) {
+        IE_THROW() << "Value for the " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " must be >= 0, while " << value
+                   << " is passed";
+    }
+    return static_cast<unsigned int>(timeout);
+}
+
+// the slot of the batched blob that corresponds to the request with the batchId
+Blob::Ptr CreateSlotBlob(const Blob::Ptr& batchedBlob, std::size_t batchId, std::size_t batchSize) {
+    auto memoryBlob = as<MemoryBlob>(batchedBlob);
+    if (nullptr == memoryBlob) {
+        IE_THROW(NotImplemented) << "BATCH device supports the memory blobs of the device requests only";
+    }
+    auto desc = memoryBlob->getTensorDesc();
+    auto dims = desc.getDims();
+    dims[0] = 1;
+    const auto slotSize = memoryBlob->byteSize() / batchSize;
+    return make_blob_with_precision(TensorDesc{desc.getPrecision(), dims, desc.getLayout()},
+                                    memoryBlob->rwmap().as<uint8_t*>() + slotSize * batchId);
+}
+
+}  // namespace
+
+// ------------------------------AutoBatchInferRequest----------------------------
+AutoBatchInferRequest::AutoBatchInferRequest(const InputsDataMap&                          networkInputs,
+                                             const OutputsDataMap&                         networkOutputs,
+                                             AutoBatchExecutableNetwork::WorkerInferRequest& workerRequest,
+                                             int                                           batchId,
+                                             int                                           numBatch)
+        : IInferRequestInternal(networkInputs, networkOutputs),
+          _workerInferRequest(workerRequest),
+          _batchId(batchId),
+          _batchSize(numBatch) {
+    // by default the request works with its slot of the batched request blobs, so no copies are made
+    for (const auto& it : _networkInputs) {
+        _batchedInputs[it.first] = CreateSlotBlob(_workerInferRequest._inferRequestBatched->GetBlob(it.first), _batchId, _batchSize);
+        _inputs[it.first] = _batchedInputs[it.first];
+    }
+    for (const auto& it : _networkOutputs) {
+        _batchedOutputs[it.first] = CreateSlotBlob(_workerInferRequest._inferRequestBatched->GetBlob(it.first), _batchId, _batchSize);
+        _outputs[it.first] = _batchedOutputs[it.first];
+    }
+}
+
+void AutoBatchInferRequest::SetBlobsToAnotherRequest(const SoIInferRequestInternal& req) {
+    for (const auto& it : _networkInputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        auto blob = GetBlob(name);
+        if (req->GetBlob(name) != blob)
+            req->SetBlob(name, blob);
+    }
+    for (const auto& it : _networkOutputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        auto blob = GetBlob(name);
+        if (req->GetBlob(name) != blob)
+            req->SetBlob(name, blob);
+    }
+}
+
+void AutoBatchInferRequest::CopyBlobIfNeeded(const Blob::Ptr& src, const Blob::Ptr& dst) {
+    auto srcMemory = as<MemoryBlob>(src);
+    auto dstMemory = as<MemoryBlob>(dst);
+    if (nullptr == srcMemory || nullptr == dstMemory) {
+        IE_THROW(NotImplemented) << "BATCH device supports the memory blobs only";
+    }
+    auto dstHolder = dstMemory->wmap();
+    auto srcHolder = srcMemory->rmap();
+    auto dstPtr = dstHolder.as<uint8_t*>();
+    auto srcPtr = srcHolder.as<const uint8_t*>();
+    if (dstPtr == srcPtr) {
+        return;
+    }
+    if (srcMemory->byteSize() != dstMemory->byteSize()) {
+        IE_THROW() << "The size of the blob (" << srcMemory->byteSize() << " bytes) does not match the size of the batch slot ("
+                   << dstMemory->byteSize() << " bytes)";
+    }
+    std::memcpy(dstPtr, srcPtr, srcMemory->byteSize());
+}
+
+void AutoBatchInferRequest::CopyInputsIfNeeded() {
+    for (const auto& it : _networkInputs) {
+        CopyBlobIfNeeded(_inputs[it.first], _batchedInputs[it.first]);
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsIfNeeded() {
+    for (const auto& it : _networkOutputs) {
+        CopyBlobIfNeeded(_batchedOutputs[it.first], _outputs[it.first]);
+    }
+}
+
+std::map<std::string, InferenceEngineProfileInfo> AutoBatchInferRequest::GetPerformanceCounts() const {
+    IE_THROW(NotImplemented);
+}
+
+void AutoBatchInferRequest::InferImpl() {
+    IE_THROW(NotImplemented);
+}
+
+// ------------------------------AutoBatchAsyncInferRequest----------------------------
+AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
+    const AutoBatchInferRequest::Ptr&    inferRequest,
+    const bool                           needPerfCounters,
+    const SoIInferRequestInternal&       inferRequestWithoutBatch,
+    const ITaskExecutor::Ptr&            callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+    _inferRequestWithoutBatch(inferRequestWithoutBatch),
+    _inferRequest{inferRequest},
+    _needPerfCounters{needPerfCounters} {
+    // this executor passes the task (checking the result) to the worker thread which starts the inference
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(AutoBatchAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            auto& workerInferRequest = _this->_inferRequest->_workerInferRequest;
+            {
+                std::lock_guard<std::mutex> lock(workerInferRequest._mutex);
+                workerInferRequest._tasks.push(std::make_pair(_this, std::move(task)));
+            }
+            workerInferRequest._cond.notify_one();
+        };
+        AutoBatchAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        // the user blobs (e.g. set with SetBlob) are copied to the slot of the batched request
+        { /*TaskExecutor*/ std::make_shared<ImmediateExecutor>(), /*task*/ [this] {
+              _inferRequest->CopyInputsIfNeeded();
+        }},
+        // final task in the pipeline:
+        { /*TaskExecutor*/ std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
+              if (_wasBatchedRequestUsed) {
+                  auto& workerInferRequest = _inferRequest->_workerInferRequest;
+                  if (nullptr != workerInferRequest._exceptionPtr) {
+                      std::rethrow_exception(workerInferRequest._exceptionPtr);
+                  }
+                  _inferRequest->CopyOutputsIfNeeded();
+                  if (_needPerfCounters)
+                      _perfMap = workerInferRequest._inferRequestBatched->GetPerformanceCounts();
+              } else {
+                  if (nullptr != _exceptionPtr) {
+                      std::rethrow_exception(_exceptionPtr);
+                  }
+                  if (_needPerfCounters)
+                      _perfMap = _inferRequestWithoutBatch->GetPerformanceCounts();
+              }
+        }}
+    };
+}
+
+void AutoBatchAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+std::map<std::string, InferenceEngineProfileInfo> AutoBatchAsyncInferRequest::GetPerformanceCounts() const {
+    CheckState();
+    return _perfMap;
+}
+
+AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
+    StopAndWait();
+}
+
+// ------------------------------AutoBatchExecutableNetwork----------------------------
+AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(const SoExecutableNetworkInternal&                  networkForDevice,
+                                                       const SoExecutableNetworkInternal&                  networkForDeviceWithoutBatch,
+                                                       const DeviceInformation&                            networkDevice,
+                                                       const std::unordered_map<std::string, Parameter>&   config,
+                                                       const bool                                          needPerfCounters) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
+    _device{networkDevice},
+    _network{networkForDevice},
+    _networkWithoutBatch{networkForDeviceWithoutBatch},
+    _config{config},
+    _needPerfCounters{needPerfCounters} {
+    auto timeout = _config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
+    _timeOut = ParseTimeoutValue(timeout == _config.end() ? std::string(defaultTimeout) : timeout->second.as<std::string>());
+}
+
+AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
+    _terminate = true;
+    for (auto&& workerRequest : _workerRequests) {
+        // the lock makes sure the worker either sees the flag or already waits for the notification
+        { std::lock_guard<std::mutex> lock(workerRequest->_mutex); }
+        workerRequest->_cond.notify_all();
+        workerRequest->_thread.join();
+    }
+    _workerRequests.clear();
+}
+
+void AutoBatchExecutableNetwork::GenerateWorker() {
+    auto workerRequestPtr = std::make_shared<WorkerInferRequest>();
+    auto& workerRequest = *workerRequestPtr;
+    workerRequest._batchSize = _device.batchForDevice;
+    workerRequest._inferRequestBatched = { _network._so, _network->CreateInferRequest() };
+    workerRequest._inferRequestBatched->SetCallback([&workerRequest] (std::exception_ptr exceptionPtr) {
+        workerRequest._exceptionPtr = exceptionPtr;
+        // the batched request is already idle, so the completed requests may start the next batch right away
+        auto completionTasks = std::move(workerRequest._completionTasks);
+        workerRequest._completionTasks.clear();
+        for (auto&& task : completionTasks) {
+            task();
+        }
+    });
+    workerRequest._thread = std::thread([this, &workerRequest] {
+        RunWorker(workerRequest);
+    });
+    _workerRequests.push_back(workerRequestPtr);
+}
+
+void AutoBatchExecutableNetwork::RunWorker(WorkerInferRequest& workerRequest) {
+    const auto batchSize = static_cast<std::size_t>(workerRequest._batchSize);
+    while (!_terminate) {
+        std::unique_lock<std::mutex> lock(workerRequest._mutex);
+        workerRequest._cond.wait(lock, [&] { return _terminate || !workerRequest._tasks.empty(); });
+        // the timeout is counted from the first request of the batch
+        const bool fullBatch = workerRequest._cond.wait_for(lock, std::chrono::milliseconds(_timeOut.load()), [&] {
+            return _terminate || workerRequest._tasks.size() == batchSize;
+        });
+        if (_terminate) {
+            break;
+        }
+        std::vector<std::pair<AutoBatchAsyncInferRequest*, Task>> tasks;
+        while (!workerRequest._tasks.empty()) {
+            tasks.push_back(std::move(workerRequest._tasks.front()));
+            workerRequest._tasks.pop();
+        }
+        lock.unlock();
+
+        if (fullBatch) {
+            for (auto&& t : tasks) {
+                t.first->_wasBatchedRequestUsed = true;
+                workerRequest._completionTasks.push_back(std::move(t.second));
+            }
+            try {
+                workerRequest._inferRequestBatched->StartAsync();
+            } catch (...) {
+                workerRequest._exceptionPtr = std::current_exception();
+                auto completionTasks = std::move(workerRequest._completionTasks);
+                workerRequest._completionTasks.clear();
+                for (auto&& task : completionTasks) {
+                    task();
+                }
+            }
+        } else {
+            // not enough requests came in time, so every request is executed with the network without batch
+            for (auto&& t : tasks) {
+                auto request = t.first;
+                request->_wasBatchedRequestUsed = false;
+                request->_exceptionPtr = nullptr;
+                auto task = std::move(t.second);
+                try {
+                    request->_inferRequest->SetBlobsToAnotherRequest(request->_inferRequestWithoutBatch);
+                    request->_inferRequestWithoutBatch->SetCallback([request, task] (std::exception_ptr exceptionPtr) {
+                        request->_exceptionPtr = exceptionPtr;
+                        task();
+                    });
+                    request->_inferRequestWithoutBatch->StartAsync();
+                } catch (...) {
+                    request->_exceptionPtr = std::current_exception();
+                    task();
+                }
+            }
+        }
+    }
+}
+
+IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
+                                                                              OutputsDataMap networkOutputs) {
+    std::lock_guard<std::mutex> lock(_workerRequestsMutex);
+    // every batchForDevice requests share the batched request of the device, each request owns the slot of the batch
+    const auto batchId = _numRequestsCreated % _device.batchForDevice;
+    if (0 == batchId) {
+        GenerateWorker();
+    }
+    _numRequestsCreated++;
+    return std::make_shared<AutoBatchInferRequest>(networkInputs, networkOutputs, *_workerRequests.back(),
+                                                   static_cast<int>(batchId), _device.batchForDevice);
+}
+
+IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequest() {
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    SoIInferRequestInternal inferRequestWithoutBatch = { _networkWithoutBatch._so, _networkWithoutBatch->CreateInferRequest() };
+    return std::make_shared<AutoBatchAsyncInferRequest>(std::static_pointer_cast<AutoBatchInferRequest>(syncRequestImpl),
+                                                        _needPerfCounters,
+                                                        inferRequestWithoutBatch,
+                                                        _callbackExecutor);
+}
+
+std::shared_ptr<RemoteContext> AutoBatchExecutableNetwork::GetContext() const {
+    return _network->GetContext();
+}
+
+void AutoBatchExecutableNetwork::SetConfig(const std::map<std::string, Parameter>& config) {
+    auto timeout = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
+    if (timeout == config.end() || config.size() > 1) {
+        IE_THROW() << "The only config supported for the Network's SetConfig is " << CONFIG_KEY(AUTO_BATCH_TIMEOUT);
+    } else {
+        _timeOut = ParseTimeoutValue(timeout->second.as<std::string>());
+        _config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = timeout->second;
+    }
+}
+
+Parameter AutoBatchExecutableNetwork::GetConfig(const std::string& name) const {
+    auto it = _config.find(name);
+    if (it != _config.end()) {
+        return it->second;
+    } else {
+        // find config key among networks config keys
+        auto param = _network->GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        for (auto&& configKey : param.as<std::vector<std::string>>()) {
+            if (configKey == name) {
+                return _network->GetConfig(configKey);
+            }
+        }
+        IE_THROW(NotFound) << name << " not found in the ExecutableNetwork config";
+    }
+}
+
+Parameter AutoBatchExecutableNetwork::GetMetric(const std::string& name) const {
+    if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        // every batched request of the device needs batchForDevice requests to run full batches
+        unsigned int res = 0u;
+        try {
+            res = _network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        } catch (const InferenceEngine::Exception& iie) {
+            IE_THROW()
+                << "Every device used with the Auto-Batching should "
+                << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
+                << "Failed to query the metric for the " << _device.deviceName << " with error:" << iie.what();
+        }
+        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, _device.batchForDevice * res);
+    } else if (name == METRIC_KEY(NETWORK_NAME)) {
+        IE_SET_METRIC_RETURN(NETWORK_NAME, _network->GetMetric(METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(NETWORK_NAME),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+        });
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, {CONFIG_KEY(AUTO_BATCH_TIMEOUT)});
+    } else {
+        IE_THROW() << "Unsupported Network metric: " << name;
+    }
+}
+
+// ------------------------------AutoBatchInferencePlugin----------------------------
+static const Version version = {{2, 1}, CI_BUILD_NUMBER, "AutoBatchPlugin"};
+IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
+
+AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
+    _pluginName = "BATCH";
+    _config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = defaultTimeout;
+}
+
+std::map<std::string, std::string> AutoBatchInferencePlugin::GetSupportedConfig(
+    const std::map<std::string, std::string>& config, const DeviceName& deviceName) const {
+    std::vector<std::string> supportedConfigKeys = GetCore()->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    std::map<std::string, std::string> supportedConfig;
+    for (auto&& key : supportedConfigKeys) {
+        auto itKey = config.find(key);
+        if (config.end() != itKey) {
+            supportedConfig[key] = itKey->second;
+        }
+    }
+    return supportedConfig;
+}
+
+DeviceInformation AutoBatchInferencePlugin::ParseBatchDevice(const std::string& deviceWithBatch) {
+    auto openingBracket = deviceWithBatch.find_first_of('(');
+    auto closingBracket = deviceWithBatch.find_first_of(')', openingBracket);
+    auto deviceName = deviceWithBatch.substr(0, openingBracket);
+
+    if (closingBracket == std::string::npos || openingBracket >= closingBracket) {
+        IE_THROW() << "The batch size is not set for the '" << deviceName << "' device, use the "
+                   << CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) << " value like " << deviceName << "(4)";
+    }
+    int batch = 0;
+    try {
+        batch = std::stoi(deviceWithBatch.substr(openingBracket + 1, closingBracket - openingBracket - 1));
+    } catch (const std::logic_error&) {
+        IE_THROW() << "Unsupported " << CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) << " value: " << deviceWithBatch;
+    }
+    if (batch <= 0) {
+        IE_THROW() << "Batch value for '" << deviceName << "' must be > 0, while " << batch << " is passed";
+    }
+    return { deviceName, {}, batch };
+}
+
+DeviceInformation AutoBatchInferencePlugin::ParseMetaDevice(const std::string& devicesBatchCfg,
+                                                            const std::map<std::string, std::string>& config) const {
+    auto metaDevice = ParseBatchDevice(devicesBatchCfg);
+
+    DeviceIDParser deviceParser(metaDevice.deviceName);
+    std::map<std::string, std::string> tconfig = mergeConfigs(_config, config);
+    // set device ID if any
+    std::string deviceIDLocal = deviceParser.getDeviceID();
+    if (!deviceIDLocal.empty()) {
+        tconfig[PluginConfigParams::KEY_DEVICE_ID] = deviceIDLocal;
+    }
+    metaDevice.config = GetSupportedConfig(tconfig, deviceParser.getDeviceName());
+    return metaDevice;
+}
+
+void AutoBatchInferencePlugin::CheckConfig(const std::map<std::string, std::string>& config) {
+    for (auto&& kvp : config) {
+        const auto& name = kvp.first;
+        if (supported_configKeys.end() == std::find(supported_configKeys.begin(), supported_configKeys.end(), name)) {
+            IE_THROW() << "Unsupported config key: " << name;
+        }
+        if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT)) {
+            ParseTimeoutValue(kvp.second);
+        } else {
+            ParseBatchDevice(kvp.second);
+        }
+    }
+}
+
+void AutoBatchInferencePlugin::SetConfig(const std::map<std::string, std::string>& config) {
+    CheckConfig(config);
+    for (auto&& kvp : config) {
+        _config[kvp.first] = kvp.second;
+    }
+}
+
+Parameter AutoBatchInferencePlugin::GetConfig(const std::string& name,
+                                              const std::map<std::string, Parameter>& options) const {
+    if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), name)) {
+        auto it = _config.find(name);
+        if (it == _config.end()) {
+            IE_THROW() << "Value for " << name << " is not set";
+        } else {
+            return { it->second };
+        }
+    } else {
+        IE_THROW() << "Unsupported config key: " << name;
+    }
+}
+
+Parameter AutoBatchInferencePlugin::GetMetric(const std::string& name,
+                                              const std::map<std::string, Parameter>& options) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(FULL_DEVICE_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
+        std::string device_name = { GetName() };
+        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, device_name);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, supported_configKeys);
+    } else {
+        IE_THROW() << "Unsupported metric key " << name;
+    }
+}
+
+IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(const CNNNetwork& network,
+                                                                             const std::map<std::string, std::string>& config) {
+    if (GetCore() == nullptr) {
+        IE_THROW() << "Please, work with " << GetName() << " device via InferenceEngine::Core object";
+    }
+    if (network.getFunction() == nullptr) {
+        IE_THROW() << GetName() << " device supports just ngraph network representation";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    CheckConfig(fullConfig);
+    auto deviceBatch = fullConfig.find(CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG));
+    if (deviceBatch == fullConfig.end()) {
+        IE_THROW() << CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) << " key is not set for " << GetName() << " device";
+    }
+    auto metaDevice = ParseMetaDevice(deviceBatch->second, fullConfig);
+    const auto& deviceName = metaDevice.deviceName;
+    const auto& deviceConfig = metaDevice.config;
+
+    // the batch is set to the dimension 0 of every input, so every output has to get the batch the same way
+    CNNNetwork clonedNetwork(InferenceEngine::details::cloneNetwork(network));
+    auto shapes = clonedNetwork.getInputShapes();
+    for (const auto& input : clonedNetwork.getInputsInfo()) {
+        const auto layout = input.second->getTensorDesc().getLayout();
+        if (layout != Layout::NC && layout != Layout::NCHW && layout != Layout::NHWC &&
+            layout != Layout::NCDHW && layout != Layout::NDHWC) {
+            IE_THROW(NotImplemented) << GetName() << " device supports the inputs with the batch dimension only, while the '"
+                                     << input.first << "' input has the " << layout << " layout";
+        }
+        auto& shape = shapes[input.first];
+        if (shape[0] != 1) {
+            IE_THROW(NotImplemented) << GetName() << " device supports the networks with the batch 1 only, while the '"
+                                     << input.first << "' input has the batch " << shape[0];
+        }
+        shape[0] = metaDevice.batchForDevice;
+    }
+    clonedNetwork.reshape(shapes);
+    for (const auto& output : clonedNetwork.getOutputsInfo()) {
+        const auto& dims = output.second->getTensorDesc().getDims();
+        if (dims.empty() || dims[0] != static_cast<std::size_t>(metaDevice.batchForDevice)) {
+            IE_THROW(NotImplemented) << GetName() << " device supports the networks with the batch in every output only, while the '"
+                                     << output.first << "' output is not batched";
+        }
+    }
+
+    auto executableNetworkWithBatch = GetCore()->LoadNetwork(clonedNetwork, deviceName, deviceConfig);
+    auto executableNetworkWithoutBatch = GetCore()->LoadNetwork(network, deviceName, deviceConfig);
+
+    std::unordered_map<std::string, Parameter> networkConfig;
+    networkConfig.insert(*deviceBatch);
+    networkConfig.insert(*fullConfig.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT)));
+    auto perfCount = deviceConfig.find(PluginConfigParams::KEY_PERF_COUNT);
+    const bool enablePerfCounters = perfCount != deviceConfig.end() && perfCount->second == PluginConfigParams::YES;
+    return std::make_shared<AutoBatchExecutableNetwork>(executableNetworkWithBatch,
+                                                        executableNetworkWithoutBatch,
+                                                        metaDevice,
+                                                        networkConfig,
+                                                        enablePerfCounters);
+}
+
+QueryNetworkResult AutoBatchInferencePlugin::QueryNetwork(const CNNNetwork& network,
+                                                          const std::map<std::string, std::string>& config) const {
+    if (GetCore() == nullptr) {
+        IE_THROW() << "Please, work with " << GetName() << " device via InferencEngine::Core object";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto deviceBatch = fullConfig.find(CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG));
+    if (deviceBatch == fullConfig.end()) {
+        IE_THROW() << CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) << " key is not set for " << GetName() << " device";
+    }
+    auto metaDevice = ParseMetaDevice(deviceBatch->second, fullConfig);
+    auto queryResult = GetCore()->QueryNetwork(network, metaDevice.deviceName, metaDevice.config);
+    for (auto&& layerQr : queryResult.supportedLayersMap) {
+        layerQr.second = GetName();
+    }
+    return queryResult;
+}
+
+}  // namespace AutoBatchPlugin
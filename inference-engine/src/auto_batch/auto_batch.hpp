@@ -0,0 +1,165 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
+#include "ie_icore.hpp"
+
+namespace AutoBatchPlugin {
+
+using DeviceName = std::string;
+
+struct DeviceInformation {
+    DeviceName deviceName;
+    std::map<std::string, std::string> config;
+    int batchForDevice;
+};
+
+class AutoBatchAsyncInferRequest;
+
+class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchExecutableNetwork>;
+    // The batched request of the device network, shared by batchForDevice user requests (each owns a slot of the batch).
+    // The worker thread collects the requests started by the users and runs the batched request when all of them came
+    // or, on the timeout, runs the collected ones with the not batched network one by one
+    struct WorkerInferRequest {
+        using Ptr = std::shared_ptr<WorkerInferRequest>;
+        InferenceEngine::SoIInferRequestInternal                                     _inferRequestBatched;
+        int                                                                          _batchSize;
+        std::queue<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>>    _tasks;  // guarded by the _mutex
+        std::vector<InferenceEngine::Task>                                           _completionTasks;
+        std::thread                                                                  _thread;
+        std::condition_variable                                                      _cond;
+        std::mutex                                                                   _mutex;
+        std::exception_ptr                                                           _exceptionPtr = nullptr;
+    };
+
+    explicit AutoBatchExecutableNetwork(const InferenceEngine::SoExecutableNetworkInternal&                   networkForDevice,
+                                        const InferenceEngine::SoExecutableNetworkInternal&                   networkForDeviceWithoutBatch,
+                                        const DeviceInformation&                                              networkDevice,
+                                        const std::unordered_map<std::string, InferenceEngine::Parameter>&    config,
+                                        const bool                                                            needPerfCounters = false);
+
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) override;
+    InferenceEngine::Parameter GetConfig(const std::string& name) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name) const override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                       InferenceEngine::OutputsDataMap networkOutputs) override;
+    std::shared_ptr<InferenceEngine::RemoteContext> GetContext() const override;
+    virtual ~AutoBatchExecutableNetwork();
+
+protected:
+    void GenerateWorker();
+    void RunWorker(WorkerInferRequest& workerRequest);
+
+    std::atomic_bool                                                _terminate = {false};
+    DeviceInformation                                               _device;
+    InferenceEngine::SoExecutableNetworkInternal                    _network;
+    InferenceEngine::SoExecutableNetworkInternal                    _networkWithoutBatch;
+    std::vector<WorkerInferRequest::Ptr>                            _workerRequests;
+    std::mutex                                                      _workerRequestsMutex;
+    std::unordered_map<std::string, InferenceEngine::Parameter>     _config;
+    bool                                                            _needPerfCounters = false;
+    std::size_t                                                     _numRequestsCreated = 0;
+    std::atomic<unsigned int>                                       _timeOut = {0};  // in ms
+};
+
+class AutoBatchInferRequest : public InferenceEngine::IInferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<AutoBatchInferRequest>;
+    explicit AutoBatchInferRequest(const InferenceEngine::InputsDataMap&          networkInputs,
+                                   const InferenceEngine::OutputsDataMap&         networkOutputs,
+                                   AutoBatchExecutableNetwork::WorkerInferRequest& workerRequest,
+                                   int                                            batchId,
+                                   int                                            numBatch);
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+    void InferImpl() override;
+
+    // Batch-Device impl specific: sets the data (blobs from the device request to the batched device request)
+    void SetBlobsToAnotherRequest(const InferenceEngine::SoIInferRequestInternal& req);
+    // the user blobs which are not the views to the slot of the batched request are copied
+    void CopyInputsIfNeeded();
+    void CopyOutputsIfNeeded();
+
+    AutoBatchExecutableNetwork::WorkerInferRequest&     _workerInferRequest;
+
+protected:
+    static void CopyBlobIfNeeded(const InferenceEngine::Blob::Ptr& src, const InferenceEngine::Blob::Ptr& dst);
+
+    InferenceEngine::BlobMap    _batchedInputs;   // views to the slot of the batched request blobs
+    InferenceEngine::BlobMap    _batchedOutputs;
+    std::size_t                 _batchId;
+    std::size_t                 _batchSize;
+};
+
+class AutoBatchAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchAsyncInferRequest>;
+
+    explicit AutoBatchAsyncInferRequest(const AutoBatchInferRequest::Ptr&               inferRequest,
+                                        const bool                                      needPerfCounters,
+                                        const InferenceEngine::SoIInferRequestInternal& inferRequestWithoutBatch,
+                                        const InferenceEngine::ITaskExecutor::Ptr&      callbackExecutor);
+    void Infer_ThreadUnsafe() override;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+    virtual ~AutoBatchAsyncInferRequest();
+
+    InferenceEngine::SoIInferRequestInternal                            _inferRequestWithoutBatch;
+    AutoBatchInferRequest::Ptr                                          _inferRequest;
+    // set by the worker thread: whether the request was executed as a part of the batch or on its own
+    bool                                                                _wasBatchedRequestUsed = false;
+    std::exception_ptr                                                  _exceptionPtr = nullptr;
+
+protected:
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>  _perfMap;
+    bool                                                                _needPerfCounters = false;
+};
+
+class AutoBatchInferencePlugin : public InferenceEngine::IInferencePlugin {
+public:
+    AutoBatchInferencePlugin();
+    virtual ~AutoBatchInferencePlugin() = default;
+
+    InferenceEngine::IExecutableNetworkInternal::Ptr LoadExeNetworkImpl(const InferenceEngine::CNNNetwork&        network,
+                                                                       const std::map<std::string, std::string>& config) override;
+
+    void SetConfig(const std::map<std::string, std::string>& config) override;
+    void CheckConfig(const std::map<std::string, std::string>& config);
+
+    InferenceEngine::Parameter GetConfig(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+    InferenceEngine::QueryNetworkResult QueryNetwork(const InferenceEngine::CNNNetwork&        network,
+                                                     const std::map<std::string, std::string>& config) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+
+    // parses "GPU(4)" into the device name and batch size, the device config is filtered from the given one
+    DeviceInformation ParseMetaDevice(const std::string& devicesBatchCfg,
+                                      const std::map<std::string, std::string>& config) const;
+
+protected:
+    std::map<std::string, std::string> GetSupportedConfig(const std::map<std::string, std::string>& config,
+                                                          const DeviceName& deviceName) const;
+    static DeviceInformation ParseBatchDevice(const std::string& deviceWithBatch);
+};
+
+}  // namespace AutoBatchPlugin
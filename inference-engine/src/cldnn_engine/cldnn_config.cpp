@@ -12,6 +12,7 @@
 #include "file_utils.h"
 #include "cldnn_itt.h"
 #include <thread>
+#include <limits>
 
 #ifdef _WIN32
 # include <direct.h>
@@ -242,6 +243,42 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& configMap)
                                    << "\nSpecify the number of threads use for build as an integer."
                                    << "\nOut of range value will be set as a default value, maximum concurrent threads.";
             }
+        } else if (key.compare(GPUConfigParams::KEY_GPU_KERNELS_CACHE_MAX_SIZE) == 0) {
+            try {
+                int val_i = std::stoi(val);
+                if (val_i < 0)
+                    throw std::invalid_argument("negative kernels cache size");
+                kernels_cache_max_size = static_cast<size_t>(val_i) << 20;
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << GPUConfigParams::KEY_GPU_KERNELS_CACHE_MAX_SIZE << ": " << val
+                                   << "\nSpecify the max size of kernels cache in megabytes as a non-negative integer.";
+            }
+        } else if (key.compare(GPUConfigParams::KEY_GPU_SIZE_CLASS_MEMORY_POOL) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                size_class_memory_pool = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                size_class_memory_pool = false;
+            } else {
+                IE_THROW(NotFound) << "Unsupported KEY_GPU_SIZE_CLASS_MEMORY_POOL flag value: " << val;
+            }
+        } else if (key.compare(GPUConfigParams::KEY_GPU_BRANCH_QUEUES) == 0) {
+            try {
+                int val_i = std::stoi(val);
+                if (val_i < 1 || val_i > std::numeric_limits<uint16_t>::max())
+                    throw std::invalid_argument("wrong number of branch queues");
+                branch_queues = static_cast<uint16_t>(val_i);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << GPUConfigParams::KEY_GPU_BRANCH_QUEUES << ": " << val
+                                   << "\nSpecify the number of queues per stream as a positive integer.";
+            }
+        } else if (key.compare(GPUConfigParams::KEY_GPU_SHARE_CONSTANTS) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                share_constants = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                share_constants = false;
+            } else {
+                IE_THROW(NotFound) << "Unsupported KEY_GPU_SHARE_CONSTANTS flag value: " << val;
+            }
         } else if (key.compare(GPUConfigParams::KEY_GPU_ENABLE_LOOP_UNROLLING) == 0) {
             if (val.compare(PluginConfigParams::YES) == 0) {
                 enable_loop_unrolling = true;
@@ -341,6 +378,16 @@ void Config::adjustKeyMapValues() {
     key_config_map[PluginConfigParams::KEY_DEVICE_ID] = device_id;
     key_config_map[PluginConfigParams::KEY_CONFIG_FILE] = "";
     key_config_map[GPUConfigParams::KEY_GPU_MAX_NUM_THREADS] = std::to_string(n_threads);
+    key_config_map[GPUConfigParams::KEY_GPU_KERNELS_CACHE_MAX_SIZE] = std::to_string(kernels_cache_max_size >> 20);
+    if (size_class_memory_pool)
+        key_config_map[GPUConfigParams::KEY_GPU_SIZE_CLASS_MEMORY_POOL] = PluginConfigParams::YES;
+    else
+        key_config_map[GPUConfigParams::KEY_GPU_SIZE_CLASS_MEMORY_POOL] = PluginConfigParams::NO;
+    key_config_map[GPUConfigParams::KEY_GPU_BRANCH_QUEUES] = std::to_string(branch_queues);
+    if (share_constants)
+        key_config_map[GPUConfigParams::KEY_GPU_SHARE_CONSTANTS] = PluginConfigParams::YES;
+    else
+        key_config_map[GPUConfigParams::KEY_GPU_SHARE_CONSTANTS] = PluginConfigParams::NO;
 
     if (enable_loop_unrolling)
         key_config_map[GPUConfigParams::KEY_GPU_ENABLE_LOOP_UNROLLING] = PluginConfigParams::YES;
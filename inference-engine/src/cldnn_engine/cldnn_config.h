@@ -32,6 +32,10 @@ struct Config {
                sources_dumps_dir(""),
                device_id("0"),
                kernels_cache_dir(""),
+               kernels_cache_max_size(0),
+               size_class_memory_pool(false),
+               branch_queues(1),
+               share_constants(true),
                n_threads(std::max(static_cast<unsigned int>(1), std::thread::hardware_concurrency())),
                enable_loop_unrolling(true) {
         adjustKeyMapValues();
@@ -58,6 +62,10 @@ struct Config {
     std::string sources_dumps_dir;
     std::string device_id;
     std::string kernels_cache_dir;
+    size_t kernels_cache_max_size;
+    bool size_class_memory_pool;
+    uint16_t branch_queues;
+    bool share_constants;
     size_t n_threads;
     bool enable_loop_unrolling;
 
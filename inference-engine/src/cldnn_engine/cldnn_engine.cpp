@@ -22,6 +22,7 @@
 #include <ngraph/pass/constant_folding.hpp>
 #include <ie_ngraph_utils.hpp>
 #include <ie_algorithm.hpp>
+#include <ie_transformations_cache.hpp>
 
 #include <transformations/opset_conversions/convert_opset3_to_opset2.hpp>
 #include <transformations/opset_conversions/convert_opset2_to_opset1.hpp>
@@ -29,6 +30,7 @@
 #include <transformations/control_flow/unroll_tensor_iterator.hpp>
 
 #include <transformations/common_optimizations/common_optimizations.hpp>
+#include <transformations/common_optimizations/matmul_weights_decompression.hpp>
 #include <transformations/common_optimizations/lin_op_sequence_fusion.hpp>
 #include <transformations/common_optimizations/weights_dequantize_to_fake_quantize.hpp>
 #include "transformations/common_optimizations/convert_quantize_dequantize.hpp"
@@ -85,6 +87,7 @@
 #include "cldnn_custom_layer.h"
 #include "cldnn_itt.h"
 #include "gpu/gpu_config.hpp"
+#include "cldnn/cldnn_config.hpp"
 
 #include "cldnn/runtime/device_query.hpp"
 #include "cldnn/runtime/debug_configuration.hpp"
@@ -167,6 +170,8 @@ InferenceEngine::CNNNetwork clDNNEngine::CloneAndTransformNetwork(const Inferenc
             }
 
             manager.register_pass<ngraph::pass::InitNodeInfo>();
+            // keeps i8/u8 weights of MatMul compressed, the scale is applied to the FullyConnected output
+            manager.register_pass<ngraph::pass::MatMulWeightsDecompression>();
             manager.register_pass<ngraph::pass::CommonOptimizations>();
 
             if (!config.enable_loop_unrolling) {
@@ -490,6 +495,30 @@ InferenceEngine::CNNNetwork clDNNEngine::CloneAndTransformNetwork(const Inferenc
     return clonedNetwork;
 }
 
+// must be increased each time CloneAndTransformNetwork produces a different function for the same input
+static constexpr const char* transformationsPipelineVersion = "1";
+
+InferenceEngine::CNNNetwork clDNNEngine::TransformNetworkCached(const InferenceEngine::CNNNetwork& network,
+                                                                const CLDNNPlugin::Config& config) const {
+    // the device does not export, so CACHE_DIR keeps the transformed networks besides the compiled kernels
+    TransformationsCache cache(config.kernels_cache_dir, transformationsPipelineVersion);
+    auto core = GetCore();
+    if (!cache.isEnabled() || !core) {
+        return CloneAndTransformNetwork(network, config);
+    }
+
+    const std::map<std::string, std::string> options = {
+        {"ENABLE_INT8", config.enableInt8 ? PluginConfigParams::YES : PluginConfigParams::NO},
+        {CLDNNConfigParams::KEY_CLDNN_ENABLE_FP16_FOR_QUANTIZED_MODELS,
+         config.enable_fp16_for_quantized_models ? PluginConfigParams::YES : PluginConfigParams::NO},
+        {GPUConfigParams::KEY_GPU_ENABLE_LOOP_UNROLLING,
+         config.enable_loop_unrolling ? PluginConfigParams::YES : PluginConfigParams::NO},
+    };
+    return cache.getOrTransform(network, options, *core, [&](const CNNNetwork& net) {
+        return CloneAndTransformNetwork(net, config);
+    });
+}
+
 clDNNEngine::clDNNEngine() : m_defaultContext(nullptr) {
     _pluginName = "GPU";
     _impl = std::make_shared<impl>();
@@ -571,7 +600,11 @@ std::map<std::string, std::string> clDNNEngine::ConvertPerfHintsToConfig(
             if (mode_name == CONFIG_VALUE(LATENCY)) {
                 config[PluginConfigParams::KEY_GPU_THROUGHPUT_STREAMS] = std::to_string(1);
             } else if (mode_name == CONFIG_VALUE(THROUGHPUT)) {
-                config[PluginConfigParams::KEY_GPU_THROUGHPUT_STREAMS] = CONFIG_VALUE(GPU_THROUGHPUT_AUTO);
+                // GPU_THROUGHPUT_AUTO stands for 2 streams, there is no use of more streams than requests
+                const int num_streams = plugin_config.perfHintsConfig.LimitNumStreamsByNumRequests(2, config);
+                config[PluginConfigParams::KEY_GPU_THROUGHPUT_STREAMS] = num_streams < 2
+                                                                         ? std::to_string(num_streams)
+                                                                         : CONFIG_VALUE(GPU_THROUGHPUT_AUTO);
                 //disabling the throttling temporarily to set the validation (that is switching to the hints) perf baseline
                 //checking throttling (to avoid overriding what user might explicitly set in the incoming config or previously via SetConfig)
                 // const auto bInConfig = config.find(GPUConfigParams::KEY_GPU_PLUGIN_THROTTLE) != config.end() ||
@@ -608,12 +641,14 @@ IExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(const InferenceE
                context_config.useProfiling == current_config.useProfiling &&
                context_config.dumpCustomKernels == current_config.dumpCustomKernels &&
                context_config.memory_pool_on == current_config.memory_pool_on &&
-               context_config.queueThrottle == current_config.queueThrottle &&
-               context_config.queuePriority == current_config.queuePriority &&
                context_config.sources_dumps_dir == current_config.sources_dumps_dir &&
                context_config.tuningConfig.mode == current_config.tuningConfig.mode &&
                context_config.tuningConfig.cache_file_path == current_config.tuningConfig.cache_file_path &&
                context_config.kernels_cache_dir == current_config.kernels_cache_dir &&
+               context_config.kernels_cache_max_size == current_config.kernels_cache_max_size &&
+               context_config.size_class_memory_pool == current_config.size_class_memory_pool &&
+               context_config.branch_queues == current_config.branch_queues &&
+               context_config.share_constants == current_config.share_constants &&
                context_config.device_id == current_config.device_id &&
                context_config.n_threads == current_config.n_threads &&
                context_config.enable_loop_unrolling == current_config.enable_loop_unrolling;
@@ -629,7 +664,7 @@ IExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(const InferenceE
 
     context = m_defaultContext;
 
-    auto transformedNetwork = CloneAndTransformNetwork(network, conf);
+    auto transformedNetwork = TransformNetworkCached(network, conf);
     {
         OV_ITT_SCOPED_TASK(itt::domains::CLDNNPlugin, "clDNNEngine::LoadExeNetworkImpl::CreateExeNetwork");
         return std::make_shared<CLDNNExecNetwork>(transformedNetwork, context, conf);
@@ -651,7 +686,7 @@ IExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(const InferenceE
     auto config = ConvertPerfHintsToConfig(orig_config, conf);
     UpdateConfig(conf, network, config);
 
-    auto transformedNetwork = CloneAndTransformNetwork(network, conf);
+    auto transformedNetwork = TransformNetworkCached(network, conf);
     return std::make_shared<CLDNNExecNetwork>(transformedNetwork, casted, conf);
 }
 
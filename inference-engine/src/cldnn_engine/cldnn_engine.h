@@ -32,6 +32,8 @@ class clDNNEngine : public InferenceEngine::IInferencePlugin,
     cldnn::device_info GetDeviceInfo(const std::map<std::string, std::string> &config) const;
     InferenceEngine::CNNNetwork CloneAndTransformNetwork(const InferenceEngine::CNNNetwork& network,
                                                          const CLDNNPlugin::Config& config) const;
+    InferenceEngine::CNNNetwork TransformNetworkCached(const InferenceEngine::CNNNetwork& network,
+                                                       const CLDNNPlugin::Config& config) const;
 
     std::map<std::string, std::string> ConvertPerfHintsToConfig(const std::map<std::string, std::string>& network_config,
                                                                const CLDNNPlugin::Config& plugin_config) const;
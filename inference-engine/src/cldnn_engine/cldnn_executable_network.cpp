@@ -129,6 +129,8 @@ InferenceEngine::Parameter CLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
         metrics.push_back(GPU_METRIC_KEY(MEMORY_STATISTICS));
+        metrics.push_back(GPU_METRIC_KEY(MEMORY_FOOTPRINT));
+        metrics.push_back(GPU_METRIC_KEY(PRIMITIVES_MEMORY_RECORDS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -150,6 +152,30 @@ InferenceEngine::Parameter CLDNNExecNetwork::GetMetric(const std::string &name)
             impl->release_lock();
         }
         IE_SET_METRIC_RETURN(GPU_MEMORY_STATISTICS, statistics);
+    } else if (name == GPU_METRIC_KEY(MEMORY_FOOTPRINT)) {
+        IE_ASSERT(!m_graphs.empty());
+        // graphs of the streams share the program, so its kernels and constants are taken from the first one
+        auto footprint = m_graphs[0]->GetMemoryFootprint();
+        for (size_t i = 1; i < m_graphs.size(); i++) {
+            auto stream_footprint = m_graphs[i]->GetMemoryFootprint();
+            footprint.intermediates += stream_footprint.intermediates;
+            footprint.inputs_outputs += stream_footprint.inputs_outputs;
+        }
+        std::map<std::string, uint64_t> result = {
+            {"weights", footprint.weights},
+            {"intermediates", footprint.intermediates},
+            {"inputs_outputs", footprint.inputs_outputs},
+            {"kernels", footprint.kernels},
+            {"total", footprint.total()}
+        };
+        IE_SET_METRIC_RETURN(GPU_MEMORY_FOOTPRINT, result);
+    } else if (name == GPU_METRIC_KEY(PRIMITIVES_MEMORY_RECORDS)) {
+        IE_ASSERT(!m_graphs.empty());
+        std::map<std::string, std::pair<uint64_t, uint64_t>> records;
+        for (auto& info : m_graphs[0]->GetNetwork()->get_primitives_memory_info()) {
+            records[info.first] = {info.second.record, info.second.bytes};
+        }
+        IE_SET_METRIC_RETURN(GPU_PRIMITIVES_MEMORY_RECORDS, records);
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -74,14 +74,15 @@ void CLDNNGraph::Build() {
     UpdateLayersMaps();
 
     if (GetMaxDynamicBatchSize() > 1) {
+        // networks of the larger batch buckets are built on demand by GetNetwork()
         int m_bv_sz = m_program->GetMaxBatchSizeForSingleProgram();
-        for (int b = m_bv_sz - 1; b >= 0; b--) {
-            auto network = BuildNetwork(m_program->GetCompiledProgram(b));
-            m_networks.insert(m_networks.begin(), network);
-        }
+        m_networks.resize(m_bv_sz);
+        m_networks[0] = BuildNetwork(m_program->GetCompiledProgram(0));
     } else {
         auto network = BuildNetwork(m_program->GetCompiledProgram());
         m_networks.emplace_back(network);
+        if (GetEngine()->get_device_info().dev_type == cldnn::device_type::discrete_gpu)
+            m_copy_stream = GetEngine()->create_stream(m_config.queuePriority, m_config.queueThrottle);
     }
 
     UpdateImplementationsMap();
@@ -96,7 +97,10 @@ void CLDNNGraph::Build() {
 
 std::shared_ptr<cldnn::network> CLDNNGraph::BuildNetwork(std::shared_ptr<cldnn::program> program) {
     OV_ITT_SCOPED_TASK(itt::domains::CLDNNPlugin, "CLDNNGraph::BuildNetwork");
-    auto network = std::make_shared<cldnn::network>(program, m_stream_id);
+    // the queues are created with the priority hints of the network, so the networks sharing the context
+    // may be run with different priorities
+    auto stream = program->get_engine().create_stream(m_config.queuePriority, m_config.queueThrottle);
+    auto network = std::make_shared<cldnn::network>(program, stream, false, m_stream_id == 0);
 
     if (!m_config.graph_dumps_dir.empty() && m_stream_id == 0) {
         static int net_id = 0;
@@ -751,6 +755,36 @@ std::shared_ptr<cldnn::network> CLDNNGraph::GetNetwork(size_t idx) const {
     return m_networks[idx];
 }
 
+std::shared_ptr<cldnn::network> CLDNNGraph::GetNetwork(size_t idx) {
+    if (idx >= GetNetworksCount())
+        IE_THROW() << "Unable to find network with id=" << idx << ". Stored networks count: " << GetNetworksCount();
+
+    if (idx == 0)
+        return m_networks[0];
+
+    std::lock_guard<std::mutex> lock(m_networks_mutex);
+    if (!m_networks[idx]) {
+        OV_ITT_SCOPED_TASK(itt::domains::CLDNNPlugin, "CLDNNGraph::BuildDynamicBatchNetwork");
+        m_networks[idx] = BuildNetwork(m_program->GetCompiledProgram(static_cast<int>(idx)));
+    }
+    return m_networks[idx];
+}
+
+
+cldnn::network_memory_footprint CLDNNGraph::GetMemoryFootprint() const {
+    cldnn::network_memory_footprint footprint;
+    for (auto& network : m_networks) {
+        if (!network)
+            continue;
+        auto network_footprint = network->get_memory_footprint();
+        // dynamic batch networks are built from the same topology, so they use the same constant buffers
+        footprint.weights = std::max(footprint.weights, network_footprint.weights);
+        footprint.intermediates += network_footprint.intermediates;
+        footprint.inputs_outputs += network_footprint.inputs_outputs;
+        footprint.kernels += network_footprint.kernels;
+    }
+    return footprint;
+}
 
 std::string CLDNNGraph::MapOutputName(std::string outName) const {
     auto networkOutputsIDs = GetNetwork()->get_output_ids();
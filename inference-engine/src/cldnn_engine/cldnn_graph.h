@@ -53,8 +53,15 @@ public:
     const std::map<std::string, cldnn::layout>& GetInputLayouts() const { return m_program->GetInputLayouts(); }
     size_t GetNetworksCount() const { return m_networks.size(); }
     std::shared_ptr<cldnn::network> GetNetwork(size_t idx = 0) const;
+    // Builds the network of a dynamic batch bucket on the first call
+    std::shared_ptr<cldnn::network> GetNetwork(size_t idx = 0);
+    // Queue of the host<->device copies of the user blobs on the discrete GPU, so the transfers of one request
+    // overlap the execution of another one. nullptr if the copies are done on the network queue
+    cldnn::stream::ptr GetCopyStream() const { return m_copy_stream; }
     InferenceEngine::SizeVector GetOutputSize(std::string outName) const;
     std::string MapOutputName(std::string outName) const;
+    // Device memory of the built networks by purpose, constants shared by the networks are counted once
+    cldnn::network_memory_footprint GetMemoryFootprint() const;
     std::string getName() const { return m_networkName; }
     void wait(Stage stage_mask) {
         std::unique_lock<std::mutex> lock(m_infer_mutex);
@@ -81,6 +88,7 @@ protected:
 
     InferenceEngine::gpu::ClContext::Ptr m_context;
     std::vector<std::shared_ptr<cldnn::network>> m_networks;
+    std::mutex m_networks_mutex;
     std::map<std::string, cldnn::primitive_id> primitiveIDs;
     std::map<std::string, std::vector<cldnn::primitive_id>> prevPrimitiveIDs;
 
@@ -92,6 +100,7 @@ protected:
 
     std::shared_ptr<Program> m_program;
     uint16_t m_stream_id;
+    cldnn::stream::ptr m_copy_stream;
 
     std::shared_ptr<cldnn::network> BuildNetwork(std::shared_ptr<cldnn::program> program);
     void Build();
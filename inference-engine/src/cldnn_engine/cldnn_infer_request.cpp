@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <cstdint>
 #include <string>
 #include <map>
 #include <functional>
@@ -27,6 +28,10 @@ const char unsupported_batched_blob[] = "Batched input blob is expected to conta
 const char str_input_not_allocated[] = "Input data was not allocated.";
 const char str_output_not_allocated[] = "Output data was not allocated.";
 
+// host pointer and size requirements for CL_MEM_USE_HOST_PTR buffers to be zero-copy on integrated GPUs
+constexpr size_t zero_copy_ptr_alignment = 4096;
+constexpr size_t zero_copy_size_alignment = 64;
+
 template <typename T>
 void copyToFloat(float* dst, const InferenceEngine::Blob* src) {
     if (!dst) {
@@ -224,6 +229,9 @@ void CLDNNInferRequest::SetBlob(const std::string& name, const Blob::Ptr& data)
                                     << (is_input ? "input" : "output") << " precision";
     }
 
+    sharedHostInputs.erase(name);
+    sharedHostOutputs.erase(name);
+
     auto remote_ptr = data->as<gpu::ClBlob>();
     bool is_remote = remote_ptr != nullptr;
     if (is_remote) {
@@ -307,6 +315,15 @@ void CLDNNInferRequest::SetBlob(const std::string& name, const Blob::Ptr& data)
                 if (data->buffer() == nullptr)
                     IE_THROW(NotAllocated) << str_input_not_allocated << " Input name: \'" << name << "\'";
                 _inputs[name] = data;
+
+                // I16/U16 inputs are converted to fp32 on copy, so they can't be shared
+                auto inputLayout = m_graph->GetInputLayouts().find(name);
+                if (inputLayout != m_graph->GetInputLayouts().end() &&
+                    desc.getPrecision() != Precision::I16 && desc.getPrecision() != Precision::U16) {
+                    auto sharedMem = share_host_blob(data, inputLayout->second);
+                    if (sharedMem)
+                        sharedHostInputs[name] = sharedMem;
+                }
             }
         }
     } else {
@@ -326,6 +343,13 @@ void CLDNNInferRequest::SetBlob(const std::string& name, const Blob::Ptr& data)
             }
             if (data->buffer() == nullptr)
                 IE_THROW(NotAllocated) << str_input_not_allocated << " Input name: \'" << name << "\'";
+
+            auto outputId = outputsMap.find(name);
+            if (outputId != outputsMap.end()) {
+                auto sharedMem = share_host_blob(data, m_graph->GetNetwork()->get_output_memory(outputId->second)->get_layout());
+                if (sharedMem)
+                    sharedHostOutputs[name] = sharedMem;
+            }
         }
         _outputs[name] = data;
     }
@@ -395,6 +419,12 @@ void CLDNNInferRequest::SetBatch(int new_batch) {
     batchInputs.clear();
     batchOutputs.clear();
 
+    // networks of the batch buckets used by this request are built here rather than on the first inference
+    for (unsigned nb = 0; nb < m_graph->GetNetworksCount(); nb++) {
+        if (new_batch & (1 << nb))
+            m_graph->GetNetwork(nb);
+    }
+
     // tune expected inputs
     for (auto &input : m_graph->GetInputLayouts()) {
         cldnn::tensor dims = input.second.size;
@@ -477,6 +507,8 @@ void CLDNNInferRequest::preprocess() {
         return;
     }
     execDataPreprocessing(_inputs, true);  // "true" stands for serial preprocessing in case of OpenMP
+    if (m_graph->GetCopyStream())
+        upload_inputs();
     m_graph->notify(CLDNNGraph::Stage::PREPROC);
 }
 
@@ -526,6 +558,15 @@ void CLDNNInferRequest::enqueue() {
         prepare_output(outputName, outputBlob);
     }
 
+    if (!uploadEvents.empty()) {
+        // the uploads are on the other queue, so they are waited here instead of being the kernels dependencies
+        std::vector<cldnn::event::ptr> uploads;
+        for (auto& upload : uploadEvents)
+            uploads.push_back(upload.second);
+        m_graph->GetCopyStream()->wait_for_events(uploads);
+        uploadEvents.clear();
+    }
+
     internal_outputs.clear();
     internal_outputs = m_graph->GetNetwork()->execute(dependencies);
 }
@@ -540,19 +581,37 @@ void CLDNNInferRequest::wait() {
         IE_THROW() << "Inference was not started!\n";
     }
 
+    // the outputs are read back on the copy queue, so the next request may start the execution meanwhile
+    const bool overlapCopies = m_graph->GetCopyStream() != nullptr;
+    std::map<std::string, cldnn::memory::ptr> outputMemories;
+    for (auto& no : _networkOutputs)
+        outputMemories[no.first] = internal_outputs.at(outputsMap.at(no.first)).get_memory();
+    if (overlapCopies) {
+        if (m_useProfiling) {
+            m_graph->UpdatePerfStatistics();
+        }
+        m_graph->notify(CLDNNGraph::Stage::EXECUTE);
+    }
+
     // wait for completion & collect outputs as requested by the model
     for (auto& no : _networkOutputs) {
         Blob::Ptr bptr = _outputs[no.first];
-        std::string outputID = outputsMap.at(no.first);
-        auto outputMemory = internal_outputs.at(outputID).get_memory();
+        auto outputMemory = outputMemories.at(no.first);
 
         // mapping remote blobs not needed -
         // let the user take care of them explicitly
-        if (!bptr->is<gpu::ClBlob>()) {
+        auto sharedOutput = sharedHostOutputs.find(no.first);
+        if (sharedOutput != sharedHostOutputs.end()) {
+            // the device writes to the user memory directly, mapping only waits for the results
+            cldnn::mem_lock<uint8_t> lock{ sharedOutput->second, m_graph->GetNetwork()->get_stream() };
+        } else if (!bptr->is<gpu::ClBlob>()) {
             copy_output_data(outputMemory, bptr);
         }
     }
 
+    if (overlapCopies)
+        return;
+
     // finally collect profiling info
     if (m_useProfiling) {
         m_graph->UpdatePerfStatistics();
@@ -702,7 +761,7 @@ Blob::Ptr CLDNNInferRequest::create_output_host_blob(const TensorDesc& desc, uin
 
 void CLDNNInferRequest::copy_output_data(cldnn::memory::ptr src, Blob::Ptr dst, buf_info* bi) {
     OV_ITT_SCOPED_TASK(itt::domains::CLDNNPlugin, "CLDNNInferRequest::copy_output_data");
-    auto& stream = m_graph->GetNetwork()->get_stream();
+    auto& stream = m_graph->GetCopyStream() ? *m_graph->GetCopyStream() : m_graph->GetNetwork()->get_stream();
     switch (dst->getTensorDesc().getPrecision()) {
     case Precision::FP32: copyResultToOutputBlob<float>(src, dst, bi, stream);    break;
     case Precision::FP16: copyResultToOutputBlob<uint16_t>(src, dst, bi, stream); break;
@@ -894,6 +953,11 @@ void CLDNNInferRequest::prepare_input(const cldnn::primitive_id& inputName, Blob
     Blob::Ptr reqBlob = _deviceInputs.at(inputName);
     auto _nw_ptr = m_graph->GetNetwork();
     cldnn::primitive_id internalName = "parameter:" + inputName;
+    auto sharedInput = sharedHostInputs.find(inputName);
+    if (sharedInput != sharedHostInputs.end()) {
+        _nw_ptr->set_input_data(internalName, sharedInput->second);
+        return;
+    }
     const auto& prec = inputBlob->getTensorDesc().getPrecision();
     auto remote_ptr = inputBlob->as<gpu::ClBlob>();
     auto& stream = m_graph->GetNetwork()->get_stream();
@@ -926,7 +990,7 @@ void CLDNNInferRequest::prepare_input(const cldnn::primitive_id& inputName, Blob
                     } else {
                         copyToFloat<uint16_t>(ptr.data(), inputBlob.get());
                     }
-                } else {
+                } else if (uploadEvents.count(inputName) == 0) {
                     auto src_lock = inputBlob->cbuffer();
                     auto ev = inputMem->copy_from(stream, src_lock.as<const uint8_t*>());
                     dependencies.push_back(ev);
@@ -940,11 +1004,38 @@ void CLDNNInferRequest::prepare_input(const cldnn::primitive_id& inputName, Blob
     }
 }
 
+void CLDNNInferRequest::upload_inputs() {
+    OV_ITT_SCOPED_TASK(itt::domains::CLDNNPlugin, "CLDNNInferRequest::upload_inputs");
+    // the request owns the device memory of the inputs, so it may be written while the graph executes other request
+    auto& stream = *m_graph->GetCopyStream();
+    uploadEvents.clear();
+    for (auto& item : _inputs) {
+        const std::string& inputName = item.first;
+        const Blob::Ptr& inputBlob = item.second;
+        const auto& prec = inputBlob->getTensorDesc().getPrecision();
+        if (sharedHostInputs.count(inputName) || inputBlob->is<CompoundBlob>() || inputBlob->is<gpu::ClBlob>() ||
+            prec == Precision::I16 || prec == Precision::U16)
+            continue;
+        auto impl = getBlobImpl(_deviceInputs.at(inputName)->as<gpu::ClBlob>());
+        if (!impl->is_allocated()) {
+            IE_THROW() << str_input_not_allocated;
+        }
+        auto src_lock = inputBlob->cbuffer();
+        uploadEvents[inputName] = impl->getMemory()->copy_from(stream, src_lock.as<const uint8_t*>());
+    }
+    stream.flush();
+}
+
 void CLDNNInferRequest::prepare_output(const cldnn::primitive_id& outputName, Blob::Ptr& outputBlob) {
     OV_ITT_SCOPED_TASK(itt::domains::CLDNNPlugin, "CLDNNInferRequest::prepare_output");
     Blob::Ptr reqBlob = _deviceOutputs.at(outputName);
     cldnn::primitive_id internalName = outputsMap[outputName];
     auto _nw_ptr = m_graph->GetNetwork();
+    auto sharedOutput = sharedHostOutputs.find(outputName);
+    if (sharedOutput != sharedHostOutputs.end()) {
+        _nw_ptr->set_output_memory(internalName, sharedOutput->second);
+        return;
+    }
     auto remote_ptr = outputBlob->as<gpu::ClBlob>();
     auto output_blob_ptr = (reqBlob != outputBlob && remote_ptr != nullptr)
         ? remote_ptr
@@ -963,4 +1054,36 @@ InferenceEngine::Blob::Ptr CLDNNInferRequest::create_device_blob(const Inference
     return blobPtr;
 }
 
+cldnn::memory::ptr CLDNNInferRequest::share_host_blob(const Blob::Ptr& blob, const cldnn::layout& layout) {
+    OV_ITT_SCOPED_TASK(itt::domains::CLDNNPlugin, "CLDNNInferRequest::share_host_blob");
+    // host and device share memory only on integrated GPU, on discrete one the driver would copy anyway
+    auto engine = m_graph->GetEngine();
+    if (engine->get_device_info().dev_type != cldnn::device_type::integrated_gpu ||
+        m_graph->GetMaxDynamicBatchSize() > 1 || blob->is<CompoundBlob>() || blob->is<gpu::ClBlob>())
+        return nullptr;
+
+    const size_t size = blob->byteSize();
+    if (layout.data_padding || layout.bytes_count() != size || size % zero_copy_size_alignment != 0)
+        return nullptr;
+
+    auto locked = blob->buffer();
+    void* ptr = locked.as<void*>();
+    if (ptr == nullptr || reinterpret_cast<uintptr_t>(ptr) % zero_copy_ptr_alignment != 0)
+        return nullptr;
+
+    auto impl = getContextImpl(m_graph->GetContext());
+    impl->acquire_lock();
+    cldnn::memory::ptr mem = nullptr;
+    try {
+        cl::Context context(static_cast<cl_context>(engine->get_user_context()), true);
+        cl::Buffer buffer(context, CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR, size, ptr);
+        mem = engine->share_buffer(layout, buffer.get());
+    } catch (...) {
+        // fall back to the staging copies
+        mem = nullptr;
+    }
+    impl->release_lock();
+    return mem;
+}
+
 }  // namespace CLDNNPlugin
@@ -71,10 +71,12 @@ private:
     void prepare_input(const cldnn::primitive_id &inputName, InferenceEngine::Blob::Ptr &inputBlob,
                        std::vector<cldnn::event::ptr>& dependencies);
     void prepare_output(const cldnn::primitive_id& outputName, InferenceEngine::Blob::Ptr& outputBlob);
+    void upload_inputs();
 
     InferenceEngine::Blob::Ptr create_input_host_blob(const InferenceEngine::TensorDesc& desc, uint8_t* mem_ptr = nullptr);
     InferenceEngine::Blob::Ptr create_output_host_blob(const InferenceEngine::TensorDesc& desc, uint8_t* mem_ptr = nullptr);
     InferenceEngine::Blob::Ptr create_device_blob(const InferenceEngine::TensorDesc& desc, const cldnn::layout& layout);
+    cldnn::memory::ptr share_host_blob(const InferenceEngine::Blob::Ptr& blob, const cldnn::layout& layout);
 
     void copy_output_data(cldnn::memory::ptr outputMemory, InferenceEngine::Blob::Ptr bptr, buf_info* bi = nullptr);
     void copy_input_data(std::shared_ptr<cldnn::network> network, const cldnn::primitive_id &inputName,
@@ -86,6 +88,13 @@ private:
     void allocate_inputs_dynamic();
     void allocate_outputs_dynamic();
 
+    // user host blobs which are accessed by the device directly, without staging copies (integrated GPU only)
+    std::map<std::string, cldnn::memory::ptr> sharedHostInputs;
+    std::map<std::string, cldnn::memory::ptr> sharedHostOutputs;
+
+    // copies of the user host inputs started on the graph copy queue during the pre-processing
+    std::map<std::string, cldnn::event::ptr> uploadEvents;
+
     std::map<cldnn::primitive_id, cldnn::network_output> internal_outputs;
     std::vector<std::map<cldnn::primitive_id, cldnn::network_output>> internal_outputs_dynamic;
 };
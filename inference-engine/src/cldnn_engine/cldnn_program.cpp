@@ -119,7 +119,17 @@ Program::Program(InferenceEngine::CNNNetwork& network, std::shared_ptr<cldnn::en
 
     m_max_batch = config.max_dynamic_batch;
 
-    if (config.max_dynamic_batch > 1) {
+    if (config.max_dynamic_batch > 1 && !createTopologyOnly) {
+        // Only the batch-1 program is compiled here, the programs for the other power-of-two batch buckets
+        // are compiled on the first request of such batch, see GetCompiledProgram()
+        m_dynBatchFunction = func;
+        m_dynBatchInputs = networkInputs;
+        m_dynBatchOutputs = networkOutputs;
+        m_programs.resize(m_bv_sz);
+
+        ChangeInputBatch(1);
+        m_programs[0] = BuildProgram(ops, networkInputs, networkOutputs, createTopologyOnly);
+    } else if (config.max_dynamic_batch > 1) {
         for (int b = m_bv_sz - 1; b >= 0; b--) {
             inputLayouts.clear();
             outputDims.clear();
@@ -156,6 +166,20 @@ std::shared_ptr<cldnn::program> Program::GetCompiledProgram(int program_id) {
     if (program_id >= m_programs.size())
         IE_THROW() << "Invalid program ID";
 
+    if (!m_dynBatchFunction)
+        return m_programs[program_id];
+
+    std::lock_guard<std::mutex> lock(m_dynBatchMutex);
+    if (!m_programs[program_id]) {
+        OV_ITT_SCOPED_TASK(itt::domains::CLDNNPlugin, "Program::BuildDynamicBatchProgram");
+        // The bucket is built by a separate Program object, so the layers maps of the batch-1 program
+        // which are used by the graphs and infer requests stay untouched.
+        Program bucket(m_engine, m_config);
+        bucket.m_max_batch = m_max_batch;
+        bucket.ChangeInputBatch(1U << static_cast<unsigned>(program_id));
+        m_programs[program_id] = bucket.BuildProgram(m_dynBatchFunction->get_ordered_ops(), m_dynBatchInputs, m_dynBatchOutputs, false);
+    }
+
     return m_programs[program_id];
 }
 
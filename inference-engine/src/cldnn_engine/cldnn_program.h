@@ -156,6 +156,11 @@ public:
 private:
     static factories_map_t factories_map;
     std::vector<std::shared_ptr<cldnn::program>> m_programs;
+    // Source of the dynamic batch programs which are compiled on demand
+    std::shared_ptr<ngraph::Function> m_dynBatchFunction;
+    InferenceEngine::InputsDataMap m_dynBatchInputs;
+    InferenceEngine::OutputsDataMap m_dynBatchOutputs;
+    std::mutex m_dynBatchMutex;
     std::shared_ptr<cldnn::engine> m_engine;
     Config m_config;
 
@@ -248,7 +248,13 @@ CLDNNExecutionContextImpl::CLDNNExecutionContextImpl(const std::shared_ptr<IInfe
                                                                                                      m_config.memory_pool_on,
                                                                                                      use_unified_shared_memory,
                                                                                                      m_config.kernels_cache_dir,
-                                                                                                     m_config.n_threads));
+                                                                                                     m_config.n_threads,
+                                                                                                     1,
+                                                                                                     "cache.json",
+                                                                                                     m_config.kernels_cache_max_size,
+                                                                                                     m_config.size_class_memory_pool,
+                                                                                                     m_config.branch_queues,
+                                                                                                     m_config.share_constants));
     }
 }
 
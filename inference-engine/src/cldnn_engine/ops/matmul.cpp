@@ -7,6 +7,7 @@
 
 #include "ngraph/op/matmul.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
 #include "ngraph/op/fake_quantize.hpp"
 
 #include "cldnn/primitives/gemm.hpp"
@@ -76,6 +77,15 @@ void CreateMatMulOp(Program& p, const std::shared_ptr<ngraph::op::v0::MatMul>& o
         auto inputName = inputPrimitives[0];
         auto weightsName = inputPrimitives[1];
 
+        // Compressed weights (see MatMulWeightsDecompression transformation) are passed to FullyConnected as is,
+        // so they stay in i8/u8 in the device memory and are converted by the kernel
+        auto weightsConvert = std::dynamic_pointer_cast<ngraph::op::v0::Convert>(op->get_input_node_shared_ptr(1));
+        if (weightsConvert && ngraph::is_type<ngraph::op::v0::Constant>(weightsConvert->get_input_node_ptr(0))) {
+            auto compressedType = weightsConvert->get_input_element_type(0);
+            if (compressedType == ngraph::element::i8 || compressedType == ngraph::element::u8)
+                weightsName = p.GetInputPrimitiveIDs(weightsConvert)[0];
+        }
+
         // Weights normalization
         if (!op->get_transpose_b()) {
             std::vector<uint16_t> transpose_order(shape_b.size());
@@ -11,11 +11,43 @@
 #include "cldnn/primitives/reorder.hpp"
 #include "cldnn/primitives/data.hpp"
 #include "cldnn/primitives/concatenation.hpp"
+#include "cldnn/primitives/activation.hpp"
+#include "cldnn/primitives/scale.hpp"
+
+#include <vector>
+#include <algorithm>
 
 using namespace InferenceEngine;
 
 namespace CLDNNPlugin {
 
+// Divides the output of preprocessing reorder by the std scales of the input channels. When all the channels share the
+// same scale, it's expressed by linear activation which is fused into the reorder, so NV12 conversion, mean subtraction
+// and normalization are executed by the single kernel reading the input surfaces.
+static cldnn::primitive_id AddStdScale(Program& p, const cldnn::primitive_id& inputID, const std::vector<float>& stdScales,
+                                       const cldnn::tensor& scaleTensor, const std::string& extPrimID) {
+    if (std::all_of(stdScales.begin(), stdScales.end(), [](float s) { return fabs(s - 1.0f) <= 1e-10; }))
+        return inputID;
+
+    auto scalePrimID = inputID + "_std_scale";
+    if (std::all_of(stdScales.begin(), stdScales.end(), [&](float s) { return s == stdScales[0]; })) {
+        p.AddPrimitive(cldnn::activation(scalePrimID, inputID, cldnn::activation_func::linear, {1.0f / stdScales[0], 0.0f}, extPrimID));
+    } else {
+        auto scaleDataID = scalePrimID + "_data";
+        cldnn::layout scaleLayout(cldnn::data_types::f32, cldnn::format::bfyx, scaleTensor);
+        auto mem = p.GetEngine().allocate_memory(scaleLayout, false);
+        cldnn::mem_lock<float> scaleData{ mem, p.GetEngine().get_program_stream() };
+        for (size_t c = 0; c < stdScales.size(); c++)
+            scaleData[c] = 1.0f / stdScales[c];
+        p.AddPrimitive(cldnn::data(scaleDataID, mem));
+        p.AddPrimitive(cldnn::scale(scalePrimID, inputID, scaleDataID, {}, extPrimID));
+    }
+    p.InitProfileInfo(scalePrimID, "reorder");
+    p.primitiveIDs[scalePrimID] = scalePrimID;
+    p.profilingIDs.push_back(scalePrimID);
+    return scalePrimID;
+}
+
 void CreateParameterOp(Program& p, const std::shared_ptr<ngraph::op::v0::Parameter>& op) {
     auto networkInputs = p.GetNetworkInputs();
     if (networkInputs.find(op->get_friendly_name()) == networkInputs.end()) {
@@ -100,6 +132,12 @@ void CreateParameterOp(Program& p, const std::shared_ptr<ngraph::op::v0::Paramet
     networkInputLayout.data_type = DataTypeFromPrecision(op->get_output_element_type(0));
     cldnn::primitive_id meanBlobID = inputName + Program::m_meanValuesTag;
     std::vector<float> meanValues;
+    std::vector<float> stdScales;
+    for (size_t c = 0; c < meanChannels; c++) {
+        if (preProcess[c]->stdScale == 0.0f)
+            IE_THROW() << "Zero stdScale in input " << inputName;
+        stdScales.push_back(preProcess[c]->stdScale);
+    }
 
     if ((meanChannels > 0) &&
         (meanChannels != networkInputLayout.size.feature[0])) {
@@ -111,8 +149,6 @@ void CreateParameterOp(Program& p, const std::shared_ptr<ngraph::op::v0::Paramet
     case MEAN_VALUE: {
         if (meanChannels > 0) {
             for (size_t c = 0; c < meanChannels; c++) {
-                if (fabs(preProcess[c]->stdScale - 1.0f) > 1e-10)
-                    IE_THROW() << "not supporting stdScale yet in input " << inputName;
                 meanValues.push_back(preProcess[c]->meanValue);
             }
         }
@@ -135,8 +171,6 @@ void CreateParameterOp(Program& p, const std::shared_ptr<ngraph::op::v0::Paramet
         meanBlob.allocate();
         auto meanBlobData = meanBlob.data();
         for (size_t c = 0; c < meanChannels; c++) {
-            if (fabs(preProcess[c]->stdScale - 1.0f) > 1e-10)
-                IE_THROW() << "not supporting stdScale yet in input " << inputName;
             auto channelMeanBlob = std::dynamic_pointer_cast<TBlob<float>>(preProcess[c]->meanData);
             auto channelSize = channelMeanBlob->size();
             auto channelBlobData = channelMeanBlob->data();
@@ -174,6 +208,8 @@ void CreateParameterOp(Program& p, const std::shared_ptr<ngraph::op::v0::Paramet
         break;
     }
 
+    cldnn::tensor stdScaleTensor(1, TensorValue(meanChannels), 1, 1);
+
     if (ColorFormat::NV12 == preProcess.getColorFormat() && p.GetConfig().nv12_two_inputs) {
         // for NV12, create two input layouts with reorder instead of one,
         // and then would expect compound blob in inferRequest
@@ -230,9 +266,10 @@ void CreateParameterOp(Program& p, const std::shared_ptr<ngraph::op::v0::Paramet
 
             p.profilingIDs.push_back(preprocessPrimID);
             p.InitProfileInfo(preprocessPrimID, "Reorder");
-            p.primitiveIDs[inputName] = preprocessPrimID;  // If it is batched blob, it will be overwritten afterwards.
             p.primitiveIDs[preprocessPrimID] = preprocessPrimID;
-            reorders.push_back(preprocessPrimID);
+            auto normalizedPrimID = AddStdScale(p, preprocessPrimID, stdScales, stdScaleTensor, inputInfo->name());
+            p.primitiveIDs[inputName] = normalizedPrimID;  // If it is batched blob, it will be overwritten afterwards.
+            reorders.push_back(normalizedPrimID);
         }
 
         if (inputDims[0] > 1) {
@@ -273,7 +310,7 @@ void CreateParameterOp(Program& p, const std::shared_ptr<ngraph::op::v0::Paramet
         }
         p.InitProfileInfo(preprocessPrimID, "reorder");
         p.primitiveIDs[preprocessPrimID] = preprocessPrimID;
-        p.primitiveIDs[inputName] = preprocessPrimID;
+        p.primitiveIDs[inputName] = AddStdScale(p, preprocessPrimID, stdScales, stdScaleTensor, op->get_friendly_name());
         p.profilingIDs.push_back(preprocessPrimID);
     }
 }
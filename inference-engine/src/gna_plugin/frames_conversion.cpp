@@ -0,0 +1,118 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "frames_conversion.hpp"
+#include "preprocessing.hpp"
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace GNAPluginNS {
+namespace XARCH {
+
+// Vector code follows the scalar conversion: the value is rounded by adding +-0.5 depending on its sign,
+// saturated to the range of the target type and truncated. Tails are converted with the scalar functions.
+
+static void float_to_int16(int16_t* dst, const float* src, size_t count, float scale_factor) {
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    const __m512 scale = _mm512_set1_ps(scale_factor);
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 pos_half = _mm512_set1_ps(0.5f);
+    const __m512 neg_half = _mm512_set1_ps(-0.5f);
+    const __m512 max_value = _mm512_set1_ps(32767.0f);
+    const __m512 min_value = _mm512_set1_ps(-32768.0f);
+    for (; i + 16 <= count; i += 16) {
+        __m512 value = _mm512_mul_ps(_mm512_loadu_ps(src + i), scale);
+        __m512 rounding = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(value, zero, _CMP_GT_OQ), neg_half, pos_half);
+        value = _mm512_max_ps(_mm512_min_ps(_mm512_add_ps(value, rounding), max_value), min_value);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm512_cvtsepi32_epi16(_mm512_cvttps_epi32(value)));
+    }
+#elif defined(HAVE_AVX2)
+    const __m256 scale = _mm256_set1_ps(scale_factor);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 pos_half = _mm256_set1_ps(0.5f);
+    const __m256 neg_half = _mm256_set1_ps(-0.5f);
+    const __m256 max_value = _mm256_set1_ps(32767.0f);
+    const __m256 min_value = _mm256_set1_ps(-32768.0f);
+    for (; i + 8 <= count; i += 8) {
+        __m256 value = _mm256_mul_ps(_mm256_loadu_ps(src + i), scale);
+        __m256 rounding = _mm256_blendv_ps(neg_half, pos_half, _mm256_cmp_ps(value, zero, _CMP_GT_OQ));
+        value = _mm256_max_ps(_mm256_min_ps(_mm256_add_ps(value, rounding), max_value), min_value);
+        __m256i value_i32 = _mm256_cvttps_epi32(value);
+        __m128i value_i16 = _mm_packs_epi32(_mm256_castsi256_si128(value_i32), _mm256_extracti128_si256(value_i32, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), value_i16);
+    }
+#endif
+    for (; i < count; i++) {
+        dst[i] = ConvertFloatToInt16(src[i] * scale_factor);
+    }
+}
+
+static void float_to_int8(int8_t* dst, const float* src, size_t count, float scale_factor) {
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    const __m512 scale = _mm512_set1_ps(scale_factor);
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 pos_half = _mm512_set1_ps(0.5f);
+    const __m512 neg_half = _mm512_set1_ps(-0.5f);
+    const __m512 max_value = _mm512_set1_ps(127.0f);
+    const __m512 min_value = _mm512_set1_ps(-128.0f);
+    for (; i + 16 <= count; i += 16) {
+        __m512 value = _mm512_mul_ps(_mm512_loadu_ps(src + i), scale);
+        __m512 rounding = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(value, zero, _CMP_GT_OQ), neg_half, pos_half);
+        value = _mm512_max_ps(_mm512_min_ps(_mm512_add_ps(value, rounding), max_value), min_value);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm512_cvtsepi32_epi8(_mm512_cvttps_epi32(value)));
+    }
+#elif defined(HAVE_AVX2)
+    const __m256 scale = _mm256_set1_ps(scale_factor);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 pos_half = _mm256_set1_ps(0.5f);
+    const __m256 neg_half = _mm256_set1_ps(-0.5f);
+    const __m256 max_value = _mm256_set1_ps(127.0f);
+    const __m256 min_value = _mm256_set1_ps(-128.0f);
+    for (; i + 8 <= count; i += 8) {
+        __m256 value = _mm256_mul_ps(_mm256_loadu_ps(src + i), scale);
+        __m256 rounding = _mm256_blendv_ps(neg_half, pos_half, _mm256_cmp_ps(value, zero, _CMP_GT_OQ));
+        value = _mm256_max_ps(_mm256_min_ps(_mm256_add_ps(value, rounding), max_value), min_value);
+        __m256i value_i32 = _mm256_cvttps_epi32(value);
+        __m128i value_i16 = _mm_packs_epi32(_mm256_castsi256_si128(value_i32), _mm256_extracti128_si256(value_i32, 1));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi16(value_i16, value_i16));
+    }
+#endif
+    for (; i < count; i++) {
+        dst[i] = ConvertFloatToInt8(src[i] * scale_factor);
+    }
+}
+
+static void int32_to_float(float* dst, const int32_t* src, size_t count, float scale_factor) {
+    size_t i = 0;
+    // division is kept instead of multiplication by the reciprocal to get the same results as ConvertToFloat
+#if defined(HAVE_AVX512F)
+    const __m512 scale = _mm512_set1_ps(scale_factor);
+    for (; i + 16 <= count; i += 16) {
+        __m512 value = _mm512_cvtepi32_ps(_mm512_loadu_si512(src + i));
+        _mm512_storeu_ps(dst + i, _mm512_div_ps(value, scale));
+    }
+#elif defined(HAVE_AVX2)
+    const __m256 scale = _mm256_set1_ps(scale_factor);
+    for (; i + 8 <= count; i += 8) {
+        __m256 value = _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        _mm256_storeu_ps(dst + i, _mm256_div_ps(value, scale));
+    }
+#endif
+    for (; i < count; i++) {
+        dst[i] = static_cast<float>(src[i]) / scale_factor;
+    }
+}
+
+void get_frames_conversion_kernels(frames_conversion_kernels* kernels) {
+    kernels->float_to_int16 = float_to_int16;
+    kernels->float_to_int8 = float_to_int8;
+    kernels->int32_to_float = int32_to_float;
+}
+
+}  // namespace XARCH
+}  // namespace GNAPluginNS
@@ -0,0 +1,27 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace GNAPluginNS {
+
+/**
+ * @brief Conversions of frames between user blobs and GNA buffers.
+ * Results are bit exact with ConvertFloatToInt16, ConvertFloatToInt8 and ConvertToFloat for any instruction set
+ */
+struct frames_conversion_kernels {
+    void (*float_to_int16)(int16_t* dst, const float* src, size_t count, float scale_factor);
+    void (*float_to_int8)(int8_t* dst, const float* src, size_t count, float scale_factor);
+    void (*int32_to_float)(float* dst, const int32_t* src, size_t count, float scale_factor);
+};
+
+namespace XARCH {
+
+void get_frames_conversion_kernels(frames_conversion_kernels* kernels);
+
+}  // namespace XARCH
+}  // namespace GNAPluginNS
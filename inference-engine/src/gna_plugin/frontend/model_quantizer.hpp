@@ -8,6 +8,10 @@
 #include <utility>
 #include <string>
 #include <type_traits>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
 
 #include <legacy/layer_transform.hpp>
 #include "gna_graph_tools.hpp"
@@ -85,15 +89,71 @@ class ModelQuantizer {
 
         propagateScaleFactor(sortedNewNet);
 
+        // the weights of a layer are quantized with the final scale factors and only the layer itself is updated,
+        // so the weightable layers are quantized concurrently
+        std::vector<InferenceEngine::CNNLayerPtr> weightableLayers;
+        for (auto &&layer : sortedNewNet) {
+            if (LayerInfo(layer).isWeightable()) {
+                weightableLayers.push_back(layer);
+            }
+        }
+        quantizeConcurrently(weightableLayers, lc);
+
         // sorted order gives possibility for propagate quantisation along depended layers
         for (auto &&layer : sortedNewNet) {
-            transformLayer(layer, lc);
+            if (!LayerInfo(layer).isWeightable()) {
+                transformLayer(layer, lc);
+            }
         }
 
         return copiedNet;
     }
 
  private :
+    void quantizeConcurrently(const std::vector<InferenceEngine::CNNLayerPtr> &layers, const LayersQuantizer<T> &lc) const {
+        OV_ITT_SCOPED_TASK(itt::domains::GNA_LT, "ModelQuantizer::quantizeConcurrently");
+        // small networks are quantized by the calling thread, as starting of threads takes longer
+        constexpr size_t minWeightsPerThread = 64 * 1024;
+        size_t weightsSize = 0;
+        for (auto &&layer : layers) {
+            auto wl = dynamic_cast<InferenceEngine::WeightableLayer *>(layer.get());
+            weightsSize += wl && wl->_weights ? wl->_weights->size() : 0;
+        }
+        size_t threadsNum = std::min<size_t>({std::thread::hardware_concurrency(), layers.size(), weightsSize / minWeightsPerThread});
+        if (threadsNum <= 1) {
+            for (auto &&layer : layers) {
+                transformLayer(layer, lc);
+            }
+            return;
+        }
+
+        std::atomic<size_t> nextLayer{0};
+        std::vector<std::exception_ptr> errors(layers.size());
+        auto worker = [&]() {
+            for (size_t i = nextLayer++; i < layers.size(); i = nextLayer++) {
+                try {
+                    transformLayer(layers[i], lc);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            }
+        };
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < threadsNum; i++) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        // the error of the first layer in the topological order is reported as it is done by the sequential quantization
+        for (auto &error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
     void propagateScaleFactor(std::vector<InferenceEngine::CNNLayerPtr> & net) const {
         ScaleFactorCalculator<T> sf(net);
 
@@ -104,6 +164,11 @@ class ModelQuantizer {
             auto layers = sf.getStartLayers();
             infiniteLoopHistory.emplace_back(layers.front()->name);
             for (auto &&layer : layers) {
+                // the parameters this layer depends on weren't changed since its last visit
+                if (sf.isCurrentLayerUpToDate()) {
+                    sf.skipCurrentLayer();
+                    continue;
+                }
                 transformLayer(layer, sf);
                 // transforming until we reached cases where output scale updated due to situation in downstream layer
                 if (sf.needToRestart()) {
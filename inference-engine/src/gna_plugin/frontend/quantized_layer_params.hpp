@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <vector>
+
 namespace GNAPluginNS {
 
 class Quantization {
@@ -66,6 +68,14 @@ public:
         SetMinValues(src.GetMinValues(false), false);
         SetMaxValues(src.GetMaxValues(false), false);
     }
+    bool operator==(const Quantization& other) const {
+        return scale == other.scale && scale_set == other.scale_set && levels == other.levels &&
+            input_min_values == other.input_min_values && input_max_values == other.input_max_values &&
+            output_min_values == other.output_min_values && output_max_values == other.output_max_values;
+    }
+    bool operator!=(const Quantization& other) const {
+        return !(*this == other);
+    }
 
 private:
     float scale = 1.0f;
@@ -86,6 +96,15 @@ struct QuantizedLayerParams {
     Quantization _bias_quant;
 
     bool lowPrecision = false;
+
+    bool operator==(const QuantizedLayerParams& other) const {
+        return _src_quant == other._src_quant && _dst_quant == other._dst_quant &&
+            _weights_quant == other._weights_quant && _bias_quant == other._bias_quant &&
+            lowPrecision == other.lowPrecision;
+    }
+    bool operator!=(const QuantizedLayerParams& other) const {
+        return !(*this == other);
+    }
 };
 
 }  // namespace GNAPluginNS
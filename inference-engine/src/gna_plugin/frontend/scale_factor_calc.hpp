@@ -1333,9 +1333,90 @@ class ScaleFactorCalculator {
     mutable bool needRestart = false;
     int infiniteLoopCount = 0;
 
+    /**
+     * Tracking of the quantization parameters changes, so the layers following the restart point are revisited only
+     * if the parameters they depend on were changed since their last visit. The scale factor of a layer depends on
+     * the parameters of the layer itself, of its upstream layers and of its direct consumers; memory layers are
+     * connected with their pairs outside of the graph edges and are always revisited.
+     */
+    struct LayerState {
+        QuantizedLayerParams params;  // the parameters seen after the last change
+        size_t lastChange = 0;        // step of the last change of the parameters
+        size_t lastVisit = 0;         // step of the last visit, 0 if the layer was not visited yet
+        int visitLoopCount = 0;       // infinite loop counter at the last visit
+        std::vector<size_t> prev;
+        std::vector<size_t> next;
+    };
+    mutable std::vector<LayerState> states;
+    mutable size_t step = 0;
+    // the latest change among the layer and all its upstream layers, valid for the first ancestorsReady layers
+    mutable std::vector<size_t> ancestorsChange;
+    mutable size_t ancestorsReady = 0;
+
+    size_t position(Cnt::const_iterator it) const {
+        return static_cast<size_t>(std::distance(net.cbegin(), it));
+    }
+
+    void initStates() {
+        std::map<InferenceEngine::CNNLayer*, size_t> positions;
+        for (size_t i = 0; i < net.size(); i++) {
+            positions[net[i].get()] = i;
+        }
+        states.resize(net.size());
+        ancestorsChange.resize(net.size());
+        for (size_t i = 0; i < net.size(); i++) {
+            states[i].params = *InferenceEngine::getInjectedData<QuantizedLayerParams>(*net[i]);
+            for (auto&& input : net[i]->insData) {
+                auto data = input.lock();
+                auto creator = data ? getCreatorLayer(data).lock() : nullptr;
+                auto found = creator ? positions.find(creator.get()) : positions.end();
+                if (found != positions.end()) {
+                    states[i].prev.push_back(found->second);
+                }
+            }
+            for (auto&& output : net[i]->outData) {
+                for (auto&& consumer : getInputTo(output)) {
+                    auto found = positions.find(consumer.second.get());
+                    if (found != positions.end()) {
+                        states[i].next.push_back(found->second);
+                    }
+                }
+            }
+        }
+    }
+
+    // the handlers may change the parameters of other layers, so all the layers are checked after each visit
+    void registerVisit(size_t visited) const {
+        ++step;
+        states[visited].lastVisit = step;
+        states[visited].visitLoopCount = infiniteLoopCount;
+        for (size_t i = 0; i < net.size(); i++) {
+            auto& params = *InferenceEngine::getInjectedData<QuantizedLayerParams>(*net[i]);
+            if (states[i].params != params) {
+                states[i].params = params;
+                states[i].lastChange = step;
+                ancestorsReady = std::min(ancestorsReady, i);
+            }
+        }
+    }
+
+    size_t getAncestorsChange(size_t i) const {
+        // the network is sorted topologically, so the upstream layers precede the layer
+        for (; ancestorsReady <= i; ancestorsReady++) {
+            auto& state = states[ancestorsReady];
+            size_t change = state.lastChange;
+            for (auto p : state.prev) {
+                change = std::max(change, ancestorsChange[p]);
+            }
+            ancestorsChange[ancestorsReady] = change;
+        }
+        return ancestorsChange[i];
+    }
+
  public:
     ScaleFactorCalculator(Cnt &net) : net(net) {
         idx = std::begin(this->net);
+        initStates();
     }
     bool needToRestart() const {
         return needRestart;
@@ -1349,6 +1430,26 @@ class ScaleFactorCalculator {
     void SetInfiniteLoopCount(int infiniteLoopCount) {
         this->infiniteLoopCount = infiniteLoopCount;
     }
+    /**
+     * @brief Checks if the visit of the current layer would give the same result as its previous visit
+     */
+    bool isCurrentLayerUpToDate() const {
+        const size_t current = position(idx);
+        const auto& state = states[current];
+        if (state.lastVisit == 0 || state.visitLoopCount != infiniteLoopCount || LayerInfo(net[current]).isMemory()) {
+            return false;
+        }
+        if (getAncestorsChange(current) > state.lastVisit) {
+            return false;
+        }
+        return std::all_of(state.next.begin(), state.next.end(), [&](size_t n) {
+            return states[n].lastChange <= state.lastVisit;
+        });
+    }
+    void skipCurrentLayer() const {
+        needRestart = false;
+        idx++;
+    }
     template<class T>
     bool operator()(T ptr) const {
         needRestart = false;
@@ -1356,6 +1457,7 @@ class ScaleFactorCalculator {
         if (!frontend::ScaleFactorPerLayer<T, QUANT_DESC>()(ptr, result, infiniteLoopCount)) {
             return false;
         }
+        registerVisit(position(idx));
         if (result) {
             idx++;
             return true;
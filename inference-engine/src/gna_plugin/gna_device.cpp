@@ -82,12 +82,19 @@ uint32_t GNADeviceHelper::propagate(const intel_nnet_type_t *pNeuralNetwork,
                    const uint32_t *pActiveIndices,
                    uint32_t nActiveIndices,
                    intel_gna_proc_t nGNAProcType) {
+    auto& scheduler = GNAPluginNS::GNADeviceScheduler::instance();
+    scheduler.acquireSlot(schedulerClientId);
     std::unique_lock<std::mutex> lockGnaCalls{ acrossPluginsSync };
     uint32_t reqId;
 
     nGNAStatus = GNAPropagateForward(nGNAHandle, pNeuralNetwork,
                                      pActiveIndices, nActiveIndices, &reqId, nGNAProcType);
-    checkStatus();
+    try {
+        checkStatus();
+    } catch (...) {
+        scheduler.releaseSlot(schedulerClientId);
+        throw;
+    }
     return reqId;
 }
 #else
@@ -99,6 +106,9 @@ void GNADeviceHelper::setUpActiveList(const uint32_t requestConfigId, uint32_t l
 }
 
 uint32_t GNADeviceHelper::propagate(const uint32_t requestConfigId, Gna2AccelerationMode gna2AccelerationMode) {
+    // the scheduler keeps the device queue shared fairly between the networks of the process
+    auto& scheduler = GNAPluginNS::GNADeviceScheduler::instance();
+    scheduler.acquireSlot(schedulerClientId);
     std::unique_lock<std::mutex> lockGnaCalls{ acrossPluginsSync };
     uint32_t reqId{};
     if ((gna2AccelerationMode == Gna2AccelerationModeHardware ||
@@ -106,10 +116,15 @@ uint32_t GNADeviceHelper::propagate(const uint32_t requestConfigId, Gna2Accelera
         detectedGnaDevVersion == Gna2DeviceVersionSoftwareEmulation) {
         gnawarn() << "GNA Device not detected, consider using other mode of acceleration";
     }
-    const auto status1 = Gna2RequestConfigSetAccelerationMode(requestConfigId, gna2AccelerationMode);
-    checkGna2Status(status1, "Gna2RequestConfigSetAccelerationMode");
-    const auto status2 = Gna2RequestEnqueue(requestConfigId, &reqId);
-    checkGna2Status(status2, "Gna2RequestEnqueue");
+    try {
+        const auto status1 = Gna2RequestConfigSetAccelerationMode(requestConfigId, gna2AccelerationMode);
+        checkGna2Status(status1, "Gna2RequestConfigSetAccelerationMode");
+        const auto status2 = Gna2RequestEnqueue(requestConfigId, &reqId);
+        checkGna2Status(status2, "Gna2RequestEnqueue");
+    } catch (...) {
+        scheduler.releaseSlot(schedulerClientId);
+        throw;
+    }
 
     unwaitedRequestIds.insert(reqId);
 
@@ -409,24 +424,29 @@ const std::map <const std::pair<Gna2OperationType, int32_t>, const std::string>
 #endif
 
 GnaWaitStatus GNADeviceHelper::wait(uint32_t reqId, int64_t millisTimeout) {
-    std::unique_lock<std::mutex> lockGnaCalls{ acrossPluginsSync };
 #if GNA_LIB_VER == 2
+    // the lock is not held while waiting, so the other networks may enqueue their requests meanwhile
     const auto status = Gna2RequestWait(reqId, millisTimeout);
+    std::unique_lock<std::mutex> lockGnaCalls{ acrossPluginsSync };
     if (status == Gna2StatusWarningDeviceBusy) {
         return GNA_REQUEST_PENDING;
     }
-    unwaitedRequestIds.erase(reqId);
+    if (unwaitedRequestIds.erase(reqId) != 0) {
+        GNAPluginNS::GNADeviceScheduler::instance().releaseSlot(schedulerClientId);
+    }
     if (status == Gna2StatusDriverQoSTimeoutExceeded) {
         return GNA_REQUEST_ABORTED;
     }
     checkGna2Status(status, "Gna2RequestWait");
 #else
+    std::unique_lock<std::mutex> lockGnaCalls{ acrossPluginsSync };
     if (isPerformanceMeasuring) {
         nGNAStatus = GNAWaitPerfRes(nGNAHandle, millisTimeout, reqId, &nGNAPerfResults);
     } else {
         nGNAStatus = GNAWait(nGNAHandle, millisTimeout, reqId);
     }
     checkStatus();
+    GNAPluginNS::GNADeviceScheduler::instance().releaseSlot(schedulerClientId);
 #endif
     updateGnaPerfCounters();
     return GNA_REQUEST_COMPLETED;
@@ -15,6 +15,8 @@
 
 #include <ie_common.h>
 
+#include "gna_device_scheduler.hpp"
+
 #if GNA_LIB_VER == 2
 #include "gna2-common-api.h"
 #include "gna2-inference-api.h"
@@ -73,6 +75,7 @@ class GNADeviceHelper {
 #endif
     bool isPerformanceMeasuring = false;
     bool deviceOpened = false;
+    uint32_t schedulerClientId = 0;
 public:
 #if GNA_LIB_VER == 1
     explicit GNADeviceHelper(uint8_t lib_async_n_threads = 1,
@@ -114,6 +117,7 @@ public:
             uint8_t num_cores = std::thread::hardware_concurrency();
             setOMPThreads((num_cores != 0) ? num_cores : 1);
         }
+        schedulerClientId = GNAPluginNS::GNADeviceScheduler::instance().registerClient();
     }
 
     GNADeviceHelper(const GNADeviceHelper&) = delete;
@@ -122,6 +126,7 @@ public:
         if (deviceOpened) {
             close();
         }
+        GNAPluginNS::GNADeviceScheduler::instance().unregisterClient(schedulerClientId);
     }
 
     uint8_t *alloc(uint32_t size_requested, uint32_t *size_granted);
@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gna_device_scheduler.hpp"
+
+#include <algorithm>
+
+namespace GNAPluginNS {
+
+constexpr uint32_t GNADeviceScheduler::queueCapacity;
+
+GNADeviceScheduler& GNADeviceScheduler::instance() {
+    static GNADeviceScheduler scheduler;
+    return scheduler;
+}
+
+uint32_t GNADeviceScheduler::registerClient() {
+    std::lock_guard<std::mutex> lock{guard};
+    const auto clientId = nextClientId++;
+    clients[clientId];
+    return clientId;
+}
+
+void GNADeviceScheduler::unregisterClient(uint32_t clientId) {
+    {
+        std::lock_guard<std::mutex> lock{guard};
+        auto found = clients.find(clientId);
+        if (found == clients.end()) {
+            return;
+        }
+        totalInFlight -= found->second.inFlight;
+        if (found->second.inFlight != 0 && totalInFlight == 0) {
+            busyTotal += Clock::now() - busyStart;
+        }
+        clients.erase(found);
+    }
+    // the share of the remaining clients is larger now
+    slotReleased.notify_all();
+}
+
+uint32_t GNADeviceScheduler::fairShare() const {
+    return std::max<uint32_t>(1, queueCapacity / static_cast<uint32_t>(std::max<size_t>(1, clients.size())));
+}
+
+bool GNADeviceScheduler::isAdmissible(const Client& client) const {
+    return client.inFlight < fairShare();
+}
+
+bool GNADeviceScheduler::canAcquire(uint32_t clientId) const {
+    const auto& client = clients.at(clientId);
+    if (isAdmissible(client)) {
+        return true;
+    }
+    // the client over its share gives way only to the waiting clients below their share: they are admitted
+    // at once, so the wait is bounded by their submission and not by the completion of any request
+    return std::none_of(clients.begin(), clients.end(), [&](const std::pair<const uint32_t, Client>& other) {
+        return other.first != clientId && other.second.waiting != 0 && isAdmissible(other.second);
+    });
+}
+
+void GNADeviceScheduler::acquireSlot(uint32_t clientId) {
+    std::unique_lock<std::mutex> lock{guard};
+    auto& client = clients.at(clientId);
+    client.waiting++;
+    slotReleased.wait(lock, [&] { return canAcquire(clientId); });
+    client.waiting--;
+    client.inFlight++;
+
+    const auto now = Clock::now();
+    if (!used) {
+        used = true;
+        firstRequest = now;
+    }
+    if (totalInFlight++ == 0) {
+        busyStart = now;
+    }
+    // the clients over their share may proceed once this one isn't waiting anymore
+    lock.unlock();
+    slotReleased.notify_all();
+}
+
+void GNADeviceScheduler::releaseSlot(uint32_t clientId) {
+    {
+        std::lock_guard<std::mutex> lock{guard};
+        auto found = clients.find(clientId);
+        if (found == clients.end() || found->second.inFlight == 0) {
+            return;
+        }
+        found->second.inFlight--;
+        if (--totalInFlight == 0) {
+            busyTotal += Clock::now() - busyStart;
+        }
+    }
+    slotReleased.notify_all();
+}
+
+float GNADeviceScheduler::getUtilization() const {
+    std::lock_guard<std::mutex> lock{guard};
+    if (!used) {
+        return 0.f;
+    }
+    const auto now = Clock::now();
+    auto busy = busyTotal;
+    if (totalInFlight != 0) {
+        busy += now - busyStart;
+    }
+    const auto elapsed = now - firstRequest;
+    if (elapsed.count() <= 0) {
+        return 0.f;
+    }
+    return 100.f * std::chrono::duration<float>(busy).count() / std::chrono::duration<float>(elapsed).count();
+}
+
+}  // namespace GNAPluginNS
@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+namespace GNAPluginNS {
+
+/**
+ * @brief Process wide scheduler of the requests of all the GNA executable networks sharing the device
+ *
+ * The compiled models stay resident on the device, so switching between them costs only the request enqueue,
+ * and the GNA library executes the enqueued requests in the order of arrival. Without coordination a network
+ * submitting many requests fills the library queue and delays the requests of the other networks.
+ * The scheduler gives each client a fair share of the device queue: a client which has more requests in flight
+ * than its share waits while a client below its share is submitting. A client is never blocked by its own requests,
+ * so submitting several requests before waiting for them can't deadlock.
+ *
+ * The time when the device has requests in flight is accumulated to report the device utilization.
+ */
+class GNADeviceScheduler {
+public:
+    static GNADeviceScheduler& instance();
+
+    GNADeviceScheduler(const GNADeviceScheduler&) = delete;
+    GNADeviceScheduler& operator=(const GNADeviceScheduler&) = delete;
+
+    uint32_t registerClient();
+    void unregisterClient(uint32_t clientId);
+
+    /**
+     * @brief Blocks until the client may enqueue one more request, must be followed by releaseSlot
+     * when the request is waited for completion or when the enqueue fails
+     */
+    void acquireSlot(uint32_t clientId);
+    void releaseSlot(uint32_t clientId);
+
+    /**
+     * @brief Share of the time the device had requests in flight since the first request, in percent
+     */
+    float getUtilization() const;
+
+    // number of the requests in flight shared by the clients
+    static constexpr uint32_t queueCapacity = 8;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Client {
+        uint32_t inFlight = 0;
+        uint32_t waiting = 0;
+    };
+
+    GNADeviceScheduler() = default;
+
+    uint32_t fairShare() const;
+    bool isAdmissible(const Client& client) const;
+    bool canAcquire(uint32_t clientId) const;
+
+    mutable std::mutex guard;
+    std::condition_variable slotReleased;
+    std::map<uint32_t, Client> clients;
+    uint32_t nextClientId = 0;
+    uint32_t totalInFlight = 0;
+
+    bool used = false;
+    Clock::time_point firstRequest;
+    Clock::time_point busyStart;
+    Clock::duration busyTotal = Clock::duration::zero();
+};
+
+}  // namespace GNAPluginNS
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <vector>
 #include <array>
 #include <ios>
@@ -53,6 +54,24 @@ inline void readNBits(T & obj, std::istream & is) {
     obj = * reinterpret_cast<T*>(&tmp.front());
 }
 
+/**
+ * @brief Reads GNA memory image straight into the GNA allocated buffer. Reads are split into chunks so the stream
+ * never has to provide the whole image at once, and a truncated model is reported with the number of bytes read
+ */
+inline void readGnaGraph(void * basePointer, size_t gnaGraphSize, std::istream & is) {
+    constexpr size_t chunkSize = 16 * 1024 * 1024;
+    auto ptr = reinterpret_cast<char *>(basePointer);
+    size_t offset = 0;
+    try {
+        for (; offset < gnaGraphSize; offset += chunkSize) {
+            is.read(ptr + offset, std::min(chunkSize, gnaGraphSize - offset));
+        }
+    } catch (const std::ios_base::failure&) {
+        THROW_GNA_EXCEPTION << "Imported model is truncated: GNA memory of " << gnaGraphSize << " bytes expected, but only "
+                            << offset + static_cast<size_t>(is.gcount()) << " bytes read";
+    }
+}
+
 inline void * offsetToPointer(void * const base, uint64_t offset) {
     return reinterpret_cast<uint8_t *>(base) + offset;
 }
@@ -357,7 +376,7 @@ void GNAModelSerial::Import(void *basePointer,
 
 
     // once structure has been read lets read whole gna graph
-    is.read(reinterpret_cast<char*>(basePointer), gnaGraphSize);
+    readGnaGraph(basePointer, gnaGraphSize, is);
 }
 
 void GNAModelSerial::Export(void * basePointer, size_t gnaGraphSize, std::ostream & os) const {
@@ -657,7 +676,7 @@ void GNAModelSerial::Import(void *basePointer,
 
 
     // once structure has been read lets read whole gna graph
-    is.read(reinterpret_cast<char*>(basePointer), gnaGraphSize);
+    readGnaGraph(basePointer, gnaGraphSize, is);
 }
 
 /**
@@ -16,6 +16,7 @@
 #include <memory>
 #include <utility>
 #include <limits>
+#include <thread>
 
 #include <legacy/graph_tools.hpp>
 #include <legacy/net_pass.h>
@@ -26,6 +27,7 @@
 #include "optimizer/gna_pass_manager.hpp"
 #include "layers/gna_layer_type.hpp"
 #include "preprocessing.hpp"
+#include "frames_conversion.hpp"
 #include "frontend/weights_converter.hpp"
 #include "frontend/model_quantizer.hpp"
 #include "gna_fused_iterator.hpp"
@@ -97,6 +99,7 @@ uint32_t ToByteSize(const Gna2DataType type) {
 
 constexpr uint32_t GNAPluginNS::GNAPlugin::FAKE_REQUEST_CONFIG_ID;
 #endif
+constexpr uint32_t GNAPluginNS::GNAPlugin::PIPELINED_REQUESTS_NUM;
 using namespace InferenceEngine;
 using namespace std;
 using namespace GNAPluginNS;
@@ -107,6 +110,64 @@ namespace InferenceEngine {
     InferenceEngine::TBlob<gna_compound_bias_t, std::enable_if<true, void> >::~TBlob() { free(); }
 }
 
+namespace {
+
+const frames_conversion_kernels& getFramesConversionKernels() {
+    static const frames_conversion_kernels kernels = [] {
+        frames_conversion_kernels result;
+        XARCH::get_frames_conversion_kernels(&result);
+        return result;
+    }();
+    return kernels;
+}
+
+// Precision of the destination is selected by input_low_precision flag, so it's enough to check the types
+// to use the vectorized conversion of FP32 inputs
+template <typename T, typename U>
+void convertFrame(T *dst, const U *src, uint32_t num_elements, float scaleFactor, bool lowPrecision) {
+    for (uint32_t j = 0; j < num_elements; j++) {
+        if (!lowPrecision) {
+            dst[j] = GNAPluginNS::ConvertFloatToInt16(src[j] * scaleFactor);
+        } else {
+            dst[j] = GNAPluginNS::ConvertFloatToInt8(src[j] * scaleFactor);
+        }
+    }
+}
+
+void convertFrame(int16_t *dst, const float *src, uint32_t num_elements, float scaleFactor, bool) {
+    getFramesConversionKernels().float_to_int16(dst, src, num_elements, scaleFactor);
+}
+
+void convertFrame(int8_t *dst, const float *src, uint32_t num_elements, float scaleFactor, bool) {
+    getFramesConversionKernels().float_to_int8(dst, src, num_elements, scaleFactor);
+}
+
+// Splits frames into chunks processed by separate threads. Small inputs are processed by the calling thread,
+// as starting of threads takes longer than their conversion
+template <typename F>
+void parallelForFrames(bool multithreading, uint32_t num_frames, uint32_t num_vector_elements, const F& func) {
+    constexpr size_t min_elements_per_thread = 16 * 1024;
+    size_t num_threads = multithreading ? std::thread::hardware_concurrency() : 1;
+    num_threads = std::min<size_t>({num_threads, num_frames,
+                                    static_cast<size_t>(num_frames) * num_vector_elements / min_elements_per_thread});
+    if (num_threads <= 1) {
+        func(0, num_frames);
+        return;
+    }
+
+    const uint32_t chunk = static_cast<uint32_t>((num_frames + num_threads - 1) / num_threads);
+    std::vector<std::thread> threads;
+    for (uint32_t first = chunk; first < num_frames; first += chunk) {
+        threads.emplace_back(func, first, std::min(first + chunk, num_frames));
+    }
+    func(0, chunk);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+}  // namespace
+
 template <typename T, typename U>
 void GNAPlugin::copyInputData(T *dst,
                 const U *src,
@@ -119,24 +180,28 @@ void GNAPlugin::copyInputData(T *dst,
     if (!dst || !src) {
         return;
     }
+    const bool lowPrecision = gnaFlags->input_low_precision;
     if (orientation == kDnnInterleavedOrientation) {
-        for (uint32_t i = 0; i < num_frames; i++) {
-            for (uint32_t j = 0; j < num_vector_elements; j++) {
+        parallelForFrames(gnaFlags->gna_openmp_multithreading, num_frames, num_vector_elements, [&](uint32_t first, uint32_t last) {
+            std::vector<T> frame(std::is_same<T, U>::value ? 0 : num_vector_elements);
+            for (uint32_t i = first; i < last; i++) {
                 if (!std::is_same<T, U>::value) {
-                    if (!gnaFlags->input_low_precision) {
-                        dst[j * num_group + i] = GNAPluginNS::ConvertFloatToInt16(src[i * num_vector_elements + j] * scaleFactor);
-                    } else {
-                        dst[j * num_group + i] = GNAPluginNS::ConvertFloatToInt8(src[i * num_vector_elements + j] * scaleFactor);
+                    // frame is converted contiguously and then transposed
+                    convertFrame(frame.data(), src + i * num_vector_elements, num_vector_elements, scaleFactor, lowPrecision);
+                    for (uint32_t j = 0; j < num_vector_elements; j++) {
+                        dst[j * num_group + i] = frame[j];
                     }
                 } else {
-                    dst[j * num_group + i] = src[i * num_vector_elements + j];
+                    for (uint32_t j = 0; j < num_vector_elements; j++) {
+                        dst[j * num_group + i] = static_cast<T>(src[i * num_vector_elements + j]);
+                    }
+                }
+                // pad to meet weight matrix row length requirement
+                for (uint32_t j = num_vector_elements; j < num_vector_stride; j++) {
+                    dst[j * num_group + i] = 0;
                 }
             }
-            // pad to meet weight matrix row length requirement
-            for (uint32_t j = num_vector_elements; j < num_vector_stride; j++) {
-                dst[j * num_group + i] = 0;
-            }
-        }
+        });
         // pad partial group
         for (uint32_t i = num_frames; i < num_group; i++) {
             for (uint32_t j = 0; j < num_vector_stride; j++) {
@@ -145,21 +210,14 @@ void GNAPlugin::copyInputData(T *dst,
         }
     } else {
         if (!std::is_same<T, U>::value) {
-            for (uint32_t i = 0; i < num_frames; i++) {
-                T *ptr_dst_vec = reinterpret_cast<T *>(dst) + i * num_vector_stride;
-                const U *ptr_src_vec = reinterpret_cast<const U *>(src) + i * num_vector_elements;
-                std::memset(ptr_dst_vec, 0, num_vector_stride * sizeof(T));
-                if (!gnaFlags->input_low_precision) {
-                    for (uint32_t j = 0; j < num_vector_elements; j++) {
-                        ptr_dst_vec[j] = GNAPluginNS::ConvertFloatToInt16(ptr_src_vec[j] * scaleFactor);
-                    }
-                } else {
-                    for (uint32_t j = 0; j < num_vector_elements; j++) {
-                        ptr_dst_vec[j] = GNAPluginNS::ConvertFloatToInt8(ptr_src_vec[j] * scaleFactor);
-                    }
+            parallelForFrames(gnaFlags->gna_openmp_multithreading, num_frames, num_vector_elements, [&](uint32_t first, uint32_t last) {
+                for (uint32_t i = first; i < last; i++) {
+                    T *ptr_dst_vec = reinterpret_cast<T *>(dst) + i * num_vector_stride;
+                    const U *ptr_src_vec = reinterpret_cast<const U *>(src) + i * num_vector_elements;
+                    convertFrame(ptr_dst_vec, ptr_src_vec, num_vector_elements, scaleFactor, lowPrecision);
+                    std::memset(ptr_dst_vec + num_vector_elements, 0, (num_vector_stride - num_vector_elements) * sizeof(T));
                 }
-            }
-
+            });
         } else {
             for (uint32_t i = 0; i < num_frames; i++) {
                 void *ptr_dst_vec = reinterpret_cast<uint8_t *>(dst) + i * num_vector_stride * sizeof(T);
@@ -1053,6 +1111,14 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
         }
     }
 
+#if GNA_LIB_VER == 2
+    // GNA library executes requests one by one, so only I/O buffers are needed to keep several requests in flight
+    if (gnaFlags->gna_lib_async_threads_num == 1 && graphCompiler.memory_connection.empty() &&
+        gnadevice && !trivialTopology && !graphCompiler.dnnComponents.components.empty()) {
+        initPipelinedRequests(effectiveGnaCompileTarget);
+    }
+#endif
+
     // calculating input orientation without memory layers, since their orientation not changed during infer right now
     std::unordered_map<string, std::vector<string>> skippedLayers;
 
@@ -1142,6 +1208,111 @@ void GNAPlugin::createRequestConfigsForGnaModels() {
 
 #endif
 
+void GNAPlugin::initPipelinedRequests(const std::string& effectiveGnaCompileTarget) {
+    struct IORegion {
+        uint8_t* ptr;
+        size_t size;
+        size_t offset;  // offset in I/O buffers of each pipelined request
+    };
+    std::vector<IORegion> regions;
+    size_t requestIOBytes = 0;
+    auto addRegion = [&regions, &requestIOBytes](void* ptr, size_t size) {
+        if (ptr == nullptr || size == 0) {
+            return;
+        }
+        regions.push_back({reinterpret_cast<uint8_t*>(ptr), size, requestIOBytes});
+        requestIOBytes += ALIGN64(size);
+    };
+    for (auto && input : inputsDataMap) {
+        addRegion(inputsDesc->getPtrInputsGlobal(input.first).front(), inputsDesc->bytes_allocated_for_input[input.first]);
+    }
+    int outputIdx = 0;
+    for (auto && output : outputsDataMap) {
+        auto& outputDesc = outputsDesc[outputIdx++];
+        addRegion(outputDesc.ptrs.front(), outputDesc.num_bytes_per_element * details::product(output.second->getTensorDesc().getDims()));
+    }
+
+    auto overlaps = [](const IORegion& region, const uint8_t* ptr, size_t size) {
+        return ptr < region.ptr + region.size && region.ptr < ptr + size;
+    };
+    auto contains = [](const IORegion& region, const uint8_t* ptr, size_t size) {
+        return ptr >= region.ptr && ptr + size <= region.ptr + region.size;
+    };
+    for (size_t i = 0; i < regions.size(); i++) {
+        for (size_t j = i + 1; j < regions.size(); j++) {
+            if (overlaps(regions[i], regions[j].ptr, regions[j].size)) {
+                gnalog() << "Requests pipelining is disabled: network inputs and outputs share GNA memory\n";
+                return;
+            }
+        }
+    }
+
+    // operands which are partially located in I/O buffers (e.g. concat of input with other data) cannot be relocated
+    auto& model = std::get<0>(gnaModels.front())->obj;
+    for (uint32_t i = 0; i != model.NumberOfOperations; i++) {
+        for (uint32_t j = 0; j != 2; j++) {
+            const auto operand = model.Operations[i].Operands[j];
+            if (operand == nullptr || operand->Data == nullptr) {
+                continue;
+            }
+            auto ptr = reinterpret_cast<const uint8_t*>(operand->Data);
+            size_t size = ToByteSize(operand->Type);
+            for (uint32_t d = 0; d != operand->Shape.NumberOfDimensions; d++) {
+                size *= operand->Shape.Dimensions[d];
+            }
+            for (auto && region : regions) {
+                if ((size == 0 && contains(region, ptr, 1)) || (overlaps(region, ptr, size) && !contains(region, ptr, size))) {
+                    gnalog() << "Requests pipelining is disabled: operand of operation " << i << " is partially located in I/O buffer\n";
+                    return;
+                }
+            }
+        }
+    }
+
+    uint32_t granted = 0;
+    const uint32_t requestedBytes = static_cast<uint32_t>(requestIOBytes * (PIPELINED_REQUESTS_NUM - 1));
+    auto device = gnadevice;
+    pipelinedIOData.reset(gnadevice->alloc(requestedBytes, &granted), [device](uint8_t* ptr) {
+        device->free(ptr);
+    });
+
+    for (uint32_t i = 1; i != PIPELINED_REQUESTS_NUM; i++) {
+        auto basePtr = pipelinedIOData.get() + requestIOBytes * (i - 1);
+        auto relocate = [basePtr, &regions](void* ptr) -> void* {
+            for (auto && region : regions) {
+                auto bytePtr = reinterpret_cast<uint8_t*>(ptr);
+                if (bytePtr >= region.ptr && bytePtr < region.ptr + region.size) {
+                    return basePtr + region.offset + (bytePtr - region.ptr);
+                }
+            }
+            return ptr;
+        };
+
+        gnaModels.push_back(std::make_tuple(make_shared<CPPWrapper<Gna2Model>>()));
+        dnn->InitGNAStruct(&std::get<0>(gnaModels.back())->obj, effectiveGnaCompileTarget);
+        auto& pipelinedModel = std::get<0>(gnaModels.back())->obj;
+        for (uint32_t j = 0; j != pipelinedModel.NumberOfOperations; j++) {
+            auto& gnaOperation = pipelinedModel.Operations[j];
+            for (uint32_t k = 0; k != 2; k++) {
+                if (gnaOperation.Operands[k] != nullptr) {
+                    auto& data = const_cast<Gna2Tensor*>(gnaOperation.Operands[k])->Data;
+                    data = relocate(data);
+                }
+            }
+        }
+
+        for (auto && input : inputsDataMap) {
+            auto& ptrs = inputsDesc->getPtrInputsGlobal(input.first);
+            ptrs.resize(PIPELINED_REQUESTS_NUM);
+            ptrs[i] = relocate(ptrs.front());
+        }
+        for (auto && outputDesc : outputsDesc) {
+            outputDesc.ptrs.resize(PIPELINED_REQUESTS_NUM);
+            outputDesc.ptrs[i] = relocate(outputDesc.ptrs.front());
+        }
+    }
+}
+
 int GNAPlugin::GetDeviceVersionFromString(const std::string deviceString) {
     constexpr uint32_t embeddedSuffix = 0xE;
     if (deviceString.empty())
@@ -1212,7 +1383,7 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
         } else {
             IE_THROW(RequestBusy)
                                << "GNA executable network has max of "
-                               << static_cast<uint32_t >(gnaFlags->gna_lib_async_threads_num)
+                               << static_cast<uint32_t >(nnets.size())
                                << " parallel infer requests, please sync one of already running";
         }
     }
@@ -1438,10 +1609,9 @@ GnaWaitStatus GNAPlugin::WaitFor(uint32_t request_idx, int64_t millisTimeout) {
                 fprintf(f, "\n\n");
             }
 #endif
-            ConvertToFloat(outputBlob->buffer(),
+            getFramesConversionKernels().int32_to_float(outputBlob->buffer(),
                 outputBlob->buffer(),
-                elementsPerBatch,
-                batchSize,
+                static_cast<size_t>(elementsPerBatch) * batchSize,
                 outputDesc.scale_factor);
 #ifdef PLOT
             if (f) {
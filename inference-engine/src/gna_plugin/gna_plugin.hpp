@@ -70,6 +70,7 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
 
 #if GNA_LIB_VER == 2
     void createRequestConfigsForGnaModels();
+    void initPipelinedRequests(const std::string& effectiveGnaCompileTarget);
 #endif
 
     static int GetDeviceVersionFromString(const std::string deviceString);
@@ -79,6 +80,15 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
      * @brief size of RW segment without extra memory for parallel execution
      */
     uint32_t rwSegmentSize = 0;
+    /**
+     * @brief number of requests in flight when GNA library runs them one by one:
+     * inputs import of the next request, execution of the current one and outputs export of the previous one
+     */
+    static constexpr uint32_t PIPELINED_REQUESTS_NUM = 3;
+    /**
+     * @brief input and output buffers of the pipelined requests, intermediate buffers are shared by all of them
+     */
+    std::shared_ptr<uint8_t> pipelinedIOData;
 
     InferenceEngine::InputsDataMap inputsDataMap;
     InferenceEngine::OutputsDataMap outputsDataMap;
@@ -5,6 +5,7 @@
 #include <ie_parameter.hpp>
 #include "gna_plugin.hpp"
 #include "gna/gna_config.hpp"
+#include "gna_device_scheduler.hpp"
 
 #include <string>
 #include <map>
@@ -47,6 +48,7 @@ Parameter GNAPlugin::GetMetric(const std::string& name, const std::map<std::stri
             return deviceName;
         }},
         {METRIC_KEY(GNA_LIBRARY_FULL_VERSION), [this]() {return GNADeviceHelper::GetGnaLibraryVersion();}},
+        {METRIC_KEY(GNA_DEVICE_UTILIZATION), []() {return GNADeviceScheduler::instance().getUtilization();}},
         {METRIC_KEY(SUPPORTED_METRICS), [&queryApiSupported, this]() {
             std::vector<std::string> availablesMetrics;
             for (auto && supportedAPI : queryApiSupported) {
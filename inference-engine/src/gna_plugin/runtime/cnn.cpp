@@ -9,6 +9,7 @@
 #include <gna_plugin_log.hpp>
 
 #include "cnn.h"
+#include "float_kernels.hpp"
 #include "backend/dnn_types.h"
 #include "backend/gna_limitations.hpp"
 #include "gna_lib_ver_selector.hpp"
@@ -37,13 +38,11 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
+    const auto dot_product = GNAPluginNS::runtime::getFloatKernels().dot_product;
     for (uint32_t j = 0; j < numberOfOutputsPerFilter; j++, input += convolutionStride, output += numberOfFilters) {
         auto filter = filters;
         for (uint32_t i = 0; i < numberOfFilters; i++, filter += filterSize) {
-            output[i] = biases[i];
-            for (uint32_t k = 0; k < filterSize; k++) {
-                output[i] += input[k] * filter[k];
-            }
+            output[i] = biases[i] + dot_product(input, filter, filterSize);
         }
     }
 }
@@ -208,22 +207,18 @@ float CNN2DFilter32SingleHWC(const float bias, const float* filter, const unsign
 
     const auto zPH = zeroPadding[0];
     const auto zPW = zeroPadding[1];
+    const auto dot_product = GNAPluginNS::runtime::getFloatKernels().dot_product;
     float output = 0;
     for (unsigned kh = 0; kh < KH; kh++) {
         for (unsigned kw = 0; kw < KW; kw++) {
-            for (unsigned kc = 0; kc < KC; kc++) {
-                if (!matchesPaddedArea(kh, oh, IH, zPH, cSH) &&
-                    !matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
-                    const auto ih = (cSH * oh + kh) - zPH;
-                    const auto iw = (cSW * ow + kw) - zPW;
-                    const auto ic = kc;
-                    const auto imageIndex = getQubeIndex(ih, iw, ic, IW, IC);
-                    const auto imageElement = image[imageIndex];
-                    const auto filterIndex = getQubeIndex(kh, kw, kc, KW, KC);
-                    const auto filterElement = filter[filterIndex];
-                    const auto product = imageElement * filterElement;
-                    output += product;
-                }
+            // channels are innermost in both image and filter, so each pixel is a dot product of contiguous data
+            if (!matchesPaddedArea(kh, oh, IH, zPH, cSH) &&
+                !matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
+                const auto ih = (cSH * oh + kh) - zPH;
+                const auto iw = (cSW * ow + kw) - zPW;
+                const auto imageIndex = getQubeIndex(ih, iw, 0u, IW, IC);
+                const auto filterIndex = getQubeIndex(kh, kw, 0u, KW, KC);
+                output += dot_product(image + imageIndex, filter + filterIndex, KC);
             }
         }
     }
@@ -0,0 +1,73 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "float_kernels.hpp"
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace XARCH {
+
+static float dot_product(const float* a, const float* b, size_t count) {
+    size_t i = 0;
+    float sum = 0.0f;
+#if defined(HAVE_AVX512F)
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+    for (; i + 32 <= count; i += 32) {
+        sum0 = _mm512_add_ps(sum0, _mm512_mul_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+        sum1 = _mm512_add_ps(sum1, _mm512_mul_ps(_mm512_loadu_ps(a + i + 16), _mm512_loadu_ps(b + i + 16)));
+    }
+    for (; i + 16 <= count; i += 16) {
+        sum0 = _mm512_add_ps(sum0, _mm512_mul_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+    }
+    float partial[16];
+    _mm512_storeu_ps(partial, _mm512_add_ps(sum0, sum1));
+    for (size_t l = 0; l < 16; l++) {
+        sum += partial[l];
+    }
+#elif defined(HAVE_AVX2)
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    for (; i + 16 <= count; i += 16) {
+        sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+        sum1 = _mm256_add_ps(sum1, _mm256_mul_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8)));
+    }
+    for (; i + 8 <= count; i += 8) {
+        sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    sum0 = _mm256_add_ps(sum0, sum1);
+    __m128 sum128 = _mm_add_ps(_mm256_castps256_ps128(sum0), _mm256_extractf128_ps(sum0, 1));
+    sum128 = _mm_add_ps(sum128, _mm_movehl_ps(sum128, sum128));
+    sum128 = _mm_add_ss(sum128, _mm_shuffle_ps(sum128, sum128, 1));
+    sum = _mm_cvtss_f32(sum128);
+#else
+    // independent partial sums let the compiler use SSE registers without reordering of additions
+    constexpr size_t lanes = 8;
+    float partial[lanes] = {};
+    for (; i + lanes <= count; i += lanes) {
+        for (size_t l = 0; l < lanes; l++) {
+            partial[l] += a[i + l] * b[i + l];
+        }
+    }
+    for (size_t l = 0; l < lanes; l++) {
+        sum += partial[l];
+    }
+#endif
+    for (; i < count; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+void get_float_kernels(float_kernels* kernels) {
+    kernels->dot_product = dot_product;
+}
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
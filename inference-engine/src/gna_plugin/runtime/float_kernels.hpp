@@ -0,0 +1,31 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace GNAPluginNS {
+namespace runtime {
+
+/**
+ * @brief Inner loops of the GNA_SW_FP32 emulation.
+ * Products are summed in several partial sums, so results may differ from sequential summation in last bits
+ */
+struct float_kernels {
+    float (*dot_product)(const float* a, const float* b, size_t count);
+};
+
+/**
+ * @brief Kernels for the best instruction set supported by the host
+ */
+const float_kernels& getFloatKernels();
+
+namespace XARCH {
+
+void get_float_kernels(float_kernels* kernels);
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
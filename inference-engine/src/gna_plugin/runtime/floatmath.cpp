@@ -1,13 +1,44 @@
 // Copyright (C) 2018-2021 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines (for reference)
 //
 
 #include <cstdint>
 #include <cstdio>
+#include <vector>
 
 #include "floatmath.h"
+#include "float_kernels.hpp"
+
+using GNAPluginNS::runtime::getFloatKernels;
+
+const GNAPluginNS::runtime::float_kernels& GNAPluginNS::runtime::getFloatKernels() {
+    static const float_kernels kernels = [] {
+        float_kernels result;
+        XARCH::get_float_kernels(&result);
+        return result;
+    }();
+    return kernels;
+}
+
+namespace {
+
+// Columns of B are transposed once to compute every element of C as a dot product of contiguous rows
+const float *transposeColumns(const float *B, const MKL_INT ldb, const MKL_INT N, const MKL_INT K, std::vector<float> &buffer) {
+    if (N == 1 && ldb == 1) {
+        return B;
+    }
+    buffer.resize(static_cast<size_t>(N) * K);
+    for (MKL_INT k = 0; k < K; k++) {
+        for (MKL_INT j = 0; j < N; j++) {
+            buffer[static_cast<size_t>(j) * K + k] = B[k * ldb + j];
+        }
+    }
+    return buffer.data();
+}
+
+}  // namespace
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -26,13 +57,14 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
         throw -1;
     }
 
+    const auto dot_product = getFloatKernels().dot_product;
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
+        std::vector<float> buffer;
+        const float *Bt = transposeColumns(B, ldb, N, K, buffer);
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
                 float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
+                sum += dot_product(A + i * lda, Bt + j * K, K);
                 C[i * ldc + j] = sum;
             }
         }
@@ -41,9 +73,7 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
             for (j = 0; j < N; j++) {
                 float sum;
                 sum = beta * C[i * ldc + j];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
+                sum += alpha * dot_product(A + i * lda, B + j * ldb, K);
                 C[i * ldc + j] = sum;
             }
         }
@@ -104,14 +134,15 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
         throw -1;
     }
 
+    const auto dot_product = getFloatKernels().dot_product;
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
+        std::vector<float> buffer;
+        const float *Bt = transposeColumns(B, ldb, N, K, buffer);
         for (l = 0; l < L; l++) {
             i = OutputList[l];
             for (j = 0; j < N; j++) {
                 float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
+                sum += dot_product(A + i * lda, Bt + j * K, K);
                 C[l * ldc + j] = sum;
             }
         }
@@ -121,9 +152,7 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                 float sum;
                 j = OutputList[l];
                 sum = beta * C[i * ldc + l];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
+                sum += alpha * dot_product(A + i * lda, B + j * ldb, K);
                 C[i * ldc + l] = sum;
             }
         }
@@ -155,16 +184,13 @@ void sgemv_split(const uint32_t N,
                  float *C) {
     uint32_t num_columns = K1 + K2;
     uint32_t num_rows = N;
-    uint32_t i, j;
+    uint32_t i;
 
+    const auto dot_product = getFloatKernels().dot_product;
     for (i = 0; i < num_rows; i++) {
         float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
+        sum += dot_product(A1, X + i * num_columns, K1);
+        sum += dot_product(A2, X + i * num_columns + K1, K2);
         C[i] = sum;
     }
 }
@@ -9,6 +9,10 @@
 #include <limits>
 #include <cstdint>
 #include <algorithm>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <utility>
 
 #ifdef _NO_MKL_
 #include <cmath>
@@ -322,13 +326,13 @@ inline std::vector<pwl_t> negative_pwl(const std::vector<pwl_t>& pwl) {
     return(new_pwl);
 }
 
-std::vector<pwl_t> pwl_search(const DnnActivation& activation_type,
-                                const double l_bound,
-                                const double u_bound,
-                                const double threshold,
-                                const double allowed_err_pct,
-                                const int samples,
-                                double& err_pct) {
+static std::vector<pwl_t> pwl_search_uncached(const DnnActivation& activation_type,
+                                              const double l_bound,
+                                              const double u_bound,
+                                              const double threshold,
+                                              const double allowed_err_pct,
+                                              const int samples,
+                                              double& err_pct) {
     std::vector<pwl_t> pwl;
     double err = 0.0;
     int n_segments = 1;
@@ -493,6 +497,72 @@ std::vector<pwl_t> pwl_search(const DnnActivation& activation_type,
     return(pwl);
 }
 
+namespace {
+
+// function, its pow arguments, input range, threshold, allowed error and number of samples
+using pwl_search_key = std::tuple<int, float, float, float, double, double, double, double, int>;
+using pwl_search_result = std::pair<std::vector<pwl_t>, double>;
+
+// Segments depend only on the function and its input range, not on the scale factors of the layer,
+// so the same search is done once for all layers and networks of the process
+class pwl_search_cache {
+ public:
+    bool find(const pwl_search_key& key, pwl_search_result& result) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = entries.find(key);
+        if (found == entries.end()) {
+            return false;
+        }
+        result = found->second;
+        return true;
+    }
+
+    void insert(const pwl_search_key& key, const pwl_search_result& result) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (entries.size() >= max_entries) {
+            entries.clear();
+        }
+        entries.emplace(key, result);
+    }
+
+ private:
+    static constexpr size_t max_entries = 1024;
+    std::mutex mutex;
+    std::map<pwl_search_key, pwl_search_result> entries;
+};
+
+pwl_search_cache& get_pwl_search_cache() {
+    static pwl_search_cache cache;
+    return cache;
+}
+
+}  // namespace
+
+std::vector<pwl_t> pwl_search(const DnnActivation& activation_type,
+                                const double l_bound,
+                                const double u_bound,
+                                const double threshold,
+                                const double allowed_err_pct,
+                                const int samples,
+                                double& err_pct) {
+    const bool is_pow = activation_type == kActPow;
+    const pwl_search_key key{static_cast<int>(activation_type.type),
+                             is_pow ? activation_type.args.pow.exponent : 0.0f,
+                             is_pow ? activation_type.args.pow.scale : 0.0f,
+                             is_pow ? activation_type.args.pow.offset : 0.0f,
+                             l_bound, u_bound, threshold, allowed_err_pct, samples};
+    pwl_search_result result;
+    if (get_pwl_search_cache().find(key, result)) {
+        err_pct = result.second;
+        return result.first;
+    }
+
+    result.first = pwl_search_uncached(activation_type, l_bound, u_bound, threshold, allowed_err_pct, samples, result.second);
+    get_pwl_search_cache().insert(key, result);
+    err_pct = result.second;
+    return result.first;
+}
+
 
 void PwlDesignOpt(const DnnActivation activation_type,
                     std::vector<gna_pwl_segment_t> &ptr_segment,
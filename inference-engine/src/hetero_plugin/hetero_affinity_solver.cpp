@@ -0,0 +1,199 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_affinity_solver.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+
+#include <ngraph/op/util/op_types.hpp>
+
+using namespace HeteroPlugin;
+
+namespace {
+
+// the costs are measured in the elements: processing an element costs 1 on the first fallback device
+constexpr double transferElementCost = 1.0;
+// the start of the next subgraph subrequest and the wait for the previous one
+constexpr double boundarySyncCost = 10000.0;
+constexpr std::size_t unassigned = std::numeric_limits<std::size_t>::max();
+
+bool IsComputeNode(const ngraph::Node* node) {
+    return !ngraph::op::is_constant(node) && !ngraph::op::is_parameter(node) && !ngraph::op::is_output(node);
+}
+
+double ElementsCount(const ngraph::PartialShape& shape) {
+    return shape.is_static() ? static_cast<double>(ngraph::shape_size(shape.to_shape())) : 1.0;
+}
+
+struct Edge {
+    std::size_t _producer;
+    std::size_t _consumer;
+    double      _cost;
+};
+
+struct Island {
+    double                      _cost = 0.0;
+    std::vector<std::size_t>    _nodes;
+    // the cost of the edges to the neighbour nodes of each device
+    std::vector<double>         _boundary;
+};
+
+}  // namespace
+
+void HeteroPlugin::SolveAffinities(const std::shared_ptr<const ngraph::Function>& function,
+                                   const std::vector<std::map<std::string, std::string>>& supportedLayers,
+                                   std::map<std::string, std::string>& affinities) {
+    const auto devicesNum = supportedLayers.size();
+    auto IsSupported = [&] (std::size_t device, const std::string& name) {
+        return supportedLayers[device].find(name) != supportedLayers[device].end();
+    };
+
+    std::vector<const ngraph::Node*> nodes;
+    std::unordered_map<const ngraph::Node*, std::size_t> nodeIndices;
+    std::vector<std::size_t> devices;
+    std::vector<double> costs;
+    for (auto&& op : function->get_ordered_ops()) {
+        if (!IsComputeNode(op.get())) {
+            continue;
+        }
+        // the fallback policy assigns the first device supporting the node
+        std::size_t device = unassigned;
+        for (std::size_t d = 0; d < devicesNum && device == unassigned; ++d) {
+            if (IsSupported(d, op->get_friendly_name())) {
+                device = d;
+            }
+        }
+        double cost = 0.0;
+        for (auto&& output : op->outputs()) {
+            cost += ElementsCount(output.get_partial_shape());
+        }
+        for (auto&& input : op->inputs()) {
+            if (ngraph::op::is_constant(input.get_source_output().get_node())) {
+                cost += ElementsCount(input.get_partial_shape());
+            }
+        }
+        nodeIndices.emplace(op.get(), nodes.size());
+        nodes.push_back(op.get());
+        devices.push_back(device);
+        costs.push_back(cost);
+    }
+
+    std::vector<Edge> edges;
+    for (std::size_t consumer = 0; consumer < nodes.size(); ++consumer) {
+        for (auto&& input : nodes[consumer]->inputs()) {
+            auto itProducer = nodeIndices.find(input.get_source_output().get_node());
+            if (itProducer != nodeIndices.end()) {
+                edges.push_back({itProducer->second, consumer,
+                                 transferElementCost * ElementsCount(input.get_partial_shape()) + boundarySyncCost});
+            }
+        }
+    }
+
+    // every move merges the island into its neighbours, so the number of the islands decreases
+    for (bool moved = true; moved;) {
+        moved = false;
+        std::vector<std::size_t> parents(nodes.size());
+        std::iota(parents.begin(), parents.end(), 0);
+        auto Root = [&] (std::size_t node) {
+            while (parents[node] != node) {
+                node = parents[node] = parents[parents[node]];
+            }
+            return node;
+        };
+        for (auto&& edge : edges) {
+            if (devices[edge._producer] != unassigned && devices[edge._producer] == devices[edge._consumer]) {
+                parents[Root(edge._producer)] = Root(edge._consumer);
+            }
+        }
+
+        std::unordered_map<std::size_t, Island> islands;
+        for (std::size_t node = 0; node < nodes.size(); ++node) {
+            auto& island = islands[Root(node)];
+            island._cost += costs[node];
+            island._nodes.push_back(node);
+            island._boundary.resize(devicesNum, 0.0);
+        }
+        for (auto&& edge : edges) {
+            const auto producerRoot = Root(edge._producer);
+            const auto consumerRoot = Root(edge._consumer);
+            if (producerRoot == consumerRoot ||
+                devices[edge._producer] == unassigned || devices[edge._consumer] == unassigned) {
+                continue;
+            }
+            islands[producerRoot]._boundary[devices[edge._consumer]] += edge._cost;
+            islands[consumerRoot]._boundary[devices[edge._producer]] += edge._cost;
+        }
+
+        std::vector<const Island*> orderedIslands;
+        for (auto&& island : islands) {
+            orderedIslands.push_back(&island.second);
+        }
+        std::stable_sort(orderedIslands.begin(), orderedIslands.end(), [] (const Island* l, const Island* r) {
+            return l->_cost < r->_cost || (l->_cost == r->_cost && l->_nodes.front() < r->_nodes.front());
+        });
+
+        for (auto&& island : orderedIslands) {
+            const auto device = devices[island->_nodes.front()];
+            if (device == unassigned) {
+                continue;
+            }
+            std::size_t bestDevice = unassigned;
+            double bestGain = 0.0;
+            for (std::size_t target = 0; target < devicesNum; ++target) {
+                if (target == device || island->_boundary[target] == 0.0 ||
+                    !std::all_of(island->_nodes.begin(), island->_nodes.end(), [&] (std::size_t node) {
+                        return IsSupported(target, nodes[node]->get_friendly_name());
+                    })) {
+                    continue;
+                }
+                // the edges to the target device disappear, the compute cost changes with the device speed
+                const double gain = island->_boundary[target] -
+                                    island->_cost * (static_cast<double>(target) - static_cast<double>(device));
+                if (gain > bestGain) {
+                    bestGain = gain;
+                    bestDevice = target;
+                }
+            }
+            if (bestDevice != unassigned) {
+                for (auto&& node : island->_nodes) {
+                    devices[node] = bestDevice;
+                }
+                moved = true;
+                break;
+            }
+        }
+    }
+
+    for (std::size_t node = 0; node < nodes.size(); ++node) {
+        if (devices[node] != unassigned) {
+            const auto& name = nodes[node]->get_friendly_name();
+            affinities[name] = supportedLayers[devices[node]].at(name);
+        }
+    }
+
+    // constants and parameters go with their first consumer, results go with their producer
+    for (auto&& op : function->get_ordered_ops()) {
+        if (IsComputeNode(op.get())) {
+            continue;
+        }
+        const ngraph::Node* neighbour = nullptr;
+        if (ngraph::op::is_output(op)) {
+            neighbour = op->get_input_node_ptr(0);
+        } else if (op->get_output_size() != 0 && !op->output(0).get_target_inputs().empty()) {
+            neighbour = op->output(0).get_target_inputs().begin()->get_node();
+        }
+        auto itNeighbour = nodeIndices.find(neighbour);
+        if (itNeighbour == nodeIndices.end() || devices[itNeighbour->second] == unassigned) {
+            continue;
+        }
+        const auto device = devices[itNeighbour->second];
+        const auto& name = op->get_friendly_name();
+        if (IsSupported(device, name)) {
+            affinities[name] = supportedLayers[device].at(name);
+        }
+    }
+}
@@ -0,0 +1,34 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/function.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Refines the first-supported-device affinities of the fallback policy with a heuristic cost model.
+ *
+ * The cost of an operation is estimated by the number of the elements it produces and reads from the constants,
+ * the device of the fallback position `i` is expected to be `(1 + i)` times slower than the first one.
+ * Every edge between the devices costs a copy of the tensor and a fixed synchronization cost of the subgraphs.
+ * The islands (connected operations of the same device) are moved to the neighbour device supporting all
+ * their operations, the smallest first, while it reduces the total cost, so the small islands are merged back
+ * into the dominant device. Constants, parameters and results follow the operations they are connected to.
+ *
+ * @param function The network function
+ * @param supportedLayers The QueryNetwork results of the devices in the fallback priority order
+ * @param affinities The layer to device map which is refined in place
+ */
+void SolveAffinities(const std::shared_ptr<const ngraph::Function>& function,
+                     const std::vector<std::map<std::string, std::string>>& supportedLayers,
+                     std::map<std::string, std::string>& affinities);
+
+}  // namespace HeteroPlugin
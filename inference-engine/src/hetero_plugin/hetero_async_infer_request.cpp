@@ -17,24 +17,39 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
     _pipeline.clear();
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
-            explicit RequestExecutor(SoIInferRequestInternal & inferRequest) : _inferRequest(inferRequest) {
+            RequestExecutor(SoIInferRequestInternal & inferRequest, const HeteroStageExecutor::Ptr& stageExecutor) :
+                _inferRequest(inferRequest), _stageExecutor(stageExecutor) {
                 _inferRequest->SetCallback(
                 [this] (std::exception_ptr exceptionPtr) mutable {
-                    _exceptionPtr = exceptionPtr;
-                    auto capturedTask = std::move(_task);
-                    capturedTask();
+                    Completed(exceptionPtr);
                 });
             }
             void run(Task task) override {
                 _task = std::move(task);
-                _inferRequest->StartAsync();
+                // the subrequest is started once the device stage has a free slot,
+                // so it can be started from the callback of another HETERO request
+                _stageExecutor->run([this] {
+                    try {
+                        _inferRequest->StartAsync();
+                    } catch (...) {
+                        Completed(std::current_exception());
+                    }
+                });
             };
+            void Completed(std::exception_ptr exceptionPtr) {
+                _exceptionPtr = exceptionPtr;
+                _stageExecutor->Release();
+                auto capturedTask = std::move(_task);
+                capturedTask();
+            }
             SoIInferRequestInternal &  _inferRequest;
+            HeteroStageExecutor::Ptr   _stageExecutor;
             std::exception_ptr         _exceptionPtr;
             Task                       _task;
         };
 
-        auto requestExecutor = std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request);
+        auto requestExecutor = std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request,
+                                                                 _heteroInferRequest->_inferRequests[requestId]._stageExecutor);
         _pipeline.emplace_back(requestExecutor, [requestExecutor] {
             if (nullptr != requestExecutor->_exceptionPtr) {
                 std::rethrow_exception(requestExecutor->_exceptionPtr);
@@ -380,6 +380,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
 
     InputsDataMap externalInputsData = network.getInputsInfo();
     OutputsDataMap externalOutputsData = network.getOutputsInfo();
+    OutputsDataMap subgraphOutputs;
     _networks.resize(orderedSubgraphs.size());
     std::vector<std::shared_ptr<ngraph::Function>> subFunctions(orderedSubgraphs.size());
     int id = 0;
@@ -408,6 +409,19 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                 itClonedOutput->second->setLayout(externalOutput.second->getLayout());
             }
         }
+        // subgraph inputs are bound to the producer output blobs as is, so keep the same precision and layout
+        // on both sides of the boundary to let the consumer plugin use the producer memory without conversion
+        for (auto&& clonedInput : clonedInputs) {
+            auto itBlobName = _blobNameMap.find(clonedInput.first);
+            if (itBlobName != _blobNameMap.end()) {
+                auto itProducerOutput = subgraphOutputs.find(itBlobName->second);
+                if (itProducerOutput != subgraphOutputs.end()) {
+                    clonedInput.second->setPrecision(itProducerOutput->second->getPrecision());
+                    clonedInput.second->setLayout(itProducerOutput->second->getLayout());
+                }
+            }
+        }
+        subgraphOutputs.insert(clonedOutputs.begin(), clonedOutputs.end());
         ++id;
     }
     if (dumpDotFile) {
@@ -735,12 +749,25 @@ void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
 IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
         InputsDataMap networkInputs,
         OutputsDataMap networkOutputs) {
+    // one pipeline stage per device, shared between all infer requests of the network
+    std::call_once(_stageExecutorsOnce, [&] {
+        std::unordered_map<std::string, unsigned int> maxInFlight;
+        for (auto&& subnetwork : _networks) {
+            auto& value = maxInFlight[subnetwork._device];
+            value = std::max(value,
+                subnetwork._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+        }
+        for (auto&& device : maxInFlight) {
+            _stageExecutors.emplace(device.first, std::make_shared<HeteroStageExecutor>(device.second));
+        }
+    });
     HeteroInferRequest::SubRequestsList inferRequests;
     int index = 0;
     for (auto&& subnetwork : _networks) {
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
+        desc._stageExecutor = _stageExecutors.at(subnetwork._device);
         inferRequests.push_back(desc);
     }
     return std::make_shared<HeteroInferRequest>(networkInputs,
@@ -767,6 +794,9 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == HETERO_CONFIG_KEY(COST_MODEL_AFFINITY)) {
+        auto it = _config.find(name);
+        result = it != _config.end() && it->second == YES;
     } else {
         // find config key among plugin config keys
         for (auto&& desc : _networks) {
@@ -851,6 +881,7 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
         std::vector<std::string> heteroConfigKeys = {
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(COST_MODEL_AFFINITY),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
         };
 
@@ -873,9 +904,17 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
     } else if (EXEC_NETWORK_METRIC_KEY(NETWORK_NAME) == name) {
         IE_SET_METRIC_RETURN(NETWORK_NAME, _name);
     } else if (EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
-        unsigned int value = 0u;
+        // subgraphs of different requests are executed as a pipeline,
+        // so each device stage should be kept busy with its own optimal number of requests
+        std::unordered_map<std::string, unsigned int> stageValues;
         for (auto&& desc : _networks) {
-            value = std::max(value, desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            auto& stageValue = stageValues[desc._device];
+            stageValue = std::max(stageValue,
+                desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+        }
+        unsigned int value = 0u;
+        for (auto&& stageValue : stageValues) {
+            value += stageValue.second;
         }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
     } else {
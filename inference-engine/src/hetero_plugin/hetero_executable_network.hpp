@@ -12,6 +12,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -73,6 +74,8 @@ private:
     std::string                                  _name;
     std::map<std::string, std::string>           _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+    std::once_flag                               _stageExecutorsOnce;
+    std::unordered_map<std::string, HeteroStageExecutor::Ptr> _stageExecutors;
 };
 
 }  // namespace HeteroPlugin
@@ -26,11 +26,14 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
         IE_THROW() << "Internal error: no information about network's output/input";
     }
 
-    auto requestBlob([&](const std::string& blobName, InferenceEngine::SoIInferRequestInternal& r) {
+    auto requestBlob([&](const std::string& blobName, std::size_t requestId) {
+        auto& r = _inferRequests[requestId]._request;
         std::string intermediateBlobName = blobName;
         auto itName = subgraphInputToOutputBlobNames.find(blobName);
         if (itName != subgraphInputToOutputBlobNames.end()) {
             intermediateBlobName = itName->second;
+            // the consumer works directly on the producer output blob, so it has to follow it if the blob is replaced
+            _subgraphConsumers[intermediateBlobName].emplace_back(requestId, blobName);
         }
         BlobMap::iterator itBlob;
         bool emplaced = false;
@@ -48,18 +51,19 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
     });
 
     // go over all subnet and create requests
-    for (auto&& desc : _inferRequests) {
+    for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+        auto& desc = _inferRequests[requestId];
         desc._request = {desc._network._so, desc._network->CreateInferRequest()};
-        // go over all inputs and get blobs from subnet infer requests
+        // go over all outputs and get blobs from subnet infer requests
         for (auto&& outputInfo : desc._network->GetOutputsInfo()) {
-            requestBlob(outputInfo.first, desc._request);
+            requestBlob(outputInfo.first, requestId);
         }
     }
 
-    // go over all outputs and get blobs from subnet infer requests
-    for (auto&& desc : _inferRequests) {
-        for (auto&& inputInfo : desc._network->GetInputsInfo()) {
-            requestBlob(inputInfo.first, desc._request);
+    // go over all inputs and share producer output blobs with the consumer subnet infer requests
+    for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+        for (auto&& inputInfo : _inferRequests[requestId]._network->GetInputsInfo()) {
+            requestBlob(inputInfo.first, requestId);
         }
     }
 }
@@ -133,6 +137,13 @@ void HeteroInferRequest::updateInOutIfNeeded() {
                 if (ito->second != _blobs[ioname]) {
                     r->SetBlob(ioname.c_str(), ito->second);
                     _blobs[ioname] = ito->second;
+                    // network output which is also consumed by the next subgraphs
+                    auto itConsumers = _subgraphConsumers.find(ioname);
+                    if (itConsumers != _subgraphConsumers.end()) {
+                        for (auto&& consumer : itConsumers->second) {
+                            _inferRequests[consumer.first]._request->SetBlob(consumer.second, ito->second);
+                        }
+                    }
                 }
             }
         }
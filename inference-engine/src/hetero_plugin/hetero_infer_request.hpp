@@ -8,11 +8,13 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <utility>
 #include <unordered_map>
 #include <ie_common.h>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 #include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
 #include <openvino/itt.hpp>
+#include "hetero_stage_executor.hpp"
 
 namespace HeteroPlugin {
 
@@ -24,6 +26,7 @@ public:
         InferenceEngine::SoExecutableNetworkInternal  _network;
         InferenceEngine::SoIInferRequestInternal      _request;
         openvino::itt::handle_t                       _profilingTask;
+        HeteroStageExecutor::Ptr                      _stageExecutor;
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
@@ -42,6 +45,8 @@ public:
 
     SubRequestsList _inferRequests;
     std::map<std::string, InferenceEngine::Blob::Ptr>   _blobs;
+    // producer output blob name -> consumer subrequest index and its input name
+    std::unordered_map<std::string, std::vector<std::pair<std::size_t, std::string>>> _subgraphConsumers;
 };
 
 }  // namespace HeteroPlugin
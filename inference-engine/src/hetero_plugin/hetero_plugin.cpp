@@ -13,6 +13,7 @@
 #include <unordered_set>
 #include "ie_plugin_config.hpp"
 #include "hetero_executable_network.hpp"
+#include "hetero_affinity_solver.hpp"
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 
 using namespace InferenceEngine;
@@ -24,6 +25,7 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(COST_MODEL_AFFINITY)] = NO;
 }
 
 namespace {
@@ -36,6 +38,7 @@ Engine::Configs mergeConfigs(Engine::Configs config, const Engine::Configs & loc
 }
 std::vector<std::string> supported_configKeys {
     HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+    HETERO_CONFIG_KEY(COST_MODEL_AFFINITY),
     "TARGET_FALLBACK",
     CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
 };
@@ -108,6 +111,8 @@ Engine::DeviceMetaInformationMap Engine::GetDevicePlugins(const std::string& tar
 void Engine::SetConfig(const Configs &configs) {
     for (auto && kvp : configs) {
         const auto& name = kvp.first;
+        if (name == HETERO_CONFIG_KEY(COST_MODEL_AFFINITY) && kvp.second != YES && kvp.second != NO)
+            IE_THROW() << "Unsupported " << name << " value: " << kvp.second;
         if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), name))
             _config[name] = kvp.second;
         else
@@ -151,6 +156,15 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork &network, const Configs
         }
     }
 
+    auto itCostModel = tconfig.find(HETERO_CONFIG_KEY(COST_MODEL_AFFINITY));
+    if (itCostModel != tconfig.end() && itCostModel->second == YES && fallbackDevices.size() > 1) {
+        std::vector<std::map<std::string, std::string>> supportedLayers;
+        for (auto&& deviceName : fallbackDevices) {
+            supportedLayers.push_back(queryResults[deviceName].supportedLayersMap);
+        }
+        SolveAffinities(function, supportedLayers, qr.supportedLayersMap);
+    }
+
     // set OK status
     qr.rc = StatusCode::OK;
 
@@ -207,6 +221,11 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return { dump };
+    } else if (name == HETERO_CONFIG_KEY(COST_MODEL_AFFINITY)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(COST_MODEL_AFFINITY));
+        IE_ASSERT(it != _config.end());
+        bool costModel = it->second == YES;
+        return { costModel };
     } else if (name == "TARGET_FALLBACK") {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
@@ -0,0 +1,41 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_stage_executor.hpp"
+#include <algorithm>
+#include <utility>
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+HeteroStageExecutor::HeteroStageExecutor(unsigned int maxInFlight) :
+    _maxInFlight{std::max(maxInFlight, 1u)} {
+}
+
+void HeteroStageExecutor::run(Task task) {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_inFlight >= _maxInFlight) {
+            _tasks.push_back(std::move(task));
+            return;
+        }
+        ++_inFlight;
+    }
+    task();
+}
+
+void HeteroStageExecutor::Release() {
+    Task task;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_tasks.empty()) {
+            --_inFlight;
+            return;
+        }
+        // the slot is passed to the next waiting task as is
+        task = std::move(_tasks.front());
+        _tasks.pop_front();
+    }
+    task();
+}
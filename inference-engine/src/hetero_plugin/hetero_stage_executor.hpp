@@ -0,0 +1,41 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <threading/ie_itask_executor.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Executor of one pipeline stage, i.e. subgraphs which are assigned to the same device.
+ * Tasks start subrequests asynchronously, so at most `maxInFlight` of them are allowed to run at the same time
+ * and the others wait in the queue. The slot is returned with `Release()` once the started subrequest is completed.
+ * The bound keeps the device at its optimal load while requests of the other stages go on in parallel,
+ * so the pipeline throughput is limited by the slowest stage rather than by the sum of all stages.
+ */
+class HeteroStageExecutor : public InferenceEngine::ITaskExecutor {
+public:
+    using Ptr = std::shared_ptr<HeteroStageExecutor>;
+
+    explicit HeteroStageExecutor(unsigned int maxInFlight);
+
+    void run(InferenceEngine::Task task) override;
+
+    /**
+     * @brief Should be called once a task passed to `run()` has finished its work on the device
+     */
+    void Release();
+
+private:
+    std::mutex                          _mutex;
+    std::deque<InferenceEngine::Task>   _tasks;
+    unsigned int                        _inFlight = 0;
+    unsigned int                        _maxInFlight = 1;
+};
+
+}  // namespace HeteroPlugin
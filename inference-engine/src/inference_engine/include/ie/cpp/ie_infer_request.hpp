@@ -148,6 +148,17 @@ public:
      */
     void SetBatch(const int batch);
 
+    /**
+     * @brief Sets the priority of the following inference calls of this request.
+     *
+     * The requests of higher priority are executed ahead of the queued requests of lower priority, e.g. the
+     * interactive requests may go ahead of the bulk ones sharing the same executable network. The requests of lower
+     * priority are still executed periodically, so they are not starved.
+     *
+     * @param priority The request priority, higher value is more urgent, `0` is the default one
+     */
+    void SetPriority(const int priority);
+
     /**
      * @brief Start inference of specified input(s) in asynchronous mode
      *
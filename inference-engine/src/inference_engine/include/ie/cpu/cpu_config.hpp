@@ -0,0 +1,216 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for advanced hardware related properties for CPU plugin
+ *        To use in SetConfig() and LoadNetwork() methods of plugins
+ *
+ * @file cpu_config.hpp
+ */
+#pragma once
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief CPU plugin configuration
+ */
+namespace CPUConfigParams {
+
+/**
+ * @brief shortcut for defining configuration keys
+ */
+#define CPU_CONFIG_KEY(name)           InferenceEngine::CPUConfigParams::_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_KEY(name)   DECLARE_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(CPU_##name)
+
+/**
+ * @brief This key defines the directory where CPU plugin stores repacked (reordered to blocked layouts) constant
+ * weights. The entries are content-addressed, so they are reused by any process which loads the same model on the same
+ * kind of machine and skips weights reordering on LoadNetwork.
+ * Empty string (default) disables the persistent weights cache.
+ */
+DECLARE_CPU_CONFIG_KEY(WEIGHTS_CACHE_DIR);
+
+/**
+ * @brief This key defines the file where CPU plugin stores the convolution implementations chosen by measurement.
+ * When several implementations of the selected layout are available (e.g. winograd and direct ones), each unique
+ * convolution problem is timed once on LoadNetwork and the fastest implementation is stored per CPU model, so the
+ * following loads of the same shapes take it without measurement. Takes effect only in the builds configured with
+ * ENABLE_CPU_CONV_TUNING, the static implementations priority is used otherwise.
+ * Empty string (default) disables the measurement.
+ */
+DECLARE_CPU_CONFIG_KEY(TUNING_CACHE_FILE);
+
+/**
+ * @brief This key defines whether constant weights are replicated per NUMA node on multi-socket machines, so the
+ * streams bound to a node read only the local copy. Reordered weights and constants are allocated and first touched
+ * by a stream of the node. PluginConfigParams::YES (default) or PluginConfigParams::NO; the latter keeps a single
+ * copy shared by all the streams, which saves memory at the cost of remote memory accesses.
+ */
+DECLARE_CPU_CONFIG_KEY(NUMA_WEIGHTS_REPLICATION);
+
+/**
+ * @brief This key defines the strategy which is used to place intermediate tensors into the common memory arena
+ * CPU_MEMORY_SOLVER_GREEDY (default) - biggest tensors first, each one is lifted above all intersected ones
+ * CPU_MEMORY_SOLVER_BEST_FIT - biggest tensors first, each one takes the smallest fitting gap between already placed
+ * tensors; offsets are aligned to cache line for small tensors and to page for big ones
+ */
+DECLARE_CPU_CONFIG_KEY(MEMORY_SOLVER);
+DECLARE_CPU_CONFIG_VALUE(MEMORY_SOLVER_GREEDY);
+DECLARE_CPU_CONFIG_VALUE(MEMORY_SOLVER_BEST_FIT);
+
+/**
+ * @brief This key defines the maximal number of compiled kernels and primitives which are kept by the executable network
+ * for nodes with dynamic shapes. The cache is shared by all streams, so repeated input shapes don't trigger
+ * recompilation. 0 disables the cache. The default value is 5000.
+ */
+DECLARE_CPU_CONFIG_KEY(RUNTIME_CACHE_CAPACITY);
+
+/**
+ * @brief This key defines how the graph optimizer decides whether to fuse a node into the preceding one as a post-op
+ * CPU_FUSION_COST_MODEL_NONE (default) - every supported fusion is applied
+ * CPU_FUSION_COST_MODEL_ANALYTIC - a fusion is applied only if the estimated saved memory traffic exceeds the estimated
+ * slowdown of the fused kernel; the decisions are reported by the "fusionDecisions" attribute of the execution graph
+ */
+DECLARE_CPU_CONFIG_KEY(FUSION_COST_MODEL);
+DECLARE_CPU_CONFIG_VALUE(FUSION_COST_MODEL_NONE);
+DECLARE_CPU_CONFIG_VALUE(FUSION_COST_MODEL_ANALYTIC);
+
+/**
+ * @brief This key enables the process-wide pool of CPU streams shared by all executable networks loaded with it
+ * PluginConfigParams::YES - infer requests of all such networks are run by the same pinned stream threads, so the
+ * total number of threads matches the number of cores regardless of how many networks are loaded. Requests are
+ * served in the order they are started. The number of streams of the network only limits the graphs it creates
+ * PluginConfigParams::NO (default) - the network gets its own streams executor
+ */
+DECLARE_CPU_CONFIG_KEY(SHARED_STREAMS);
+
+/**
+ * @brief This key defines the sampling interval N of the lightweight per node profiling: each stream times the nodes
+ * of one inference out of every N and accumulates the execution times into histograms available with the
+ * CPU_METRIC_KEY(NODE_EXEC_TIME_HISTOGRAMS) metric. Unlike PluginConfigParams::KEY_PERF_COUNT the other inferences
+ * are not timed, so it can stay enabled in production. Non negative integer value, 0 (default) disables sampling
+ */
+DECLARE_CPU_CONFIG_KEY(PERF_COUNT_SAMPLING);
+
+/**
+ * @brief LoadNetwork key which lists the static input shapes the network with dynamic inputs is compiled for.
+ * Buckets are separated by ';', each bucket lists the input shapes as "input1[1,128],input2[1,128]".
+ * The compiled variants share the constant weights. Each inference is routed to the smallest bucket fitting the
+ * input shapes: the inputs are padded with zeros up to the bucket shapes and the outputs are cropped to the shapes
+ * the network produces for the actual inputs, so the padding must not affect the valid part of the outputs
+ * (e.g. the padded sequence positions are masked). Empty string (default) disables the buckets
+ */
+DECLARE_CPU_CONFIG_KEY(SHAPE_BUCKETS);
+
+/**
+ * @brief This key enables concurrent execution of the independent branches of the graph inside one stream
+ * PluginConfigParams::YES - the nodes are grouped into waves by their depth in the graph and the nodes of one wave are
+ * executed concurrently by the threads of the stream, so the small nodes of the parallel branches (e.g. the detection
+ * heads) run on different cores. The memory reuse accounts for the waves, so the memory arena may grow
+ * PluginConfigParams::NO (default) - the nodes are executed one by one in the topological order
+ */
+DECLARE_CPU_CONFIG_KEY(BRANCH_PARALLELISM);
+
+/**
+ * @brief This key enables the fast approximations of the transcendental activations computed by the JIT kernels of
+ * the Eltwise nodes: Exp, Sigmoid, Tanh, Swish and Gelu. Exp uses a degree 3 polynomial (max relative error 7.5e-5),
+ * the reciprocals use the hardware approximation refined by one Newton-Raphson iteration. The max absolute errors are
+ * 1.9e-5 for Sigmoid, 3.7e-5 for Tanh, 1.7e-5 for Swish and 4.7e-4 for Gelu, which is computed with the tanh formula
+ * for both approximation modes. The activations fused into the oneDNN primitives are not affected
+ * PluginConfigParams::YES - the fast approximations are used
+ * PluginConfigParams::NO (default) - the accurate implementations are used
+ */
+DECLARE_CPU_CONFIG_KEY(FAST_MATH);
+
+/**
+ * @brief This key makes the network run on the threads of the application instead of the plugin streams
+ * PluginConfigParams::YES - the inference requests are executed by the executor set with
+ * InferenceEngine::ExecutorManager::setExternalExecutor() before LoadNetwork or, if there is none, by the threads
+ * starting them. At most CPU_THROUGHPUT_STREAMS requests run at once. With the TBB threading the parallel loops of
+ * the nodes run in the task arena of the executing thread, so no threads are created by the plugin. The thread
+ * binding keys are ignored
+ * PluginConfigParams::NO (default) - the plugin creates its own streams threads
+ */
+DECLARE_CPU_CONFIG_KEY(EXTERNAL_THREADING);
+
+/**
+ * @brief This key lists the nodes kept in FP32 when the network is executed in BF16 (see
+ * PluginConfigParams::KEY_ENFORCE_BF16). The entries are separated by ',' and match either the operation type
+ * (e.g. "Softmax,MVN") or the layer name, so the layers sensitive to the precision loss don't force disabling BF16
+ * for the whole network. Empty string (default) keeps only the nodes the plugin finds unsafe for BF16 in FP32:
+ * the producers of a FakeQuantize with a quantization step finer than the BF16 resolution of its range
+ */
+DECLARE_CPU_CONFIG_KEY(BF16_FP32_NODES);
+
+/**
+ * @brief This key sets the minimal fraction of zero weights in [0, 1] starting from which a FullyConnected layer
+ * with constant FP32 weights stores them compressed and is executed by the sparse kernel, so the unstructured
+ * sparsity left by the pruning yields the speedup. The post operations aren't fused into such layers
+ * 1 (default) - the sparse kernel is switched off
+ */
+DECLARE_CPU_CONFIG_KEY(SPARSE_WEIGHTS_RATE);
+
+/**
+ * @brief This key defines whether the constant weights and the intermediate tensors memory arenas are backed by the
+ * huge pages to reduce the TLB misses of the big networks. Only the allocations of at least 2 MB are affected
+ * CPU_HUGE_PAGES_NONE (default) - the regular pages are used
+ * CPU_HUGE_PAGES_TRANSPARENT - the memory is aligned to 2 MB and advised to be backed by the transparent huge pages
+ * CPU_HUGE_PAGES_EXPLICIT - the memory is mapped from the preallocated hugetlbfs pool: 1 GB pages for the allocations
+ * not smaller than 1 GB, 2 MB pages otherwise. If the pool is exhausted, the transparent huge pages are used
+ * The huge pages are supported on Linux only, the regular pages are used otherwise. The actual usage is reported by the
+ * CPU_METRIC_KEY(HUGE_PAGES_USAGE) metric of the plugin
+ */
+DECLARE_CPU_CONFIG_KEY(HUGE_PAGES);
+DECLARE_CPU_CONFIG_VALUE(HUGE_PAGES_NONE);
+DECLARE_CPU_CONFIG_VALUE(HUGE_PAGES_TRANSPARENT);
+DECLARE_CPU_CONFIG_VALUE(HUGE_PAGES_EXPLICIT);
+
+}  // namespace CPUConfigParams
+
+namespace Metrics {
+
+/**
+ * @def CPU_METRIC_KEY(name)
+ * @brief shortcut for defining CPU plugin metrics
+ */
+#define CPU_METRIC_KEY(name)              METRIC_KEY(CPU_##name)
+#define DECLARE_CPU_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(CPU_##name, __VA_ARGS__)
+
+/**
+ * @brief ExecutableNetwork metric to get the size in bytes of the intermediate tensors memory arena of one stream.
+ * The map contains:
+ *  - "arena_size" - the size of the arena chosen by the memory solver
+ *  - "lower_bound" - the maximal sum of sizes of the simultaneously alive tensors, no placement can go below it
+ */
+DECLARE_CPU_METRIC_KEY(MEMORY_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief ExecutableNetwork metric to get statistics of the runtime cache of compiled kernels and primitives.
+ * The map contains "hits", "misses" and "size" (current number of entries) values.
+ */
+DECLARE_CPU_METRIC_KEY(RUNTIME_CACHE_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief ExecutableNetwork metric to get execution time histograms of the nodes collected from the inferences sampled
+ * by all streams (see CPUConfigParams::KEY_CPU_PERF_COUNT_SAMPLING). The map is keyed by the node name, element 0 of
+ * the vector counts executions shorter than 1 microsecond, element i counts the ones in [2^(i-1), 2^i) microseconds
+ * and the last element counts all the longer ones.
+ */
+DECLARE_CPU_METRIC_KEY(NODE_EXEC_TIME_HISTOGRAMS, std::map<std::string, std::vector<uint64_t>>);
+
+/**
+ * @brief Plugin metric to get the size in bytes of the memory currently allocated by the process on the huge pages
+ * (see CPUConfigParams::KEY_CPU_HUGE_PAGES). The map contains:
+ *  - "explicit" - the memory mapped from the hugetlbfs pool
+ *  - "transparent" - the memory advised to be backed by the transparent huge pages
+ *  - "fallback" - the memory requested on the huge pages which got the regular pages, since the transparent huge
+ *    pages are disabled in the system
+ */
+DECLARE_CPU_METRIC_KEY(HUGE_PAGES_USAGE, std::map<std::string, uint64_t>);
+
+}  // namespace Metrics
+}  // namespace InferenceEngine
@@ -0,0 +1,141 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for the CPU plugin custom kernel interface working on the raw memory
+ *
+ * @file cpu_kernel_extension.hpp
+ */
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "ie_iextension.h"
+
+namespace InferenceEngine {
+
+/**
+ * @struct CPUKernelTensor
+ * @brief This structure describes an input or output memory of the custom CPU kernel
+ */
+struct CPUKernelTensor {
+    /**
+     * @brief Pointer to the first element of the tensor, the offset of the blocking descriptor is already applied
+     */
+    void* data = nullptr;
+    /**
+     * @brief Precision of the tensor elements
+     */
+    Precision precision;
+    /**
+     * @brief Logical dimensions of the tensor
+     */
+    SizeVector dims;
+    /**
+     * @brief Memory layout (blocked dims, order and strides in elements) selected for the tensor
+     */
+    BlockingDesc blockingDesc;
+};
+
+/**
+ * @interface ICPUExecutionContext
+ * @brief This class gives the custom CPU kernel access to the threads of the stream executing it
+ */
+class ICPUExecutionContext {
+public:
+    /**
+     * @brief Destructor
+     */
+    virtual ~ICPUExecutionContext() = default;
+
+    /**
+     * @brief Returns the number of threads available to the kernel
+     * @return Number of threads
+     */
+    virtual int getNumThreads() const = 0;
+
+    /**
+     * @brief Splits the work between the threads of the stream and waits for its completion
+     *
+     * @param workAmount Number of work items
+     * @param body Function processing the work items [begin, end), it is called concurrently
+     */
+    virtual void parallelFor(size_t workAmount, const std::function<void(size_t begin, size_t end)>& body) const = 0;
+};
+
+/**
+ * @interface ICPUKernelImpl
+ * @brief This class provides interface for the custom CPU kernel executed on the raw memory
+ *
+ * The supported layouts and precisions are declared with getSupportedConfigurations() and take part in the layout
+ * selection of the plugin as for ILayerExecImpl. The CPU plugin calls executeKernel() with the memory of the graph
+ * directly, so no blobs are created on inference.
+ */
+class ICPUKernelImpl : public ILayerExecImpl {
+public:
+    /**
+     * @brief A shared pointer to the ICPUKernelImpl interface
+     */
+    using Ptr = std::shared_ptr<ICPUKernelImpl>;
+
+    /**
+     * @brief Executes the kernel
+     *
+     * @param inputs Input tensors
+     * @param outputs Output tensors
+     * @param context Threads of the executing stream
+     * @param resp Response descriptor
+     * @return Status code
+     */
+    virtual StatusCode executeKernel(const std::vector<CPUKernelTensor>& inputs,
+                                     const std::vector<CPUKernelTensor>& outputs,
+                                     const ICPUExecutionContext& context,
+                                     ResponseDesc* resp) noexcept = 0;
+
+    /**
+     * @brief Executes the kernel with the blobs on the calling thread, it is used by the callers not aware of the
+     * executeKernel() method
+     */
+    StatusCode execute(std::vector<Blob::Ptr>& inputs,
+                       std::vector<Blob::Ptr>& outputs,
+                       ResponseDesc* resp) noexcept override {
+        std::vector<LockedMemory<void>> holders;
+        auto toTensors = [&holders](const std::vector<Blob::Ptr>& blobs, std::vector<CPUKernelTensor>& tensors) {
+            for (const auto& blob : blobs) {
+                auto memoryBlob = as<MemoryBlob>(blob);
+                if (!memoryBlob)
+                    return false;
+                holders.push_back(memoryBlob->rwmap());
+                const auto& desc = memoryBlob->getTensorDesc();
+                CPUKernelTensor tensor;
+                tensor.data = holders.back().as<uint8_t*>() + desc.getBlockingDesc().getOffsetPadding() *
+                                                                   desc.getPrecision().size();
+                tensor.precision = desc.getPrecision();
+                tensor.dims = desc.getDims();
+                tensor.blockingDesc = desc.getBlockingDesc();
+                tensors.push_back(tensor);
+            }
+            return true;
+        };
+
+        std::vector<CPUKernelTensor> inputTensors, outputTensors;
+        if (!toTensors(inputs, inputTensors) || !toTensors(outputs, outputTensors))
+            return PARAMETER_MISMATCH;
+
+        struct SerialContext : public ICPUExecutionContext {
+            int getNumThreads() const override {
+                return 1;
+            }
+            void parallelFor(size_t workAmount, const std::function<void(size_t, size_t)>& body) const override {
+                if (workAmount > 0)
+                    body(0, workAmount);
+            }
+        };
+        return executeKernel(inputTensors, outputTensors, SerialContext(), resp);
+    }
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header for properties
+ * of shared memory contexts and shared memory blobs
+ * for CPU plugin
+ *
+ * @file cpu_params.hpp
+ */
+#pragma once
+
+#include <string>
+
+namespace InferenceEngine {
+
+namespace CPUContextParams {
+/**
+ * @def CPU_PARAM_KEY(name)
+ * @brief Shortcut for defining configuration keys
+ */
+#define CPU_PARAM_KEY(name) ::InferenceEngine::CPUContextParams::PARAM_##name
+/**
+ * @def CPU_PARAM_VALUE(name)
+ * @brief Shortcut for defining configuration values
+ */
+#define CPU_PARAM_VALUE(name) ::InferenceEngine::CPUContextParams::name
+
+/**
+ * @def DECLARE_CPU_PARAM_VALUE(name)
+ * @brief Shortcut for defining possible values for object parameter keys
+ */
+#define DECLARE_CPU_PARAM_VALUE(name) static constexpr auto name = #name
+
+/**
+ * @def DECLARE_CPU_PARAM_KEY(name, ...)
+ * @brief Shortcut for defining object parameter keys
+ */
+#define DECLARE_CPU_PARAM_KEY(name, ...) static constexpr auto PARAM_##name = #name
+
+/**
+ * @brief Shared context type, only SHARED_MEMORY is supported
+ */
+DECLARE_CPU_PARAM_KEY(CONTEXT_TYPE, std::string);
+/**
+ * @brief Context which creates blobs in the memory shared between processes of the same host (Linux only)
+ */
+DECLARE_CPU_PARAM_VALUE(SHARED_MEMORY);
+
+/**
+ * @brief This key identifies type of internal shared memory
+ * in a shared memory blob parameter map.
+ */
+DECLARE_CPU_PARAM_KEY(SHARED_MEM_TYPE, std::string);
+/**
+ * @brief Blob in memory mapped from a memfd or POSIX shared memory object
+ */
+DECLARE_CPU_PARAM_VALUE(SHARED_MEMORY_FD);
+
+/**
+ * @brief This key identifies the file descriptor of the shared memory in a shared memory blob parameter map.
+ * The descriptor may be passed to another process (e.g. over a Unix domain socket with SCM_RIGHTS), which creates the
+ * blob on the same memory by passing the received descriptor with this key to RemoteContext::CreateBlob.
+ * The blob duplicates the passed descriptor, so the caller keeps the ownership of it.
+ */
+DECLARE_CPU_PARAM_KEY(SHARED_MEM_FD, int);
+
+/**
+ * @brief This key identifies the name of the POSIX shared memory object (see shm_open) in a shared memory blob
+ * parameter map. The object is created if it doesn't exist, and is removed when the blob which created it is
+ * destroyed, the processes which have it mapped keep the access. Without the name and the descriptor an anonymous
+ * memfd is created
+ */
+DECLARE_CPU_PARAM_KEY(SHARED_MEM_NAME, std::string);
+
+}  // namespace CPUContextParams
+}  // namespace InferenceEngine
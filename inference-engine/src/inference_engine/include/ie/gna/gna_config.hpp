@@ -136,6 +136,12 @@ namespace Metrics {
  * <API_REVISION>.<RELEASE_LINE>.<RELEASE>.<BUILD>
  */
 DECLARE_METRIC_KEY(GNA_LIBRARY_FULL_VERSION, std::string);
+
+/**
+ * @brief Metric to get a float share of the time, in percent, the GNA device had inference requests
+ * of any network of the process in flight since the first request
+ */
+DECLARE_METRIC_KEY(GNA_DEVICE_UTILIZATION, float);
 }  // namespace Metrics
 
 namespace PluginConfigParams {
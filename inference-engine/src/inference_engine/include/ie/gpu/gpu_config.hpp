@@ -51,6 +51,19 @@ DECLARE_GPU_METRIC_KEY(EXECUTION_UNITS_COUNT, int);
  */
 DECLARE_GPU_METRIC_KEY(MEMORY_STATISTICS, std::map<std::string, uint64_t>);
 
+/**
+ * @brief Metric to get device memory in bytes used by the executable network. It contains "weights" (constants),
+ * "intermediates" (buffers of the memory pool), "inputs_outputs", "kernels" (compiled kernel binaries) and "total" items.
+ * Buffers shared by several primitives or streams are counted once
+ */
+DECLARE_GPU_METRIC_KEY(MEMORY_FOOTPRINT, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the device buffer of each primitive output as a pair of the buffer record index and its size in bytes.
+ * Primitives with the same record index share one buffer
+ */
+DECLARE_GPU_METRIC_KEY(PRIMITIVES_MEMORY_RECORDS, std::map<std::string, std::pair<uint64_t, uint64_t>>);
+
 /**
  * @brief Possible return value for OPTIMIZATION_CAPABILITIES metric
  *  - "HW_MATMUL" - Defines if device has hardware block for matrix multiplication
@@ -76,6 +89,8 @@ namespace GPUConfigParams {
  * as defined in https://www.khronos.org/registry/OpenCL/specs/opencl-2.1-extensions.pdf
  * this option should be used with an unsigned integer value (1 is lowest priority)
  * 0 means no priority hint is set and default queue is created.
+ * The key may be passed to LoadNetwork, so the networks loaded to the same context
+ * run on the queues of different priorities (e.g. latency critical and background ones)
  */
 DECLARE_GPU_CONFIG_KEY(PLUGIN_PRIORITY);
 
@@ -84,6 +99,7 @@ DECLARE_GPU_CONFIG_KEY(PLUGIN_PRIORITY);
  * as defined in https://www.khronos.org/registry/OpenCL/specs/opencl-2.1-extensions.pdf,
  * chapter 9.19. This option should be used with an unsigned integer value (1 is lowest energy consumption)
  * 0 means no throttle hint is set and default queue created.
+ * As the priority, the key may be set per network in LoadNetwork config
  */
 DECLARE_GPU_CONFIG_KEY(PLUGIN_THROTTLE);
 
@@ -108,6 +124,35 @@ DECLARE_GPU_CONFIG_KEY(MAX_NUM_THREADS);
  * Thus, this key should be turned off if graph loading time is considered to be most important target to optimize.*/
 DECLARE_GPU_CONFIG_KEY(ENABLE_LOOP_UNROLLING);
 
+/**
+ * @brief This key limits the total size (in megabytes) of compiled kernels binaries stored in the KEY_CACHE_DIR
+ * directory. When the limit is exceeded, the least recently used binaries are removed. Default value is 0 which means
+ * that the size of the cache is not limited.
+ */
+DECLARE_GPU_CONFIG_KEY(KERNELS_CACHE_MAX_SIZE);
+
+/**
+ * @brief Turning on this key enables the pool of device buffers which is shared by all networks loaded to the same
+ * context. Buffers are grouped by size classes, so a buffer released by one network can be reused by another one even
+ * if their layouts are different. It reduces device memory fragmentation when many networks share the device.
+ * Turned off by default.
+ */
+DECLARE_GPU_CONFIG_KEY(SIZE_CLASS_MEMORY_POOL);
+
+/**
+ * @brief This key sets the number of in-order queues used by each stream. Independent branches of the network
+ * (e.g. towers of Inception blocks or heads of detection networks) are distributed between the queues,
+ * so small kernels of different branches can occupy the device concurrently. Default value is 1.
+ */
+DECLARE_GPU_CONFIG_KEY(BRANCH_QUEUES);
+
+/**
+ * @brief Turning on this key lets the networks loaded to the same context share the device buffers of the constants.
+ * Weights with the same content and layout, e.g. of the same model loaded with different batch sizes, are uploaded
+ * and reordered once. Turned on by default.
+ */
+DECLARE_GPU_CONFIG_KEY(SHARE_CONSTANTS);
+
 }  // namespace GPUConfigParams
 
 namespace PluginConfigParams {
@@ -34,5 +34,14 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of the cost model based affinities. Instead of assigning every layer to the first
+ * device from the TARGET_FALLBACK which supports it, the small islands of layers are moved to the neighbouring
+ * device when the saved copies and synchronizations on the subgraph boundaries outweigh the slower execution.
+ * Has no effect if the network has the affinities set by the user.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(COST_MODEL_AFFINITY);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
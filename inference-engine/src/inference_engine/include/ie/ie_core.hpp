@@ -9,6 +9,8 @@
  */
 #pragma once
 
+#include <functional>
+#include <future>
 #include <istream>
 #include <map>
 #include <memory>
@@ -23,6 +25,22 @@
 
 namespace InferenceEngine {
 
+/**
+ * @brief Stages of Core::LoadNetworkAsync reported to the progress callback
+ */
+enum class LoadNetworkStage {
+    READ_NETWORK,       //!< Reading the model file
+    IMPORT_FROM_CACHE,  //!< Importing the compiled network from the model cache
+    COMPILE,            //!< Transformations and compilation of the network by the plugin
+    EXPORT_TO_CACHE,    //!< Writing the compiled network to the model cache
+};
+
+/**
+ * @brief Progress callback of Core::LoadNetworkAsync, called on the loading thread when a stage starts.
+ * Returning false cancels the load: the future's get() throws InferenceEngine::InferCancelled
+ */
+using LoadNetworkCallback = std::function<bool(LoadNetworkStage)>;
+
 /**
  * @brief This class represents Inference Engine Core entity.
  *
@@ -127,6 +145,43 @@ public:
                                   const std::string& deviceName,
                                   const std::map<std::string, std::string>& config = {});
 
+    /**
+     * @brief Creates an executable network from a network object without blocking the caller
+     *
+     * Loading runs on a separate thread, so several networks can be loaded concurrently.
+     * Cancellation is cooperative: it is checked when the next stage starts, so a compilation in progress is finished.
+     * Note that like any future from std::async the returned one waits for the loading on destruction
+     *
+     * @param network CNNNetwork object acquired from Core::ReadNetwork, is copied
+     * @param deviceName Name of device to load network to
+     * @param config Optional map of pairs: (config parameter name, config parameter value) relevant only for this load
+     * operation
+     * @param callback Optional progress callback, see LoadNetworkCallback
+     * @return A future of the executable network, rethrows loading errors from get()
+     */
+    std::future<ExecutableNetwork> LoadNetworkAsync(const CNNNetwork& network,
+                                                    const std::string& deviceName,
+                                                    const std::map<std::string, std::string>& config = {},
+                                                    const LoadNetworkCallback& callback = {});
+
+    /**
+     * @brief Reads model and creates an executable network from IR or ONNX file without blocking the caller
+     *
+     * @see LoadNetworkAsync(const CNNNetwork&, const std::string&, const std::map<std::string, std::string>&, const
+     * LoadNetworkCallback&)
+     *
+     * @param modelPath path to model
+     * @param deviceName Name of device to load network to
+     * @param config Optional map of pairs: (config parameter name, config parameter value) relevant only for this load
+     * operation
+     * @param callback Optional progress callback, see LoadNetworkCallback
+     * @return A future of the executable network, rethrows loading errors from get()
+     */
+    std::future<ExecutableNetwork> LoadNetworkAsync(const std::string& modelPath,
+                                                    const std::string& deviceName,
+                                                    const std::map<std::string, std::string>& config = {},
+                                                    const LoadNetworkCallback& callback = {});
+
     /**
      * @brief Registers extension
      * @param extension Pointer to already loaded extension
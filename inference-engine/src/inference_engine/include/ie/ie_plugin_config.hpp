@@ -244,6 +244,17 @@ DECLARE_CONFIG_VALUE(THROUGHPUT);
  */
 DECLARE_CONFIG_KEY(PERFORMANCE_HINT_NUM_REQUESTS);
 
+/**
+ * @brief Auto-batching configuration, string for the device + batch size, e.g. "GPU(4)"
+ * The BATCH device collects this number of concurrent requests and runs them as one inference of the batched network
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG);
+/**
+ * @brief Auto-batching configuration: timeout in milliseconds since the first request of the not full batch came,
+ * after the timeout the collected requests are executed one by one with the network without batch. Default value: 1000
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_TIMEOUT);
+
 /**
  * @brief generic boolean values
  */
@@ -268,6 +279,8 @@ DECLARE_CONFIG_KEY(CPU_THREADS_NUM);
  *      on the Windows and MacOS* this option behaves as YES
  * PluginConfigParams::HYBRID_AWARE (let the runtime to do pinning to the cores types, e.g. prefer the "big" cores for
  * latency tasks) on the hybrid CPUs this option is default
+ * PluginConfigParams::CACHE_AWARE (pinning the threads of a stream to the cores sharing the last level cache, e.g. one
+ * CCX of AMD EPYC, so a stream doesn't span the caches), implemented on Linux only
  *
  * Also, the settings are ignored, if the OpenVINO compiled with OpenMP and any affinity-related OpenMP's
  * environment variable is set (as affinity is configured explicitly)
@@ -275,6 +288,7 @@ DECLARE_CONFIG_KEY(CPU_THREADS_NUM);
 DECLARE_CONFIG_KEY(CPU_BIND_THREAD);
 DECLARE_CONFIG_VALUE(NUMA);
 DECLARE_CONFIG_VALUE(HYBRID_AWARE);
+DECLARE_CONFIG_VALUE(CACHE_AWARE);
 
 /**
  * @brief Optimize CPU execution to maximize throughput.
@@ -420,6 +434,16 @@ DECLARE_CONFIG_KEY(CACHE_DIR);
  */
 DECLARE_AUTO_CONFIG_KEY(DEVICE_LIST);
 
+/**
+ * @brief The key to release the CPU network of the warm start once the accelerator serves the requests
+ *
+ * The requests are served by the CPU while the network is compiled for the accelerator. Once the accelerator
+ * network is ready, the requests go to the accelerator and only the ones finding no idle accelerator request
+ * are still served by the CPU, until the accelerator completes the first inference. With YES the CPU network
+ * is unloaded then (as soon as it has no requests in flight) to free the memory. Values: YES or NO (default)
+ */
+DECLARE_AUTO_CONFIG_KEY(RELEASE_CPU_NETWORK);
+
 }  // namespace InferenceEngine
 
 #include "hetero/hetero_plugin_config.hpp"
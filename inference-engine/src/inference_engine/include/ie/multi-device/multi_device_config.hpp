@@ -34,5 +34,46 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief Scheduling policy of inference requests between devices
+ * - MULTI_PRIORITY - (default) request is sent to the first device with an idle request in the order of DEVICE_PRIORITIES
+ * - MULTI_COMPLETION_TIME - request is sent to the device which is estimated to complete it first, based on the
+ *   measured device latency and the number of requests already running or waiting for the device
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(PRIORITY);
+DECLARE_MULTI_CONFIG_VALUE(COMPLETION_TIME);
+
+/**
+ * @brief Batch sizes of the device replicas of the network, comma-separated <device>:<batch> pairs, e.g. "GPU:4"
+ * - the replica of a listed device is compiled with the network batch multiplied by the given value, so the samples
+ *   of the batch must be independent (the network batch is the first dimension of all the inputs and outputs)
+ * - the user requests waiting for the device are coalesced into its batched requests, each user request takes
+ *   a slot of the batch. A batched request is started with the requests waiting at the moment, so a partially
+ *   filled batch is run when the load is low
+ * - the devices which are not listed run the network as is
+ */
+DECLARE_MULTI_CONFIG_KEY(DEVICE_BATCH);
+
 }  // namespace MultiDeviceConfigParams
+
+/**
+ * @brief Multi Device plugin metrics
+ */
+namespace Metrics {
+
+/**
+ * @def MULTI_METRIC_KEY(name)
+ * @brief shortcut for defining MULTI device plugin metrics
+ */
+#define MULTI_METRIC_KEY(name)              METRIC_KEY(MULTI_##name)
+#define DECLARE_MULTI_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(MULTI_##name, __VA_ARGS__)
+
+/**
+ * @brief Metric to get a live throughput (inferences per second) of each device used by the executable network,
+ * the value is a moving average so it follows the recent load
+ */
+DECLARE_MULTI_METRIC_KEY(DEVICE_THROUGHPUT, std::map<std::string, float>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
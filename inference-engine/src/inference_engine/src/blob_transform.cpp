@@ -9,13 +9,47 @@
 #    include "cpu_x86_sse42/blob_transform_sse42.hpp"
 #endif
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 
+#include "ie_parallel.hpp"
+
 //----------------------------------------------------------------------
 
 namespace InferenceEngine {
 
+// Planes are transposed by square tiles of this size, so the source and destination lines of a tile stay in L1 cache
+static constexpr size_t transpose_tile = 16;
+
+/**
+ * @brief Copies W x C plane of elements whose addresses are src_ptr + w * W_src_stride + c * C_src_stride
+ * to dst_ptr + w * W_dst_stride + c * C_dst_stride, tile by tile
+ */
+template <typename data_t>
+static void blob_copy_plane_t(const data_t* src_ptr,
+                              data_t* dst_ptr,
+                              size_t W,
+                              size_t C,
+                              size_t W_src_stride,
+                              size_t C_src_stride,
+                              size_t W_dst_stride,
+                              size_t C_dst_stride) {
+    for (size_t c0 = 0; c0 < C; c0 += transpose_tile) {
+        const size_t c1 = std::min(C, c0 + transpose_tile);
+        for (size_t w0 = 0; w0 < W; w0 += transpose_tile) {
+            const size_t w1 = std::min(W, w0 + transpose_tile);
+            for (size_t c = c0; c < c1; c++) {
+                const data_t* src_ptr_l = src_ptr + c * C_src_stride;
+                data_t* dst_ptr_l = dst_ptr + c * C_dst_stride;
+                for (size_t w = w0; w < w1; w++) {
+                    dst_ptr_l[w * W_dst_stride] = src_ptr_l[w * W_src_stride];
+                }
+            }
+        }
+    }
+}
+
 template <InferenceEngine::Precision::ePrecision PRC>
 static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
@@ -111,40 +145,20 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
             return;
         }
     }
-#else
-    (void)H_dst_stride;
 #endif  // HAVE_SSE
 
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (size_t h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (size_t w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
-                }
-            }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
-                for (size_t h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (size_t w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        dst_ptr_l += W_dst_stride;
-                        src_ptr_l_l++;
-                    }
-                }
-            }
-        }
+    if ((src_l == NHWC && dst_l == NCHW) || (src_l == NCHW && dst_l == NHWC)) {
+        // the rows are independent, so they are transposed in parallel
+        parallel_for2d(N, H, [&](size_t n, size_t h) {
+            blob_copy_plane_t(src_ptr + n * N_src_stride + h * H_src_stride,
+                              dst_ptr + n * N_dst_stride + h * H_dst_stride,
+                              W,
+                              C,
+                              W_src_stride,
+                              C_src_stride,
+                              W_dst_stride,
+                              C_dst_stride);
+        });
     } else {
         for (size_t i = 0; i < N * C * H * W; i++) {
             dst_ptr[i] = src_ptr[i];
@@ -284,43 +298,18 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
             return;
         }
     }
-#else
-    (void)H_dst_stride;
 #endif  // HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                for (size_t d = 0; d < D; d++) {
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    for (size_t h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (size_t w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            src_ptr_l_l += W_src_stride;
-                            dst_ptr_l++;
-                        }
-                    }
-                }
-            }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                for (size_t d = 0; d < D; d++) {
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride;
-                    for (size_t h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (size_t w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            dst_ptr_l += W_dst_stride;
-                            src_ptr_l_l++;
-                        }
-                    }
-                }
-            }
-        }
+    if ((src_l == NDHWC && dst_l == NCDHW) || (src_l == NCDHW && dst_l == NDHWC)) {
+        parallel_for3d(N, D, H, [&](size_t n, size_t d, size_t h) {
+            blob_copy_plane_t(src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride,
+                              dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride,
+                              W,
+                              C,
+                              W_src_stride,
+                              C_src_stride,
+                              W_dst_stride,
+                              C_dst_stride);
+        });
     } else {
         for (size_t i = 0; i < N * C * D * H * W; i++) {
             dst_ptr[i] = src_ptr[i];
@@ -396,16 +396,17 @@ void CNNNetworkNGraphImpl::reshape(const std::map<std::string, ngraph::PartialSh
 
     auto params = _ngraph_function->get_parameters();
 
-    bool parameter_replaced = false;
+    ngraph::ParameterVector replaced_params;
     for (size_t i = 0; i < params.size(); i++) {
         auto& param = params[i];
         if (inputShapes.find(param->get_friendly_name()) == inputShapes.end())
             continue;
         param->set_partial_shape(inputShapes.at(param->get_friendly_name()));
-        parameter_replaced = true;
+        replaced_params.push_back(param);
     }
-    if (parameter_replaced)
-        _ngraph_function->validate_nodes_and_infer_types();
+    // only the nodes depending on the replaced parameters are revalidated
+    if (!replaced_params.empty())
+        _ngraph_function->validate_nodes_and_infer_types(replaced_params);
 
     const auto& results = _ngraph_function->get_results();
     bool outputs_are_static = all_of(begin(results), end(results), [](const std::shared_ptr<ngraph::Node>& n) {
@@ -7,6 +7,10 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include <set>
+#include <unordered_map>
+#include <vector>
+
 #ifndef _WIN32
 #    include <unistd.h>
 #endif
@@ -15,10 +19,13 @@
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
+#include "ie_data_hash.hpp"
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
+#include "ngraph/op/util/framework_node.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/variant.hpp"
-#include "openvino/pass/serialize.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
@@ -39,30 +46,218 @@ static int32_t as_int32_t(T v) {
     return static_cast<int32_t>(v);
 }
 
-class OstreamHashWrapper final : public std::streambuf {
-    std::size_t m_res = 0;
+/**
+ * @brief Hashes the function structure: operation types, attributes, ports and connections. Data of
+ * constants is not hashed during the traversal, the buffers are collected and hashed in parallel
+ * afterwards, see hashConstants(). A buffer shared by several constants is hashed once.
+ */
+class FunctionHashVisitor final : public ngraph::AttributeVisitor {
+    std::size_t& m_seed;
+    std::vector<std::pair<const void*, size_t>>& m_buffers;
+    std::map<std::pair<const void*, size_t>, size_t>& m_bufferIds;
+
+    template <typename T>
+    void hashValue(const std::string& name, const T& value) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, value);
+    }
+
+    template <typename T>
+    void hashVector(const std::string& name, const std::vector<T>& values) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, values.size());
+        for (const auto& value : values)
+            m_seed = hash_combine(m_seed, value);
+    }
 
 public:
-    std::size_t getResult() const {
-        return m_res;
-    }
-    std::streamsize xsputn(const char* s, std::streamsize n) override {
-        const std::int64_t* intS = (const std::int64_t*)s;
-        std::streamsize n64 = n / sizeof(std::int64_t);
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
+    FunctionHashVisitor(std::size_t& seed,
+                        std::vector<std::pair<const void*, size_t>>& buffers,
+                        std::map<std::pair<const void*, size_t>, size_t>& bufferIds)
+        : m_seed(seed),
+          m_buffers(buffers),
+          m_bufferIds(bufferIds) {}
+
+    void hashBuffer(const void* data, size_t size) {
+        const auto key = std::make_pair(data, size);
+        auto it = m_bufferIds.find(key);
+        if (it == m_bufferIds.end()) {
+            it = m_bufferIds.emplace(key, m_buffers.size()).first;
+            m_buffers.push_back(key);
+        }
+        // the data is hashed later, the index of the buffer identifies it in the structure
+        m_seed = hash_combine(m_seed, it->second);
+    }
+
+    void hashFunction(const ngraph::Function& function) {
+        const auto ops = function.get_ordered_ops();
+        std::unordered_map<const ngraph::Node*, size_t> opIds;
+        opIds.reserve(ops.size());
+        for (const auto& op : ops)
+            opIds.emplace(op.get(), opIds.size());
+
+        m_seed = hash_combine(m_seed, function.get_friendly_name());
+        for (const auto& op : ops) {
+            const auto& typeInfo = op->get_type_info();
+            m_seed = hash_combine(m_seed, std::string(typeInfo.name));
+            m_seed = hash_combine(m_seed, typeInfo.version);
+            if (typeInfo.version_id)
+                m_seed = hash_combine(m_seed, std::string(typeInfo.version_id));
+            m_seed = hash_combine(m_seed, op->get_friendly_name());
+
+            for (const auto& input : op->input_values()) {
+                m_seed = hash_combine(m_seed, opIds.at(input.get_node()));
+                m_seed = hash_combine(m_seed, input.get_index());
+            }
+            for (const auto& output : op->outputs()) {
+                m_seed = hash_combine(m_seed, output.get_element_type().get_type_name());
+                const auto& shape = output.get_partial_shape();
+                m_seed = hash_combine(m_seed, shape.rank().is_static());
+                if (shape.rank().is_static()) {
+                    m_seed = hash_combine(m_seed, shape.size());
+                    for (const auto& dim : shape) {
+                        m_seed = hash_combine(m_seed, dim.get_min_length());
+                        m_seed = hash_combine(m_seed, dim.get_max_length());
+                    }
+                }
+                // the names are sorted to not depend on the order of the hash set
+                const auto& tensorNames = output.get_tensor().get_names();
+                const std::set<std::string> names(tensorNames.begin(), tensorNames.end());
+                m_seed = hash_combine(m_seed, names.size());
+                for (const auto& name : names)
+                    m_seed = hash_combine(m_seed, name);
+            }
+
+            // Constant::visit_attributes scans the data, so the attributes are taken directly
+            if (const auto constant = ngraph::as_type<ngraph::opset6::Constant>(op.get())) {
+                m_seed = hash_combine(m_seed, constant->get_element_type().get_type_name());
+                m_seed = hash_combine(m_seed, constant->get_shape().size());
+                for (const auto dim : constant->get_shape())
+                    m_seed = hash_combine(m_seed, dim);
+                hashBuffer(constant->get_data_ptr(), constant->get_byte_size());
+            } else {
+                op->visit_attributes(*this);
+            }
         }
 
-        std::streamsize rest = n % sizeof(std::int64_t);
-        for (i = 0; i < rest; i++) {
-            m_res += s[n - rest + i];
+        // the order of parameters and results is not defined by the topology
+        for (const auto& parameter : function.get_parameters())
+            m_seed = hash_combine(m_seed, opIds.at(parameter.get()));
+        for (const auto& result : function.get_results())
+            m_seed = hash_combine(m_seed, opIds.at(result.get()));
+        for (const auto& sink : function.get_sinks())
+            m_seed = hash_combine(m_seed, opIds.at(sink.get()));
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        m_seed = hash_combine(m_seed, name);
+        using InputDescriptions = std::vector<std::shared_ptr<ngraph::op::util::MultiSubGraphOp::InputDescription>>;
+        using OutputDescriptions = std::vector<std::shared_ptr<ngraph::op::util::MultiSubGraphOp::OutputDescription>>;
+        if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<InputDescriptions>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                m_seed = hash_combine(m_seed, std::string(desc->get_type_info().name));
+                m_seed = hash_combine(m_seed, desc->m_input_index);
+                m_seed = hash_combine(m_seed, desc->m_body_parameter_index);
+                if (const auto slice =
+                        ngraph::as_type_ptr<ngraph::op::util::MultiSubGraphOp::SliceInputDescription>(desc)) {
+                    for (const auto value :
+                         {slice->m_start, slice->m_stride, slice->m_part_size, slice->m_end, slice->m_axis})
+                        m_seed = hash_combine(m_seed, value);
+                } else if (const auto merged =
+                               ngraph::as_type_ptr<ngraph::op::util::MultiSubGraphOp::MergedInputDescription>(desc)) {
+                    m_seed = hash_combine(m_seed, merged->m_body_value_index);
+                }
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<OutputDescriptions>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                m_seed = hash_combine(m_seed, std::string(desc->get_type_info().name));
+                m_seed = hash_combine(m_seed, desc->m_body_value_index);
+                m_seed = hash_combine(m_seed, desc->m_output_index);
+                if (const auto concat =
+                        ngraph::as_type_ptr<ngraph::op::util::MultiSubGraphOp::ConcatOutputDescription>(desc)) {
+                    for (const auto value :
+                         {concat->m_start, concat->m_stride, concat->m_part_size, concat->m_end, concat->m_axis})
+                        m_seed = hash_combine(m_seed, value);
+                } else if (const auto body =
+                               ngraph::as_type_ptr<ngraph::op::util::MultiSubGraphOp::BodyOutputDescription>(desc)) {
+                    m_seed = hash_combine(m_seed, body->m_iteration);
+                }
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(
+                       &adapter)) {
+            m_seed = hash_combine(m_seed, a->get().current_iteration_input_idx);
+            m_seed = hash_combine(m_seed, a->get().body_condition_output_idx);
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(
+                       &adapter)) {
+            m_seed = hash_combine(m_seed, a->get()->get_info().variable_id);
+        } else if (const auto& a =
+                       ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+                           &adapter)) {
+            hashBuffer(a->get()->get_ptr(), a->get()->size());
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(
+                       &adapter)) {
+            const auto& attrs = a->get();
+            m_seed = hash_combine(m_seed, attrs.get_type_name());
+            m_seed = hash_combine(m_seed, attrs.get_opset_name());
+            for (const auto& attr : attrs) {
+                m_seed = hash_combine(m_seed, attr.first);
+                m_seed = hash_combine(m_seed, attr.second);
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::element::TypeVector>>(&adapter)) {
+            for (const auto& type : a->get())
+                m_seed = hash_combine(m_seed, type.get_type_name());
+        } else {
+            IE_THROW() << "Unsupported attribute type for hashing: " << name;
         }
-        return n;
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        m_seed = hash_combine(m_seed, name);
+        hashFunction(*adapter.get());
     }
 };
 
+/**
+ * @brief Hashes data of the collected buffers in parallel, the result does not depend on the number of threads
+ */
+static std::size_t hashConstants(std::size_t seed, const std::vector<std::pair<const void*, size_t>>& buffers) {
+    std::vector<uint64_t> hashes(buffers.size());
+    parallel_for(buffers.size(), [&](size_t i) {
+        hashes[i] = computeDataHash(buffers[i].first, buffers[i].second);
+    });
+    for (const auto hash : hashes)
+        seed = hash_combine(seed, hash);
+    return seed;
+}
+
 //////////////////////////////////////////////////
 
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
@@ -88,22 +283,17 @@ std::string NetworkCompilationContext::calculateFileInfo(const std::string& file
 std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
                                                    const std::map<std::string, std::string>& compileOptions) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_LT, "NetworkCompilationContext::computeHash - CNN");
-    OstreamHashWrapper xmlHash;
-    OstreamHashWrapper binHash;
-    std::ostream xml(&xmlHash);
-    std::ostream bin(&binHash);
-
     IE_ASSERT(network.getFunction());
 
-    // 1. Serialize
-    CNNNetwork net(network);
-    ov::pass::Serialize serializer(xml, bin);
-    serializer.run_on_function(net.getFunction());
-
-    // 2. Compute hash on serialized data and options
+    // 1. Hash the function structure, the data of constants is only referenced
     size_t seed = 0;
-    seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
+    std::vector<std::pair<const void*, size_t>> buffers;
+    std::map<std::pair<const void*, size_t>, size_t> bufferIds;
+    FunctionHashVisitor visitor(seed, buffers, bufferIds);
+    visitor.hashFunction(*network.getFunction());
+
+    // 2. Compute hash on constants data and options
+    seed = hashConstants(seed, buffers);
 
     for (const auto& kvp : compileOptions) {
         seed = hash_combine(seed, kvp.first + kvp.second);
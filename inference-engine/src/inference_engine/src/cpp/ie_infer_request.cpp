@@ -93,6 +93,10 @@ void InferRequest::SetBatch(const int batch) {
     INFER_REQ_CALL_STATEMENT(_impl->SetBatch(batch);)
 }
 
+void InferRequest::SetPriority(const int priority) {
+    INFER_REQ_CALL_STATEMENT(_impl->SetPriority(priority);)
+}
+
 void InferRequest::StartAsync() {
     INFER_REQ_CALL_STATEMENT(_impl->StartAsync();)
 }
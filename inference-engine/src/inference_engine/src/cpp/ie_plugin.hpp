@@ -207,6 +207,12 @@ struct InferencePlugin {
         OV_PLUGIN_CALL_STATEMENT(return {_so, _ptr->ImportNetwork(networkModel, context, config)});
     }
 
+    SoPtr<ie::IExecutableNetworkInternal> import_model(std::istream& networkModel,
+                                                       const std::shared_ptr<ov::util::MappedMemory>& networkMemory,
+                                                       const ConfigMap& config) {
+        OV_PLUGIN_CALL_STATEMENT(return {_so, _ptr->ImportNetwork(networkModel, networkMemory, config)});
+    }
+
     ie::Parameter get_metric(const std::string& name, const ie::ParamMap& options) const {
         OV_PLUGIN_CALL_STATEMENT(return _ptr->GetMetric(name, options));
     }
@@ -174,6 +174,14 @@ void IInferRequestInternal::SetBatch(int batch) {
     IE_THROW(NotImplemented);
 }
 
+void IInferRequestInternal::SetPriority(int priority) {
+    _priority = priority;
+}
+
+int IInferRequestInternal::GetPriority() const {
+    return _priority;
+}
+
 std::vector<std::shared_ptr<IVariableStateInternal>> IInferRequestInternal::QueryState() {
     IE_THROW(NotImplemented);
 }
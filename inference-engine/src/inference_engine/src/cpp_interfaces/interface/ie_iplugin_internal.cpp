@@ -245,6 +245,13 @@ std::shared_ptr<IExecutableNetworkInternal> IInferencePlugin::ImportNetwork(
     IE_THROW(NotImplemented);
 }
 
+std::shared_ptr<IExecutableNetworkInternal> IInferencePlugin::ImportNetwork(
+    std::istream& networkModel,
+    const std::shared_ptr<ov::util::MappedMemory>&,
+    const std::map<std::string, std::string>& config) {
+    return ImportNetwork(networkModel, config);
+}
+
 void IInferencePlugin::SetCore(std::weak_ptr<ICore> core) {
     IE_ASSERT(!core.expired());
     _core = core;
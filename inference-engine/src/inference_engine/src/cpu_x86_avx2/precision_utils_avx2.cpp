@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "precision_utils_avx2.hpp"
+
+#include <immintrin.h>
+
+#include "precision_utils.h"
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+void f16tof32Arrays_avx2(float* dst, const int16_t* src, size_t nelem) {
+    size_t i = 0;
+    // the conversion to F32 is exact, so the instruction gives the same result as the scalar code
+    for (; i + 8 <= nelem; i += 8) {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = f16tof32(src[i]);
+    }
+}
+
+void f32tof16Arrays_avx2(int16_t* dst, const float* src, size_t nelem) {
+    // vcvtps2ph keeps the denormals and produces infinities, so the scalar algorithm is vectorized instead
+    const __m256i absMask = _mm256_set1_epi32(0x7FFFFFFF);
+    const __m256i lowMask = _mm256_set1_epi32(0xFFFF);
+    const __m256i expMaskF32 = _mm256_set1_epi32(0x7F800000);
+    const __m256i mantMaskF32 = _mm256_set1_epi32(0x007FFFFF);
+    const __m256i signMaskF16 = _mm256_set1_epi32(0x8000);
+    const __m256i infF16 = _mm256_set1_epi32(0x7C00);
+    const __m256i nanBitF16 = _mm256_set1_epi32(0x0200);
+    const __m256i minF16 = _mm256_set1_epi32(1 << 10);
+    const __m256i maxF16 = _mm256_set1_epi32(((15 + 15) << 10) | 0x3FF);
+    const __m256i expBiasDiff = _mm256_set1_epi32((127 - 15) << 23);
+    const __m256 halfULPScale = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 11) << 23));
+    const __m256 min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 14) << 23));
+    const __m256 halfMin16 = _mm256_mul_ps(min16, _mm256_set1_ps(0.5f));
+    const __m256 max16 = _mm256_castsi256_ps(_mm256_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m256i u = _mm256_castps_si256(_mm256_loadu_ps(src + i));
+        __m256i s = _mm256_and_si256(_mm256_srli_epi32(u, 16), signMaskF16);
+        u = _mm256_and_si256(u, absMask);
+
+        // NAN and INF
+        __m256i isNanInf = _mm256_cmpeq_epi32(_mm256_and_si256(u, expMaskF32), expMaskF32);
+        __m256i isZeroMantissa = _mm256_cmpeq_epi32(_mm256_and_si256(u, mantMaskF32), _mm256_setzero_si256());
+        __m256i isNan = _mm256_andnot_si256(isZeroMantissa, isNanInf);
+        __m256i nanInf = _mm256_blendv_epi8(infF16, _mm256_or_si256(_mm256_srli_epi32(u, 23 - 10), nanBitF16), isNan);
+
+        // round to nearest by adding half of F16 ULP
+        __m256 halfULP = _mm256_mul_ps(_mm256_castsi256_ps(_mm256_and_si256(u, expMaskF32)), halfULPScale);
+        __m256 f = _mm256_add_ps(_mm256_castsi256_ps(u), halfULP);
+
+        __m256i r = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_castps_si256(f), expBiasDiff), 23 - 10);
+        r = _mm256_blendv_epi8(r, maxF16, _mm256_castps_si256(_mm256_cmp_ps(f, max16, _CMP_GE_OQ)));
+        r = _mm256_blendv_epi8(r, minF16, _mm256_castps_si256(_mm256_cmp_ps(f, min16, _CMP_LT_OQ)));
+        r = _mm256_blendv_epi8(r, _mm256_setzero_si256(), _mm256_castps_si256(_mm256_cmp_ps(f, halfMin16, _CMP_LT_OQ)));
+        r = _mm256_blendv_epi8(r, nanInf, isNanInf);
+        // NAN payload is wider than 16 bits, so it's truncated as the scalar code does on return
+        r = _mm256_and_si256(_mm256_or_si256(r, s), lowMask);
+
+        // the values fit 16 bits, so the saturation doesn't change them; packing interleaves the 128-bit lanes
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(r, r), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_castsi256_si128(packed));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = f32tof16(src[i]);
+    }
+}
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+//------------------------------------------------------------------------
+//
+// FP16 conversions manually vectored for AVX2 and F16C (w/o OpenMP threads)
+//
+//------------------------------------------------------------------------
+
+void f16tof32Arrays_avx2(float* dst, const int16_t* src, size_t nelem);
+
+// Rounds in the same way as the scalar f32tof16: the denormals are flushed to 0
+// and the finite values greater than the largest FP16 one are saturated
+void f32tof16Arrays_avx2(int16_t* dst, const float* src, size_t nelem);
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -11,11 +11,13 @@ namespace InferenceEngine {
 CacheGuardEntry::CacheGuardEntry(CacheGuard& cacheGuard,
                                  const std::string& hash,
                                  std::shared_ptr<std::mutex> m,
-                                 std::atomic_int& refCount)
+                                 std::atomic_int& refCount,
+                                 std::shared_ptr<void>& result)
     : m_cacheGuard(cacheGuard),
       m_hash(hash),
       m_mutex(m),
-      m_refCount(refCount) {
+      m_refCount(refCount),
+      m_result(result) {
     // Don't lock mutex right here for exception-safe considerations
     m_refCount++;
 }
@@ -30,6 +32,14 @@ void CacheGuardEntry::performLock() {
     m_mutex->lock();
 }
 
+void CacheGuardEntry::setResult(std::shared_ptr<void> result) {
+    m_result = std::move(result);
+}
+
+std::shared_ptr<void> CacheGuardEntry::getResult() const {
+    return m_result;
+}
+
 //////////////////////////////////////////////////////
 
 CacheGuard::~CacheGuard() {
@@ -42,8 +52,8 @@ std::unique_ptr<CacheGuardEntry> CacheGuard::getHashLock(const std::string& hash
     std::unique_ptr<CacheGuardEntry> res;
     try {
         // TODO: use std::make_unique when migrated to C++14
-        res =
-            std::unique_ptr<CacheGuardEntry>(new CacheGuardEntry(*this, hash, data.m_mutexPtr, data.m_itemRefCounter));
+        res = std::unique_ptr<CacheGuardEntry>(
+            new CacheGuardEntry(*this, hash, data.m_mutexPtr, data.m_itemRefCounter, data.m_result));
     } catch (...) {
         // In case of exception, we shall remove hash entry if it is not used
         if (data.m_itemRefCounter == 0) {
@@ -35,11 +35,13 @@ public:
      * @param hash String representing hash of network
      * @param m Shared pointer to mutex for internal locking
      * @param refCount Reference counter. Will be decremented on CacheGuardEntry destruction
+     * @param result Result shared with the clients waiting for the same hash
      */
     CacheGuardEntry(CacheGuard& cacheGuard,
                     const std::string& hash,
                     std::shared_ptr<std::mutex> m,
-                    std::atomic_int& refCount);
+                    std::atomic_int& refCount,
+                    std::shared_ptr<void>& result);
     CacheGuardEntry(const CacheGuardEntry&) = delete;
     CacheGuardEntry& operator=(const CacheGuardEntry&) = delete;
 
@@ -60,11 +62,27 @@ public:
      */
     void performLock();
 
+    /**
+     * @brief Shares the result of the work with the clients which are waiting for the same hash
+     * The result is kept while there are clients holding or waiting for the lock, so only concurrent requests reuse it
+     *
+     * @param result Type-erased result, e.g. loaded network
+     */
+    void setResult(std::shared_ptr<void> result);
+
+    /**
+     * @brief Gets the result set by the previous holder of the lock
+     *
+     * @return The result or nullptr if the previous holder didn't set it or there was no concurrent holder
+     */
+    std::shared_ptr<void> getResult() const;
+
 private:
     CacheGuard& m_cacheGuard;
     std::string m_hash;
     std::shared_ptr<std::mutex> m_mutex;
     std::atomic_int& m_refCount;
+    std::shared_ptr<void>& m_result;
 };
 
 /**
@@ -111,11 +129,19 @@ private:
         std::shared_ptr<std::mutex> m_mutexPtr{std::make_shared<std::mutex>()};
         // Reference counter for item usage
         std::atomic_int m_itemRefCounter{0};
+        // Result shared between concurrent holders, guarded by m_mutexPtr
+        std::shared_ptr<void> m_result;
 
         Item() = default;
-        Item(const Item& other) : m_mutexPtr(other.m_mutexPtr), m_itemRefCounter(other.m_itemRefCounter.load()) {}
+        Item(const Item& other)
+            : m_mutexPtr(other.m_mutexPtr),
+              m_itemRefCounter(other.m_itemRefCounter.load()),
+              m_result(other.m_result) {}
         Item& operator=(const Item& other) = delete;
-        Item(Item&& other) : m_mutexPtr(std::move(other.m_mutexPtr)), m_itemRefCounter(other.m_itemRefCounter.load()) {}
+        Item(Item&& other)
+            : m_mutexPtr(std::move(other.m_mutexPtr)),
+              m_itemRefCounter(other.m_itemRefCounter.load()),
+              m_result(std::move(other.m_result)) {}
         Item& operator=(Item&& other) = delete;
     };
     std::mutex m_tableMutex;
@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_cache_manager.hpp"
+
+#include <cstdio>
+#include <string>
+
+#include "ie_common.h"
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace InferenceEngine {
+
+namespace {
+
+#ifdef _WIN32
+
+class FileLock {
+    HANDLE m_handle;
+
+public:
+    explicit FileLock(const std::string& path) {
+        // exclusive share mode works as the lock, file is removed when the last handle is closed
+        while ((m_handle = CreateFileA(path.c_str(),
+                                       GENERIC_READ | GENERIC_WRITE,
+                                       0,
+                                       nullptr,
+                                       OPEN_ALWAYS,
+                                       FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE,
+                                       nullptr)) == INVALID_HANDLE_VALUE) {
+            const auto error = GetLastError();
+            if (error != ERROR_SHARING_VIOLATION && error != ERROR_ACCESS_DENIED) {
+                IE_THROW() << "Cannot create cache lock file " << path << ", error " << error;
+            }
+            Sleep(10);
+        }
+    }
+
+    ~FileLock() {
+        CloseHandle(m_handle);
+    }
+};
+
+#else
+
+class FileLock {
+    std::string m_path;
+    int m_fd = -1;
+
+public:
+    explicit FileLock(const std::string& path) : m_path(path) {
+        while (true) {
+            m_fd = open(m_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+            if (m_fd == -1) {
+                IE_THROW() << "Cannot create cache lock file " << m_path;
+            }
+            if (flock(m_fd, LOCK_EX) == 0) {
+                // the previous owner may have removed the file while we were waiting on it, lock the new one then
+                struct stat fdStat = {}, pathStat = {};
+                if (fstat(m_fd, &fdStat) == 0 && stat(m_path.c_str(), &pathStat) == 0 &&
+                    fdStat.st_ino == pathStat.st_ino && fdStat.st_dev == pathStat.st_dev) {
+                    return;
+                }
+            }
+            close(m_fd);
+        }
+    }
+
+    ~FileLock() {
+        unlink(m_path.c_str());
+        close(m_fd);
+    }
+};
+
+#endif
+
+}  // namespace
+
+void FileStorageCacheManager::writeCacheEntry(const std::string& id, StreamWriter writer) {
+    const auto blobFileName = getBlobFile(id);
+    const auto tmpFileName = blobFileName + ".tmp";
+    {
+        std::ofstream stream(tmpFileName, std::ios_base::binary | std::ofstream::out);
+        try {
+            writer(stream);
+        } catch (...) {
+            stream.close();
+            std::remove(tmpFileName.c_str());
+            throw;
+        }
+    }
+    // rename does not replace existing files on Windows
+    std::remove(blobFileName.c_str());
+    if (std::rename(tmpFileName.c_str(), blobFileName.c_str()) != 0) {
+        std::remove(tmpFileName.c_str());
+    }
+}
+
+std::shared_ptr<void> FileStorageCacheManager::lockCacheEntry(const std::string& id) {
+    return std::make_shared<FileLock>(getBlobFile(id) + ".lock");
+}
+
+}  // namespace InferenceEngine
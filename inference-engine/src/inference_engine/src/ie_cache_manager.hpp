@@ -16,6 +16,7 @@
 
 #include "file_utils.h"
 #include "ie_api.h"
+#include "openvino/util/mmap_object.hpp"
 
 namespace InferenceEngine {
 
@@ -62,6 +63,25 @@ public:
      */
     virtual void readCacheEntry(const std::string& id, StreamReader reader) = 0;
 
+    /**
+     * @brief Function passing the cache entry mapped into memory
+     *
+     */
+    using MemoryReader = std::function<void(const std::shared_ptr<ov::util::MappedMemory>&)>;
+    /**
+     * @brief Callback when Inference Engine intends to read network from cache without copying it
+     *
+     * Client needs to map the cache entry into memory and call reader(memory)
+     * Otherwise, network will be read from cache with readCacheEntry
+     *
+     * @param id Id of cache (hash of the network)
+     * @param reader Lambda function to be called when the memory is mapped
+     * @return false if the cache entry cannot be mapped, so readCacheEntry is to be used
+     */
+    virtual bool readCacheEntryMapped(const std::string& id, MemoryReader reader) {
+        return false;
+    }
+
     /**
      * @brief Callback when Inference Engine intends to remove cache entry
      *
@@ -70,6 +90,19 @@ public:
      * @param id Id of cache (hash of the network)
      */
     virtual void removeCacheEntry(const std::string& id) = 0;
+
+    /**
+     * @brief Callback when Inference Engine intends to get an exclusive access to a cache entry
+     *
+     * Client may block until other processes sharing the same cache release the entry,
+     * so only one of them compiles the network while the others wait and read it from cache
+     *
+     * @param id Id of cache (hash of the network)
+     * @return RAII handle releasing the entry on destruction, nullptr if the cache is not shared between processes
+     */
+    virtual std::shared_ptr<void> lockCacheEntry(const std::string& id) {
+        return nullptr;
+    }
 };
 
 /**
@@ -99,10 +132,11 @@ public:
     ~FileStorageCacheManager() override = default;
 
 private:
-    void writeCacheEntry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
-    }
+    /**
+     * @brief Writes the blob to a temporary file renamed to the cache entry once it is complete,
+     * so readers never see a partially written entry
+     */
+    void writeCacheEntry(const std::string& id, StreamWriter writer) override;
 
     void readCacheEntry(const std::string& id, StreamReader reader) override {
         auto blobFileName = getBlobFile(id);
@@ -112,11 +146,31 @@ private:
         }
     }
 
+    bool readCacheEntryMapped(const std::string& id, MemoryReader reader) override {
+        auto blobFileName = getBlobFile(id);
+        if (FileUtils::fileExist(blobFileName)) {
+            std::shared_ptr<ov::util::MappedMemory> mapped;
+            try {
+                mapped = ov::util::load_mmap_object(blobFileName);
+            } catch (const std::runtime_error&) {
+                return false;
+            }
+            reader(mapped);
+        }
+        return true;
+    }
+
     void removeCacheEntry(const std::string& id) override {
         auto blobFileName = getBlobFile(id);
         if (FileUtils::fileExist(blobFileName))
             std::remove(blobFileName.c_str());
     }
+
+    /**
+     * @brief Locks "<id>.blob.lock" file next to the entry, so the processes sharing the cache directory
+     * are serialized per entry. The lock file is removed on release.
+     */
+    std::shared_ptr<void> lockCacheEntry(const std::string& id) override;
 };
 
 }  // namespace InferenceEngine
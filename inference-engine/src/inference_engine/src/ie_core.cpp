@@ -23,6 +23,7 @@
 #include "ie_cache_manager.hpp"
 #include "ie_icore.hpp"
 #include "ie_itt.hpp"
+#include "ie_mapped_memory.hpp"
 #include "ie_network_reader.hpp"
 #include "ie_ngraph_utils.hpp"
 #include "ie_plugin_config.hpp"
@@ -74,6 +75,9 @@ Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::ma
     } else if (deviceName_.find("MULTI:") == 0) {
         deviceName_ = "MULTI";
         config_[ie::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = deviceName.substr(6);
+    } else if (deviceName_.find("BATCH:") == 0) {
+        deviceName_ = "BATCH";
+        config_[CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG)] = deviceName.substr(6);
     } else if (deviceName.find("AUTO") == 0) {
         deviceName_ = "AUTO";
         if (deviceName.find("AUTO:") == 0) {
@@ -131,6 +135,25 @@ void allowNotImplemented(F&& f) {
     }
 }
 
+// Progress callback of the Core::LoadNetworkAsync running on this thread, nullptr for blocking loads
+thread_local const ie::LoadNetworkCallback* loadNetworkCallback = nullptr;
+
+// Sets the callback for the loading thread, the thread may be reused by std::async implementation for other tasks
+struct LoadNetworkCallbackScope {
+    explicit LoadNetworkCallbackScope(const ie::LoadNetworkCallback& callback) {
+        loadNetworkCallback = &callback;
+    }
+    ~LoadNetworkCallbackScope() {
+        loadNetworkCallback = nullptr;
+    }
+};
+
+void notifyLoadNetworkStage(ie::LoadNetworkStage stage) {
+    if (loadNetworkCallback && *loadNetworkCallback && !(*loadNetworkCallback)(stage)) {
+        IE_THROW(InferCancelled) << "LoadNetwork is cancelled";
+    }
+}
+
 }  // namespace
 
 class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore> {
@@ -232,10 +255,12 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         bool forceDisableCache = false) {
         OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "CoreImpl::compile_model_impl");
         ov::runtime::SoPtr<ie::IExecutableNetworkInternal> execNetwork;
+        notifyLoadNetworkStage(ie::LoadNetworkStage::COMPILE);
         execNetwork = context ? plugin.compile_model(network, context, parsedConfig)
                               : plugin.compile_model(network, parsedConfig);
         auto cacheManager = coreConfig.getCacheConfig()._cacheManager;
         if (!forceDisableCache && cacheManager && DeviceSupportsImportExport(plugin)) {
+            notifyLoadNetworkStage(ie::LoadNetworkStage::EXPORT_TO_CACHE);
             try {
                 // need to export network for further import from "cache"
                 OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::LoadNetwork::Export");
@@ -265,30 +290,53 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         struct HeaderException {};
 
         OPENVINO_ASSERT(cacheManager != nullptr);
-        try {
-            cacheManager->readCacheEntry(blobId, [&](std::istream& networkStream) {
-                OV_ITT_SCOPE(FIRST_INFERENCE,
-                             ie::itt::domains::IE_LT,
-                             "Core::LoadNetworkFromCache::ReadStreamAndImport");
-                try {
-                    ie::CompiledBlobHeader header;
-                    networkStream >> header;
-                    if (header.getIeVersion() != ie::GetInferenceEngineVersion()->buildNumber) {
-                        // Build number mismatch, don't use this cache
-                        throw ie::NetworkNotRead("Version does not match");
-                    }
-                    if (header.getFileInfo() != ie::NetworkCompilationContext::calculateFileInfo(modelPath)) {
-                        // Original file is changed, don't use cache
-                        throw ie::NetworkNotRead("Original model file is changed");
-                    }
-                } catch (...) {
-                    throw HeaderException();
+        const auto readHeader = [&](std::istream& networkStream) {
+            try {
+                ie::CompiledBlobHeader header;
+                networkStream >> header;
+                if (header.getIeVersion() != ie::GetInferenceEngineVersion()->buildNumber) {
+                    // Build number mismatch, don't use this cache
+                    throw ie::NetworkNotRead("Version does not match");
                 }
-
-                execNetwork = context ? plugin.import_model(networkStream, context, config)
-                                      : plugin.import_model(networkStream, config);
-                networkIsImported = true;
-            });
+                if (header.getFileInfo() != ie::NetworkCompilationContext::calculateFileInfo(modelPath)) {
+                    // Original file is changed, don't use cache
+                    throw ie::NetworkNotRead("Original model file is changed");
+                }
+            } catch (...) {
+                throw HeaderException();
+            }
+        };
+        try {
+            // the mapped entry is passed to the plugin as is, so the plugin can reference the data in place
+            const bool isMapped =
+                !context && cacheManager->readCacheEntryMapped(
+                                blobId,
+                                [&](const std::shared_ptr<ov::util::MappedMemory>& networkMemory) {
+                                    OV_ITT_SCOPE(FIRST_INFERENCE,
+                                                 ie::itt::domains::IE_LT,
+                                                 "Core::LoadNetworkFromCache::MapAndImport");
+                                    ie::MemoryStreamBuf buffer(networkMemory->data(), networkMemory->size());
+                                    std::istream networkStream(&buffer);
+                                    readHeader(networkStream);
+                                    notifyLoadNetworkStage(ie::LoadNetworkStage::IMPORT_FROM_CACHE);
+                                    execNetwork = plugin.import_model(networkStream, networkMemory, config);
+                                    networkIsImported = true;
+                                });
+            if (!isMapped) {
+                cacheManager->readCacheEntry(blobId, [&](std::istream& networkStream) {
+                    OV_ITT_SCOPE(FIRST_INFERENCE,
+                                 ie::itt::domains::IE_LT,
+                                 "Core::LoadNetworkFromCache::ReadStreamAndImport");
+                    readHeader(networkStream);
+                    notifyLoadNetworkStage(ie::LoadNetworkStage::IMPORT_FROM_CACHE);
+                    execNetwork = context ? plugin.import_model(networkStream, context, config)
+                                          : plugin.import_model(networkStream, config);
+                    networkIsImported = true;
+                });
+            }
+        } catch (const ie::InferCancelled&) {
+            // cache entry is valid, load is cancelled by the user
+            throw;
         } catch (const HeaderException&) {
             // For these exceptions just remove old cache and set that import didn't work
             cacheManager->removeCacheEntry(blobId);
@@ -302,6 +350,19 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         return execNetwork;
     }
 
+    // Concurrent loads of the same network (same hash) wait for the first one and reuse the network it has loaded
+    // instead of importing it once again. Loads with remote context are not shared as context is not a part of hash
+    template <typename Loader>
+    ov::runtime::SoPtr<ie::IExecutableNetworkInternal> LoadNetworkShared(ie::CacheGuardEntry& lock, Loader load) {
+        using ExecNetwork = ov::runtime::SoPtr<ie::IExecutableNetworkInternal>;
+        if (auto shared = lock.getResult()) {
+            return *std::static_pointer_cast<ExecNetwork>(shared);
+        }
+        auto execNetwork = load();
+        lock.setResult(std::make_shared<ExecNetwork>(execNetwork));
+        return execNetwork;
+    }
+
     std::map<std::string, std::string> CreateCompileConfig(const ov::runtime::InferencePlugin& plugin,
                                                            const std::string& deviceFamily,
                                                            const std::map<std::string, std::string>& origConfig) const {
@@ -446,6 +507,7 @@ public:
 
     ie::CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from file");
+        notifyLoadNetworkStage(ie::LoadNetworkStage::READ_NETWORK);
         return InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, newAPI);
     }
 
@@ -474,6 +536,7 @@ public:
             auto hash = CalculateNetworkHash(network, parsed._deviceName, plugin, parsed._config);
             bool loadedFromCache = false;
             auto lock = cacheGuard.getHashLock(hash);
+            auto fileLock = cacheManager->lockCacheEntry(hash);
             res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, context, loadedFromCache);
             if (!loadedFromCache) {
                 res = compile_model_impl(network, plugin, parsed._config, context, hash);
@@ -501,10 +564,16 @@ public:
             auto hash = CalculateNetworkHash(network, parsed._deviceName, plugin, parsed._config);
             bool loadedFromCache = false;
             auto lock = cacheGuard.getHashLock(hash);
-            res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache);
-            if (!loadedFromCache) {
-                res = compile_model_impl(network, plugin, parsed._config, nullptr, hash, {}, forceDisableCache);
-            }
+            res = LoadNetworkShared(*lock, [&] {
+                auto fileLock = cacheManager->lockCacheEntry(hash);
+                auto execNetwork =
+                    LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache);
+                if (!loadedFromCache) {
+                    execNetwork =
+                        compile_model_impl(network, plugin, parsed._config, nullptr, hash, {}, forceDisableCache);
+                }
+                return execNetwork;
+            });
         } else {
             res = compile_model_impl(network, plugin, parsed._config, nullptr, {}, {}, forceDisableCache);
         }
@@ -523,11 +592,21 @@ public:
             bool loadedFromCache = false;
             auto hash = CalculateFileHash(modelPath, parsed._deviceName, plugin, parsed._config);
             auto lock = cacheGuard.getHashLock(hash);
-            res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache, modelPath);
-            if (!loadedFromCache) {
-                auto cnnNetwork = ReadNetwork(modelPath, std::string());
-                res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, hash, modelPath);
-            }
+            res = LoadNetworkShared(*lock, [&] {
+                auto fileLock = cacheManager->lockCacheEntry(hash);
+                auto execNetwork = LoadNetworkFromCache(cacheManager,
+                                                        hash,
+                                                        plugin,
+                                                        parsed._config,
+                                                        nullptr,
+                                                        loadedFromCache,
+                                                        modelPath);
+                if (!loadedFromCache) {
+                    auto cnnNetwork = ReadNetwork(modelPath, std::string());
+                    execNetwork = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, hash, modelPath);
+                }
+                return execNetwork;
+            });
         } else if (cacheManager) {
             res = plugin.compile_model(modelPath, parsed._config);
         } else {
@@ -881,6 +960,13 @@ public:
                     deviceNames = ie::DeviceIDParser::getMultiDevices(deviceName.substr(pos + 1));
                 }
                 deviceNames.emplace_back("AUTO");
+            } else if (deviceName.find("BATCH") == 0) {
+                auto pos = deviceName.find_first_of(":");
+                if (pos != std::string::npos) {
+                    // the batch size in the brackets e.g. "GPU(4)" is skipped the same way as the #requests for MULTI
+                    deviceNames = ie::DeviceIDParser::getMultiDevices(deviceName.substr(pos + 1));
+                }
+                deviceNames.push_back("BATCH");
             } else {
                 deviceNames.push_back(deviceName);
             }
@@ -1045,6 +1131,31 @@ ExecutableNetwork Core::LoadNetwork(const std::string& modelPath,
     return {exec._so, exec._ptr};
 }
 
+std::future<ExecutableNetwork> Core::LoadNetworkAsync(const CNNNetwork& network,
+                                                      const std::string& deviceName,
+                                                      const std::map<std::string, std::string>& config,
+                                                      const LoadNetworkCallback& callback) {
+    // the thread keeps the core implementation alive, so the Core object itself can be destroyed meanwhile
+    auto impl = _impl;
+    return std::async(std::launch::async, [impl, network, deviceName, config, callback] {
+        ov::runtime::LoadNetworkCallbackScope callbackScope(callback);
+        auto exec = impl->LoadNetwork(network, deviceName, config);
+        return ExecutableNetwork{exec._so, exec._ptr};
+    });
+}
+
+std::future<ExecutableNetwork> Core::LoadNetworkAsync(const std::string& modelPath,
+                                                      const std::string& deviceName,
+                                                      const std::map<std::string, std::string>& config,
+                                                      const LoadNetworkCallback& callback) {
+    auto impl = _impl;
+    return std::async(std::launch::async, [impl, modelPath, deviceName, config, callback] {
+        ov::runtime::LoadNetworkCallbackScope callbackScope(callback);
+        auto exec = impl->LoadNetwork(modelPath, deviceName, config);
+        return ExecutableNetwork{exec._so, exec._ptr};
+    });
+}
+
 RemoteContext::Ptr Core::CreateContext(const std::string& deviceName, const ParamMap& params) {
     if (deviceName.find("HETERO") == 0) {
         IE_THROW() << "HETERO device does not support remote context";
@@ -0,0 +1,128 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_data_hash.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "ie_parallel.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+// xxHash64 algorithm, see https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+constexpr uint64_t prime1 = 0x9E3779B185EBCA87ull;
+constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+constexpr uint64_t prime3 = 0x165667B19E3779F9ull;
+constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ull;
+constexpr uint64_t prime5 = 0x27D4EB2F165667C5ull;
+
+// Data blocks are hashed independently, so this defines the granularity of parallel work
+constexpr size_t hashBlockSize = 1 << 20;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t read32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t hashRound(uint64_t acc, uint64_t input) {
+    acc += input * prime2;
+    acc = rotl(acc, 31);
+    return acc * prime1;
+}
+
+inline uint64_t mergeRound(uint64_t acc, uint64_t val) {
+    acc ^= hashRound(0, val);
+    return acc * prime1 + prime4;
+}
+
+uint64_t xxhash64(const uint8_t* p, size_t size, uint64_t seed) {
+    const uint8_t* const end = p + size;
+    uint64_t h;
+
+    if (size >= 32) {
+        const uint8_t* const limit = end - 32;
+        uint64_t v1 = seed + prime1 + prime2;
+        uint64_t v2 = seed + prime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - prime1;
+
+        do {
+            v1 = hashRound(v1, read64(p));
+            v2 = hashRound(v2, read64(p + 8));
+            v3 = hashRound(v3, read64(p + 16));
+            v4 = hashRound(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = mergeRound(h, v1);
+        h = mergeRound(h, v2);
+        h = mergeRound(h, v3);
+        h = mergeRound(h, v4);
+    } else {
+        h = seed + prime5;
+    }
+
+    h += static_cast<uint64_t>(size);
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= hashRound(0, read64(p));
+        h = rotl(h, 27) * prime1 + prime4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(p)) * prime1;
+        h = rotl(h, 23) * prime2 + prime3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        h ^= static_cast<uint64_t>(*p) * prime5;
+        h = rotl(h, 11) * prime1;
+    }
+
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+}  // namespace
+
+uint64_t computeDataHashSequential(const void* data, size_t size, uint64_t seed) {
+    return xxhash64(static_cast<const uint8_t*>(data), size, seed);
+}
+
+uint64_t computeDataHash(const void* data, size_t size) {
+    const auto ptr = static_cast<const uint8_t*>(data);
+    if (size <= hashBlockSize)
+        return xxhash64(ptr, size, 0);
+
+    const size_t blocksNum = (size + hashBlockSize - 1) / hashBlockSize;
+    std::vector<uint64_t> digests(blocksNum);
+    parallel_for(blocksNum, [&](size_t block) {
+        const size_t offset = block * hashBlockSize;
+        const size_t blockSize = std::min(hashBlockSize, size - offset);
+        digests[block] = xxhash64(ptr + offset, blockSize, block);
+    });
+
+    return xxhash64(reinterpret_cast<const uint8_t*>(digests.data()), digests.size() * sizeof(uint64_t), size);
+}
+
+}  // namespace InferenceEngine
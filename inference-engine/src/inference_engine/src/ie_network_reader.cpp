@@ -22,6 +22,7 @@
 #include "ie_input_info.hpp"
 #include "ie_ir_version.hpp"
 #include "ie_itt.hpp"
+#include "ie_mapped_memory.hpp"
 #include "ie_reader.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -32,6 +33,7 @@
 #include "openvino/core/preprocess/input_tensor_info.hpp"
 #include "openvino/core/preprocess/pre_post_process.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "transformations/rt_info/old_api_map_attribute.hpp"
 #include "transformations/utils/utils.hpp"
 
@@ -226,24 +228,21 @@ CNNNetwork load_ir_v7_network(const std::string& modelPath,
 #else
                 std::string weights_path = bPath;
 #endif
-                std::ifstream binStream;
-                binStream.open(weights_path, std::ios::binary);
-                if (!binStream.is_open())
-                    IE_THROW() << "Weights file " << bPath << " cannot be opened!";
-
-                binStream.seekg(0, std::ios::end);
-                size_t fileSize = binStream.tellg();
-                binStream.seekg(0, std::ios::beg);
-
-                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, {fileSize}, C});
-
+                std::shared_ptr<ov::util::MappedMemory> mappedWeights;
                 {
                     OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "ReadNetworkWeights");
-                    weights->allocate();
-                    binStream.read(weights->buffer(), fileSize);
-                    binStream.close();
+                    try {
+                        mappedWeights = ov::util::load_mmap_object(weights_path);
+                    } catch (const std::exception& ex) {
+                        IE_THROW() << "Weights file " << bPath << " cannot be opened! " << ex.what();
+                    }
                 }
 
+                const size_t fileSize = mappedWeights->size();
+                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, {fileSize}, C},
+                                                              std::make_shared<MappedMemoryAllocator>(mappedWeights));
+                weights->allocate();
+
                 // read model with weights
                 auto network = reader->read(modelStream, weights, exts);
                 modelStream.close();
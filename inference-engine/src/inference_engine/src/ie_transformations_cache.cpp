@@ -0,0 +1,194 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_transformations_cache.hpp"
+
+#include <cstdint>
+#include <sstream>
+#include <vector>
+
+#include "compilation_context.hpp"
+#include "ie_blob.h"
+#include "ie_cache_manager.hpp"
+#include "ie_icore.hpp"
+#include "ie_itt.hpp"
+#include "ie_version.hpp"
+#include "ngraph/opsets/opset.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/pass/serialize.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+constexpr const char* transformedEntryPrefix = "transformed_";
+
+// IR reader restores the standard opsets only, the plugin internal operations are not cached
+bool hasStandardOpsOnly(const std::shared_ptr<const ngraph::Function>& function) {
+    static const std::vector<const ngraph::OpSet*> opsets = {&ngraph::get_opset1(),
+                                                             &ngraph::get_opset2(),
+                                                             &ngraph::get_opset3(),
+                                                             &ngraph::get_opset4(),
+                                                             &ngraph::get_opset5(),
+                                                             &ngraph::get_opset6(),
+                                                             &ngraph::get_opset7(),
+                                                             &ngraph::get_opset8()};
+    for (const auto& op : function->get_ops()) {
+        const auto& typeInfo = op->get_type_info();
+        bool isStandard = false;
+        for (const auto opset : opsets) {
+            if (opset->contains_type(typeInfo)) {
+                isStandard = true;
+                break;
+            }
+        }
+        if (!isStandard)
+            return false;
+
+        if (auto subGraphOp = ov::as_type_ptr<const ov::op::util::MultiSubGraphOp>(op)) {
+            for (size_t i = 0; i < subGraphOp->get_num_internal_subgraphs(); i++) {
+                if (!hasStandardOpsOnly(subGraphOp->get_function(static_cast<int>(i))))
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename T>
+void writeValue(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+T readValue(std::istream& stream) {
+    T value{};
+    stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+    if (!stream.good()) {
+        IE_THROW() << "Transformed network cache entry is truncated";
+    }
+    return value;
+}
+
+}  // namespace
+
+TransformationsCache::TransformationsCache(const std::string& cacheDir, const std::string& pipelineVersion)
+    : m_pipelineVersion(pipelineVersion) {
+    if (!cacheDir.empty()) {
+        m_cacheManager = std::make_shared<FileStorageCacheManager>(std::string(cacheDir));
+    }
+}
+
+bool TransformationsCache::isEnabled() const {
+    return m_cacheManager != nullptr;
+}
+
+std::string TransformationsCache::computeHash(const CNNNetwork& network,
+                                              const std::map<std::string, std::string>& options) const {
+    auto hashOptions = options;
+    // the IR produced by another build may contain the outdated transformations results
+    hashOptions["IE_BUILD_NUMBER"] = GetInferenceEngineVersion()->buildNumber;
+    hashOptions["TRANSFORMATIONS_PIPELINE_VERSION"] = m_pipelineVersion;
+    return transformedEntryPrefix + NetworkCompilationContext::computeHash(network, hashOptions);
+}
+
+CNNNetwork TransformationsCache::load(const std::string& hash, const CNNNetwork& network, const ICore& core) const {
+    OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "TransformationsCache::load");
+    CNNNetwork transformed;
+    try {
+        m_cacheManager->readCacheEntry(hash, [&](std::istream& stream) {
+            const auto xmlSize = readValue<uint64_t>(stream);
+            const auto binSize = readValue<uint64_t>(stream);
+
+            std::string xml(static_cast<size_t>(xmlSize), '\0');
+            stream.read(&xml[0], static_cast<std::streamsize>(xmlSize));
+
+            Blob::Ptr weights;
+            if (binSize > 0) {
+                weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {static_cast<size_t>(binSize)}, Layout::C));
+                weights->allocate();
+                stream.read(weights->buffer().as<char*>(), static_cast<std::streamsize>(binSize));
+            }
+            if (!stream.good()) {
+                IE_THROW() << "Transformed network cache entry is truncated";
+            }
+            transformed = core.ReadNetwork(xml, weights);
+        });
+    } catch (...) {
+        // the broken entry is transformed and stored again
+        m_cacheManager->removeCacheEntry(hash);
+        return {};
+    }
+    if (!transformed.getFunction()) {
+        return {};
+    }
+
+    // the user settings of the original network are not a part of IR
+    auto inputs = transformed.getInputsInfo();
+    for (const auto& input : network.getInputsInfo()) {
+        auto it = inputs.find(input.first);
+        if (it == inputs.end()) {
+            m_cacheManager->removeCacheEntry(hash);
+            return {};
+        }
+        it->second->setPrecision(input.second->getPrecision());
+        it->second->setLayout(input.second->getLayout());
+        it->second->getPreProcess() = input.second->getPreProcess();
+    }
+    auto outputs = transformed.getOutputsInfo();
+    for (const auto& output : network.getOutputsInfo()) {
+        auto it = outputs.find(output.first);
+        if (it == outputs.end()) {
+            m_cacheManager->removeCacheEntry(hash);
+            return {};
+        }
+        it->second->setPrecision(output.second->getPrecision());
+        it->second->setLayout(output.second->getLayout());
+    }
+    return transformed;
+}
+
+void TransformationsCache::store(const std::string& hash, const CNNNetwork& transformed) const {
+    OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "TransformationsCache::store");
+    if (!hasStandardOpsOnly(transformed.getFunction()))
+        return;
+
+    std::stringstream xml, bin;
+    ov::pass::Serialize serializer(xml, bin);
+    serializer.run_on_function(std::const_pointer_cast<ngraph::Function>(transformed.getFunction()));
+    const auto xmlStr = xml.str();
+    const auto binStr = bin.str();
+
+    try {
+        m_cacheManager->writeCacheEntry(hash, [&](std::ostream& stream) {
+            writeValue(stream, static_cast<uint64_t>(xmlStr.size()));
+            writeValue(stream, static_cast<uint64_t>(binStr.size()));
+            stream.write(xmlStr.data(), static_cast<std::streamsize>(xmlStr.size()));
+            stream.write(binStr.data(), static_cast<std::streamsize>(binStr.size()));
+        });
+    } catch (...) {
+        // caching is an optimization, the network is loaded anyway
+        m_cacheManager->removeCacheEntry(hash);
+    }
+}
+
+CNNNetwork TransformationsCache::getOrTransform(const CNNNetwork& network,
+                                                const std::map<std::string, std::string>& options,
+                                                const ICore& core,
+                                                const Transform& transform) const {
+    if (!isEnabled() || !network.getFunction()) {
+        return transform(network);
+    }
+
+    const auto hash = computeHash(network, options);
+    auto lock = m_cacheManager->lockCacheEntry(hash);
+    auto transformed = load(hash, network, core);
+    if (!transformed.getFunction()) {
+        transformed = transform(network);
+        store(hash, transformed);
+    }
+    return transformed;
+}
+
+}  // namespace InferenceEngine
@@ -6,21 +6,72 @@
 
 #include <stdint.h>
 
+#include <algorithm>
+
+#include "ie_parallel.hpp"
+#include "ie_system_conf.h"
+#ifdef HAVE_AVX2
+#    include "cpu_x86_avx2/precision_utils_avx2.hpp"
+#endif
+
 namespace InferenceEngine {
 namespace PrecisionUtils {
 
+namespace {
+
+// Arrays are converted by blocks of this number of elements in parallel
+constexpr size_t conversionBlockSize = 1 << 16;
+
+template <typename F>
+void parallelBlocks(size_t nelem, const F& convert) {
+    if (nelem <= conversionBlockSize) {
+        convert(0, nelem);
+        return;
+    }
+    const size_t blocksNum = (nelem + conversionBlockSize - 1) / conversionBlockSize;
+    parallel_for(blocksNum, [&](size_t block) {
+        const size_t offset = block * conversionBlockSize;
+        convert(offset, std::min(conversionBlockSize, nelem - offset));
+    });
+}
+
+}  // namespace
+
 void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
     const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
 
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
+#ifdef HAVE_AVX2
+    // the vector code doesn't apply scale and bias to not change the rounding by fusing them
+    if (scale == 1.f && bias == 0.f && with_cpu_x86_avx2()) {
+        parallelBlocks(nelem, [&](size_t offset, size_t size) {
+            f16tof32Arrays_avx2(dst + offset, _src + offset, size);
+        });
+        return;
     }
+#endif
+
+    parallelBlocks(nelem, [&](size_t offset, size_t size) {
+        for (size_t i = offset; i < offset + size; i++) {
+            dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
+        }
+    });
 }
 
 void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+#ifdef HAVE_AVX2
+    if (scale == 1.f && bias == 0.f && with_cpu_x86_avx2()) {
+        parallelBlocks(nelem, [&](size_t offset, size_t size) {
+            f32tof16Arrays_avx2(dst + offset, src + offset, size);
+        });
+        return;
     }
+#endif
+
+    parallelBlocks(nelem, [&](size_t offset, size_t size) {
+        for (size_t i = offset; i < offset + size; i++) {
+            dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+        }
+    });
 }
 
 // Function to convert F32 into F16
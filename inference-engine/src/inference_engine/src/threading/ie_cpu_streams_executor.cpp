@@ -8,6 +8,7 @@
 #include <cassert>
 #include <climits>
 #include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -19,6 +20,8 @@
 
 #include "ie_parallel_custom_arena.hpp"
 #include "ie_system_conf.h"
+#include "threading/ie_lock_free_queue.hpp"
+#include "threading/ie_priority_task_queue.hpp"
 #include "threading/ie_thread_affinity.hpp"
 #include "threading/ie_thread_local.hpp"
 
@@ -30,6 +33,7 @@ struct CPUStreamsExecutor::Impl {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         struct Observer : public custom::task_scheduler_observer {
             CpuSet _mask;
+            CpuSet _streamMask;
             int _ncpus = 0;
             int _threadBindingStep = 0;
             int _offset = 0;
@@ -45,7 +49,17 @@ struct CPUStreamsExecutor::Impl {
                   _ncpus(ncpus),
                   _threadBindingStep(threadBindingStep),
                   _offset{streamId * threadsPerStream + threadBindingOffset} {}
+            // all threads of the stream share the mask of its cache group, the OS balances them inside the group
+            Observer(custom::task_arena& arena, CpuSet mask, CpuSet streamMask, int ncpus)
+                : custom::task_scheduler_observer(arena),
+                  _mask{std::move(mask)},
+                  _streamMask{std::move(streamMask)},
+                  _ncpus(ncpus) {}
             void on_scheduler_entry(bool) override {
+                if (nullptr != _streamMask) {
+                    PinCurrentThreadByMask(_ncpus, _streamMask);
+                    return;
+                }
                 PinThreadToVacantCore(_offset + tbb::this_task_arena::current_thread_index(),
                                       _threadBindingStep,
                                       _ncpus,
@@ -102,12 +116,35 @@ struct CPUStreamsExecutor::Impl {
                                 return p.second > streamId_wrapped;
                             })
                             ->first;
+                    _littleCore = selected_core_type != custom::info::core_types().back();
+                    const auto core_type_concurrency =
+                        (_littleCore && 0 != _impl->_config._littleCoreThreadsPerStream)
+                            ? _impl->_config._littleCoreThreadsPerStream
+                            : concurrency;
                     _taskArena.reset(new custom::task_arena{custom::task_arena::constraints{}
                                                                 .set_core_type(selected_core_type)
-                                                                .set_max_concurrency(concurrency)});
+                                                                .set_max_concurrency(core_type_concurrency)});
                 }
             } else if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
                 _taskArena.reset(new custom::task_arena{custom::task_arena::constraints{_numaNodeId, concurrency}});
+            } else if (ThreadBindingType::CACHE_AWARE == _impl->_config._threadBindingType) {
+                CpuSet processMask, streamMask;
+                int ncpus = 0;
+                std::tie(processMask, ncpus) = GetProcessMask();
+                std::tie(streamMask, ncpus) = GetStreamCacheMask(_streamId,
+                                                                 _impl->_config._threadsPerStream,
+                                                                 _impl->_config._threadBindingSmt);
+                if (nullptr != streamMask) {
+                    const auto streamConcurrency =
+                        (0 == _impl->_config._threadsPerStream)
+                            ? CPU_COUNT_S(CPU_ALLOC_SIZE(ncpus), streamMask.get())
+                            : concurrency;
+                    _taskArena.reset(new custom::task_arena{streamConcurrency});
+                    _observer.reset(new Observer{*_taskArena, std::move(processMask), std::move(streamMask), ncpus});
+                    _observer->observe(true);
+                } else {
+                    _taskArena.reset(new custom::task_arena{concurrency});
+                }
             } else if ((0 != _impl->_config._threadsPerStream) ||
                        (ThreadBindingType::CORES == _impl->_config._threadBindingType)) {
                 _taskArena.reset(new custom::task_arena{concurrency});
@@ -129,7 +166,18 @@ struct CPUStreamsExecutor::Impl {
             }
 #elif IE_THREAD == IE_THREAD_OMP
             omp_set_num_threads(_impl->_config._threadsPerStream);
-            if (!checkOpenMpEnvVars(false) && (ThreadBindingType::NONE != _impl->_config._threadBindingType)) {
+            if (!checkOpenMpEnvVars(false) && (ThreadBindingType::CACHE_AWARE == _impl->_config._threadBindingType)) {
+                CpuSet streamMask;
+                int ncpus = 0;
+                std::tie(streamMask, ncpus) = GetStreamCacheMask(_streamId,
+                                                                 _impl->_config._threadsPerStream,
+                                                                 _impl->_config._threadBindingSmt);
+                if (nullptr != streamMask) {
+                    parallel_nt(_impl->_config._threadsPerStream, [&](int, int) {
+                        PinCurrentThreadByMask(ncpus, streamMask);
+                    });
+                }
+            } else if (!checkOpenMpEnvVars(false) && (ThreadBindingType::NONE != _impl->_config._threadBindingType)) {
                 CpuSet processMask;
                 int ncpus = 0;
                 std::tie(processMask, ncpus) = GetProcessMask();
@@ -144,6 +192,14 @@ struct CPUStreamsExecutor::Impl {
 #elif IE_THREAD == IE_THREAD_SEQ
             if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
                 PinCurrentThreadToSocket(_numaNodeId);
+            } else if (ThreadBindingType::CACHE_AWARE == _impl->_config._threadBindingType) {
+                CpuSet streamMask;
+                int ncpus = 0;
+                std::tie(streamMask, ncpus) =
+                    GetStreamCacheMask(_streamId, _impl->_config._threadsPerStream, _impl->_config._threadBindingSmt);
+                if (nullptr != streamMask) {
+                    PinCurrentThreadByMask(ncpus, streamMask);
+                }
             } else if (ThreadBindingType::CORES == _impl->_config._threadBindingType) {
                 CpuSet processMask;
                 int ncpus = 0;
@@ -172,6 +228,7 @@ struct CPUStreamsExecutor::Impl {
         Impl* _impl = nullptr;
         int _streamId = 0;
         int _numaNodeId = 0;
+        bool _littleCore = false;
         bool _execute = false;
         std::queue<Task> _taskQueue;
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -196,12 +253,15 @@ struct CPUStreamsExecutor::Impl {
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         if (ThreadBindingType::HYBRID_AWARE == config._threadBindingType) {
             const auto core_types = custom::info::core_types();
-            const int threadsPerStream =
+            const int bigCoreThreadsPerStream =
                 (0 == config._threadsPerStream) ? std::thread::hardware_concurrency() : config._threadsPerStream;
             int sum = 0;
             // reversed order, so BIG cores are first
             for (auto iter = core_types.rbegin(); iter < core_types.rend(); iter++) {
                 const auto& type = *iter;
+                const int threadsPerStream = (iter != core_types.rbegin() && 0 != config._littleCoreThreadsPerStream)
+                                                 ? config._littleCoreThreadsPerStream
+                                                 : bigCoreThreadsPerStream;
                 // calculating the #streams per core type
                 const int num_streams_for_core_type =
                     std::max(1,
@@ -213,37 +273,171 @@ struct CPUStreamsExecutor::Impl {
                 // first)
                 total_streams_on_core_types.push_back({type, sum});
             }
+            _preferBigCores = Config::PreferredCoreType::ROUND_ROBIN == config._threadPreferredCoreType &&
+                              total_streams_on_core_types.size() > 1;
         }
 #endif
+        if (_config._workStealing) {
+            for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+                _workerQueues.emplace_back(new WorkerQueue{});
+            }
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                if (_config._workStealing) {
+                    WorkStealingLoop(streamId);
+                    return;
+                }
+                auto& stream = *(_streams.local());
+                // the Little cores streams take a task only if there is no idle Big cores stream,
+                // so with the low load all the requests are executed by the faster Big cores
+                const bool yieldToBigCores = _preferBigCores && stream._littleCore;
                 for (bool stopped = false; !stopped;) {
                     Task task;
+                    bool moreTasks = false;
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
+                        if (_preferBigCores && !stream._littleCore) {
+                            ++_idleBigCoreStreams;
+                        }
                         _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
+                            return (!_taskQueue.empty() && !(yieldToBigCores && _idleBigCoreStreams > 0)) ||
+                                   (stopped = _isStopped);
                         });
+                        if (_preferBigCores && !stream._littleCore) {
+                            --_idleBigCoreStreams;
+                        }
                         if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                            task = _taskQueue.pop();
                         }
+                        moreTasks = !_taskQueue.empty();
+                    }
+                    if (moreTasks && _preferBigCores && !stream._littleCore) {
+                        // the waiting Little cores streams may take the rest of tasks now
+                        _queueCondVar.notify_all();
                     }
                     if (task) {
-                        Execute(task, *(_streams.local()));
+                        Execute(task, stream);
                     }
                 }
             });
         }
     }
 
-    void Enqueue(Task task) {
+    void Enqueue(Task task, const int priority) {
+        if (!_workerQueues.empty()) {
+            EnqueueToWorkerQueue(std::move(task), priority);
+            return;
+        }
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _taskQueue.push(std::move(task), priority);
+        }
+        if (_preferBigCores) {
+            // a waiting Little cores stream can't tell whether the task is for it, so all the streams check it
+            _queueCondVar.notify_all();
+        } else {
+            _queueCondVar.notify_one();
+        }
+    }
+
+    void EnqueueToWorkerQueue(Task task, const int priority) {
+        bool pushed = false;
+        // the ring buffers are FIFO, so only the tasks of the default priority are distributed to them
+        if (0 == priority) {
+            // round-robin distribution, idle streams will steal the tasks if the target stream is busy
+            const auto queuesNum = _workerQueues.size();
+            const auto start = _nextWorkerQueue.fetch_add(1, std::memory_order_relaxed);
+            for (std::size_t i = 0; i < queuesNum && !pushed; ++i) {
+                pushed = _workerQueues[(start + i) % queuesNum]->_tasks.try_push(task);
+            }
+        }
+        if (!pushed) {
+            // all the ring buffers are full or the task has a priority, fallback to the unbounded shared queue
+            std::lock_guard<std::mutex> lock(_mutex);
+            _taskQueue.push(std::move(task), priority);
+            _sharedTasks.fetch_add(1);
+            if (priority > 0) {
+                _urgentTasks.fetch_add(1);
+            }
+        }
+        _pendingTasks.fetch_add(1);
+        if (_sleepingWorkers.load() > 0) {
+            // acquiring the mutex guarantees that the sleeping worker either waits or will see the pending task
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            _queueCondVar.notify_one();
+        }
+    }
+
+    bool TryPopFromWorkerQueues(const int streamId, Task& task) {
+        auto& own = *_workerQueues[streamId];
+        if (own._tasks.try_pop(task)) {
+            return true;
+        }
+        // steal from the streams on the same NUMA node first to keep the data local, then from the rest of streams
+        const auto numaNodeId = own._numaNodeId.load(std::memory_order_relaxed);
+        for (const bool sameNode : {true, false}) {
+            for (std::size_t i = 1; i < _workerQueues.size(); ++i) {
+                auto& victim = *_workerQueues[(streamId + i) % _workerQueues.size()];
+                if ((victim._numaNodeId.load(std::memory_order_relaxed) == numaNodeId) == sameNode &&
+                    victim._tasks.try_pop(task)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // expects the locked _mutex and the non-empty shared queue
+    Task PopFromSharedQueue() {
+        int priority = 0;
+        Task task = _taskQueue.pop(&priority);
+        _sharedTasks.fetch_sub(1);
+        if (priority > 0) {
+            _urgentTasks.fetch_sub(1);
+        }
+        return task;
+    }
+
+    bool TryPopFromSharedQueue(Task& task) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_taskQueue.empty()) {
+            return false;
+        }
+        task = PopFromSharedQueue();
+        return true;
+    }
+
+    void WorkStealingLoop(const int streamId) {
+        auto& stream = *(_streams.local());
+        _workerQueues[streamId]->_numaNodeId.store(stream._numaNodeId, std::memory_order_relaxed);
+        std::size_t iteration = 0;
+        for (bool stopped = false; !stopped;) {
+            Task task;
+            // the urgent tasks go ahead of the ring buffers, the rest of shared queue is periodically checked as well,
+            // so the low priority tasks are not starved by the steady flow of the default ones
+            const bool sharedFirst = _urgentTasks.load() > 0 ||
+                                     (_sharedTasks.load() > 0 && 0 == (++iteration % sharedQueueCheckPeriod));
+            if ((sharedFirst && TryPopFromSharedQueue(task)) || TryPopFromWorkerQueues(streamId, task)) {
+                _pendingTasks.fetch_sub(1);
+            } else {
+                std::unique_lock<std::mutex> lock(_mutex);
+                if (!_taskQueue.empty()) {
+                    task = PopFromSharedQueue();
+                    _pendingTasks.fetch_sub(1);
+                } else {
+                    _sleepingWorkers.fetch_add(1);
+                    _queueCondVar.wait(lock, [&] {
+                        return _pendingTasks.load() > 0 || (stopped = _isStopped);
+                    });
+                    _sleepingWorkers.fetch_sub(1);
+                }
+            }
+            if (task) {
+                Execute(task, stream);
+            }
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -282,8 +476,25 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread> _threads;
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    PriorityTaskQueue _taskQueue;
     bool _isStopped = false;
+    struct WorkerQueue {
+        static constexpr std::size_t capacity = 1024;
+        LockFreeBoundedQueue<Task> _tasks{capacity};
+        std::atomic<int> _numaNodeId{-1};
+    };
+    std::vector<std::unique_ptr<WorkerQueue>> _workerQueues;
+    std::atomic<std::size_t> _nextWorkerQueue{0};
+    // number of tasks in all the queues, may be temporarily negative as it is updated after push
+    std::atomic<std::int64_t> _pendingTasks{0};
+    std::atomic<int> _sleepingWorkers{0};
+    // number of tasks in the shared queue and the ones of them with the positive priority
+    std::atomic<std::int64_t> _sharedTasks{0};
+    std::atomic<std::int64_t> _urgentTasks{0};
+    static constexpr std::size_t sharedQueueCheckPeriod = 8;
+    // Big cores streams have the priority on the hybrid processors, guarded by the _mutex
+    bool _preferBigCores = false;
+    int _idleBigCoreStreams = 0;
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -326,10 +537,14 @@ void CPUStreamsExecutor::Execute(Task task) {
 }
 
 void CPUStreamsExecutor::run(Task task) {
+    runWithPriority(std::move(task), 0);
+}
+
+void CPUStreamsExecutor::runWithPriority(Task task, int priority) {
     if (0 == _impl->_config._streams) {
         _impl->Defer(std::move(task));
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->Enqueue(std::move(task), priority);
     }
 }
 
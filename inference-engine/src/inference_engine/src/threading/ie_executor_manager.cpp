@@ -35,7 +35,8 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
             executorConfig._threadsPerStream == config._threadsPerStream &&
             executorConfig._threadBindingType == config._threadBindingType &&
             executorConfig._threadBindingStep == config._threadBindingStep &&
-            executorConfig._threadBindingOffset == config._threadBindingOffset)
+            executorConfig._threadBindingOffset == config._threadBindingOffset &&
+            executorConfig._threadBindingSmt == config._threadBindingSmt)
             if (executorConfig._threadBindingType != IStreamsExecutor::ThreadBindingType::HYBRID_AWARE ||
                 executorConfig._threadPreferredCoreType == config._threadPreferredCoreType)
                 return executor;
@@ -45,6 +46,25 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
     return newExec;
 }
 
+IStreamsExecutor::Ptr ExecutorManagerImpl::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    std::lock_guard<std::mutex> guard(streamExecutorMutex);
+    auto& executor = sharedCpuStreamsExecutors[config._name];
+    if (executor == nullptr) {
+        executor = std::make_shared<CPUStreamsExecutor>(config);
+    }
+    return executor;
+}
+
+void ExecutorManagerImpl::setExternalExecutor(const ITaskExecutor::Ptr& executor) {
+    std::lock_guard<std::mutex> guard(taskExecutorMutex);
+    externalExecutor = executor;
+}
+
+ITaskExecutor::Ptr ExecutorManagerImpl::getExternalExecutor() {
+    std::lock_guard<std::mutex> guard(taskExecutorMutex);
+    return externalExecutor;
+}
+
 // for tests purposes
 size_t ExecutorManagerImpl::getExecutorsNumber() {
     return executors.size();
@@ -61,8 +81,11 @@ void ExecutorManagerImpl::clear(const std::string& id) {
     if (id.empty()) {
         executors.clear();
         cpuStreamsExecutors.clear();
+        externalExecutor = nullptr;
+        sharedCpuStreamsExecutors.clear();
     } else {
         executors.erase(id);
+        sharedCpuStreamsExecutors.erase(id);
         cpuStreamsExecutors.erase(
             std::remove_if(cpuStreamsExecutors.begin(),
                            cpuStreamsExecutors.end(),
@@ -134,4 +157,16 @@ IStreamsExecutor::Ptr ExecutorManager::getIdleCPUStreamsExecutor(const IStreamsE
     return _impl.getIdleCPUStreamsExecutor(config);
 }
 
+IStreamsExecutor::Ptr ExecutorManager::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    return _impl.getSharedCPUStreamsExecutor(config);
+}
+
+void ExecutorManager::setExternalExecutor(const ITaskExecutor::Ptr& executor) {
+    _impl.setExternalExecutor(executor);
+}
+
+ITaskExecutor::Ptr ExecutorManager::getExternalExecutor() {
+    return _impl.getExternalExecutor();
+}
+
 }  // namespace InferenceEngine
@@ -0,0 +1,104 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "threading/ie_external_streams_executor.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "threading/ie_priority_task_queue.hpp"
+#include "threading/ie_thread_local.hpp"
+
+namespace InferenceEngine {
+struct ExternalStreamsExecutor::Impl {
+    explicit Impl(const Config& config) : _currentStream{-1} {
+        const int streams = std::max(1, config._streams);
+        for (int streamId = streams - 1; streamId >= 0; streamId--)
+            _freeStreams.push_back(streamId);
+    }
+
+    // Executes the queued tasks while there are free streams, so the thread completing a task picks up the tasks
+    // which couldn't get a stream when they were submitted
+    void Drain() {
+        while (true) {
+            Task task;
+            int streamId = 0;
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                if (_taskQueue.empty() || _freeStreams.empty())
+                    return;
+                task = _taskQueue.pop();
+                streamId = _freeStreams.back();
+                _freeStreams.pop_back();
+            }
+            Execute(task, streamId);
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _freeStreams.push_back(streamId);
+            }
+        }
+    }
+
+    void Execute(const Task& task, int streamId) {
+        // a task may run the tasks of this executor inline (e.g. with no host executor), so the stream is restored
+        auto& currentStream = _currentStream.local();
+        struct Restore {
+            int& current;
+            int saved;
+            ~Restore() {
+                current = saved;
+            }
+        } restore{currentStream, currentStream};
+        currentStream = streamId;
+        task();
+    }
+
+    std::mutex _mutex;
+    PriorityTaskQueue _taskQueue;
+    std::vector<int> _freeStreams;
+    ThreadLocal<int> _currentStream;
+};
+
+ExternalStreamsExecutor::ExternalStreamsExecutor(const Config& config, const ITaskExecutor::Ptr& host)
+    : _impl{std::make_shared<Impl>(config)},
+      _host{host} {}
+
+ExternalStreamsExecutor::~ExternalStreamsExecutor() = default;
+
+void ExternalStreamsExecutor::run(Task task) {
+    runWithPriority(std::move(task), 0);
+}
+
+void ExternalStreamsExecutor::runWithPriority(Task task, int priority) {
+    {
+        std::lock_guard<std::mutex> lock{_impl->_mutex};
+        _impl->_taskQueue.push(std::move(task), priority);
+    }
+    if (_host) {
+        // the host may run the job after the executor is destroyed, so it keeps the queue alive
+        auto impl = _impl;
+        _host->run([impl] {
+            impl->Drain();
+        });
+    } else {
+        _impl->Drain();
+    }
+}
+
+void ExternalStreamsExecutor::Execute(Task task) {
+    _impl->Execute(task, GetStreamId());
+}
+
+int ExternalStreamsExecutor::GetStreamId() {
+    return std::max(0, _impl->_currentStream.local());
+}
+
+int ExternalStreamsExecutor::GetNumaNodeId() {
+    return 0;
+}
+
+}  // namespace InferenceEngine
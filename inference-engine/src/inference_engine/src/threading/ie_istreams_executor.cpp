@@ -25,6 +25,9 @@ std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
         CONFIG_KEY(CPU_BIND_THREAD),
         CONFIG_KEY(CPU_THREADS_NUM),
         CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM),
+        CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING),
+        CONFIG_KEY_INTERNAL(CPU_LITTLE_CORE_THREADS_PER_STREAM),
+        CONFIG_KEY_INTERNAL(CPU_BIND_SMT_SIBLINGS),
     };
 }
 int IStreamsExecutor::Config::GetDefaultNumStreams() {
@@ -52,12 +55,15 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
 #endif
         } else if (value == CONFIG_VALUE(HYBRID_AWARE)) {
             _threadBindingType = IStreamsExecutor::ThreadBindingType::HYBRID_AWARE;
+        } else if (value == CONFIG_VALUE(CACHE_AWARE)) {
+            _threadBindingType = IStreamsExecutor::ThreadBindingType::CACHE_AWARE;
         } else if (value == CONFIG_VALUE(NO)) {
             _threadBindingType = IStreamsExecutor::ThreadBindingType::NONE;
         } else {
             IE_THROW() << "Wrong value for property key " << CONFIG_KEY(CPU_BIND_THREAD)
                        << ". Expected only YES(binds to cores) / NO(no binding) / NUMA(binds to NUMA nodes) / "
-                          "HYBRID_AWARE (let the runtime recognize and use the hybrid cores)";
+                          "HYBRID_AWARE (let the runtime recognize and use the hybrid cores) / "
+                          "CACHE_AWARE (binds a stream to the cores sharing the last level cache)";
         }
     } else if (key == CONFIG_KEY(CPU_THROUGHPUT_STREAMS)) {
         if (value == CONFIG_VALUE(CPU_THROUGHPUT_NUMA)) {
@@ -106,6 +112,37 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                        << ". Expected only non negative numbers (#threads)";
         }
         _threadsPerStream = val_i;
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING)) {
+        if (value == CONFIG_VALUE(YES)) {
+            _workStealing = true;
+        } else if (value == CONFIG_VALUE(NO)) {
+            _workStealing = false;
+        } else {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING)
+                       << ". Expected only YES/NO";
+        }
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_LITTLE_CORE_THREADS_PER_STREAM)) {
+        int val_i;
+        try {
+            val_i = std::stoi(value);
+        } catch (const std::exception&) {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_LITTLE_CORE_THREADS_PER_STREAM)
+                       << ". Expected only non negative numbers (#threads)";
+        }
+        if (val_i < 0) {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_LITTLE_CORE_THREADS_PER_STREAM)
+                       << ". Expected only non negative numbers (#threads)";
+        }
+        _littleCoreThreadsPerStream = val_i;
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_BIND_SMT_SIBLINGS)) {
+        if (value == CONFIG_VALUE(YES)) {
+            _threadBindingSmt = true;
+        } else if (value == CONFIG_VALUE(NO)) {
+            _threadBindingSmt = false;
+        } else {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_BIND_SMT_SIBLINGS)
+                       << ". Expected only YES/NO";
+        }
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
@@ -126,6 +163,9 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
         case IStreamsExecutor::ThreadBindingType::HYBRID_AWARE:
             return {CONFIG_VALUE(HYBRID_AWARE)};
             break;
+        case IStreamsExecutor::ThreadBindingType::CACHE_AWARE:
+            return {CONFIG_VALUE(CACHE_AWARE)};
+            break;
         }
     } else if (key == CONFIG_KEY(CPU_THROUGHPUT_STREAMS)) {
         return {std::to_string(_streams)};
@@ -133,6 +173,12 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
         return {std::to_string(_threads)};
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {std::to_string(_threadsPerStream)};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING)) {
+        return {std::string(_workStealing ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO))};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_LITTLE_CORE_THREADS_PER_STREAM)) {
+        return {std::to_string(_littleCoreThreadsPerStream)};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_BIND_SMT_SIBLINGS)) {
+        return {std::string(_threadBindingSmt ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO))};
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
@@ -150,14 +196,14 @@ IStreamsExecutor::Config IStreamsExecutor::Config::MakeDefaultMultiThreaded(cons
     // by default, do not use the hyper-threading (to minimize threads synch overheads)
     int num_cores_default = getNumberOfCPUCores();
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    const int int8_threshold = 4;  // ~relative efficiency of the VNNI-intensive code for Big vs Little cores;
+    const int fp32_threshold = 2;  // ~relative efficiency of the AVX2 fp32 code for Big vs Little cores;
     // additional latency-case logic for hybrid processors:
     if (ThreadBindingType::HYBRID_AWARE == streamExecutorConfig._threadBindingType) {
         const auto core_types = custom::info::core_types();
         const auto num_little_cores =
             custom::info::default_concurrency(custom::task_arena::constraints{}.set_core_type(core_types.front()));
         const auto num_big_cores_phys = getNumberOfCPUCores(true);
-        const int int8_threshold = 4;  // ~relative efficiency of the VNNI-intensive code for Big vs Little cores;
-        const int fp32_threshold = 2;  // ~relative efficiency of the AVX2 fp32 code for Big vs Little cores;
         // by default the latency case uses (faster) Big cores only, depending on the compute ratio
         const bool bLatencyCaseBigOnly =
             num_big_cores_phys > (num_little_cores / (fp_intesive ? fp32_threshold : int8_threshold));
@@ -192,6 +238,24 @@ IStreamsExecutor::Config IStreamsExecutor::Config::MakeDefaultMultiThreaded(cons
         streamExecutorConfig._threads ? streamExecutorConfig._threads : (envThreads ? envThreads : hwCores);
     streamExecutorConfig._threadsPerStream =
         streamExecutorConfig._streams ? std::max(1, threads / streamExecutorConfig._streams) : threads;
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    // the throughput case on hybrid processors: the streams landed on the Little cores get more threads,
+    // so a request takes roughly the same time on any stream and the Little core streams are not stragglers
+    if (ThreadBindingType::HYBRID_AWARE == streamExecutorConfig._threadBindingType &&
+        IStreamsExecutor::Config::PreferredCoreType::ROUND_ROBIN == streamExecutorConfig._threadPreferredCoreType &&
+        0 == streamExecutorConfig._littleCoreThreadsPerStream && 0 == envThreads) {
+        const auto core_types = custom::info::core_types();
+        if (core_types.size() > 1) {
+            const int num_little_cores =
+                custom::info::default_concurrency(custom::task_arena::constraints{}.set_core_type(core_types.front()));
+            // hyper-threads of the Big cores are roughly twice slower than the physical cores
+            const bool hyper_threading = threads > getNumberOfCPUCores();
+            const int ratio = (fp_intesive ? fp32_threshold : int8_threshold) / (hyper_threading ? 2 : 1);
+            streamExecutorConfig._littleCoreThreadsPerStream =
+                std::max(1, std::min(num_little_cores, streamExecutorConfig._threadsPerStream * ratio));
+        }
+    }
+#endif
     return streamExecutorConfig;
 }
 
@@ -11,6 +11,10 @@
 
 namespace InferenceEngine {
 
+void ITaskExecutor::runWithPriority(Task task, int) {
+    run(std::move(task));
+}
+
 void ITaskExecutor::runAndWait(const std::vector<Task>& tasks) {
     std::vector<std::packaged_task<void()>> packagedTasks;
     std::vector<std::future<void>> futures;
@@ -4,10 +4,16 @@
 
 #include "threading/ie_thread_affinity.hpp"
 
+#include <algorithm>
 #include <cerrno>
 #include <climits>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "ie_system_conf.h"
 
@@ -75,6 +81,127 @@ bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSe
     return res;
 }
 
+namespace {
+// parses the sysfs lists like "0-3,8,10-11"
+std::vector<int> ReadCpuList(const std::string& path) {
+    std::vector<int> cpus;
+    std::ifstream file{path};
+    std::string range;
+    while (std::getline(file, range, ',')) {
+        int first = 0, last = 0;
+        char dash = 0;
+        std::istringstream stream{range};
+        if (!(stream >> first))
+            break;
+        last = (stream >> dash >> last) ? last : first;
+        for (int cpu = first; cpu <= last; cpu++)
+            cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+// the lowest logical CPU of the group of the last level cache
+int GetLastLevelCacheId(int cpu) {
+    const auto cacheDir = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cache/index";
+    int maxLevel = -1;
+    int cacheId = -1;
+    for (int index = 0;; index++) {
+        std::ifstream levelFile{cacheDir + std::to_string(index) + "/level"};
+        int level = 0;
+        if (!(levelFile >> level))
+            break;
+        const auto shared = ReadCpuList(cacheDir + std::to_string(index) + "/shared_cpu_list");
+        if (level > maxLevel && !shared.empty()) {
+            maxLevel = level;
+            cacheId = *std::min_element(shared.begin(), shared.end());
+        }
+    }
+    return cacheId;
+}
+
+struct Core {
+    int cacheId;
+    std::vector<int> cpus;  // the SMT siblings available to the process
+};
+}  // namespace
+
+std::tuple<CpuSet, int> GetStreamCacheMask(int streamId, int threadsPerStream, bool useSmtSiblings) {
+    int ncpus = 0;
+    CpuSet processMask;
+    std::tie(processMask, ncpus) = GetProcessMask();
+    if (nullptr == processMask)
+        return std::make_tuple(nullptr, 0);
+    const size_t size = CPU_ALLOC_SIZE(ncpus);
+
+    // cores ordered by the cache groups, keyed by the cache group and the first sibling
+    std::map<std::pair<int, int>, Core> coresMap;
+    for (int cpu = 0; cpu < ncpus; cpu++) {
+        if (!CPU_ISSET_S(cpu, size, processMask.get()))
+            continue;
+        const auto cacheId = GetLastLevelCacheId(cpu);
+        const auto siblings =
+            ReadCpuList("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/thread_siblings_list");
+        if (cacheId < 0 || siblings.empty())
+            return std::make_tuple(nullptr, 0);
+        auto& core = coresMap[{cacheId, *std::min_element(siblings.begin(), siblings.end())}];
+        core.cacheId = cacheId;
+        core.cpus.push_back(cpu);
+    }
+    if (coresMap.empty())
+        return std::make_tuple(nullptr, 0);
+    std::vector<Core> cores;
+    std::map<int, int> groupCapacity;
+    for (auto&& item : coresMap) {
+        if (!useSmtSiblings)
+            item.second.cpus.resize(1);
+        groupCapacity[item.second.cacheId] += static_cast<int>(item.second.cpus.size());
+        cores.emplace_back(std::move(item.second));
+    }
+    int maxGroupCapacity = 0, totalCapacity = 0;
+    for (auto&& group : groupCapacity) {
+        maxGroupCapacity = std::max(maxGroupCapacity, group.second);
+        totalCapacity += group.second;
+    }
+    auto restOfGroup = [&](size_t pos) {
+        int rest = 0;
+        for (auto i = pos; i < cores.size() && cores[i].cacheId == cores[pos].cacheId; i++)
+            rest += static_cast<int>(cores[i].cpus.size());
+        return rest;
+    };
+
+    // the streams are placed one after another, so the previous ones define where the requested stream begins
+    std::vector<int> streamCpus;
+    size_t pos = 0;
+    for (int stream = 0; stream <= streamId; stream++) {
+        if (pos == cores.size())
+            pos = 0;
+        const bool wholeGroup = 0 == threadsPerStream;
+        const int need = std::min(totalCapacity, wholeGroup ? groupCapacity[cores[pos].cacheId] : threadsPerStream);
+        // the stream which fits a cache group doesn't start in the middle of a group lacking the room for it
+        if (need > restOfGroup(pos) && need <= maxGroupCapacity) {
+            const auto cacheId = cores[pos].cacheId;
+            while (pos < cores.size() && cores[pos].cacheId == cacheId)
+                pos++;
+            if (pos == cores.size())
+                pos = 0;
+        }
+        streamCpus.clear();
+        while (static_cast<int>(streamCpus.size()) < need) {
+            if (pos == cores.size())
+                pos = 0;
+            const auto& cpus = cores[pos++].cpus;
+            const auto count = std::min(cpus.size(), static_cast<size_t>(need) - streamCpus.size());
+            streamCpus.insert(streamCpus.end(), cpus.begin(), cpus.begin() + count);
+        }
+    }
+
+    CpuSet streamMask{CPU_ALLOC(ncpus)};
+    CPU_ZERO_S(size, streamMask.get());
+    for (auto cpu : streamCpus)
+        CPU_SET_S(cpu, size, streamMask.get());
+    return std::make_tuple(std::move(streamMask), ncpus);
+}
+
 bool PinCurrentThreadToSocket(int socket) {
     const int sockets = InferenceEngine::getAvailableNUMANodes().size();
     const int cores = InferenceEngine::getNumberOfCPUCores();
@@ -110,6 +237,9 @@ bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSe
 bool PinCurrentThreadByMask(int ncores, const CpuSet& procMask) {
     return false;
 }
+std::tuple<CpuSet, int> GetStreamCacheMask(int streamId, int threadsPerStream, bool useSmtSiblings) {
+    return std::make_tuple(nullptr, 0);
+}
 bool PinCurrentThreadToSocket(int socket) {
     return false;
 }
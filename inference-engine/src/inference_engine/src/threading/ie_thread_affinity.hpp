@@ -77,6 +77,19 @@ bool PinThreadToVacantCore(int thrIdx, int hyperThreads, int ncores, const CpuSe
  */
 bool PinCurrentThreadByMask(int ncores, const CpuSet& processMask);
 
+/**
+ * @brief      Returns the mask of the logical CPUs for the threads of a stream placed on the cores which share the last
+ *             level cache (e.g. a CCX of AMD EPYC). The streams are placed one by one, so a stream spans several
+ *             cache groups only if it needs more CPUs than a group has.
+ * @ingroup    ie_dev_api_threading
+ *
+ * @param[in]  streamId          The stream index
+ * @param[in]  threadsPerStream  The number of threads of a stream, zero means the whole cache group
+ * @param[in]  useSmtSiblings    The threads of a stream run on the SMT siblings of its cores as well
+ * @return     The mask and its size (as GetProcessMask), or `nullptr` if the cache topology is not available
+ */
+std::tuple<CpuSet, int> GetStreamCacheMask(int streamId, int threadsPerStream, bool useSmtSiblings);
+
 /**
  * @brief      Pins a current thread to a socket.
  * @ingroup    ie_dev_api_threading
@@ -8,6 +8,7 @@
 #include <unordered_set>
 #include <regex>
 #include <sstream>
+#include <exception>
 
 #include <cnn_network_ngraph_impl.hpp>
 #include "ngraph_ops/convolution_ie.hpp"
@@ -54,6 +55,7 @@
 #include "legacy/graph_tools.hpp"
 #include "legacy/net_pass.h"
 #include "ie_legacy_itt.hpp"
+#include "ie_parallel.hpp"
 
 namespace Builder {
 
@@ -332,12 +334,6 @@ public:
         params[name] = value.get() ? "true" : "false";
     }
 
-    void addSpecificCreator(const std::vector<std::string>& forTypes, const CreatorFor& creator) {
-        for (const auto type : forTypes) {
-            creators[type] = creator;
-        }
-    }
-
     void on_adapter(const std::string& name, ::ngraph::ValueAccessor<std::string>& adapter) override {
         std::string data = adapter.get();
         std::transform(data.begin(), data.end(), data.begin(), [](unsigned char c) {
@@ -391,9 +387,33 @@ public:
     void on_adapter(const std::string& name, ::ngraph::ValueAccessor<void>& adapter) override;
 
 private:
+    /**
+     * @brief The creators don't depend on the converted node, so the table is built once
+     * and shared by all the visitors instead of being filled for every node of the function
+     */
+    class Creators {
+    public:
+        Creators();
+
+        const CreatorFor* find(const std::string& type) const {
+            auto found = creators.find(type);
+            return found == creators.end() ? nullptr : &found->second;
+        }
+
+    private:
+        void addSpecificCreator(const std::vector<std::string>& forTypes, const CreatorFor& creator) {
+            for (const auto& type : forTypes) {
+                creators[type] = creator;
+            }
+        }
+
+        std::map<std::string, CreatorFor> creators;
+    };
+
+    static const Creators& getCreators();
+
     std::shared_ptr<::ngraph::Node> node;
     std::map<std::string, std::string> params;
-    std::map<std::string, CreatorFor> creators;
 };
 
 void InferenceEngine::details::CNNLayerCreator::on_adapter(const std::string& name,
@@ -442,7 +462,14 @@ void InferenceEngine::details::CNNLayerCreator::on_adapter(const std::string& na
     }
 }
 
-InferenceEngine::details::CNNLayerCreator::CNNLayerCreator(const std::shared_ptr<::ngraph::Node>& node): node(node) {
+InferenceEngine::details::CNNLayerCreator::CNNLayerCreator(const std::shared_ptr<::ngraph::Node>& node): node(node) {}
+
+const InferenceEngine::details::CNNLayerCreator::Creators& InferenceEngine::details::CNNLayerCreator::getCreators() {
+    static const Creators creators;
+    return creators;
+}
+
+InferenceEngine::details::CNNLayerCreator::Creators::Creators() {
     addSpecificCreator({"Parameter"}, [](const std::shared_ptr<::ngraph::Node>& node,
                                          const std::map<std::string, std::string>& params) -> CNNLayerPtr {
         LayerParams attrs = {node->get_friendly_name(), "Input",
@@ -1779,8 +1806,8 @@ InferenceEngine::details::CNNLayerCreator::CNNLayerCreator(const std::shared_ptr
 CNNLayerPtr InferenceEngine::details::CNNLayerCreator::create() {
     LayerParams attrs = {node->get_friendly_name(), node->description(),
                          details::convertPrecision(node->get_output_element_type(0))};
-    if (creators.find(node->description()) != creators.end())
-        return creators[node->description()](node, params);
+    if (auto creator = getCreators().find(node->description()))
+        return (*creator)(node, params);
 
     auto res = std::make_shared<CNNLayer>(attrs);
     res->params = params;
@@ -1970,38 +1997,58 @@ void convertFunctionToICNNNetwork(const std::shared_ptr<const ::ngraph::Function
         unique_names[node->get_friendly_name()] = node;
     }
 
-    // Create layers and output data
-    for (const auto &layer : nodes) {
-        if (isInternalLayer(layer, keep_constants)) continue;
-
-        // TODO: remove this rt info when all blobs will be inputs
-        auto &rt_info = layer->get_rt_info();
-        rt_info["keep_constants"] = std::make_shared<::ngraph::VariantWrapper<int64_t>> (keep_constants);
-
-        CNNLayerPtr cnnLayer = createCNNLayer(layer);
-
-        // Set originalLayersNames from FusedNames
-        std::string originalNames = ngraph::getFusedNames(layer);
-        if (!originalNames.empty()) {
-            cnnLayer->params[ExecGraphInfoSerialization::ORIGINAL_NAMES] = originalNames;
-        }
+    // Create layers. The nodes are converted independently: the creators read only their own node and
+    // share the data of the constants, so the layers of the large functions are created in parallel
+    std::vector<CNNLayerPtr> cnnLayers(nodes.size());
+    std::vector<std::exception_ptr> conversionErrors(nodes.size());
+    parallel_for(nodes.size(), [&](size_t idx) {
+        const auto &layer = nodes[idx];
+        if (isInternalLayer(layer, keep_constants)) return;
+
+        try {
+            // TODO: remove this rt info when all blobs will be inputs
+            auto &rt_info = layer->get_rt_info();
+            rt_info["keep_constants"] = std::make_shared<::ngraph::VariantWrapper<int64_t>> (keep_constants);
+
+            CNNLayerPtr cnnLayer = createCNNLayer(layer);
+
+            // Set originalLayersNames from FusedNames
+            std::string originalNames = ngraph::getFusedNames(layer);
+            if (!originalNames.empty()) {
+                cnnLayer->params[ExecGraphInfoSerialization::ORIGINAL_NAMES] = originalNames;
+            }
 
-        std::string primitivesPriority = ov::getPrimitivesPriority(layer);
-        if (!primitivesPriority.empty()) {
-            cnnLayer->params["PrimitivesPriority"] = primitivesPriority;
-        }
+            std::string primitivesPriority = ov::getPrimitivesPriority(layer);
+            if (!primitivesPriority.empty()) {
+                cnnLayer->params["PrimitivesPriority"] = primitivesPriority;
+            }
 
-        // Copy runtime info attributes from Nodes to CNNLayers if they have VariantWrapper<std::string> type
-        using VariantString = ::ngraph::VariantWrapper<std::string>;
-        for (const auto &rt : rt_info) {
-            if (auto str_attr = std::dynamic_pointer_cast<VariantString>(rt.second)) {
-                if (details::CaselessEq<std::string>()(rt.first, "affinity")) {
-                    cnnLayer->affinity = str_attr->get();
-                } else {
-                    cnnLayer->params[rt.first] = str_attr->get();
+            // Copy runtime info attributes from Nodes to CNNLayers if they have VariantWrapper<std::string> type
+            using VariantString = ::ngraph::VariantWrapper<std::string>;
+            for (const auto &rt : rt_info) {
+                if (auto str_attr = std::dynamic_pointer_cast<VariantString>(rt.second)) {
+                    if (details::CaselessEq<std::string>()(rt.first, "affinity")) {
+                        cnnLayer->affinity = str_attr->get();
+                    } else {
+                        cnnLayer->params[rt.first] = str_attr->get();
+                    }
                 }
             }
+            cnnLayers[idx] = cnnLayer;
+        } catch (...) {
+            conversionErrors[idx] = std::current_exception();
         }
+    });
+    // report the error of the first node in the order as the sequential conversion does
+    for (const auto &error : conversionErrors) {
+        if (error) std::rethrow_exception(error);
+    }
+
+    // Create output data
+    for (size_t idx = 0; idx < nodes.size(); idx++) {
+        const auto &layer = nodes[idx];
+        const CNNLayerPtr &cnnLayer = cnnLayers[idx];
+        if (!cnnLayer) continue;
 
         size_t inputCount(0);
         for (size_t i = 0; i < layer->get_input_size(); i++) {
@@ -167,6 +167,19 @@ MarkupOptimizations::MarkupOptimizations(
     quantizationRestrictions(quantizationRestrictions) {}
 
 bool ngraph::pass::low_precision::MarkupOptimizations::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::LPT_LT, "MarkupOptimizations");
+
+    // one traversal instead of has_op_with_type call per operation type
+    bool hasAvgPool = false;
+    bool hasConcat = false;
+    for (const auto& node : f->get_ops()) {
+        hasAvgPool = hasAvgPool || is_type<ngraph::opset1::AvgPool>(node);
+        hasConcat = hasConcat || is_type<ngraph::opset1::Concat>(node);
+        if (hasAvgPool && hasConcat) {
+            break;
+        }
+    }
+
     ngraph::pass::Manager markup(get_pass_config());
     markup.set_per_pass_validation(false);
     markup.register_pass<low_precision::MarkupCanBeQuantized>();
@@ -176,11 +189,11 @@ bool ngraph::pass::low_precision::MarkupOptimizations::run_on_function(std::shar
     if (!quantizationRestrictions.empty()) {
         markup.register_pass<low_precision::MarkupPerTensorQuantization>(quantizationRestrictions);
     }
-    if (ngraph::op::util::has_op_with_type<ngraph::opset1::AvgPool>(f)) {
+    if (hasAvgPool) {
         markup.register_pass<low_precision::MarkupAvgPoolPrecisionPreserved>();
     }
     markup.register_pass<low_precision::PropagatePrecisions>();
-    if (ngraph::op::util::has_op_with_type<ngraph::opset1::Concat>(f)) {
+    if (hasConcat) {
         markup.register_pass<low_precision::AlignQuantizationIntervals>();
         markup.register_pass<low_precision::AlignQuantizationParameters>();
     }
@@ -195,6 +208,7 @@ bool ngraph::pass::low_precision::LowPrecision::run_on_function(std::shared_ptr<
     ngraph::pass::Manager manager(passConfig);
 
     auto prerequisites = manager.register_pass<ngraph::pass::GraphRewrite>();
+    prerequisites->set_name("LPT_Prerequisites");
     const std::vector<ngraph::element::Type> supportedTypes = {ngraph::element::i8, ngraph::element::u8};
     prerequisites->add_matcher<PullReshapeThroughDequantization>(supportedTypes);
     prerequisites->add_matcher<PullTransposeThroughDequantization>(supportedTypes);
@@ -206,6 +220,7 @@ bool ngraph::pass::low_precision::LowPrecision::run_on_function(std::shared_ptr<
     manager.register_pass<ngraph::pass::low_precision::MarkupOptimizations>(precisionRestrictions, quantizationRestrictions);
 
     std::shared_ptr<ngraph::pass::GraphRewrite> common = manager.register_pass<ngraph::pass::GraphRewrite>();
+    common->set_name("LPT_Common");
     common->add_matcher<ngraph::pass::low_precision::AddTransformation>(params);
     common->add_matcher<ngraph::pass::low_precision::AvgPoolTransformation>(params);
     common->add_matcher<ngraph::pass::low_precision::ClampTransformation>(params);
@@ -239,6 +254,7 @@ bool ngraph::pass::low_precision::LowPrecision::run_on_function(std::shared_ptr<
     common->add_matcher<ngraph::pass::low_precision::VariadicSplitTransformation>(params);
 
     std::shared_ptr<ngraph::pass::GraphRewrite> cleanup = manager.register_pass<ngraph::pass::GraphRewrite>();
+    cleanup->set_name("LPT_Cleanup");
     cleanup->add_matcher<ngraph::pass::low_precision::FoldConvertTransformation>(params);
     cleanup->add_matcher<ngraph::pass::low_precision::FuseConvertTransformation>(params);
     cleanup->add_matcher<ngraph::pass::low_precision::FuseSubtractToFakeQuantizeTransformation>(params);
@@ -290,13 +306,9 @@ bool ngraph::pass::low_precision::LowPrecision::isFQLevelsPresent(
         const std::set<size_t>& levels) {
     std::vector<std::shared_ptr<ngraph::Node>> nodes = function->get_ops();
     for (auto& node : nodes) {
-        for (size_t i = 0; i < node->inputs().size(); ++i) {
-            const auto fakeQuantize = as_type_ptr<ngraph::opset1::FakeQuantize>(node);
-            if (fakeQuantize != nullptr) {
-                if (levels.count(fakeQuantize->get_levels()) == 1) {
-                    return true;
-                }
-            }
+        const auto fakeQuantize = as_type_ptr<ngraph::opset1::FakeQuantize>(node);
+        if ((fakeQuantize != nullptr) && (levels.count(fakeQuantize->get_levels()) == 1)) {
+            return true;
         }
     }
     return false;
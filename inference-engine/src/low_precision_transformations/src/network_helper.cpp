@@ -79,6 +79,8 @@ bool NetworkHelper::isConstantPath(const std::shared_ptr<Node>& op) {
         return false;
     }
 
+    // each parent is handled once: without it branches which join again are walked once per path
+    std::unordered_set<Node*> visited;
     std::queue<Input<Node>> inputs;
     const std::vector<Input<Node>> nodeInputs = op->inputs();
     for (const Input<Node>& nodeInput : nodeInputs) {
@@ -91,6 +93,9 @@ bool NetworkHelper::isConstantPath(const std::shared_ptr<Node>& op) {
 
         const Output<Node>& sourceOutput = input.get_source_output();
         const auto parentNode = sourceOutput.get_node_shared_ptr();
+        if (!visited.insert(parentNode.get()).second) {
+            continue;
+        }
         if (isNotConstantPathOperation(parentNode)) {
             return false;
         }
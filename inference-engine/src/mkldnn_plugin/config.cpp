@@ -3,12 +3,15 @@
 //
 
 #include "config.h"
+#include "mkldnn_shape_buckets.h"
 
 #include <string>
 #include <map>
 #include <algorithm>
+#include <sstream>
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "ie_common.h"
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
@@ -93,6 +96,139 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             IE_SUPPRESS_DEPRECATED_END
             // empty string means that dumping is switched off
             dumpToDot = val;
+        } else if (key == CPUConfigParams::KEY_CPU_WEIGHTS_CACHE_DIR) {
+            // empty string means that persistent weights cache is switched off
+            weightsCacheDir = val;
+        } else if (key == CPUConfigParams::KEY_CPU_TUNING_CACHE_FILE) {
+            // empty string means that the measured selection of implementations is switched off
+            tuningCacheFile = val;
+        } else if (key == CPUConfigParams::KEY_CPU_NUMA_WEIGHTS_REPLICATION) {
+            if (val == PluginConfigParams::YES)
+                numaWeightsReplication = true;
+            else if (val == PluginConfigParams::NO)
+                numaWeightsReplication = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_NUMA_WEIGHTS_REPLICATION
+                           << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_MEMORY_SOLVER) {
+            if (val == CPUConfigParams::CPU_MEMORY_SOLVER_GREEDY)
+                memorySolverMode = MemorySolverMode::Greedy;
+            else if (val == CPUConfigParams::CPU_MEMORY_SOLVER_BEST_FIT)
+                memorySolverMode = MemorySolverMode::BestFit;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_MEMORY_SOLVER
+                    << ". Expected only " << CPUConfigParams::CPU_MEMORY_SOLVER_GREEDY << "/"
+                    << CPUConfigParams::CPU_MEMORY_SOLVER_BEST_FIT;
+        } else if (key == CPUConfigParams::KEY_CPU_HUGE_PAGES) {
+            if (val == CPUConfigParams::CPU_HUGE_PAGES_NONE)
+                hugePagesMode = HugePagesMode::None;
+            else if (val == CPUConfigParams::CPU_HUGE_PAGES_TRANSPARENT)
+                hugePagesMode = HugePagesMode::Transparent;
+            else if (val == CPUConfigParams::CPU_HUGE_PAGES_EXPLICIT)
+                hugePagesMode = HugePagesMode::Explicit;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_HUGE_PAGES
+                    << ". Expected only " << CPUConfigParams::CPU_HUGE_PAGES_NONE << "/"
+                    << CPUConfigParams::CPU_HUGE_PAGES_TRANSPARENT << "/" << CPUConfigParams::CPU_HUGE_PAGES_EXPLICIT;
+        } else if (key == CPUConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY
+                           << ". Expected only non negative integer values";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY
+                           << ". Expected only non negative integer values";
+            runtimeCacheCapacity = val_i;
+        } else if (key == CPUConfigParams::KEY_CPU_FUSION_COST_MODEL) {
+            if (val == CPUConfigParams::CPU_FUSION_COST_MODEL_NONE)
+                fusionCostModel = FusionCostModel::NoCostModel;
+            else if (val == CPUConfigParams::CPU_FUSION_COST_MODEL_ANALYTIC)
+                fusionCostModel = FusionCostModel::Analytic;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_FUSION_COST_MODEL
+                    << ". Expected only " << CPUConfigParams::CPU_FUSION_COST_MODEL_NONE << "/"
+                    << CPUConfigParams::CPU_FUSION_COST_MODEL_ANALYTIC;
+        } else if (key == CPUConfigParams::KEY_CPU_SHARED_STREAMS) {
+            if (val == PluginConfigParams::YES)
+                sharedStreams = true;
+            else if (val == PluginConfigParams::NO)
+                sharedStreams = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SHARED_STREAMS
+                           << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_BRANCH_PARALLELISM) {
+            if (val == PluginConfigParams::YES)
+                branchParallelism = true;
+            else if (val == PluginConfigParams::NO)
+                branchParallelism = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_BRANCH_PARALLELISM
+                           << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_FAST_MATH) {
+            if (val == PluginConfigParams::YES)
+                fastMath = true;
+            else if (val == PluginConfigParams::NO)
+                fastMath = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_FAST_MATH
+                           << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_EXTERNAL_THREADING) {
+            if (val == PluginConfigParams::YES)
+                externalThreading = true;
+            else if (val == PluginConfigParams::NO)
+                externalThreading = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_EXTERNAL_THREADING
+                           << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_BF16_FP32_NODES) {
+            std::set<std::string> nodes;
+            if (!val.empty()) {
+                std::stringstream stream(val);
+                std::string item;
+                while (std::getline(stream, item, ',')) {
+                    if (item.empty())
+                        IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_BF16_FP32_NODES
+                                   << ". Expected comma separated list of operation types or layer names";
+                    nodes.insert(item);
+                }
+                if (val.back() == ',')
+                    IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_BF16_FP32_NODES
+                               << ". Expected comma separated list of operation types or layer names";
+            }
+            bf16Fp32Nodes = val;
+            bf16Fp32NodesSet = std::move(nodes);
+        } else if (key == CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_RATE) {
+            float val_f = -1.f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_RATE
+                           << ". Expected only float numbers in the range [0, 1]";
+            }
+            if (val_f < 0.f || val_f > 1.f)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_RATE
+                           << ". Expected only float numbers in the range [0, 1]";
+            sparseWeightsRate = val_f;
+        } else if (key == CPUConfigParams::KEY_CPU_PERF_COUNT_SAMPLING) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PERF_COUNT_SAMPLING
+                           << ". Expected only non negative integer values";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PERF_COUNT_SAMPLING
+                           << ". Expected only non negative integer values";
+            perfCountSampling = val_i;
+        } else if (key == CPUConfigParams::KEY_CPU_SHAPE_BUCKETS) {
+            // empty string means that buckets are switched off
+            if (!val.empty())
+                parseShapeBuckets(val);
+            shapeBuckets = val;
         } else if (key.compare(PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE) == 0) {
             if (val == PluginConfigParams::NO)
                 lpTransformsMode = LPTransformsMode::Off;
@@ -140,6 +276,9 @@ void Config::updateProperties() {
             case IStreamsExecutor::ThreadBindingType::HYBRID_AWARE:
                 _config.insert({ PluginConfigParams::KEY_CPU_BIND_THREAD, PluginConfigParams::HYBRID_AWARE });
             break;
+            case IStreamsExecutor::ThreadBindingType::CACHE_AWARE:
+                _config.insert({ PluginConfigParams::KEY_CPU_BIND_THREAD, PluginConfigParams::CACHE_AWARE });
+            break;
         }
         if (collectPerfCounters == true)
             _config.insert({ PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES });
@@ -160,6 +299,33 @@ void Config::updateProperties() {
         IE_SUPPRESS_DEPRECATED_START
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
         IE_SUPPRESS_DEPRECATED_END
+        _config.insert({ CPUConfigParams::KEY_CPU_WEIGHTS_CACHE_DIR, weightsCacheDir });
+        _config.insert({ CPUConfigParams::KEY_CPU_TUNING_CACHE_FILE, tuningCacheFile });
+        _config.insert({ CPUConfigParams::KEY_CPU_NUMA_WEIGHTS_REPLICATION,
+                         numaWeightsReplication ? PluginConfigParams::YES : PluginConfigParams::NO });
+        if (memorySolverMode == MemorySolverMode::BestFit)
+            _config.insert({ CPUConfigParams::KEY_CPU_MEMORY_SOLVER, CPUConfigParams::CPU_MEMORY_SOLVER_BEST_FIT });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_MEMORY_SOLVER, CPUConfigParams::CPU_MEMORY_SOLVER_GREEDY });
+        _config.insert({ CPUConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY, std::to_string(runtimeCacheCapacity) });
+        if (hugePagesMode == HugePagesMode::Transparent)
+            _config.insert({ CPUConfigParams::KEY_CPU_HUGE_PAGES, CPUConfigParams::CPU_HUGE_PAGES_TRANSPARENT });
+        else if (hugePagesMode == HugePagesMode::Explicit)
+            _config.insert({ CPUConfigParams::KEY_CPU_HUGE_PAGES, CPUConfigParams::CPU_HUGE_PAGES_EXPLICIT });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_HUGE_PAGES, CPUConfigParams::CPU_HUGE_PAGES_NONE });
+        if (fusionCostModel == FusionCostModel::Analytic)
+            _config.insert({ CPUConfigParams::KEY_CPU_FUSION_COST_MODEL, CPUConfigParams::CPU_FUSION_COST_MODEL_ANALYTIC });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_FUSION_COST_MODEL, CPUConfigParams::CPU_FUSION_COST_MODEL_NONE });
+        _config.insert({ CPUConfigParams::KEY_CPU_SHARED_STREAMS, sharedStreams ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ CPUConfigParams::KEY_CPU_PERF_COUNT_SAMPLING, std::to_string(perfCountSampling) });
+        _config.insert({ CPUConfigParams::KEY_CPU_SHAPE_BUCKETS, shapeBuckets });
+        _config.insert({ CPUConfigParams::KEY_CPU_BRANCH_PARALLELISM, branchParallelism ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ CPUConfigParams::KEY_CPU_FAST_MATH, fastMath ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ CPUConfigParams::KEY_CPU_EXTERNAL_THREADING, externalThreading ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ CPUConfigParams::KEY_CPU_BF16_FP32_NODES, bf16Fp32Nodes });
+        _config.insert({ CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_RATE, std::to_string(sparseWeightsRate) });
         if (enforceBF16)
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
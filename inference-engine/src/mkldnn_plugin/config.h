@@ -7,9 +7,11 @@
 #include <threading/ie_istreams_executor.hpp>
 #include <ie_performance_hints.hpp>
 #include "utils/debug_capabilities.h"
+#include "utils/huge_pages.h"
 
 #include <string>
 #include <map>
+#include <set>
 
 namespace MKLDNNPlugin {
 
@@ -21,11 +23,37 @@ struct Config {
         On,
     };
 
+    enum MemorySolverMode {
+        Greedy,
+        BestFit,
+    };
+
+    enum FusionCostModel {
+        NoCostModel,
+        Analytic,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
+    std::string weightsCacheDir = "";
+    std::string tuningCacheFile = "";
+    bool numaWeightsReplication = true;
+    MemorySolverMode memorySolverMode = MemorySolverMode::Greedy;
+    int runtimeCacheCapacity = 5000;
+    FusionCostModel fusionCostModel = FusionCostModel::NoCostModel;
+    bool sharedStreams = false;
+    int perfCountSampling = 0;
+    std::string shapeBuckets = "";
+    bool branchParallelism = false;
+    bool fastMath = false;
+    bool externalThreading = false;
+    std::string bf16Fp32Nodes = "";
+    std::set<std::string> bf16Fp32NodesSet;
+    float sparseWeightsRate = 1.f;
     int batchLimit = 0;
+    HugePagesMode hugePagesMode = HugePagesMode::None;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
@@ -101,6 +101,7 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "Assign", MemoryOutput },  // for construction from layer ctor
         { "Convert", Convert },
         { "MVN", MVN},
+        { "RMSNorm", MVN},
         { "NormalizeL2", NormalizeL2},
         { "ScatterUpdate", ScatterUpdate},
         { "ScatterElementsUpdate", ScatterElementsUpdate},
@@ -179,6 +180,8 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "NonMaxSuppressionIEInternal", NonMaxSuppression},
         { "MatrixNms", MatrixNms},
         { "MulticlassNms", MulticlassNms},
+        { "ScaledAttentionCPU", ScaledAttention},
+        { "YoloDetectionCPU", YoloDetection},
         { "Reference", Reference},
 };
 
@@ -355,6 +358,10 @@ std::string NameFromType(const Type type) {
             return "MatrixNms";
         case MulticlassNms:
             return "MulticlassNms";
+        case ScaledAttention:
+            return "ScaledAttention";
+        case YoloDetection:
+            return "YoloDetection";
         case Reference:
             return "Reference";
         default:
@@ -97,7 +97,9 @@ enum Type {
     ExtractImagePatches,
     NonMaxSuppression,
     MatrixNms,
-    MulticlassNms
+    MulticlassNms,
+    ScaledAttention,
+    YoloDetection
 };
 
 enum Algorithm {
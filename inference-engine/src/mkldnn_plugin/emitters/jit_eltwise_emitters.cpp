@@ -1784,4 +1784,183 @@ size_t jit_erf_emitter::aux_vecs_count() const {
     return 5ul;
 }
 
+/// FAST MATH ///
+jit_fast_math_emitter::jit_fast_math_emitter(jit_generator *host, cpu_isa_t host_isa, const MKLDNNNode* node, Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {
+    const MKLDNNEltwiseNode *eltwiseNode = dynamic_cast<const MKLDNNEltwiseNode *>(node);
+    if (eltwiseNode == nullptr) {
+        IE_THROW() << "Can't cast to MKLDNNEltwiseNode";
+    }
+    algorithm = eltwiseNode->getAlgorithm();
+    alpha = eltwiseNode->getAlpha();
+
+    prepare_table();
+}
+
+size_t jit_fast_math_emitter::get_inputs_num() const { return 1; }
+
+bool jit_fast_math_emitter::is_supported(Algorithm algorithm) {
+    return one_of(algorithm, EltwiseExp, EltwiseSigmoid, EltwiseTanh, EltwiseSwish, EltwiseGelu);
+}
+
+void jit_fast_math_emitter::emit_impl(
+    const std::vector<size_t> &in_vec_idxs,
+    const std::vector<size_t> &out_vec_idxs,
+    const std::vector<size_t> &pool_vec_idxs,
+    const std::vector<size_t> &pool_gpr_idxs,
+    const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_vec_idxs, out_vec_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_fast_math_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src = Vmm(in_vec_idxs[0]);
+    Vmm vmm_dst = Vmm(out_vec_idxs[0]);
+
+    Vmm vmm_mask = Vmm(aux_vec_idxs[0]);
+    Vmm vmm_aux1 = Vmm(aux_vec_idxs[1]);
+    Vmm vmm_aux2 = Vmm(aux_vec_idxs[2]);
+    Vmm vmm_aux3 = Vmm(aux_vec_idxs[3]);
+
+    // vmm = exp(vmm), vmm_aux1 and vmm_aux2 are clobbered
+    auto exp_compute_vector_fwd = [&](const Vmm &vmm) {
+        // get mask of values lower than log(FLT_MIN) to zero them in the output
+        if (isa == cpu::x64::avx512_common) {
+            h->vcmpps(k_mask, vmm, table_val("exp_ln_flt_min_f"), _cmp_lt_os);
+        } else {
+            h->uni_vcmpps(vmm_mask, vmm, table_val("exp_ln_flt_min_f"), _cmp_lt_os);
+        }
+        h->uni_vminps(vmm, vmm, table_val("exp_ln_flt_max_f"));
+        h->uni_vmaxps(vmm, vmm, table_val("exp_ln_flt_min_f"));
+
+        // n = floorf(x * log2ef + 0.5)
+        const auto _op_floor = 1u;
+        h->uni_vmulps(vmm_aux1, vmm, table_val("exp_log2ef"));
+        h->uni_vaddps(vmm_aux1, vmm_aux1, table_val("half"));
+        h->uni_vroundps(vmm_aux1, vmm_aux1, _op_floor);
+
+        // r = x - n * ln2, the copy of n is used since sse41 fnmadd overwrites its second operand
+        h->uni_vmovups(vmm_aux2, vmm_aux1);
+        h->uni_vfnmadd231ps(vmm, vmm_aux2, table_val("ln2f"));
+
+        // 2^(n - 1), the polynomial is scaled by 2 to keep n = 128 representable
+        h->uni_vcvtps2dq(vmm_aux1, vmm_aux1);
+        h->uni_vpaddd(vmm_aux1, vmm_aux1, table_val("exponent_bias"));
+        const int n_mantissa_bits = 23;
+        h->uni_vpslld(vmm_aux1, vmm_aux1, n_mantissa_bits);
+
+        // set zeroes at those points which were < log(FLT_MIN)
+        h->uni_vpxor(vmm_aux2, vmm_aux2, vmm_aux2);
+        if (isa == cpu::x64::avx512_common) {
+            h->vblendmps(vmm_aux1 | k_mask, vmm_aux1, vmm_aux2);
+        } else {
+            h->uni_vblendvps(vmm_aux1, vmm_aux1, vmm_aux2, vmm_mask);
+        }
+
+        // 2 * exp(r) ~ p(r)
+        h->uni_vmovups(vmm_aux2, table_val("ex_pol3"));
+        h->uni_vfmadd213ps(vmm_aux2, vmm, table_val("ex_pol2"));
+        h->uni_vfmadd213ps(vmm_aux2, vmm, table_val("ex_pol1"));
+        h->uni_vfmadd213ps(vmm_aux2, vmm, table_val("ex_pol0"));
+        h->uni_vmulps(vmm, vmm_aux2, vmm_aux1);
+    };
+
+    // vmm = 1 / vmm, vmm_aux1 and vmm_aux2 are clobbered
+    auto rcp_compute_vector_fwd = [&](const Vmm &vmm) {
+        if (isa == cpu::x64::avx512_common) {
+            h->vrcp14ps(vmm_aux1, vmm);
+        } else if (isa == cpu::x64::avx2) {
+            h->vrcpps(vmm_aux1, vmm);
+        } else {
+            h->rcpps(vmm_aux1, vmm);
+        }
+        // one Newton-Raphson iteration: y = y + y * (1 - d * y)
+        h->uni_vmovups(vmm_aux2, table_val("one"));
+        h->uni_vfnmadd231ps(vmm_aux2, vmm, vmm_aux1);
+        h->uni_vfmadd213ps(vmm_aux2, vmm_aux1, vmm_aux1);
+        h->uni_vmovups(vmm, vmm_aux2);
+    };
+
+    // vmm = 1 / (1 + exp(-vmm))
+    auto sigmoid_compute_vector_fwd = [&](const Vmm &vmm) {
+        h->uni_vxorps(vmm, vmm, table_val("sign_mask"));
+        exp_compute_vector_fwd(vmm);
+        h->uni_vaddps(vmm, vmm, table_val("one"));
+        rcp_compute_vector_fwd(vmm);
+    };
+
+    // vmm_src is kept untouched until the result is stored, since it may share the register with vmm_dst
+    switch (algorithm) {
+        case EltwiseExp:
+            h->uni_vmovups(vmm_aux3, vmm_src);
+            exp_compute_vector_fwd(vmm_aux3);
+            h->uni_vmovups(vmm_dst, vmm_aux3);
+            break;
+        case EltwiseSigmoid:
+            h->uni_vmovups(vmm_aux3, vmm_src);
+            sigmoid_compute_vector_fwd(vmm_aux3);
+            h->uni_vmovups(vmm_dst, vmm_aux3);
+            break;
+        case EltwiseTanh:
+            // tanh(x) = 2 * sigmoid(2 * x) - 1
+            h->uni_vaddps(vmm_aux3, vmm_src, vmm_src);
+            sigmoid_compute_vector_fwd(vmm_aux3);
+            h->uni_vaddps(vmm_aux3, vmm_aux3, vmm_aux3);
+            h->uni_vsubps(vmm_dst, vmm_aux3, table_val("one"));
+            break;
+        case EltwiseSwish:
+            // swish(x) = x * sigmoid(alpha * x)
+            h->uni_vmulps(vmm_aux3, vmm_src, table_val("alpha"));
+            sigmoid_compute_vector_fwd(vmm_aux3);
+            h->uni_vmulps(vmm_dst, vmm_src, vmm_aux3);
+            break;
+        case EltwiseGelu:
+            // gelu(x) = 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3))) = x * sigmoid(x * (c1 + c2 * x^2))
+            h->uni_vmulps(vmm_aux3, vmm_src, vmm_src);
+            h->uni_vmulps(vmm_aux3, vmm_aux3, table_val("gelu_c2"));
+            h->uni_vaddps(vmm_aux3, vmm_aux3, table_val("gelu_c1"));
+            h->uni_vmulps(vmm_aux3, vmm_aux3, vmm_src);
+            sigmoid_compute_vector_fwd(vmm_aux3);
+            h->uni_vmulps(vmm_dst, vmm_src, vmm_aux3);
+            break;
+        default:
+            assert(!"unsupported algorithm");
+    }
+}
+
+void jit_fast_math_emitter::register_table_entries() {
+    push_arg_entry_of("sign_mask", 0x80000000, true);
+    push_arg_entry_of("one", 0x3f800000, true);
+    push_arg_entry_of("half", 0x3f000000, true);
+
+    // degree 3 minimax polynomial of 2 * exp(r) on [-ln2 / 2, ln2 / 2]
+    push_arg_entry_of("ex_pol0", 0x3ffffb49, true); // p0 = 1.99985611f
+    push_arg_entry_of("ex_pol1", 0x40000561, true); // p1 = 2.0003283f
+    push_arg_entry_of("ex_pol2", 0x3f814546, true); // p2 = 1.00992656f
+    push_arg_entry_of("ex_pol3", 0x3ea9a4fc, true); // p3 = 0.331336856f
+
+    push_arg_entry_of("exp_log2ef", 0x3fb8aa3b, true);
+    push_arg_entry_of("exp_ln_flt_max_f", 0x42b17218, true);
+    push_arg_entry_of("exp_ln_flt_min_f", 0xc2aeac50, true);
+    push_arg_entry_of("ln2f", 0x3f317218, true);
+    push_arg_entry_of("exponent_bias", 0x0000007e, true); // 127 - 1
+
+    push_arg_entry_of("gelu_c1", 0x3fcc422a, true); // c1 = 2 * sqrt(2 / pi)
+    push_arg_entry_of("gelu_c2", 0x3d922279, true); // c2 = c1 * 0.044715
+    push_arg_entry_of("alpha", cpu::x64::float2int(alpha), true);
+}
+
+size_t jit_fast_math_emitter::aux_vecs_count() const {
+    return 4ul;
+}
+
 } // namespace MKLDNNPlugin
@@ -548,4 +548,38 @@ private:
     size_t aux_vecs_count() const override;
 };
 
+/**
+ * Fast approximations of Exp, Sigmoid, Tanh, Swish and Gelu selected by CPUConfigParams::KEY_CPU_FAST_MATH.
+ * exp(x) = 2^n * p(r) with the degree 3 minimax polynomial p, max relative error 7.5e-5 (~630 ulp), the results
+ * below 2^-125 are flushed to zero. The reciprocals use rcpps refined by one Newton-Raphson iteration.
+ * Max absolute errors: sigmoid 1.9e-5, tanh 3.7e-5 (as 2 * sigmoid(2x) - 1), swish 1.7e-5, gelu 4.7e-4 (the tanh
+ * formula is used for both approximation modes, it alone deviates from the erf one by 4.7e-4)
+ */
+class jit_fast_math_emitter : public jit_emitter {
+public:
+    jit_fast_math_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const MKLDNNNode* node,
+                          InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
+
+    size_t get_inputs_num() const override;
+
+    static bool is_supported(Algorithm algorithm);
+
+private:
+    void emit_impl(
+        const std::vector<size_t> &in_vec_idxs,
+        const std::vector<size_t> &out_vec_idxs,
+        const std::vector<size_t> &pool_vec_idxs,
+        const std::vector<size_t> &pool_gpr_idxs,
+        const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const;
+
+    void register_table_entries() override;
+    size_t aux_vecs_count() const override;
+
+    Algorithm algorithm;
+    float alpha;
+};
+
 } // namespace MKLDNNPlugin
@@ -28,10 +28,13 @@ impl_desc_type MKLDNNPlugin::parse_impl_name(std::string impl_desc_name) {
     SEARCH_WORD_2(sse41, sse42);
     SEARCH_WORD(avx2);
     SEARCH_WORD(avx512);
+    SEARCH_WORD(amx);
     SEARCH_WORD(any);
     SEARCH_WORD(_1x1);
     SEARCH_WORD(_dw);
     SEARCH_WORD(reorder);
+    SEARCH_WORD(sparse);
+    SEARCH_WORD(compressed);
     if ((res & impl_desc_type::avx2) != impl_desc_type::avx2 &&
         (res & impl_desc_type::avx512) != impl_desc_type::avx512)
         SEARCH_WORD(avx);
@@ -44,6 +47,8 @@ impl_desc_type MKLDNNPlugin::parse_impl_name(std::string impl_desc_name) {
     SEARCH_WORD_2(nchw, ref);
     SEARCH_WORD_2(ncdhw, ref);
     SEARCH_WORD_2(wino, winograd);
+    // the brgemm based primitives are the jit ones tiled for the AMX and AVX512 registers
+    SEARCH_WORD_2(brg, jit);
 
 #undef SEARCH_WORD_2
 #undef SEARCH_WORD
@@ -59,6 +64,8 @@ const char* MKLDNNPlugin::impl_type_to_string(impl_desc_type type) {
     CASE(undef);
     CASE(ref_any);
     CASE(reorder);
+    CASE(sparse);
+    CASE(compressed);
     CASE(gemm_any);
     CASE(gemm_blas);
     CASE(gemm_avx512);
@@ -67,11 +74,13 @@ const char* MKLDNNPlugin::impl_type_to_string(impl_desc_type type) {
     CASE(gemm_sse42);
     CASE(jit_gemm);
     CASE(jit_avx512_winograd);
+    CASE(jit_avx512_amx);
     CASE(jit_avx512);
     CASE(jit_avx2);
     CASE(jit_avx);
     CASE(jit_sse42);
     CASE(jit_uni);
+    CASE(jit_avx512_amx_1x1);
     CASE(jit_avx512_1x1);
     CASE(jit_avx2_1x1);
     CASE(jit_avx_1x1);
@@ -31,6 +31,12 @@ enum impl_desc_type {
     reorder = 1<<19,
     // winograd
     winograd = 1<<20,
+    // Advanced Matrix Extensions tiles
+    amx = 1<<21,
+    // compressed sparse weights
+    sparse = 1<<22,
+    // i8/u8 weights converted by the kernel
+    compressed = 1<<23,
     // real types
     ref_any             = ref  | any,
 
@@ -44,12 +50,14 @@ enum impl_desc_type {
     jit_gemm            = jit | gemm,
 
     jit_avx512_winograd = jit  | avx512 | winograd,
+    jit_avx512_amx      = jit  | avx512 | amx,
     jit_avx512          = jit  | avx512,
     jit_avx2            = jit  | avx2,
     jit_avx             = jit  | avx,
     jit_sse42           = jit  | sse42,
     jit_uni             = jit  | uni,
 
+    jit_avx512_amx_1x1  = jit  | avx512 | amx | _1x1,
     jit_avx512_1x1      = jit  | avx512 | _1x1,
     jit_avx2_1x1        = jit  | avx2   | _1x1,
     jit_avx_1x1         = jit  | avx    | _1x1,
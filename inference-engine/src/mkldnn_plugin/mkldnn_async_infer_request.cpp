@@ -7,8 +7,10 @@
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
-                                                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
+                                                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor,
+                                                               bool directSyncInfer)
     : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
+    _directSyncInfer = directSyncInfer;
     static_cast<MKLDNNInferRequest*>(inferRequest.get())->SetAsyncRequest(this);
 }
 
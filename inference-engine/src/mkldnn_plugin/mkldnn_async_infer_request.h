@@ -15,7 +15,8 @@ class MKLDNNAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadS
 public:
     MKLDNNAsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr &inferRequest,
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
-                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
+                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
+                            bool directSyncInfer = false);
     ~MKLDNNAsyncInferRequest();
 };
 
@@ -187,6 +187,11 @@ std::string MKLDNNEdge::name() const {
     return  result.str();
 }
 
+std::string MKLDNNEdge::cacheKey() const {
+    const auto& desc = getDesc();
+    return name() + " " + desc.getShape().toString() + " " + desc.serializeFormat();
+}
+
 void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
     if (status != Status::NeedAllocation)
         return;
@@ -197,7 +202,7 @@ void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
             return memoryPtr;
         };
 
-        auto ptr = weightsCache->findOrCreate(name(), alloc, false);
+        auto ptr = weightsCache->findOrCreate(cacheKey(), alloc, false);
         memoryPtr = *ptr;
         useExternalMemory = true;
         status = Status::Allocated;
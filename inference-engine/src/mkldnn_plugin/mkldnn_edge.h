@@ -73,6 +73,9 @@ public:
 
 private:
     std::string name() const;
+    // the key of the edge memory in the weights cache, the same edge may have different descriptors in the networks
+    // compiled from the same model for different input shapes
+    std::string cacheKey() const;
 
     std::weak_ptr<MKLDNNNode> parent;
     std::weak_ptr<MKLDNNNode> child;
@@ -4,6 +4,7 @@
 
 #include <ie_metric_helpers.hpp>
 #include <precision_utils.h>
+#include "cpu/cpu_config.hpp"
 #include "mkldnn_exec_network.h"
 
 #include "mkldnn_async_infer_request.h"
@@ -18,6 +19,7 @@
 #include <threading/ie_tbb_streams_executor.hpp>
 #endif
 #include <threading/ie_cpu_streams_executor.hpp>
+#include <threading/ie_external_streams_executor.hpp>
 #include <ie_system_conf.h>
 #include <algorithm>
 #include <unordered_set>
@@ -67,9 +69,26 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
     }
 
-    if (cfg.exclusiveAsyncRequests) {
+    int sharedStreams = 0;
+    if (cfg.externalThreading) {
+        // no threads of its own: the requests run on the application executor or on the threads starting them
+        auto streamsExecutorConfig = _cfg.streamExecutorConfig;
+        streamsExecutorConfig._name = "CPUExternalStreamsExecutor";
+        _taskExecutor = std::make_shared<ExternalStreamsExecutor>(streamsExecutorConfig,
+                                                                  ExecutorManager::getInstance()->getExternalExecutor());
+    } else if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
+    } else if (cfg.sharedStreams) {
+        // the pool is sized for the whole machine by the first network and then is used by all networks as is
+        auto sharedConfig = _cfg.streamExecutorConfig;
+        sharedConfig._name = "CPUSharedStreamsExecutor";
+        sharedConfig._streams = IStreamsExecutor::Config::GetDefaultNumStreams();
+        sharedConfig._threads = 0;
+        sharedConfig._threadsPerStream = 0;
+        sharedConfig = IStreamsExecutor::Config::MakeDefaultMultiThreaded(sharedConfig, isFloatModel);
+        sharedStreams = sharedConfig._streams;
+        _taskExecutor = ExecutorManager::getInstance()->getSharedCPUStreamsExecutor(sharedConfig);
     } else {
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, isFloatModel);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
@@ -79,7 +98,10 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
 #endif
     }
-    if (0 != cfg.streamExecutorConfig._streams) {
+    if (cfg.externalThreading) {
+        // callbacks run on the thread completing the request, serialized to preserve legacy behaviour
+        _callbackExecutor = std::make_shared<ImmediateSerialExecutor>();
+    } else if (0 != cfg.streamExecutorConfig._streams || sharedStreams > 0) {
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         // There is no additional threads but we still need serialize callback execution to preserve legacy behaviour
         _callbackExecutor = std::make_shared<ImmediateSerialExecutor>();
@@ -91,18 +113,41 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         _callbackExecutor = _taskExecutor;
     }
 
-    int streams = std::max(1, _cfg.streamExecutorConfig._streams);
-    std::vector<Task> tasks; tasks.resize(streams);
-    _graphs.resize(streams);
-    if (_cfg.streamExecutorConfig._streams != 0) {
-        for (auto&& task : tasks) {
-            task = [this] {
-                MKLDNNExecNetwork::GetGraph();
-            };
-        }
-        _taskExecutor->runAndWait(tasks);
-    } else {
+    // the shared pool and the exclusive queue serialize requests of several networks, so they always go through it
+    _directSyncInfer = _cfg.streamExecutorConfig._streams == 1 && sharedStreams == 0 && !cfg.exclusiveAsyncRequests;
+
+    if (_cfg.runtimeCacheCapacity > 0)
+        _paramsCache = std::make_shared<MKLDNNParamsCache>(_cfg.runtimeCacheCapacity);
+
+#ifdef CPU_CONV_TUNING
+    // the cache is shared by the graphs of all streams, so each problem is measured once per network
+    if (!_cfg.tuningCacheFile.empty())
+        _tuningCache = std::make_shared<MKLDNNTuningCache>(_cfg.tuningCacheFile);
+#endif
+
+    if (sharedStreams > 0) {
+        // a request may run on any stream of the pool, so every stream gets its own graph to not wait for the others.
+        // Graphs are created on the first request run by the stream, so only the streams used by the network pay
+        _graphs.resize(sharedStreams);
         MKLDNNExecNetwork::GetGraph();
+    } else {
+        int streams = std::max(1, _cfg.streamExecutorConfig._streams);
+        std::vector<Task> tasks; tasks.resize(streams);
+        _graphs.resize(streams);
+        if (_cfg.streamExecutorConfig._streams != 0) {
+            for (auto&& task : tasks) {
+                task = [this] {
+                    MKLDNNExecNetwork::GetGraph();
+                };
+            }
+            // the first graph is the template: it compiles the primitives and reorders the weights, the graphs of
+            // the other streams take them from the params and weights caches and only allocate their own memory
+            if (streams > 1 && _paramsCache)
+                _taskExecutor->runAndWait({tasks.front()});
+            _taskExecutor->runAndWait(tasks);
+        } else {
+            MKLDNNExecNetwork::GetGraph();
+        }
     }
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
@@ -143,7 +188,12 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+                graphLock._graph.paramsCache = _paramsCache;
+                graphLock._graph.tuningCache = _tuningCache;
+                // the graph is created by the stream itself, so NUMA local weights are first touched on its node
+                auto& weightsCache = _cfg.numaWeightsReplication ? _numaNodesWeights[numaNodeId]
+                                                                 : _numaNodesWeights.shared();
+                graphLock._graph.CreateGraph(_network, extensionManager, weightsCache);
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -174,7 +224,9 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
 }
 
 InferenceEngine::IInferRequestInternal::Ptr MKLDNNExecNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    return std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor, _callbackExecutor, _directSyncInfer);
 }
 
 std::shared_ptr<ngraph::Function> MKLDNNExecNetwork::GetExecGraphInfo() {
@@ -207,6 +259,9 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(CPU_METRIC_KEY(MEMORY_STATISTICS));
+        metrics.push_back(CPU_METRIC_KEY(RUNTIME_CACHE_STATISTICS));
+        metrics.push_back(CPU_METRIC_KEY(NODE_EXEC_TIME_HISTOGRAMS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -221,6 +276,24 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == CPU_METRIC_KEY(MEMORY_STATISTICS)) {
+        IE_SET_METRIC_RETURN(CPU_MEMORY_STATISTICS, GetGraph()._graph.GetMemoryStatistics());
+    } else if (name == CPU_METRIC_KEY(RUNTIME_CACHE_STATISTICS)) {
+        std::map<std::string, uint64_t> statistics{{"hits", 0}, {"misses", 0}, {"size", 0}};
+        if (_paramsCache) {
+            statistics["hits"] = _paramsCache->hits();
+            statistics["misses"] = _paramsCache->misses();
+            statistics["size"] = _paramsCache->size();
+        }
+        IE_SET_METRIC_RETURN(CPU_RUNTIME_CACHE_STATISTICS, statistics);
+    } else if (name == CPU_METRIC_KEY(NODE_EXEC_TIME_HISTOGRAMS)) {
+        std::map<std::string, std::vector<uint64_t>> histograms;
+        for (auto& g : _graphs) {
+            auto graphLock = Graph::Lock(g);
+            if (graphLock._graph.IsReady())
+                graphLock._graph.GetPerfSamplingData(histograms);
+        }
+        IE_SET_METRIC_RETURN(CPU_NODE_EXEC_TIME_HISTOGRAMS, histograms);
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -280,6 +353,16 @@ std::vector<IVariableStateInternal::Ptr> MKLDNNExecNetwork::QueryState() {
 IE_SUPPRESS_DEPRECATED_END
 
 void MKLDNNExecNetwork::Export(std::ostream& modelStream) {
-    CNNNetworkSerializer serializer(modelStream, extensionManager);
+    // the implementations selected by the graph are exported, so the import doesn't search for them again
+    std::map<std::string, std::string> implementations;
+    {
+        auto graphLock = GetGraph();
+        for (auto &node : graphLock._graph.GetNodes()) {
+            auto selectedPD = node->getSelectedPrimitiveDescriptor();
+            if (selectedPD != nullptr && selectedPD->getImplementationType() != impl_desc_type::unknown)
+                implementations[node->getName()] = impl_type_to_string(selectedPD->getImplementationType());
+        }
+    }
+    CNNNetworkSerializer serializer(modelStream, extensionManager, implementations);
     serializer <<_network;
 }
@@ -63,8 +63,16 @@ protected:
     };
 
     // WARNING: Do not use _graphs directly.
+    // There is exactly one graph per executor stream. All infer requests executed on a stream use its graph, so
+    // intermediate tensors of all these requests share a single memory arena sized by MemorySolver and infer requests
+    // own only their input and output blobs. Requests of the same stream are serialized with Graph::_mutex.
     mutable std::deque<Graph>                   _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    // compiled kernels of dynamic shape nodes and primitives of static ones, shared by graphs of all streams
+    MKLDNNParamsCache::Ptr                      _paramsCache;
+    MKLDNNTuningCache::Ptr                      _tuningCache;
+    // the only stream runs the synchronous requests on the calling thread anyway, so they skip the async pipeline
+    bool                                        _directSyncInfer = false;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -7,6 +7,9 @@
 #include "ngraph_transformations/op/leaky_relu.hpp"
 #include "ngraph_transformations/op/power_static.hpp"
 #include "ngraph_transformations/op/swish_cpu.hpp"
+#include "ngraph_transformations/op/scaled_attention.hpp"
+#include "ngraph_transformations/op/rms_norm.hpp"
+#include "ngraph_transformations/op/yolo_detection.hpp"
 
 #include <ngraph/ngraph.hpp>
 #include <ngraph_ops/type_relaxed.hpp>
@@ -38,6 +41,9 @@ std::map<std::string, ngraph::OpSet> MKLDNNExtension::getOpSets() {
         NGRAPH_OP(LeakyReluNode, MKLDNNPlugin)
         NGRAPH_OP(PowerStaticNode, MKLDNNPlugin)
         NGRAPH_OP(SwishNode, MKLDNNPlugin)
+        NGRAPH_OP(ScaledAttentionNode, MKLDNNPlugin)
+        NGRAPH_OP(RMSNormNode, MKLDNNPlugin)
+        NGRAPH_OP(YoloDetectionNode, MKLDNNPlugin)
 #undef NGRAPH_OP
 
         return opset;
@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_fusion_cost_model.h"
+
+#include "nodes/mkldnn_conv_node.h"
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+using namespace MKLDNNPlugin;
+using namespace mkldnn::impl::cpu::x64;
+
+namespace {
+
+size_t tensorBytes(const Shape& shape, const InferenceEngine::Precision& precision) {
+    return shape.getElementsCount() * precision.size();
+}
+
+// the edges of the fused nodes are removed, so the number of inputs is taken from the original operation
+bool isBinaryPostOp(const MKLDNNNodePtr& node) {
+    return node->getType() == FakeQuantize || (node->getType() == Eltwise && node->getOriginalInputsNumber() > 1);
+}
+
+// number of binary post-ops the parent kernel keeps in registers without reducing the blocking
+size_t binaryPostOpsBudget(const MKLDNNNodePtr& parent) {
+    const size_t vectorRegisters = mayiuse(avx512_common) ? 32 : 16;
+    if (parent->getType() == Convolution) {
+        auto conv = std::dynamic_pointer_cast<MKLDNNConvolutionNode>(parent);
+        if (conv && conv->isDepthWise())
+            return vectorRegisters / 16;
+    }
+    return vectorRegisters / 4;
+}
+
+}  // namespace
+
+MKLDNNFusionCostModel::Estimation MKLDNNFusionCostModel::estimate(const MKLDNNNodePtr& parent, const MKLDNNNodePtr& child) {
+    const auto& outShape = parent->getOutputShapeAtPort(0);
+    const auto& inShape = parent->getInputShapeAtPort(0);
+    if (!outShape.isStatic() || !inShape.isStatic())
+        return {true, 0, 0};
+
+    const size_t outBytes = tensorBytes(outShape, parent->getOriginalOutputPrecisionAtPort(0));
+    const size_t inBytes = tensorBytes(inShape, parent->getOriginalInputPrecisionAtPort(0));
+
+    size_t binaryPostOps = isBinaryPostOp(child) ? 1 : 0;
+    for (const auto& fused : parent->getFusedWith()) {
+        if (isBinaryPostOp(fused))
+            binaryPostOps++;
+    }
+
+    // each binary post-op beyond the register budget makes the parent kernel read its input once more
+    const size_t budget = binaryPostOpsBudget(parent);
+    const size_t extraReads = isBinaryPostOp(child) && binaryPostOps > budget ? binaryPostOps - budget : 0;
+    const size_t penaltyBytes = extraReads * inBytes;
+    const size_t savedBytes = 2 * outBytes;
+
+    return {savedBytes > penaltyBytes, savedBytes, penaltyBytes};
+}
+
+std::string MKLDNNFusionCostModel::describe(const MKLDNNNodePtr& child, const Estimation& estimation) {
+    return std::string(estimation.profitable ? "fused " : "not fused ") + child->getName() +
+           " (saved " + std::to_string(estimation.savedBytes) + " bytes, penalty " + std::to_string(estimation.penaltyBytes) + " bytes)";
+}
@@ -0,0 +1,41 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_node.h"
+
+#include <cstddef>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Analytic estimation whether fusing a node into the preceding one as a post-op pays off
+ * The fusion saves the write and the read of the intermediate tensor. Binary post-ops (Eltwise with a data input and
+ * FakeQuantize) need vector registers of the parent's JIT kernel for their parameters. When the chain exceeds the
+ * register budget of the kernel, it falls back to a smaller register blocking and reads its input once more for each
+ * post-op beyond the budget. Depthwise convolutions have the smallest budget since they keep all accumulators in
+ * registers and have no reduction over input channels to hide the reloads.
+ *
+ * The estimation is done in bytes of memory traffic and works for static shapes only, fusions of nodes with dynamic
+ * shapes are always considered profitable.
+ */
+class MKLDNNFusionCostModel {
+public:
+    struct Estimation {
+        bool profitable;
+        size_t savedBytes;
+        size_t penaltyBytes;
+    };
+
+    static Estimation estimate(const MKLDNNNodePtr& parent, const MKLDNNNodePtr& child);
+
+    /**
+     * Returns a human readable description of the decision reported by the execution graph
+     */
+    static std::string describe(const MKLDNNNodePtr& child, const Estimation& estimation);
+};
+
+}  // namespace MKLDNNPlugin
@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <cmath>
 #include <string>
 #include <map>
 #include <vector>
@@ -10,9 +11,12 @@
 #include <unordered_set>
 #include <limits>
 #include <fstream>
+#include <sstream>
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <mutex>
+#include <exception>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -25,8 +29,15 @@
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_convert_node.h>
+#include <nodes/mkldnn_memory_node.hpp>
+#include <nodes/mkldnn_fake_quantize_node.h>
+#include <nodes/mkldnn_fullyconnected_node.h>
+#include <nodes/mkldnn_conv_node.h>
+#include <nodes/mkldnn_eltwise_node.h>
 
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
+#include <ie_data_hash.hpp>
 #include <blob_factory.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -69,7 +80,11 @@ void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMg
         ForgetGraphData();
     // disable caching if graph was created only once
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    weightsDiskCache = config.weightsCacheDir.empty() ? nullptr
+                                                      : std::make_shared<MKLDNNWeightsDiskCache>(config.weightsCacheDir);
 
+    // weights, constant subgraphs and memory arena are allocated while the graph is initialized
+    HugePagesScope hugePages(config.hugePagesMode);
     Replicate(net, extMgr);
     InitGraph();
 
@@ -283,7 +298,10 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
     // change precision for input/output nodes to avoid extra data conversion when set input/output blobs
     // also we need to change input/output precisions for consumers/producers to avoid inserting reorder
     for (auto &input : inputNodesMap) {
-        const auto precToSet = normalizeToSupportedPrecision(inputsInfo.at(input.first)->getPrecision());
+        const auto& inputInfo = inputsInfo.at(input.first);
+        // the normalized image is fractional, the integer images are converted while the mean is subtracted
+        const auto precToSet = inputInfo->getPreProcess().getNumberOfChannels() ? Precision(Precision::FP32)
+                                                                                 : normalizeToSupportedPrecision(inputInfo->getPrecision());
         input.second->setOriginalOutputPrecisionAtPort(0, precToSet);
         const auto childEdges = input.second->getChildEdgesAtPort(0);
         for (size_t i = 0; i < childEdges.size(); i++) {
@@ -294,7 +312,15 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
     }
 
     for (auto &output : outputNodesMap) {
-        const auto precToSet = normalizeToSupportedPrecision(outputsInfo.at(output.first)->getPrecision());
+        const auto& outputInfo = outputsInfo.at(output.first);
+        // the channels last output blob becomes the graph memory, so neither the reorder to the planar layout nor
+        // the copy to the blob is needed
+        auto outputNode = std::dynamic_pointer_cast<MKLDNNInputNode>(output.second);
+        if (outputNode && !outputNode->isDynamicNode() &&
+            MKLDNNPlugin::one_of(outputInfo->getLayout(), Layout::NHWC, Layout::NDHWC))
+            outputNode->withOutputLayout(LayoutType::nspc);
+
+        const auto precToSet = normalizeToSupportedPrecision(outputInfo->getPrecision());
         output.second->setOriginalInputPrecisionAtPort(0, precToSet);
         const auto parentEdges = output.second->getParentEdgesAtPort(0);
         for (size_t i = 0; i < parentEdges.size(); i++) {
@@ -325,6 +351,15 @@ void MKLDNNGraph::InitGraph() {
     SortTopologically();
     InitNodes();
 
+    for (auto &graphNode : graphNodes) {
+        if (graphNode->getType() == FullyConnected)
+            std::static_pointer_cast<MKLDNNFullyConnectedNode>(graphNode)->setSparseWeightsRate(config.sparseWeightsRate);
+        if (graphNode->getType() == Convolution)
+            std::static_pointer_cast<MKLDNNConvolutionNode>(graphNode)->setTuningCache(tuningCache);
+        if (graphNode->getType() == Eltwise)
+            std::static_pointer_cast<MKLDNNEltwiseNode>(graphNode)->setFastMath(config.fastMath);
+    }
+
     optimizer.ApplyCommonGraphOptimizations(*this);
     SortTopologically();
 
@@ -338,9 +373,22 @@ void MKLDNNGraph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    reordersCount = std::count_if(graphNodes.begin(), graphNodes.end(),
+                                  [](const MKLDNNNodePtr& node) { return node->getType() == Reorder; });
+
+    InitExecutionWaves();
     Allocate();
 
+    for (auto &graphNode : graphNodes) {
+        graphNode->paramsCache = paramsCache;
+    }
     CreatePrimitives();
+    AllocateScratchpad();
+
+    for (auto &graphNode : graphNodes) {
+        if (graphNode->getType() == MemoryOutput)
+            std::static_pointer_cast<MKLDNNMemoryOutputNode>(graphNode)->initInPlaceState();
+    }
 
 #ifndef CPU_DEBUG_CAPS
     for (auto &graphNode : graphNodes) {
@@ -352,6 +400,32 @@ void MKLDNNGraph::InitGraph() {
     ExecuteConstantNodesOnly();
 }
 
+/*
+ * A node gets the wave next to the latest wave of its parents, so the nodes of one wave are independent and may be
+ * executed concurrently once the previous waves are completed. The nodes with dependencies not expressed by the edges
+ * (the memory nodes) and the dynamic nodes, which reallocate their outputs during the inference, keep the sequential
+ * execution of the whole graph.
+ */
+void MKLDNNGraph::InitExecutionWaves() {
+    nodeWaves.clear();
+    if (!config.branchParallelism)
+        return;
+
+    for (const auto& node : graphNodes) {
+        if (one_of(node->getType(), MemoryInput, MemoryOutput) || node->isDynamicNode())
+            return;
+    }
+
+    nodeWaves.resize(graphNodes.size(), 0);
+    for (const auto& node : graphNodes) {
+        int wave = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            wave = std::max(wave, nodeWaves[node->getParentEdgeAt(i)->getParent()->execIndex] + 1);
+        }
+        nodeWaves[node->execIndex] = wave;
+    }
+}
+
 void MKLDNNGraph::InitNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::InitNodes");
     for (auto &node : graphNodes) {
@@ -382,6 +456,107 @@ void MKLDNNGraph::InitDescriptors() {
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
         node->selectOptimalPrimitiveDescriptor();
     }
+
+    PropagateLayouts();
+}
+
+/*
+ * The descriptors are selected greedily above: every node looks at the layouts of its already processed parents only,
+ * so a layout required downstream doesn't reach the producers and the reorder is inserted on each such border.
+ * Here the selection is refined iteratively: every node picks among the descriptors of the same implementation type
+ * the one that minimizes the size of the reorders on the both sides given the current choice of all its neighbors.
+ * The total reorders cost never grows, so the passes are repeated until no node changes its descriptor.
+ */
+void MKLDNNGraph::PropagateLayouts() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::PropagateLayouts");
+
+    auto reorderCost = [](const MemoryDescPtr& srcDesc, const MemoryDescPtr& dstDesc) -> size_t {
+        if (!srcDesc || !dstDesc || srcDesc->isCompatible(*dstDesc))
+            return 0;
+        const auto& shape = dstDesc->getShape();
+        return shape.isStatic() ? shape.getElementsCount() : 1;
+    };
+
+    auto hasInPlace = [](const NodeConfig& config) {
+        for (const auto& conf : config.inConfs)
+            if (conf.inPlace >= 0)
+                return true;
+        for (const auto& conf : config.outConfs)
+            if (conf.inPlace >= 0)
+                return true;
+        return false;
+    };
+
+    auto nodeCost = [&](const MKLDNNNodePtr& node, const NodeConfig& config) -> size_t {
+        size_t cost = 0;
+        for (size_t i = 0; i < config.inConfs.size(); i++) {
+            auto parentEdge = node->getParentEdgeAt(i);
+            auto parent = parentEdge->getParent();
+            // reorders on the constant inputs are executed once on the load network stage
+            if (parent->isConstant() && !node->isConstant())
+                continue;
+            auto parentPD = parent->getSelectedPrimitiveDescriptor();
+            if (parentPD == nullptr || parentPD->getConfig().outConfs.empty())
+                continue;
+            int inNum = parentEdge->getInputNum();
+            if (inNum < 0 || inNum >= parentPD->getConfig().outConfs.size())
+                inNum = 0;
+            cost += reorderCost(parentPD->getConfig().outConfs[inNum].desc, config.inConfs[i].desc);
+        }
+        for (const auto& childEdgeWeak : node->getChildEdges()) {
+            auto childEdge = childEdgeWeak.lock();
+            if (!childEdge)
+                continue;
+            int outNum = childEdge->getInputNum();
+            int childInNum = childEdge->getOutputNum();
+            auto childPD = childEdge->getChild()->getSelectedPrimitiveDescriptor();
+            if (childPD == nullptr || outNum < 0 || outNum >= config.outConfs.size() ||
+                    childInNum < 0 || childInNum >= childPD->getConfig().inConfs.size())
+                continue;
+            cost += reorderCost(config.outConfs[outNum].desc, childPD->getConfig().inConfs[childInNum].desc);
+        }
+        return cost;
+    };
+
+    const size_t maxPasses = 4;
+    for (size_t pass = 0; pass < maxPasses; pass++) {
+        bool changed = false;
+        for (auto& node : graphNodes) {
+            // the nodes below select the descriptors with their own in-place logic or have no layout choice
+            if (one_of(node->getType(), Input, Output, Reorder, Concatenation, Split) || node->isConstant())
+                continue;
+
+            auto selectedPD = node->getSelectedPrimitiveDescriptor();
+            if (selectedPD == nullptr || hasInPlace(selectedPD->getConfig()))
+                continue;
+
+            const auto& supportedPDs = node->getSupportedPrimitiveDescriptors();
+            int bestIdx = node->selectedPrimitiveDescriptorIndex;
+            size_t bestCost = nodeCost(node, selectedPD->getConfig());
+            for (int i = 0; i < supportedPDs.size() && bestCost > 0; i++) {
+                const auto& config = supportedPDs[i].getConfig();
+                if (i == node->selectedPrimitiveDescriptorIndex ||
+                        supportedPDs[i].getImplementationType() != selectedPD->getImplementationType() ||
+                        config.inConfs.size() != selectedPD->getConfig().inConfs.size() ||
+                        config.outConfs.size() != selectedPD->getConfig().outConfs.size() ||
+                        config.inConfs.size() > node->getParentEdges().size() ||
+                        hasInPlace(config))
+                    continue;
+                const size_t cost = nodeCost(node, config);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestIdx = i;
+                }
+            }
+
+            if (bestIdx != node->selectedPrimitiveDescriptorIndex) {
+                node->selectPrimitiveDescriptorByIndex(bestIdx);
+                changed = true;
+            }
+        }
+        if (!changed)
+            break;
+    }
 }
 
 void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
@@ -405,6 +580,19 @@ void MKLDNNGraph::ExtractConstantAndExecutableNodes() {
              */
             executableGraphNodes.emplace_back(graphNode);
     }
+    perfHistograms.resize(executableGraphNodes.size());
+
+    executionWaves.clear();
+    if (!nodeWaves.empty()) {
+        // the topological order interleaves the waves of different branches
+        executionWaves.resize(*std::max_element(nodeWaves.begin(), nodeWaves.end()) + 1);
+        for (size_t i = 0; i < executableGraphNodes.size(); i++) {
+            executionWaves[nodeWaves[executableGraphNodes[i]->execIndex]].push_back(i);
+        }
+        executionWaves.erase(std::remove_if(executionWaves.begin(), executionWaves.end(),
+                                            [](const std::vector<size_t>& wave) { return wave.empty(); }),
+                             executionWaves.end());
+    }
 }
 
 void MKLDNNGraph::ExecuteConstantNodesOnly() const {
@@ -422,7 +610,7 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() const {
             auto edgePtr = node->getChildEdgeAt(i);
             if (edgePtr) {
                 if (edgePtr->isUseExternalMemory()) {
-                    auto ptr = weightsCache->get(edgePtr->name());
+                    auto ptr = weightsCache->get(edgePtr->cacheKey());
                     outputs.emplace_back(ptr);
                     if (!ptr->isValid())
                         hasExternalInvalidEdges = true;
@@ -440,17 +628,52 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() const {
             auto sharedOutputs = acquireSharedOutputs(node);
 
             if (std::get<0>(sharedOutputs) || std::get<1>(sharedOutputs)) {
-                ExecuteNode(node, stream);
+                ExecuteConstantNode(node, stream);
 
                 for (auto & output : std::get<2>(sharedOutputs))
                     output->valid(true);
             }
         } else {
-            ExecuteNode(node, stream);
+            ExecuteConstantNode(node, stream);
         }
     }
 }
 
+void MKLDNNGraph::ExecuteConstantNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream) const {
+    // Only weights repacking is worth to be persisted: it is the most expensive part of constant path
+    // and its result depends on input data and memory descriptors only
+    if (!weightsDiskCache || node->getType() != Reorder || node->isDynamicNode() ||
+        node->getParentEdges().size() != 1 || node->getChildEdges().empty()) {
+        ExecuteNode(node, stream);
+        return;
+    }
+
+    const auto& srcMemory = node->getParentEdgeAt(0)->getMemory();
+    const auto& dstMemory = node->getChildEdgeAt(0)->getMemory();
+
+    auto describe = [](const MKLDNNMemory& memory) {
+        const auto& desc = memory.getDesc();
+        std::string result = desc.getPrecision().name();
+        result += "_" + desc.getShape().toString() + "_" + desc.serializeFormat() + "_" + std::to_string(memory.GetSize());
+        if (desc.getType() & MemoryDescType::Mkldnn)
+            result += "_" + std::to_string(MemoryDescUtils::convertToDnnlMemoryDesc(desc.clone())->getDnnlDesc().data.extra.flags);
+        return result;
+    };
+
+    const std::string descriptors = describe(srcMemory) + "->" + describe(dstMemory);
+    const uint64_t descHash = computeDataHashSequential(descriptors.data(), descriptors.size());
+    const uint64_t dataHash = computeDataHash(srcMemory.GetData(), srcMemory.GetSize());
+
+    std::stringstream key;
+    key << std::hex << dataHash << "_" << descHash;
+
+    if (weightsDiskCache->load(key.str(), dstMemory))
+        return;
+
+    ExecuteNode(node, stream);
+    weightsDiskCache->store(key.str(), dstMemory);
+}
+
 static bool isReorderAvailable(const MemoryDesc& parentDesc, const MemoryDesc& childDesc, const mkldnn::engine& eng) {
     memory::desc dstMemDesc = MemoryDescUtils::convertToDnnlMemoryDesc(childDesc.clone())->getDnnlDesc();
     memory::desc srcMemDesc = MemoryDescUtils::convertToDnnlMemoryDesc(parentDesc.clone())->getDnnlDesc();
@@ -615,8 +838,9 @@ void MKLDNNGraph::AllocateWithReuse() {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            // the nodes of one wave are executed concurrently, so the tensors live during the whole waves
+            int e_start = nodeWaves.empty() ? edge->getParent()->execIndex : nodeWaves[edge->getParent()->execIndex];
+            int e_finish = nodeWaves.empty() ? edge->getChild()->execIndex : nodeWaves[edge->getChild()->execIndex];
 
             if (!edge->hasDefinedMaxSize()) {
                 IE_THROW() << "Can not allocate memory since the size is undefined.";
@@ -651,8 +875,24 @@ void MKLDNNGraph::AllocateWithReuse() {
         box.size = div_up(box.size, alignment);
     }
 
-    MemorySolver memSolver(boxes);
+    // Best fit strategy additionally aligns boxes to cache line, and big ones to page, to avoid false sharing and
+    // split pages between tensors. In-place chains are already merged into a single box by findEdgeClusters.
+    MemorySolver::Strategy strategy = MemorySolver::Strategy::Greedy;
+    std::map<int64_t, int64_t> boxAlignments;
+    if (config.memorySolverMode == Config::MemorySolverMode::BestFit) {
+        strategy = MemorySolver::Strategy::BestFit;
+        const int64_t cacheLineSize = 64;
+        const int64_t pageSize = 4096;
+        for (const auto& box : boxes) {
+            boxAlignments[box.id] = box.size * alignment >= pageSize ? pageSize / alignment
+                                                                     : div_up(cacheLineSize, alignment);
+        }
+    }
+
+    MemorySolver memSolver(boxes, strategy, boxAlignments);
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    memArenaSize = total_size;
+    memArenaLowerBound = static_cast<uint64_t>(memSolver.maxDepth()) * alignment;
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
@@ -707,9 +947,70 @@ void MKLDNNGraph::Allocate() {
 
 void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
-    for (auto& node : graphNodes) {
+    auto createPrimitive = [](const MKLDNNNodePtr& node) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
         node->createPrimitive();
+    };
+
+    /*
+     * The memory is allocated and the descriptors are selected at this point, so a node creates its primitive
+     * (compiles its JIT kernels) looking at its own state and the memory of its edges only and the nodes are processed
+     * concurrently. The shared caches (weights, runtime params, tuning) are thread safe. The memory nodes bind to
+     * the global state holder, so they are still created sequentially.
+     */
+    std::vector<MKLDNNNodePtr> concurrentNodes;
+    concurrentNodes.reserve(graphNodes.size());
+    for (auto& node : graphNodes) {
+        if (one_of(node->getType(), MemoryInput, MemoryOutput))
+            createPrimitive(node);
+        else
+            concurrentNodes.push_back(node);
+    }
+
+    std::mutex exceptionMutex;
+    std::exception_ptr exception;
+    parallel_for(concurrentNodes.size(), [&](size_t i) {
+        try {
+            createPrimitive(concurrentNodes[i]);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exceptionMutex);
+            if (!exception)
+                exception = std::current_exception();
+        }
+    });
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+/*
+ * The nodes executed one by one reuse the same scratchpad, so it is sized by the largest one. The nodes of one wave may
+ * be executed concurrently, so they get disjoint parts of the scratchpad and it is sized by the largest wave.
+ */
+void MKLDNNGraph::AllocateScratchpad() {
+    std::map<int, size_t> waveSizes;
+    std::vector<std::pair<MKLDNNNodePtr, size_t>> offsets;
+    for (auto& node : graphNodes) {
+        const size_t size = node->scratchpadDesc.get_size();
+        if (size == 0)
+            continue;
+        auto& waveSize = waveSizes[nodeWaves.empty() ? 0 : nodeWaves[node->execIndex]];
+        offsets.emplace_back(node, waveSize);
+        // keep the parts of the concurrent nodes aligned to the cache line
+        waveSize += rnd_up(size, 64);
+    }
+    if (offsets.empty())
+        return;
+
+    size_t totalSize = 0;
+    for (const auto& waveSize : waveSizes)
+        totalSize = std::max(totalSize, waveSize.second);
+    memScratchpad = std::make_shared<MKLDNNMemory>(eng);
+    memScratchpad->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{totalSize})));
+
+    auto* scratchpadPtr = static_cast<int8_t*>(memScratchpad->GetData());
+    for (const auto& offset : offsets) {
+        auto& node = offset.first;
+        node->primArgs[DNNL_ARG_SCRATCHPAD] = mkldnn::memory(node->scratchpadDesc, eng, scratchpadPtr + offset.second);
     }
 }
 
@@ -721,6 +1022,30 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         const void *ext_data_ptr = in->cbuffer();
         void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
 
+        auto normalize = _normalizePreprocMap.find(name);
+        const auto inPrec = in->getTensorDesc().getPrecision();
+        if (normalize != _normalizePreprocMap.end() && ext_data_ptr != inter_data_ptr &&
+            MKLDNNPlugin::one_of(inPrec, InferenceEngine::Precision::FP32, InferenceEngine::Precision::U8)) {
+            // the graph input of the normalized image is FP32, so the blob is compared with it in the graph precision
+            InferenceEngine::TensorDesc inDesc = in->getTensorDesc();
+            inDesc.setPrecision(InferenceEngine::Precision::FP32);
+            if (inDesc == MemoryDescUtils::convertToTensorDesc(input->second->getChildEdgeAt(0)->getMemory().getDesc())) {
+                // the blob has the layout of the graph input, so it is normalized (and converted) while it is copied
+                if (inPrec == InferenceEngine::Precision::U8) {
+                    normalize->second.NormalizeImage(input->second->getOutputShapeAtPort(0),
+                                                     reinterpret_cast<const uint8_t *>(ext_data_ptr),
+                                                     reinterpret_cast<float *>(inter_data_ptr),
+                                                     in->getTensorDesc().getLayout());
+                } else {
+                    normalize->second.NormalizeImage(input->second->getOutputShapeAtPort(0),
+                                                     reinterpret_cast<const float *>(ext_data_ptr),
+                                                     reinterpret_cast<float *>(inter_data_ptr),
+                                                     in->getTensorDesc().getLayout());
+                }
+                return;
+            }
+        }
+
         if (ext_data_ptr != inter_data_ptr) {
             auto ext_tdesc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(in->getTensorDesc());
 
@@ -730,14 +1055,15 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
             input->second->getChildEdgeAt(0)->getMemory().SetData(ext_mem, 0, false);
         }
 
-        // todo: make sure 'name' exists in this map...
-        if (_normalizePreprocMap.find(name) != _normalizePreprocMap.end()) {
-            if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
-                _normalizePreprocMap[name].NormalizeImage(input->second->getOutputShapeAtPort(0),
-                                                          reinterpret_cast<float *>(inter_data_ptr),
-                                                          in->getTensorDesc().getLayout());
+        if (normalize != _normalizePreprocMap.end()) {
+            // the data are converted to the FP32 graph input above, so any supported blob precision is normalized in place
+            const auto interPrec = input->second->getChildEdgeAt(0)->getMemory().getDesc().getPrecision();
+            if (interPrec == InferenceEngine::Precision::FP32) {
+                normalize->second.NormalizeImage(input->second->getOutputShapeAtPort(0),
+                                                 reinterpret_cast<float *>(inter_data_ptr),
+                                                 in->getTensorDesc().getLayout());
             } else {
-                IE_THROW() << "Mean image of type " << in->getTensorDesc().getPrecision().name() << " is unsupported";
+                IE_THROW() << "Mean image of type " << interPrec.name() << " is unsupported";
             }
         }
     } else {
@@ -835,14 +1161,47 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
 
     mkldnn::stream stream(eng);
 
-    for (const auto& node : executableGraphNodes) {
+    bool sample = false;
+    if (config.perfCountSampling > 0) {
+        sample = perfSamplingCounter == 0;
+        perfSamplingCounter = (perfSamplingCounter + 1) % config.perfCountSampling;
+    }
+
+    auto execute = [&](size_t i, const mkldnn::stream& nodeStream) {
+        const auto& node = executableGraphNodes[i];
         VERBOSE(node, config.debugCaps.verbose);
         PERF(node, config.collectPerfCounters);
 
-        if (request)
-            request->ThrowIfCanceled();
+        if (sample) {
+            const auto start = std::chrono::high_resolution_clock::now();
+            ExecuteNode(node, nodeStream);
+            const auto finish = std::chrono::high_resolution_clock::now();
+            perfHistograms[i].add(std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count());
+        } else {
+            ExecuteNode(node, nodeStream);
+        }
+    };
 
-        ExecuteNode(node, stream);
+    if (executionWaves.empty()) {
+        for (size_t i = 0; i < executableGraphNodes.size(); i++) {
+            if (request)
+                request->ThrowIfCanceled();
+            execute(i, stream);
+        }
+    } else {
+        for (const auto& wave : executionWaves) {
+            if (request)
+                request->ThrowIfCanceled();
+            if (wave.size() == 1) {
+                execute(wave.front(), stream);
+                continue;
+            }
+            // every node runs its own internal parallel loops, so the threads left by the small nodes are reused
+            parallel_for(wave.size(), [&](size_t j) {
+                mkldnn::stream nodeStream(eng);
+                execute(wave[j], nodeStream);
+            });
+        }
     }
 
     if (infer_count != -1) infer_count++;
@@ -964,6 +1323,16 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
     }
 }
 
+void MKLDNNGraph::GetPerfSamplingData(std::map<std::string, std::vector<uint64_t>> &histograms) const {
+    for (size_t i = 0; i < executableGraphNodes.size(); i++) {
+        auto& histogram = histograms[executableGraphNodes[i]->getName()];
+        histogram.resize(PerfHistogram::numBuckets, 0);
+        const auto& buckets = perfHistograms[i].get();
+        for (size_t b = 0; b < buckets.size(); b++)
+            histogram[b] += buckets[b];
+    }
+}
+
 void MKLDNNGraph::setConfig(const Config &cfg) {
     config = cfg;
 }
@@ -1204,13 +1573,46 @@ bool MKLDNNGraph::InsertNode(MKLDNNNodePtr parent, MKLDNNNodePtr child, MKLDNNNo
     return true;
 }
 
+// BF16 keeps 8 bits of the mantissa, so the values rounded to BF16 before the FakeQuantize with a finer quantization step
+// than the BF16 resolution of its range would be quantized to the wrong levels
+static bool isFinerThanBF16(const MKLDNNFakeQuantizeNode& fq) {
+    float maxAbs = 0.f;
+    for (auto value : fq.getCropLow())
+        maxAbs = std::max(maxAbs, std::abs(value));
+    for (auto value : fq.getCropHigh())
+        maxAbs = std::max(maxAbs, std::abs(value));
+    const auto& inputScale = fq.getInputScale();
+    const float maxScale = inputScale.empty() ? 0.f : *std::max_element(inputScale.begin(), inputScale.end());
+    if (maxScale <= 0.f)
+        return false;
+
+    const float bf16Resolution = maxAbs / 256.f;
+    return bf16Resolution > 1.f / maxScale;
+}
+
 // Set all non const data paths precision to BF16
 void MKLDNNGraph::EnforceBF16() {
     // Floating point parts of FP32 + INT8 or FP32 + BIN mixed precision models will be executed in BF16 precision
     // only if enforceBF16 flag was set manually because current performance is not good enough to enable it by default
     if (implication(isQuantized(), config.manualEnforceBF16)) {
+        // The nodes listed by the user and the nodes the plugin finds unsafe for BF16 stay in FP32,
+        // the reorders converting the precision are inserted on their borders
+        std::unordered_set<MKLDNNNode*> fp32Nodes;
+        for (auto &node : graphNodes) {
+            if (config.bf16Fp32NodesSet.count(node->getTypeStr()) || config.bf16Fp32NodesSet.count(node->getName()))
+                fp32Nodes.insert(node.get());
+
+            if (node->getType() == FakeQuantize) {
+                auto fq = std::dynamic_pointer_cast<MKLDNNFakeQuantizeNode>(node);
+                if (fq && isFinerThanBF16(*fq)) {
+                    fp32Nodes.insert(node.get());
+                    fp32Nodes.insert(node->getParentEdgesAtPort(0)[0]->getParent().get());
+                }
+            }
+        }
+
         for (auto &node : graphNodes) {
-            if (node->getType() != Input && node->getType() != Output) {
+            if (node->getType() != Input && node->getType() != Output && fp32Nodes.count(node.get()) == 0) {
                 for (size_t i = 0; i < node->getOriginalInputsNumber(); i++) {
                     auto &parent = node->getParentEdgesAtPort(i)[0]->getParent();
                     if (!(parent->getType() == Input && parent->isConstant()) &&       // exclude nodes after Constant Inputs
@@ -10,6 +10,8 @@
 #include "normalize_preprocess.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "perf_count.h"
+#include "mkldnn_tuning_cache.hpp"
 #include <map>
 #include <string>
 #include <vector>
@@ -22,6 +24,10 @@ class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
     MKLDNNWeightsSharing::Ptr weightsCache;
+    MKLDNNWeightsDiskCache::Ptr weightsDiskCache;
+    MKLDNNParamsCache::Ptr paramsCache;
+    // may be null, the convolutions take the static implementations priority in that case
+    MKLDNNTuningCache::Ptr tuningCache;
 
     enum Status {
         NotReady = 0,
@@ -77,6 +83,18 @@ public:
         return graphEdges;
     }
 
+    size_t GetReordersCount() const {
+        return reordersCount;
+    }
+
+    /**
+     * @brief Returns statistics of the intermediate tensors memory arena
+     * @return map with "arena_size" and "lower_bound" values in bytes
+     */
+    std::map<std::string, uint64_t> GetMemoryStatistics() const {
+        return {{"arena_size", memArenaSize}, {"lower_bound", memArenaLowerBound}};
+    }
+
     std::map<std::string, MKLDNNNodePtr>& GetInputNodesMap() {
         return inputNodesMap;
     }
@@ -112,6 +130,8 @@ public:
     }
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
+    // adds the execution time histograms of the sampled inferences to the given ones
+    void GetPerfSamplingData(std::map<std::string, std::vector<uint64_t>> &histograms) const;
 
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
@@ -213,6 +233,9 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    MKLDNNMemoryPtr memScratchpad;
+    uint64_t memArenaSize = 0;
+    uint64_t memArenaLowerBound = 0;
 
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
@@ -223,6 +246,9 @@ protected:
     bool isQuantizedFlag = false;
     bool graphHasDynamicInput = false;
 
+    // the number of the reorders left in the graph after the layouts propagation and the graph optimizations
+    size_t reordersCount = 0;
+
     static mkldnn::engine eng;
 
     void Replicate(const InferenceEngine::CNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
@@ -230,14 +256,18 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    void PropagateLayouts();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
+    void InitExecutionWaves();
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
+    void AllocateScratchpad();
     void ExtractConstantAndExecutableNodes();
     void ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream) const;
     void ExecuteConstantNodesOnly() const;
+    void ExecuteConstantNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream) const;
 
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
@@ -248,12 +278,22 @@ private:
     std::map<std::string, MKLDNNNodePtr> inputNodesMap;
     std::map<std::string, MKLDNNNodePtr> outputNodesMap;
 
+    // the depth of every node of graphNodes (indexed by execIndex) when the independent branches are executed
+    // concurrently, empty otherwise
+    std::vector<int> nodeWaves;
+    // indexes of executableGraphNodes grouped by the depth, the nodes of one wave don't depend on each other
+    std::vector<std::vector<size_t>> executionWaves;
+
     // these node pointers (from graphNodes) are to avoid regular checking for
     // constantness of nodes in ExecuteConstantNodesOnly, Infer methods and calls of
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<MKLDNNNodePtr> constantGraphNodes;
     std::vector<MKLDNNNodePtr> executableGraphNodes;
 
+    // execution time histograms of executableGraphNodes, filled by one inference out of every config.perfCountSampling
+    std::vector<PerfHistogram> perfHistograms;
+    int perfSamplingCounter = 0;
+
     void EnforceBF16();
 };
 
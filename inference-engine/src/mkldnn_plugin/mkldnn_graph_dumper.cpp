@@ -9,6 +9,7 @@
 #include "exec_graph_info.hpp"
 #include "ie_common.h"
 #include "mkldnn_debug.h"
+#include "nodes/mkldnn_reference_node.h"
 #include <ngraph/variant.hpp>
 #include "ngraph/ngraph.hpp"
 #include <ngraph/pass/manager.hpp>
@@ -44,6 +45,18 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
     // Original layers
     serialization_info[ExecGraphInfoSerialization::ORIGINAL_NAMES] = node->getOriginalLayers();
 
+    // Operations executed by fallback on ngraph reference implementation
+    if (node->getType() == Reference) {
+        serialization_info["originalLayerType"] = node->getTypeStr();
+        const auto& fallbackReason = static_cast<const MKLDNNReferenceNode*>(node.get())->getFallbackReason();
+        if (!fallbackReason.empty())
+            serialization_info["fallbackReason"] = fallbackReason;
+    }
+
+    // Decisions of the fusion cost model, if it is enabled
+    if (!node->getFusionDecisions().empty())
+        serialization_info["fusionDecisions"] = node->getFusionDecisions();
+
     // Implementation type name
     serialization_info[ExecGraphInfoSerialization::IMPL_TYPE] = node->getPrimitiveDescriptorType();
 
@@ -171,6 +184,8 @@ std::shared_ptr<ngraph::Function> dump_graph_as_ie_ngraph_net(const MKLDNNGraph
         } else if (is_output) {
             results.emplace_back(std::make_shared<ngraph::op::Result>(get_inputs(node).back()));
             return_node = results.back();
+            // the graph wide statistics are stored on the results since the function has no runtime info of its own
+            meta_data["reordersCount"] = std::to_string(graph.GetReordersCount());
         } else {
             return_node = std::make_shared<ExecGraphInfoSerialization::ExecutionNode>(
                 get_inputs(node), node->getSelectedPrimitiveDescriptor()->getConfig().outConfs.size());
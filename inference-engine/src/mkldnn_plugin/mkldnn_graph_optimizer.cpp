@@ -5,6 +5,7 @@
 #include "mkldnn_graph_optimizer.h"
 
 #include "mkldnn_extension_utils.h"
+#include "mkldnn_fusion_cost_model.h"
 #include "nodes/mkldnn_reshape_node.h"
 #include "nodes/mkldnn_pooling_node.h"
 #include "nodes/mkldnn_eltwise_node.h"
@@ -17,6 +18,7 @@
 #include <nodes/mkldnn_transpose_node.h>
 #include "nodes/mkldnn_interpolate_node.h"
 #include "nodes/mkldnn_input_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 #include "nodes/mkldnn_rnn.h"
 #include "nodes/common/cpu_convert.h"
 
@@ -57,6 +59,18 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseConvolutionAndBias(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseFCAndWeightsDecompression");
+    FuseFCAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseMVNResidualAndAffine");
+    FuseMVNResidualAndAffine(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseReduceAndInputEltwise");
+    FuseReduceAndInputEltwise(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseMultiplyAndAdd");
     FuseMultiplyAndAdd(graph);
     graph.RemoveDroppedNodes();
@@ -77,6 +91,10 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FusePerformedAsScaleShiftAndFakeQuantize(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseFakeQuantizeAndConvert");
+    FuseFakeQuantizeAndConvert(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndZeroPoints");
     FuseConvolutionAndZeroPoints(graph);
     graph.RemoveDroppedNodes();
@@ -137,6 +155,10 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseInputConvertAndEltwise");
+    FuseInputConvertAndEltwise(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "reshapeRnnSeq");
     reshapeRnnSeq(graph);
     graph.RemoveDroppedNodes();
@@ -306,6 +328,70 @@ void MKLDNNGraphOptimizer::FuseDeconvolutionAndSimpleOperation(MKLDNNGraph &grap
     }
 }
 
+void MKLDNNGraphOptimizer::FuseFCAndWeightsDecompression(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableConstant = [](const MKLDNNNodePtr& node) {
+        return node->getType() == Input && node->isConstant() && dynamic_cast<MKLDNNInputNode*>(node.get()) != nullptr;
+    };
+
+    auto isSuitableDecompression = [&](const MKLDNNNodePtr& node) {
+        if (node->getType() != Convert || node->getChildEdges().size() != 1 ||
+            node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return false;
+        const auto weights = node->getParentEdgesAtPort(0)[0]->getParent();
+        return isSuitableConstant(weights) && one_of(weights->getOriginalOutputPrecisionAtPort(0), Precision::U8, Precision::I8);
+    };
+
+    // the scale is per output channel or common, so it is applied after the accumulation
+    auto isSuitableScale = [&](const MKLDNNNodePtr& fcNode, const MKLDNNNodePtr& scaleParent, const MKLDNNNodePtr& node) {
+        if (node->getAlgorithm() != EltwiseMultiply || node->getParentEdges().size() != 2 ||
+            node->getParentEdgesAtPort(0)[0]->getParent() != scaleParent)
+            return false;
+        const auto scales = node->getParentEdgesAtPort(1)[0]->getParent();
+        if (!isSuitableConstant(scales) || scales->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return false;
+        const auto scalesCount = scales->getOutputShapeAtPort(0).getElementsCount();
+        const auto& fcDims = fcNode->getOutputShapeAtPort(0).getDims();
+        const auto& scalesDims = scales->getOutputShapeAtPort(0).getDims();
+        return scalesCount == 1 || (scalesCount == fcDims.back() && scalesDims.back() == fcDims.back());
+    };
+
+    for (const auto& node : graphNodes) {
+        auto fcNode = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(node);
+        if (!fcNode || fcNode->getChildEdges().size() != 1 || fcNode->getOriginalInputPrecisionAtPort(0) != Precision::FP32 ||
+            !fcNode->getOutputShapeAtPort(0).isStatic())
+            continue;
+
+        const auto decompression = fcNode->getParentEdgesAtPort(1)[0]->getParent();
+        // the output of the FullyConnected with 3D input is reshaped back, the output channels stay the last axis
+        auto scaleParent = std::static_pointer_cast<MKLDNNNode>(fcNode);
+        auto scaleNode = fcNode->getChildEdgeAt(0)->getChild();
+        if (scaleNode->getType() == Reshape && scaleNode->getChildEdges().size() == 1 &&
+            scaleNode->getOutputShapeAtPort(0).getDims().back() == fcNode->getOutputShapeAtPort(0).getDims().back()) {
+            scaleParent = scaleNode;
+            scaleNode = scaleNode->getChildEdgeAt(0)->getChild();
+        }
+        if (!isSuitableDecompression(decompression) || !isSuitableScale(fcNode, scaleParent, scaleNode))
+            continue;
+
+        auto scalesConstant = dynamic_cast<MKLDNNInputNode*>(scaleNode->getParentEdgesAtPort(1)[0]->getParent().get());
+        const auto scalesData = static_cast<const float*>(scalesConstant->getMemoryPtr()->GetPtr());
+        fcNode->setCompressedWeights(std::vector<float>(scalesData, scalesData + scalesConstant->getOutputShapeAtPort(0).getElementsCount()));
+
+        fcNode->addOriginalLayer(decompression->getOriginalLayers());
+        graph.DropNode(decompression);
+        auto parentEdges = scaleNode->parentEdges;
+        for (auto& parentEdge : parentEdges) {
+            auto p_edge = parentEdge.lock();
+            if (p_edge && p_edge->getParent() != scaleParent)
+                graph.RemoveEdge(p_edge);
+        }
+        fcNode->addOriginalLayer(scaleNode->getOriginalLayers());
+        graph.DropNode(scaleNode);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseMultiplyAndAdd(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -606,6 +692,16 @@ static bool BF16QuantizeNodeFusing(MKLDNNNodePtr parentNode, MKLDNNNodePtr child
             childNode->getOriginalOutputPrecisionAtPort(0));
 }
 
+// with the analytic cost model enabled, the decision is recorded on the parent node to be reported by the execution graph
+static bool isFusionProfitable(const MKLDNNGraph &graph, const MKLDNNNodePtr& parentNode, const MKLDNNNodePtr& childNode) {
+    if (graph.getConfig().fusionCostModel == Config::FusionCostModel::NoCostModel)
+        return true;
+
+    const auto estimation = MKLDNNFusionCostModel::estimate(parentNode, childNode);
+    parentNode->addFusionDecision(MKLDNNFusionCostModel::describe(childNode, estimation));
+    return estimation.profitable;
+}
+
 void MKLDNNGraphOptimizer::FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -633,6 +729,11 @@ void MKLDNNGraphOptimizer::FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &gra
             continue;
         }
 
+        if (!isFusionProfitable(graph, parentNode, childNode)) {
+            parent++;
+            continue;
+        }
+
         childNode->fuseInto(parentNode);
 
         if (childNode->getType() == FakeQuantize || childNode->getType() == Eltwise) {
@@ -671,6 +772,11 @@ void MKLDNNGraphOptimizer::FuseMatMulAndSimpleOperation(MKLDNNGraph &graph) {
             continue;
         }
 
+        if (!isFusionProfitable(graph, parentNode, childNode)) {
+            parent++;
+            continue;
+        }
+
         childNode->fuseInto(parentNode);
 
         if (childNode->getType() == FakeQuantize || childNode->getType() == Eltwise) {
@@ -898,6 +1004,11 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndSimpleOperation(MKLDNNGraph &graph)
             continue;
         }
 
+        if (!isFusionProfitable(graph, parentNode, childNode)) {
+            parent++;
+            continue;
+        }
+
         childNode->fuseInto(parentNode);
 
         if (childNode->getType() == FakeQuantize || childNode->getType() == Eltwise) {
@@ -1192,6 +1303,126 @@ void MKLDNNGraphOptimizer::FuseConvolutionSumAndConvolutionSumActivation(MKLDNNG
     }
 }
 
+void MKLDNNGraphOptimizer::FuseMVNResidualAndAffine(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableConstant = [](const MKLDNNNodePtr& node) {
+        return node->getType() == Input && node->isConstant() && dynamic_cast<MKLDNNInputNode*>(node.get()) != nullptr &&
+               node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32;
+    };
+
+    auto isSuitableEltwise = [](const MKLDNNNodePtr& node, Algorithm algorithm, const VectorDims& dataDims) {
+        return node->getAlgorithm() == algorithm && node->getFusedWith().empty() && node->getParentEdges().size() == 2 &&
+               node->getOriginalInputPrecisionAtPort(0) == Precision::FP32 && node->getOriginalInputPrecisionAtPort(1) == Precision::FP32 &&
+               node->getOutputShapeAtPort(0).isStatic() && node->getOutputShapeAtPort(0).getStaticDims() == dataDims;
+    };
+
+    // the residual is a non constant tensor of the same shape, the sum isn't used by other nodes
+    auto isSuitableResidual = [&](const MKLDNNNodePtr& node, const VectorDims& dataDims) {
+        if (!isSuitableEltwise(node, EltwiseAdd, dataDims) || node->getChildEdges().size() != 1)
+            return false;
+        for (size_t port = 0; port < 2; port++) {
+            const auto& shape = node->getInputShapeAtPort(port);
+            if (node->getParentEdgesAtPort(port)[0]->getParent()->isConstant() || !shape.isStatic() || shape.getStaticDims() != dataDims)
+                return false;
+        }
+        return true;
+    };
+
+    // gamma and beta are common or given for each element of the normalized row
+    auto getAffineConstant = [&](const MKLDNNNodePtr& node, const MKLDNNNodePtr& parent, size_t rowSize) -> MKLDNNNodePtr {
+        if (node->getParentEdgesAtPort(0)[0]->getParent() != parent)
+            return nullptr;
+        const auto constant = node->getParentEdgesAtPort(1)[0]->getParent();
+        if (!isSuitableConstant(constant))
+            return nullptr;
+        const auto& constDims = constant->getOutputShapeAtPort(0).getStaticDims();
+        const auto& dataDims = node->getOutputShapeAtPort(0).getStaticDims();
+        const size_t constSize = constant->getOutputShapeAtPort(0).getElementsCount();
+        if (constSize == 1)
+            return constant;
+        if (constSize != rowSize || constDims.size() > dataDims.size())
+            return nullptr;
+        // the leading dims are 1, the trailing ones are the normalized dims
+        size_t trailingSize = 1;
+        for (size_t i = 1; i <= constDims.size() && trailingSize < rowSize; i++) {
+            if (constDims[constDims.size() - i] != dataDims[dataDims.size() - i])
+                return nullptr;
+            trailingSize *= constDims[constDims.size() - i];
+        }
+        return trailingSize == rowSize ? constant : nullptr;
+    };
+
+    auto readConstant = [](const MKLDNNNodePtr& constant) {
+        auto inputNode = dynamic_cast<MKLDNNInputNode*>(constant.get());
+        const auto data = static_cast<const float*>(inputNode->getMemoryPtr()->GetPtr());
+        return std::vector<float>(data, data + constant->getOutputShapeAtPort(0).getElementsCount());
+    };
+
+    auto dropAffineNode = [&](const MKLDNNNodePtr& mvnNode, const MKLDNNNodePtr& node) {
+        auto parentEdges = node->parentEdges;
+        for (auto& parentEdge : parentEdges) {
+            auto p_edge = parentEdge.lock();
+            if (p_edge && p_edge->getParent() != mvnNode)
+                graph.RemoveEdge(p_edge);
+        }
+        mvnNode->addOriginalLayer(node->getOriginalLayers());
+        graph.DropNode(node);
+    };
+
+    for (const auto& node : graphNodes) {
+        auto mvnNode = std::dynamic_pointer_cast<MKLDNNMVNNode>(node);
+        if (!mvnNode || !mvnNode->canFuseResidualAndAffine())
+            continue;
+
+        const auto dataDims = mvnNode->getInputShapeAtPort(0).getStaticDims();
+        const size_t rowSize = mvnNode->getNormalizedSize();
+
+        auto addNode = mvnNode->getParentEdgesAtPort(0)[0]->getParent();
+        if (isSuitableResidual(addNode, dataDims)) {
+            // the second summand becomes the next input of MVN, the first one is connected to the data port by DropNode
+            auto residualEdge = addNode->getParentEdgesAtPort(1)[0];
+            auto residual = residualEdge->getParent();
+            const int inNum = residualEdge->getInputNum();
+            residualEdge->drop();
+            graph.RemoveEdge(residualEdge);
+
+            const size_t residualPort = mvnNode->getParentEdges().size();
+            MKLDNNEdgePtr newEdge(new MKLDNNEdge(residual, mvnNode, inNum, static_cast<int>(residualPort)));
+            graph.GetEdges().push_back(newEdge);
+            residual->addEdge(newEdge);
+            mvnNode->inputShapes.push_back(addNode->getInputShapeAtPort(1));
+            mvnNode->addOriginalInputPrecision(addNode->getOriginalInputPrecisionAtPort(1));
+            mvnNode->fuseResidual(residualPort);
+
+            mvnNode->addOriginalLayer(addNode->getOriginalLayers());
+            graph.DropNode(addNode);
+        }
+
+        if (mvnNode->getChildEdges().size() != 1)
+            continue;
+
+        std::vector<float> gamma;
+        std::vector<float> beta;
+        auto childNode = mvnNode->getChildEdgeAt(0)->getChild();
+        if (isSuitableEltwise(childNode, EltwiseMultiply, dataDims)) {
+            if (auto constant = getAffineConstant(childNode, mvnNode, rowSize)) {
+                gamma = readConstant(constant);
+                dropAffineNode(mvnNode, childNode);
+                childNode = mvnNode->getChildEdges().size() == 1 ? mvnNode->getChildEdgeAt(0)->getChild() : nullptr;
+            }
+        }
+        if (childNode && isSuitableEltwise(childNode, EltwiseAdd, dataDims)) {
+            if (auto constant = getAffineConstant(childNode, mvnNode, rowSize)) {
+                beta = readConstant(constant);
+                dropAffineNode(mvnNode, childNode);
+            }
+        }
+        if (!gamma.empty() || !beta.empty())
+            mvnNode->fuseAffine(gamma, beta);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseMVNAndSimpleOperation(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1488,6 +1719,55 @@ void MKLDNNGraphOptimizer::DropDoubleReorders(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseReduceAndInputEltwise(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // Square -> ReduceSum and Abs -> ReduceSum are computed by the reduce kernels in one pass as ReduceSumSquare and ReduceL1,
+    // so the full size intermediate tensor is neither written nor read
+    auto getFusedAlgorithm = [](const MKLDNNNodePtr& node) {
+        if (node->getType() != Eltwise || node->getChildEdges().size() != 1 || !node->getFusedWith().empty() ||
+                node->getOriginalInputPrecisionAtPort(0) != Precision::FP32 || node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return Algorithm::Default;
+
+        auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
+        if (eltwiseNode == nullptr)
+            return Algorithm::Default;
+
+        if (node->getAlgorithm() == EltwiseAbs)
+            return ReduceL1;
+        if (node->getAlgorithm() == EltwisePowerStatic && eltwiseNode->getAlpha() == 2.f && eltwiseNode->getBeta() == 1.f &&
+                eltwiseNode->getGamma() == 0.f)
+            return ReduceSumSquare;
+        if (node->getAlgorithm() == EltwiseMultiply && node->getParentEdges().size() == 2) {
+            const auto edge0 = node->getParentEdgeAt(0);
+            const auto edge1 = node->getParentEdgeAt(1);
+            if (edge0->getParent() == edge1->getParent() && edge0->getInputNum() == edge1->getInputNum())
+                return ReduceSumSquare;
+        }
+        return Algorithm::Default;
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto reduceNode = graphNodes[i];
+        if (reduceNode->getType() != Reduce || reduceNode->getAlgorithm() != ReduceSum)
+            continue;
+
+        auto eltwiseNode = reduceNode->getParentEdgesAtPort(0)[0]->getParent();
+        const auto fusedAlgorithm = getFusedAlgorithm(eltwiseNode);
+        if (fusedAlgorithm == Algorithm::Default)
+            continue;
+
+        // x * x reads the same output twice, one of the edges goes away with the node
+        if (eltwiseNode->getParentEdges().size() == 2) {
+            auto secondEdge = eltwiseNode->getParentEdgeAt(1);
+            secondEdge->drop();
+            graph.RemoveEdge(secondEdge);
+        }
+        reduceNode->setAlgorithm(fusedAlgorithm);
+        graph.DropNode(eltwiseNode);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseBroadcastAndEltwise(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1567,6 +1847,119 @@ void MKLDNNGraphOptimizer::FuseClampAndFakeQuantize(MKLDNNGraph &graph) {
     }
 }
 
+/*
+ * The FakeQuantize kernel stores its output in any of FP32, U8 and I8 precisions, so the Convert following it is folded
+ * into the kernel as long as the conversion is exact: every quantized value is an integer fitting both precisions,
+ * so neither the rounding mode nor the saturation of the Convert matter. When the FakeQuantize is fused into
+ * the producer later, the producer writes the converted precision directly.
+ */
+void MKLDNNGraphOptimizer::FuseFakeQuantizeAndConvert(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto getPrecisionRange = [](Precision prc, float& low, float& high) {
+        switch (prc) {
+            case Precision::U8: low = 0.f; high = 255.f; return true;
+            case Precision::I8: low = -128.f; high = 127.f; return true;
+            case Precision::FP32: low = -(1 << 24); high = 1 << 24; return true;
+            default: return false;
+        }
+    };
+
+    auto isExactConversion = [&](const MKLDNNFakeQuantizeNode* fakeQuantizeNode, Precision dstPrc) {
+        float srcLow, srcHigh, dstLow, dstHigh;
+        if (!getPrecisionRange(fakeQuantizeNode->getOutputPrecision(), srcLow, srcHigh) || !getPrecisionRange(dstPrc, dstLow, dstHigh))
+            return false;
+        const float low = std::max(srcLow, dstLow);
+        const float high = std::min(srcHigh, dstHigh);
+
+        const auto& cropLow = fakeQuantizeNode->getCropLow();
+        const auto& cropHigh = fakeQuantizeNode->getCropHigh();
+        const auto& inputScale = fakeQuantizeNode->getInputScale();
+        const auto& inputShift = fakeQuantizeNode->getInputShift();
+        const auto& outputScale = fakeQuantizeNode->getOutputScale();
+        const auto& outputShift = fakeQuantizeNode->getOutputShift();
+        const size_t size = std::max({cropLow.size(), cropHigh.size(), inputScale.size(), inputShift.size(), outputScale.size(), outputShift.size()});
+        auto at = [](const std::vector<float>& values, size_t i) {
+            return values.size() == 1 ? values[0] : values[i];
+        };
+
+        for (size_t i = 0; i < size; i++) {
+            const float scale = at(outputScale, i);
+            const float shift = at(outputShift, i);
+            if (std::round(scale) != scale || std::round(shift) != shift)
+                return false;
+
+            const float levelFirst = std::round(at(cropLow, i) * at(inputScale, i) + at(inputShift, i));
+            const float levelLast = std::round(at(cropHigh, i) * at(inputScale, i) + at(inputShift, i));
+            const float first = levelFirst * scale + shift;
+            const float last = levelLast * scale + shift;
+            if (std::min(first, last) < low || std::max(first, last) > high)
+                return false;
+        }
+        return true;
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto parent = graphNodes[i];
+        if (parent->getType() != FakeQuantize || parent->getAlgorithm() == FQBinarization || parent->getChildEdges().size() != 1)
+            continue;
+
+        auto child = parent->getChildEdgeAt(0)->getChild();
+        if (child->getType() != Convert)
+            continue;
+
+        auto* fakeQuantizeNode = dynamic_cast<MKLDNNFakeQuantizeNode*>(parent.get());
+        if (fakeQuantizeNode == nullptr)
+            IE_THROW() << "Cannot cast " << parent->getName() << " to FakeQuantize node";
+
+        const auto dstPrc = child->getOriginalOutputPrecisionAtPort(0);
+        if (!isExactConversion(fakeQuantizeNode, dstPrc))
+            continue;
+
+        fakeQuantizeNode->setOutputPrecision(dstPrc);
+        graph.DropNode(child);
+    }
+}
+
+/*
+ * The Eltwise kernels load U8 and I8 inputs with the conversion to FP32, so the Convert of the integer network input
+ * feeding only Eltwise nodes (e.g. the mean and scale of the image) is dropped and the full-size FP32 copy of the input
+ * is never written. The pass runs after the Eltwise fusings, so it doesn't change the precision of the nodes fused
+ * into the convolutions, and only the own ports of the Eltwise nodes are handled, the ports added by the fused
+ * Eltwise nodes keep their precision.
+ */
+void MKLDNNGraphOptimizer::FuseInputConvertAndEltwise(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableChildEdge = [](const MKLDNNEdgePtr& edge) {
+        const auto child = edge->getChild();
+        return child->getType() == Eltwise && edge->getOutputNum() < child->getOriginalInputsNumber();
+    };
+
+    for (const auto& node : graphNodes) {
+        if (node->getType() != Convert || node->getParentEdges().size() != 1 || node->getChildEdges().empty() ||
+            node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+
+        const auto parent = node->getParentEdgeAt(0)->getParent();
+        if (parent->getType() != Input || parent->isConstant())
+            continue;
+
+        const auto srcPrc = parent->getOriginalOutputPrecisionAtPort(0);
+        if (!one_of(srcPrc, Precision::U8, Precision::I8))
+            continue;
+
+        const auto childEdges = node->getChildEdgesAtPort(0);
+        if (childEdges.size() != node->getChildEdges().size() ||
+            !std::all_of(childEdges.begin(), childEdges.end(), isSuitableChildEdge))
+            continue;
+
+        for (const auto& edge : childEdges)
+            edge->getChild()->setOriginalInputPrecisionAtPort(edge->getOutputNum(), srcPrc);
+        graph.DropNode(node);
+    }
+}
+
 void MKLDNNGraphOptimizer::FusePerformedAsScaleShiftAndFakeQuantize(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -21,6 +21,7 @@ public:
 private:
     void FuseConvolutionAndBias(MKLDNNGraph &graph);
     void FuseDeconvolutionAndSimpleOperation(MKLDNNGraph &graph);
+    void FuseFCAndWeightsDecompression(MKLDNNGraph &graph);
     void FuseMultiplyAndAdd(MKLDNNGraph &graph);
     void FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &graph);
     void FuseMatMulAndSimpleOperation(MKLDNNGraph &graph);
@@ -29,6 +30,8 @@ private:
     void FuseConvolutionAndDWConvolution(MKLDNNGraph &graph);
     void FusePoolingAndFakeQuantize(MKLDNNGraph &graph);
     void FuseConvolutionSumAndConvolutionSumActivation(MKLDNNGraph &graph);
+    void FuseMVNResidualAndAffine(MKLDNNGraph &graph);
+    void FuseReduceAndInputEltwise(MKLDNNGraph &graph);
     void FuseMVNAndSimpleOperation(MKLDNNGraph &graph);
     void FuseInterpolateAndSimpleOperation(MKLDNNGraph &graph);
     void FuseNormalizeL2AndSimpleOperation(MKLDNNGraph &graph);
@@ -39,6 +42,8 @@ private:
     void FuseEltwiseAndSimple(MKLDNNGraph &graph);
     void FusePerformedAsScaleShiftAndFakeQuantize(MKLDNNGraph &graph);
     void FuseClampAndFakeQuantize(MKLDNNGraph &graph);
+    void FuseFakeQuantizeAndConvert(MKLDNNGraph &graph);
+    void FuseInputConvertAndEltwise(MKLDNNGraph &graph);
     void MergeTransposeAndReorder(MKLDNNGraph &graph);
     void reshapeRnnSeq(MKLDNNGraph &graph);
 };
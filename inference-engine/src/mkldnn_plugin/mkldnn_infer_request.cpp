@@ -101,13 +101,53 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
     graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
 }
 
+// Returns the data of the first sample if the samples follow each other in memory, so the batch may be used in place
+static void* getContiguousBatchData(const InferenceEngine::BatchedBlob& batched) {
+    auto data = batched.getBlob(0)->buffer().as<uint8_t*>();
+    for (size_t i = 1; i < batched.size(); i++) {
+        const auto sample = batched.getBlob(i);
+        if (sample->buffer().as<uint8_t*>() != data + i * sample->byteSize())
+            return nullptr;
+    }
+    return data;
+}
+
+static void copyBatchData(const InferenceEngine::BatchedBlob& batched, uint8_t* dst) {
+    for (size_t i = 0; i < batched.size(); i++) {
+        const auto sample = batched.getBlob(i);
+        cpu_parallel_memcpy(dst + i * sample->byteSize(), sample->cbuffer().as<const uint8_t*>(), sample->byteSize());
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::pushBatchedInput(const std::string& inputName, const InferenceEngine::BatchedBlob& batched,
+                                                        InferenceEngine::Precision inPrec) {
+    const auto& blobDesc = batched.getTensorDesc();
+    auto& memory = graph->getInputNodeByName(inputName)->getChildEdgesAtPort(0)[0]->getMemory();
+    // the samples are copied right to the input memory when it has the same layout and no conversion is needed
+    if (inPrec == blobDesc.getPrecision() && !graph->hasMeanImageFor(inputName) &&
+        memory.getDesc().isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(blobDesc))) {
+        auto dst = static_cast<uint8_t*>(memory.GetData());
+        // the input memory may be the samples themselves
+        if (getContiguousBatchData(batched) != dst)
+            copyBatchData(batched, dst);
+        return;
+    }
+
+    // otherwise the samples are gathered to a contiguous blob which is pushed as usual
+    InferenceEngine::Blob::Ptr contiguous = make_blob_with_precision(blobDesc);
+    contiguous->allocate();
+    copyBatchData(batched, contiguous->buffer().as<uint8_t*>());
+    pushInput(inputName, contiguous, inPrec);
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
     for (auto input : _inputs) {
         if (!_networkInputs[input.first]) {
             IE_THROW() << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << input.first;
         }
         auto inPrec = input.second->getTensorDesc().getPrecision();
-        if (graph->hasMeanImageFor(input.first) && one_of(inPrec, InferenceEngine::Precision::U8, InferenceEngine::Precision::BOOL)) {
+        // U8 images are converted by the graph while they are normalized
+        if (graph->hasMeanImageFor(input.first) && inPrec == InferenceEngine::Precision::BOOL) {
             inPrec = InferenceEngine::Precision::FP32;
         } else {
             inPrec = normalizeToSupportedPrecision(inPrec);
@@ -123,45 +163,87 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
             input.second->getTensorDesc().setLayout(_networkInputs[input.first]->getLayout());
         }
 
+        if (auto batched = input.second->as<InferenceEngine::BatchedBlob>()) {
+            pushBatchedInput(input.first, *batched, inPrec);
+            continue;
+        }
         pushInput(input.first, input.second, inPrec);
     }
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
+void MKLDNNPlugin::MKLDNNInferRequest::bindStates() {
+    // the states are matched with the graph nodes once per graph, so a step of a stateful network doesn't search for them
+    if (stateBindingsGraph == graph)
+        return;
+
+    stateBindings.clear();
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
             auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<MKLDNNVariableState>(state);
+                    IE_ASSERT(cur_state != nullptr);
+                    stateBindings.push_back({cur_node, cur_state, false, 0, 0});
                 }
             }
         }
     }
+    stateBindingsGraph = graph;
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
+void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
+    bindStates();
+    for (auto &binding : stateBindings) {
+        auto cur_node = binding.node;
+        const auto& state = binding.state;
+        if (cur_node->isDynamicNode())
+            cur_node->resizeStore(state->GetState()->getTensorDesc().getDims());
+
+        auto cur_state_mem = cur_node->getStore();
+        auto data_ptr = state->GetState()->cbuffer().as<void*>();
+        auto data_size = state->GetState()->byteSize();
+        auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
+
+        if (cur_node->getStateMode() == MKLDNNMemoryInputNode::StateMode::InPlace) {
+            // The graph reads and writes the state of this request right in its blob
+            if (data_size == cur_state_mem->GetSize()) {
+                cur_node->setStateData(data_ptr);
+                continue;
             }
+            cur_node->setStateData(cur_state_mem->GetData());
         }
+
+        // The store still holds the state pulled by this request, if neither the user nor another request changed them
+        if (binding.pulled && binding.stateVersion == state->getVersion() &&
+            binding.storeVersion == cur_node->getStoreVersion())
+            continue;
+
+        cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+        cur_node->touchStore();
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
+    for (auto &binding : stateBindings) {
+        auto cur_node = binding.node;
+        const auto& state = binding.state;
+        auto cur_state_mem = cur_node->getStore();
+        if (cur_node->isDynamicNode())
+            state->resize(cur_state_mem->getStaticDims());
+
+        auto data_ptr = state->GetState()->cbuffer().as<void*>();
+        auto data_size = state->GetState()->byteSize();
+        auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
+
+        if (cur_node->getStateData() == data_ptr)
+            continue;
+
+        cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+        binding.pulled = true;
+        binding.stateVersion = state->getVersion();
+        binding.storeVersion = cur_node->getStoreVersion();
     }
 }
 
@@ -355,6 +437,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
     InferenceEngine::DataPtr foundOutput;
     const bool isInput = findInputAndOutputBlobByName(name, foundInput, foundOutput);
     const bool compoundBlobPassed = data->is<InferenceEngine::CompoundBlob>();
+    const bool batchedBlobPassed = data->is<InferenceEngine::BatchedBlob>();
     if (!compoundBlobPassed && data->buffer() == nullptr)
         IE_THROW(NotAllocated) << "Input data was not allocated. Input name: \'" << name << "\'";
     IE_SUPPRESS_DEPRECATED_START
@@ -364,8 +447,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
     }
     IE_SUPPRESS_DEPRECATED_END
 
-    size_t dataSize = data->size();
     const auto &blobDesc = data->getTensorDesc();
+    // the size of a compound blob is the number of its blobs
+    size_t dataSize = batchedBlobPassed ? InferenceEngine::details::product(blobDesc.getDims()) : data->size();
 
     if (isInput) {
         if (foundInput->getPrecision() != blobDesc.getPrecision()) {
@@ -374,9 +458,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
         }
 
         const bool preProcRequired = preProcessingRequired(foundInput, data);
-        if (compoundBlobPassed && !preProcRequired) {
+        if (compoundBlobPassed && !preProcRequired && !batchedBlobPassed) {
             IE_THROW(NotImplemented)
-                               << "cannot set compound blob: supported only for input pre-processing";
+                               << "cannot set compound blob: supported only for input pre-processing and batched blobs";
         }
 
         if (preProcRequired) {
@@ -404,6 +488,21 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
                 IE_THROW(ParameterMismatch) << "Failed to set input blob. Dimensions mismatch.";
             }
 
+            void* blobData = nullptr;
+            if (batchedBlobPassed) {
+                if (isDynamic)
+                    IE_THROW(NotImplemented) << "cannot set batched blob to input with dynamic shape: " << name;
+                auto batched = data->as<InferenceEngine::BatchedBlob>();
+                for (size_t i = 0; i < batched->size(); i++) {
+                    const auto sample = batched->getBlob(i);
+                    if (sample->is<InferenceEngine::CompoundBlob>() || sample->buffer() == nullptr)
+                        IE_THROW(NotAllocated) << "Sample " << i << " of batched blob was not allocated. Input name: \'" << name << "\'";
+                }
+                blobData = getContiguousBatchData(*batched);
+            } else {
+                blobData = data->buffer();
+            }
+
             if (blobDesc.getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY) {
                 if (isDynamic && InferenceEngine::TensorDesc(foundInput->getPrecision(), blobDesc.getDims(), foundInput->getLayout()).getBlockingDesc() !=
                         blobDesc.getBlockingDesc())
@@ -414,10 +513,10 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             }
 
             const auto &actualDesc = graph->getInputNodeByName(name)->getChildEdgesAtPort(0)[0]->getMemory().getDesc();
-            if (blobDesc.getLayout() != InferenceEngine::Layout::ANY &&
+            if (blobData != nullptr && blobDesc.getLayout() != InferenceEngine::Layout::ANY &&
                 actualDesc.isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(blobDesc)) &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
-                externalPtr[name] = data->buffer();
+                externalPtr[name] = blobData;
             } else if (externalPtr.find(name) != externalPtr.end()) {
                 externalPtr.erase(name);
             }
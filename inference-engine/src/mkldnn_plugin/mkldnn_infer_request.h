@@ -9,11 +9,14 @@
 #include <string>
 #include <map>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <ie_compound_blob.h>
 
 namespace MKLDNNPlugin {
 
 class MKLDNNExecNetwork;
 class MKLDNNAsyncInferRequest;
+class MKLDNNMemoryInputNode;
+class MKLDNNVariableState;
 
 class MKLDNNInferRequest : public InferenceEngine::IInferRequestInternal {
 public:
@@ -51,9 +54,11 @@ private:
     void PushInputData();
     void PushStates();
     void PullStates();
+    void bindStates();
     void redefineMemoryForInputNodes();
 
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
+    void pushBatchedInput(const std::string& inputName, const InferenceEngine::BatchedBlob& batched, InferenceEngine::Precision dataType);
 
     void changeDefaultPtr();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
@@ -62,5 +67,19 @@ private:
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
+
+    /**
+     * @brief The state of the request bound to the state node of the graph. The store and the state hold the same data
+     * while both versions are unchanged since the state was pulled, so the state isn't pushed again.
+     */
+    struct StateBinding {
+        MKLDNNMemoryInputNode* node;
+        std::shared_ptr<MKLDNNVariableState> state;
+        bool pulled;
+        size_t stateVersion;
+        size_t storeVersion;
+    };
+    std::vector<StateBinding>           stateBindings;
+    const MKLDNNGraph*                  stateBindingsGraph = nullptr;
 };
 }  // namespace MKLDNNPlugin
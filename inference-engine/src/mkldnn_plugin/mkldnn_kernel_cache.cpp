@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_kernel_cache.hpp"
+
+namespace MKLDNNPlugin {
+
+MKLDNNKernelCache& MKLDNNKernelCache::getInstance() {
+    static MKLDNNKernelCache cache;
+    return cache;
+}
+
+std::shared_ptr<void> MKLDNNKernelCache::find(const std::string& key) {
+    std::lock_guard<std::mutex> lock(_guard);
+    auto found = _kernels.find(key);
+    if (found != _kernels.end()) {
+        if (auto kernel = found->second.lock()) {
+            _hits++;
+            return kernel;
+        }
+    }
+    _misses++;
+    return nullptr;
+}
+
+std::shared_ptr<void> MKLDNNKernelCache::insert(const std::string& key, std::shared_ptr<void> value) {
+    if (value == nullptr)
+        return value;
+
+    std::lock_guard<std::mutex> lock(_guard);
+    auto& stored = _kernels[key];
+    if (auto kernel = stored.lock()) {
+        // the same kernel was generated concurrently by another node, share the stored one
+        return kernel;
+    }
+    stored = value;
+
+    // the entries of the released kernels are dropped once they outnumber the alive ones
+    if (_kernels.size() > 64) {
+        size_t expired = 0;
+        for (const auto& entry : _kernels)
+            expired += entry.second.expired();
+        if (expired * 2 > _kernels.size()) {
+            for (auto it = _kernels.begin(); it != _kernels.end();) {
+                if (it->second.expired())
+                    it = _kernels.erase(it);
+                else
+                    ++it;
+            }
+        }
+    }
+    return value;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Process wide store of the generated plugin JIT kernels
+ * Repetitive architectures (e.g. transformer layers) have many nodes with the same kernel configuration, they share
+ * one immutable kernel instead of generating its copy per node. Only kernels fully described by their config
+ * params may be shared: the kernels with post ops embed pointers to the data of the particular fused nodes.
+ * The entries are held weakly, so a kernel is released together with the last node using it.
+ *
+ * Is a thread safe
+ */
+class MKLDNNKernelCache {
+public:
+    static MKLDNNKernelCache& getInstance();
+
+    /**
+     * Returns the kernel stored for the key or creates a new one with builder and stores it
+     * @param key kernel key, it has to describe everything the generated code depends on
+     * @param builder callable returning std::shared_ptr<T> with the created kernel, it is called without holding
+     * the cache lock
+     */
+    template <typename T, typename Builder>
+    std::shared_ptr<T> getOrCreate(const std::string& key, Builder&& builder) {
+        if (auto cached = find(key))
+            return std::static_pointer_cast<T>(cached);
+        std::shared_ptr<T> created = builder();
+        return std::static_pointer_cast<T>(insert(key, created));
+    }
+
+    uint64_t hits() const { return _hits; }
+    uint64_t misses() const { return _misses; }
+
+private:
+    MKLDNNKernelCache() = default;
+
+    std::shared_ptr<void> find(const std::string& key);
+    std::shared_ptr<void> insert(const std::string& key, std::shared_ptr<void> value);
+
+    std::mutex _guard;
+    std::unordered_map<std::string, std::weak_ptr<void>> _kernels;
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _misses{0};
+};
+
+/**
+ * Appends the bytes of the trivially copyable value (config param field) to the kernel key
+ */
+template <typename T>
+void appendKernelKey(std::string& key, const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "kernel key field must be trivially copyable");
+    key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/**
+ * Creates the Kernel (jit_uni_*_kernel_f32<isa>) with args and generates its code, the kernel is shared through
+ * the kernel cache unless the key is empty
+ */
+template <typename Base, typename Kernel, typename... Args>
+std::shared_ptr<Base> createSharedKernel(const std::string& key, Args&&... args) {
+    auto builder = [&]() {
+        std::shared_ptr<Base> kernel = std::make_shared<Kernel>(std::forward<Args>(args)...);
+        kernel->create_ker();
+        return kernel;
+    };
+    if (key.empty())
+        return builder();
+    return MKLDNNKernelCache::getInstance().getOrCreate<Base>(std::string(typeid(Kernel).name()) + ':' + key, builder);
+}
+
+}  // namespace MKLDNNPlugin
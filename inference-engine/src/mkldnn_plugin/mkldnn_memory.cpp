@@ -22,6 +22,7 @@
 #include "utils/cpu_utils.hpp"
 #include "nodes/mkldnn_reorder_node.h"
 #include "memory_desc/cpu_memory_desc.h"
+#include "utils/huge_pages.h"
 
 using namespace InferenceEngine;
 using namespace mkldnn;
@@ -60,7 +61,16 @@ void MKLDNNMemory::Create(const memory::dims& dims, memory::data_type data_type,
 
 void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bool pads_zeroing) {
     if (data == nullptr) {
-        prim.reset(new memory(desc, eng));
+        const auto size = MKLDNNExtensionUtils::getMemSizeForDnnlDesc(desc);
+        auto hugePagesStorage = size == MemoryDesc::UNDEFINED_SIZE ? nullptr
+                                                                   : allocateOnHugePages(size, HugePagesScope::current());
+        if (hugePagesStorage) {
+            prim.reset(new memory(desc, eng, DNNL_MEMORY_NONE));
+            prim->set_data_handle(hugePagesStorage.get());
+        } else {
+            prim.reset(new memory(desc, eng));
+        }
+        storage = std::move(hugePagesStorage);
 
         size_t real_size = 0;
         if (desc.data.format_kind == dnnl_format_kind_wino)
@@ -79,6 +89,8 @@ void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bo
         // Equivalent of constructor memory(const primitive_desc &desc, void *hdl)
         // but with ability to skipp pads zeroing.
         prim.reset(new memory(desc, eng, DNNL_MEMORY_NONE));
+        if (data != storage.get())
+            storage.reset();
         if (pads_zeroing)
             prim->set_data_handle(const_cast<void*>(data));
         else
@@ -126,6 +126,8 @@ private:
     mkldnn::engine eng;
     bool useExternalStorage = false;
     size_t memUpperBound = 0ul;
+    // the buffer allocated on the huge pages instead of oneDNN allocation, see HugePagesScope
+    std::shared_ptr<void> storage;
 };
 
 using MKLDNNMemoryPtr = std::shared_ptr<MKLDNNMemory>;
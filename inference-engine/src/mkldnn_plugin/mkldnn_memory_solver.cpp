@@ -8,12 +8,15 @@
 
 
 #include <algorithm>
+#include <limits>
+#include <utility>
 #include <vector>
 #include <map>
 
 namespace MKLDNNPlugin {
 
-MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
+MemorySolver::MemorySolver(const std::vector<Box>& boxes, Strategy strategy, const std::map<int64_t, int64_t>& alignments)
+    : _boxes(boxes), _strategy(strategy), _alignments(alignments) {
     int max_ts = 0;
     // TODO: add validation of data correctness:
     // 1. Box.start >= 0 and Box.finish >= -1
@@ -46,11 +49,15 @@ MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
     _time_duration = ts_f - rm_ts_f;
 }
 
-inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Box &box_old) {
+inline int64_t alignOffset(int64_t offset, int64_t alignment) {
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Box &box_old, int64_t alignment) {
     if (box_new.id+box_new.size > box_old.id &&
         box_old.id+box_old.size > box_new.id) {
         // Move the new one up. There is an intersection
-        box_new.id = box_old.id + box_old.size;
+        box_new.id = alignOffset(box_old.id + box_old.size, alignment);
         return true;
     } else {
         return false;
@@ -58,6 +65,10 @@ inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Bo
 }
 
 int64_t MemorySolver::solve() {
+    return _strategy == Strategy::BestFit ? solveBestFit() : solveGreedy();
+}
+
+int64_t MemorySolver::solveGreedy() {
     maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
     std::vector<std::vector<const Box*>> time_slots(_time_duration);
     for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
@@ -72,6 +83,7 @@ int64_t MemorySolver::solve() {
     for (Box& box : _boxes) {
         // start from bottom and will lift it up if intersect with other present
         int64_t id = box.id;
+        const int64_t alignment = getAlignment(id);
         box.id = 0;  // id will be used as a temp offset storage
         bool popped_up;
         do {
@@ -80,7 +92,7 @@ int64_t MemorySolver::solve() {
                 for (auto *box_in_slot : time_slots[i_slot]) {
                     // intersect with already stored boxes for all covered time slots
                     // and move up the new one if needed
-                    popped_up |= popupTogetherWith(box, *box_in_slot);
+                    popped_up |= popupTogetherWith(box, *box_in_slot, alignment);
                 }
             }
         } while (popped_up);
@@ -97,6 +109,57 @@ int64_t MemorySolver::solve() {
     return _min_required;
 }
 
+int64_t MemorySolver::solveBestFit() {
+    maxDepth();  // depth calculation relies on boxes sorted by box.start, so do it before reordering
+    // Sort by box size. First is biggest. Among boxes of the same size the longer living one goes first,
+    // it has less chances to find a suitable gap later.
+    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r) {
+        return l.size > r.size || (l.size == r.size && l.finish - l.start > r.finish - r.start);
+    });
+
+    int64_t _min_required = 0;
+    std::vector<const Box*> placed;
+    placed.reserve(_boxes.size());
+    std::vector<std::pair<int64_t, int64_t>> busy;  // [begin, end) memory ranges occupied at the box live time
+    busy.reserve(_boxes.size());
+
+    for (Box& box : _boxes) {
+        const int64_t id = box.id;
+        const int64_t alignment = getAlignment(id);
+
+        busy.clear();
+        for (const Box* other : placed) {
+            if (other->start <= box.finish && box.start <= other->finish)
+                busy.emplace_back(other->id, other->id + other->size);  // id is used as offset storage
+        }
+        std::sort(busy.begin(), busy.end());
+
+        // look for the smallest gap which fits the box, otherwise put it on top of the intersected ones
+        int64_t best_offset = -1;
+        int64_t best_gap = std::numeric_limits<int64_t>::max();
+        int64_t gap_begin = 0;
+        for (const auto& range : busy) {
+            const int64_t candidate = alignOffset(gap_begin, alignment);
+            const int64_t gap = range.first - gap_begin;
+            if (candidate + box.size <= range.first && gap < best_gap) {
+                best_gap = gap;
+                best_offset = candidate;
+            }
+            gap_begin = std::max(gap_begin, range.second);
+        }
+        if (best_offset == -1)
+            best_offset = alignOffset(gap_begin, alignment);
+
+        box.id = best_offset;
+        placed.push_back(&box);
+
+        _min_required = std::max(_min_required, box.id + box.size);
+        _offsets[id] = box.id;
+    }
+
+    return _min_required;
+}
+
 int64_t MemorySolver::maxDepth() {
     if (_depth == -1) calcDepth();
     return _depth;
@@ -115,6 +178,11 @@ int64_t MemorySolver::getOffset(int id) const {
 
 //======== Private =============//
 
+int64_t MemorySolver::getAlignment(int64_t id) const {
+    auto alignment = _alignments.find(id);
+    return alignment == _alignments.end() ? 1 : std::max<int64_t>(alignment->second, 1);
+}
+
 void MemorySolver::calcDepth() {
     int64_t top_depth = 0;
     int64_t depth = 0;
@@ -65,7 +65,27 @@ public:
         int64_t id;
     };
 
-    explicit MemorySolver(const std::vector<Box>& boxes);
+    /** @brief Strategy of boxes placement */
+    enum class Strategy {
+        /** Boxes are placed biggest first, each box is lifted up above all intersected boxes */
+        Greedy,
+        /**
+         * Boxes are placed biggest first (longer living first among equal sizes), each box takes
+         * the smallest free gap between already placed boxes alive at the same time
+         */
+        BestFit,
+    };
+
+    /**
+     * @brief Constructs the solver
+     * @param boxes Boxes to place
+     * @param strategy Placement strategy
+     * @param alignments Required alignment of offset (in the same units as Box::size) keyed by Box::id.
+     *        Boxes absent in the map have no alignment requirements.
+     */
+    explicit MemorySolver(const std::vector<Box>& boxes,
+                          Strategy strategy = Strategy::Greedy,
+                          const std::map<int64_t, int64_t>& alignments = {});
 
     /**
      * @brief Solve memory location with maximal reuse.
@@ -83,12 +103,17 @@ public:
 
 private:
     std::vector<Box> _boxes;
+    Strategy _strategy;
+    std::map<int64_t, int64_t> _alignments;
     std::map<int64_t, int64_t> _offsets;
     int64_t _top_depth = -1;
     int64_t _depth = -1;
     int _time_duration = -1;
 
     void calcDepth();
+    int64_t solveGreedy();
+    int64_t solveBestFit();
+    int64_t getAlignment(int64_t id) const;
 };
 
 }  // namespace MKLDNNPlugin
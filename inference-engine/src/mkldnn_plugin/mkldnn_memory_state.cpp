@@ -6,12 +6,36 @@
 #include "mkldnn_extension_utils.h"
 #include "blob_factory.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
 using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
 
 void  MKLDNNVariableState::Reset() {
+    // the dynamic state gets back to its initial dims
+    resize(initialDims);
     std::memset(state->buffer(), 0, state->byteSize());
+    version++;
+}
+
+void MKLDNNVariableState::SetState(const Blob::Ptr& newState) {
+    IVariableStateInternal::SetState(newState);
+    version++;
+}
+
+void MKLDNNVariableState::resize(const SizeVector& dims) {
+    const auto& desc = state->getTensorDesc();
+    if (desc.getDims() == dims)
+        return;
+
+    TensorDesc newDesc(desc.getPrecision(), dims, TensorDesc::getLayoutByDims(dims));
+    const size_t size = std::accumulate(dims.begin(), dims.end(), desc.getPrecision().size(), std::multiplies<size_t>());
+    if (size > buffer.size() || buffer.empty())
+        std::vector<uint8_t>(std::max<size_t>({size, 2 * buffer.size(), 1})).swap(buffer);
+    state = make_blob_with_precision(newDesc, buffer.data());
 }
 
 }  // namespace MKLDNNPlugin
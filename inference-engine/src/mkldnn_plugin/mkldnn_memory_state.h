@@ -11,6 +11,7 @@
 #include "memory_desc/cpu_memory_desc_utils.h"
 
 #include <string>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -21,9 +22,31 @@ public:
         state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
         state->allocate();
         cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
+        initialDims = state->getTensorDesc().getDims();
     }
 
     void Reset() override;
+
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+
+    /**
+     * @brief The version of the state data, it changes each time the state is set or reset
+     */
+    size_t getVersion() const {
+        return version;
+    }
+
+    /**
+     * @brief Changes the dims of a dynamic state. The state keeps its capacity, so a state growing each inference
+     * isn't reallocated each time. The data isn't kept.
+     * @param dims new dims of the state
+     */
+    void resize(const InferenceEngine::SizeVector& dims);
+
+private:
+    InferenceEngine::SizeVector initialDims;
+    std::vector<uint8_t> buffer;
+    size_t version = 0;
 };
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
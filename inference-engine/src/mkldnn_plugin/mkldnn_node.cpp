@@ -8,6 +8,7 @@
 #include "mkldnn_itt.h"
 
 #include "caseless.hpp"
+#include "ie_data_hash.hpp"
 #include <vector>
 #include <string>
 #include <limits>
@@ -57,6 +58,7 @@
 #include <ie_ngraph_utils.hpp>
 #include "utils/general_utils.h"
 #include "utils/cpu_utils.hpp"
+#include "utils/shape_inference/shape_inference.hpp"
 #include "nodes/common/cpu_convert.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
@@ -728,8 +730,7 @@ void MKLDNNNode::prepareMemory(const NodeDesc *selected_pd, mkldnn::primitive_de
 
         MKLDNNMemoryPtr ptr;
         if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
+            const uint64_t data_hash = InferenceEngine::computeDataHash(internalBlob->cbuffer(), internalBlob->byteSize());
 
             const std::string string_hash = name + "_" + std::to_string(i)
                                             + "_" + std::to_string(internalBlob->byteSize())
@@ -808,6 +809,15 @@ void MKLDNNNode::addOriginalLayer(const std::string& layerName) {
     }
 }
 
+void MKLDNNNode::addFusionDecision(const std::string& decision) {
+    if (decision.empty()) return;
+    if (fusionDecisions.empty()) {
+        fusionDecisions = decision;
+    } else {
+        fusionDecisions += ";" + decision;
+    }
+}
+
 void MKLDNNNode::cleanup() {
     internalBlobs.clear();
 
@@ -823,6 +833,8 @@ void MKLDNNNode::cleanup() {
 const std::vector<impl_desc_type>& MKLDNNNode::getPrimitivesPriority() {
     std::vector<impl_desc_type> priorities = {
             impl_desc_type::unknown,
+            impl_desc_type::jit_avx512_amx_1x1,
+            impl_desc_type::jit_avx512_amx,
             impl_desc_type::jit_uni_dw,
             impl_desc_type::jit_uni_1x1,
             impl_desc_type::jit_uni,
@@ -1224,6 +1236,23 @@ bool MKLDNNNode::needShapeInfer() const {
 }
 
 std::vector<VectorDims> MKLDNNNode::shapeInfer() const {
+    // the shape inference templates work on the static dims directly, without the ngraph validation
+    std::vector<ov::StaticShape> inputStaticShapes;
+    inputStaticShapes.reserve(opToShapeInfer->get_input_size());
+    for (size_t i = 0; i < opToShapeInfer->get_input_size(); i++) {
+        inputStaticShapes.emplace_back(getParentEdgesAtPort(i)[0]->getMemory().getStaticDims());
+    }
+    std::vector<ov::StaticShape> outputStaticShapes(opToShapeInfer->get_output_size(), ov::StaticShape{});
+    if (ov::shape_inference(opToShapeInfer.get(), inputStaticShapes, outputStaticShapes)) {
+        IE_ASSERT(outputStaticShapes.size() == outputShapes.size());
+
+        std::vector<VectorDims> newOutputShapes(outputStaticShapes.size());
+        for (size_t i = 0; i < newOutputShapes.size(); i++) {
+            newOutputShapes[i] = outputStaticShapes[i].to_shape();
+        }
+        return newOutputShapes;
+    }
+
     for (size_t i = 0; i < opToShapeInfer->get_input_size(); i++) {
         if (!dynamic_cast<ngraph::opset1::Constant *>(opToShapeInfer->get_input_node_ptr(i))) {
             opToShapeInfer->get_input_tensor(i).set_partial_shape(
@@ -19,6 +19,7 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_primitive.h"
 #include "mkldnn_weights_cache.hpp"
+#include "mkldnn_params_cache.hpp"
 #include "mkldnn.hpp"
 #include <openvino/itt.hpp>
 #include "utils/ngraph_utils.hpp"
@@ -268,6 +269,12 @@ public:
         return originalLayers;
     }
 
+    void addFusionDecision(const std::string& decision);
+
+    const std::string &getFusionDecisions() const {
+        return fusionDecisions;
+    }
+
     Type getType() const {
         return type;
     }
@@ -423,6 +430,36 @@ public:
         IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
     }
 
+    /**
+     * Static nodes executing their primitive with primArgs use the scratchpad allocated by the graph once for all the
+     * nodes (see MKLDNNGraph::AllocateScratchpad) instead of the one held by every primitive
+     */
+    void setScratchpadMode(mkldnn::primitive_attr& attr) const {
+        if (!isDynamicNode())
+            attr.set_scratchpad_mode(mkldnn::scratchpad_mode::user);
+    }
+
+    /**
+     * Creates the oneDNN primitive of the static node or takes the one compiled by the graph of another stream
+     * Graphs of all streams are compiled from the same network in the same way, so the node name together with the
+     * selected implementation identifies the primitive. The primitive is shared immutable, the memory arguments are
+     * passed by every graph on execution.
+     */
+    template <typename Prim, typename PD>
+    std::shared_ptr<mkldnn::primitive> createSharedPrimitive(const PD& prim_desc) {
+        auto builder = [&prim_desc]() {
+            return std::make_shared<Prim>(prim_desc);
+        };
+        scratchpadDesc = prim_desc.scratchpad_desc();
+        if (!paramsCache || isDynamicNode())
+            return builder();
+
+        std::string key = getName() + '|' + prim_desc.impl_info_str();
+        for (const auto& md : {prim_desc.src_desc(), prim_desc.dst_desc()})
+            key.append(reinterpret_cast<const char*>(&md.data), sizeof(md.data));
+        return paramsCache->getOrCreate<Prim>(key, builder);
+    }
+
     int getExecIndex() const {
         return execIndex;
     }
@@ -595,6 +632,7 @@ protected:
     std::vector <mkldnn::memory::format_tag> outputMemoryFormatsFilter;
 
     std::string originalLayers;  // contains names of the original layers separated by comma
+    std::string fusionDecisions;  // decisions of the fusion cost model separated by semicolon
 
     MKLDNNNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &w_cache);
     MKLDNNNode(const std::string& type, const std::string& name, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &w_cache);
@@ -615,9 +653,13 @@ protected:
     std::unordered_map<int, mkldnn::memory> primArgs;
     std::vector<mkldnn::memory> binaryPostOpsArgs;
     MKLDNNPrimitive prim;
+    // the user managed scratchpad of prim, zero if the primitive holds the scratchpad itself
+    mkldnn::memory::desc scratchpadDesc;
     std::vector<MKLDNNDescriptor> descs;
 
     MKLDNNWeightsSharing::Ptr weightCache;
+    // may be null, nodes must create their executors directly in that case
+    MKLDNNParamsCache::Ptr paramsCache;
 
     Algorithm algorithm = Algorithm::Default;
 
@@ -769,8 +811,7 @@ class MKLDNNNode::NodesFactory : public openvino::cc::Factory<Type,
                                                         const mkldnn::engine &,
                                                         MKLDNNWeightsSharing::Ptr &)> {
 public:
-    NodesFactory()
-        : Factory("NodesFactory") {}
+    NodesFactory();
 
     MKLDNNNode* create(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
                        const MKLDNNExtensionManager::Ptr& extMgr, MKLDNNWeightsSharing::Ptr &w_cache);
@@ -784,15 +825,4 @@ struct MKLDNNNodeImpl : public MKLDNNNodeType {
     }
 };
 
-#define REG_MKLDNN_CONCAT3_(X, Y, Z) X ## Y ## Z
-#define REG_MKLDNN_CONCAT3(X, Y, Z) REG_MKLDNN_CONCAT3_(X, Y, Z)
-
-#define REG_MKLDNN_PRIM_FOR(__prim, __type)                                                 \
-static struct REG_MKLDNN_CONCAT3(Registrar4, __prim, __LINE__) {                            \
-    REG_MKLDNN_CONCAT3(Registrar4, __prim, __LINE__)() {                                    \
-        MKLDNNNode::factory()                                                               \
-            .registerNodeIfRequired(MKLDNNPlugin, __prim, __type, MKLDNNNodeImpl<__prim>);  \
-    }                                                                                       \
-} REG_MKLDNN_CONCAT3(_reg_, __prim, __LINE__);
-
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_params_cache.hpp"
+
+namespace MKLDNNPlugin {
+
+MKLDNNParamsCache::MKLDNNParamsCache(size_t capacity) : _capacity(capacity) {}
+
+std::shared_ptr<void> MKLDNNParamsCache::find(const std::string& key) {
+    std::lock_guard<std::mutex> lock(_guard);
+    auto found = _index.find(key);
+    if (found == _index.end()) {
+        _misses++;
+        return nullptr;
+    }
+    _entries.splice(_entries.begin(), _entries, found->second);
+    _hits++;
+    return found->second->second;
+}
+
+std::shared_ptr<void> MKLDNNParamsCache::insert(const std::string& key, std::shared_ptr<void> value) {
+    if (_capacity == 0 || value == nullptr)
+        return value;
+
+    std::lock_guard<std::mutex> lock(_guard);
+    auto found = _index.find(key);
+    if (found != _index.end()) {
+        // the same object was created concurrently by another stream, share the stored one
+        _entries.splice(_entries.begin(), _entries, found->second);
+        return found->second->second;
+    }
+
+    _entries.emplace_front(key, std::move(value));
+    _index.emplace(key, _entries.begin());
+    if (_entries.size() > _capacity) {
+        _index.erase(_entries.back().first);
+        _entries.pop_back();
+    }
+    return _entries.front().second;
+}
+
+size_t MKLDNNParamsCache::size() const {
+    std::lock_guard<std::mutex> lock(_guard);
+    return _entries.size();
+}
+
+}  // namespace MKLDNNPlugin
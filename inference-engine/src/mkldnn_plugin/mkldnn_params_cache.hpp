@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Bounded LRU store of compiled primitives and kernels
+ * Nodes with dynamic shapes recreate their executors each time input shapes change. When the shapes repeat, the
+ * executor is taken from the cache instead of compiling it again. The graphs of all streams share the cache, so the
+ * oneDNN primitives of static nodes are compiled by the first graph only.
+ * The key is built by the node and has to describe everything the cached object depends on. Within a single network
+ * the node name identifies static properties of the node (type, precisions, fused operations), so the cache should not
+ * be shared between different networks.
+ *
+ * Is a thread safe
+ */
+class MKLDNNParamsCache {
+public:
+    typedef std::shared_ptr<MKLDNNParamsCache> Ptr;
+
+    /**
+     * @param capacity maximal number of stored entries, least recently used ones are evicted first
+     */
+    explicit MKLDNNParamsCache(size_t capacity);
+
+    /**
+     * Returns the cached object or creates a new one with builder and stores it
+     * @param key object key, it is combined with the object type internally
+     * @param builder callable returning std::shared_ptr<T>, it is called without holding the cache lock
+     */
+    template <typename T, typename Builder>
+    std::shared_ptr<T> getOrCreate(const std::string& key, Builder&& builder) {
+        const std::string fullKey = std::string(typeid(T).name()) + ':' + key;
+        if (auto cached = find(fullKey))
+            return std::static_pointer_cast<T>(cached);
+        std::shared_ptr<T> created = builder();
+        return std::static_pointer_cast<T>(insert(fullKey, created));
+    }
+
+    uint64_t hits() const { return _hits; }
+    uint64_t misses() const { return _misses; }
+    size_t size() const;
+
+private:
+    std::shared_ptr<void> find(const std::string& key);
+    std::shared_ptr<void> insert(const std::string& key, std::shared_ptr<void> value);
+
+    using Entry = std::pair<std::string, std::shared_ptr<void>>;
+
+    const size_t _capacity;
+    mutable std::mutex _guard;
+    std::list<Entry> _entries;  // most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> _index;
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _misses{0};
+};
+
+}  // namespace MKLDNNPlugin
@@ -8,10 +8,13 @@
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn_itt.h"
 #include "mkldnn_serialize.h"
+#include "mkldnn_shape_buckets.h"
 
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
 #include <ie_plugin_config.hpp>
+#include "cpu/cpu_config.hpp"
+#include "cpu/cpu_params.hpp"
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <ie_icore.hpp>
 #include <fstream>
@@ -27,6 +30,7 @@
 
 #include <transformations/common_optimizations/common_optimizations.hpp>
 #include <transformations/common_optimizations/weights_dequantize_to_fake_quantize.hpp>
+#include <transformations/common_optimizations/matmul_weights_decompression.hpp>
 #include "transformations/common_optimizations/convert_quantize_dequantize.hpp"
 #include <transformations/op_conversions/convert_depth_to_space.hpp>
 #include <transformations/op_conversions/convert_shuffle_channels3.hpp>
@@ -121,6 +125,7 @@ Engine::~Engine() {
     ExecutorManager::getInstance()->clear("CPU");
     ExecutorManager::getInstance()->clear("CPUStreamsExecutor");
     ExecutorManager::getInstance()->clear("CPUCallbackExecutor");
+    ExecutorManager::getInstance()->clear("CPUSharedStreamsExecutor");
 }
 
 static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function> nGraphFunc, const bool _enableLPT) {
@@ -157,6 +162,10 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
 
     static const auto precisions = get_convert_precisions();
 
+    if (!useLpt) {
+        // keeps i8/u8 weights of MatMul compressed, the scale is applied to the FullyConnected output
+        manager.register_pass<ngraph::pass::MatMulWeightsDecompression>();
+    }
     // WA: ConvertPriorBox must be executed before the 1st ConstantFolding pass
     manager.register_pass<ngraph::pass::CommonOptimizations>();
     manager.register_pass<ngraph::pass::ConvertRNNSequenceToTensorIterator>();
@@ -456,6 +465,24 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     }
 
     auto config = orig_config;
+
+    // the network with dynamic inputs is compiled for each of the shape buckets, the buckets are compiled as usual networks
+    auto shapeBuckets = engConfig.shapeBuckets;
+    const auto shapeBucketsProp = config.find(CPUConfigParams::KEY_CPU_SHAPE_BUCKETS);
+    if (shapeBucketsProp != config.end())
+        shapeBuckets = shapeBucketsProp->second;
+    if (!shapeBuckets.empty()) {
+        auto bucketConfig = config;
+        bucketConfig[CPUConfigParams::KEY_CPU_SHAPE_BUCKETS] = "";
+        std::vector<MKLDNNShapeBucketsExecNetwork::Bucket> buckets;
+        for (auto&& inputShapes : parseShapeBuckets(shapeBuckets)) {
+            CNNNetwork bucketNetwork = InferenceEngine::details::cloneNetwork(network);
+            bucketNetwork.reshape(inputShapes);
+            buckets.push_back({inputShapes, LoadNetwork(bucketNetwork, bucketConfig)});
+        }
+        return std::make_shared<MKLDNNShapeBucketsExecNetwork>(network, std::move(buckets), shapeBuckets);
+    }
+
     CNNNetwork clonedNetwork = InferenceEngine::details::cloneNetwork(network);
     const auto& lptProp = config.find(InferenceEngine::PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE);
     const bool enableLPT = (lptProp != config.end() && lptProp->second == PluginConfigParams::YES) /* enabled in the orig_config*/
@@ -505,31 +532,11 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
                         memThresholdAssumeLimitedForISA);
                 // num of phys CPU cores (most aggressive value for #streams)
                 const auto num_cores = getNumberOfCPUCores();
-                // less aggressive
-                const auto num_streams_less_aggressive = num_cores / 2;
                 // default #streams value (most conservative)
                 const auto default_num_streams = IStreamsExecutor::Config::GetDefaultNumStreams();
-                int num_streams = default_num_streams;
-                if (networkToleranceForLowCache.max_mem_tolerance == ov::MemBandwidthPressure::UNKNOWN) {
-                    if ((networkToleranceForLowCache.ratio_compute_convs == ov::MemBandwidthPressure::ALL)
-                        || (networkToleranceForLowCache.ratio_compute_deconvs == ov::MemBandwidthPressure::ALL)) {
-                        // all relevant layers (convs, etc) are compute-limited, the most aggressive val for #streams
-                        num_streams = num_cores;
-                    }   // otherwise (no recognized layers) falling back to the default value
-                } else if (networkToleranceForLowCache.max_mem_tolerance > memThresholdAssumeLimitedForISA) {
-                    // network is below the ISA-specific threshold
-                    num_streams = num_cores;
-                } else if (networkToleranceForLowCache.max_mem_tolerance > ov::MemBandwidthPressure::LIMITED) {
-                    // network is below general threshold
-                    num_streams = std::max(default_num_streams, num_streams_less_aggressive);
-                }
-                auto num_requests = config.find(PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS);
-                if (engConfig.perfHintsConfig.ovPerfHintNumRequests)  // set thru SetConfig to the plugin
-                    num_streams = std::min(engConfig.perfHintsConfig.ovPerfHintNumRequests,
-                            engConfig.perfHintsConfig.ovPerfHintNumRequests);
-                if (num_requests != config.end())   // arrived with config to the LoadNetwork (and thus higher pri)
-                    num_streams = std::min(num_streams,
-                            PerfHintsConfig::CheckPerformanceHintRequestValue(num_requests->second));
+                int num_streams = ov::GetNumStreamsForThroughput(networkToleranceForLowCache,
+                        num_cores, default_num_streams, memThresholdAssumeLimitedForISA);
+                num_streams = engConfig.perfHintsConfig.LimitNumStreamsByNumRequests(num_streams, config);
                 config[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = std::to_string(num_streams);
            }
         }
@@ -589,6 +596,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
             METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS),
             METRIC_KEY(RANGE_FOR_STREAMS),
             METRIC_KEY(IMPORT_EXPORT_SUPPORT),
+            CPU_METRIC_KEY(HUGE_PAGES_USAGE),
         };
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
@@ -638,6 +646,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
     } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
         IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
+    } else if (name == CPU_METRIC_KEY(HUGE_PAGES_USAGE)) {
+        IE_SET_METRIC_RETURN(CPU_HUGE_PAGES_USAGE, getHugePagesUsage());
     } else {
         IE_THROW() << "Unsupported metric key " << name;
     }
@@ -736,9 +746,15 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
 
 InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istream& networkModel,
                                             const std::map<std::string, std::string>& config) {
+    return ImportNetwork(networkModel, nullptr, config);
+}
+
+InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istream& networkModel,
+                                            const std::shared_ptr<ov::util::MappedMemory>& networkMemory,
+                                            const std::map<std::string, std::string>& config) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "ImportNetwork");
 
-    CNNNetworkDeserializer deserializer(networkModel,
+    CNNNetworkDeserializer deserializer(networkModel, networkMemory,
         [this](const std::string& model, const Blob::CPtr& weights) {
             return GetCore()->ReadNetwork(model, weights);
         });
@@ -762,5 +778,16 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
     return execNetwork;
 }
 
+std::shared_ptr<RemoteContext> Engine::CreateContext(const ParamMap& params) {
+    const auto contextType = params.find(CPU_PARAM_KEY(CONTEXT_TYPE));
+    if (contextType != params.end() && contextType->second.as<std::string>() != CPU_PARAM_VALUE(SHARED_MEMORY))
+        IE_THROW() << "Unsupported CPU context type: " << contextType->second.as<std::string>();
+    return std::make_shared<MKLDNNSharedMemoryContext>();
+}
+
+std::shared_ptr<RemoteContext> Engine::GetDefaultContext(const ParamMap& /*params*/) {
+    return sharedMemoryContext;
+}
+
 static const Version version = {{2, 1}, CI_BUILD_NUMBER, "MKLDNNPlugin"};
 IE_DEFINE_PLUGIN_CREATE_FUNCTION(Engine, version)
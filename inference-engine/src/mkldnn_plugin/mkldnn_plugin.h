@@ -6,6 +6,7 @@
 
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
 #include "mkldnn_exec_network.h"
+#include "mkldnn_remote_context.h"
 
 #include <string>
 #include <map>
@@ -40,11 +41,20 @@ public:
     InferenceEngine::IExecutableNetworkInternal::Ptr ImportNetwork(std::istream& networkModel,
                                                      const std::map<std::string, std::string>& config) override;
 
+    InferenceEngine::IExecutableNetworkInternal::Ptr ImportNetwork(std::istream& networkModel,
+                                                     const std::shared_ptr<ov::util::MappedMemory>& networkMemory,
+                                                     const std::map<std::string, std::string>& config) override;
+
+    std::shared_ptr<InferenceEngine::RemoteContext> CreateContext(const InferenceEngine::ParamMap& params) override;
+
+    std::shared_ptr<InferenceEngine::RemoteContext> GetDefaultContext(const InferenceEngine::ParamMap& params) override;
+
 private:
     Config engConfig;
     NumaNodesWeights weightsSharing;
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
     bool streamsSet = false;
+    std::shared_ptr<InferenceEngine::RemoteContext> sharedMemoryContext = std::make_shared<MKLDNNSharedMemoryContext>();
 };
 
 }  // namespace MKLDNNPlugin
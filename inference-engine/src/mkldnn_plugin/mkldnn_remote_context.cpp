@@ -0,0 +1,200 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_remote_context.h"
+
+#include <cpu/cpu_params.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <string>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// The memory is mapped for the whole blob life time, so the lock is a no-op
+class SharedMemoryAllocator : public IAllocator {
+public:
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+    void unlock(void*) noexcept override {}
+    void* alloc(size_t) noexcept override {
+        return nullptr;
+    }
+    bool free(void*) noexcept override {
+        return false;
+    }
+};
+
+#ifdef __linux__
+int createAnonymousMemory() {
+#ifdef __NR_memfd_create
+    constexpr unsigned int memfdCloexec = 1U;  // MFD_CLOEXEC
+    const int memfd = static_cast<int>(syscall(__NR_memfd_create, "openvino_shared_blob", memfdCloexec));
+    if (memfd >= 0)
+        return memfd;
+#endif
+    // the object is removed right away, so only the descriptor refers to it
+    static std::atomic<unsigned int> counter{0};
+    const auto name = "/openvino_shared_blob_" + std::to_string(getpid()) + "_" + std::to_string(counter++);
+    const int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (fd >= 0)
+        shm_unlink(name.c_str());
+    return fd;
+}
+#endif
+
+}  // namespace
+
+std::string MKLDNNSharedMemoryContext::getDeviceName() const noexcept {
+    return "CPU";
+}
+
+ParamMap MKLDNNSharedMemoryContext::getParams() const {
+    return {{CPU_PARAM_KEY(CONTEXT_TYPE), std::string(CPU_PARAM_VALUE(SHARED_MEMORY))}};
+}
+
+RemoteBlob::Ptr MKLDNNSharedMemoryContext::CreateBlob(const TensorDesc& tensorDesc, const ParamMap& params) {
+#ifdef __linux__
+    const auto fdParam = params.find(CPU_PARAM_KEY(SHARED_MEM_FD));
+    const auto nameParam = params.find(CPU_PARAM_KEY(SHARED_MEM_NAME));
+    for (const auto& param : params) {
+        if (param.first != CPU_PARAM_KEY(SHARED_MEM_FD) && param.first != CPU_PARAM_KEY(SHARED_MEM_NAME) &&
+            param.first != CPU_PARAM_KEY(SHARED_MEM_TYPE))
+            IE_THROW() << "Unsupported shared memory blob parameter: " << param.first;
+    }
+    if (fdParam != params.end() && nameParam != params.end())
+        IE_THROW() << "Shared memory blob can be created either from the descriptor or from the name";
+
+    int fd = -1;
+    std::string name;
+    bool created = false;
+    if (fdParam != params.end()) {
+        fd = fcntl(fdParam->second.as<int>(), F_DUPFD_CLOEXEC, 0);
+    } else if (nameParam != params.end()) {
+        name = nameParam->second.as<std::string>();
+        fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+        created = fd >= 0;
+        if (!created && errno == EEXIST)
+            fd = shm_open(name.c_str(), O_RDWR, 0);
+    } else {
+        fd = createAnonymousMemory();
+        created = true;
+    }
+    if (fd < 0)
+        IE_THROW() << "Failed to open shared memory for the blob, errno: " << errno;
+
+    return std::make_shared<MKLDNNSharedMemoryBlob>(tensorDesc, shared_from_this(), fd, name, created);
+#else
+    IE_THROW(NotImplemented) << "Shared memory blobs are supported on Linux only";
+#endif
+}
+
+MKLDNNSharedMemoryBlob::MKLDNNSharedMemoryBlob(const TensorDesc& tensorDesc,
+                                               const std::shared_ptr<RemoteContext>& context,
+                                               int fd,
+                                               const std::string& name,
+                                               bool created)
+    : RemoteBlob(tensorDesc),
+      context(context),
+      allocator(std::make_shared<SharedMemoryAllocator>()),
+      fd(fd),
+      name(name),
+      created(created) {
+#ifdef __linux__
+    auto cleanup = [this] {
+        close(this->fd);
+        if (this->created && !this->name.empty())
+            shm_unlink(this->name.c_str());
+    };
+    mappedSize = byteSize();
+    if (mappedSize == 0) {
+        cleanup();
+        IE_THROW() << "Shared memory blob can't be empty";
+    }
+
+    // the memory created by the blob is resized, the memory of another process must be big enough
+    struct stat status {};
+    if (fstat(fd, &status) != 0 || static_cast<size_t>(status.st_size) < mappedSize) {
+        if (!created || ftruncate(fd, static_cast<off_t>(mappedSize)) != 0) {
+            cleanup();
+            IE_THROW() << "Shared memory is smaller than the blob: " << status.st_size << " < " << mappedSize;
+        }
+    }
+
+    data = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+        data = nullptr;
+        cleanup();
+        IE_THROW() << "Failed to map shared memory of the blob, errno: " << errno;
+    }
+#endif
+}
+
+MKLDNNSharedMemoryBlob::~MKLDNNSharedMemoryBlob() {
+#ifdef __linux__
+    munmap(data, mappedSize);
+    close(fd);
+    if (created && !name.empty())
+        shm_unlink(name.c_str());
+#endif
+}
+
+ParamMap MKLDNNSharedMemoryBlob::getParams() const {
+    ParamMap params = {{CPU_PARAM_KEY(SHARED_MEM_TYPE), std::string(CPU_PARAM_VALUE(SHARED_MEMORY_FD))},
+                       {CPU_PARAM_KEY(SHARED_MEM_FD), fd}};
+    if (!name.empty())
+        params[CPU_PARAM_KEY(SHARED_MEM_NAME)] = name;
+    return params;
+}
+
+std::string MKLDNNSharedMemoryBlob::getDeviceName() const noexcept {
+    return "CPU";
+}
+
+std::shared_ptr<RemoteContext> MKLDNNSharedMemoryBlob::getContext() const noexcept {
+    return context;
+}
+
+LockedMemory<void> MKLDNNSharedMemoryBlob::buffer() noexcept {
+    return LockedMemory<void>(allocator.get(), data, 0);
+}
+
+LockedMemory<const void> MKLDNNSharedMemoryBlob::cbuffer() const noexcept {
+    return LockedMemory<const void>(allocator.get(), data, 0);
+}
+
+LockedMemory<void> MKLDNNSharedMemoryBlob::rwmap() noexcept {
+    return LockedMemory<void>(allocator.get(), data, 0);
+}
+
+LockedMemory<const void> MKLDNNSharedMemoryBlob::rmap() const noexcept {
+    return LockedMemory<const void>(allocator.get(), data, 0);
+}
+
+LockedMemory<void> MKLDNNSharedMemoryBlob::wmap() noexcept {
+    return LockedMemory<void>(allocator.get(), data, 0);
+}
+
+const std::shared_ptr<IAllocator>& MKLDNNSharedMemoryBlob::getAllocator() const noexcept {
+    return allocator;
+}
+
+void* MKLDNNSharedMemoryBlob::getHandle() const noexcept {
+    return data;
+}
+
+}  // namespace MKLDNNPlugin
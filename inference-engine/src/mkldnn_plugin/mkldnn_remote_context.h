@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_remote_context.hpp>
+
+#include <memory>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Context of the blobs allocated in memory, which may be mapped by other processes of the host.
+ * The blobs are plain host memory for the CPU plugin, so they are used by the infer requests
+ * in place as any other user blob.
+ */
+class MKLDNNSharedMemoryContext : public InferenceEngine::RemoteContext {
+public:
+    std::string getDeviceName() const noexcept override;
+
+    InferenceEngine::RemoteBlob::Ptr CreateBlob(const InferenceEngine::TensorDesc& tensorDesc,
+                                                const InferenceEngine::ParamMap& params = {}) override;
+
+    InferenceEngine::ParamMap getParams() const override;
+};
+
+/**
+ * Blob mapped from a memfd or POSIX shared memory object
+ */
+class MKLDNNSharedMemoryBlob : public InferenceEngine::RemoteBlob {
+public:
+    /**
+     * @param fd descriptor of the memory, the blob takes its ownership
+     * @param name name of the shared memory object, empty for the anonymous memory
+     * @param created true if the memory is created for the blob, so it is resized to the blob size
+     * and the named object is removed on destruction
+     */
+    MKLDNNSharedMemoryBlob(const InferenceEngine::TensorDesc& tensorDesc,
+                           const std::shared_ptr<InferenceEngine::RemoteContext>& context,
+                           int fd,
+                           const std::string& name,
+                           bool created);
+    ~MKLDNNSharedMemoryBlob() override;
+
+    InferenceEngine::ParamMap getParams() const override;
+    std::string getDeviceName() const noexcept override;
+    std::shared_ptr<InferenceEngine::RemoteContext> getContext() const noexcept override;
+
+    void allocate() noexcept override {}
+    bool deallocate() noexcept override {
+        return false;
+    }
+
+    InferenceEngine::LockedMemory<void> buffer() noexcept override;
+    InferenceEngine::LockedMemory<const void> cbuffer() const noexcept override;
+    InferenceEngine::LockedMemory<void> rwmap() noexcept override;
+    InferenceEngine::LockedMemory<const void> rmap() const noexcept override;
+    InferenceEngine::LockedMemory<void> wmap() noexcept override;
+
+protected:
+    const std::shared_ptr<InferenceEngine::IAllocator>& getAllocator() const noexcept override;
+    void* getHandle() const noexcept override;
+
+private:
+    std::shared_ptr<InferenceEngine::RemoteContext> context;
+    std::shared_ptr<InferenceEngine::IAllocator> allocator;
+    int fd = -1;
+    std::string name;
+    bool created = false;
+    void* data = nullptr;
+    size_t mappedSize = 0;
+};
+
+}  // namespace MKLDNNPlugin
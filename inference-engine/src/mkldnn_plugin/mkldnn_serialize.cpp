@@ -3,7 +3,10 @@
 //
 #include "mkldnn_serialize.h"
 
+#include <ie_mapped_memory.hpp>
+#include <ie_system_conf.h>
 #include <openvino/pass/serialize.hpp>
+#include <transformations/rt_info/primitives_priority_attribute.hpp>
 
 #include <pugixml.hpp>
 
@@ -64,11 +67,50 @@ namespace {
             it->second->setLayout(layout_from_string(layout_attr.value()));
         }
     }
+
+    // The implementations are jitted for the instruction set, so they are reused on the machines with the same one only
+    std::string cpuIsaName() {
+        if (with_cpu_x86_bfloat16())
+            return "avx512_core_bf16";
+        if (with_cpu_x86_avx512_core())
+            return "avx512_core";
+        if (with_cpu_x86_avx512f())
+            return "avx512f";
+        if (with_cpu_x86_avx2())
+            return "avx2";
+        if (with_cpu_x86_avx())
+            return "avx";
+        if (with_cpu_x86_sse42())
+            return "sse42";
+        return "uni";
+    }
+
+    void setImplementations(const pugi::xml_node & primitives, const InferenceEngine::CNNNetwork & network) {
+        if (!primitives || cpuIsaName() != primitives.attribute("isa").value())
+            return;
+
+        std::map<std::string, std::string> implementations;
+        for (auto n : primitives.children("node")) {
+            implementations[n.attribute("name").value()] = n.attribute("impl").value();
+        }
+
+        for (const auto & op : network.getFunction()->get_ordered_ops()) {
+            auto it = implementations.find(op->get_friendly_name());
+            auto & rtInfo = op->get_rt_info();
+            // the priorities set by the user are kept
+            if (it == implementations.end() || rtInfo.count(ov::PrimitivesPriority::get_type_info_static()))
+                continue;
+            rtInfo[ov::PrimitivesPriority::get_type_info_static()] =
+                std::make_shared<ov::PrimitivesPriority>("cpu:" + it->second);
+        }
+    }
 };  // namespace
 
-CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager)
+CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager,
+                                           std::map<std::string, std::string> implementations)
     : _ostream(ostream)
-    , _extensionManager(extensionManager) {
+    , _extensionManager(extensionManager)
+    , _implementations(std::move(implementations)) {
 }
 
 void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
@@ -114,6 +156,16 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
                     .set_value(to_string(out.second->getLayout()).c_str());
         }
 
+        if (!_implementations.empty()) {
+            pugi::xml_node primitives = root.append_child("primitives");
+            primitives.append_attribute("isa").set_value(cpuIsaName().c_str());
+            for (const auto & impl : _implementations) {
+                auto node = primitives.append_child("node");
+                node.append_attribute("name").set_value(impl.first.c_str());
+                node.append_attribute("impl").set_value(impl.second.c_str());
+            }
+        }
+
         xml_doc.save(stream);
     };
 
@@ -127,6 +179,14 @@ CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream & istream, cnn_netwo
     , _cnn_network_builder(fn) {
 }
 
+CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream & istream,
+                                               std::shared_ptr<ov::util::MappedMemory> memory,
+                                               cnn_network_builder fn)
+    : _istream(istream)
+    , _memory(std::move(memory))
+    , _cnn_network_builder(fn) {
+}
+
 void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network) {
     using namespace ov::pass;
 
@@ -147,8 +207,17 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     }
 
     // read blob content
-    _istream.seekg(hdr.consts_offset);
-    if (hdr.consts_size) {
+    if (hdr.consts_size && _memory) {
+        if (hdr.consts_offset + hdr.consts_size > _memory->size()) {
+            IE_THROW(NetworkNotRead) << "The weights are out of the network memory.";
+        }
+        // the constants of the network refer to the weights in the mapped memory
+        dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C),
+            std::make_shared<MappedMemoryAllocator>(std::make_shared<MappedMemoryView>(_memory, hdr.consts_offset, hdr.consts_size)));
+        dataBlob->allocate();
+    } else if (hdr.consts_size) {
+        _istream.seekg(hdr.consts_offset);
         dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
             InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C));
         dataBlob->allocate();
@@ -169,6 +238,9 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
 
     setPrecisionsAndLayouts(inputs.children("in"), network.getInputsInfo());
     setPrecisionsAndLayouts(outputs.children("out"), network.getOutputsInfo());
+
+    // the graph of the imported network tries the implementations selected for the exported one first
+    setImplementations(root.child("primitives"), network);
 }
 
 }  // namespace MKLDNNPlugin
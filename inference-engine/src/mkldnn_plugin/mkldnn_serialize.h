@@ -6,18 +6,24 @@
 
 #include <iostream>
 #include <functional>
+#include <map>
+#include <string>
 #include <cpp/ie_cnn_network.h>
+#include <openvino/util/mmap_object.hpp>
 
 namespace MKLDNNPlugin {
 
 class CNNNetworkSerializer {
 public:
-    CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager);
+    // implementations map node names to the names of the implementations selected for them by the graph
+    CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager,
+                         std::map<std::string, std::string> implementations = {});
     void operator << (const InferenceEngine::CNNNetwork & network);
 
 private:
     std::ostream & _ostream;
     MKLDNNExtensionManager::Ptr _extensionManager;
+    std::map<std::string, std::string> _implementations;
 };
 
 class CNNNetworkDeserializer {
@@ -27,10 +33,15 @@ public:
                         const std::string&,
                         const InferenceEngine::Blob::CPtr&)> cnn_network_builder;
     CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
+    // the stream is on top of the memory, so the weights are referenced in the memory instead of reading them
+    CNNNetworkDeserializer(std::istream & istream,
+                           std::shared_ptr<ov::util::MappedMemory> memory,
+                           cnn_network_builder fn);
     void operator >> (InferenceEngine::CNNNetwork & network);
 
 private:
     std::istream & _istream;
+    std::shared_ptr<ov::util::MappedMemory> _memory;
     cnn_network_builder _cnn_network_builder;
 };
 
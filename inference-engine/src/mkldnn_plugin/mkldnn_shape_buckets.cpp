@@ -0,0 +1,395 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_shape_buckets.h"
+
+#include <ie_metric_helpers.hpp>
+#include <ie_parallel.hpp>
+#include <blob_factory.hpp>
+#include <ie_algorithm.hpp>
+#include <debug.h>
+#include <threading/ie_immediate_executor.hpp>
+#include <ngraph/graph_util.hpp>
+#include <transformations/utils/utils.hpp>
+#include "cpu/cpu_config.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <sstream>
+#include <utility>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+size_t volume(const ShapesMap& shapes) {
+    size_t result = 0;
+    for (auto&& shape : shapes)
+        result += details::product(shape.second);
+    return result;
+}
+
+ShapesMap blobShapes(const BlobMap& blobs) {
+    ShapesMap shapes;
+    for (auto&& blob : blobs)
+        shapes[blob.first] = blob.second->getTensorDesc().getDims();
+    return shapes;
+}
+
+SizeVector physicalDims(const Blob::Ptr& blob) {
+    const auto& desc = blob->getTensorDesc();
+    const auto& blockDims = desc.getBlockingDesc().getBlockDims();
+    if (blockDims.size() != desc.getDims().size())
+        IE_THROW(NotImplemented) << "Shape buckets do not support blocked layouts of the blobs";
+    return blockDims;
+}
+
+// Copies the leading box of the given dims between the dense tensors, the dims are in the physical order
+void copyBox(const uint8_t* src, const SizeVector& srcDims, uint8_t* dst, const SizeVector& dstDims,
+             const SizeVector& box, size_t elementSize) {
+    const size_t rank = box.size();
+    if (rank == 0) {
+        std::memcpy(dst, src, elementSize);
+        return;
+    }
+    std::vector<size_t> srcStrides(rank, elementSize), dstStrides(rank, elementSize);
+    for (size_t i = rank - 1; i > 0; i--) {
+        srcStrides[i - 1] = srcStrides[i] * srcDims[i];
+        dstStrides[i - 1] = dstStrides[i] * dstDims[i];
+    }
+    const size_t rowSize = box[rank - 1] * elementSize;
+    const size_t rows = details::product(box.begin(), box.end() - 1);
+    parallel_for(rows, [&](size_t row) {
+        size_t srcOffset = 0, dstOffset = 0;
+        for (size_t i = rank - 1; i > 0; i--) {
+            const size_t index = row % box[i - 1];
+            row /= box[i - 1];
+            srcOffset += index * srcStrides[i - 1];
+            dstOffset += index * dstStrides[i - 1];
+        }
+        std::memcpy(dst + dstOffset, src + srcOffset, rowSize);
+    });
+}
+
+}  // namespace
+
+std::vector<ShapesMap> parseShapeBuckets(const std::string& value) {
+    auto error = [&] {
+        IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SHAPE_BUCKETS << ": " << value
+                   << ". Expected buckets separated by ';' each listing the input shapes as input1[1,128],input2[1,128]";
+    };
+
+    std::vector<ShapesMap> buckets;
+    size_t bucketBegin = 0;
+    while (bucketBegin <= value.size()) {
+        auto bucketEnd = std::min(value.find(';', bucketBegin), value.size());
+        const auto bucket = value.substr(bucketBegin, bucketEnd - bucketBegin);
+        bucketBegin = bucketEnd + 1;
+        if (std::all_of(bucket.begin(), bucket.end(), ::isspace))
+            continue;
+
+        ShapesMap shapes;
+        size_t pos = 0;
+        while (pos < bucket.size()) {
+            const auto open = bucket.find('[', pos);
+            const auto close = bucket.find(']', open);
+            if (open == std::string::npos || close == std::string::npos)
+                error();
+            auto name = bucket.substr(pos, open - pos);
+            name.erase(0, name.find_first_not_of(" ,"));
+            name.erase(name.find_last_not_of(' ') + 1);
+            if (name.empty() || shapes.count(name))
+                error();
+            auto& dims = shapes[name];
+            const auto dimsStr = bucket.substr(open + 1, close - open - 1);
+            for (size_t dimBegin = 0; dimBegin <= dimsStr.size() && !dimsStr.empty();) {
+                const auto dimEnd = std::min(dimsStr.find(',', dimBegin), dimsStr.size());
+                try {
+                    size_t parsed = 0;
+                    const auto dim = dimsStr.substr(dimBegin, dimEnd - dimBegin);
+                    const auto dimValue = std::stoll(dim, &parsed);
+                    if (dimValue < 0 || dim.find_first_not_of(' ', parsed) != std::string::npos)
+                        error();
+                    dims.push_back(static_cast<size_t>(dimValue));
+                } catch (const std::logic_error&) {
+                    error();
+                }
+                dimBegin = dimEnd + 1;
+            }
+            pos = close + 1;
+            if (bucket.find_first_not_of(" ,", pos) == std::string::npos)
+                break;
+        }
+        buckets.push_back(std::move(shapes));
+    }
+    if (buckets.empty())
+        error();
+    return buckets;
+}
+
+MKLDNNShapeBucketsExecNetwork::MKLDNNShapeBucketsExecNetwork(const CNNNetwork& network,
+                                                             std::vector<Bucket> buckets,
+                                                             const std::string& shapeBuckets)
+    // the requests are run by the request of the bucket, the first stage that routes the request is immediate
+    : ExecutableNetworkThreadSafeDefault(std::make_shared<ImmediateExecutor>(), std::make_shared<ImmediateExecutor>()),
+      _buckets(std::move(buckets)),
+      _function(ngraph::clone_function(*network.getFunction())),
+      _shapeBuckets(shapeBuckets) {
+    std::stable_sort(_buckets.begin(), _buckets.end(), [] (const Bucket& lhs, const Bucket& rhs) {
+        return volume(lhs.inputShapes) < volume(rhs.inputShapes);
+    });
+}
+
+IInferRequestInternal::Ptr MKLDNNShapeBucketsExecNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
+                                                                                 OutputsDataMap networkOutputs) {
+    return std::make_shared<MKLDNNShapeBucketsInferRequest>(networkInputs, networkOutputs,
+                                                            std::static_pointer_cast<MKLDNNShapeBucketsExecNetwork>(shared_from_this()));
+}
+
+IInferRequestInternal::Ptr MKLDNNShapeBucketsExecNetwork::CreateInferRequest() {
+    auto syncRequestImpl = std::static_pointer_cast<MKLDNNShapeBucketsInferRequest>(
+        CreateInferRequestImpl(_networkInputs, _networkOutputs));
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    return std::make_shared<MKLDNNShapeBucketsAsyncInferRequest>(syncRequestImpl, _callbackExecutor);
+}
+
+Parameter MKLDNNShapeBucketsExecNetwork::GetConfig(const std::string& name) const {
+    if (name == CPUConfigParams::KEY_CPU_SHAPE_BUCKETS)
+        return _shapeBuckets;
+    return _buckets.front().network->GetConfig(name);
+}
+
+Parameter MKLDNNShapeBucketsExecNetwork::GetMetric(const std::string& name) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(NETWORK_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        unsigned int requests = 1;
+        for (auto&& bucket : _buckets) {
+            requests = std::max(requests, bucket.network->GetMetric(name).as<unsigned int>());
+        }
+        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, requests);
+    } else if (name == METRIC_KEY(NETWORK_NAME) || name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        return _buckets.front().network->GetMetric(name);
+    } else {
+        IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
+    }
+}
+
+std::shared_ptr<ngraph::Function> MKLDNNShapeBucketsExecNetwork::GetExecGraphInfo() {
+    return _buckets.back().network->GetExecGraphInfo();
+}
+
+size_t MKLDNNShapeBucketsExecNetwork::SelectBucket(const ShapesMap& inputShapes) const {
+    for (size_t i = 0; i < _buckets.size(); i++) {
+        bool fits = true;
+        for (auto&& bucketShape : _buckets[i].inputShapes) {
+            auto shape = inputShapes.find(bucketShape.first);
+            fits = fits && shape != inputShapes.end() && shape->second.size() == bucketShape.second.size() &&
+                   std::equal(shape->second.begin(), shape->second.end(), bucketShape.second.begin(), std::less_equal<size_t>());
+        }
+        if (fits)
+            return i;
+    }
+    std::stringstream shapes;
+    for (auto&& shape : inputShapes)
+        shapes << " " << shape.first << details::dumpVec(shape.second);
+    IE_THROW() << "None of the shape buckets fits the input shapes:" << shapes.str();
+}
+
+ShapesMap MKLDNNShapeBucketsExecNetwork::GetOutputShapes(const ShapesMap& inputShapes) const {
+    std::lock_guard<std::mutex> lock{_outputShapesMutex};
+    auto found = _outputShapes.find(inputShapes);
+    if (found != _outputShapes.end())
+        return found->second;
+
+    auto function = ngraph::clone_function(*_function);
+    for (auto&& parameter : function->get_parameters()) {
+        auto shape = inputShapes.find(parameter->get_friendly_name());
+        if (shape != inputShapes.end())
+            parameter->set_partial_shape(ngraph::PartialShape(ngraph::Shape(shape->second)));
+    }
+    function->validate_nodes_and_infer_types();
+
+    ShapesMap outputShapes;
+    for (auto&& result : function->get_results()) {
+        const auto& output = result->input_value(0);
+        const auto& shape = output.get_partial_shape();
+        if (shape.is_dynamic())
+            IE_THROW() << "Output shape of " << ngraph::op::util::create_ie_output_name(output)
+                       << " is not defined by the input shapes";
+        outputShapes[ngraph::op::util::create_ie_output_name(output)] = shape.to_shape();
+    }
+    _outputShapes.emplace(inputShapes, outputShapes);
+    return outputShapes;
+}
+
+MKLDNNShapeBucketsInferRequest::MKLDNNShapeBucketsInferRequest(InputsDataMap networkInputs,
+                                                               OutputsDataMap networkOutputs,
+                                                               const MKLDNNShapeBucketsExecNetwork::Ptr& execNetwork)
+    : IInferRequestInternal(networkInputs, networkOutputs),
+      _execNetwork(execNetwork),
+      _bucketRequests(execNetwork->_buckets.size()) {
+    IE_SUPPRESS_DEPRECATED_START
+    for (auto&& input : _networkInputs) {
+        if (!input.second->getInputData()->isDynamic()) {
+            _inputs[input.first] = make_blob_with_precision(input.second->getTensorDesc());
+            _inputs[input.first]->allocate();
+        }
+    }
+    IE_SUPPRESS_DEPRECATED_END
+}
+
+void MKLDNNShapeBucketsInferRequest::SetBlob(const std::string& name, const Blob::Ptr& data) {
+    if (!data)
+        IE_THROW(NotAllocated) << "Failed to set empty blob with name: \'" << name << "\'";
+    InputInfo::Ptr foundInput;
+    DataPtr foundOutput;
+    const auto precision = findInputAndOutputBlobByName(name, foundInput, foundOutput) ? foundInput->getPrecision()
+                                                                                       : foundOutput->getPrecision();
+    if (precision != data->getTensorDesc().getPrecision()) {
+        IE_THROW(ParameterMismatch) << "Failed to set Blob with precision not corresponding to the network precision";
+    }
+    if (!data->is<MemoryBlob>()) {
+        IE_THROW(NotImplemented) << "Shape buckets support only memory blobs";
+    }
+    physicalDims(data);
+    if (foundInput) {
+        _inputs[name] = data;
+    } else {
+        _outputs[name] = data;
+    }
+}
+
+Blob::Ptr MKLDNNShapeBucketsInferRequest::GetBlob(const std::string& name) {
+    InputInfo::Ptr foundInput;
+    DataPtr foundOutput;
+    auto& blobs = findInputAndOutputBlobByName(name, foundInput, foundOutput) ? _inputs : _outputs;
+    auto blob = blobs.find(name);
+    if (blob == blobs.end()) {
+        IE_THROW(NotAllocated) << (foundInput ? "Input" : "Output") << " blob " << name
+                               << (foundInput ? " of the dynamic input must be set before inference"
+                                              : " is available after inference");
+    }
+    return blob->second;
+}
+
+std::map<std::string, InferenceEngineProfileInfo> MKLDNNShapeBucketsInferRequest::GetPerformanceCounts() const {
+    if (!_bucketRequest)
+        return {};
+    return _bucketRequest->request->GetPerformanceCounts();
+}
+
+void MKLDNNShapeBucketsInferRequest::RouteToBucket() {
+    const auto inputShapes = blobShapes(_inputs);
+    const auto bucketIndex = _execNetwork->SelectBucket(inputShapes);
+    const auto& bucket = _execNetwork->_buckets[bucketIndex];
+    _bucketRequest = &_bucketRequests[bucketIndex];
+    if (!_bucketRequest->request) {
+        auto bucketRequest = _bucketRequest;
+        bucketRequest->request = bucket.network->CreateInferRequest();
+        bucketRequest->request->SetCallback([this] (std::exception_ptr exceptionPtr) {
+            _exceptionPtr = exceptionPtr;
+            auto capturedTask = std::move(_task);
+            if (capturedTask)
+                capturedTask();
+        });
+        for (auto&& input : _networkInputs) {
+            bucketRequest->paddedInputs[input.first] = bucketRequest->request->GetBlob(input.first);
+        }
+        for (auto&& output : _networkOutputs) {
+            bucketRequest->paddedOutputs[output.first] = bucketRequest->request->GetBlob(output.first);
+        }
+    }
+
+    _exactFit = std::all_of(bucket.inputShapes.begin(), bucket.inputShapes.end(), [&] (const ShapesMap::value_type& shape) {
+        return inputShapes.at(shape.first) == shape.second;
+    });
+
+    auto& request = _bucketRequest->request;
+    for (auto&& input : _inputs) {
+        const auto& padded = _bucketRequest->paddedInputs.at(input.first);
+        if (_exactFit || input.second->getTensorDesc().getDims() == padded->getTensorDesc().getDims()) {
+            request->SetBlob(input.first, input.second);
+            continue;
+        }
+        request->SetBlob(input.first, padded);
+        auto src = input.second->as<MemoryBlob>()->rmap();
+        auto dst = padded->as<MemoryBlob>()->wmap();
+        std::memset(dst.as<uint8_t*>(), 0, padded->byteSize());
+        copyBox(src.as<const uint8_t*>(), physicalDims(input.second), dst.as<uint8_t*>(), physicalDims(padded),
+                physicalDims(input.second), padded->element_size());
+    }
+
+    const auto outputShapes = _exactFit ? blobShapes(_bucketRequest->paddedOutputs) : _execNetwork->GetOutputShapes(inputShapes);
+    for (auto&& output : _networkOutputs) {
+        const auto& padded = _bucketRequest->paddedOutputs.at(output.first);
+        const auto& dims = outputShapes.at(output.first);
+        auto& blob = _outputs[output.first];
+        if (!blob || blob->getTensorDesc().getDims() != dims) {
+            blob = make_blob_with_precision(TensorDesc(padded->getTensorDesc().getPrecision(), dims,
+                                                       padded->getTensorDesc().getLayout()));
+            blob->allocate();
+        }
+        request->SetBlob(output.first, _exactFit ? blob : padded);
+    }
+}
+
+void MKLDNNShapeBucketsInferRequest::CollectOutputs() {
+    if (_exactFit)
+        return;
+    for (auto&& output : _outputs) {
+        const auto& padded = _bucketRequest->paddedOutputs.at(output.first);
+        auto src = padded->as<MemoryBlob>()->rmap();
+        auto dst = output.second->as<MemoryBlob>()->wmap();
+        copyBox(src.as<const uint8_t*>(), physicalDims(padded), dst.as<uint8_t*>(), physicalDims(output.second),
+                physicalDims(output.second), padded->element_size());
+    }
+}
+
+void MKLDNNShapeBucketsInferRequest::InferImpl() {
+    RouteToBucket();
+    _bucketRequest->request->Infer();
+    CollectOutputs();
+}
+
+MKLDNNShapeBucketsAsyncInferRequest::MKLDNNShapeBucketsAsyncInferRequest(const MKLDNNShapeBucketsInferRequest::Ptr& inferRequest,
+                                                                         const ITaskExecutor::Ptr& callbackExecutor)
+    : AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+      _inferRequest{inferRequest} {
+    // the stage task is run by the callback of the bucket request after its inference
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(MKLDNNShapeBucketsAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            auto inferRequest = _this->_inferRequest;
+            inferRequest->_task = std::move(task);
+            inferRequest->_bucketRequest->request->StartAsync();
+        }
+        MKLDNNShapeBucketsAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        { /*TaskExecutor*/ std::make_shared<ImmediateExecutor>(), /*task*/ [this] {
+            _inferRequest->RouteToBucket();
+        }},
+        { /*TaskExecutor*/ std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
+            if (nullptr != _inferRequest->_exceptionPtr) {
+                std::rethrow_exception(_inferRequest->_exceptionPtr);
+            }
+            _inferRequest->CollectOutputs();
+        }}
+    };
+}
+
+MKLDNNShapeBucketsAsyncInferRequest::~MKLDNNShapeBucketsAsyncInferRequest() {
+    StopAndWait();
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,119 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <ngraph/function.hpp>
+
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+using ShapesMap = std::map<std::string, InferenceEngine::SizeVector>;
+
+/**
+ * Parses CPU_SHAPE_BUCKETS value: "input1[1,128],input2[1,128];input1[1,256],input2[1,256]"
+ */
+std::vector<ShapesMap> parseShapeBuckets(const std::string& value);
+
+/**
+ * The network with dynamic inputs compiled for several static input shapes (buckets).
+ * Compiled variants are regular executable networks of the plugin, so they share the constant weights through
+ * the plugin weights cache.
+ */
+class MKLDNNShapeBucketsExecNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    typedef std::shared_ptr<MKLDNNShapeBucketsExecNetwork> Ptr;
+
+    struct Bucket {
+        ShapesMap inputShapes;
+        InferenceEngine::IExecutableNetworkInternal::Ptr network;
+    };
+
+    MKLDNNShapeBucketsExecNetwork(const InferenceEngine::CNNNetwork& network,
+                                  std::vector<Bucket> buckets,
+                                  const std::string& shapeBuckets);
+
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                       InferenceEngine::OutputsDataMap networkOutputs) override;
+
+    InferenceEngine::Parameter GetConfig(const std::string& name) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name) const override;
+    std::shared_ptr<ngraph::Function> GetExecGraphInfo() override;
+
+    /**
+     * @return the index of the smallest bucket fitting the input shapes
+     */
+    size_t SelectBucket(const ShapesMap& inputShapes) const;
+
+    /**
+     * @return the output shapes of the original network for the input shapes, the results of the shape inference
+     * are cached as the set of actual shapes is usually small
+     */
+    ShapesMap GetOutputShapes(const ShapesMap& inputShapes) const;
+
+    // sorted by the number of input elements
+    std::vector<Bucket> _buckets;
+
+protected:
+    std::shared_ptr<const ngraph::Function> _function;
+    std::string _shapeBuckets;
+    mutable std::mutex _outputShapesMutex;
+    mutable std::map<ShapesMap, ShapesMap> _outputShapes;
+};
+
+class MKLDNNShapeBucketsInferRequest : public InferenceEngine::IInferRequestInternal {
+public:
+    typedef std::shared_ptr<MKLDNNShapeBucketsInferRequest> Ptr;
+
+    MKLDNNShapeBucketsInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                                   InferenceEngine::OutputsDataMap networkOutputs,
+                                   const MKLDNNShapeBucketsExecNetwork::Ptr& execNetwork);
+
+    void InferImpl() override;
+    void SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& data) override;
+    InferenceEngine::Blob::Ptr GetBlob(const std::string& name) override;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+
+    // selects the bucket for the current input shapes and sets the inputs and outputs of its request
+    void RouteToBucket();
+    // copies the outputs of the bucket request cropped to the actual output shapes, if needed
+    void CollectOutputs();
+
+    struct BucketRequest {
+        InferenceEngine::IInferRequestInternal::Ptr request;
+        InferenceEngine::BlobMap paddedInputs;
+        InferenceEngine::BlobMap paddedOutputs;
+    };
+
+    BucketRequest*          _bucketRequest = nullptr;  // routed by the last RouteToBucket() call
+    InferenceEngine::Task   _task;                     // run by the bucket request callback
+    std::exception_ptr      _exceptionPtr = nullptr;   // set by the bucket request callback
+
+private:
+    MKLDNNShapeBucketsExecNetwork::Ptr  _execNetwork;
+    std::vector<BucketRequest>          _bucketRequests;  // created on the first use of the bucket
+    bool                                _exactFit = false;
+};
+
+class MKLDNNShapeBucketsAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    MKLDNNShapeBucketsAsyncInferRequest(const MKLDNNShapeBucketsInferRequest::Ptr& inferRequest,
+                                        const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor);
+    ~MKLDNNShapeBucketsAsyncInferRequest();
+
+protected:
+    MKLDNNShapeBucketsInferRequest::Ptr _inferRequest;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_tuning_cache.hpp"
+
+#include <fstream>
+
+#if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
+# ifdef _WIN32
+#  include <intrin.h>
+# else
+#  include <cpuid.h>
+# endif
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+std::string getCpuModel() {
+    std::string model;
+#if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
+    unsigned int addr_list[3] = { 0x80000002, 0x80000003, 0x80000004 };
+    unsigned int regs[4];
+    for (auto addr : addr_list) {
+        regs[0] = addr;
+#ifdef _WIN32
+        __cpuid(reinterpret_cast<int*>(regs), regs[0]);
+#else
+        __get_cpuid(regs[0], &regs[0], &regs[1], &regs[2], &regs[3]);
+#endif
+        const char *ch = reinterpret_cast<const char*>(&regs[0]);
+        for (size_t j = 0; j < sizeof(regs) && ch[j] != '\0'; j++)
+            model += ch[j];
+    }
+#endif
+    // the separators of the file format must not appear in the model name
+    for (auto& ch : model) {
+        if (ch == '|' || ch == '\t' || ch == '\n')
+            ch = ' ';
+    }
+    const auto last = model.find_last_not_of(' ');
+    model.erase(last == std::string::npos ? 0 : last + 1);
+    return model.empty() ? "unknown" : model;
+}
+
+}  // namespace
+
+MKLDNNTuningCache::MKLDNNTuningCache(const std::string& filePath) : path(filePath), cpuModel(getCpuModel()) {
+    load();
+}
+
+void MKLDNNTuningCache::load() {
+    std::ifstream stream(path);
+    if (!stream.is_open())
+        return;
+
+    const std::string prefix = cpuModel + '|';
+    std::string line;
+    while (std::getline(stream, line)) {
+        const auto separator = line.rfind('\t');
+        if (separator == std::string::npos || line.compare(0, prefix.size(), prefix) != 0)
+            continue;
+        // the later entries of the same key are the more recent measurements
+        entries[line.substr(0, separator)] = line.substr(separator + 1);
+    }
+}
+
+void MKLDNNTuningCache::store(const std::string& fullKey, const std::string& value) const {
+    // a single short line per write, so the appends of the concurrent processes aren't interleaved in practice
+    std::ofstream stream(path, std::ios::app);
+    if (!stream.is_open())
+        return;
+    stream << fullKey + '\t' + value + '\n';
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Persistent store of the implementations chosen by measurement
+ * Nodes which have several implementations of the same layout with the performance depending on the shape
+ * (e.g. winograd and direct convolutions) time the candidates once and store the name of the fastest one under the
+ * key describing the problem. The entries are kept in one text file, each line is "<cpu model>|<key>\t<implementation>",
+ * so the file may be shared by different machines: only the entries of the current CPU model are loaded.
+ *
+ * Is a thread safe. The tuner is called holding the cache lock, so the concurrently created graphs don't disturb each
+ * other's measurements and the same problem is measured only once.
+ */
+class MKLDNNTuningCache {
+public:
+    typedef std::shared_ptr<MKLDNNTuningCache> Ptr;
+
+    explicit MKLDNNTuningCache(const std::string& filePath);
+
+    /**
+     * Returns the stored implementation name or measures it with tuner and stores the result
+     * @param key problem key, the CPU model is added internally
+     * @param tuner callable returning std::string, empty result is not stored
+     */
+    template <typename Tuner>
+    std::string getOrTune(const std::string& key, Tuner&& tuner) {
+        const std::string fullKey = cpuModel + '|' + key;
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = entries.find(fullKey);
+        if (found != entries.end())
+            return found->second;
+
+        std::string result = tuner();
+        if (!result.empty()) {
+            entries.emplace(fullKey, result);
+            store(fullKey, result);
+        }
+        return result;
+    }
+
+private:
+    void load();
+    // appends the entry to the file, failures are silently ignored as the cache is only an optimization
+    void store(const std::string& fullKey, const std::string& value) const;
+
+    const std::string path;
+    const std::string cpuModel;
+    std::mutex guard;
+    std::unordered_map<std::string, std::string> entries;
+};
+
+}  // namespace MKLDNNPlugin
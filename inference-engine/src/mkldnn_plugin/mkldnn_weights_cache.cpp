@@ -5,12 +5,20 @@
 #include "mkldnn_weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <ie_data_hash.hpp>
+#include <file_utils.h>
+#include <openvino/util/mmap_object.hpp>
+#include "nodes/common/cpu_memcpy.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
 #include <memory>
+#include <sstream>
+#include <thread>
 
 namespace MKLDNNPlugin {
 
-const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
-
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
         std::unique_lock<std::mutex> && lock,
         const MKLDNNMemoryInfo::Ptr & memory,
@@ -70,9 +78,105 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const st
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+namespace {
+// Entry header protects from reading truncated, corrupted or foreign files
+struct DiskCacheEntryHeader {
+    uint64_t magic;
+    uint64_t size;
+    uint64_t checksum;
+};
+constexpr uint64_t diskCacheEntryMagic = 0x32424C4257555043ull;  // "CPUWBLB2"
+
+// Layout of the repacked weights depends on the ISA the primitives are selected for and may change between oneDNN and
+// plugin versions, so entries produced by another environment must not be picked up
+std::string getEnvironmentTag() {
+    const auto dnnlVersion = dnnl_version();
+    std::stringstream environment;
+    environment << "isa_" << static_cast<unsigned>(dnnl::get_effective_cpu_isa())
+                << "_onednn_" << dnnlVersion->major << "." << dnnlVersion->minor << "." << dnnlVersion->patch
+                << "_" << dnnlVersion->hash << "_plugin_" << CI_BUILD_NUMBER;
+    const auto environmentStr = environment.str();
+
+    std::stringstream tag;
+    tag << std::hex << InferenceEngine::computeDataHashSequential(environmentStr.data(), environmentStr.size());
+    return tag.str();
+}
+}  // namespace
+
+MKLDNNWeightsDiskCache::MKLDNNWeightsDiskCache(const std::string& cacheDir) : dir(cacheDir), environmentTag(getEnvironmentTag()) {
+    if (!dir.empty() && !FileUtils::directoryExists(dir))
+        FileUtils::createDirectoryRecursive(dir);
+}
+
+std::string MKLDNNWeightsDiskCache::getEntryPath(const std::string& key) const {
+    return FileUtils::makePath(dir, key + "_" + environmentTag + ".wblob");
+}
+
+bool MKLDNNWeightsDiskCache::load(const std::string& key, const MKLDNNMemory& memory) const {
+    const auto path = getEntryPath(key);
+    if (!FileUtils::fileExist(path))
+        return false;
+
+    std::shared_ptr<ov::util::MappedMemory> mapped;
+    try {
+        mapped = ov::util::load_mmap_object(path);
+    } catch (const std::exception&) {
+        return false;
+    }
+
+    const size_t size = memory.GetSize();
+    if (mapped->size() != sizeof(DiskCacheEntryHeader) + size)
+        return false;
+
+    DiskCacheEntryHeader header;
+    cpu_memcpy(&header, mapped->data(), sizeof(header));
+    if (header.magic != diskCacheEntryMagic || header.size != size)
+        return false;
+
+    const char* data = mapped->data() + sizeof(header);
+    if (header.checksum != InferenceEngine::computeDataHash(data, size))
+        return false;
+
+    cpu_memcpy(memory.GetData(), data, size);
+    return true;
+}
+
+void MKLDNNWeightsDiskCache::store(const std::string& key, const MKLDNNMemory& memory) const {
+    const auto path = getEntryPath(key);
+    if (FileUtils::fileExist(path))
+        return;
+
+    // unique name of temporary file prevents concurrent writers from corrupting each other
+    const auto uniqueId = std::hash<std::thread::id>()(std::this_thread::get_id()) ^
+        static_cast<size_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    const auto tmpPath = path + "." + std::to_string(uniqueId) + ".tmp";
+
+    const DiskCacheEntryHeader header { diskCacheEntryMagic, memory.GetSize(),
+                                        InferenceEngine::computeDataHash(memory.GetData(), memory.GetSize()) };
+    {
+        std::ofstream stream(tmpPath, std::ios::binary);
+        if (!stream.is_open())
+            return;
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        stream.write(static_cast<const char*>(memory.GetData()), header.size);
+        if (!stream.good()) {
+            stream.close();
+            std::remove(tmpPath.c_str());
+            return;
+        }
+    }
+
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+        std::remove(tmpPath.c_str());
+}
+
 NumaNodesWeights::NumaNodesWeights() {
-    for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
-        _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
+    const auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+    const bool numaLocal = numaNodes.size() > 1;
+    for (auto numa_id : numaNodes)
+        _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>(numaLocal);
+    // on a single node machine the only store is the shared one
+    _shared = numaLocal || _cache_map.empty() ? std::make_shared<MKLDNNWeightsSharing>() : _cache_map.begin()->second;
 }
 
 MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
@@ -89,4 +193,8 @@ const MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const
     return found->second;
 }
 
+MKLDNNWeightsSharing::Ptr& NumaNodesWeights::shared() {
+    return _shared;
+}
+
 }  // namespace MKLDNNPlugin
@@ -22,30 +22,6 @@
 
 namespace MKLDNNPlugin {
 
-class SimpleDataHash {
-public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
-
-protected:
-    static const int kTableSize = 256;
-    uint64_t table[kTableSize];
-};
-
 /**
  * Caching store of MKLDNNMemory objects
  * Will return a cached object or create new one
@@ -69,6 +45,17 @@ class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
 
+    /**
+     * @param numaLocal true if the store is one of the per NUMA node replicas. Such store must own all
+     * the memory it holds, so constants are copied by the stream which creates the entry (and the pages
+     * are first touched on its node) instead of being referenced in place.
+     */
+    explicit MKLDNNWeightsSharing(bool numaLocal = false) : numaLocal(numaLocal) {}
+
+    bool isNumaLocal() const {
+        return numaLocal;
+    }
+
     class MKLDNNSharedMemory {
     public:
         typedef std::shared_ptr<MKLDNNSharedMemory> Ptr;
@@ -93,16 +80,54 @@ public:
 
     MKLDNNSharedMemory::Ptr get(const std::string& key) const;
 
-    static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
-
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MKLDNNMemoryInfo::Ptr> sharedWeights;
-    static const SimpleDataHash simpleCRC;
+    const bool numaLocal;
+};
+
+/**
+ * Persistent content-addressed store of repacked constant data
+ * Entries are kept as plain files in the given directory, one file per key, so
+ * the result of weights reordering survives process restart and may be shared
+ * between processes which load the same model.
+ *
+ * Is a thread and process safe: entries are written to a temporary file first
+ * and then atomically renamed.
+ *
+ * File names include a tag of the ISA, oneDNN and plugin versions, as the layout
+ * of repacked weights depends on them. Each entry keeps the size and checksum of
+ * its data, which are verified on load.
+ */
+class MKLDNNWeightsDiskCache {
+public:
+    typedef std::shared_ptr<MKLDNNWeightsDiskCache> Ptr;
+
+    explicit MKLDNNWeightsDiskCache(const std::string& cacheDir);
+
+    /**
+     * Fills the memory with content stored under the key
+     * @return false if there is no entry, its size doesn't match memory size or its checksum doesn't match the data
+     */
+    bool load(const std::string& key, const MKLDNNMemory& memory) const;
+
+    /**
+     * Stores memory content under the key. Failures are silently ignored
+     * as the cache is only an optimization.
+     */
+    void store(const std::string& key, const MKLDNNMemory& memory) const;
+
+private:
+    std::string getEntryPath(const std::string& key) const;
+
+    std::string dir;
+    std::string environmentTag;
 };
 
 /**
  * Collection of memory caching store per NUMA node(former socket)
+ * On multi-socket machines each store is a NUMA local replica, and there is an additional
+ * store shared by all the nodes, which is used if weights replication is switched off.
  *
  * Is a thread safe
  */
@@ -113,8 +138,11 @@ public:
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    MKLDNNWeightsSharing::Ptr& shared();
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
+    MKLDNNWeightsSharing::Ptr _shared;
 };
 
 }  // namespace MKLDNNPlugin
@@ -9,6 +9,7 @@
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <transformations/utils/utils.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 
 NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::ConvertMatMulToFC, "ConvertMatMulToFC", 0);
 
@@ -99,6 +100,14 @@ MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
         // vector of new nGraph operations
         ngraph::NodeVector new_ops;
 
+        // Compressed weights: the Convert of the i8/u8 Constant is kept after the weights normalization,
+        // so the Transpose and Reshape are folded into the compressed Constant
+        auto decompression = std::dynamic_pointer_cast<ngraph::opset1::Convert>(fc_input_b.get_node_shared_ptr());
+        if (decompression && !std::dynamic_pointer_cast<ngraph::opset1::Constant>(decompression->get_input_node_shared_ptr(0)))
+            decompression = nullptr;
+        if (decompression)
+            fc_input_b = decompression->input_value(0);
+
         // Check that if second inputs is Constant operation and it's shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
         // Otherwise we replace MatMul with Gemm.
@@ -130,6 +139,14 @@ MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
                 new_ops.push_back(fc_input_b.get_node_shared_ptr());
             }
 
+            if (decompression) {
+                auto convert = std::make_shared<ngraph::opset1::Convert>(fc_input_b, decompression->get_destination_type());
+                convert->set_friendly_name(decompression->get_friendly_name());
+                ov::disable_constant_folding(convert);
+                fc_input_b = convert;
+                new_ops.push_back(convert);
+            }
+
             // Input normalization
             if (matmul->get_transpose_a() && shape_a.size() != 1) {
                 fc_input_a = create_transpose(fc_input_a, matmul->get_friendly_name() + "/transpose_a");
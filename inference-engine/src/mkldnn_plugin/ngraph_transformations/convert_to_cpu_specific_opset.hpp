@@ -17,6 +17,9 @@
 #include "convert_to_power_static.hpp"
 #include "convert_to_leaky_relu.hpp"
 #include "convert_to_swish_cpu.hpp"
+#include "convert_upsample_conv_to_deconv.hpp"
+#include "scaled_attention_fusion.hpp"
+#include "rms_norm_fusion.hpp"
 #include "transformations/convert_precision.hpp"
 #include "transformations/utils/utils.hpp"
 #include "rnn_sequences_optimization.hpp"
@@ -30,6 +33,9 @@ inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphF
     manager.register_pass<Reshape1DGroupConvolution>();
     manager.register_pass<Reshape1DAvgPool>();
     manager.register_pass<Reshape1DMaxPool>();
+    manager.register_pass<ScaledAttentionFusion>();
+    manager.register_pass<RMSNormFusion>();
+    manager.register_pass<ConvertUpsampleConvolutionToDeconvolution>();
     manager.register_pass<ConvertMatMulToFC>();
     manager.register_pass<AlignMatMulInputRanks>();
     manager.register_pass<ConvertBroadcastToTiles>();
@@ -0,0 +1,192 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "convert_upsample_conv_to_deconv.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::ConvertUpsampleConvolutionToDeconvolution, "ConvertUpsampleConvolutionToDeconvolution", 0);
+
+namespace {
+
+using Interpolate = ngraph::opset4::Interpolate;
+
+// checks that the nearest interpolation with the scale 2 copies every input pixel to exactly two neighbouring outputs
+bool isPixelReplication(Interpolate::CoordinateTransformMode coordMode, Interpolate::NearestMode nearestMode) {
+    using CoordMode = Interpolate::CoordinateTransformMode;
+    using NearestMode = Interpolate::NearestMode;
+    switch (coordMode) {
+        case CoordMode::ASYMMETRIC:
+            return nearestMode == NearestMode::FLOOR || nearestMode == NearestMode::ROUND_PREFER_FLOOR || nearestMode == NearestMode::SIMPLE;
+        case CoordMode::HALF_PIXEL:
+        case CoordMode::PYTORCH_HALF_PIXEL:
+            return nearestMode == NearestMode::ROUND_PREFER_FLOOR || nearestMode == NearestMode::ROUND_PREFER_CEIL;
+        case CoordMode::TF_HALF_PIXEL_FOR_NN:
+            return nearestMode == NearestMode::FLOOR || nearestMode == NearestMode::SIMPLE;
+        default:
+            return false;
+    }
+}
+
+bool isNearestUpsamplingX2(const std::shared_ptr<Interpolate>& interp) {
+    const auto& inShape = interp->get_input_shape(0);
+    const auto& outShape = interp->get_output_shape(0);
+    const size_t rank = inShape.size();
+    if (rank != 4 && rank != 5)
+        return false;
+    for (size_t i = 0; i < rank; i++) {
+        if (outShape[i] != (i < 2 ? inShape[i] : 2 * inShape[i]))
+            return false;
+    }
+
+    const auto& attrs = interp->get_attrs();
+    if (attrs.mode != Interpolate::InterpolateMode::NEAREST || attrs.antialias)
+        return false;
+    const auto isZero = [](size_t pad) { return pad == 0; };
+    if (!std::all_of(attrs.pads_begin.begin(), attrs.pads_begin.end(), isZero) ||
+        !std::all_of(attrs.pads_end.begin(), attrs.pads_end.end(), isZero))
+        return false;
+    if (!isPixelReplication(attrs.coordinate_transformation_mode, attrs.nearest_mode))
+        return false;
+
+    // the coordinates are computed from the scales in this mode, they must be exactly 2 as well
+    if (attrs.shape_calculation_mode == Interpolate::ShapeCalcMode::SCALES) {
+        const auto scalesConst = std::dynamic_pointer_cast<ngraph::opset1::Constant>(interp->get_input_node_shared_ptr(2));
+        if (!scalesConst)
+            return false;
+        const auto scales = scalesConst->cast_vector<float>();
+
+        std::vector<int64_t> axes(rank);
+        for (size_t i = 0; i < rank; i++)
+            axes[i] = static_cast<int64_t>(i);
+        if (interp->get_input_size() > 3) {
+            const auto axesConst = std::dynamic_pointer_cast<ngraph::opset1::Constant>(interp->get_input_node_shared_ptr(3));
+            if (!axesConst)
+                return false;
+            axes = axesConst->cast_vector<int64_t>();
+        }
+        if (axes.size() != scales.size())
+            return false;
+        for (size_t i = 0; i < axes.size(); i++) {
+            const auto axis = axes[i] < 0 ? axes[i] + static_cast<int64_t>(rank) : axes[i];
+            if (scales[i] != (axis < 2 ? 1.f : 2.f))
+                return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+MKLDNNPlugin::ConvertUpsampleConvolutionToDeconvolution::ConvertUpsampleConvolutionToDeconvolution() {
+    auto interp = ngraph::pattern::wrap_type<ngraph::opset4::Interpolate>(ngraph::pattern::has_static_shape());
+    auto weights = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto conv = ngraph::pattern::wrap_type<ngraph::opset1::Convolution>({interp, weights}, ngraph::pattern::has_static_shape());
+
+    ngraph::matcher_pass_callback callback = [this](ngraph::pattern::Matcher& m) {
+        auto conv = std::dynamic_pointer_cast<ngraph::opset1::Convolution>(m.get_match_root());
+        if (!conv || transformation_callback(conv))
+            return false;
+        auto interp = std::dynamic_pointer_cast<ngraph::opset4::Interpolate>(conv->get_input_node_shared_ptr(0));
+        auto weights = std::dynamic_pointer_cast<ngraph::opset1::Constant>(conv->get_input_node_shared_ptr(1));
+        if (!interp || !weights || interp->output(0).get_target_inputs().size() != 1)
+            return false;
+        if (!isNearestUpsamplingX2(interp))
+            return false;
+
+        const auto& wShape = weights->get_shape();
+        const size_t spatialRank = wShape.size() - 2;
+        if (spatialRank != interp->get_input_shape(0).size() - 2)
+            return false;
+
+        const auto isOne = [](size_t value) { return value == 1; };
+        if (!std::all_of(conv->get_strides().begin(), conv->get_strides().end(), isOne) ||
+            !std::all_of(conv->get_dilations().begin(), conv->get_dilations().end(), isOne))
+            return false;
+
+        // odd kernel with symmetric "same" padding, which keeps the spatial size
+        const auto autoPad = conv->get_auto_pad();
+        if (autoPad != ngraph::op::PadType::EXPLICIT && autoPad != ngraph::op::PadType::SAME_UPPER && autoPad != ngraph::op::PadType::SAME_LOWER)
+            return false;
+        std::vector<int64_t> pads(spatialRank);
+        for (size_t d = 0; d < spatialRank; d++) {
+            const size_t kernel = wShape[d + 2];
+            if (kernel % 2 == 0)
+                return false;
+            pads[d] = static_cast<int64_t>(kernel / 2);
+            if (autoPad == ngraph::op::PadType::EXPLICIT &&
+                (conv->get_pads_begin()[d] != pads[d] || conv->get_pads_end()[d] != pads[d]))
+                return false;
+        }
+
+        const size_t outChannels = wShape[0];
+        const size_t inChannels = wShape[1];
+        ngraph::Shape kernelShape(wShape.begin() + 2, wShape.end());
+        ngraph::Shape newKernelShape(kernelShape);
+        for (auto& dim : newKernelShape)
+            dim++;
+        const size_t kernelSize = ngraph::shape_size(kernelShape);
+        const size_t newKernelSize = ngraph::shape_size(newKernelShape);
+
+        // for every deconvolution kernel point collect the convolution kernel points which are summed into it
+        std::vector<std::vector<size_t>> sources(newKernelSize);
+        std::vector<int64_t> k(spatialRank);
+        for (size_t nk = 0; nk < newKernelSize; nk++) {
+            size_t rest = nk;
+            for (size_t d = spatialRank; d > 0; d--) {
+                k[d - 1] = static_cast<int64_t>(rest % newKernelShape[d - 1]);
+                rest /= newKernelShape[d - 1];
+            }
+            for (size_t r = 0; r < (size_t(1) << spatialRank); r++) {
+                bool valid = true;
+                size_t flat = 0;
+                for (size_t d = 0; d < spatialRank && valid; d++) {
+                    const int64_t u = 2 * pads[d] + static_cast<int64_t>((r >> d) & 1) - k[d];
+                    valid = u >= 0 && u < static_cast<int64_t>(kernelShape[d]);
+                    flat = flat * kernelShape[d] + static_cast<size_t>(u);
+                }
+                if (valid)
+                    sources[nk].push_back(flat);
+            }
+        }
+
+        const auto w = weights->cast_vector<float>();
+        std::vector<float> newWeights(inChannels * outChannels * newKernelSize, 0.f);
+        for (size_t oc = 0; oc < outChannels; oc++) {
+            for (size_t ic = 0; ic < inChannels; ic++) {
+                const float* src = &w[(oc * inChannels + ic) * kernelSize];
+                float* dst = &newWeights[(ic * outChannels + oc) * newKernelSize];
+                for (size_t nk = 0; nk < newKernelSize; nk++) {
+                    for (auto flat : sources[nk])
+                        dst[nk] += src[flat];
+                }
+            }
+        }
+
+        ngraph::Shape newWeightsShape{inChannels, outChannels};
+        newWeightsShape.insert(newWeightsShape.end(), newKernelShape.begin(), newKernelShape.end());
+        auto newWeightsConst = ngraph::opset1::Constant::create(weights->get_element_type(), newWeightsShape, newWeights);
+
+        const ngraph::CoordinateDiff deconvPads(pads.begin(), pads.end());
+        auto deconv = std::make_shared<ngraph::opset1::ConvolutionBackpropData>(interp->input_value(0), newWeightsConst,
+                                                                                ngraph::Strides(spatialRank, 2), deconvPads, deconvPads,
+                                                                                ngraph::Strides(spatialRank, 1));
+        if (deconv->get_output_partial_shape(0) != conv->get_output_partial_shape(0))
+            return false;
+
+        deconv->set_friendly_name(conv->get_friendly_name());
+        ngraph::copy_runtime_info({interp, conv}, {newWeightsConst, deconv});
+        ngraph::replace_node(conv, deconv);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(conv, "ConvertUpsampleConvolutionToDeconvolution");
+    this->register_matcher(m, callback);
+}
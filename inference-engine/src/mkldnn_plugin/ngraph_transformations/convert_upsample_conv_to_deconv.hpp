@@ -0,0 +1,23 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Replaces Interpolate(nearest, x2 on spatial axes) followed by Convolution(stride 1, odd kernel K, "same" pads)
+ * with ConvolutionBackpropData(stride 2, kernel K + 1) on the original input, so the upsampled tensor is never
+ * materialized. Each deconvolution weight is the sum of the two convolution weights which read the same input
+ * pixel after the nearest upsampling: W'(k) = W(2p - k) + W(2p + 1 - k), where p = (K - 1) / 2.
+ */
+class ConvertUpsampleConvolutionToDeconvolution: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    ConvertUpsampleConvolutionToDeconvolution();
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,28 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "rms_norm.hpp"
+
+constexpr ngraph::NodeTypeInfo MKLDNNPlugin::RMSNormNode::type_info;
+
+MKLDNNPlugin::RMSNormNode::RMSNormNode(const ngraph::Output<Node>& data, const float eps, const bool across_channels)
+    : Op({data}), m_eps(eps), m_across_channels(across_channels) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::RMSNormNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<MKLDNNPlugin::RMSNormNode>(new_args.at(0), m_eps, m_across_channels);
+}
+
+void MKLDNNPlugin::RMSNormNode::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this, get_input_size() == 1, "RMSNorm expects 1 input, got: ", get_input_size());
+    set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+}
+
+bool MKLDNNPlugin::RMSNormNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    visitor.on_attribute("eps", m_eps);
+    visitor.on_attribute("across_channels", m_across_channels);
+    return true;
+}
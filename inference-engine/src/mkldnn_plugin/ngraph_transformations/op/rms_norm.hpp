@@ -0,0 +1,38 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Root mean square normalization: x / Sqrt(ReduceMean(x ^ 2) + eps), the mean isn't subtracted.
+ * The normalized axes are all the axes starting from the 1st one if across_channels is true or from the 2nd one otherwise,
+ * the same as for MVN-1.
+ */
+class RMSNormNode : public ngraph::op::Op {
+public:
+    static constexpr ngraph::NodeTypeInfo type_info{"RMSNorm", 0};
+    static constexpr const ::ngraph::Node::type_info_t& get_type_info_static() { return type_info; }
+    const ngraph::NodeTypeInfo &get_type_info() const override { return type_info; }
+
+    RMSNormNode() = default;
+
+    RMSNormNode(const ngraph::Output<Node> &data, float eps, bool across_channels);
+
+    void validate_and_infer_types() override;
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override;
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector &new_args) const override;
+
+    float get_eps() const { return m_eps; }
+    bool get_across_channels() const { return m_across_channels; }
+
+private:
+    float m_eps = 1e-9f;
+    bool m_across_channels = false;
+};
+
+}  // namespace MKLDNNPlugin
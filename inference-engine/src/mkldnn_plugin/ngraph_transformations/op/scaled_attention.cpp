@@ -0,0 +1,58 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_attention.hpp"
+
+constexpr ngraph::NodeTypeInfo MKLDNNPlugin::ScaledAttentionNode::type_info;
+
+MKLDNNPlugin::ScaledAttentionNode::ScaledAttentionNode(const ngraph::Output<Node>& q,
+                                                       const ngraph::Output<Node>& k,
+                                                       const ngraph::Output<Node>& v,
+                                                       const float scale,
+                                                       const bool transpose_k)
+    : Op({q, k, v}), m_scale(scale), m_transpose_k(transpose_k) {
+    validate_and_infer_types();
+}
+
+MKLDNNPlugin::ScaledAttentionNode::ScaledAttentionNode(const ngraph::Output<Node>& q,
+                                                       const ngraph::Output<Node>& k,
+                                                       const ngraph::Output<Node>& v,
+                                                       const ngraph::Output<Node>& mask,
+                                                       const float scale,
+                                                       const bool transpose_k)
+    : Op({q, k, v, mask}), m_scale(scale), m_transpose_k(transpose_k) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::ScaledAttentionNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    if (new_args.size() == 3) {
+        return std::make_shared<MKLDNNPlugin::ScaledAttentionNode>(new_args.at(0), new_args.at(1), new_args.at(2), m_scale, m_transpose_k);
+    } else if (new_args.size() == 4) {
+        return std::make_shared<MKLDNNPlugin::ScaledAttentionNode>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3),
+                                                                   m_scale, m_transpose_k);
+    }
+
+    throw ngraph::ngraph_error("Unsupported number of arguments for ScaledAttention operation");
+}
+
+void MKLDNNPlugin::ScaledAttentionNode::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this, get_input_size() == 3 || get_input_size() == 4,
+                          "ScaledAttention expects 3 or 4 inputs, got: ", get_input_size());
+
+    auto output_shape = get_input_partial_shape(0);
+    const auto& v_shape = get_input_partial_shape(2);
+    if (output_shape.rank().is_static() && v_shape.rank().is_static()) {
+        NODE_VALIDATION_CHECK(this, output_shape.rank().get_length() >= 2 && v_shape.rank().get_length() >= 2,
+                              "ScaledAttention expects Q and V of rank 2 at least");
+        output_shape[output_shape.rank().get_length() - 1] = v_shape[v_shape.rank().get_length() - 1];
+    }
+    set_output_type(0, get_input_element_type(0), output_shape);
+}
+
+bool MKLDNNPlugin::ScaledAttentionNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("transpose_k", m_transpose_k);
+    return true;
+}
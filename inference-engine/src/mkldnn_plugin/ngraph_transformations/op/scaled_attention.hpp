@@ -0,0 +1,53 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Scaled dot-product attention: Softmax(scale * Q x K^T + mask) x V, softmax is computed over the last axis.
+ * Inputs:
+ *   Q    [..., Sq, D]
+ *   K    [..., Sk, D] or [..., D, Sk] if transpose_k is true
+ *   V    [..., Sk, Dv]
+ *   mask optional, numpy broadcastable to [..., Sq, Sk]
+ * Output: [..., Sq, Dv]
+ */
+class ScaledAttentionNode : public ngraph::op::Op {
+public:
+    static constexpr ngraph::NodeTypeInfo type_info{"ScaledAttentionCPU", 0};
+    static constexpr const ::ngraph::Node::type_info_t& get_type_info_static() { return type_info; }
+    const ngraph::NodeTypeInfo &get_type_info() const override { return type_info; }
+
+    ScaledAttentionNode() = default;
+
+    ScaledAttentionNode(const ngraph::Output<Node> &q,
+                        const ngraph::Output<Node> &k,
+                        const ngraph::Output<Node> &v,
+                        float scale,
+                        bool transpose_k);
+
+    ScaledAttentionNode(const ngraph::Output<Node> &q,
+                        const ngraph::Output<Node> &k,
+                        const ngraph::Output<Node> &v,
+                        const ngraph::Output<Node> &mask,
+                        float scale,
+                        bool transpose_k);
+
+    void validate_and_infer_types() override;
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override;
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector &new_args) const override;
+
+    float get_scale() const { return m_scale; }
+    bool get_transpose_k() const { return m_transpose_k; }
+
+private:
+    float m_scale = 1.f;
+    bool m_transpose_k = false;
+};
+
+}  // namespace MKLDNNPlugin
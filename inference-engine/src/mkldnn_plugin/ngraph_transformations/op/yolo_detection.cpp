@@ -0,0 +1,77 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "yolo_detection.hpp"
+
+constexpr ngraph::NodeTypeInfo MKLDNNPlugin::YoloDetectionNode::type_info;
+
+MKLDNNPlugin::YoloDetectionNode::YoloDetectionNode(const ngraph::OutputVector& feature_maps,
+                                                   const int64_t classes,
+                                                   const std::vector<float>& anchors,
+                                                   const int64_t input_width,
+                                                   const int64_t input_height,
+                                                   const bool do_softmax,
+                                                   const float confidence_threshold,
+                                                   const float iou_threshold,
+                                                   const int64_t keep_top_k)
+    : Op(feature_maps), m_classes(classes), m_anchors(anchors), m_input_width(input_width), m_input_height(input_height),
+      m_do_softmax(do_softmax), m_confidence_threshold(confidence_threshold), m_iou_threshold(iou_threshold),
+      m_keep_top_k(keep_top_k) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::YoloDetectionNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<MKLDNNPlugin::YoloDetectionNode>(new_args, m_classes, m_anchors, m_input_width, m_input_height,
+                                                             m_do_softmax, m_confidence_threshold, m_iou_threshold, m_keep_top_k);
+}
+
+void MKLDNNPlugin::YoloDetectionNode::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this, get_input_size() >= 1, "YoloDetection expects at least 1 input");
+    NODE_VALIDATION_CHECK(this, m_classes > 0 && m_keep_top_k > 0 && m_input_width > 0 && m_input_height > 0,
+                          "YoloDetection expects positive classes, keep_top_k and input sizes");
+
+    ngraph::Dimension batch = ngraph::Dimension::dynamic();
+    bool static_boxes = true;
+    int64_t boxes = 0;
+    for (size_t i = 0; i < get_input_size(); i++) {
+        const auto& shape = get_input_partial_shape(i);
+        NODE_VALIDATION_CHECK(this, shape.rank().is_dynamic() || shape.rank().get_length() == 4,
+                              "YoloDetection expects 4D feature maps");
+        if (shape.rank().is_dynamic()) {
+            static_boxes = false;
+            continue;
+        }
+        NODE_VALIDATION_CHECK(this, ngraph::Dimension::merge(batch, batch, shape[0]),
+                              "YoloDetection expects feature maps of the same batch");
+        if (shape[1].is_static()) {
+            const int64_t channels = shape[1].get_length();
+            NODE_VALIDATION_CHECK(this, channels % (5 + m_classes) == 0,
+                                  "YoloDetection expects the channels to be a multiple of 5 + classes");
+            boxes += channels / (5 + m_classes);
+        } else {
+            static_boxes = false;
+        }
+    }
+    if (static_boxes) {
+        NODE_VALIDATION_CHECK(this, static_cast<int64_t>(m_anchors.size()) == 2 * boxes,
+                              "YoloDetection expects (width, height) anchors pair for each box of the inputs");
+    }
+
+    const ngraph::Dimension results = batch.is_static() ? ngraph::Dimension(batch.get_length() * m_keep_top_k)
+                                                        : ngraph::Dimension::dynamic();
+    set_output_type(0, get_input_element_type(0), ngraph::PartialShape{1, 1, results, 7});
+}
+
+bool MKLDNNPlugin::YoloDetectionNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    visitor.on_attribute("classes", m_classes);
+    visitor.on_attribute("anchors", m_anchors);
+    visitor.on_attribute("input_width", m_input_width);
+    visitor.on_attribute("input_height", m_input_height);
+    visitor.on_attribute("do_softmax", m_do_softmax);
+    visitor.on_attribute("confidence_threshold", m_confidence_threshold);
+    visitor.on_attribute("iou_threshold", m_iou_threshold);
+    visitor.on_attribute("keep_top_k", m_keep_top_k);
+    return true;
+}
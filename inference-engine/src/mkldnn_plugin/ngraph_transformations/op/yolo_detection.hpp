@@ -0,0 +1,64 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * YOLO post-processing: activations, box decoding, score thresholding and class aware NMS of the detection head.
+ * Inputs: raw feature maps of the scales [N, B * (5 + classes), H, W], the channels of each box are
+ *   (tx, ty, tw, th, objectness, class scores)
+ * Attributes:
+ *   anchors (width, height) pairs of the boxes of all the inputs in the order of the inputs
+ *   input_width, input_height network input size the logistic head anchors are measured in, the anchors of
+ *   the softmax (YOLOv2 region) head are measured in the feature map cells
+ * Output: DetectionOutput-like [1, 1, N * keep_top_k, 7] rows of (image, class, score, xmin, ymin, xmax, ymax),
+ *   the coordinates are normalized, the rows after the last detection start with -1
+ */
+class YoloDetectionNode : public ngraph::op::Op {
+public:
+    static constexpr ngraph::NodeTypeInfo type_info{"YoloDetectionCPU", 0};
+    static constexpr const ::ngraph::Node::type_info_t& get_type_info_static() { return type_info; }
+    const ngraph::NodeTypeInfo &get_type_info() const override { return type_info; }
+
+    YoloDetectionNode() = default;
+
+    YoloDetectionNode(const ngraph::OutputVector &feature_maps,
+                      int64_t classes,
+                      const std::vector<float> &anchors,
+                      int64_t input_width,
+                      int64_t input_height,
+                      bool do_softmax,
+                      float confidence_threshold,
+                      float iou_threshold,
+                      int64_t keep_top_k);
+
+    void validate_and_infer_types() override;
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override;
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector &new_args) const override;
+
+    int64_t get_classes() const { return m_classes; }
+    const std::vector<float>& get_anchors() const { return m_anchors; }
+    int64_t get_input_width() const { return m_input_width; }
+    int64_t get_input_height() const { return m_input_height; }
+    bool get_do_softmax() const { return m_do_softmax; }
+    float get_confidence_threshold() const { return m_confidence_threshold; }
+    float get_iou_threshold() const { return m_iou_threshold; }
+    int64_t get_keep_top_k() const { return m_keep_top_k; }
+
+private:
+    int64_t m_classes = 0;
+    std::vector<float> m_anchors;
+    int64_t m_input_width = 0;
+    int64_t m_input_height = 0;
+    bool m_do_softmax = false;
+    float m_confidence_threshold = 0.5f;
+    float m_iou_threshold = 0.45f;
+    int64_t m_keep_top_k = 100;
+};
+
+}  // namespace MKLDNNPlugin
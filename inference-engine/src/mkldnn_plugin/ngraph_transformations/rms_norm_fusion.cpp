@@ -0,0 +1,121 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "rms_norm_fusion.hpp"
+#include "op/rms_norm.hpp"
+#include "transformations/utils/utils.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+#include <algorithm>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::RMSNormFusion, "RMSNormFusion", 0);
+
+namespace {
+
+bool isSingleValue(const std::shared_ptr<ngraph::Node>& node, float ref) {
+    const auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(node);
+    float value = 0.f;
+    return constant && ngraph::op::util::get_single_value(constant, value) && value == ref;
+}
+
+}  // namespace
+
+MKLDNNPlugin::RMSNormFusion::RMSNormFusion() {
+    auto m_x = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+
+    // x ^ 2 is given either as x * x or as Power(x, 2)
+    auto m_mul_lhs = ngraph::pattern::any_input();
+    auto m_mul_rhs = ngraph::pattern::any_input();
+    auto m_mul_square = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({m_mul_lhs, m_mul_rhs});
+    auto m_pow_base = ngraph::pattern::any_input();
+    auto m_pow_exp = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto m_pow_square = ngraph::pattern::wrap_type<ngraph::opset1::Power>({m_pow_base, m_pow_exp});
+    auto m_square = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{m_mul_square, m_pow_square});
+
+    auto m_axes = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto m_mean = ngraph::pattern::wrap_type<ngraph::opset1::ReduceMean>({m_square, m_axes});
+    auto m_eps = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto m_add_eps = ngraph::pattern::wrap_type<ngraph::opset1::Add>({m_mean, m_eps});
+    auto m_sqrt = ngraph::pattern::wrap_type<ngraph::opset1::Sqrt>({m_add_eps});
+
+    auto m_div = ngraph::pattern::wrap_type<ngraph::opset1::Divide>({m_x, m_sqrt});
+
+    // x * Power(Sqrt(...), -1) is left by ConvertDivide, x * Power(..., -0.5) is the reciprocal square root
+    auto m_inv_exp = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto m_inv_sqrt = ngraph::pattern::wrap_type<ngraph::opset1::Power>({m_sqrt, m_inv_exp});
+    auto m_rsqrt_exp = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto m_rsqrt = ngraph::pattern::wrap_type<ngraph::opset1::Power>({m_add_eps, m_rsqrt_exp});
+    auto m_inv = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{m_inv_sqrt, m_rsqrt});
+    auto m_mul = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({m_x, m_inv});
+
+    auto m_output = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{m_div, m_mul});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        const auto& pattern_to_output = m.get_pattern_value_map();
+        const auto& x = pattern_to_output.at(m_x);
+        const auto output = m.get_match_root();
+        if (transformation_callback(output))
+            return false;
+
+        const auto precision = x.get_element_type();
+        if (precision != ngraph::element::f32 && precision != ngraph::element::bf16)
+            return false;
+
+        if (pattern_to_output.count(m_mul_square)) {
+            if (pattern_to_output.at(m_mul_lhs) != x || pattern_to_output.at(m_mul_rhs) != x)
+                return false;
+        } else {
+            if (pattern_to_output.at(m_pow_base) != x || !isSingleValue(pattern_to_output.at(m_pow_exp).get_node_shared_ptr(), 2.f))
+                return false;
+        }
+        if (pattern_to_output.count(m_inv_sqrt) && !isSingleValue(pattern_to_output.at(m_inv_exp).get_node_shared_ptr(), -1.f))
+            return false;
+        if (pattern_to_output.count(m_rsqrt) && !isSingleValue(pattern_to_output.at(m_rsqrt_exp).get_node_shared_ptr(), -0.5f))
+            return false;
+
+        const auto eps_const = std::dynamic_pointer_cast<ngraph::opset1::Constant>(pattern_to_output.at(m_eps).get_node_shared_ptr());
+        float eps = 0.f;
+        if (!eps_const || !ngraph::op::util::get_single_value(eps_const, eps) || eps < 0.f)
+            return false;
+
+        // the mean must be broadcasted back over the reduced axes only, so the output keeps the shape of x
+        const auto mean = std::dynamic_pointer_cast<ngraph::opset1::ReduceMean>(pattern_to_output.at(m_mean).get_node_shared_ptr());
+        if (!mean || !mean->get_keep_dims() || output->get_output_shape(0) != x.get_shape())
+            return false;
+
+        const auto axes_const = std::dynamic_pointer_cast<ngraph::opset1::Constant>(pattern_to_output.at(m_axes).get_node_shared_ptr());
+        if (!axes_const)
+            return false;
+        const auto rank = static_cast<int64_t>(x.get_shape().size());
+        auto axes = axes_const->cast_vector<int64_t>();
+        for (auto& axis : axes)
+            axis = axis < 0 ? axis + rank : axis;
+        std::sort(axes.begin(), axes.end());
+        // the trailing axes starting from the 1st one (across channels) or from the 2nd one
+        if (axes.empty() || axes.back() != rank - 1 || axes.front() < 1 || axes.front() > 2 || rank > 5)
+            return false;
+        for (size_t i = 1; i < axes.size(); i++) {
+            if (axes[i] != axes[i - 1] + 1)
+                return false;
+        }
+        const bool across_channels = axes.front() == 1;
+
+        auto rms_norm = std::make_shared<MKLDNNPlugin::RMSNormNode>(x, eps, across_channels);
+        rms_norm->set_friendly_name(output->get_friendly_name());
+        ngraph::NodeVector fused_nodes = {output, mean, pattern_to_output.at(m_add_eps).get_node_shared_ptr()};
+        for (const auto& pattern : {m_mul_square, m_pow_square, m_sqrt, m_inv_sqrt, m_rsqrt}) {
+            if (pattern_to_output.count(pattern))
+                fused_nodes.push_back(pattern_to_output.at(pattern).get_node_shared_ptr());
+        }
+        ngraph::copy_runtime_info(fused_nodes, rms_norm);
+        ngraph::replace_node(output, rms_norm);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_output, "RMSNormFusion");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,22 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Fuses x / Sqrt(ReduceMean(x ^ 2, axes) + eps) into RMSNormNode, the division may be already converted
+ * to the multiplication by Power(-1) and Sqrt with Power(-1) may be given as Power(-0.5).
+ * The reduced axes must be the trailing ones starting from the 1st or the 2nd axis.
+ */
+class RMSNormFusion : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    RMSNormFusion();
+};
+
+}  // namespace MKLDNNPlugin
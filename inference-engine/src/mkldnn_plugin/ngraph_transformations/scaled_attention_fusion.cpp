@@ -0,0 +1,135 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_attention_fusion.hpp"
+#include "op/scaled_attention.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::ScaledAttentionFusion, "ScaledAttentionFusion", 0);
+
+namespace {
+
+bool isSupportedPrecision(const ngraph::element::Type& type) {
+    return type == ngraph::element::f32 || type == ngraph::element::bf16;
+}
+
+// mask must be numpy broadcastable to the scores without changing their shape
+bool isBroadcastableTo(const ngraph::Shape& mask, const ngraph::Shape& scores) {
+    if (mask.size() > scores.size())
+        return false;
+    for (size_t i = 1; i <= mask.size(); i++) {
+        const auto dim = mask[mask.size() - i];
+        if (dim != 1 && dim != scores[scores.size() - i])
+            return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+MKLDNNPlugin::ScaledAttentionFusion::ScaledAttentionFusion() {
+    auto single_static_consumer = [](ngraph::Output<ngraph::Node> output) {
+        return ngraph::pattern::consumers_count(1)(output) && ngraph::pattern::has_static_shape()(output);
+    };
+
+    auto m_q = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto m_k = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto m_v = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto m_qk = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({m_q, m_k}, single_static_consumer);
+
+    auto m_scale = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto m_scaled = ngraph::pattern::wrap_type<ngraph::opset1::Multiply, ngraph::opset1::Divide>({m_qk, m_scale}, single_static_consumer);
+    auto m_scores = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{m_qk, m_scaled});
+
+    auto m_mask = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto m_masked = ngraph::pattern::wrap_type<ngraph::opset1::Add>({m_scores, m_mask}, single_static_consumer);
+    auto m_softmax_input = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{m_scores, m_masked});
+
+    auto m_softmax = ngraph::pattern::wrap_type<ngraph::opset1::Softmax>({m_softmax_input}, single_static_consumer);
+    auto m_output = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({m_softmax, m_v}, ngraph::pattern::has_static_shape());
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        const auto& pattern_to_output = m.get_pattern_value_map();
+
+        const auto qk = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_to_output.at(m_qk).get_node_shared_ptr());
+        const auto softmax = std::dynamic_pointer_cast<ngraph::opset1::Softmax>(pattern_to_output.at(m_softmax).get_node_shared_ptr());
+        const auto output = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_to_output.at(m_output).get_node_shared_ptr());
+        if (!qk || !softmax || !output || transformation_callback(output))
+            return false;
+
+        // Q [..., Sq, D] x K^T, where K is [..., Sk, D] (transpose_b) or [..., D, Sk]
+        if (qk->get_transpose_a() || output->get_transpose_a() || output->get_transpose_b())
+            return false;
+
+        const auto& q = pattern_to_output.at(m_q);
+        const auto& k = pattern_to_output.at(m_k);
+        const auto& v = pattern_to_output.at(m_v);
+        const auto& q_shape = q.get_shape();
+        const auto& k_shape = k.get_shape();
+        const auto& v_shape = v.get_shape();
+        const auto& scores_shape = qk->get_output_shape(0);
+        const size_t rank = q_shape.size();
+        if (rank < 3 || k_shape.size() != rank || v_shape.size() != rank)
+            return false;
+        // batch dimensions are not broadcasted
+        if (!std::equal(q_shape.begin(), q_shape.end() - 2, k_shape.begin()) ||
+            !std::equal(q_shape.begin(), q_shape.end() - 2, v_shape.begin()))
+            return false;
+        const bool transpose_k = !qk->get_transpose_b();
+        const size_t sk = transpose_k ? k_shape[rank - 1] : k_shape[rank - 2];
+        if (sk != v_shape[rank - 2])
+            return false;
+
+        const auto precision = q.get_element_type();
+        if (!isSupportedPrecision(precision) || k.get_element_type() != precision || v.get_element_type() != precision)
+            return false;
+
+        if (softmax->get_axis() != rank - 1)
+            return false;
+
+        ngraph::NodeVector fused_nodes = {qk, softmax, output};
+
+        float scale = 1.f;
+        if (pattern_to_output.count(m_scaled)) {
+            const auto scaled = pattern_to_output.at(m_scaled).get_node_shared_ptr();
+            const auto scale_const = std::dynamic_pointer_cast<ngraph::opset1::Constant>(pattern_to_output.at(m_scale).get_node_shared_ptr());
+            if (!scale_const || ngraph::shape_size(scale_const->get_shape()) != 1 || scaled->get_output_shape(0) != scores_shape)
+                return false;
+            const float value = scale_const->cast_vector<float>()[0];
+            if (ngraph::is_type<ngraph::opset1::Divide>(scaled)) {
+                // constant must be the divisor
+                if (scaled->get_input_node_shared_ptr(1) != scale_const || value == 0.f)
+                    return false;
+                scale = 1.f / value;
+            } else {
+                scale = value;
+            }
+            fused_nodes.push_back(scaled);
+        }
+
+        std::shared_ptr<ngraph::Node> attention;
+        if (pattern_to_output.count(m_masked)) {
+            const auto masked = pattern_to_output.at(m_masked).get_node_shared_ptr();
+            const auto& mask = pattern_to_output.at(m_mask);
+            if (masked->get_autob().m_type != ngraph::op::AutoBroadcastType::NUMPY || !isSupportedPrecision(mask.get_element_type()) ||
+                !isBroadcastableTo(mask.get_shape(), scores_shape))
+                return false;
+            fused_nodes.push_back(masked);
+            attention = std::make_shared<MKLDNNPlugin::ScaledAttentionNode>(q, k, v, mask, scale, transpose_k);
+        } else {
+            attention = std::make_shared<MKLDNNPlugin::ScaledAttentionNode>(q, k, v, scale, transpose_k);
+        }
+
+        attention->set_friendly_name(output->get_friendly_name());
+        ngraph::copy_runtime_info(fused_nodes, attention);
+        ngraph::replace_node(output, attention);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_output, "ScaledAttentionFusion");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,21 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Fuses MatMul(Q, K) -> [Multiply/Divide by scalar] -> [Add(mask)] -> Softmax(last axis) -> MatMul(V)
+ * into ScaledAttentionNode, so the [..., Sq, Sk] attention scores are never materialized.
+ */
+class ScaledAttentionFusion : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    ScaledAttentionFusion();
+};
+
+}  // namespace MKLDNNPlugin
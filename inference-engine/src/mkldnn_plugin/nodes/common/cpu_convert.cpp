@@ -17,7 +17,7 @@ namespace {
 template<typename srcType, typename dstType>
 void convert(const void *srcPtr, void *dstPtr, const size_t size) {
     if (std::is_same<srcType, dstType>::value) {
-        cpu_memcpy(dstPtr, srcPtr, size*sizeof(dstType));
+        cpu_parallel_memcpy(dstPtr, srcPtr, size*sizeof(dstType));
     } else {
         const srcType *srcData = reinterpret_cast<const srcType *>(srcPtr);
         dstType *dstData = reinterpret_cast<dstType *>(dstPtr);
@@ -67,7 +67,7 @@ void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision d
         IE_THROW() << "cpu_convert has null data pointer";
 
     if (srcPrc == dstPrc) {
-        cpu_memcpy(dstPtr, srcPtr, size*dstPrc.size());
+        cpu_parallel_memcpy(dstPtr, srcPtr, size*dstPrc.size());
         return;
     }
 
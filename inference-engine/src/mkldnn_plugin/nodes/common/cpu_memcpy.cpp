@@ -0,0 +1,73 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_memcpy.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <emmintrin.h>
+#include <ie_parallel.hpp>
+#include "mkldnn/ie_mkldnn.h"
+#include "utils/general_utils.h"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+namespace {
+// the smaller copies don't pay off the dispatch to the threads
+constexpr size_t parallelCopyThreshold = 256 * 1024;
+// every thread copies at least this number of bytes
+constexpr size_t minChunkSize = 64 * 1024;
+constexpr size_t cacheLineSize = 64;
+
+void streamingCopy(uint8_t* dst, const uint8_t* src, size_t count) {
+    // the bytes up to the first cache line of the destination are copied as usual, the full lines are streamed
+    const size_t head = (std::min)(count, (cacheLineSize - reinterpret_cast<uintptr_t>(dst) % cacheLineSize) % cacheLineSize);
+    std::memcpy(dst, src, head);
+
+    size_t i = head;
+    for (; i + cacheLineSize <= count; i += cacheLineSize) {
+        const auto srcLine = reinterpret_cast<const __m128i*>(src + i);
+        const auto dstLine = reinterpret_cast<__m128i*>(dst + i);
+        const __m128i v0 = _mm_loadu_si128(srcLine);
+        const __m128i v1 = _mm_loadu_si128(srcLine + 1);
+        const __m128i v2 = _mm_loadu_si128(srcLine + 2);
+        const __m128i v3 = _mm_loadu_si128(srcLine + 3);
+        _mm_stream_si128(dstLine, v0);
+        _mm_stream_si128(dstLine + 1, v1);
+        _mm_stream_si128(dstLine + 2, v2);
+        _mm_stream_si128(dstLine + 3, v3);
+    }
+    std::memcpy(dst + i, src + i, count - i);
+    // the streamed stores are weakly ordered, they have to be visible before the thread reports the chunk is done
+    _mm_sfence();
+}
+}  // namespace
+
+void cpu_parallel_memcpy(void* dst, const void* src, size_t count) {
+    if (count < parallelCopyThreshold) {
+        cpu_memcpy(dst, src, count);
+        return;
+    }
+
+    static const size_t streamingThreshold = static_cast<size_t>(mkldnn::utils::get_cache_size(3, false)) / 2;
+    const bool streaming = streamingThreshold != 0 && count > streamingThreshold;
+
+    const size_t chunks = (std::max)(size_t(1), (std::min)(static_cast<size_t>(parallel_get_max_threads()), count / minChunkSize));
+    // the chunks are whole cache lines, so the threads don't write the same lines of the aligned destination
+    const size_t chunkSize = rnd_up(div_up(count, chunks), cacheLineSize);
+
+    auto dstData = static_cast<uint8_t*>(dst);
+    auto srcData = static_cast<const uint8_t*>(src);
+    parallel_for(chunks, [&](size_t c) {
+        const size_t begin = c * chunkSize;
+        if (begin >= count)
+            return;
+        const size_t size = (std::min)(chunkSize, count - begin);
+        if (streaming)
+            streamingCopy(dstData + begin, srcData + begin, size);
+        else
+            std::memcpy(dstData + begin, srcData + begin, size);
+    });
+}
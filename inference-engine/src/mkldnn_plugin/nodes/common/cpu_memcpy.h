@@ -4,9 +4,14 @@
 
 #pragma once
 
+#include <cstdint>
 #include <cstring>
 #include "ie_api.h"
 
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#endif
+
 /**
  * @brief Copies bytes between buffers with security enhancements
  * Copies count bytes from src to dest. If the source and destination
@@ -47,3 +52,38 @@ inline int cpu_memcpy_s(void* dst, size_t dst_size, const void* src, size_t coun
 #endif
     return 0;
 }
+
+/**
+ * @brief Copies the large buffers by the threads of the current arena (e.g. the threads of the stream), the small
+ * copies are done by cpu_memcpy. The copies larger than the half of the last level cache are done with the non-temporal
+ * stores, so the destination, which doesn't fit the cache anyway, doesn't evict the working set of the graph.
+ * The source and the destination must not overlap.
+ * @param dst
+ * pointer to the object to copy to
+ * @param src
+ * pointer to the object to copy from
+ * @param count
+ * number of bytes to copy
+ */
+void cpu_parallel_memcpy(void* dst, const void* src, size_t count);
+
+/**
+ * @brief Hints the CPU to fetch the cache lines of the bytes [src, src + count) into all cache levels.
+ * Used to hide memory latency of data-dependent reads (e.g. table rows selected by indices),
+ * which hardware prefetchers cannot predict.
+ * @param src
+ * pointer to the first byte to prefetch
+ * @param count
+ * number of bytes to prefetch
+ */
+inline void cpu_prefetch(const void* src, size_t count) {
+    constexpr size_t cacheLineSize = 64;
+    const char* ptr = static_cast<const char*>(src);
+    for (size_t offset = 0; offset < count; offset += cacheLineSize) {
+#if defined(_MSC_VER)
+        _mm_prefetch(ptr + offset, _MM_HINT_T0);
+#else
+        __builtin_prefetch(ptr + offset, 0, 3);
+#endif
+    }
+}
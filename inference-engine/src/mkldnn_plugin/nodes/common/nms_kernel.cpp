@@ -0,0 +1,511 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_kernel.h"
+
+#include <cpu/x64/jit_generator.hpp>
+#include <mkldnn.hpp>  // TODO: just to replace mkldnn->dnnl via macros
+
+#include <algorithm>
+#include <cassert>
+
+using namespace MKLDNNPlugin;
+using namespace mkldnn;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+namespace MKLDNNPlugin {
+
+struct jit_nms_config_params {
+    float norm;
+    bool inclusive_score_threshold;
+    bool suppression_check;  // IoU kernel stops on the first IoU exceeding the threshold instead of storing IoU values
+};
+
+struct jit_args_nms_filter {
+    const float* scores;
+    size_t count;
+    float threshold;
+    float* dst_scores;
+    int* dst_indices;
+    size_t* filtered;
+};
+
+struct jit_args_nms_iou {
+    const float* box;  // NmsBox
+    const float* ymin;
+    const float* xmin;
+    const float* ymax;
+    const float* xmax;
+    const float* area;
+    size_t count;
+    float norm;
+    float iou_threshold;
+    float* iou;
+    int* suppressed;
+};
+
+struct jit_uni_nms_filter_kernel {
+    void (*ker_)(const jit_args_nms_filter *);
+
+    void operator()(const jit_args_nms_filter *args) { assert(ker_); ker_(args); }
+
+    virtual void create_ker() = 0;
+
+    jit_uni_nms_filter_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_nms_filter_kernel() {}
+};
+
+struct jit_uni_nms_iou_kernel {
+    void (*ker_)(const jit_args_nms_iou *);
+
+    void operator()(const jit_args_nms_iou *args) { assert(ker_); ker_(args); }
+
+    virtual void create_ker() = 0;
+
+    jit_uni_nms_iou_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_nms_iou_kernel() {}
+};
+
+}  // namespace MKLDNNPlugin
+
+namespace {
+
+#define GET_OFF(field) offsetof(jit_args_nms_filter, field)
+
+template <cpu_isa_t isa>
+struct jit_uni_nms_filter_kernel_f32 : public jit_uni_nms_filter_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_nms_filter_kernel_f32)
+
+    explicit jit_uni_nms_filter_kernel_f32(jit_nms_config_params jcp)
+        : jit_uni_nms_filter_kernel(), jit_generator(), jcp_(jcp) {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(scores)]);
+        mov(reg_count, ptr[reg_params + GET_OFF(count)]);
+        mov(reg_dst_scores, ptr[reg_params + GET_OFF(dst_scores)]);
+        mov(reg_dst_indices, ptr[reg_params + GET_OFF(dst_indices)]);
+        uni_vbroadcastss(vmm_threshold, ptr[reg_params + GET_OFF(threshold)]);
+
+        xor_(reg_idx, reg_idx);
+        xor_(reg_filtered, reg_filtered);
+
+        // threshold < score, or threshold <= score for the inclusive threshold
+        const int predicate = jcp_.inclusive_score_threshold ? _cmp_le_os : _cmp_lt_os;
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label next_label;
+        Xbyak::Label passed_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label tail_next_label;
+        Xbyak::Label exit_label;
+
+        L(main_loop_label); {
+            mov(reg_tmp, reg_count);
+            sub(reg_tmp, reg_idx);
+            cmp(reg_tmp, simd_w);
+            jl(tail_loop_label, T_NEAR);
+
+            if (isa == avx512_common) {
+                vcmpps(k_mask, vmm_threshold, ptr[reg_src + reg_idx * sizeof(float)], predicate);
+                kmovw(reg_mask.cvt32(), k_mask);
+            } else {
+                uni_vcmpps(vmm_mask, vmm_threshold, ptr[reg_src + reg_idx * sizeof(float)], predicate);
+                uni_vmovmskps(reg_mask.cvt32(), vmm_mask);
+            }
+            // most of the scores are usually below the threshold, so the whole vector is skipped
+            test(reg_mask.cvt32(), reg_mask.cvt32());
+            jz(next_label, T_NEAR);
+
+            L(passed_label); {
+                bsf(reg_bit.cvt32(), reg_mask.cvt32());
+                lea(reg_tmp, ptr[reg_idx + reg_bit]);
+                mov(dword[reg_dst_indices + reg_filtered * sizeof(int)], reg_tmp.cvt32());
+                mov(reg_tmp.cvt32(), dword[reg_src + reg_tmp * sizeof(float)]);
+                mov(dword[reg_dst_scores + reg_filtered * sizeof(float)], reg_tmp.cvt32());
+                inc(reg_filtered);
+
+                // clear the lowest set bit
+                mov(reg_tmp.cvt32(), reg_mask.cvt32());
+                sub(reg_tmp.cvt32(), 1);
+                and_(reg_mask.cvt32(), reg_tmp.cvt32());
+                jnz(passed_label, T_NEAR);
+            }
+
+            L(next_label);
+            add(reg_idx, simd_w);
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(tail_loop_label); {
+            cmp(reg_idx, reg_count);
+            jge(exit_label, T_NEAR);
+
+            uni_vmovss(xmm_score, ptr[reg_src + reg_idx * sizeof(float)]);
+            if (isa == sse41)
+                ucomiss(xmm_score, xmm_threshold);
+            else
+                vucomiss(xmm_score, xmm_threshold);
+            // unordered comparison sets CF, so NaN scores never pass
+            if (jcp_.inclusive_score_threshold)
+                jb(tail_next_label, T_NEAR);
+            else
+                jbe(tail_next_label, T_NEAR);
+
+            mov(dword[reg_dst_indices + reg_filtered * sizeof(int)], reg_idx.cvt32());
+            uni_vmovss(ptr[reg_dst_scores + reg_filtered * sizeof(float)], xmm_score);
+            inc(reg_filtered);
+
+            L(tail_next_label);
+            inc(reg_idx);
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+        mov(reg_tmp, ptr[reg_params + GET_OFF(filtered)]);
+        mov(ptr[reg_tmp], reg_filtered);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_count = r9;
+    Xbyak::Reg64 reg_dst_scores = r10;
+    Xbyak::Reg64 reg_dst_indices = r11;
+    Xbyak::Reg64 reg_idx = r12;
+    Xbyak::Reg64 reg_filtered = r13;
+    Xbyak::Reg64 reg_mask = r14;
+    Xbyak::Reg64 reg_bit = r15;
+    Xbyak::Reg64 reg_tmp = rax;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_threshold = Vmm(0);
+    Xbyak::Xmm xmm_threshold = Xbyak::Xmm(0);
+    Vmm vmm_mask = Vmm(1);
+    Xbyak::Xmm xmm_score = Xbyak::Xmm(2);
+
+    const Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+
+    jit_nms_config_params jcp_;
+};
+
+#undef GET_OFF
+#define GET_OFF(field) offsetof(jit_args_nms_iou, field)
+
+/*
+ * Computes IoU of one box against simd_w boxes at once, the operations and their order are the same as in
+ * NmsKernel::intersectionOverUnion(), so the results are bitwise equal.
+ * Whole vectors are processed, the tails are covered by the padding of NmsSelectedBoxes.
+ */
+template <cpu_isa_t isa>
+struct jit_uni_nms_iou_kernel_f32 : public jit_uni_nms_iou_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_nms_iou_kernel_f32)
+
+    explicit jit_uni_nms_iou_kernel_f32(jit_nms_config_params jcp)
+        : jit_uni_nms_iou_kernel(), jit_generator(), jcp_(jcp) {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_box, ptr[reg_params + GET_OFF(box)]);
+        mov(reg_ymin, ptr[reg_params + GET_OFF(ymin)]);
+        mov(reg_xmin, ptr[reg_params + GET_OFF(xmin)]);
+        mov(reg_ymax, ptr[reg_params + GET_OFF(ymax)]);
+        mov(reg_xmax, ptr[reg_params + GET_OFF(xmax)]);
+        mov(reg_area, ptr[reg_params + GET_OFF(area)]);
+        mov(reg_count, ptr[reg_params + GET_OFF(count)]);
+        if (jcp_.suppression_check)
+            uni_vbroadcastss(vmm_iou_threshold, ptr[reg_params + GET_OFF(iou_threshold)]);
+        else
+            mov(reg_dst, ptr[reg_params + GET_OFF(iou)]);
+        if (jcp_.norm != 0.f)
+            uni_vbroadcastss(vmm_norm, ptr[reg_params + GET_OFF(norm)]);
+
+        uni_vbroadcastss(vmm_box_ymin, ptr[reg_box + offsetof(NmsBox, ymin)]);
+        uni_vbroadcastss(vmm_box_xmin, ptr[reg_box + offsetof(NmsBox, xmin)]);
+        uni_vbroadcastss(vmm_box_ymax, ptr[reg_box + offsetof(NmsBox, ymax)]);
+        uni_vbroadcastss(vmm_box_xmax, ptr[reg_box + offsetof(NmsBox, xmax)]);
+        uni_vbroadcastss(vmm_box_area, ptr[reg_box + offsetof(NmsBox, area)]);
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        xor_(reg_idx, reg_idx);
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label suppressed_label;
+        Xbyak::Label exit_label;
+
+        L(main_loop_label); {
+            cmp(reg_idx, reg_count);
+            jge(exit_label, T_NEAR);
+
+            // height = max(min(ymaxI, ymaxJ) - max(yminI, yminJ) + norm, 0)
+            side(vmm_height, reg_ymin, vmm_box_ymin, reg_ymax, vmm_box_ymax);
+            side(vmm_width, reg_xmin, vmm_box_xmin, reg_xmax, vmm_box_xmax);
+            uni_vmulps(vmm_height, vmm_height, vmm_width);  // intersection
+
+            uni_vmovups(vmm_area, ptr[reg_area + reg_idx * sizeof(float)]);
+            uni_vmovups(vmm_union, vmm_area);
+            uni_vaddps(vmm_union, vmm_union, vmm_box_area);
+            uni_vsubps(vmm_union, vmm_union, vmm_height);
+            uni_vdivps(vmm_height, vmm_height, vmm_union);  // IoU
+
+            // IoU is zero for the boxes with not positive area
+            Vmm vmm_iou = vmm_height;
+            if (isa == avx512_common) {
+                vcmpps(k_mask, vmm_area, vmm_zero, _cmp_le_os);
+                vpxord(vmm_iou | k_mask, vmm_iou, vmm_iou);
+            } else {
+                uni_vcmpps(vmm_mask, vmm_area, vmm_zero, _cmp_le_os);
+                uni_vandnps(vmm_mask, vmm_mask, vmm_iou);
+                vmm_iou = vmm_mask;
+            }
+
+            if (jcp_.suppression_check) {
+                // threshold <= IoU, false for NaN as in the scalar code
+                if (isa == avx512_common) {
+                    vcmpps(k_mask, vmm_iou_threshold, vmm_iou, _cmp_le_os);
+                    kortestw(k_mask, k_mask);
+                } else {
+                    uni_vcmpps(vmm_area, vmm_iou_threshold, vmm_iou, _cmp_le_os);
+                    uni_vmovmskps(reg_tmp.cvt32(), vmm_area);
+                    test(reg_tmp.cvt32(), reg_tmp.cvt32());
+                }
+                jnz(suppressed_label, T_NEAR);
+            } else {
+                uni_vmovups(ptr[reg_dst + reg_idx * sizeof(float)], vmm_iou);
+            }
+
+            add(reg_idx, simd_w);
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        if (jcp_.suppression_check) {
+            L(suppressed_label);
+            mov(reg_tmp, ptr[reg_params + GET_OFF(suppressed)]);
+            mov(dword[reg_tmp], 1);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_box = r8;
+    Xbyak::Reg64 reg_ymin = r9;
+    Xbyak::Reg64 reg_xmin = r10;
+    Xbyak::Reg64 reg_ymax = r11;
+    Xbyak::Reg64 reg_xmax = r12;
+    Xbyak::Reg64 reg_area = r13;
+    Xbyak::Reg64 reg_count = r14;
+    Xbyak::Reg64 reg_dst = r15;
+    Xbyak::Reg64 reg_idx = rax;
+    Xbyak::Reg64 reg_tmp = rdx;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_box_ymin = Vmm(0);
+    Vmm vmm_box_xmin = Vmm(1);
+    Vmm vmm_box_ymax = Vmm(2);
+    Vmm vmm_box_xmax = Vmm(3);
+    Vmm vmm_box_area = Vmm(4);
+    Vmm vmm_zero = Vmm(5);
+    Vmm vmm_norm = Vmm(6);
+    Vmm vmm_iou_threshold = Vmm(7);
+    Vmm vmm_height = Vmm(8);
+    Vmm vmm_width = Vmm(9);
+    Vmm vmm_area = Vmm(10);
+    Vmm vmm_union = Vmm(11);
+    Vmm vmm_mask = Vmm(12);
+    Vmm vmm_aux = Vmm(13);
+
+    const Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+
+    jit_nms_config_params jcp_;
+
+    // dst = max(min(maxI, maxJ) - max(minI, minJ) + norm, 0), the operands order matches std::min/std::max
+    void side(const Vmm& vmm_dst, const Xbyak::Reg64& reg_min, const Vmm& vmm_box_min,
+              const Xbyak::Reg64& reg_max, const Vmm& vmm_box_max) {
+        uni_vmovups(vmm_dst, ptr[reg_max + reg_idx * sizeof(float)]);
+        uni_vminps(vmm_dst, vmm_dst, vmm_box_max);
+        uni_vmovups(vmm_aux, ptr[reg_min + reg_idx * sizeof(float)]);
+        uni_vmaxps(vmm_aux, vmm_aux, vmm_box_min);
+        uni_vsubps(vmm_dst, vmm_dst, vmm_aux);
+        if (jcp_.norm != 0.f)
+            uni_vaddps(vmm_dst, vmm_dst, vmm_norm);
+        uni_vmovups(vmm_aux, vmm_zero);
+        uni_vmaxps(vmm_aux, vmm_aux, vmm_dst);
+        uni_vmovups(vmm_dst, vmm_aux);
+    }
+};
+
+#undef GET_OFF
+
+}  // namespace
+
+constexpr size_t NmsSelectedBoxes::padding;
+
+NmsSelectedBoxes::NmsSelectedBoxes(size_t capacity)
+    : stride((capacity + padding - 1) / padding * padding + padding),
+      data(COORDINATES_NUM * stride, 0.f) {}
+
+void NmsSelectedBoxes::push_back(const NmsBox& box) {
+    assert(count + padding < stride);
+    data[YMIN * stride + count] = box.ymin;
+    data[XMIN * stride + count] = box.xmin;
+    data[YMAX * stride + count] = box.ymax;
+    data[XMAX * stride + count] = box.xmax;
+    data[AREA * stride + count] = box.area;
+    count++;
+}
+
+NmsKernel::NmsKernel(float norm, bool inclusiveScoreThreshold)
+        : norm(norm), inclusiveScoreThreshold(inclusiveScoreThreshold) {
+    jit_nms_config_params jcp = { norm, inclusiveScoreThreshold, false };
+    jit_nms_config_params suppressionJcp = { norm, inclusiveScoreThreshold, true };
+
+    if (mayiuse(x64::avx512_common)) {
+        filterKernel.reset(new jit_uni_nms_filter_kernel_f32<x64::avx512_common>(jcp));
+        iouKernel.reset(new jit_uni_nms_iou_kernel_f32<x64::avx512_common>(jcp));
+        suppressionKernel.reset(new jit_uni_nms_iou_kernel_f32<x64::avx512_common>(suppressionJcp));
+    } else if (mayiuse(x64::avx2)) {
+        filterKernel.reset(new jit_uni_nms_filter_kernel_f32<x64::avx2>(jcp));
+        iouKernel.reset(new jit_uni_nms_iou_kernel_f32<x64::avx2>(jcp));
+        suppressionKernel.reset(new jit_uni_nms_iou_kernel_f32<x64::avx2>(suppressionJcp));
+    } else if (mayiuse(x64::sse41)) {
+        filterKernel.reset(new jit_uni_nms_filter_kernel_f32<x64::sse41>(jcp));
+        iouKernel.reset(new jit_uni_nms_iou_kernel_f32<x64::sse41>(jcp));
+        suppressionKernel.reset(new jit_uni_nms_iou_kernel_f32<x64::sse41>(suppressionJcp));
+    }
+
+    if (filterKernel)
+        filterKernel->create_ker();
+    if (iouKernel)
+        iouKernel->create_ker();
+    if (suppressionKernel)
+        suppressionKernel->create_ker();
+}
+
+size_t NmsKernel::filterScores(const float* scores, size_t count, float threshold,
+                               float* dstScores, int* dstIndices) const {
+    size_t filtered = 0;
+    if (filterKernel) {
+        auto args = jit_args_nms_filter();
+        args.scores = scores;
+        args.count = count;
+        args.threshold = threshold;
+        args.dst_scores = dstScores;
+        args.dst_indices = dstIndices;
+        args.filtered = &filtered;
+        (*filterKernel)(&args);
+        return filtered;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (inclusiveScoreThreshold ? scores[i] >= threshold : scores[i] > threshold) {
+            dstScores[filtered] = scores[i];
+            dstIndices[filtered] = static_cast<int>(i);
+            filtered++;
+        }
+    }
+    return filtered;
+}
+
+bool NmsKernel::isSuppressed(const NmsBox& box, const NmsSelectedBoxes& selected, float iouThreshold) const {
+    if (selected.size() == 0)
+        return false;
+    // IoU with the box of not positive area is zero
+    if (box.area <= 0.f)
+        return iouThreshold <= 0.f;
+
+    // the padding boxes have zero IoU which passes not positive threshold, such threshold is handled by the scalar code
+    if (suppressionKernel && iouThreshold > 0.f) {
+        int suppressed = 0;
+        auto args = jit_args_nms_iou();
+        args.box = &box.ymin;
+        args.ymin = selected.get(NmsSelectedBoxes::YMIN);
+        args.xmin = selected.get(NmsSelectedBoxes::XMIN);
+        args.ymax = selected.get(NmsSelectedBoxes::YMAX);
+        args.xmax = selected.get(NmsSelectedBoxes::XMAX);
+        args.area = selected.get(NmsSelectedBoxes::AREA);
+        args.count = selected.size();
+        args.norm = norm;
+        args.iou_threshold = iouThreshold;
+        args.suppressed = &suppressed;
+        (*suppressionKernel)(&args);
+        return suppressed != 0;
+    }
+
+    for (size_t i = 0; i < selected.size(); i++) {
+        const NmsBox boxJ = { selected.get(NmsSelectedBoxes::YMIN)[i], selected.get(NmsSelectedBoxes::XMIN)[i],
+                              selected.get(NmsSelectedBoxes::YMAX)[i], selected.get(NmsSelectedBoxes::XMAX)[i],
+                              selected.get(NmsSelectedBoxes::AREA)[i] };
+        if (intersectionOverUnion(box, boxJ) >= iouThreshold)
+            return true;
+    }
+    return false;
+}
+
+void NmsKernel::intersectionOverUnion(const NmsBox& box, const NmsSelectedBoxes& selected,
+                                      size_t begin, float* dst) const {
+    if (begin >= selected.size())
+        return;
+
+    if (iouKernel) {
+        auto args = jit_args_nms_iou();
+        args.box = &box.ymin;
+        args.ymin = selected.get(NmsSelectedBoxes::YMIN) + begin;
+        args.xmin = selected.get(NmsSelectedBoxes::XMIN) + begin;
+        args.ymax = selected.get(NmsSelectedBoxes::YMAX) + begin;
+        args.xmax = selected.get(NmsSelectedBoxes::XMAX) + begin;
+        args.area = selected.get(NmsSelectedBoxes::AREA) + begin;
+        args.count = selected.size() - begin;
+        args.norm = norm;
+        args.iou = dst;
+        (*iouKernel)(&args);
+        if (box.area <= 0.f)
+            std::fill(dst, dst + selected.size() - begin, 0.f);
+        return;
+    }
+
+    for (size_t i = begin; i < selected.size(); i++) {
+        const NmsBox boxJ = { selected.get(NmsSelectedBoxes::YMIN)[i], selected.get(NmsSelectedBoxes::XMIN)[i],
+                              selected.get(NmsSelectedBoxes::YMAX)[i], selected.get(NmsSelectedBoxes::XMAX)[i],
+                              selected.get(NmsSelectedBoxes::AREA)[i] };
+        dst[i - begin] = intersectionOverUnion(box, boxJ);
+    }
+}
+
+float NmsKernel::intersectionOverUnion(const NmsBox& boxI, const NmsBox& boxJ) const {
+    if (boxI.area <= 0.f || boxJ.area <= 0.f)
+        return 0.f;
+
+    float height = (std::min)(boxI.ymax, boxJ.ymax) - (std::max)(boxI.ymin, boxJ.ymin);
+    float width = (std::min)(boxI.xmax, boxJ.xmax) - (std::max)(boxI.xmin, boxJ.xmin);
+    if (norm != 0.f) {
+        height += norm;
+        width += norm;
+    }
+    const float intersection_area = (std::max)(height, 0.f) * (std::max)(width, 0.f);
+    return intersection_area / (boxI.area + boxJ.area - intersection_area);
+}
@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+struct jit_uni_nms_filter_kernel;
+struct jit_uni_nms_iou_kernel;
+
+/**
+ * Box in the corner form with precomputed area
+ */
+struct NmsBox {
+    float ymin;
+    float xmin;
+    float ymax;
+    float xmax;
+    float area;
+};
+
+/**
+ * Boxes selected for one (batch, class) pair stored as structure of arrays, so IoU of a candidate box
+ * against the selected ones is computed for the whole vector at once.
+ * The arrays are padded to whole vectors of the widest ISA, the padding boxes have zero area.
+ */
+class NmsSelectedBoxes {
+public:
+    static constexpr size_t padding = 16;
+
+    explicit NmsSelectedBoxes(size_t capacity);
+
+    void push_back(const NmsBox& box);
+    size_t size() const { return count; }
+
+private:
+    friend class NmsKernel;
+
+    enum Coordinate { YMIN, XMIN, YMAX, XMAX, AREA, COORDINATES_NUM };
+    const float* get(Coordinate coordinate) const { return data.data() + coordinate * stride; }
+
+    size_t stride;
+    size_t count = 0;
+    std::vector<float> data;
+};
+
+/**
+ * Score threshold filtering and IoU computation shared by NonMaxSuppression and MulticlassNms nodes.
+ * The JIT kernels are used for sse41/avx2/avx512 and the results are bitwise equal to the scalar code,
+ * which is used on the rest of platforms.
+ */
+class NmsKernel {
+public:
+    /**
+     * @param norm value added to the sides of boxes, NMS uses 0 and MulticlassNms uses 1 for not normalized boxes
+     * @param inclusiveScoreThreshold true if the scores equal to the threshold pass filtering
+     */
+    NmsKernel(float norm, bool inclusiveScoreThreshold);
+
+    /**
+     * Compacts the scores passing the threshold and their indices keeping the order
+     * @return number of the passed scores
+     */
+    size_t filterScores(const float* scores, size_t count, float threshold, float* dstScores, int* dstIndices) const;
+
+    /**
+     * @return true if IoU of the box with any of the selected boxes is not less than the threshold
+     */
+    bool isSuppressed(const NmsBox& box, const NmsSelectedBoxes& selected, float iouThreshold) const;
+
+    /**
+     * Computes IoU of the box with the selected boxes starting from begin.
+     * dst must have space for (selected.size() - begin + NmsSelectedBoxes::padding) values.
+     */
+    void intersectionOverUnion(const NmsBox& box, const NmsSelectedBoxes& selected, size_t begin, float* dst) const;
+
+    float intersectionOverUnion(const NmsBox& boxI, const NmsBox& boxJ) const;
+
+private:
+    float norm;
+    bool inclusiveScoreThreshold;
+
+    std::shared_ptr<jit_uni_nms_filter_kernel> filterKernel;
+    std::shared_ptr<jit_uni_nms_iou_kernel> iouKernel;
+    std::shared_ptr<jit_uni_nms_iou_kernel> suppressionKernel;
+};
+
+}  // namespace MKLDNNPlugin
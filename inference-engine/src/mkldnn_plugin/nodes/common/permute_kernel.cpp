@@ -139,7 +139,61 @@ private:
 };
 
 PermuteKernel::PermuteKernel(const PermuteParams& params) : params(params) {
-    prepareParams();
+    prepareTiledKernel();
+    if (!reorder_kernel)
+        prepareParams();
+}
+
+/*
+ * The permutation is the reorder between two layouts of the destination tensor: the destination layout itself and
+ * the source layout whose dims are renamed to the destination ones. The reorder kernel collapses the dims which are
+ * contiguous in the both layouts and transposes the tiles on the vector registers, so it is used whenever the dims
+ * allow that. The batch must stay the outermost dim of the both layouts for the dynamic batch.
+ */
+void PermuteKernel::prepareTiledKernel() {
+    if (params.order.empty() || params.order[0] != 0 || (params.data_size != 1 && params.data_size != 4))
+        return;
+
+    const size_t ndims = params.order.size();
+    SizeVector inverse_order(ndims);
+    for (size_t i = 0; i < ndims; i++) {
+        if (params.order[i] >= ndims)
+            return;
+        inverse_order[params.order[i]] = i;
+    }
+
+    auto getStrides = [](const SizeVector& block_dims) {
+        SizeVector strides(block_dims.size(), 1);
+        for (size_t i = block_dims.size(); i-- > 1;)
+            strides[i - 1] = strides[i] * block_dims[i];
+        return strides;
+    };
+
+    ReorderParams reorder_params;
+    reorder_params.dims = SizeVector(ndims, 1);
+    for (size_t i = 0; i < params.dst_block_dims.size(); i++) {
+        if (params.dst_block_order[i] >= ndims)
+            return;
+        reorder_params.dims[params.dst_block_order[i]] *= params.dst_block_dims[i];
+    }
+    for (const auto dim : params.src_block_order) {
+        if (dim >= ndims)
+            return;
+        reorder_params.src_block_order.push_back(inverse_order[dim]);
+    }
+    reorder_params.src_block_dims = params.src_block_dims;
+    reorder_params.src_strides = getStrides(params.src_block_dims);
+    reorder_params.dst_block_dims = params.dst_block_dims;
+    reorder_params.dst_block_order = params.dst_block_order;
+    reorder_params.dst_strides = getStrides(params.dst_block_dims);
+    // the data is moved bitwise, the integer precisions avoid any conversion in the kernel
+    reorder_params.src_prc = reorder_params.dst_prc = params.data_size == 4 ? Precision::I32 : Precision::U8;
+
+    std::shared_ptr<ReorderKernel> kernel = std::make_shared<ReorderKernel>(reorder_params);
+    if (kernel->isSupported()) {
+        reorder_kernel = kernel;
+        batch = reorder_params.dims[0];
+    }
 }
 
 void PermuteKernel::prepareParams() {
@@ -267,6 +321,11 @@ void PermuteKernel::prepareParams() {
 }
 
 void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data, const int mb) {
+    if (reorder_kernel) {
+        reorder_kernel->execute(src_data, dst_data, mb);
+        return;
+    }
+
     if (permute_kernel) {
         optimizedExecute(src_data, dst_data, mb);
         return;
@@ -276,6 +335,11 @@ void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data, const in
 }
 
 void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data) {
+    if (reorder_kernel) {
+        reorder_kernel->execute(src_data, dst_data, batch);
+        return;
+    }
+
     SizeVector dst_dims = jcp.dst_block_dims;
     if (permute_kernel) {
         optimizedExecute(src_data, dst_data, dst_dims[0]);
@@ -7,6 +7,7 @@
 #include <ie_common.h>
 #include <mkldnn_node.h>
 #include <memory>
+#include "reorder_kernel.h"
 
 namespace MKLDNNPlugin {
 
@@ -58,14 +59,22 @@ public:
     void execute(const uint8_t* src_data, uint8_t* dst_data);
     void execute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
 
+    // the permutation is done by the tiled kernel transposing on the vector registers
+    bool isTiled() const {
+        return reorder_kernel != nullptr;
+    }
+
 private:
     void prepareParams();
+    void prepareTiledKernel();
 
     void optimizedExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
     void referenceExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
 
     jit_permute_config_params jcp = {};
     std::shared_ptr<jit_uni_permute_kernel> permute_kernel;
+    std::shared_ptr<ReorderKernel> reorder_kernel;
+    size_t batch = 0;
     PermuteParams params;
 };
 
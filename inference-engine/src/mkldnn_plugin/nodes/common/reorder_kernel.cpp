@@ -0,0 +1,459 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "reorder_kernel.h"
+
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <mkldnn_types.h>
+#include <ie_parallel.hpp>
+#include "utils/general_utils.h"
+#include "emitters/jit_load_store_emitters.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_args_reorder, field)
+
+namespace {
+// the number of the inner elements processed by one kernel call in the copy mode
+constexpr size_t copy_chunk = 2048;
+}  // namespace
+
+template <cpu_isa_t isa>
+struct jit_uni_reorder_kernel_f32 : public jit_uni_reorder_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_reorder_kernel_f32)
+
+    explicit jit_uni_reorder_kernel_f32(jit_reorder_config_params jcp_) : jit_uni_reorder_kernel(jcp_), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+
+        if (jcp.transpose) {
+            transpose_loop();
+        } else {
+            mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+            copy_loop();
+        }
+
+        this->postamble();
+
+        load_emitter->emit_data();
+        store_emitter->emit_data();
+    }
+
+private:
+    const int step = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    void load(int vmm_idx, const Xbyak::Reg64 &reg, int offset, int load_num) {
+        load_emitter->emit_code({static_cast<size_t>(reg.getIdx())}, {static_cast<size_t>(vmm_idx)},
+                                std::make_shared<load_emitter_context>(jcp.src_prc, jcp.exec_prc, load_num, offset),
+                                {}, load_pool_gpr_idxs);
+    }
+
+    void store(int vmm_idx, int vmm_aux_idx, const Xbyak::Reg64 &reg, int offset, int store_num) {
+        store_emitter->emit_code({static_cast<size_t>(vmm_idx)}, {static_cast<size_t>(reg.getIdx())},
+                                 std::make_shared<store_emitter_context>(jcp.exec_prc, jcp.dst_prc, store_num, offset),
+                                 {static_cast<size_t>(vmm_aux_idx)}, store_pool_gpr_idxs);
+    }
+
+    void copy_element(int src_offset, int dst_offset) {
+        load(0, aux_reg_src, src_offset, 1);
+        store(0, 1, aux_reg_dst, dst_offset, 1);
+    }
+
+    void copy_loop() {
+        const int src_size = jcp.src_prc.size();
+        const int dst_size = jcp.dst_prc.size();
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label exit_label;
+
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, step);
+            jl(tail_loop_label, T_NEAR);
+
+            load(0, reg_src, 0, step);
+            store(0, 1, reg_dst, 0, step);
+
+            add(reg_src, step * src_size);
+            add(reg_dst, step * dst_size);
+            sub(reg_work_amount, step);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(tail_loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            je(exit_label, T_NEAR);
+
+            load(0, reg_src, 0, 1);
+            store(0, 1, reg_dst, 0, 1);
+
+            add(reg_src, src_size);
+            add(reg_dst, dst_size);
+            sub(reg_work_amount, 1);
+
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+    }
+
+    // rows 0..3 of the tile are in xmm0..xmm3, the columns are stored to xmm0..xmm3, xmm4..xmm7 are clobbered
+    void transpose_4x4() {
+        auto r = [](int i) { return Xbyak::Xmm(i); };
+        auto t = [](int i) { return Xbyak::Xmm(4 + i); };
+        movaps(t(0), r(0)); unpcklps(t(0), r(1));
+        movaps(t(1), r(0)); unpckhps(t(1), r(1));
+        movaps(t(2), r(2)); unpcklps(t(2), r(3));
+        movaps(t(3), r(2)); unpckhps(t(3), r(3));
+        movaps(r(0), t(0)); movlhps(r(0), t(2));
+        movaps(r(1), t(2)); movhlps(r(1), t(0));
+        movaps(r(2), t(1)); movlhps(r(2), t(3));
+        movaps(r(3), t(3)); movhlps(r(3), t(1));
+    }
+
+    // rows 0..7 of the tile are in ymm0..ymm7, the columns are stored to ymm8..ymm15, ymm0..ymm7 are clobbered
+    void transpose_8x8() {
+        auto r = [](int i) { return Xbyak::Ymm(i); };
+        auto t = [](int i) { return Xbyak::Ymm(8 + i); };
+        for (int i = 0; i < 8; i += 2) {
+            vunpcklps(t(i), r(i), r(i + 1));
+            vunpckhps(t(i + 1), r(i), r(i + 1));
+        }
+        for (int i = 0; i < 8; i += 4) {
+            vshufps(r(i), t(i), t(i + 2), 0x44);
+            vshufps(r(i + 1), t(i), t(i + 2), 0xEE);
+            vshufps(r(i + 2), t(i + 1), t(i + 3), 0x44);
+            vshufps(r(i + 3), t(i + 1), t(i + 3), 0xEE);
+        }
+        for (int i = 0; i < 4; i++) {
+            vperm2f128(t(i), r(i), r(i + 4), 0x20);
+            vperm2f128(t(i + 4), r(i), r(i + 4), 0x31);
+        }
+    }
+
+    /*
+     * The region is tile_work x inner_work, the tile dim is contiguous in the source and the inner dim is contiguous
+     * in the destination. Full step x step tiles are loaded along the tile dim, transposed and stored along the inner dim,
+     * the tails are copied element by element.
+     */
+    void transpose_loop() {
+        const int src_size = jcp.src_prc.size();
+        const int dst_size = jcp.dst_prc.size();
+        const int src_inner_step = static_cast<int>(jcp.inner_src_stride) * src_size;
+        const int dst_tile_step = static_cast<int>(jcp.tile_dst_stride) * dst_size;
+        const size_t tile_blocks = jcp.tile_work / step;
+        const size_t tile_tail = jcp.tile_work % step;
+        const size_t inner_blocks = jcp.inner_work / step;
+        const size_t inner_tail = jcp.inner_work % step;
+        const int out_base = isa == cpu::x64::sse41 ? 0 : step;
+        const int aux_idx = isa == cpu::x64::sse41 ? step : 0;
+
+        if (tile_blocks > 0) {
+            Xbyak::Label tile_loop_label;
+            Xbyak::Label inner_loop_label;
+
+            mov(reg_tile_work, tile_blocks);
+            L(tile_loop_label);
+            {
+                mov(aux_reg_src, reg_src);
+                mov(aux_reg_dst, reg_dst);
+
+                if (inner_blocks > 0) {
+                    mov(reg_work_amount, inner_blocks);
+                    L(inner_loop_label);
+                    {
+                        for (int i = 0; i < step; i++)
+                            load(i, aux_reg_src, i * src_inner_step, step);
+
+                        if (isa == cpu::x64::sse41)
+                            transpose_4x4();
+                        else
+                            transpose_8x8();
+
+                        for (int i = 0; i < step; i++)
+                            store(out_base + i, aux_idx, aux_reg_dst, i * dst_tile_step, step);
+
+                        add(aux_reg_src, step * src_inner_step);
+                        add(aux_reg_dst, step * dst_size);
+                        dec(reg_work_amount);
+                        jnz(inner_loop_label, T_NEAR);
+                    }
+                }
+
+                for (int j = 0; j < static_cast<int>(inner_tail); j++) {
+                    for (int i = 0; i < step; i++)
+                        copy_element(j * src_inner_step + i * src_size, i * dst_tile_step + j * dst_size);
+                }
+
+                add(reg_src, step * src_size);
+                add(reg_dst, step * dst_tile_step);
+                dec(reg_tile_work);
+                jnz(tile_loop_label, T_NEAR);
+            }
+        }
+
+        for (int i = 0; i < static_cast<int>(tile_tail); i++) {
+            Xbyak::Label tail_loop_label;
+
+            mov(aux_reg_src, reg_src);
+            mov(aux_reg_dst, reg_dst);
+            mov(reg_work_amount, jcp.inner_work);
+            L(tail_loop_label);
+            {
+                copy_element(i * src_size, i * dst_tile_step);
+
+                add(aux_reg_src, src_inner_step);
+                add(aux_reg_dst, dst_size);
+                dec(reg_work_amount);
+                jnz(tail_loop_label, T_NEAR);
+            }
+        }
+    }
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 aux_reg_src = r11;
+    Xbyak::Reg64 aux_reg_dst = r12;
+    Xbyak::Reg64 reg_tile_work = r13;
+    Xbyak::Reg64 reg_load_store_mask = r14;
+    Xbyak::Reg64 reg_load_table = r15;
+
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+    std::vector<size_t> store_pool_gpr_idxs;
+};
+
+ReorderKernel::ReorderKernel(const ReorderParams& params) {
+    if (!prepareParams(params))
+        return;
+
+    if (mayiuse(cpu::x64::avx2)) {
+        reorder_kernel.reset(new jit_uni_reorder_kernel_f32<cpu::x64::avx2>(jcp));
+        impl_type = impl_desc_type::jit_avx2;
+    } else if (mayiuse(cpu::x64::sse41)) {
+        reorder_kernel.reset(new jit_uni_reorder_kernel_f32<cpu::x64::sse41>(jcp));
+        impl_type = impl_desc_type::jit_sse42;
+    }
+
+    if (reorder_kernel)
+        reorder_kernel->create_ker();
+}
+
+bool ReorderKernel::prepareParams(const ReorderParams& params) {
+    // bf16 store needs avx512 and the kernels work on ymm at most, so bf16 is left to oneDNN
+    auto isSupportedPrecision = [](Precision prc) {
+        return one_of(prc, Precision::FP32, Precision::I32, Precision::I8, Precision::U8);
+    };
+    if (!isSupportedPrecision(params.src_prc) || !isSupportedPrecision(params.dst_prc))
+        return false;
+
+    const size_t ndims = params.dims.size();
+    if (ndims == 0)
+        return false;
+
+    /*
+     * Every dim of the layout is split into one or several blocked dims, the offset of the element is linear in the
+     * indexes of the blocked dims. The unit of the blocked dim is its step in the elements of the logical dim.
+     */
+    struct BlockedDim {
+        size_t dim;
+        size_t work;
+        size_t stride;
+        size_t unit;
+    };
+    auto getBlockedDims = [&](const SizeVector& block_dims, const SizeVector& order, const SizeVector& strides,
+                              std::vector<BlockedDim>& blocked) {
+        if (block_dims.size() != order.size() || block_dims.size() != strides.size())
+            return false;
+        SizeVector dims(ndims, 1);
+        for (size_t i = block_dims.size(); i-- > 0;) {
+            if (order[i] >= ndims)
+                return false;
+            blocked.push_back({order[i], block_dims[i], strides[i], dims[order[i]]});
+            dims[order[i]] *= block_dims[i];
+        }
+        // padded layouts aren't supported
+        return dims == params.dims;
+    };
+    std::vector<BlockedDim> src_blocked, dst_blocked;
+    if (!getBlockedDims(params.src_block_dims, params.src_block_order, params.src_strides, src_blocked) ||
+        !getBlockedDims(params.dst_block_dims, params.dst_block_order, params.dst_strides, dst_blocked))
+        return false;
+
+    auto findStride = [](const std::vector<BlockedDim>& blocked, size_t dim, size_t unit, size_t& stride) {
+        for (const auto& bd : blocked) {
+            if (bd.dim == dim && bd.unit <= unit && unit < bd.unit * bd.work && unit % bd.unit == 0) {
+                stride = bd.stride * (unit / bd.unit);
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // the common sub-dims of the both layouts: the units of the sub-dims are the units of the blocked dims of the both layouts
+    struct SubDim {
+        size_t work;
+        size_t src_stride;
+        size_t dst_stride;
+    };
+    std::vector<SubDim> sub_dims;
+    for (size_t dim = 0; dim < ndims; dim++) {
+        std::set<size_t, std::greater<size_t>> units = {params.dims[dim]};
+        for (const auto& bd : src_blocked)
+            if (bd.dim == dim) units.insert(bd.unit);
+        for (const auto& bd : dst_blocked)
+            if (bd.dim == dim) units.insert(bd.unit);
+
+        size_t dim_sub_dims = 0;
+        for (auto it = units.begin(); std::next(it) != units.end(); ++it) {
+            const size_t unit = *std::next(it);
+            if (*it % unit != 0)
+                return false;
+            SubDim sub_dim = {*it / unit, 0, 0};
+            if (!findStride(src_blocked, dim, unit, sub_dim.src_stride) || !findStride(dst_blocked, dim, unit, sub_dim.dst_stride))
+                return false;
+            if (dim == 0) {
+                batch_src_stride = sub_dim.src_stride;
+                batch_dst_stride = sub_dim.dst_stride;
+            } else if (sub_dim.work > 1) {
+                sub_dims.push_back(sub_dim);
+            }
+            dim_sub_dims++;
+        }
+        // the batch is processed by the outermost loop to support dynamic batch
+        if (dim == 0 && dim_sub_dims > 1)
+            return false;
+    }
+
+    std::sort(sub_dims.begin(), sub_dims.end(), [](const SubDim& lhs, const SubDim& rhs) {
+        return lhs.dst_stride > rhs.dst_stride;
+    });
+    std::vector<SubDim> collapsed;
+    for (const auto& sub_dim : sub_dims) {
+        if (!collapsed.empty() &&
+            collapsed.back().src_stride == sub_dim.src_stride * sub_dim.work &&
+            collapsed.back().dst_stride == sub_dim.dst_stride * sub_dim.work) {
+            collapsed.back().work *= sub_dim.work;
+            collapsed.back().src_stride = sub_dim.src_stride;
+            collapsed.back().dst_stride = sub_dim.dst_stride;
+        } else {
+            collapsed.push_back(sub_dim);
+        }
+    }
+    if (collapsed.empty() || collapsed.back().dst_stride != 1)
+        return false;
+
+    const size_t step = (mayiuse(cpu::x64::avx2) ? cpu_isa_traits<cpu::x64::avx2>::vlen : cpu_isa_traits<cpu::x64::sse41>::vlen) / sizeof(float);
+    const auto inner = collapsed.back();
+    collapsed.pop_back();
+
+    jcp.src_prc = params.src_prc;
+    jcp.dst_prc = params.dst_prc;
+    // integer data is copied without the conversion to float to keep the exact values
+    const bool is_integer = params.src_prc != Precision::FP32 && params.dst_prc != Precision::FP32;
+    jcp.exec_prc = is_integer ? Precision::I32 : Precision::FP32;
+    jcp.inner_work = inner.work;
+    jcp.inner_src_stride = inner.src_stride;
+    jcp.transpose = inner.src_stride != 1;
+    jcp.tile_work = 1;
+    jcp.tile_dst_stride = 0;
+    if (inner.work < step)
+        return false;
+
+    if (jcp.transpose) {
+        auto tile = std::find_if(collapsed.begin(), collapsed.end(), [](const SubDim& sub_dim) {
+            return sub_dim.src_stride == 1;
+        });
+        if (tile == collapsed.end() || tile->work < step)
+            return false;
+        jcp.tile_work = tile->work;
+        jcp.tile_dst_stride = tile->dst_stride;
+        collapsed.erase(tile);
+
+        // the offsets inside the tile are encoded as immediates
+        const size_t max_offset = step * std::max(jcp.inner_src_stride * params.src_prc.size(), jcp.tile_dst_stride * params.dst_prc.size());
+        if (max_offset > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+            return false;
+    }
+
+    for (const auto& sub_dim : collapsed) {
+        outer_dims.push_back(sub_dim.work);
+        outer_src_strides.push_back(sub_dim.src_stride);
+        outer_dst_strides.push_back(sub_dim.dst_stride);
+    }
+    return true;
+}
+
+void ReorderKernel::execute(const uint8_t* src_data, uint8_t* dst_data, const size_t mb) {
+    const size_t src_size = jcp.src_prc.size();
+    const size_t dst_size = jcp.dst_prc.size();
+    const size_t chunk = jcp.transpose ? jcp.inner_work : copy_chunk;
+    const size_t inner_chunks = MKLDNNPlugin::div_up(jcp.inner_work, chunk);
+    const size_t outer_work = std::accumulate(outer_dims.begin(), outer_dims.end(), size_t(1), std::multiplies<size_t>());
+    const size_t work_amount = mb * outer_work * inner_chunks;
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(work_amount, nthr, ithr, start, end);
+
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            size_t idx = iwork;
+            const size_t inner_chunk = idx % inner_chunks;
+            idx /= inner_chunks;
+
+            size_t src_off = inner_chunk * chunk * jcp.inner_src_stride;
+            size_t dst_off = inner_chunk * chunk;
+            for (size_t i = outer_dims.size(); i-- > 0;) {
+                const size_t outer_idx = idx % outer_dims[i];
+                idx /= outer_dims[i];
+                src_off += outer_idx * outer_src_strides[i];
+                dst_off += outer_idx * outer_dst_strides[i];
+            }
+            src_off += idx * batch_src_stride;
+            dst_off += idx * batch_dst_stride;
+
+            auto arg = jit_args_reorder();
+            arg.src = src_data + src_off * src_size;
+            arg.dst = dst_data + dst_off * dst_size;
+            arg.work_amount = std::min(chunk, jcp.inner_work - inner_chunk * chunk);
+
+            (*reorder_kernel)(&arg);
+        }
+    });
+}
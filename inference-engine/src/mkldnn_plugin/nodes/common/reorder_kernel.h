@@ -0,0 +1,101 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <ie_precision.hpp>
+#include <mkldnn_node.h>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Layouts of the reorder are given by the blocked descriptors: the logical dims and the block dims, order and strides
+ * of the source and the destination in elements.
+ */
+struct ReorderParams {
+    InferenceEngine::SizeVector dims;
+    InferenceEngine::SizeVector src_block_dims;
+    InferenceEngine::SizeVector src_block_order;
+    InferenceEngine::SizeVector src_strides;
+    InferenceEngine::SizeVector dst_block_dims;
+    InferenceEngine::SizeVector dst_block_order;
+    InferenceEngine::SizeVector dst_strides;
+    InferenceEngine::Precision src_prc;
+    InferenceEngine::Precision dst_prc;
+};
+
+/*
+ * The kernel processes one region of the reorder: the dim contiguous in the destination (inner) and, in the transpose
+ * mode, the dim contiguous in the source (tile). Tiles of the both dims are transposed on the vector registers.
+ */
+struct jit_reorder_config_params {
+    InferenceEngine::Precision src_prc;
+    InferenceEngine::Precision dst_prc;
+    InferenceEngine::Precision exec_prc;
+    bool transpose;
+    size_t inner_work;
+    size_t inner_src_stride;
+    size_t tile_work;
+    size_t tile_dst_stride;
+};
+
+struct jit_args_reorder {
+    const void* src;
+    void* dst;
+    size_t work_amount;  // the number of the inner elements in the copy mode
+};
+
+struct jit_uni_reorder_kernel {
+    void (*ker_)(const jit_args_reorder *);
+
+    void operator()(const jit_args_reorder *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_reorder_kernel(jit_reorder_config_params jcp_) : ker_(nullptr), jcp(jcp_) {}
+    virtual ~jit_uni_reorder_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_reorder_config_params jcp;
+};
+
+/*
+ * Generic reorder between the dense blocked layouts fusing the layout permutation and the precision conversion in one pass.
+ * The dims of the both layouts are split into the common sub-dims, so every element offset is linear in the sub-dims
+ * indexes. The batch dim is kept outermost to support dynamic batch.
+ */
+class ReorderKernel {
+public:
+    explicit ReorderKernel(const ReorderParams& params);
+
+    // the kernel isn't created if the layouts or precisions aren't supported, oneDNN reorder is used in that case
+    bool isSupported() const {
+        return reorder_kernel != nullptr;
+    }
+
+    impl_desc_type getImplType() const {
+        return impl_type;
+    }
+
+    void execute(const uint8_t* src_data, uint8_t* dst_data, const size_t mb);
+
+private:
+    bool prepareParams(const ReorderParams& params);
+
+    jit_reorder_config_params jcp = {};
+    std::shared_ptr<jit_uni_reorder_kernel> reorder_kernel;
+    impl_desc_type impl_type = impl_desc_type::undef;
+
+    InferenceEngine::SizeVector outer_dims;
+    InferenceEngine::SizeVector outer_src_strides;
+    InferenceEngine::SizeVector outer_dst_strides;
+    size_t batch_src_stride = 0;
+    size_t batch_dst_stride = 0;
+};
+
+}  // namespace MKLDNNPlugin
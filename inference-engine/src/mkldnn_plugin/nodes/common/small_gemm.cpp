@@ -0,0 +1,296 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "small_gemm.h"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <mkldnn_types.h>
+#include <ie_parallel.hpp>
+#include "mkldnn/ie_mkldnn.h"
+#include "utils/general_utils.h"
+
+#include "cpu/x64/jit_generator.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_args_small_gemm, field)
+
+namespace {
+// the output blocks are unrolled in the kernel code, so the problem dims are limited to keep the code small
+constexpr size_t max_gemm_dim = 256;
+// the register block of the rows is limited by the number of the accumulators and the broadcasts latency hiding
+constexpr size_t max_rows_block = 8;
+}  // namespace
+
+template <cpu_isa_t isa>
+struct jit_uni_small_gemm_kernel_f32 : public jit_uni_small_gemm_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_small_gemm_kernel_f32)
+
+    explicit jit_uni_small_gemm_kernel_f32(jit_small_gemm_config_params jcp_) : jit_uni_small_gemm_kernel(jcp_), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_a, ptr[reg_params + GET_OFF(a)]);
+        mov(reg_b, ptr[reg_params + GET_OFF(b)]);
+        mov(reg_c, ptr[reg_params + GET_OFF(c)]);
+
+        const size_t tail = jcp.N % step;
+        if (tail != 0) {
+            if (isa == avx512_common) {
+                mov(reg_tmp.cvt32(), (1 << tail) - 1);
+                kmovw(k_tail_mask, reg_tmp.cvt32());
+            } else {
+                mov(reg_tmp, l_tail_mask);
+                uni_vmovups(vmm_tail_mask, ptr[reg_tmp]);
+            }
+        }
+
+        const size_t cols_block = n_block * step;
+        for (size_t n0 = 0; n0 < jcp.N; n0 += cols_block) {
+            const size_t cols = std::min(cols_block, jcp.N - n0);
+            const int vecs = static_cast<int>(MKLDNNPlugin::div_up(cols, step));
+            const bool has_tail = cols % step != 0;
+            // the rest of the registers are the vectors of B, the broadcast of A and the tail mask
+            const size_t rows_block = std::min(max_rows_block, static_cast<size_t>((vmm_count - vecs - 2) / vecs));
+            for (size_t m0 = 0; m0 < jcp.M; m0 += rows_block)
+                compute_block(m0, static_cast<int>(std::min(rows_block, jcp.M - m0)), n0, vecs, has_tail);
+        }
+
+        this->postamble();
+
+        if (tail != 0 && isa != avx512_common) {
+            align(64);
+            L(l_tail_mask);
+            for (size_t i = 0; i < step; i++)
+                dd(i < tail ? 0xFFFFFFFF : 0);
+        }
+    }
+
+private:
+    using Vmm = typename conditional<isa == avx512_common, Xbyak::Zmm, Xbyak::Ymm>::type;
+    static constexpr size_t step = cpu_isa_traits<isa>::vlen / sizeof(float);
+    static constexpr int vmm_count = isa == avx512_common ? 32 : 16;
+    // the widest block of the columns keeping at least 6 rows in the registers
+    static constexpr size_t n_block = isa == avx512_common ? 4 : 2;
+
+    Vmm vmm_acc(int rows, int vecs, int m, int v) const { return Vmm(m * vecs + v); }
+    Vmm vmm_b(int rows, int vecs, int v) const { return Vmm(rows * vecs + v); }
+    Vmm vmm_bcast(int rows, int vecs) const { return Vmm(rows * vecs + vecs); }
+
+    void load_b(const Vmm& vmm, const Xbyak::Address& addr, bool tail) {
+        if (!tail)
+            uni_vmovups(vmm, addr);
+        else if (isa == avx512_common)
+            vmovups(vmm | k_tail_mask | T_z, addr);
+        else
+            vmaskmovps(vmm, vmm_tail_mask, addr);
+    }
+
+    void store_c(const Xbyak::Address& addr, const Vmm& vmm, bool tail) {
+        if (!tail)
+            uni_vmovups(addr, vmm);
+        else if (isa == avx512_common)
+            vmovups(addr, vmm | k_tail_mask);
+        else
+            vmaskmovps(addr, vmm_tail_mask, vmm);
+    }
+
+    // C[m0 : m0 + rows, n0 : n0 + vecs * step] = A[m0 : m0 + rows, :] * B[:, n0 : n0 + vecs * step]
+    void compute_block(size_t m0, int rows, size_t n0, int vecs, bool has_tail) {
+        const int f32 = sizeof(float);
+        for (int m = 0; m < rows; m++)
+            for (int v = 0; v < vecs; v++)
+                uni_vpxor(vmm_acc(rows, vecs, m, v), vmm_acc(rows, vecs, m, v), vmm_acc(rows, vecs, m, v));
+
+        mov(aux_reg_a, reg_a);
+        if (m0 != 0)
+            add(aux_reg_a, static_cast<int>(m0 * jcp.lda_m * f32));
+        mov(aux_reg_b, reg_b);
+        if (n0 != 0)
+            add(aux_reg_b, static_cast<int>(n0 * f32));
+
+        Xbyak::Label k_loop_label;
+        mov(reg_k, jcp.K);
+        L(k_loop_label);
+        {
+            for (int v = 0; v < vecs; v++)
+                load_b(vmm_b(rows, vecs, v), ptr[aux_reg_b + v * step * f32], has_tail && v == vecs - 1);
+
+            for (int m = 0; m < rows; m++) {
+                vbroadcastss(vmm_bcast(rows, vecs), ptr[aux_reg_a + static_cast<int>(m * jcp.lda_m * f32)]);
+                for (int v = 0; v < vecs; v++)
+                    vfmadd231ps(vmm_acc(rows, vecs, m, v), vmm_b(rows, vecs, v), vmm_bcast(rows, vecs));
+            }
+
+            add(aux_reg_a, static_cast<int>(jcp.lda_k * f32));
+            add(aux_reg_b, static_cast<int>(jcp.ldb * f32));
+            dec(reg_k);
+            jnz(k_loop_label, T_NEAR);
+        }
+
+        for (int m = 0; m < rows; m++) {
+            for (int v = 0; v < vecs; v++) {
+                const int offset = static_cast<int>(((m0 + m) * jcp.ldc + n0 + v * step) * f32);
+                store_c(ptr[reg_c + offset], vmm_acc(rows, vecs, m, v), has_tail && v == vecs - 1);
+            }
+        }
+    }
+
+    Xbyak::Reg64 reg_a = r8;
+    Xbyak::Reg64 reg_b = r9;
+    Xbyak::Reg64 reg_c = r10;
+    Xbyak::Reg64 aux_reg_a = r11;
+    Xbyak::Reg64 aux_reg_b = r12;
+    Xbyak::Reg64 reg_k = r13;
+    Xbyak::Reg64 reg_tmp = r14;
+
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    // the mask is in the last register, the blocks never reach it
+    Vmm vmm_tail_mask = Vmm(vmm_count - 1);
+    const Xbyak::Opmask k_tail_mask = Xbyak::Opmask(1);
+
+    Xbyak::Label l_tail_mask;
+};
+
+bool SmallGemm::isApplicable(const SmallGemmParams& params) {
+    if (!mayiuse(cpu::x64::avx2))
+        return false;
+
+    const size_t rank = params.dst_dims.size();
+    if (rank < 2 || params.src0_dims.size() != rank || params.src1_dims.size() != rank)
+        return false;
+
+    const size_t M = params.dst_dims[rank - 2];
+    const size_t N = params.dst_dims[rank - 1];
+    const size_t K = params.transpose_a ? params.src0_dims[rank - 2] : params.src0_dims[rank - 1];
+    if (M == 0 || N == 0 || K == 0 || M > max_gemm_dim || N > max_gemm_dim || K > max_gemm_dim)
+        return false;
+
+    // the matrices of one batch have to stay in the per core L2 together, the packed B is expected to stay in L1
+    const size_t L1_cache_size = static_cast<size_t>(mkldnn::utils::get_cache_size(1, true));
+    const size_t L2_cache_size = static_cast<size_t>(mkldnn::utils::get_cache_size(2, true));
+    const size_t matrices_size = (M * K + K * N + M * N) * sizeof(float);
+    return matrices_size <= L2_cache_size / 2 && (!params.transpose_b || K * N * sizeof(float) <= L1_cache_size);
+}
+
+SmallGemm::SmallGemm(const SmallGemmParams& params) : transpose_a(params.transpose_a), transpose_b(params.transpose_b) {
+    const size_t rank = params.dst_dims.size();
+    M = params.dst_dims[rank - 2];
+    N = params.dst_dims[rank - 1];
+    K = transpose_a ? params.src0_dims[rank - 2] : params.src0_dims[rank - 1];
+
+    // the offsets of the matrices of the inputs for every batch of the output, the broadcasted dims have zero strides
+    const size_t batch = std::accumulate(params.dst_dims.begin(), params.dst_dims.end() - 2, size_t(1), std::multiplies<size_t>());
+    src0_offsets.resize(batch);
+    src1_offsets.resize(batch);
+    for (size_t b = 0; b < batch; b++) {
+        size_t rest = b;
+        size_t src0_stride = M * K, src1_stride = K * N;
+        size_t src0_offset = 0, src1_offset = 0;
+        for (size_t i = rank - 2; i-- > 0;) {
+            const size_t idx = rest % params.dst_dims[i];
+            rest /= params.dst_dims[i];
+            if (params.src0_dims[i] != 1)
+                src0_offset += idx * src0_stride;
+            if (params.src1_dims[i] != 1)
+                src1_offset += idx * src1_stride;
+            src0_stride *= params.src0_dims[i];
+            src1_stride *= params.src1_dims[i];
+        }
+        src0_offsets[b] = src0_offset;
+        src1_offsets[b] = src1_offset;
+    }
+
+    nthr = parallel_get_max_threads();
+    const size_t chunks_per_batch = batch >= static_cast<size_t>(nthr) ? 1 : MKLDNNPlugin::div_up(static_cast<size_t>(nthr), batch);
+    m_chunk = MKLDNNPlugin::div_up(M, chunks_per_batch);
+    m_chunks = MKLDNNPlugin::div_up(M, m_chunk);
+
+    jit_small_gemm_config_params jcp = {};
+    jcp.M = m_chunk;
+    jcp.N = N;
+    jcp.K = K;
+    jcp.lda_m = transpose_a ? 1 : K;
+    jcp.lda_k = transpose_a ? M : 1;
+    jcp.ldb = N;
+    jcp.ldc = N;
+    main_kernel = createKernel(jcp);
+
+    const size_t tail_rows = M - (m_chunks - 1) * m_chunk;
+    if (tail_rows != m_chunk) {
+        jcp.M = tail_rows;
+        tail_kernel = createKernel(jcp);
+    }
+
+    if (transpose_b)
+        packed_b.resize(static_cast<size_t>(nthr) * K * N);
+}
+
+impl_desc_type SmallGemm::getImplType() {
+    return mayiuse(cpu::x64::avx512_common) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+}
+
+std::shared_ptr<jit_uni_small_gemm_kernel> SmallGemm::createKernel(const jit_small_gemm_config_params& jcp) const {
+    std::shared_ptr<jit_uni_small_gemm_kernel> kernel;
+    if (mayiuse(cpu::x64::avx512_common)) {
+        kernel.reset(new jit_uni_small_gemm_kernel_f32<cpu::x64::avx512_common>(jcp));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        kernel.reset(new jit_uni_small_gemm_kernel_f32<cpu::x64::avx2>(jcp));
+    } else {
+        IE_THROW() << "Small GEMM kernel requires avx2";
+    }
+    kernel->create_ker();
+    return kernel;
+}
+
+void SmallGemm::execute(const float* src0, const float* src1, float* dst) {
+    const size_t batch = src0_offsets.size();
+    const size_t lda_m = transpose_a ? 1 : K;
+
+    parallel_nt(nthr, [&](const int ithr, const int threads) {
+        float* packed = transpose_b ? packed_b.data() + static_cast<size_t>(ithr) * K * N : nullptr;
+        const float* packed_src = nullptr;
+
+        for_1d(ithr, threads, batch * m_chunks, [&](size_t i) {
+            const size_t b = i / m_chunks;
+            const size_t chunk = i % m_chunks;
+
+            const float* b_data = src1 + src1_offsets[b];
+            if (transpose_b) {
+                // B is [N, K], the kernel loads the rows of [K, N]
+                if (packed_src != b_data) {
+                    for (size_t n = 0; n < N; n++)
+                        for (size_t k = 0; k < K; k++)
+                            packed[k * N + n] = b_data[n * K + k];
+                    packed_src = b_data;
+                }
+                b_data = packed;
+            }
+
+            jit_args_small_gemm args;
+            args.a = src0 + src0_offsets[b] + chunk * m_chunk * lda_m;
+            args.b = b_data;
+            args.c = dst + b * M * N + chunk * m_chunk * N;
+            if (chunk == m_chunks - 1 && tail_kernel)
+                (*tail_kernel)(&args);
+            else
+                (*main_kernel)(&args);
+        });
+    });
+}
@@ -0,0 +1,97 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Batched fp32 matrix multiplication C[M, N] = A[M, K] * B[K, N] of the plain layouts given by the dims of the inputs
+ * and the output of the equal ranks. The batch dims of the inputs are either equal to the output ones or broadcasted.
+ */
+struct SmallGemmParams {
+    InferenceEngine::SizeVector src0_dims;
+    InferenceEngine::SizeVector src1_dims;
+    InferenceEngine::SizeVector dst_dims;
+    bool transpose_a;
+    bool transpose_b;
+};
+
+/*
+ * The kernel is generated for the whole M x N x K problem of one batch: the output is computed by the register blocks
+ * of the rows of A broadcasted against the vectors of the rows of B, the K loop is the only runtime loop.
+ */
+struct jit_small_gemm_config_params {
+    size_t M;
+    size_t N;
+    size_t K;
+    size_t lda_m;  // strides of A in elements along M and K, so the transposed A is read in place
+    size_t lda_k;
+    size_t ldb;
+    size_t ldc;
+};
+
+struct jit_args_small_gemm {
+    const float* a;
+    const float* b;
+    float* c;
+};
+
+struct jit_uni_small_gemm_kernel {
+    void (*ker_)(const jit_args_small_gemm *);
+
+    void operator()(const jit_args_small_gemm *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_small_gemm_kernel(jit_small_gemm_config_params jcp_) : ker_(nullptr), jcp(jcp_) {}
+    virtual ~jit_uni_small_gemm_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_small_gemm_config_params jcp;
+};
+
+/*
+ * Small GEMM executor parallelized over the batch and, when the batch doesn't occupy all the threads, over the chunks of M.
+ * The transposed B is packed by each thread into its buffer, which is reused by the following chunks of the same batch.
+ */
+class SmallGemm {
+public:
+    explicit SmallGemm(const SmallGemmParams& params);
+
+    // the problems which don't fit the caches or the machines without avx2 are left to oneDNN matmul
+    static bool isApplicable(const SmallGemmParams& params);
+
+    static impl_desc_type getImplType();
+
+    void execute(const float* src0, const float* src1, float* dst);
+
+private:
+    std::shared_ptr<jit_uni_small_gemm_kernel> createKernel(const jit_small_gemm_config_params& jcp) const;
+
+    std::shared_ptr<jit_uni_small_gemm_kernel> main_kernel;
+    std::shared_ptr<jit_uni_small_gemm_kernel> tail_kernel;
+
+    size_t M = 0;
+    size_t N = 0;
+    size_t K = 0;
+    bool transpose_a = false;
+    bool transpose_b = false;
+    size_t m_chunk = 0;
+    size_t m_chunks = 0;
+    int nthr = 1;
+
+    std::vector<float> packed_b;
+    std::vector<size_t> src0_offsets;
+    std::vector<size_t> src1_offsets;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,210 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "yolo_detection.h"
+
+#include <ie_common.h>
+#include <ie_parallel.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+inline float logistic(float x) {
+    return 1.f / (1.f + std::exp(-x));
+}
+
+// the minimal logit of the probability not less than p
+inline float logit(float p) {
+    if (p <= 0.f)
+        return -std::numeric_limits<float>::infinity();
+    if (p >= 1.f)
+        return std::numeric_limits<float>::infinity();
+    return std::log(p / (1.f - p));
+}
+
+}  // namespace
+
+constexpr size_t YoloDetectionKernel::detectionSize;
+
+YoloDetectionKernel::YoloDetectionKernel(const YoloDetectionParams& params) : params(params), nmsKernel(0.f, true) {
+    if (params.scales.empty() || params.classes == 0 || params.keep_top_k == 0)
+        IE_THROW() << "YoloDetectionKernel expects at least one scale, one class and positive keep_top_k";
+    if (params.input_width == 0 || params.input_height == 0)
+        IE_THROW() << "YoloDetectionKernel expects positive input sizes";
+
+    for (size_t s = 0; s < params.scales.size(); s++) {
+        const auto& scale = params.scales[s];
+        if (scale.anchors.empty() || scale.anchors.size() % 2 != 0)
+            IE_THROW() << "YoloDetectionKernel expects (width, height) anchors pairs for each scale";
+        for (size_t b = 0; b < scale.anchors.size() / 2; b++) {
+            for (size_t h = 0; h < scale.height; h++)
+                workItems.push_back({s, b, h});
+        }
+    }
+}
+
+void YoloDetectionKernel::collectCandidates(const std::vector<const float*>& srcs, size_t image, const WorkItem& item,
+                                            std::vector<Candidate>& candidates, std::vector<NmsBox>& boxes) const {
+    const auto& scale = params.scales[item.scale];
+    const size_t H = scale.height;
+    const size_t W = scale.width;
+    const size_t classes = params.classes;
+    const size_t boxChannels = 5 + classes;
+    const size_t boxesNum = scale.anchors.size() / 2;
+    const float threshold = params.confidence_threshold;
+
+    const float* src = srcs[item.scale] + image * boxesNum * boxChannels * H * W;
+    auto channel = [&](size_t c) {
+        return src + ((item.box * boxChannels + c) * H + item.row) * W;
+    };
+    const float* tx = channel(0);
+    const float* ty = channel(1);
+    const float* tw = channel(2);
+    const float* th = channel(3);
+    const float* tobj = channel(4);
+    const float* tcls = channel(5);
+    const size_t classStride = H * W;
+
+    // the class probabilities don't exceed 1, so the cells of the lower objectness can't contain a detection
+    const float objectnessLogit = logit(threshold);
+    const float anchorWidth = scale.anchors[2 * item.box] / (params.do_softmax ? W : params.input_width);
+    const float anchorHeight = scale.anchors[2 * item.box + 1] / (params.do_softmax ? H : params.input_height);
+
+    for (size_t w = 0; w < W; w++) {
+        if (tobj[w] < objectnessLogit)
+            continue;
+        const float objectness = logistic(tobj[w]);
+
+        // the class score passes if its raw value is not less than classLogit
+        float classLogit;
+        float maxScore = 0.f;
+        float expSum = 1.f;
+        if (params.do_softmax) {
+            maxScore = tcls[w];
+            for (size_t c = 1; c < classes; c++)
+                maxScore = (std::max)(maxScore, tcls[c * classStride + w]);
+            expSum = 0.f;
+            for (size_t c = 0; c < classes; c++)
+                expSum += std::exp(tcls[c * classStride + w] - maxScore);
+            classLogit = threshold > 0.f ? maxScore + std::log(threshold * expSum / objectness)
+                                         : -std::numeric_limits<float>::infinity();
+        } else {
+            classLogit = logit(threshold / objectness);
+        }
+
+        int boxIdx = -1;
+        for (size_t c = 0; c < classes; c++) {
+            const float raw = tcls[c * classStride + w];
+            if (raw < classLogit)
+                continue;
+            const float score = objectness * (params.do_softmax ? std::exp(raw - maxScore) / expSum : logistic(raw));
+            if (score < threshold)
+                continue;
+
+            if (boxIdx < 0) {
+                const float x = (static_cast<float>(w) + logistic(tx[w])) / W;
+                const float y = (static_cast<float>(item.row) + logistic(ty[w])) / H;
+                const float halfWidth = 0.5f * std::exp(tw[w]) * anchorWidth;
+                const float halfHeight = 0.5f * std::exp(th[w]) * anchorHeight;
+
+                NmsBox box;
+                box.xmin = x - halfWidth;
+                box.ymin = y - halfHeight;
+                box.xmax = x + halfWidth;
+                box.ymax = y + halfHeight;
+                box.area = (box.xmax - box.xmin) * (box.ymax - box.ymin);
+                boxIdx = static_cast<int>(boxes.size());
+                boxes.push_back(box);
+            }
+            candidates.push_back({score, static_cast<int>(c), boxIdx});
+        }
+    }
+}
+
+void YoloDetectionKernel::execute(const std::vector<const float*>& srcs, float* dst) const {
+    const size_t classes = params.classes;
+    const size_t keepTopK = params.keep_top_k;
+    const size_t resultsNum = params.batch * keepTopK;
+    std::memset(dst, 0, resultsNum * detectionSize * sizeof(float));
+
+    size_t count = 0;
+    for (size_t n = 0; n < params.batch; n++) {
+        std::vector<std::vector<Candidate>> itemCandidates(workItems.size());
+        std::vector<std::vector<NmsBox>> itemBoxes(workItems.size());
+        InferenceEngine::parallel_for(workItems.size(), [&](size_t i) {
+            collectCandidates(srcs, n, workItems[i], itemCandidates[i], itemBoxes[i]);
+        });
+
+        // the work items are merged in the order, so the result doesn't depend on the threads number
+        std::vector<NmsBox> boxes;
+        std::vector<std::vector<Candidate>> classCandidates(classes);
+        for (size_t i = 0; i < workItems.size(); i++) {
+            const int offset = static_cast<int>(boxes.size());
+            boxes.insert(boxes.end(), itemBoxes[i].begin(), itemBoxes[i].end());
+            for (auto candidate : itemCandidates[i]) {
+                candidate.box += offset;
+                classCandidates[candidate.label].push_back(candidate);
+            }
+        }
+
+        // no more than keep_top_k boxes of a class can get into the top of the image
+        std::vector<std::vector<Candidate>> classSelected(classes);
+        InferenceEngine::parallel_for(classes, [&](size_t c) {
+            auto& candidates = classCandidates[c];
+            if (candidates.empty())
+                return;
+            std::stable_sort(candidates.begin(), candidates.end(),
+                             [](const Candidate& l, const Candidate& r) { return l.score > r.score; });
+
+            NmsSelectedBoxes selected(keepTopK);
+            for (const auto& candidate : candidates) {
+                const auto& box = boxes[candidate.box];
+                if (nmsKernel.isSuppressed(box, selected, params.iou_threshold))
+                    continue;
+                selected.push_back(box);
+                classSelected[c].push_back(candidate);
+                if (selected.size() == keepTopK)
+                    break;
+            }
+        });
+
+        std::vector<Candidate> detections;
+        for (const auto& selected : classSelected)
+            detections.insert(detections.end(), selected.begin(), selected.end());
+        if (detections.size() > keepTopK) {
+            std::stable_sort(detections.begin(), detections.end(),
+                             [](const Candidate& l, const Candidate& r) { return l.score > r.score; });
+            detections.resize(keepTopK);
+        }
+        std::stable_sort(detections.begin(), detections.end(), [](const Candidate& l, const Candidate& r) {
+            return l.label < r.label || (l.label == r.label && l.score > r.score);
+        });
+
+        for (const auto& detection : detections) {
+            const auto& box = boxes[detection.box];
+            float* row = dst + count * detectionSize;
+            row[0] = static_cast<float>(n);
+            row[1] = static_cast<float>(detection.label);
+            row[2] = detection.score;
+            row[3] = box.xmin;
+            row[4] = box.ymin;
+            row[5] = box.xmax;
+            row[6] = box.ymax;
+            count++;
+        }
+    }
+
+    if (count < resultsNum) {
+        // marker at end of boxes list
+        dst[count * detectionSize] = -1;
+    }
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,75 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "nms_kernel.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/*
+ * YOLO detection head: the raw feature maps [N, B * (5 + C), H, W] of the scales, each one holds B boxes of
+ * channels (tx, ty, tw, th, objectness, C class scores) per cell.
+ */
+struct YoloDetectionParams {
+    struct Scale {
+        size_t height;
+        size_t width;
+        std::vector<float> anchors;  // (width, height) pairs of the boxes of the scale
+    };
+
+    std::vector<Scale> scales;
+    size_t batch;
+    size_t classes;
+    // the anchors of the logistic head are measured in the pixels of the network input, the softmax head
+    // (YOLOv2 region) measures them in the cells of the feature map
+    size_t input_width;
+    size_t input_height;
+    bool do_softmax;
+    float confidence_threshold;
+    float iou_threshold;
+    size_t keep_top_k;  // per image
+};
+
+/*
+ * Decodes the boxes and runs class aware NMS directly on the feature maps. The objectness of the cell is checked
+ * first and the class scores are compared with the threshold in the logit domain, so the activations and the boxes
+ * are computed for the surviving cells only and the prediction tensor is never stored.
+ * The output is the DetectionOutput one: [batch * keep_top_k, 7] rows of (image, class, score, xmin, ymin, xmax, ymax)
+ * with the coordinates normalized to the input, the rows after the last detection start with -1.
+ */
+class YoloDetectionKernel {
+public:
+    explicit YoloDetectionKernel(const YoloDetectionParams& params);
+
+    void execute(const std::vector<const float*>& srcs, float* dst) const;
+
+    static constexpr size_t detectionSize = 7;
+
+private:
+    struct Candidate {
+        float score;
+        int label;
+        int box;
+    };
+
+    // the rows of the feature maps of all the scales and boxes are the parallel work items of one image
+    struct WorkItem {
+        size_t scale;
+        size_t box;
+        size_t row;
+    };
+
+    void collectCandidates(const std::vector<const float*>& srcs, size_t image, const WorkItem& item,
+                           std::vector<Candidate>& candidates, std::vector<NmsBox>& boxes) const;
+
+    YoloDetectionParams params;
+    std::vector<WorkItem> workItems;
+    NmsKernel nmsKernel;
+};
+
+}  // namespace MKLDNNPlugin
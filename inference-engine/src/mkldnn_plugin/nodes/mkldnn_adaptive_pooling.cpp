@@ -265,5 +265,3 @@ inline void MKLDNNAdaptivePoolingNode::setBinBorders(size_t *startPtr, size_t *e
     *(startPtr) = idx * inputLength / outputLength;
     *(endPtr) = ceil(static_cast<float>((idx + 1) * inputLength) / outputLength);
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNAdaptivePoolingNode, AdaptivePooling)
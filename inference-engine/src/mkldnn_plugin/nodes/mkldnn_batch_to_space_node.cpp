@@ -241,5 +241,3 @@ void MKLDNNBatchToSpaceNode::execute(mkldnn::stream strm) {
 bool MKLDNNBatchToSpaceNode::created() const {
     return getType() == BatchToSpace;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNBatchToSpaceNode, BatchToSpace)
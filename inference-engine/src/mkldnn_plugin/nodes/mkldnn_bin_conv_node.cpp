@@ -1332,5 +1332,3 @@ void MKLDNNBinaryConvolutionNode::execute(mkldnn::stream strm) {
 bool MKLDNNBinaryConvolutionNode::created() const {
     return getType() == BinaryConvolution;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNBinaryConvolutionNode, BinaryConvolution);
@@ -136,5 +136,3 @@ void MKLDNNBroadcastNode::execute(mkldnn::stream strm) {
 bool MKLDNNBroadcastNode::created() const {
     return getType() == Broadcast;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNBroadcastNode, Broadcast)
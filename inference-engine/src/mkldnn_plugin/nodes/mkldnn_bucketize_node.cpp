@@ -219,5 +219,3 @@ void MKLDNNBucketizeNode::bucketize() {
 bool MKLDNNBucketizeNode::created() const {
     return getType() == Bucketize;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNBucketizeNode, Bucketize)
@@ -112,24 +112,17 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
 
     const auto& dstShape = getOutputShapeAtPort(0);
     std::vector<LayoutType> tdCreatorTypes = {LayoutType::ncsp, LayoutType::nspc};
+    // blocked layouts which are supported only in place
+    std::vector<LayoutType> inPlaceOnlyCreatorTypes;
 
     // check if blocked layouts are available the channels size should be evenly divided by the block size to avoid slow oneDNN ref implementation
     if (dstShape.getRank() > channelAxis) {
         for (auto item : { std::make_pair(8lu, LayoutType::nCsp8c), std::make_pair(16lu, LayoutType::nCsp16c)}) {
-            const VectorDims &blkDims = dstShape.getStaticDims();
-            if (blkDims[channelAxis] % item.first)
-                continue;
-
-            bool blocked = true;
-            for (size_t i = 0; i < getParentEdges().size(); i++) {
-                auto& srcDims = getInputShapeAtPort(i).getStaticDims();
-                if (srcDims[channelAxis] % item.first) {
-                    blocked = false;
-                    break;
-                }
-            }
-            if (blocked) {
+            if (isBlockAligned(item.first, true)) {
                 tdCreatorTypes.push_back(item.second);
+            } else if (axis == channelAxis && isBlockAligned(item.first, false)) {
+                // the channels of the last input may be not aligned, its padding then matches the padding of the output
+                inPlaceOnlyCreatorTypes.push_back(item.second);
             }
         }
     }
@@ -139,23 +132,27 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
     auto& creatorsMap = BlockedDescCreator::getCommonCreators();
 
     auto itrRange = BlockedDescCreator::makeFilteredRange(creatorsMap, static_cast<unsigned>(dstShape.getRank()), tdCreatorTypes);
-    for (auto itr = itrRange.first; itr != itrRange.second; ++itr) {
+    auto makeRefConfig = [&](const BlockedDescCreator::CreatorConstPtr& creator) {
         NodeConfig config;
 
         config.dynBatchSupport = true;
         config.outConfs.resize(1);
         config.outConfs[0].inPlace = -1;
         config.outConfs[0].constant = false;
-        config.outConfs[0].desc = itr->second->createSharedDesc(outputPrecision, dstShape);
+        config.outConfs[0].desc = creator->createSharedDesc(outputPrecision, dstShape);
 
         config.inConfs.resize(getParentEdges().size());
 
         for (size_t i = 0; i < getParentEdges().size(); ++i) {
             config.inConfs[i].inPlace = -1;
             config.inConfs[i].constant = false;
-            config.inConfs[i].desc = itr->second->createDesc(inputPrecision, getInputShapeAtPort(i)).cloneWithUndefStridesAndOffset();
+            config.inConfs[i].desc = creator->createDesc(inputPrecision, getInputShapeAtPort(i)).cloneWithUndefStridesAndOffset();
         }
-        supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref);
+        return config;
+    };
+
+    for (auto itr = itrRange.first; itr != itrRange.second; ++itr) {
+        supportedPrimitiveDescriptors.emplace_back(makeRefConfig(itr->second), impl_desc_type::ref);
         if (itr->first != LayoutType::nspc) {
             pdIndexesToReuse.push_back(supportedPrimitiveDescriptors.size() - 1);
         }
@@ -172,8 +169,14 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
 
     // Optimized inplace case
 
-    for (auto refPdIndex : pdIndexesToReuse) {
-        const auto& refConfig = supportedPrimitiveDescriptors[refPdIndex].getConfig();
+    std::vector<NodeConfig> refConfigs;
+    for (auto refPdIndex : pdIndexesToReuse)
+        refConfigs.push_back(supportedPrimitiveDescriptors[refPdIndex].getConfig());
+    auto inPlaceOnlyRange = BlockedDescCreator::makeFilteredRange(creatorsMap, static_cast<unsigned>(dstShape.getRank()), inPlaceOnlyCreatorTypes);
+    for (auto itr = inPlaceOnlyRange.first; itr != inPlaceOnlyRange.second; ++itr)
+        refConfigs.push_back(makeRefConfig(itr->second));
+
+    for (const auto& refConfig : refConfigs) {
         auto config = refConfig;
 
         const auto &order = refConfig.outConfs[0].desc->as<CpuBlockedMemoryDesc>()->getOrder();
@@ -259,7 +262,6 @@ void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
     }
 
     size_t maxCount = 0;
-    auto outDims = getOutputShapeAtPort(0).getStaticDims();
     LayoutType convertTo = LayoutType::ncsp;
     for (auto &it : formatFrequency) {
         if (it.second > maxCount) {
@@ -276,17 +278,11 @@ void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
 
     for (auto& item : { std::make_pair(8lu, LayoutType::nCsp8c), std::make_pair(16lu, LayoutType::nCsp16c) }) {
         if (convertTo == item.second) {
-            if (outDims[1] % item.first != 0) {
+            const bool inPlaceAligned = canBeInPlace && axis == channelAxis && isBlockAligned(item.first, false);
+            if (!isBlockAligned(item.first, true) && !inPlaceAligned) {
                 convertTo = LayoutType::ncsp;
                 break;
             }
-            for (size_t i = 0; i < getParentEdges().size(); i++) {
-                auto& inpDims = getInputShapeAtPort(i).getStaticDims();
-                if (inpDims[1] % item.first != 0) {
-                    convertTo = LayoutType::ncsp;
-                    break;
-                }
-            }
         }
     }
 
@@ -322,6 +318,18 @@ void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
     selectPrimitiveDescriptorByIndex(0);
 }
 
+bool MKLDNNConcatNode::isBlockAligned(size_t blockSize, bool withLastInput) const {
+    if (withLastInput && getOutputShapeAtPort(0).getStaticDims()[channelAxis] % blockSize)
+        return false;
+
+    const size_t inputsNum = withLastInput ? getParentEdges().size() : getParentEdges().size() - 1;
+    for (size_t i = 0; i < inputsNum; i++) {
+        if (getInputShapeAtPort(i).getStaticDims()[channelAxis] % blockSize)
+            return false;
+    }
+    return true;
+}
+
 bool MKLDNNConcatNode::created() const {
     return getType() == Concatenation;
 }
@@ -521,5 +529,3 @@ void MKLDNNConcatNode::execNspcSpecCase() {
         }
     });
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNConcatNode, Concatenation);
\ No newline at end of file
@@ -37,6 +37,8 @@ private:
     bool canOptimizeNspc = false;
 
     size_t inverseOrder(const InferenceEngine::SizeVector& order, size_t axis);
+    // checks that channels of the output and of the inputs (optionally except the last one) are multiples of the block
+    bool isBlockAligned(size_t blockSize, bool withLastInput) const;
     void execNspcSpecCase();
 
     InferenceEngine::Precision inputPrecision = InferenceEngine::Precision::FP32;
@@ -10,11 +10,16 @@
 #include "mkldnn_pooling_node.h"
 #include "mkldnn_concat_node.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include <utils/general_utils.h>
+#include <ie_parallel.hpp>
 #include <ngraph/ops.hpp>
 #include <cpu/x64/jit_generator.hpp>
 #include "common/cpu_convert.h"
@@ -399,6 +404,123 @@ void MKLDNNConvolutionNode::setPostOps(mkldnn::primitive_attr &attr, bool initWe
 
 void MKLDNNConvolutionNode::selectOptimalPrimitiveDescriptor() {
     selectPreferPrimitiveDescriptor(getPrimitivesPriority(), true);
+    // the priority defined by the user is followed as is
+    if (tuningCache && !isPrimitivesPriorityDefined)
+        selectMeasuredPrimitiveDescriptor();
+}
+
+void MKLDNNConvolutionNode::selectMeasuredPrimitiveDescriptor() {
+    // the fused depthwise convolution and the zero points need the extra arguments, which aren't emulated by the timing
+    if (withDWConv || !inputZeroPoints.empty() || getSelectedPrimitiveDescriptor() == nullptr)
+        return;
+
+    // the candidates have the layouts of the selected descriptor, so the choice doesn't add reorders around the node
+    const auto selectedConfig = getSelectedPrimitiveDescriptor()->getConfig();
+    std::vector<std::pair<int, impl_desc_type>> candidates;
+    for (const auto& type : getPrimitivesPriority()) {
+        if (candidates.size() == maxTunedCandidates)
+            break;
+        for (size_t i = 0; i < supportedPrimitiveDescriptors.size(); i++) {
+            const auto& supportedPd = supportedPrimitiveDescriptors[i];
+            const auto& config = supportedPd.getConfig();
+            if (supportedPd.getImplementationType() == type &&
+                config.inConfs[0].desc->isCompatible(*selectedConfig.inConfs[0].desc) &&
+                config.outConfs[0].desc->isCompatible(*selectedConfig.outConfs[0].desc)) {
+                candidates.emplace_back(static_cast<int>(i), type);
+                break;
+            }
+        }
+    }
+    if (candidates.size() < 2)
+        return;
+
+    auto dimsToString = [](const std::vector<size_t>& dims) {
+        std::string result;
+        for (const auto dim : dims)
+            result += std::to_string(dim) + ",";
+        return result;
+    };
+    auto paddingsToString = [](const std::vector<ptrdiff_t>& values) {
+        std::string result;
+        for (const auto value : values)
+            result += std::to_string(value) + ",";
+        return result;
+    };
+
+    std::ostringstream key;
+    key << "Convolution_" << getOriginalInputPrecisionAtPort(0).name() << "_" << getOriginalOutputPrecisionAtPort(0).name()
+        << "_src" << getInputShapeAtPort(0).toString() << selectedConfig.inConfs[0].desc->serializeFormat()
+        << "_dst" << selectedConfig.outConfs[0].desc->serializeFormat()
+        << "_wei" << dimsToString(weightDims) << "_g" << groupNum << "_b" << withBiases
+        << "_s" << dimsToString(stride) << "_d" << paddingsToString(dilation)
+        << "_pl" << paddingsToString(paddingL) << "_pr" << paddingsToString(paddingR)
+        << "_thr" << parallel_get_max_threads();
+
+    const std::string implName = tuningCache->getOrTune(key.str(), [&]() {
+        float bestTime = std::numeric_limits<float>::max();
+        std::string bestImpl;
+        for (const auto& candidate : candidates) {
+            const float time = measureImplementation(candidate.second, supportedPrimitiveDescriptors[candidate.first].getConfig());
+            if (time < bestTime) {
+                bestTime = time;
+                bestImpl = impl_type_to_string(candidate.second);
+            }
+        }
+        return bestImpl;
+    });
+
+    for (const auto& candidate : candidates) {
+        if (implName == impl_type_to_string(candidate.second)) {
+            selectPrimitiveDescriptorByIndex(candidate.first);
+            return;
+        }
+    }
+}
+
+float MKLDNNConvolutionNode::measureImplementation(impl_desc_type type, const NodeConfig& config) {
+    const int warmupRuns = 2;
+    const int measuredRuns = 5;
+
+    // the post operations are the same for all the candidates, so only the convolution itself is timed
+    mkldnn::primitive_attr attr;
+    for (const auto& desc : descs) {
+        auto itpd = desc.createPrimitiveDescriptorIterator(getEngine(), attr);
+        while (static_cast<bool>(itpd)) {
+            if (parse_impl_name(itpd.impl_info_str()) == type &&
+                getSrcMemDesc(itpd, 0)->isCompatible(*config.inConfs[0].desc) &&
+                getDstMemDesc(itpd, 0)->isCompatible(*config.outConfs[0].desc)) {
+                convolution_forward::primitive_desc primDesc(itpd.get());
+                convolution_forward conv(primDesc);
+
+                std::unordered_map<int, memory> args;
+                auto addArgument = [&](int arg, const memory::desc& md) {
+                    memory mem(md, getEngine());
+                    std::memset(mem.get_data_handle(), 0, md.get_size());
+                    args.emplace(arg, mem);
+                };
+                addArgument(DNNL_ARG_SRC, primDesc.src_desc());
+                addArgument(DNNL_ARG_WEIGHTS, primDesc.weights_desc());
+                if (withBiases)
+                    addArgument(DNNL_ARG_BIAS, primDesc.bias_desc());
+                addArgument(DNNL_ARG_DST, primDesc.dst_desc());
+
+                mkldnn::stream strm(getEngine());
+                float bestTime = std::numeric_limits<float>::max();
+                for (int i = 0; i < warmupRuns + measuredRuns; i++) {
+                    const auto start = std::chrono::steady_clock::now();
+                    conv.execute(strm, args);
+                    strm.wait();
+                    const std::chrono::duration<float, std::micro> time = std::chrono::steady_clock::now() - start;
+                    if (i >= warmupRuns)
+                        bestTime = std::min(bestTime, time.count());
+                }
+                return bestTime;
+            }
+            if (!itpd.next_impl())
+                break;
+        }
+    }
+    return std::numeric_limits<float>::max();
 }
 
 void MKLDNNConvolutionNode::initSupportedPrimitiveDescriptors() {
@@ -499,11 +621,12 @@ void MKLDNNConvolutionNode::createPrimitive() {
     } else {
         setPostOps(attr, true);
     }
+    setScratchpadMode(attr);
 
     auto prim_desc = createPrimitiveDescriptor<convolution_forward::primitive_desc,
             convolution_forward::desc>(attr);
 
-    prim.reset(new convolution_forward(prim_desc));
+    prim = createSharedPrimitive<convolution_forward>(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -888,5 +1011,3 @@ InferenceEngine::Blob::Ptr MKLDNNConvolutionNode::createInternalBlob(InferenceEn
 
     return internalBlob;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNConvolutionNode, Convolution);
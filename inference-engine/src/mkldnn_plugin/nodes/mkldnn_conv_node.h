@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <mkldnn_tuning_cache.hpp>
 #include <memory>
 #include <string>
 #include <vector>
@@ -61,6 +62,8 @@ public:
 
     bool isWinograd() const { return isWino; }
 
+    void setTuningCache(const MKLDNNTuningCache::Ptr& cache) { tuningCache = cache; }
+
 protected:
     InferenceEngine::Precision fusedEltwisePrecision(const MKLDNNNodePtr& fusingNode) const;
 
@@ -71,6 +74,8 @@ private:
     bool isPossibleToSkipInitConfig(MKLDNNDescriptor &desc) const;
     bool isNspcAvailable() const;
     InferenceEngine::Blob::Ptr createInternalBlob(InferenceEngine::SizeVector dims, size_t edgeNum, bool isGrouped = false);
+    void selectMeasuredPrimitiveDescriptor();
+    float measureImplementation(impl_desc_type type, const NodeConfig& config);
 
     bool withBiases;
     bool withSum;
@@ -102,6 +107,10 @@ private:
     const size_t Y_AXIS = 1;
 
     bool isWino = false;
+
+    // the implementations of the selected layout which are timed by the tuning
+    const size_t maxTunedCandidates = 3;
+    MKLDNNTuningCache::Ptr tuningCache;
 };
 
 }  // namespace MKLDNNPlugin
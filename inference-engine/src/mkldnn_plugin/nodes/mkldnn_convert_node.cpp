@@ -152,5 +152,3 @@ void MKLDNNConvertNode::execute(mkldnn::stream strm) {
 bool MKLDNNConvertNode::created() const {
     return getType() == Convert;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNConvertNode, Convert);
@@ -166,5 +166,3 @@ void MKLDNNCTCGreedyDecoderNode::execute(mkldnn::stream strm) {
 bool MKLDNNCTCGreedyDecoderNode::created() const {
     return getType() == CTCGreedyDecoder;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNCTCGreedyDecoderNode, CTCGreedyDecoder)
@@ -280,5 +280,3 @@ void MKLDNNCTCLossNode::execute(mkldnn::stream strm) {
 bool MKLDNNCTCLossNode::created() const {
     return getType() == CTCLoss;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNCTCLossNode, CTCLoss)
@@ -12,9 +12,175 @@
 #include "ie_precision.hpp"
 #include <ie_ngraph_utils.hpp>
 #include "mkldnn_cum_sum_node.h"
+#include "emitters/jit_load_store_emitters.hpp"
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_cum_sum_call_args, field)
+
+namespace {
+// the number of the adjacent elements summed by one kernel call
+constexpr size_t inner_chunk = 256;
+}  // namespace
+
+template <cpu_isa_t isa>
+struct jit_uni_cum_sum_kernel_f32 : public jit_uni_cum_sum_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_cum_sum_kernel_f32);
+
+    explicit jit_uni_cum_sum_kernel_f32(jit_cum_sum_config_params jcp) : jit_uni_cum_sum_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    };
+
+    void generate() override {
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_axis_len, ptr[reg_params + GET_OFF(axis_len)]);
+        mov(reg_axis_stride, ptr[reg_params + GET_OFF(axis_stride)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        Label main_loop_label;
+        Label tail_loop_label;
+        Label exit_label;
+
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, step);
+            jl(tail_loop_label, T_NEAR);
+
+            sum(step);
+
+            add(reg_src, step * jcp_.prc.size());
+            add(reg_dst, step * jcp_.prc.size());
+            sub(reg_work_amount, step);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(tail_loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            je(exit_label, T_NEAR);
+
+            sum(1);
+
+            add(reg_src, jcp_.prc.size());
+            add(reg_dst, jcp_.prc.size());
+            sub(reg_work_amount, 1);
+
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+
+        load_emitter->emit_data();
+        store_emitter->emit_data();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int step = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    void load(const Vmm &vmm, const Xbyak::Reg64 &reg, int num) {
+        load_emitter->emit_code({static_cast<size_t>(reg.getIdx())}, {static_cast<size_t>(vmm.getIdx())},
+                                std::make_shared<load_emitter_context>(jcp_.prc, jcp_.prc, num),
+                                {}, load_pool_gpr_idxs);
+    }
+
+    void store(const Vmm &vmm, const Xbyak::Reg64 &reg, int num) {
+        store_emitter->emit_code({static_cast<size_t>(vmm.getIdx())}, {static_cast<size_t>(reg.getIdx())},
+                                 std::make_shared<store_emitter_context>(jcp_.prc, jcp_.prc, num),
+                                 {static_cast<size_t>(vmm_aux.getIdx())}, store_pool_gpr_idxs);
+    }
+
+    void accumulate() {
+        if (jcp_.prc == Precision::FP32)
+            uni_vaddps(vmm_acc, vmm_acc, vmm_src);
+        else
+            uni_vpaddd(vmm_acc, vmm_acc, vmm_src);
+    }
+
+    // the running sum of num vectorized elements is carried along the whole axis
+    void sum(int num) {
+        Label axis_loop_label;
+
+        uni_vpxor(vmm_acc, vmm_acc, vmm_acc);
+        mov(aux_reg_src, reg_src);
+        mov(aux_reg_dst, reg_dst);
+        if (jcp_.reverse) {
+            mov(reg_aux, reg_axis_len);
+            dec(reg_aux);
+            imul(reg_aux, reg_axis_stride);
+            add(aux_reg_src, reg_aux);
+            add(aux_reg_dst, reg_aux);
+        }
+        mov(reg_axis_work, reg_axis_len);
+
+        L(axis_loop_label);
+        {
+            if (jcp_.exclusive) {
+                store(vmm_acc, aux_reg_dst, num);
+                load(vmm_src, aux_reg_src, num);
+                accumulate();
+            } else {
+                load(vmm_src, aux_reg_src, num);
+                accumulate();
+                store(vmm_acc, aux_reg_dst, num);
+            }
+
+            if (jcp_.reverse) {
+                sub(aux_reg_src, reg_axis_stride);
+                sub(aux_reg_dst, reg_axis_stride);
+            } else {
+                add(aux_reg_src, reg_axis_stride);
+                add(aux_reg_dst, reg_axis_stride);
+            }
+            dec(reg_axis_work);
+            jnz(axis_loop_label, T_NEAR);
+        }
+    }
+
+    Vmm vmm_acc = Vmm(0);
+    Vmm vmm_src = Vmm(1);
+    Vmm vmm_aux = Vmm(2);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_axis_len = r10;
+    Xbyak::Reg64 reg_axis_stride = r11;
+    Xbyak::Reg64 reg_work_amount = r12;
+    Xbyak::Reg64 aux_reg_src = r13;
+    Xbyak::Reg64 aux_reg_dst = r14;
+    Xbyak::Reg64 reg_axis_work = r15;
+    Xbyak::Reg64 reg_aux = rbx;
+    Xbyak::Reg64 reg_load_store_mask = rsi;
+    Xbyak::Reg64 reg_load_table = rbp;
+
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+    std::vector<size_t> store_pool_gpr_idxs;
+};
 
 bool MKLDNNCumSumNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
@@ -96,6 +262,27 @@ void MKLDNNCumSumNode::initSupportedPrimitiveDescriptors() {
                          impl_desc_type::ref_any);
 }
 
+void MKLDNNCumSumNode::createPrimitive() {
+    if (dataPrecision != Precision::FP32 && dataPrecision != Precision::I32)
+        return;
+
+    jit_cum_sum_config_params jcp;
+    jcp.prc = dataPrecision;
+    jcp.reverse = reverse;
+    jcp.exclusive = exclusive;
+
+    if (mayiuse(cpu::x64::avx512_common)) {
+        cum_sum_kernel.reset(new jit_uni_cum_sum_kernel_f32<cpu::x64::avx512_common>(jcp));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        cum_sum_kernel.reset(new jit_uni_cum_sum_kernel_f32<cpu::x64::avx2>(jcp));
+    } else if (mayiuse(cpu::x64::sse41)) {
+        cum_sum_kernel.reset(new jit_uni_cum_sum_kernel_f32<cpu::x64::sse41>(jcp));
+    }
+
+    if (cum_sum_kernel)
+        cum_sum_kernel->create_ker();
+}
+
 void MKLDNNCumSumNode::execute(mkldnn::stream strm) {
     if (inputShapes.size() == numOfInputs)
         axis = getAxis(getParentEdgeAt(AXIS)->getMemory(), getParentEdgeAt(CUM_SUM_DATA)->getMemory());
@@ -143,6 +330,12 @@ void MKLDNNCumSumNode::exec() {
     auto *output = reinterpret_cast<dataType *>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
     const VectorDims strides = getParentEdgeAt(CUM_SUM_DATA)->getMemory().GetDescWithType<BlockedMemoryDesc>()->getStrides();
 
+    // the kernel is vectorized over the elements adjacent along the axis, so the innermost axis is left to the scalar loops
+    if (cum_sum_kernel && strides[axis] > 1) {
+        jitCumSum<dataType>(input, output, strides);
+        return;
+    }
+
     if (reverse) {
         if (exclusive) {
             cumSum<true, true, dataType>(input, output, strides);
@@ -222,6 +415,29 @@ void MKLDNNCumSumNode::cumSum(const dataType *input, dataType *output, const Vec
     });
 }
 
+template <typename dataType>
+void MKLDNNCumSumNode::jitCumSum(const dataType *input, dataType *output, const VectorDims &strides) {
+    const size_t axisLen = shape[axis];
+    if (axisLen == 0)
+        return;
+    const size_t innerWork = strides[axis];
+    const size_t outerWork = std::accumulate(shape.begin(), shape.begin() + axis, size_t(1), std::multiplies<size_t>());
+    const size_t innerChunks = div_up(innerWork, inner_chunk);
+    const size_t outerStride = axisLen * innerWork;
+
+    parallel_for2d(outerWork, innerChunks, [&](size_t outer, size_t chunk) {
+        const size_t offset = outer * outerStride + chunk * inner_chunk;
+
+        auto arg = jit_cum_sum_call_args();
+        arg.src = input + offset;
+        arg.dst = output + offset;
+        arg.axis_len = axisLen;
+        arg.axis_stride = innerWork * sizeof(dataType);
+        arg.work_amount = std::min(inner_chunk, innerWork - chunk * inner_chunk);
+        (*cum_sum_kernel)(&arg);
+    });
+}
+
 void MKLDNNCumSumNode::parallelItInit(size_t start, std::vector<size_t>& counters, const std::vector<size_t>& iterationRange) {
     auto itCounter = counters.rbegin();
     auto itWork = iterationRange.rbegin();
@@ -282,5 +498,3 @@ size_t MKLDNNCumSumNode::getAxis(const MKLDNNMemory& _axis, const MKLDNNMemory&
 bool MKLDNNCumSumNode::created() const {
     return getType() == CumSum;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNCumSumNode, CumSum)
@@ -9,13 +9,44 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_cum_sum_config_params {
+    InferenceEngine::Precision prc;
+    bool reverse;
+    bool exclusive;
+};
+
+// the kernel sums work_amount adjacent elements along the axis, the elements of the next axis index are axis_stride bytes away
+struct jit_cum_sum_call_args {
+    const void *src;
+    void *dst;
+    size_t axis_len;
+    size_t axis_stride;
+    size_t work_amount;
+};
+
+struct jit_uni_cum_sum_kernel {
+    void (*ker_)(const jit_cum_sum_call_args *);
+
+    void operator()(const jit_cum_sum_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_cum_sum_kernel(jit_cum_sum_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_cum_sum_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_cum_sum_config_params jcp_;
+};
+
 class MKLDNNCumSumNode : public MKLDNNNode {
 public:
     MKLDNNCumSumNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
 
     void getSupportedDescriptors() override {};
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {};
+    void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
@@ -28,6 +59,9 @@ private:
     template <bool reverse, bool exclusive, typename dataType>
     void cumSum(const dataType *input, dataType *output, const std::vector<size_t> &strides);
 
+    template <typename dataType>
+    void jitCumSum(const dataType *input, dataType *output, const std::vector<size_t> &strides);
+
     void parallelItInit(size_t start, std::vector<size_t>& counters, const std::vector<size_t>& iterationRange);
 
     inline void parallelItStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange);
@@ -45,6 +79,8 @@ private:
 
     InferenceEngine::Precision dataPrecision;
     std::string errorPrefix;
+
+    std::shared_ptr<jit_uni_cum_sum_kernel> cum_sum_kernel;
 };
 
 }  // namespace MKLDNNPlugin
@@ -335,11 +335,12 @@ void MKLDNNDeconvolutionNode::createPrimitive() {
     if (prim)
         return;
 
+    setScratchpadMode(attr);
     if (isInt8) {
         auto prim_desc = createPrimitiveDescriptor<deconvolution_forward::primitive_desc,
                 deconvolution_forward::desc>(attr);
 
-        prim.reset(new deconvolution_forward(prim_desc));
+        prim = createSharedPrimitive<deconvolution_forward>(prim_desc);
 
         auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
         auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -348,7 +349,7 @@ void MKLDNNDeconvolutionNode::createPrimitive() {
         auto prim_desc = createPrimitiveDescriptor<convolution_backward_data::primitive_desc,
                 convolution_backward_data::desc, convolution_forward::primitive_desc>(attr);
 
-        prim.reset(new convolution_backward_data(prim_desc));
+        prim = createSharedPrimitive<convolution_backward_data>(prim_desc);
 
         auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
         auto weights = getParentEdgeAt(1)->getMemory().GetPrimitive();
@@ -435,5 +436,3 @@ InferenceEngine::Precision MKLDNNDeconvolutionNode::getRuntimePrecision() const
 
     return getMaxPrecision(inputPrecisions);
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNDeconvolutionNode, Deconvolution);
@@ -428,8 +428,9 @@ private:
                 }
             }
 
-            add(aux_reg_sampled_wei, sampledPointsPerPixel * jcp_.kh * jcp_.kw * jcp_.oh * jcp_.ow * jcp_.typesize_sampled_wei);
-            add(aux_reg_sampled_offs, sampledPointsPerPixel * jcp_.kh * jcp_.kw * jcp_.oh * jcp_.ow * jcp_.typesize_sampled_offsets);
+            // the sampled points are given for one output row
+            add(aux_reg_sampled_wei, sampledPointsPerPixel * jcp_.kh * jcp_.kw * jcp_.ow * jcp_.typesize_sampled_wei);
+            add(aux_reg_sampled_offs, sampledPointsPerPixel * jcp_.kh * jcp_.kw * jcp_.ow * jcp_.typesize_sampled_offsets);
             add(aux_reg_input, ic_per_def_group * jcp_.typesize_in);
             add(aux2_reg_input_buffer, ic_per_def_group * jcp_.typesize_in);
             inc(reg_dg_iter);
@@ -739,19 +740,13 @@ void MKLDNNDeformableConvolutionNode::initSupportedPrimitiveDescriptors() {
     }
 }
 
-void MKLDNNDeformableConvolutionNode::prepareSamplingWeights(
+void MKLDNNDeformableConvolutionNode::computeSampledPoints(int mb, int dg, int oh, int ow, int* sampledCoords, float* interpWeights,
         const std::vector<size_t>& src_strides, const float* offsets, const std::vector<size_t>& off_strides,
-        const float* modulation, const std::vector<size_t>& modulation_strides) {
-    const int MB = jcp.mb;
-    const int OH = jcp.oh;
-    const int OW = jcp.ow;
-
+        const float* modulation, const std::vector<size_t>& modulation_strides) const {
     const int KH = jcp.kh;
     const int KW = jcp.kw;
     const int ker_size = KH * KW;
 
-    const int DG = jcp.dg;
-
     const int IH = jcp.ih;
     const int IW = jcp.iw;
 
@@ -766,103 +761,114 @@ void MKLDNNDeformableConvolutionNode::prepareSamplingWeights(
 
     const bool with_bi_pad = jcp.with_bi_pad;
 
-    // prepare weights and indices
-    sampledCoordsVector.resize(MB * DG * KH * KW * OH * OW * sampledPointsPerPixel);
-    interpWeightsVector.resize(MB * DG * KH * KW * OH * OW * sampledPointsPerPixel);
-    auto precompKer = [&](int mb, int dg, int oh, int ow) {
-        int sampledCoordIndex = (mb * DG * OH * OW + dg * OH * OW + oh * OW + ow) * KH * KW * sampledPointsPerPixel;
-        const int h_in = oh * KSH - padT;
-        const int w_in = ow * KSW - padL;
-
-        const int waOffsetH = (enforceRef ? 0 : h_in);
-        const int waOffsetW = (enforceRef ? 0 : w_in);
-
-        const float *data_offset_ptr = offsets + mb * off_strides[0] + (dg * 2 * KH * KW) * off_strides[1];
-        const float *modulation_offset_ptr = nullptr;
-        if (modulation != nullptr) {
-            modulation_offset_ptr = modulation + mb * modulation_strides[0] + (dg * ker_size) * modulation_strides[1];
-        }
+    int sampledCoordIndex = 0;
+    const int h_in = oh * KSH - padT;
+    const int w_in = ow * KSW - padL;
 
-        for (int kh = 0; kh < KH; kh++) {
-            for (int kw = 0; kw < KW; kw++) {
-                const size_t data_offset_h_index = 2 * ((size_t) kh * KW + kw) * off_strides[1] + oh * off_strides[2] + ow * off_strides[3];
-                const size_t data_offset_w_index = (2 * ((size_t) kh * KW + kw) + 1) * off_strides[1] + oh * off_strides[2] + ow * off_strides[3];
-                const float offset_h = data_offset_ptr[data_offset_h_index];
-                const float offset_w = data_offset_ptr[data_offset_w_index];
-                float map_h = h_in + kh * (KDH + 1) + offset_h;
-                float map_w = w_in + kw * (KDW + 1) + offset_w;
-                bool skip_compute;
-                if (with_bilinear_pad) {
-                    skip_compute = !(static_cast<int>(map_w) > -1 &&
-                                     static_cast<int>(map_w) < IW &&
-                                     static_cast<int>(map_h) > -1 &&
-                                     static_cast<int>(map_h) < IH);
-                } else {
-                    skip_compute = !(map_w >= 0 && map_w < IW &&
-                                     map_h >= 0 && map_h < IH);
-                }
-                if (!skip_compute) {
-                    // modulations precomp.
-                    float modulation_scalar = 1.0f;
+    const int waOffsetH = (enforceRef ? 0 : h_in);
+    const int waOffsetW = (enforceRef ? 0 : w_in);
 
-                    if (modulation_offset_ptr != nullptr) {
-                        size_t modulation_index = (kh * KW + kw) * modulation_strides[1] + oh * modulation_strides[2] + ow * modulation_strides[3];
-                        modulation_scalar = modulation_offset_ptr[modulation_index];
-                    }
-                    // interpolation precomp.
-                    const int cur_h_end = IH;
-                    const int cur_w_end = IW;
-                    int h_low = with_bi_pad ? static_cast<int>(floorf(map_h)) :
-                                std::max(static_cast<int>(floorf(map_h)), 0);
-                    int w_low = with_bi_pad ? static_cast<int>(floorf(map_w)) :
-                                std::max(static_cast<int>(floorf(map_w)), 0);
-                    int h_high = with_bi_pad ? h_low + 1 : std::min(static_cast<int>(ceilf(map_h)), cur_h_end - 1);
-                    int w_high = with_bi_pad ? w_low + 1 : std::min(static_cast<int>(ceilf(map_w)), cur_w_end - 1);
-
-                    float lh = map_h - h_low;
-                    float lw = map_w - w_low;
-                    float hh = 1 - lh, hw = 1 - lw;
-
-                    int h_ind_low = std::max(h_low, 0) - waOffsetH;
-                    int h_ind_high = std::min(h_high, cur_h_end - 1) - waOffsetH;
-                    int w_ind_low = std::max(w_low, 0) - waOffsetW;
-                    int w_ind_high = std::min(w_high, cur_w_end - 1) - waOffsetW;
-
-                    hh = (h_low >= 0 ? hh : 0);
-                    hw = (w_low >= 0 ? hw : 0);
-                    lh = (h_high < cur_h_end ? lh : 0);
-                    lw = (w_high < cur_w_end ? lw : 0);
-
-                    const int h_off_low = h_ind_low * src_strides[2] / src_strides[3];
-                    const int h_off_high = h_ind_high * src_strides[2] / src_strides[3];
-                    const int w_off_low  = w_ind_low;
-                    const int w_off_high = w_ind_high;
-                    sampledCoordsVector[sampledCoordIndex] = h_off_high + w_off_high;
-                    sampledCoordsVector[sampledCoordIndex + 1] = h_off_high + w_off_low;
-                    sampledCoordsVector[sampledCoordIndex + 2] = h_off_low + w_off_high;
-                    sampledCoordsVector[sampledCoordIndex + 3] = h_off_low + w_off_low;
-
-                    float w22 = hh * hw * modulation_scalar, w21 = hh * lw * modulation_scalar,
-                            w12 = lh * hw * modulation_scalar, w11 = lh * lw * modulation_scalar;
-
-                    interpWeightsVector[sampledCoordIndex] = w11;
-                    interpWeightsVector[sampledCoordIndex + 1] = w12;
-                    interpWeightsVector[sampledCoordIndex + 2] = w21;
-                    interpWeightsVector[sampledCoordIndex + 3] = w22;
-                } else {
-                    sampledCoordsVector[sampledCoordIndex] = 0;
-                    interpWeightsVector[sampledCoordIndex] = 0;
-                    interpWeightsVector[sampledCoordIndex + 1] = 0;
-                    interpWeightsVector[sampledCoordIndex + 2] = 0;
-                    interpWeightsVector[sampledCoordIndex + 3] = 0;
+    const float *data_offset_ptr = offsets + mb * off_strides[0] + (dg * 2 * KH * KW) * off_strides[1];
+    const float *modulation_offset_ptr = nullptr;
+    if (modulation != nullptr) {
+        modulation_offset_ptr = modulation + mb * modulation_strides[0] + (dg * ker_size) * modulation_strides[1];
+    }
+
+    for (int kh = 0; kh < KH; kh++) {
+        for (int kw = 0; kw < KW; kw++) {
+            const size_t data_offset_h_index = 2 * ((size_t) kh * KW + kw) * off_strides[1] + oh * off_strides[2] + ow * off_strides[3];
+            const size_t data_offset_w_index = (2 * ((size_t) kh * KW + kw) + 1) * off_strides[1] + oh * off_strides[2] + ow * off_strides[3];
+            const float offset_h = data_offset_ptr[data_offset_h_index];
+            const float offset_w = data_offset_ptr[data_offset_w_index];
+            float map_h = h_in + kh * (KDH + 1) + offset_h;
+            float map_w = w_in + kw * (KDW + 1) + offset_w;
+            bool skip_compute;
+            if (with_bilinear_pad) {
+                skip_compute = !(static_cast<int>(map_w) > -1 &&
+                                 static_cast<int>(map_w) < IW &&
+                                 static_cast<int>(map_h) > -1 &&
+                                 static_cast<int>(map_h) < IH);
+            } else {
+                skip_compute = !(map_w >= 0 && map_w < IW &&
+                                 map_h >= 0 && map_h < IH);
+            }
+            if (!skip_compute) {
+                // modulations precomp.
+                float modulation_scalar = 1.0f;
+
+                if (modulation_offset_ptr != nullptr) {
+                    size_t modulation_index = (kh * KW + kw) * modulation_strides[1] + oh * modulation_strides[2] + ow * modulation_strides[3];
+                    modulation_scalar = modulation_offset_ptr[modulation_index];
                 }
-                sampledCoordIndex += sampledPointsPerPixel;
+                // interpolation precomp.
+                const int cur_h_end = IH;
+                const int cur_w_end = IW;
+                int h_low = with_bi_pad ? static_cast<int>(floorf(map_h)) :
+                            std::max(static_cast<int>(floorf(map_h)), 0);
+                int w_low = with_bi_pad ? static_cast<int>(floorf(map_w)) :
+                            std::max(static_cast<int>(floorf(map_w)), 0);
+                int h_high = with_bi_pad ? h_low + 1 : std::min(static_cast<int>(ceilf(map_h)), cur_h_end - 1);
+                int w_high = with_bi_pad ? w_low + 1 : std::min(static_cast<int>(ceilf(map_w)), cur_w_end - 1);
+
+                float lh = map_h - h_low;
+                float lw = map_w - w_low;
+                float hh = 1 - lh, hw = 1 - lw;
+
+                int h_ind_low = std::max(h_low, 0) - waOffsetH;
+                int h_ind_high = std::min(h_high, cur_h_end - 1) - waOffsetH;
+                int w_ind_low = std::max(w_low, 0) - waOffsetW;
+                int w_ind_high = std::min(w_high, cur_w_end - 1) - waOffsetW;
+
+                hh = (h_low >= 0 ? hh : 0);
+                hw = (w_low >= 0 ? hw : 0);
+                lh = (h_high < cur_h_end ? lh : 0);
+                lw = (w_high < cur_w_end ? lw : 0);
+
+                const int h_off_low = h_ind_low * src_strides[2] / src_strides[3];
+                const int h_off_high = h_ind_high * src_strides[2] / src_strides[3];
+                const int w_off_low  = w_ind_low;
+                const int w_off_high = w_ind_high;
+                sampledCoords[sampledCoordIndex] = h_off_high + w_off_high;
+                sampledCoords[sampledCoordIndex + 1] = h_off_high + w_off_low;
+                sampledCoords[sampledCoordIndex + 2] = h_off_low + w_off_high;
+                sampledCoords[sampledCoordIndex + 3] = h_off_low + w_off_low;
+
+                float w22 = hh * hw * modulation_scalar, w21 = hh * lw * modulation_scalar,
+                        w12 = lh * hw * modulation_scalar, w11 = lh * lw * modulation_scalar;
+
+                interpWeights[sampledCoordIndex] = w11;
+                interpWeights[sampledCoordIndex + 1] = w12;
+                interpWeights[sampledCoordIndex + 2] = w21;
+                interpWeights[sampledCoordIndex + 3] = w22;
+            } else {
+                sampledCoords[sampledCoordIndex] = 0;
+                interpWeights[sampledCoordIndex] = 0;
+                interpWeights[sampledCoordIndex + 1] = 0;
+                interpWeights[sampledCoordIndex + 2] = 0;
+                interpWeights[sampledCoordIndex + 3] = 0;
             }
+            sampledCoordIndex += sampledPointsPerPixel;
         }
-    };
+    }
+}
+
+void MKLDNNDeformableConvolutionNode::prepareSamplingWeights(
+        const std::vector<size_t>& src_strides, const float* offsets, const std::vector<size_t>& off_strides,
+        const float* modulation, const std::vector<size_t>& modulation_strides) {
+    const int MB = jcp.mb;
+    const int OH = jcp.oh;
+    const int OW = jcp.ow;
+    const int DG = jcp.dg;
+    const int pointsPerOutput = jcp.kh * jcp.kw * sampledPointsPerPixel;
+
+    // prepare weights and indices
+    sampledCoordsVector.resize(MB * DG * OH * OW * pointsPerOutput);
+    interpWeightsVector.resize(MB * DG * OH * OW * pointsPerOutput);
 
     parallel_nd(MB, DG, OH, OW, [&](int mb, int dg, int oh, int ow)  {
-        precompKer(mb, dg, oh, ow);
+        const size_t sampledCoordIndex = (mb * DG * OH * OW + dg * OH * OW + oh * OW + ow) * pointsPerOutput;
+        computeSampledPoints(mb, dg, oh, ow, &sampledCoordsVector[sampledCoordIndex], &interpWeightsVector[sampledCoordIndex],
+                             src_strides, offsets, off_strides, modulation, modulation_strides);
     });
 }
 
@@ -996,31 +1002,51 @@ void MKLDNNDeformableConvolutionNode::executeReference(const float* src, const f
 
 
 void MKLDNNDeformableConvolutionNode::executeOptimized(const float* src, const float* weights, float* dst,
-                                                       const std::vector<size_t>& src_strides,
-                                                       const std::vector<size_t>& dst_strides) {
+                                                       const std::vector<size_t>& src_strides, const std::vector<size_t>& dst_strides,
+                                                       const float* offsets, const std::vector<size_t>& off_strides,
+                                                       const float* modulation, const std::vector<size_t>& modulation_strides) {
     size_t buffer_size = (size_t)jcp.nthr * jcp.ur_w * jcp.kh * jcp.kw * jcp.ic * jcp.typesize_in;
     std::vector<float> input_buffer(buffer_size, 0);
     float* input_buffer_ptr = input_buffer.data();
 
-    parallel_for3d(jcp.mb, jcp.ngroups, jcp.oh, [&](size_t n, size_t g, size_t oh) {
+    // the sampling of one output row is computed by the thread right before the kernel reads it,
+    // so only the row of each thread is stored and it is still in the cache when the kernel runs
+    const size_t rowSamplingSize = (size_t)jcp.dg * jcp.ow * jcp.kh * jcp.kw * sampledPointsPerPixel;
+    sampledCoordsVector.resize(jcp.nthr * rowSamplingSize);
+    interpWeightsVector.resize(jcp.nthr * rowSamplingSize);
+
+    parallel_for2d(jcp.mb, jcp.oh, [&](size_t n, size_t oh) {
         auto ithr = parallel_get_thread_num();
 
-        auto par_conv = jit_def_conv_call_args();
+        int* sampledCoords = &sampledCoordsVector[ithr * rowSamplingSize];
+        float* interpWeights = &interpWeightsVector[ithr * rowSamplingSize];
+        for (int dg = 0; dg < jcp.dg; dg++) {
+            for (int ow = 0; ow < jcp.ow; ow++) {
+                const size_t sampledCoordIndex = ((size_t)dg * jcp.ow + ow) * jcp.kh * jcp.kw * sampledPointsPerPixel;
+                computeSampledPoints(n, dg, oh, ow, sampledCoords + sampledCoordIndex, interpWeights + sampledCoordIndex,
+                                     src_strides, offsets, off_strides, modulation, modulation_strides);
+            }
+        }
 
-        const size_t _oc = g * jcp.nb_oc;
-        const size_t _ic = g * jcp.nb_ic;
+        // the sampled row is shared by all the groups and the output channels
+        for (int g = 0; g < jcp.ngroups; g++) {
+            auto par_conv = jit_def_conv_call_args();
 
-        par_conv.src = &src[n * src_strides[0] + _ic*jcp.ic_block * src_strides[1] +
-                            (oh * jcp.stride_h - jcp.t_pad) * src_strides[2] - jcp.l_pad * src_strides[3]];
-        par_conv.sampledWei = &interpWeightsVector[(n * jcp.dg * jcp.oh + oh) * jcp.kh * jcp.kw * jcp.ow * sampledPointsPerPixel];
-        par_conv.sampledCoords = &sampledCoordsVector[(n * jcp.dg * jcp.oh + oh) * jcp.kh * jcp.kw * jcp.ow * sampledPointsPerPixel];
-        par_conv.filt = &weights[g * jcp.nb_oc * jcp.nb_ic * jcp.kh * jcp.kw * jcp.ic_block * jcp.oc_block];
-        par_conv.dst = &dst[n * dst_strides[0] + _oc * jcp.oc_block * dst_strides[1] + oh * dst_strides[2]];
-        par_conv.buf = input_buffer_ptr + ithr * jcp.ur_w * jcp.kh * jcp.kw * jcp.ic;
+            const size_t _oc = g * jcp.nb_oc;
+            const size_t _ic = g * jcp.nb_ic;
 
-        par_conv.oh_pos = oh;
+            par_conv.src = &src[n * src_strides[0] + _ic*jcp.ic_block * src_strides[1] +
+                                (oh * jcp.stride_h - jcp.t_pad) * src_strides[2] - jcp.l_pad * src_strides[3]];
+            par_conv.sampledWei = interpWeights;
+            par_conv.sampledCoords = sampledCoords;
+            par_conv.filt = &weights[g * jcp.nb_oc * jcp.nb_ic * jcp.kh * jcp.kw * jcp.ic_block * jcp.oc_block];
+            par_conv.dst = &dst[n * dst_strides[0] + _oc * jcp.oc_block * dst_strides[1] + oh * dst_strides[2]];
+            par_conv.buf = input_buffer_ptr + ithr * jcp.ur_w * jcp.kh * jcp.kw * jcp.ic;
 
-        (*def_conv_kernel)(&par_conv);
+            par_conv.oh_pos = oh;
+
+            (*def_conv_kernel)(&par_conv);
+        }
     });
 }
 
@@ -1066,11 +1092,10 @@ void MKLDNNDeformableConvolutionNode::execute(mkldnn::stream strm) {
         modulation_strides = getParentEdgeAt(3)->getMemory().GetDescWithType<BlockedMemoryDesc>()->getStrides();
     }
 
-    prepareSamplingWeights(src_strides, offsets, off_strides, modulation, modulation_strides);
-
     if (def_conv_kernel) {
-        executeOptimized(src, weights, dst, src_strides, dst_strides);
+        executeOptimized(src, weights, dst, src_strides, dst_strides, offsets, off_strides, modulation, modulation_strides);
     } else {
+        prepareSamplingWeights(src_strides, offsets, off_strides, modulation, modulation_strides);
         executeReference(src, weights, dst, src_strides, wei_strides, dst_strides);
     }
 }
@@ -1082,5 +1107,3 @@ bool MKLDNNDeformableConvolutionNode::created() const {
 InferenceEngine::Precision MKLDNNDeformableConvolutionNode::getRuntimePrecision() const {
     return getMaxPrecision(getInputPrecisions());
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNDeformableConvolutionNode, DeformableConvolution);
\ No newline at end of file
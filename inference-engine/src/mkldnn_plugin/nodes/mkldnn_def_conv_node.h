@@ -101,13 +101,18 @@ private:
 
     std::shared_ptr<jit_uni_def_conv_kernel> def_conv_kernel = nullptr;
 
+    void computeSampledPoints(int mb, int dg, int oh, int ow, int* sampledCoords, float* interpWeights,
+                              const std::vector<size_t>& src_strides, const float* offsets, const std::vector<size_t>& off_strides,
+                              const float* modulation, const std::vector<size_t>& modulation_strides) const;
     void prepareSamplingWeights(const std::vector<size_t>& src_strides, const float* offsets, const std::vector<size_t>& off_strides,
                                 const float* modulation = nullptr, const std::vector<size_t>& modulation_strides = {});
 
     void executeReference(const float* src, const float* weights, float* dst, const std::vector<size_t>& src_strides,
                           const std::vector<size_t>& wei_strides, const std::vector<size_t>& dst_strides);
     void executeOptimized(const float* src, const float* weights, float* dst,
-                          const std::vector<size_t>& src_strides, const std::vector<size_t>& dst_strides);
+                          const std::vector<size_t>& src_strides, const std::vector<size_t>& dst_strides,
+                          const float* offsets, const std::vector<size_t>& off_strides,
+                          const float* modulation, const std::vector<size_t>& modulation_strides);
 };
 
 }  // namespace MKLDNNPlugin
@@ -262,4 +262,3 @@ void MKLDNNDepthToSpaceNode::execute(mkldnn::stream strm) {
 bool MKLDNNDepthToSpaceNode::created() const {
     return getType() == DepthToSpace;
 }
-REG_MKLDNN_PRIM_FOR(MKLDNNDepthToSpaceNode, DepthToSpace);
@@ -10,6 +10,7 @@
 #include <ngraph/op/detection_output.hpp>
 #include "ie_parallel.hpp"
 #include "mkldnn_detection_output_node.h"
+#include "utils/general_utils.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -254,30 +255,30 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
     }
 
     // NMS
-    for (int n = 0; n < imgNum; ++n) {
-        if (!decreaseClassId) {
-            // Caffe style
-            parallel_for(classesNum, [&](int c) {
-                if (c != backgroundClassId) {  // Ignore background class
-                    int *pindices    = indicesData + n * classesNum * priorsNum + c * priorsNum;
-                    int *pbuffer     = indicesBufData + n * classesNum * priorsNum + c * priorsNum;
-                    int *pdetections = detectionsData + n * classesNum + c;
-
-                    const float *pboxes;
-                    const float *psizes;
-                    if (isShareLoc) {
-                        pboxes = decodedBboxesData + n * 4 * priorsNum;
-                        psizes = bboxSizesData + n * priorsNum;
-                    } else {
-                        pboxes = decodedBboxesData + n * 4 * classesNum * priorsNum + c * 4 * priorsNum;
-                        psizes = bboxSizesData + n * classesNum * priorsNum + c * priorsNum;
-                    }
-
-                    NMSCF(pbuffer, *pdetections, pindices, pboxes, psizes);
+    if (!decreaseClassId) {
+        // Caffe style
+        parallel_for2d(imgNum, classesNum, [&](int n, int c) {
+            if (c != backgroundClassId) {  // Ignore background class
+                int *pindices    = indicesData + n * classesNum * priorsNum + c * priorsNum;
+                int *pbuffer     = indicesBufData + n * classesNum * priorsNum + c * priorsNum;
+                int *pdetections = detectionsData + n * classesNum + c;
+
+                const float *pboxes;
+                const float *psizes;
+                if (isShareLoc) {
+                    pboxes = decodedBboxesData + n * 4 * priorsNum;
+                    psizes = bboxSizesData + n * priorsNum;
+                } else {
+                    pboxes = decodedBboxesData + n * 4 * classesNum * priorsNum + c * 4 * priorsNum;
+                    psizes = bboxSizesData + n * classesNum * priorsNum + c * priorsNum;
                 }
-            });
-        } else {
-            // MXNet style
+
+                NMSCF(pbuffer, *pdetections, pindices, pboxes, psizes);
+            }
+        });
+    } else {
+        // MXNet style
+        parallel_for(imgNum, [&](int n) {
             int *pbuffer = indicesBufData + n * classesNum * priorsNum;
             int *pdetections = detectionsData + n * classesNum;
             int *pindices = indicesData + n * classesNum * priorsNum;
@@ -285,34 +286,34 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
             const float *psizes = bboxSizesData + n * locNumForClasses * priorsNum;
 
             NMSMX(pbuffer, pdetections, pindices, pboxes, psizes);
-        }
-
-        int detectionsTotal = 0;
-        detectionsTotal = parallel_sum(classesNum, detectionsTotal, [&](size_t c)->int {
-            return detectionsData[n * classesNum + c];
         });
+    }
 
-        // combine detections of all class for this image and filter with global(image) topk(keep_topk)
-        if (keepTopK > -1 && detectionsTotal > keepTopK) {
-            std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap;
+    // combine detections of all class for each image and filter with global(image) topk(keep_topk)
+    if (keepTopK > -1) {
+        parallel_for(imgNum, [&](int n) {
+            int detectionsTotal = 0;
+            for (int c = 0; c < classesNum; ++c)
+                detectionsTotal += detectionsData[n * classesNum + c];
+            if (detectionsTotal <= keepTopK)
+                return;
 
-            std::mutex mtx;
-            parallel_for(classesNum, [&](int c) {
+            std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap;
+            confIndicesClassMap.reserve(detectionsTotal);
+            for (int c = 0; c < classesNum; ++c) {
                 int detections = detectionsData[n * classesNum + c];
                 int *pindices = indicesData + n * classesNum * priorsNum + c * priorsNum;
-
                 float *pconf  = reorderedConfData + n * classesNum * confInfoLen + c * confInfoLen;
 
                 for (int i = 0; i < detections; ++i) {
                     int pr = pindices[i];
-                    mtx.lock();
                     confIndicesClassMap.push_back(std::make_pair(pconf[pr], std::make_pair(c, pr)));
-                    mtx.unlock();
                 }
-            });
+            }
 
-            std::sort(confIndicesClassMap.begin(), confIndicesClassMap.end(),
-                      SortScorePairDescend<std::pair<int, int>>);
+            // only keep_topk best detections are ordered, the rest are dropped
+            std::partial_sort(confIndicesClassMap.begin(), confIndicesClassMap.begin() + keepTopK, confIndicesClassMap.end(),
+                              SortScorePairDescend<std::pair<int, int>>);
             confIndicesClassMap.resize(keepTopK);
 
             // Store the new indices. Assign to class back
@@ -325,7 +326,7 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
                 pindices[detectionsData[n * classesNum + cls]] = pr;
                 detectionsData[n * classesNum + cls]++;
             }
-        }
+        });
     }
 
     // get final output
@@ -624,87 +625,127 @@ inline void MKLDNNDetectionOutputNode::decodeBBoxes(const float *priorData,
     if (isSparsityWorthwhile && !isShareLoc && !decreaseClassId && confInfoH[priorsNum] == 0) {
         return;
     }
-    parallel_for(prNum, [&](int p) {
-        if (isSparsityWorthwhile && isShareLoc && confInfoV[p] == -1) {
-            return;
+    // priors are decoded by blocks: coordinates of the priors to decode are gathered to separate arrays,
+    // so the math below is done by simple loops over contiguous data which are vectorized
+    constexpr int blockSize = 64;
+    parallel_for(div_up(prNum, blockSize), [&](int block) {
+        int priors[blockSize];
+        float prior[4][blockSize];
+        float loc[4][blockSize];
+        float variance[4][blockSize];
+        float bbox[4][blockSize];
+
+        const int blockEnd = (std::min)((block + 1) * blockSize, prNum);
+        int count = 0;
+        for (int p = block * blockSize; p < blockEnd; ++p) {
+            if (isSparsityWorthwhile && isShareLoc && confInfoV[p] == -1)
+                continue;
+            priors[count++] = p;
         }
-        float newXMin = 0.0f;
-        float newYMin = 0.0f;
-        float newXMax = 0.0f;
-        float newYMax = 0.0f;
 
-        float priorXMin = priorData[p * priorSize + 0 + offs];
-        float priorYMin = priorData[p * priorSize + 1 + offs];
-        float priorXMax = priorData[p * priorSize + 2 + offs];
-        float priorYMax = priorData[p * priorSize + 3 + offs];
+        for (int i = 0; i < count; ++i) {
+            const int p = priors[i];
+            for (int k = 0; k < 4; ++k) {
+                prior[k][i] = priorData[p * priorSize + k + offs];
+                loc[k][i] = locData[4 * p * locNumForClasses + k];
+            }
+        }
+        if (!varianceEncodedInTarget) {
+            for (int i = 0; i < count; ++i) {
+                for (int k = 0; k < 4; ++k)
+                    variance[k][i] = varianceData[priors[i] * 4 + k];
+            }
+        }
 
-        float locXMin = locData[4 * p * locNumForClasses + 0];
-        float locYMin = locData[4 * p * locNumForClasses + 1];
-        float locXMax = locData[4 * p * locNumForClasses + 2];
-        float locYMax = locData[4 * p * locNumForClasses + 3];
+        float* priorXMin = prior[0];
+        float* priorYMin = prior[1];
+        float* priorXMax = prior[2];
+        float* priorYMax = prior[3];
+        const float* locXMin = loc[0];
+        const float* locYMin = loc[1];
+        const float* locXMax = loc[2];
+        const float* locYMax = loc[3];
+        float* newXMin = bbox[0];
+        float* newYMin = bbox[1];
+        float* newXMax = bbox[2];
+        float* newYMax = bbox[3];
 
         if (!normalized) {
-            priorXMin /= imgWidth;
-            priorYMin /= imgHeight;
-            priorXMax /= imgWidth;
-            priorYMax /= imgHeight;
+            for (int i = 0; i < count; ++i) {
+                priorXMin[i] /= imgWidth;
+                priorYMin[i] /= imgHeight;
+                priorXMax[i] /= imgWidth;
+                priorYMax[i] /= imgHeight;
+            }
         }
 
         if (codeType == CodeType::CORNER) {
             if (varianceEncodedInTarget) {
                 // variance is encoded in target, we simply need to add the offset predictions.
-                newXMin = priorXMin + locXMin;
-                newYMin = priorYMin + locYMin;
-                newXMax = priorXMax + locXMax;
-                newYMax = priorYMax + locYMax;
+                for (int i = 0; i < count; ++i) {
+                    newXMin[i] = priorXMin[i] + locXMin[i];
+                    newYMin[i] = priorYMin[i] + locYMin[i];
+                    newXMax[i] = priorXMax[i] + locXMax[i];
+                    newYMax[i] = priorYMax[i] + locYMax[i];
+                }
             } else {
-                newXMin = priorXMin + varianceData[p * 4 + 0] * locXMin;
-                newYMin = priorYMin + varianceData[p * 4 + 1] * locYMin;
-                newXMax = priorXMax + varianceData[p * 4 + 2] * locXMax;
-                newYMax = priorYMax + varianceData[p * 4 + 3] * locYMax;
+                for (int i = 0; i < count; ++i) {
+                    newXMin[i] = priorXMin[i] + variance[0][i] * locXMin[i];
+                    newYMin[i] = priorYMin[i] + variance[1][i] * locYMin[i];
+                    newXMax[i] = priorXMax[i] + variance[2][i] * locXMax[i];
+                    newYMax[i] = priorYMax[i] + variance[3][i] * locYMax[i];
+                }
             }
         } else if (codeType == CodeType::CENTER_SIZE) {
-            float priorWidth    =  priorXMax - priorXMin;
-            float priorHeight   =  priorYMax - priorYMin;
-            float priorCenterX = (priorXMin + priorXMax) / 2.0f;
-            float priorCenterY = (priorYMin + priorYMax) / 2.0f;
-
-            float decodeBboxCenterX, decodeBboxCenterY;
-            float decodeBboxWidth, decodeBboxHeight;
+            for (int i = 0; i < count; ++i) {
+                float priorWidth    =  priorXMax[i] - priorXMin[i];
+                float priorHeight   =  priorYMax[i] - priorYMin[i];
+                float priorCenterX = (priorXMin[i] + priorXMax[i]) / 2.0f;
+                float priorCenterY = (priorYMin[i] + priorYMax[i]) / 2.0f;
+
+                float decodeBboxCenterX, decodeBboxCenterY;
+                float decodeBboxWidth, decodeBboxHeight;
+
+                if (varianceEncodedInTarget) {
+                    // variance is encoded in target, we simply need to restore the offset predictions.
+                    decodeBboxCenterX = locXMin[i] * priorWidth  + priorCenterX;
+                    decodeBboxCenterY = locYMin[i] * priorHeight + priorCenterY;
+                    decodeBboxWidth  = std::exp(locXMax[i]) * priorWidth;
+                    decodeBboxHeight = std::exp(locYMax[i]) * priorHeight;
+                } else {
+                    // variance is encoded in bbox, we need to scale the offset accordingly.
+                    decodeBboxCenterX = variance[0][i] * locXMin[i] * priorWidth + priorCenterX;
+                    decodeBboxCenterY = variance[1][i] * locYMin[i] * priorHeight + priorCenterY;
+                    decodeBboxWidth    = std::exp(variance[2][i] * locXMax[i]) * priorWidth;
+                    decodeBboxHeight   = std::exp(variance[3][i] * locYMax[i]) * priorHeight;
+                }
 
-            if (varianceEncodedInTarget) {
-                // variance is encoded in target, we simply need to restore the offset predictions.
-                decodeBboxCenterX = locXMin * priorWidth  + priorCenterX;
-                decodeBboxCenterY = locYMin * priorHeight + priorCenterY;
-                decodeBboxWidth  = std::exp(locXMax) * priorWidth;
-                decodeBboxHeight = std::exp(locYMax) * priorHeight;
-            } else {
-                // variance is encoded in bbox, we need to scale the offset accordingly.
-                decodeBboxCenterX = varianceData[p*4 + 0] * locXMin * priorWidth + priorCenterX;
-                decodeBboxCenterY = varianceData[p*4 + 1] * locYMin * priorHeight + priorCenterY;
-                decodeBboxWidth    = std::exp(varianceData[p*4 + 2] * locXMax) * priorWidth;
-                decodeBboxHeight   = std::exp(varianceData[p*4 + 3] * locYMax) * priorHeight;
+                newXMin[i] = decodeBboxCenterX - decodeBboxWidth  / 2.0f;
+                newYMin[i] = decodeBboxCenterY - decodeBboxHeight / 2.0f;
+                newXMax[i] = decodeBboxCenterX + decodeBboxWidth  / 2.0f;
+                newYMax[i] = decodeBboxCenterY + decodeBboxHeight / 2.0f;
             }
-
-            newXMin = decodeBboxCenterX - decodeBboxWidth  / 2.0f;
-            newYMin = decodeBboxCenterY - decodeBboxHeight / 2.0f;
-            newXMax = decodeBboxCenterX + decodeBboxWidth  / 2.0f;
-            newYMax = decodeBboxCenterY + decodeBboxHeight / 2.0f;
+        } else {
+            for (int k = 0; k < 4; ++k)
+                std::fill_n(bbox[k], count, 0.0f);
         }
 
         if (clipBeforeNMS) {
-            newXMin = (std::max)(0.0f, (std::min)(1.0f, newXMin));
-            newYMin = (std::max)(0.0f, (std::min)(1.0f, newYMin));
-            newXMax = (std::max)(0.0f, (std::min)(1.0f, newXMax));
-            newYMax = (std::max)(0.0f, (std::min)(1.0f, newYMax));
+            for (int k = 0; k < 4; ++k) {
+                for (int i = 0; i < count; ++i)
+                    bbox[k][i] = (std::max)(0.0f, (std::min)(1.0f, bbox[k][i]));
+            }
         }
 
-        decodedBboxes[p*4 + 0] = newXMin;
-        decodedBboxes[p*4 + 1] = newYMin;
-        decodedBboxes[p*4 + 2] = newXMax;
-        decodedBboxes[p*4 + 3] = newYMax;
+        for (int i = 0; i < count; ++i) {
+            const int p = priors[i];
+            decodedBboxes[p*4 + 0] = newXMin[i];
+            decodedBboxes[p*4 + 1] = newYMin[i];
+            decodedBboxes[p*4 + 2] = newXMax[i];
+            decodedBboxes[p*4 + 3] = newYMax[i];
 
-        decodedBboxSizes[p] = (newXMax - newXMin) * (newYMax - newYMin);
+            decodedBboxSizes[p] = (newXMax[i] - newXMin[i]) * (newYMax[i] - newYMin[i]);
+        }
     });
 }
 
@@ -889,5 +930,3 @@ inline void MKLDNNDetectionOutputNode::generateOutput(float* reorderedConfData,
 bool MKLDNNDetectionOutputNode::created() const {
     return getType() == DetectionOutput;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNDetectionOutputNode, DetectionOutput)
@@ -4,7 +4,9 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
 #include <cmath>
+#include <memory>
 #include <mkldnn_extension_utils.h>
 
 #include "mkldnn_dft_node.h"
@@ -72,6 +74,10 @@ MKLDNNDFTNode::MKLDNNDFTNode(const std::shared_ptr<ngraph::Node>& op, const mkld
     }
 
     inverse = std::dynamic_pointer_cast<ngraph::opset7::DFT>(op) == nullptr;
+
+    if (const auto axesConst = std::dynamic_pointer_cast<const ngraph::opset7::Constant>(op->get_input_node_shared_ptr(AXES_INDEX))) {
+        constAxes = axesConst->cast_vector<int64_t>();
+    }
 }
 
 void MKLDNNDFTNode::getSupportedDescriptors() {}
@@ -114,6 +120,113 @@ inline float getImaginaryFromComplexProd(float lhsReal, float lhsImag, float rhs
     return lhsReal * rhsImag + lhsImag * rhsReal;
 }
 
+constexpr size_t parallelFFTLength = 4096;
+constexpr size_t butterfliesChunk = 64;
+constexpr double pi = 3.141592653589793238462643;
+
+/*
+    Butterflies of the small DFTs, sign is the sign of the exponent: -1 for the forward transform and 1 for the inverse one.
+    Multiplication by i * sign: (x + iy) * i * sign = -sign * y + i * sign * x
+*/
+template <size_t R>
+inline void butterfly(float* re, float* im, float sign);
+
+template <>
+inline void butterfly<2>(float* re, float* im, float) {
+    const float re1 = re[1], im1 = im[1];
+    re[1] = re[0] - re1;
+    im[1] = im[0] - im1;
+    re[0] += re1;
+    im[0] += im1;
+}
+
+template <>
+inline void butterfly<3>(float* re, float* im, float sign) {
+    constexpr float cos120 = -0.5f;
+    constexpr float sin120 = 0.866025403784438646763723f;
+    const float sumRe = re[1] + re[2], sumIm = im[1] + im[2];
+    const float diffRe = (re[1] - re[2]) * sin120 * sign, diffIm = (im[1] - im[2]) * sin120 * sign;
+    const float midRe = re[0] + cos120 * sumRe, midIm = im[0] + cos120 * sumIm;
+    re[0] += sumRe;
+    im[0] += sumIm;
+    re[1] = midRe - diffIm;
+    im[1] = midIm + diffRe;
+    re[2] = midRe + diffIm;
+    im[2] = midIm - diffRe;
+}
+
+template <>
+inline void butterfly<4>(float* re, float* im, float sign) {
+    const float t0Re = re[0] + re[2], t0Im = im[0] + im[2];
+    const float t1Re = re[0] - re[2], t1Im = im[0] - im[2];
+    const float t2Re = re[1] + re[3], t2Im = im[1] + im[3];
+    const float t3Re = (re[1] - re[3]) * sign, t3Im = (im[1] - im[3]) * sign;
+    re[0] = t0Re + t2Re;
+    im[0] = t0Im + t2Im;
+    re[2] = t0Re - t2Re;
+    im[2] = t0Im - t2Im;
+    re[1] = t1Re - t3Im;
+    im[1] = t1Im + t3Re;
+    re[3] = t1Re + t3Im;
+    im[3] = t1Im - t3Re;
+}
+
+template <>
+inline void butterfly<5>(float* re, float* im, float sign) {
+    constexpr float cos72 = 0.309016994374947424102293f;
+    constexpr float cos144 = -0.809016994374947424102293f;
+    constexpr float sin72 = 0.951056516295153572116439f;
+    constexpr float sin144 = 0.587785252292473129168706f;
+    const float sum1Re = re[1] + re[4], sum1Im = im[1] + im[4];
+    const float sum2Re = re[2] + re[3], sum2Im = im[2] + im[3];
+    const float diff1Re = (re[1] - re[4]) * sign, diff1Im = (im[1] - im[4]) * sign;
+    const float diff2Re = (re[2] - re[3]) * sign, diff2Im = (im[2] - im[3]) * sign;
+    const float mid1Re = re[0] + cos72 * sum1Re + cos144 * sum2Re, mid1Im = im[0] + cos72 * sum1Im + cos144 * sum2Im;
+    const float mid2Re = re[0] + cos144 * sum1Re + cos72 * sum2Re, mid2Im = im[0] + cos144 * sum1Im + cos72 * sum2Im;
+    const float rot1Re = sin72 * diff1Re + sin144 * diff2Re, rot1Im = sin72 * diff1Im + sin144 * diff2Im;
+    const float rot2Re = sin144 * diff1Re - sin72 * diff2Re, rot2Im = sin144 * diff1Im - sin72 * diff2Im;
+    re[0] += sum1Re + sum2Re;
+    im[0] += sum1Im + sum2Im;
+    re[1] = mid1Re - rot1Im;
+    im[1] = mid1Im + rot1Re;
+    re[4] = mid1Re + rot1Im;
+    im[4] = mid1Im - rot1Re;
+    re[2] = mid2Re - rot2Im;
+    im[2] = mid2Im + rot2Re;
+    re[3] = mid2Re + rot2Im;
+    im[3] = mid2Im - rot2Re;
+}
+
+/*
+    One pass of the Stockham autosort FFT for the butterflies [kBegin, kEnd) of the block.
+    The data is in the split format, so the loop over k accesses all the arrays with unit stride and is vectorized.
+*/
+template <size_t R>
+void butterflies(const float* srcRe, const float* srcIm, float* dstRe, float* dstIm, const float* twiddlesRe, const float* twiddlesIm,
+                 size_t length, size_t stride, size_t block, size_t kBegin, size_t kEnd, float sign) {
+    const size_t srcStep = length / R;
+    srcRe += block * stride;
+    srcIm += block * stride;
+    dstRe += block * stride * R;
+    dstIm += block * stride * R;
+    for (size_t k = kBegin; k < kEnd; ++k) {
+        float re[R], im[R];
+        re[0] = srcRe[k];
+        im[0] = srcIm[k];
+        for (size_t r = 1; r < R; ++r) {
+            const float xRe = srcRe[k + r * srcStep], xIm = srcIm[k + r * srcStep];
+            const float wRe = twiddlesRe[(r - 1) * stride + k], wIm = twiddlesIm[(r - 1) * stride + k];
+            re[r] = getRealFromComplexProd(xRe, xIm, wRe, wIm);
+            im[r] = getImaginaryFromComplexProd(xRe, xIm, wRe, wIm);
+        }
+        butterfly<R>(re, im, sign);
+        for (size_t r = 0; r < R; ++r) {
+            dstRe[k + r * stride] = re[r];
+            dstIm[k + r * stride] = im[r];
+        }
+    }
+}
+
 /*
     Returns true while we can iterate
     Specified axis is skipped in counters   
@@ -138,10 +251,6 @@ inline bool nextIterationStep(std::vector<size_t>& counters, const std::vector<s
     return false;
 }
 
-inline bool IsPowerOfTwo(size_t n) {
-    return (n != 0) && (n & (n - 1)) == 0;
-}
-
 inline bool copyStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange) {
     auto itCounter = counters.rbegin();
     auto itWork = iterationRange.rbegin();
@@ -165,26 +274,26 @@ size_t calculateOffsetFromStrides(const std::vector<size_t>& coords, const std::
     return offset;
 }
 
-void gatherToBufferND(float* buffer, const float* data, size_t axis, const std::vector<size_t>& dimIndexes,
-                                     const std::vector<size_t>& shape, const std::vector<size_t>& strides) {
+void gatherToBufferND(float* bufferRe, float* bufferIm, const float* data, size_t axis, const std::vector<size_t>& dimIndexes,
+                      const std::vector<size_t>& shape, const std::vector<size_t>& strides) {
     size_t numberOfComplex = shape[axis];
     size_t offset = calculateOffsetFromStrides(dimIndexes, strides);
 
-    for (size_t bufferIndex = 0; bufferIndex < 2 * numberOfComplex; bufferIndex += 2) {
-        buffer[bufferIndex] = data[offset];
-        buffer[bufferIndex + 1] = data[offset + 1];
+    for (size_t bufferIndex = 0; bufferIndex < numberOfComplex; ++bufferIndex) {
+        bufferRe[bufferIndex] = data[offset];
+        bufferIm[bufferIndex] = data[offset + 1];
         offset += strides[axis];
     }
 }
 
-void applyBufferND(const float* buffer, float* output, size_t axis, const std::vector<size_t>& dimIndexes,
-                                  const std::vector<size_t>& shape, const std::vector<size_t>& strides) {
+void applyBufferND(const float* bufferRe, const float* bufferIm, float* output, size_t axis, const std::vector<size_t>& dimIndexes,
+                   const std::vector<size_t>& shape, const std::vector<size_t>& strides) {
     size_t numberOfComplex = shape[axis];
     size_t offset = calculateOffsetFromStrides(dimIndexes, strides);
 
-    for (size_t bufferIndex = 0; bufferIndex < 2 * numberOfComplex; bufferIndex += 2) {
-        output[offset] = buffer[bufferIndex];
-        output[offset + 1] = buffer[bufferIndex + 1];
+    for (size_t bufferIndex = 0; bufferIndex < numberOfComplex; ++bufferIndex) {
+        output[offset] = bufferRe[bufferIndex];
+        output[offset + 1] = bufferIm[bufferIndex];
         offset += strides[axis];
     }
 }
@@ -226,6 +335,157 @@ void copyDataToOutputWithSignalSize(const float* input, const std::vector<size_t
 
 } // namespace
 
+/*
+    Precomputed transform of the fixed length and direction.
+    The lengths with the factors 2, 3, 4 and 5 only are transformed with the mixed-radix Stockham FFT,
+    other lengths are reduced to the convolution of the power-of-two length (Bluestein's algorithm).
+    The transform is not normalized.
+*/
+struct MKLDNNDFTNode::FFTPlan {
+    struct Stage {
+        size_t radix;
+        size_t stride;  // the product of the radices of the previous stages
+        std::vector<float> twiddlesRe;  // (radix - 1) x stride
+        std::vector<float> twiddlesIm;
+    };
+
+    size_t length = 0;
+    float sign = -1.0f;
+    std::vector<Stage> stages;
+
+    // Bluestein's algorithm
+    std::vector<float> chirpRe, chirpIm;                    // exp(sign * i * pi * n^2 / length)
+    std::vector<float> kernelSpectrumRe, kernelSpectrumIm;  // spectrum of the conjugated chirp divided by the convolution length
+    std::shared_ptr<FFTPlan> forwardConvolution, inverseConvolution;
+
+    static std::shared_ptr<FFTPlan> create(size_t length, bool inverse) {
+        auto plan = std::make_shared<FFTPlan>();
+        plan->length = length;
+        plan->sign = inverse ? 1.0f : -1.0f;
+
+        std::vector<size_t> radices;
+        size_t rest = length;
+        for (size_t radix : {4, 2, 3, 5}) {
+            while (rest % radix == 0) {
+                radices.push_back(radix);
+                rest /= radix;
+            }
+        }
+
+        if (rest == 1) {
+            size_t stride = 1;
+            for (size_t radix : radices) {
+                Stage stage{radix, stride, std::vector<float>((radix - 1) * stride), std::vector<float>((radix - 1) * stride)};
+                for (size_t r = 1; r < radix; ++r) {
+                    for (size_t k = 0; k < stride; ++k) {
+                        const double phase = 2.0 * pi * static_cast<double>(r * k) / static_cast<double>(stride * radix);
+                        stage.twiddlesRe[(r - 1) * stride + k] = static_cast<float>(std::cos(phase));
+                        stage.twiddlesIm[(r - 1) * stride + k] = static_cast<float>(plan->sign * std::sin(phase));
+                    }
+                }
+                plan->stages.push_back(std::move(stage));
+                stride *= radix;
+            }
+            return plan;
+        }
+
+        size_t convolutionLength = 1;
+        while (convolutionLength < 2 * length - 1)
+            convolutionLength *= 2;
+        plan->forwardConvolution = create(convolutionLength, false);
+        plan->inverseConvolution = create(convolutionLength, true);
+
+        plan->chirpRe.resize(length);
+        plan->chirpIm.resize(length);
+        for (size_t n = 0; n < length; ++n) {
+            // n^2 mod 2 * length keeps the phase accurate for the long signals
+            const double phase = pi * static_cast<double>((static_cast<uint64_t>(n) * n) % (2 * length)) / static_cast<double>(length);
+            plan->chirpRe[n] = static_cast<float>(std::cos(phase));
+            plan->chirpIm[n] = static_cast<float>(plan->sign * std::sin(phase));
+        }
+
+        plan->kernelSpectrumRe.assign(convolutionLength, 0.0f);
+        plan->kernelSpectrumIm.assign(convolutionLength, 0.0f);
+        for (size_t n = 0; n < length; ++n) {
+            const float scale = 1.0f / static_cast<float>(convolutionLength);
+            plan->kernelSpectrumRe[n] = plan->chirpRe[n] * scale;
+            plan->kernelSpectrumIm[n] = -plan->chirpIm[n] * scale;
+            if (n != 0) {
+                plan->kernelSpectrumRe[convolutionLength - n] = plan->kernelSpectrumRe[n];
+                plan->kernelSpectrumIm[convolutionLength - n] = plan->kernelSpectrumIm[n];
+            }
+        }
+        plan->forwardConvolution->transform(plan->kernelSpectrumRe.data(), plan->kernelSpectrumIm.data(), false);
+        return plan;
+    }
+
+    void transform(float* re, float* im, bool parallelize) const {
+        if (!stages.empty()) {
+            transformMixedRadix(re, im, parallelize);
+        } else if (forwardConvolution) {
+            transformBluestein(re, im, parallelize);
+        }
+    }
+
+private:
+    void transformMixedRadix(float* re, float* im, bool parallelize) const {
+        std::vector<float> buffer(2 * length);
+        float* srcRe = re;
+        float* srcIm = im;
+        float* dstRe = buffer.data();
+        float* dstIm = buffer.data() + length;
+        for (const auto& stage : stages) {
+            const size_t blocks = length / (stage.radix * stage.stride);
+            const size_t chunks = div_up(stage.stride, butterfliesChunk);
+            auto run = [&](size_t block, size_t chunk) {
+                const size_t kBegin = chunk * butterfliesChunk;
+                const size_t kEnd = std::min(stage.stride, kBegin + butterfliesChunk);
+                const float* twRe = stage.twiddlesRe.data();
+                const float* twIm = stage.twiddlesIm.data();
+                switch (stage.radix) {
+                    case 2: butterflies<2>(srcRe, srcIm, dstRe, dstIm, twRe, twIm, length, stage.stride, block, kBegin, kEnd, sign); break;
+                    case 3: butterflies<3>(srcRe, srcIm, dstRe, dstIm, twRe, twIm, length, stage.stride, block, kBegin, kEnd, sign); break;
+                    case 4: butterflies<4>(srcRe, srcIm, dstRe, dstIm, twRe, twIm, length, stage.stride, block, kBegin, kEnd, sign); break;
+                    case 5: butterflies<5>(srcRe, srcIm, dstRe, dstIm, twRe, twIm, length, stage.stride, block, kBegin, kEnd, sign); break;
+                }
+            };
+            if (parallelize && length >= parallelFFTLength) {
+                parallel_for2d(blocks, chunks, run);
+            } else {
+                for (size_t block = 0; block < blocks; ++block)
+                    for (size_t chunk = 0; chunk < chunks; ++chunk)
+                        run(block, chunk);
+            }
+            std::swap(srcRe, dstRe);
+            std::swap(srcIm, dstIm);
+        }
+        if (srcRe != re) {
+            std::copy_n(srcRe, length, re);
+            std::copy_n(srcIm, length, im);
+        }
+    }
+
+    void transformBluestein(float* re, float* im, bool parallelize) const {
+        const size_t convolutionLength = forwardConvolution->length;
+        std::vector<float> convolutionRe(convolutionLength, 0.0f), convolutionIm(convolutionLength, 0.0f);
+        for (size_t n = 0; n < length; ++n) {
+            convolutionRe[n] = getRealFromComplexProd(re[n], im[n], chirpRe[n], chirpIm[n]);
+            convolutionIm[n] = getImaginaryFromComplexProd(re[n], im[n], chirpRe[n], chirpIm[n]);
+        }
+        forwardConvolution->transform(convolutionRe.data(), convolutionIm.data(), parallelize);
+        for (size_t k = 0; k < convolutionLength; ++k) {
+            const float xRe = convolutionRe[k], xIm = convolutionIm[k];
+            convolutionRe[k] = getRealFromComplexProd(xRe, xIm, kernelSpectrumRe[k], kernelSpectrumIm[k]);
+            convolutionIm[k] = getImaginaryFromComplexProd(xRe, xIm, kernelSpectrumRe[k], kernelSpectrumIm[k]);
+        }
+        inverseConvolution->transform(convolutionRe.data(), convolutionIm.data(), parallelize);
+        for (size_t k = 0; k < length; ++k) {
+            re[k] = getRealFromComplexProd(convolutionRe[k], convolutionIm[k], chirpRe[k], chirpIm[k]);
+            im[k] = getImaginaryFromComplexProd(convolutionRe[k], convolutionIm[k], chirpRe[k], chirpIm[k]);
+        }
+    }
+};
+
 void MKLDNNDFTNode::execute(mkldnn::stream strm) {
     auto axesEdge = getParentEdgeAt(AXES_INDEX);
     const auto* axesStartPtr = reinterpret_cast<const int32_t*>(axesEdge->getMemoryPtr()->GetPtr());
@@ -239,11 +499,7 @@ void MKLDNNDFTNode::execute(mkldnn::stream strm) {
 
     outputShape = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
     for (size_t axis : axes) {
-        size_t nComplex = outputShape[axis];
-        // FFT uses different twiddle factors
-        if (twiddlesMap.find(nComplex) == twiddlesMap.end() && !IsPowerOfTwo(nComplex)) {
-            twiddlesMap[nComplex] = generateTwiddles(nComplex);
-        }
+        prepareFFTPlan(outputShape[axis]);
     }
 
     auto inputDataEdge = getParentEdgeAt(DATA_INDEX);
@@ -263,10 +519,17 @@ void MKLDNNDFTNode::execute(mkldnn::stream strm) {
     // 1d case
     if (inputDataEdge->getMemory().GetShape().getRank() == 2) {
         size_t nComplex = outputShape[0];
-        if (IsPowerOfTwo(nComplex)) {
-            fft(output, nComplex * 2, true);
-        } else {
-            naiveDFT(output, nComplex * 2);
+        std::vector<float> buffer(nComplex * 2);
+        float* bufferRe = buffer.data();
+        float* bufferIm = buffer.data() + nComplex;
+        for (size_t n = 0; n < nComplex; ++n) {
+            bufferRe[n] = output[2 * n];
+            bufferIm[n] = output[2 * n + 1];
+        }
+        transform(bufferRe, bufferIm, nComplex, true);
+        for (size_t n = 0; n < nComplex; ++n) {
+            output[2 * n] = bufferRe[n];
+            output[2 * n + 1] = bufferIm[n];
         }
     } else {
         dftNd(output, outputStrides);
@@ -282,143 +545,54 @@ void MKLDNNDFTNode::dftNd(float* output, const std::vector<size_t>& outputStride
         const size_t outputLen = outputComplexLen * 2;
 
         std::vector<size_t> iterationCounter(iterationRange.size(), 0);
-        if (IsPowerOfTwo(outputComplexLen)) {
-            size_t parallelDimIndex = lastDimIndex == currentAxis ? lastDimIndex - 1 : lastDimIndex;
-            do {
-                parallel_for(iterationRange[parallelDimIndex], [&](size_t dim) {
-                    std::vector<float> gatheredData(outputLen);
-                    auto parallelIterationCounter = iterationCounter;
-                    parallelIterationCounter[parallelDimIndex] = dim;
-                    gatherToBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
-                    fft(gatheredData.data(), outputLen);
-                    applyBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
-                });
-                iterationCounter[parallelDimIndex] = iterationRange[parallelDimIndex] - 1;
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
-        } else {
-            std::vector<float> gatheredData(outputLen);
-            do {
-                gatherToBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-                naiveDFT(gatheredData.data(), outputLen);
-                applyBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
-        }
-    }
-}
-
-/* Cooley Tukey implementation of FFT */
-void MKLDNNDFTNode::fft(float* data, int64_t dataLength, bool parallelize) const {
-    static int cacheSizeL3 = utils::get_cache_size(3, false);
-    static int elementsPerCacheLine = cacheSizeL3 / sizeof(float);
-    std::vector<float> bufferVector(dataLength * 2, 0);
-    float* buffer = bufferVector.data();
-    cpu_memcpy(buffer, data, dataLength * sizeof(float));
-
-    size_t nComplex = dataLength / 2;
-    float* inBufferStart = buffer + dataLength;
-    float* outBufferStart = buffer;
-
-    auto blockIteration = [&] (const size_t block, const size_t blockSize, const size_t nextIterationBlockSize, const float anglePart) {
-        float* curInpBufferPtr = inBufferStart + block * blockSize;
-        float* curOutBufferPtr = outBufferStart + block * nextIterationBlockSize;
-
-        const float angle = anglePart * block;
-        const float twiddleReal = std::cos(angle);
-        const float twiddleImag = -std::sin(angle);
-        for (int64_t pair = 0; pair < blockSize / 2; pair += 2) {
-            const float evenReal = curInpBufferPtr[pair];
-            const float evenImag = curInpBufferPtr[pair + 1];
-
-            const float oddReal = curInpBufferPtr[(blockSize / 2 + pair)];
-            const float oddImag = curInpBufferPtr[(blockSize / 2 + pair) + 1];
-
-            const float twiddledOddReal = getRealFromComplexProd(twiddleReal, twiddleImag, oddReal, oddImag);
-            const float twiddledOddImag = getImaginaryFromComplexProd(twiddleReal, twiddleImag, oddReal, oddImag);
-
-            curOutBufferPtr[pair] = evenReal + twiddledOddReal;
-            curOutBufferPtr[pair + 1] = evenImag + twiddledOddImag;
-
-            curOutBufferPtr[nComplex + pair] = evenReal - twiddledOddReal;
-            curOutBufferPtr[nComplex + pair + 1] = evenImag - twiddledOddImag;
-        }
-    };
-
-    for (int64_t numBlocks = 1; numBlocks < nComplex; numBlocks *= 2) {
-        const float anglePart = PI / numBlocks * (inverse ? -1 : 1);
-
-        std::swap(inBufferStart, outBufferStart);
-        const int64_t blockSize = dataLength / numBlocks;
-        const int64_t nextIterationBlockSize = blockSize / 2;
-        if (parallelize && blockSize >= 4 * elementsPerCacheLine) {
-            parallel_for(numBlocks, [&] (const size_t block) {
-                blockIteration(block, blockSize, nextIterationBlockSize, anglePart);
+        size_t parallelDimIndex = lastDimIndex == currentAxis ? lastDimIndex - 1 : lastDimIndex;
+        do {
+            parallel_for(iterationRange[parallelDimIndex], [&](size_t dim) {
+                std::vector<float> gatheredData(outputLen);
+                float* gatheredRe = gatheredData.data();
+                float* gatheredIm = gatheredData.data() + outputComplexLen;
+                auto parallelIterationCounter = iterationCounter;
+                parallelIterationCounter[parallelDimIndex] = dim;
+                gatherToBufferND(gatheredRe, gatheredIm, output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
+                transform(gatheredRe, gatheredIm, outputComplexLen, false);
+                applyBufferND(gatheredRe, gatheredIm, output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
             });
-        } else {
-            for (int64_t block = 0; block < numBlocks; ++block) {
-                blockIteration(block, blockSize, nextIterationBlockSize, anglePart);
-            }
-        }
-    }
-
-    for (int64_t k = 0; k < dataLength; k++) {
-        if (inverse) {
-            outBufferStart[k] /= nComplex;
-        }
-        data[k] = outBufferStart[k];
+            iterationCounter[parallelDimIndex] = iterationRange[parallelDimIndex] - 1;
+        } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
     }
 }
 
-void MKLDNNDFTNode::naiveDFT(float* data, size_t dataLength) const {
-    std::vector<float> outputBuffer(dataLength);
-    const size_t nComplex = dataLength / 2;
-    const auto& twiddles = twiddlesMap.find(nComplex)->second;
-
-    parallel_for(nComplex, [&](size_t k) {
-        float sumReal = 0.0f;
-        float sumImag = 0.0f;
+void MKLDNNDFTNode::transform(float* re, float* im, size_t nComplex, bool parallelize) const {
+    fftPlans.find(nComplex)->second->transform(re, im, parallelize);
+    if (inverse) {
+        const float scale = 1.0f / static_cast<float>(nComplex);
         for (size_t n = 0; n < nComplex; ++n) {
-            auto it = twiddles[k * nComplex + n];
-            float complexReal = it.first;
-            float complexImag = it.second;
-
-            if (inverse) {
-                complexImag *= -1; // conjugate
-            }
-            float complexProdReal = getRealFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-            float complexProdImag = getImaginaryFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-
-            sumReal += complexProdReal;
-            sumImag += complexProdImag;
-        }
-
-        if (inverse) {
-            sumReal /= nComplex;
-            sumImag /= nComplex;
+            re[n] *= scale;
+            im[n] *= scale;
         }
-        outputBuffer[k * 2] = sumReal;
-        outputBuffer[k * 2 + 1] = sumImag;
-    });
-    cpu_memcpy(data, outputBuffer.data(), dataLength * sizeof(float));
+    }
 }
 
-std::vector<std::pair<float, float>> MKLDNNDFTNode::generateTwiddles(size_t n_complex) const {
-    std::vector<std::pair<float, float>> twiddles(n_complex * n_complex);
-    parallel_for(n_complex, [&](const size_t k) {
-        for (size_t n = 0; n < n_complex; ++n) {
-            float phase =  2.0f * PI * static_cast<float>(n * k) / static_cast<float>(n_complex);
-            auto complexReal = std::cos(phase);
-            auto complexImag = -std::sin(phase);
-            twiddles[k * n_complex + n] = std::make_pair(complexReal, complexImag);
-        }
-    });
-    return twiddles;
+void MKLDNNDFTNode::prepareFFTPlan(size_t nComplex) {
+    // the direction is the same for all the transforms of the node, so the plans are cached by the length only
+    if (fftPlans.find(nComplex) == fftPlans.end()) {
+        fftPlans[nComplex] = FFTPlan::create(nComplex, inverse);
+    }
 }
 
 bool MKLDNNDFTNode::created() const {
     return getType() == DFT;
 }
 
-void MKLDNNDFTNode::createPrimitive() {}
-
-
-REG_MKLDNN_PRIM_FOR(MKLDNNDFTNode, DFT)
+void MKLDNNDFTNode::createPrimitive() {
+    // the twiddles are computed once for the constant axes, the plans for other axes are created on the first execution
+    const auto& dims = outputShapes[DATA_INDEX].getStaticDims();
+    for (auto axis : constAxes) {
+        if (axis < 0) {
+            axis += dims.size() - 1;
+        }
+        if (axis >= 0 && axis < static_cast<int64_t>(dims.size()) - 1) {
+            prepareFFTPlan(dims[axis]);
+        }
+    }
+}
@@ -7,6 +7,9 @@
 #include <ie_common.h>
 #include <mkldnn_node.h>
 #include <string>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -25,12 +28,13 @@ public:
 
 private:
     void dftNd(float* output, const std::vector<size_t>& outputStrides) const;
-    void fft(float* data, int64_t dataLength, bool parallelize = false) const;
-    void naiveDFT(float* data, size_t dataLength) const;
+    // transforms the signal given in the split format: real parts followed by imaginary ones
+    void transform(float* re, float* im, size_t nComplex, bool parallelize) const;
+    void prepareFFTPlan(size_t nComplex);
 
-    std::vector<std::pair<float, float>> generateTwiddles(size_t n_complex) const;
-
-    std::unordered_map<size_t, std::vector<std::pair<float, float>>> twiddlesMap;
+    struct FFTPlan;
+    std::unordered_map<size_t, std::shared_ptr<FFTPlan>> fftPlans;
+    std::vector<int64_t> constAxes;
     std::vector<int32_t> axes;
     std::vector<size_t> outputShape;
     std::vector<size_t> inputShape;
@@ -38,7 +42,6 @@ private:
     const size_t DATA_INDEX = 0;
     const size_t AXES_INDEX = 1;
     const size_t SIGNAL_SIZE_INDEX = 2;
-    static constexpr float PI = 3.141592653589793238462643f;
     bool inverse;
 };
 
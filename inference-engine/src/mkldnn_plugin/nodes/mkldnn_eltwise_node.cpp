@@ -452,6 +452,9 @@ private:
             exec_prec
         };
 
+        if (eltwiseNode.isFastMath() && jit_fast_math_emitter::is_supported(eltwiseNode.getAlgorithm()))
+            return std::make_shared<jit_fast_math_emitter>(this, isa, &node, exec_prec);
+
         OV_SWITCH(MKLDNNPlugin, EltwiseEmitter, ctx, eltwiseNode.getAlgorithm(),
         OV_CASE(EltwiseRelu, jit_mkldnn_aux_emitter),
         OV_CASE(EltwiseGelu, jit_mkldnn_aux_emitter),
@@ -1442,7 +1445,22 @@ void MKLDNNEltwiseNode::prepareParams() {
                    [](size_t& offset) { return offset * sizeof(float);});
 
     if (canUseOptimizedImpl) {
-        execPtr = std::make_shared<EltwiseJitExecutor>(jep, *this, schedulerWorkAmount, batchDimIdx);
+        auto builder = [&]() {
+            return std::make_shared<EltwiseJitExecutor>(jep, *this, schedulerWorkAmount, batchDimIdx);
+        };
+        // kernels with fused FakeQuantize keep pointers to the quantization data of the particular node, so they are not shared
+        if (paramsCache && !isFusedWith(FakeQuantize)) {
+            // jit kernel depends only on the node static properties and the input blocked dims
+            std::string key = getName();
+            for (const auto& dims : currentInBlkDims) {
+                key += '|';
+                for (const auto dim : dims)
+                    key += std::to_string(dim) + ',';
+            }
+            execPtr = paramsCache->getOrCreate<EltwiseJitExecutor>(key, builder);
+        } else {
+            execPtr = builder();
+        }
     } else {
         execPtr = std::make_shared<EltwiseRefExecutor>(jep, fullWorkAmount, batchDimIdx);
     }
@@ -1892,5 +1910,3 @@ const jit_eltwise_params& MKLDNNEltwiseNode::EltwiseJitExecutor::getJep() const
         IE_THROW() << "Can't get jit eltwise params, kernel for eltwise node is not compiled";
     return pKernel->jep_;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNEltwiseNode, Eltwise);
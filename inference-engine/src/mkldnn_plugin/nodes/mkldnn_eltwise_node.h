@@ -89,6 +89,9 @@ public:
     bool isWithBroadcast();
     bool isSpecialConvolutionAddFusing() const { return specialConvolutionAddFusing; }
 
+    void setFastMath(bool enable) { fastMath = enable; }
+    bool isFastMath() const { return fastMath; }
+
     void createPrimitive() override;
 
     bool needPrepareParams() const override;
@@ -135,6 +138,7 @@ private:
     bool canUseOptimizedImpl = false;
     bool isDynBatchEnabled = false;
     bool specialConvolutionAddFusing = false;
+    bool fastMath = false;
     size_t inputNum = 0;
     std::vector<ptrdiff_t> start_offset_in = {};
     ptrdiff_t start_offset_out = 0;
@@ -7,6 +7,7 @@
 #include <string>
 #include "mkldnn_embedding_bag_offset_sum_node.h"
 #include <ngraph/opsets/opset3.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -51,10 +52,10 @@ void MKLDNNEmbeddingBagOffsetSumNode::initSupportedPrimitiveDescriptors() {
 
     std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
     static const std::set<Precision> supportedPrecisions =
-            {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
+            {Precision::FP32, Precision::BF16, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
+    if (inDataPrecision == Precision::BF16 && !mkldnn::impl::cpu::x64::mayiuse(mkldnn::impl::cpu::x64::avx512_core))
         inDataPrecision = Precision::FP32;
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
@@ -77,6 +78,12 @@ void MKLDNNEmbeddingBagOffsetSumNode::initSupportedPrimitiveDescriptors() {
     addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
 }
 
+void MKLDNNEmbeddingBagOffsetSumNode::createPrimitive() {
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        IE_THROW() << "'" << _layerName << "' layer has unidentified preferable primitive descriptor.";
+    createKernel(getSelectedPrimitiveDescriptor()->getConfig().inConfs[EMB_TABLE_IDX].desc->getPrecision());
+}
+
 void MKLDNNEmbeddingBagOffsetSumNode::initFromInputs() {
     indicesData_ = reinterpret_cast<const int *>(getParentEdgeAt(INDICES_IDX)->getMemoryPtr()->GetPtr());
     offsetsData_ = reinterpret_cast<const int *>(getParentEdgeAt(OFFSETS_IDX)->getMemoryPtr()->GetPtr());
@@ -134,5 +141,3 @@ void MKLDNNEmbeddingBagOffsetSumNode::execute(mkldnn::stream strm) {
 bool MKLDNNEmbeddingBagOffsetSumNode::created() const {
     return getType() == EmbeddingBagOffsetsSum;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNEmbeddingBagOffsetSumNode, EmbeddingBagOffsetsSum)
@@ -5,14 +5,202 @@
 #include <cmath>
 #include <vector>
 #include <string>
+#include <algorithm>
 #include <mkldnn_types.h>
 #include "ie_parallel.hpp"
 #include "mkldnn_embedding_bag_sum_node.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/general_utils.h"
+#include "emitters/jit_load_store_emitters.hpp"
+
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_emb_bag_call_args, field)
+
+template <cpu_isa_t isa>
+struct jit_uni_emb_bag_kernel_f32 : public jit_uni_emb_bag_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_emb_bag_kernel_f32);
+
+    explicit jit_uni_emb_bag_kernel_f32(jit_emb_bag_config_params jcp) : jit_uni_emb_bag_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    };
+
+    void generate() override {
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_num, ptr[reg_params + GET_OFF(indices_num)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_aux0.getIdx()), static_cast<size_t>(vmm_aux1.getIdx())};
+
+        const size_t block = unroll * step;
+        const size_t blocks = jcp_.emb_depth / block;
+        const size_t tail = jcp_.emb_depth % block;
+
+        xor_(reg_col, reg_col);
+        if (blocks > 0) {
+            Label blocks_loop_label;
+            Label blocks_end_label;
+
+            mov(reg_blocks, blocks);
+            L(blocks_loop_label); {
+                cmp(reg_blocks, 0);
+                je(blocks_end_label, T_NEAR);
+
+                bag_body(unroll, step);
+
+                add(reg_col, block * jcp_.src_prc.size());
+                add(reg_dst, block * jcp_.src_prc.size());
+                dec(reg_blocks);
+                jmp(blocks_loop_label, T_NEAR);
+            }
+            L(blocks_end_label);
+        }
+        if (tail > 0)
+            bag_body(div_up(tail, step), tail % step == 0 ? step : tail % step);
+
+        this->postamble();
+
+        load_emitter->emit_data();
+        store_emitter->emit_data();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == sse41, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    static constexpr int unroll = 4;
+    const int step = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    Reg64 reg_src = r8;
+    Reg64 reg_indices = r9;
+    Reg64 reg_weights = r10;
+    Reg64 reg_num = r11;
+    Reg64 reg_dst = r12;
+    Reg64 reg_col = r13;
+    Reg64 reg_row = r14;
+    Reg64 reg_ind_ptr = r15;
+    Reg64 reg_w_ptr = rax;
+    Reg64 reg_count = rbx;
+    Reg64 reg_blocks = rbp;
+    Reg64 reg_tmp = rdx;
+    Reg64 reg_load_store_mask = rsi;
+    Reg64 reg_load_table = abi_not_param1;
+    Reg64 reg_params = abi_param1;
+
+    Vmm vmm_src = Vmm(unroll);
+    Vmm vmm_weight = Vmm(unroll + 1);
+    Xmm xmm_weight = Xmm(unroll + 1);
+    Vmm vmm_aux0 = Vmm(unroll + 2);
+    Vmm vmm_aux1 = Vmm(unroll + 3);
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+
+    Vmm get_acc_reg(int idx) { return Vmm(idx); }
+
+    // accumulates vec_num vectors of the current depth block, the last one holds last_num values
+    void bag_body(int vec_num, int last_num) {
+        Label no_weights_label;
+        Label store_label;
+
+        for (int v = 0; v < vec_num; v++)
+            uni_vpxor(get_acc_reg(v), get_acc_reg(v), get_acc_reg(v));
+
+        cmp(reg_weights, 0);
+        je(no_weights_label, T_NEAR);
+        rows_loop(vec_num, last_num, true);
+        jmp(store_label, T_NEAR);
+
+        L(no_weights_label);
+        rows_loop(vec_num, last_num, false);
+
+        L(store_label);
+        for (int v = 0; v < vec_num; v++) {
+            const int num = v == vec_num - 1 ? last_num : step;
+            const int offset = v * step * jcp_.src_prc.size();
+            store_emitter->emit_code({static_cast<size_t>(get_acc_reg(v).getIdx())}, {static_cast<size_t>(reg_dst.getIdx())},
+                                     std::make_shared<store_emitter_context>(Precision::FP32, jcp_.src_prc, num, offset),
+                                     store_pool_vec_idxs, store_pool_gpr_idxs);
+        }
+    }
+
+    void rows_loop(int vec_num, int last_num, bool with_weights) {
+        Label loop_label;
+        Label loop_end_label;
+
+        mov(reg_ind_ptr, reg_indices);
+        mov(reg_w_ptr, reg_weights);
+        mov(reg_count, reg_num);
+        L(loop_label); {
+            cmp(reg_count, 0);
+            je(loop_end_label, T_NEAR);
+
+            movsxd(reg_row, dword[reg_ind_ptr]);
+            imul(reg_row, reg_row, static_cast<int>(jcp_.emb_depth * jcp_.src_prc.size()));
+            add(reg_row, reg_src);
+            add(reg_row, reg_col);
+
+            if (with_weights)
+                load_weight();
+
+            for (int v = 0; v < vec_num; v++) {
+                const int num = v == vec_num - 1 ? last_num : step;
+                const int offset = v * step * jcp_.src_prc.size();
+                load_emitter->emit_code({static_cast<size_t>(reg_row.getIdx())}, {static_cast<size_t>(vmm_src.getIdx())},
+                                        std::make_shared<load_emitter_context>(jcp_.src_prc, Precision::FP32, num, offset),
+                                        {}, load_pool_gpr_idxs);
+                if (with_weights)
+                    uni_vfmadd231ps(get_acc_reg(v), vmm_src, vmm_weight);
+                else
+                    uni_vaddps(get_acc_reg(v), get_acc_reg(v), vmm_src);
+            }
+
+            add(reg_ind_ptr, sizeof(int));
+            add(reg_w_ptr, jcp_.src_prc.size());
+            dec(reg_count);
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+    }
+
+    void load_weight() {
+        if (jcp_.src_prc == Precision::BF16) {
+            movzx(reg_tmp.cvt32(), word[reg_w_ptr]);
+            shl(reg_tmp.cvt32(), 16);
+            if (isa == sse41)
+                movd(xmm_weight, reg_tmp.cvt32());
+            else
+                vmovd(xmm_weight, reg_tmp.cvt32());
+            uni_vbroadcastss(vmm_weight, xmm_weight);
+        } else {
+            uni_vbroadcastss(vmm_weight, ptr[reg_w_ptr]);
+        }
+    }
+};
+
+#undef GET_OFF
 
 MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
             const std::shared_ptr<ngraph::Node>& op,
@@ -42,6 +230,64 @@ MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
     }
 }
 
+void MKLDNNEmbeddingBagSumNode::createKernel(const InferenceEngine::Precision &srcPrc) {
+    if (!one_of(srcPrc, Precision::FP32, Precision::BF16))
+        return;
+    // the conversion of the sums to bf16 is available on avx512_core only
+    if (srcPrc == Precision::BF16 && !mayiuse(avx512_core))
+        return;
+
+    jit_emb_bag_config_params jcp = { srcPrc, _embDepth };
+    if (mayiuse(avx512_common)) {
+        _kernel.reset(new jit_uni_emb_bag_kernel_f32<avx512_common>(jcp));
+    } else if (mayiuse(avx2)) {
+        _kernel.reset(new jit_uni_emb_bag_kernel_f32<avx2>(jcp));
+    } else if (mayiuse(sse41)) {
+        _kernel.reset(new jit_uni_emb_bag_kernel_f32<sse41>(jcp));
+    }
+    if (_kernel)
+        _kernel->create_ker();
+}
+
+void MKLDNNEmbeddingBagSumNode::collectBags(size_t outputBagsNum) {
+    _bags.resize(outputBagsNum);
+    parallel_for(outputBagsNum, [&](size_t obi) {
+        BagInfo& bag = _bags[obi];
+        bag.indices = nullptr;
+        bag.size = 0lu;
+        bag.weightsIdx = 0;
+        bag.withWeights = _withWeights;
+        getIndices(obi, bag.indices, bag.size, bag.weightsIdx, bag.withWeights);
+        bag.withWeights = bag.withWeights && _withWeights;
+    });
+
+    // every bag costs its rows plus the destination write, bags are split between threads by equal total cost
+    _bagCostsPrefix.resize(outputBagsNum + 1);
+    _bagCostsPrefix[0] = 0lu;
+    for (size_t obi = 0lu; obi < outputBagsNum; obi++)
+        _bagCostsPrefix[obi + 1] = _bagCostsPrefix[obi] + (_bags[obi].indices ? _bags[obi].size : 0lu) + 1lu;
+}
+
+template<typename Func>
+void MKLDNNEmbeddingBagSumNode::parallelForBags(Func body) const {
+    const size_t bagsNum = _bags.size();
+    const size_t totalCost = _bagCostsPrefix[bagsNum];
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(totalCost, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        // bag belongs to the thread whose cost range contains the beginning of the bag
+        const auto first = _bagCostsPrefix.begin();
+        const size_t bagStart = std::lower_bound(first, first + bagsNum, start) - first;
+        const size_t bagEnd = std::lower_bound(first, first + bagsNum, end) - first;
+        for (size_t obi = bagStart; obi < bagEnd; obi++)
+            body(obi);
+    });
+}
+
 template<typename T>
 void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsData, T* dstData,
                                             const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
@@ -50,68 +296,68 @@ void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsDa
     initFromInputs();
 
     const size_t outputBagsNum = outDataDims[0];
+    collectBags(outputBagsNum);
 
-    auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
-        if (start >= end)
-            return;
+    parallelForBags([&](size_t obi) {
+        const BagInfo& bag = _bags[obi];
+        const int* indices = bag.indices;
+        const size_t indicesSize = bag.size;
+        const bool withWeights = bag.withWeights;
+        int weightsIdx = bag.weightsIdx;
+        size_t dstIndex = obi * _embDepth;
 
-        size_t indicesSize = 0lu;
-        const int* indices = nullptr;
-        int weightsIdx = 0lu;
-        bool withWeights = _withWeights;
+        if (indices != nullptr) {
+            for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                if (indices[inIdx] >= inDataDims[0]) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                }
+            }
 
-        for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            if (_kernel) {
+                auto args = jit_emb_bag_call_args();
+                args.src = srcData;
+                args.indices = indices;
+                args.weights = withWeights ? weightsData + weightsIdx : nullptr;
+                args.indices_num = indicesSize;
+                args.dst = dstData + dstIndex;
+                (*_kernel)(&args);
+                return;
+            }
 
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
+            size_t inIdx = 0lu;
+            size_t srcIndex = indices[inIdx] * _embDepth;
 
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0]) {
-                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+            if (withWeights) {
+                for (size_t i = 0lu; i < _embDepth; i++) {
+                    dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
                 }
+                weightsIdx++;
+            } else {
+                for (size_t i = 0lu; i < _embDepth; i++) {
+                    dstData[dstIndex + i] = srcData[srcIndex + i];
+                }
+            }
+
+            for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
                 size_t srcIndex = indices[inIdx] * _embDepth;
 
                 if (withWeights) {
                     for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
+                        dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
                     }
                     weightsIdx++;
                 } else {
                     for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
+                        dstData[dstIndex + i] += srcData[srcIndex + i];
                     }
                 }
-
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0]) {
-                        IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                    }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
-                }
-            } else {
-                for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
-                }
+            }
+        } else {
+            for (size_t i = 0lu; i < _embDepth; i++) {
+                dstData[dstIndex + i] = 0;
             }
         }
-    };
-
-    parallel_nt(0, threadBody);
+    });
 }
 
 void MKLDNNEmbeddingBagSumNode::execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData, const InferenceEngine::Precision &srcPrc,
@@ -121,6 +367,13 @@ void MKLDNNEmbeddingBagSumNode::execute(const uint8_t* srcData, const uint8_t* w
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
                     reinterpret_cast<const float*>(weightsData), reinterpret_cast<float*>(dstData), inDims, outDims);
         }
+        case Precision::BF16: {
+            // BF16 table is handled by the kernel only, rows are accumulated in fp32
+            if (!_kernel)
+                IE_THROW() << "EmbeddingBagSum layer with name '" << _layerName << "' has no kernel for BF16 precision";
+            return processData<PrecisionTrait<Precision::BF16>::value_type>(reinterpret_cast<const int16_t*>(srcData),
+                    reinterpret_cast<const int16_t*>(weightsData), reinterpret_cast<int16_t*>(dstData), inDims, outDims);
+        }
         case Precision::I8: {
             return processData<PrecisionTrait<Precision::I8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
                     reinterpret_cast<const int8_t*>(weightsData), reinterpret_cast<int8_t*>(dstData), inDims, outDims);
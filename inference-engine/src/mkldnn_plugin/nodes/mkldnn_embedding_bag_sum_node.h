@@ -9,9 +9,43 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <cassert>
 
 namespace MKLDNNPlugin {
 
+struct jit_emb_bag_config_params {
+    InferenceEngine::Precision src_prc;
+    size_t emb_depth;
+};
+
+struct jit_emb_bag_call_args {
+    const void* src;
+    const int* indices;
+    const void* weights;  // nullptr for the bags without per sample weights
+    size_t indices_num;
+    void* dst;
+};
+
+/*
+ * Sums the rows of the embedding table selected by the indices of one bag, optionally scaled by per sample weights.
+ * Rows are accumulated in fp32 registers by blocks of the embedding depth, so the destination is written once.
+ */
+struct jit_uni_emb_bag_kernel {
+    void (*ker_)(const jit_emb_bag_call_args *);
+
+    void operator()(const jit_emb_bag_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_emb_bag_kernel(jit_emb_bag_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_emb_bag_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_emb_bag_config_params jcp_;
+};
+
 class MKLDNNEmbeddingBagSumNode {
 public:
     MKLDNNEmbeddingBagSumNode(
@@ -27,6 +61,8 @@ public:
     ~MKLDNNEmbeddingBagSumNode() = default;
 
 protected:
+    void createKernel(const InferenceEngine::Precision &srcPrc);
+
     virtual void initFromInputs() = 0;
     virtual void getIndices(
             int embIndex,
@@ -44,6 +80,21 @@ protected:
     const size_t PER_SAMPLE_WEIGHTS_IDX;
     const size_t DEFAULT_INDEX_IDX;
 
+    struct BagInfo {
+        const int* indices;
+        size_t size;
+        int weightsIdx;
+        bool withWeights;
+    };
+
+    void collectBags(size_t outputBagsNum);
+    template<typename Func>
+    void parallelForBags(Func body) const;
+
+    std::vector<BagInfo> _bags;
+    std::vector<size_t> _bagCostsPrefix;
+    std::shared_ptr<jit_uni_emb_bag_kernel> _kernel;
+
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
@@ -368,5 +368,3 @@ void MKLDNNExperimentalDetectronDetectionOutputNode::execute(mkldnn::stream strm
 bool MKLDNNExperimentalDetectronDetectionOutputNode::created() const {
     return getType() == ExperimentalDetectronDetectionOutput;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNExperimentalDetectronDetectionOutputNode, ExperimentalDetectronDetectionOutput)
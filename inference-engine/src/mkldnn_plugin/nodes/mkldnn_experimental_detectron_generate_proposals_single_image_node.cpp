@@ -430,5 +430,3 @@ void MKLDNNExperimentalDetectronGenerateProposalsSingleImageNode::execute(mkldnn
 bool MKLDNNExperimentalDetectronGenerateProposalsSingleImageNode::created() const {
     return getType() == ExperimentalDetectronGenerateProposalsSingleImage;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNExperimentalDetectronGenerateProposalsSingleImageNode, ExperimentalDetectronGenerateProposalsSingleImage)
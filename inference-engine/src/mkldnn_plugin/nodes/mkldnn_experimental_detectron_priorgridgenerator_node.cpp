@@ -94,5 +94,3 @@ void MKLDNNExperimentalDetectronPriorGridGeneratorNode::execute(mkldnn::stream s
 bool MKLDNNExperimentalDetectronPriorGridGeneratorNode::created() const {
     return getType() == ExperimentalDetectronPriorGridGenerator;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNExperimentalDetectronPriorGridGeneratorNode, ExperimentalDetectronPriorGridGenerator)
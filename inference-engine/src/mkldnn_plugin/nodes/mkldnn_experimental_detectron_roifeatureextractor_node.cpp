@@ -412,5 +412,3 @@ void MKLDNNExperimentalDetectronROIFeatureExtractorNode::execute(mkldnn::stream
 bool MKLDNNExperimentalDetectronROIFeatureExtractorNode::created() const {
     return getType() == ExperimentalDetectronROIFeatureExtractor;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNExperimentalDetectronROIFeatureExtractorNode, ExperimentalDetectronROIFeatureExtractor)
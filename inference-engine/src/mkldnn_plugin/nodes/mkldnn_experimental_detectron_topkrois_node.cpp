@@ -84,5 +84,3 @@ void MKLDNNExperimentalDetectronTopKROIsNode::execute(mkldnn::stream strm) {
 bool MKLDNNExperimentalDetectronTopKROIsNode::created() const {
     return getType() == ExperimentalDetectronTopKROIs;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNExperimentalDetectronTopKROIsNode, ExperimentalDetectronTopKROIs)
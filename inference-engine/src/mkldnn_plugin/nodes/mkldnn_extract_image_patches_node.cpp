@@ -510,5 +510,3 @@ const std::set<size_t> MKLDNNExtractImagePatchesNode::_supported_precisions_size
 bool MKLDNNExtractImagePatchesNode::created() const {
     return getType() == ExtractImagePatches;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNExtractImagePatchesNode, ExtractImagePatches)
@@ -1663,5 +1663,3 @@ void MKLDNNFakeQuantizeNode::appendPostOps(mkldnn::post_ops& ops, bool initAsBin
 bool MKLDNNFakeQuantizeNode::created() const {
     return getType() == FakeQuantize;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNFakeQuantizeNode, FakeQuantize);
@@ -83,6 +83,8 @@ public:
     size_t getBinarizationTresholdsSize() const { return binarizationThresholds.size(); }
     size_t getBinarizationOutputMaskSize() const { return binarizationOutputMask.size(); }
 
+    size_t getLevels() const { return levels; }
+
     const std::vector<float>& getCropLow() const { return cropLow; }
     const std::vector<float>& getCropHigh() const { return cropHigh; }
     const std::vector<float>& getInputScale() const { return inputScale; }
@@ -116,6 +118,9 @@ public:
 
     InferenceEngine::Precision getInputPrecision() const { return inputPrecision; }
     InferenceEngine::Precision getOutputPrecision() const { return outputPrecision; }
+    void setOutputPrecision(InferenceEngine::Precision prc) {
+        setOriginalOutputPrecisionAtPort(0, prc); outputPrecision = prc;
+    }
 
     void appendPostOps(mkldnn::post_ops& ops, bool initAsBinary = false, bool initBinaryMemory = false) override;
 
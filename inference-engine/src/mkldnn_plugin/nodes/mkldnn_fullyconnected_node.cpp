@@ -5,6 +5,7 @@
 #include "mkldnn_fullyconnected_node.h"
 #include "mkldnn_eltwise_node.h"
 #include "mkldnn_fake_quantize_node.h"
+#include "mkldnn_input_node.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <string>
@@ -14,6 +15,8 @@
 #include "utils/general_utils.h"
 #include <memory_desc/cpu_memory_desc_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "ie_data_hash.hpp"
+#include <ie_parallel.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -79,6 +82,9 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
 
+    if (useSparseWeights || useCompressedWeights)
+        return;
+
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalOutputPrecisionAtPort(DATA_ID));
 
@@ -127,16 +133,209 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!useSparseWeights && !useCompressedWeights) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    const auto weightsPrecision = useCompressedWeights ? getParentEdgesAtPort(WEIGHTS_ID)[0]->getParent()->getOriginalOutputPrecisionAtPort(0)
+                                                       : Precision::FP32;
+    std::vector<PortConfigurator> inConfs{{LayoutType::ncsp, Precision::FP32}, {LayoutType::ncsp, weightsPrecision}};
+    if (withBiases)
+        inConfs.push_back({LayoutType::ncsp, Precision::FP32});
+    addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, Precision::FP32}},
+                         useCompressedWeights ? impl_desc_type::compressed : impl_desc_type::sparse);
+}
+
+void MKLDNNFullyConnectedNode::setSparseWeightsRate(float rate) {
+    useSparseWeights = false;
+    if (rate >= 1.f)
+        return;
+
+    if (getOriginalInputPrecisionAtPort(DATA_ID) != Precision::FP32 || getOriginalInputPrecisionAtPort(WEIGHTS_ID) != Precision::FP32 ||
+            getOriginalOutputPrecisionAtPort(0) != Precision::FP32 || (withBiases && getOriginalInputPrecisionAtPort(BIAS_ID) != Precision::FP32))
+        return;
+    if (!one_of(getInputShapeAtPort(DATA_ID).getRank(), 2, 3))
+        return;
+
+    auto weightsNode = dynamic_cast<MKLDNNInputNode*>(getParentEdgesAtPort(WEIGHTS_ID)[0]->getParent().get());
+    if (!weightsNode || !weightsNode->isConstant() || !weightsNode->getMemoryPtr())
+        return;
+    const auto& weightsMemory = weightsNode->getMemoryPtr();
+    if (weightsMemory->getDesc().getPrecision() != Precision::FP32)
+        return;
+
+    const auto* weights = reinterpret_cast<const float*>(weightsMemory->GetPtr());
+    const size_t size = weightsMemory->GetShape().getElementsCount();
+    if (size == 0)
+        return;
+    const size_t zeros = std::count(weights, weights + size, 0.f);
+    useSparseWeights = static_cast<float>(zeros) / size >= rate;
+}
+
+void MKLDNNFullyConnectedNode::setCompressedWeights(const std::vector<float>& scales) {
+    useCompressedWeights = true;
+    useSparseWeights = false;
+    decompressionScales = scales;
+}
+
+void MKLDNNFullyConnectedNode::prepareSparseWeights() {
+    const auto& weightsMemory = getParentEdgeAt(WEIGHTS_ID)->getMemory();
+    const auto& dims = weightsMemory.getStaticDims();
+    const size_t rows = dims[0];
+    const size_t cols = weightsMemory.GetShape().getElementsCount() / rows;
+    const auto* weights = reinterpret_cast<const float*>(weightsMemory.GetPtr());
+    const size_t weightsSize = rows * cols * sizeof(float);
+
+    sparseNonZeros = rows * cols - std::count(weights, weights + rows * cols, 0.f);
+
+    auto create = [&] () {
+        const size_t size = (rows + 1 + sparseNonZeros) * sizeof(int32_t) + sparseNonZeros * sizeof(float);
+        MKLDNNMemoryPtr ptr = std::make_shared<MKLDNNMemory>(getEngine());
+        ptr->Create(DnnlBlockedMemoryDesc(Precision::U8, Shape(VectorDims{size})));
+
+        auto* rowOffsets = reinterpret_cast<int32_t*>(ptr->GetPtr());
+        auto* colIndices = rowOffsets + rows + 1;
+        auto* values = reinterpret_cast<float*>(colIndices + sparseNonZeros);
+        size_t nnz = 0;
+        for (size_t row = 0; row < rows; row++) {
+            rowOffsets[row] = static_cast<int32_t>(nnz);
+            for (size_t col = 0; col < cols; col++) {
+                const float value = weights[row * cols + col];
+                if (value != 0.f) {
+                    colIndices[nnz] = static_cast<int32_t>(col);
+                    values[nnz] = value;
+                    nnz++;
+                }
+            }
+        }
+        rowOffsets[rows] = static_cast<int32_t>(nnz);
+        return ptr;
+    };
+
+    if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_sparse_" + std::to_string(weightsSize)
+                                        + "_" + std::to_string(InferenceEngine::computeDataHash(weights, weightsSize));
+        sparseWeights = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        sparseWeights = create();
+    }
+}
+
+void MKLDNNFullyConnectedNode::executeSparse() {
+    const auto& srcMemory = getParentEdgeAt(DATA_ID)->getMemory();
+    const auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const auto& srcDims = srcMemory.getStaticDims();
+    const auto& dstDims = dstMemory.getStaticDims();
+    const size_t K = srcDims.back();
+    const size_t N = dstDims.back();
+    const size_t M = dstMemory.GetShape().getElementsCount() / N;
+
+    const auto* src = reinterpret_cast<const float*>(srcMemory.GetPtr());
+    auto* dst = reinterpret_cast<float*>(dstMemory.GetPtr());
+    const auto* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemory().GetPtr()) : nullptr;
+    const auto* rowOffsets = reinterpret_cast<const int32_t*>(sparseWeights->GetPtr());
+    const auto* colIndices = rowOffsets + N + 1;
+    const auto* values = reinterpret_cast<const float*>(colIndices + sparseNonZeros);
+
+    // the block of the source rows shares the loads of the weights values and indices
+    constexpr size_t blockM = 4;
+    constexpr size_t blockN = 16;
+    parallel_for2d(div_up(M, blockM), div_up(N, blockN), [&](size_t mb, size_t nb) {
+        const size_t mStart = mb * blockM;
+        const size_t mCount = std::min(blockM, M - mStart);
+        const size_t nEnd = std::min(N, (nb + 1) * blockN);
+        const float* srcBlock = src + mStart * K;
+        for (size_t n = nb * blockN; n < nEnd; n++) {
+            float acc[blockM] = {};
+            for (int32_t i = rowOffsets[n]; i < rowOffsets[n + 1]; i++) {
+                const float value = values[i];
+                const float* srcCol = srcBlock + colIndices[i];
+                for (size_t m = 0; m < mCount; m++)
+                    acc[m] += value * srcCol[m * K];
+            }
+            const float shift = bias ? bias[n] : 0.f;
+            for (size_t m = 0; m < mCount; m++)
+                dst[(mStart + m) * N + n] = acc[m] + shift;
+        }
+    });
+}
+
+template <typename T>
+void MKLDNNFullyConnectedNode::executeCompressed() {
+    const auto& srcMemory = getParentEdgeAt(DATA_ID)->getMemory();
+    const auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const size_t K = srcMemory.getStaticDims().back();
+    const size_t N = dstMemory.getStaticDims().back();
+    const size_t M = dstMemory.GetShape().getElementsCount() / N;
+
+    const auto* src = reinterpret_cast<const float*>(srcMemory.GetPtr());
+    auto* dst = reinterpret_cast<float*>(dstMemory.GetPtr());
+    const auto* weights = reinterpret_cast<const T*>(getParentEdgeAt(WEIGHTS_ID)->getMemory().GetPtr());
+    const auto* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemory().GetPtr()) : nullptr;
+    const bool perChannelScales = decompressionScales.size() == N;
+
+    // the weights row is converted once for the block of the source rows, the partial sums of the lanes
+    // are independent, so the conversion and accumulation are vectorized by the compiler
+    constexpr size_t blockM = 4;
+    constexpr size_t lanes = 16;
+    parallel_for2d(div_up(M, blockM), N, [&](size_t mb, size_t n) {
+        const size_t mStart = mb * blockM;
+        const size_t mCount = std::min(blockM, M - mStart);
+        const T* weightsRow = weights + n * K;
+        const float* srcBlock = src + mStart * K;
+
+        float acc[blockM][lanes] = {};
+        size_t k = 0;
+        for (; k + lanes <= K; k += lanes) {
+            float w[lanes];
+            for (size_t l = 0; l < lanes; l++)
+                w[l] = static_cast<float>(weightsRow[k + l]);
+            for (size_t m = 0; m < mCount; m++) {
+                const float* srcRow = srcBlock + m * K + k;
+                for (size_t l = 0; l < lanes; l++)
+                    acc[m][l] += srcRow[l] * w[l];
+            }
+        }
+
+        const float scale = perChannelScales ? decompressionScales[n] : decompressionScales[0];
+        const float shift = bias ? bias[n] : 0.f;
+        for (size_t m = 0; m < mCount; m++) {
+            float sum = 0.f;
+            for (size_t l = 0; l < lanes; l++)
+                sum += acc[m][l];
+            const float* srcRow = srcBlock + m * K;
+            for (size_t tail = k; tail < K; tail++)
+                sum += srcRow[tail] * static_cast<float>(weightsRow[tail]);
+            dst[(mStart + m) * N + n] = (sum + shift) * scale;
+        }
+    });
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
+    if (useCompressedWeights)
+        return;
+
+    if (useSparseWeights) {
+        if (!sparseWeights)
+            prepareSparseWeights();
+        return;
+    }
+
     if (prim)
         return;
 
     std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
+    setScratchpadMode(*attr);
     std::shared_ptr<inner_product_forward::primitive_desc> prim_desc;
     prim_desc = std::make_shared<inner_product_forward::primitive_desc>(
             createPrimitiveDescriptor<inner_product_forward::primitive_desc, inner_product_forward::desc>(*attr));
 
-    prim.reset(new inner_product_forward(*prim_desc));
+    prim = createSharedPrimitive<inner_product_forward>(*prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -156,6 +355,19 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
 }
 
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (useSparseWeights) {
+        executeSparse();
+        return;
+    }
+
+    if (useCompressedWeights) {
+        if (getParentEdgeAt(WEIGHTS_ID)->getMemory().getDesc().getPrecision() == Precision::I8)
+            executeCompressed<int8_t>();
+        else
+            executeCompressed<uint8_t>();
+        return;
+    }
+
     if (prim) {
         auto reshapeMemory = [this](int argType) {
             auto param = primArgs.find(argType);
@@ -179,6 +391,8 @@ void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
 }
 
 bool MKLDNNFullyConnectedNode::canFuse(const MKLDNNNodePtr& node) const {
+    if (useSparseWeights || useCompressedWeights)
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -232,6 +446,8 @@ bool MKLDNNFullyConnectedNode::created() const {
 const std::vector<impl_desc_type>& MKLDNNFullyConnectedNode::getPrimitivesPriority() {
     std::vector<impl_desc_type> priorities = {
             impl_desc_type::unknown,
+            impl_desc_type::jit_avx512_amx_1x1,
+            impl_desc_type::jit_avx512_amx,
             impl_desc_type::gemm_blas,
             impl_desc_type::gemm_avx512,
             impl_desc_type::gemm_avx2,
@@ -320,6 +536,8 @@ void MKLDNNFullyConnectedNode::createDescriptorInternal(const mkldnn::memory::de
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                                 const std::vector<MemoryDescPtr> &outputDesc) {
+    if (useSparseWeights || useCompressedWeights)
+        return;
     createDescriptorInternal(MemoryDescUtils::convertToDnnlMemoryDesc(inputDesc[0])->getDnnlDesc(),
                              MemoryDescUtils::convertToDnnlMemoryDesc(outputDesc[0])->getDnnlDesc());
 }
@@ -357,5 +575,3 @@ InferenceEngine::Precision MKLDNNFullyConnectedNode::getRuntimePrecision() const
 
     return getMaxPrecision(inputPrecisions);
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNFullyConnectedNode, FullyConnected);
@@ -18,6 +18,7 @@ public:
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const Shape &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
@@ -43,6 +44,18 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
+    /**
+     * Switches the node to the sparse kernel if the weights are constant FP32 and at least the given fraction of them are zeros.
+     * Should be called before the fusing as the post operations aren't supported by the sparse kernel.
+     */
+    void setSparseWeightsRate(float rate);
+
+    /**
+     * Switches the node to the kernel which converts the constant i8/u8 weights on the fly, so they are kept compressed in memory.
+     * The scales (one for all or one per output channel) are applied to the output after the bias.
+     */
+    void setCompressedWeights(const std::vector<float>& scales);
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -58,6 +71,18 @@ private:
 
     bool withBiases = false;
 
+    // the weights in CSR format: row offsets, column indices and values, stored in one buffer to be shared by the weights cache
+    bool useSparseWeights = false;
+    size_t sparseNonZeros = 0;
+    MKLDNNMemoryPtr sparseWeights;
+    void prepareSparseWeights();
+    void executeSparse();
+
+    bool useCompressedWeights = false;
+    std::vector<float> decompressionScales;
+    template <typename T>
+    void executeCompressed();
+
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
     static const size_t WEIGHTS_ID = 1;
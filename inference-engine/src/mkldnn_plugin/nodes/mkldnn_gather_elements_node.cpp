@@ -145,5 +145,3 @@ void MKLDNNGatherElementsNode::execute(mkldnn::stream strm) {
 bool MKLDNNGatherElementsNode::created() const {
     return getType() == GatherElements;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNGatherElementsNode, GatherElements)
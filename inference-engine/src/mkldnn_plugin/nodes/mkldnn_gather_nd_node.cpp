@@ -162,6 +162,7 @@ void MKLDNNGatherNDNode::gatherBlocks() {
     const size_t CS = cycles * _sliceRank;
     const size_t CB = cycles * dataStep;
     const size_t workAmount = _batchNum * cycles;
+    const size_t prefetchLen = dataStep < maxPrefetchBytes ? dataStep : maxPrefetchBytes;
 
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
@@ -178,6 +179,14 @@ void MKLDNNGatherNDNode::gatherBlocks() {
 
         for (size_t b = bStart; b < _batchNum; b++) {
             for (size_t j = cStart; j < cycles; j++) {
+                // blocks are selected by data, so issue their loads ahead of the copies
+                if (j + prefetchDistance < cycles) {
+                    const int* nextIndices = shiftedIndices + prefetchDistance * _sliceRank;
+                    size_t nextIdx = 0lu;
+                    for (size_t i = 0; i < _sliceRank ; i++)
+                        nextIdx += srcMultipliers[i] * nextIndices[i];
+                    cpu_prefetch(&(shiftedSrcData[nextIdx]), prefetchLen);
+                }
                 size_t dataIdx = 0lu;
                 for (size_t i = 0; i < _sliceRank ; i++)
                     dataIdx += srcMultipliers[i] * shiftedIndices[i];
@@ -219,5 +228,3 @@ void MKLDNNGatherNDNode::execute(mkldnn::stream strm) {
 bool MKLDNNGatherNDNode::created() const {
     return getType() == GatherND;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNGatherNDNode, GatherND)
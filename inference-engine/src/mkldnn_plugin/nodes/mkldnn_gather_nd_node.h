@@ -33,6 +33,9 @@ private:
     size_t _batchStep;
     size_t _dataTypeSize;
     const size_t _dataIndex = 0;
+    // number of indices to look ahead and maximum number of bytes of a block to prefetch
+    static const size_t prefetchDistance = 8;
+    static const size_t maxPrefetchBytes = 512;
     const size_t _indicesIndex = 1;
     std::string _errorPrefix;
 
@@ -119,20 +119,46 @@ void MKLDNNGatherNode::execute(mkldnn::stream strm) {
     const uint8_t* srcData = reinterpret_cast<const uint8_t*>(getParentEdgeAt(GATHER_DATA)->getMemoryPtr()->GetPtr());
     uint8_t* dstData = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
 
-    parallel_for2d(batchSize, idxBatchStride, [&](const size_t i, const size_t j) {
-        const unsigned int idx = static_cast<uint32_t>(srcIndexes[i * idxBatchStride + j]);
-
-        // while negative indices are not supported, should set zero
-        if (idx < indexRange) {
-            for (size_t k = 0; k < outerSize; ++k) {
-                const size_t srcStride = (i * srcBatchStride + k * dataLength * indexRange) * dataSize;
-                const size_t dstStride = (i * dstBatchStride + k * dataLength * idxBatchStride) * dataSize;
+    // rows are copied in the destination order, work is split over all the (batch, outer, index) rows,
+    // so that embedding-like gathers with a single outer dimension are parallelized over indices
+    const size_t workAmount = batchSize * outerSize * idxBatchStride;
+    const size_t prefetchLen = len < maxPrefetchBytes ? len : maxPrefetchBytes;
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0lu, end = 0lu;
+        splitter(workAmount, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        size_t j = start % idxBatchStride;
+        size_t k = (start / idxBatchStride) % outerSize;
+        size_t i = start / (idxBatchStride * outerSize);
+        for (size_t w = start; w < end; w++) {
+            const int32_t* batchIndexes = srcIndexes + i * idxBatchStride;
+            const uint8_t* srcRows = srcData + (i * srcBatchStride + k * dataLength * indexRange) * dataSize;
+            uint8_t* dstRow = dstData + (i * dstBatchStride + k * dataLength * idxBatchStride) * dataSize + j * len;
+
+            // source rows are selected by data, so issue their loads ahead of the copies
+            if (j + prefetchDistance < idxBatchStride) {
+                const unsigned int nextIdx = static_cast<uint32_t>(batchIndexes[j + prefetchDistance]);
+                if (nextIdx < indexRange)
+                    cpu_prefetch(srcRows + nextIdx * len, prefetchLen);
+            }
 
-                cpu_memcpy(&dstData[dstStride + j * len], &srcData[srcStride + idx * len], len);
+            // while negative indices are not supported, should set zero
+            const unsigned int idx = static_cast<uint32_t>(batchIndexes[j]);
+            if (idx < indexRange) {
+                cpu_memcpy(dstRow, srcRows + idx * len, len);
+            } else {
+                memset(dstRow, 0, len);
             }
-        } else {
-            for (size_t k = 0; k < outerSize; ++k) {
-                memset(&dstData[(i * dstBatchStride + k * dataLength * idxBatchStride) * dataSize + j * len], 0, len);
+
+            if (++j == idxBatchStride) {
+                j = 0;
+                if (++k == outerSize) {
+                    k = 0;
+                    i++;
+                }
             }
         }
     });
@@ -141,5 +167,3 @@ void MKLDNNGatherNode::execute(mkldnn::stream strm) {
 bool MKLDNNGatherNode::created() const {
     return getType() == Gather;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNGatherNode, Gather)
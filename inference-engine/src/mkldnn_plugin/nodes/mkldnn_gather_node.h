@@ -38,6 +38,10 @@ private:
     size_t dataSize = 1;
     size_t len = 1;
 
+    // number of indices to look ahead and maximum number of bytes of a row to prefetch
+    static const size_t prefetchDistance = 8;
+    static const size_t maxPrefetchBytes = 512;
+
     static const size_t GATHER_DATA = 0;
     static const size_t GATHER_INDEXES = 1;
     static const size_t GATHER_AXIS = 2;
@@ -148,5 +148,3 @@ void MKLDNNGatherTreeNode::gatherTreeKernel() noexcept {
 bool MKLDNNGatherTreeNode::created() const {
     return getType() == GatherTree;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNGatherTreeNode, GatherTree)
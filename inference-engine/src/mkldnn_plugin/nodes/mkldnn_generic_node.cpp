@@ -10,10 +10,41 @@
 #include <blob_factory.hpp>
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 
+namespace {
+
+class StreamExecutionContext : public InferenceEngine::ICPUExecutionContext {
+public:
+    int getNumThreads() const override {
+        return parallel_get_max_threads();
+    }
+
+    void parallelFor(size_t workAmount, const std::function<void(size_t, size_t)>& body) const override {
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(workAmount, nthr, ithr, start, end);
+            if (start < end)
+                body(start, end);
+        });
+    }
+};
+
+InferenceEngine::CPUKernelTensor makeKernelTensor(const MKLDNNMemory& memory) {
+    const auto desc = MemoryDescUtils::convertToTensorDesc(memory.getDesc());
+    InferenceEngine::CPUKernelTensor tensor;
+    tensor.data = memory.GetPtr();
+    tensor.precision = desc.getPrecision();
+    tensor.dims = desc.getDims();
+    tensor.blockingDesc = desc.getBlockingDesc();
+    return tensor;
+}
+
+}  // namespace
+
 MKLDNNGenericNode::MKLDNNGenericNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
         MKLDNNNode(op, eng, cache), ngraphOp(op) {
 }
@@ -83,6 +114,13 @@ void MKLDNNGenericNode::initSupportedPrimitiveDescriptors() {
 
 void MKLDNNGenericNode::createPrimitive() {
     if (extFactory || !impls.empty()) {
+        kernelImpl = impls.empty() ? nullptr : std::dynamic_pointer_cast<InferenceEngine::ICPUKernelImpl>(impls[0]);
+        if (kernelImpl && !isDynamicNode()) {
+            for (size_t i = 0; i < getParentEdges().size(); i++)
+                kernelInputs.push_back(makeKernelTensor(getParentEdgeAt(i)->getMemory()));
+            for (size_t i = 0; i < outputShapes.size(); i++)
+                kernelOutputs.push_back(makeKernelTensor(getChildEdgesAtPort(i)[0]->getMemory()));
+        }
         return;
     }
     if (getSelectedPrimitiveDescriptor() == nullptr)
@@ -90,7 +128,9 @@ void MKLDNNGenericNode::createPrimitive() {
 }
 
 void MKLDNNGenericNode::execute(mkldnn::stream strm) {
-    if (!impls.empty()) {
+    if (kernelImpl) {
+        execKernel();
+    } else if (!impls.empty()) {
         execLayer();
     } else {
         IE_THROW() << "Descriptor for generic primitive doesn't exist";
@@ -191,6 +231,29 @@ void MKLDNNGenericNode::execLayer() {
     }
 }
 
+void MKLDNNGenericNode::execKernel() {
+    if (isDynamicNode()) {
+        kernelInputs.clear();
+        kernelOutputs.clear();
+        for (size_t i = 0; i < getParentEdges().size(); i++)
+            kernelInputs.push_back(makeKernelTensor(getParentEdgeAt(i)->getMemory()));
+        for (size_t i = 0; i < outputShapes.size(); i++)
+            kernelOutputs.push_back(makeKernelTensor(getChildEdgesAtPort(i)[0]->getMemory()));
+    } else {
+        // the memory of the graph inputs and outputs may be replaced by the user blobs between inferences
+        for (size_t i = 0; i < kernelInputs.size(); i++)
+            kernelInputs[i].data = getParentEdgeAt(i)->getMemory().GetPtr();
+        for (size_t i = 0; i < kernelOutputs.size(); i++)
+            kernelOutputs[i].data = getChildEdgesAtPort(i)[0]->getMemory().GetPtr();
+    }
+
+    InferenceEngine::ResponseDesc resp;
+    InferenceEngine::StatusCode rc = kernelImpl->executeKernel(kernelInputs, kernelOutputs, StreamExecutionContext(), &resp);
+    if (rc != InferenceEngine::OK) {
+        IE_THROW() << this->getTypeStr() << ":" << this->getName() << ": " << resp.msg;
+    }
+}
+
 void MKLDNNGenericNode::initDescriptor(const NodeConfig &config) {
     NodeConfig rightConfig = config;
     InferenceEngine::StatusCode rc;
@@ -248,5 +311,3 @@ void MKLDNNGenericNode::initDescriptor(const NodeConfig &config) {
         constant = ConstantType::Const;
     }
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNGenericNode, Generic);
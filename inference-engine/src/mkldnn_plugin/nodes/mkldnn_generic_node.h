@@ -5,6 +5,7 @@
 #pragma once
 
 #include <ie_iextension.h>
+#include <cpu/cpu_kernel_extension.hpp>
 #include <ie_common.h>
 #include <mkldnn_node.h>
 #include <string>
@@ -32,6 +33,7 @@ public:
     void initDescriptor(const NodeConfig& config) override;
 
     void execLayer();
+    void execKernel();
     void cleanup() override;
 
 protected:
@@ -40,6 +42,10 @@ protected:
 
     InferenceEngine::ILayerImplFactory::Ptr extFactory;
     std::vector<InferenceEngine::ILayerExecImpl::Ptr> impls;
+    // the selected implementation if it works on the raw memory, the tensors are filled once for the static shapes
+    InferenceEngine::ICPUKernelImpl::Ptr kernelImpl;
+    std::vector<InferenceEngine::CPUKernelTensor> kernelInputs;
+    std::vector<InferenceEngine::CPUKernelTensor> kernelOutputs;
 
     const std::shared_ptr<ngraph::Node> ngraphOp;
 };
@@ -82,5 +82,3 @@ void MKLDNNGRNNode::execute(mkldnn::stream strm) {
 bool MKLDNNGRNNode::created() const {
     return getType() == GRN;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNGRNNode, GRN)
@@ -226,5 +226,3 @@ void MKLDNNIfNode::execute(mkldnn::stream strm) {
 bool MKLDNNIfNode::created() const {
     return getType() == If;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNIfNode, If);
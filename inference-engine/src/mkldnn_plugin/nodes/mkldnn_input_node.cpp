@@ -338,8 +338,22 @@ void MKLDNNInputNode::cloneBlobIfRequired() {
                 + "_" + ptr;
     };
 
+    // The constant data which can be used as is is shared by all the streams without copying.
+    // The cached memory holds the constant, so the data stays valid until the cache entry is released.
+    // NUMA local caches are the exception: the original data lives on the node where the model was read.
+    auto shareBlob = [&, this] () {
+        auto constant = constOp;
+        MKLDNNMemoryPtr ptr(new MKLDNNMemory(getEngine()), [constant](MKLDNNMemory* memory) {
+            delete memory;
+        });
+        ptr->Create(memDesc, constOp->get_data_ptr());
+        return ptr;
+    };
+
     if (weightCache) {
-        MKLDNNMemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
+        const bool canShare = !weightCache->isNumaLocal() && isBlobAligned() && !hasSubnormals() && !isWA();
+        MKLDNNMemoryPtr ptr = *weightCache->findOrCreate(blobKey(), canShare ? std::function<MKLDNNMemoryPtr(void)>(shareBlob)
+                                                                             : std::function<MKLDNNMemoryPtr(void)>(cloneBlob));
         memoryPtr = std::const_pointer_cast<const MKLDNNMemory>(ptr);
     } else if (isBlobAligned() && !hasSubnormals() && !isWA()) {
         auto ptr = new MKLDNNMemory(getEngine());
@@ -367,6 +381,10 @@ void MKLDNNInputNode::withMeanImage() {
     isMeanImage = true;
 }
 
+void MKLDNNInputNode::withOutputLayout(LayoutType layout) {
+    outputLayout = layout;
+}
+
 MKLDNNMemoryCPtr MKLDNNInputNode::getMemoryPtr() const {
     return memoryPtr;
 }
@@ -406,7 +424,7 @@ void MKLDNNInputNode::initSupportedPrimitiveDescriptors() {
         auto precision = getOriginalInputPrecisionAtPort(0);
         if (precision == Precision::U16) precision = Precision::FP32;
 
-        inPortConfs.push_back({LayoutType::ncsp, precision});
+        inPortConfs.push_back({outputLayout, precision});
     }
 
     addSupportedPrimDesc(inPortConfs,
@@ -436,6 +454,3 @@ void MKLDNNInputNode::createPrimitive() {
 bool MKLDNNInputNode::created() const {
     return getType() == Input || getType() == Output;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNInputNode, Input);
-REG_MKLDNN_PRIM_FOR(MKLDNNInputNode, Output);
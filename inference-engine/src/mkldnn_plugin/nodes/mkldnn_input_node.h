@@ -23,6 +23,10 @@ public:
     bool created() const override;
 
     void withMeanImage();
+    /**
+     * The network output is produced in the layout of the output blob, so the blob may be used as the graph memory
+     */
+    void withOutputLayout(LayoutType layout);
     MKLDNNMemoryCPtr getMemoryPtr() const;
 
     void executeDynamicImpl(mkldnn::stream strm) override {}
@@ -40,6 +44,7 @@ private:
     std::shared_ptr<ngraph::op::Constant> constOp;
     MKLDNNMemoryCPtr memoryPtr;
     bool isMeanImage = false;
+    LayoutType outputLayout = LayoutType::ncsp;
 };
 
 }  // namespace MKLDNNPlugin
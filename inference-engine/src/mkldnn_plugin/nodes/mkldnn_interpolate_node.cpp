@@ -11,6 +11,7 @@
 #include <vector>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "mkldnn_kernel_cache.hpp"
 #include "ie_parallel.hpp"
 #include <algorithm>
 
@@ -2011,22 +2012,33 @@ void MKLDNNInterpolateNode::createPrimitive() {
     configured_for_layout = jcp.layout;
 
     if (mode == InterpolateMode::nearest || mode == InterpolateMode::linear_onnx || mode == InterpolateMode::cubic) {
+        // the kernel with post ops embeds the data pointers of the fused nodes, so it is not shared
+        std::string key;
+        if (fusedWith.empty()) {
+            appendKernelKey(key, jcp.layout);
+            appendKernelKey(key, jcp.mode);
+            appendKernelKey(key, jcp.src_dt);
+            appendKernelKey(key, jcp.dst_dt);
+            appendKernelKey(key, jcp.indices_size);
+            appendKernelKey(key, jcp.spatial_dim_size);
+            for (const auto dim : {jcp.ID, jcp.IH, jcp.IW, jcp.OD, jcp.OH, jcp.OW})
+                appendKernelKey(key, dim);
+        }
+        using Kernel = jit_uni_interpolate_kernel;
         if (jcp.layout != InterpolateLayoutType::planar) {
             if (mayiuse(cpu::x64::avx512_common)) {
-                interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::x64::avx512_common>(jcp, *attr.get()));
+                interpolateKernel = createSharedKernel<Kernel, jit_uni_interpolate_kernel_f32<cpu::x64::avx512_common>>(key, jcp, *attr.get());
             } else if (mayiuse(cpu::x64::avx2)) {
-                interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
+                interpolateKernel = createSharedKernel<Kernel, jit_uni_interpolate_kernel_f32<cpu::x64::avx2>>(key, jcp, *attr.get());
             } else if (mayiuse(cpu::x64::sse41)) {
-                interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::x64::sse41>(jcp, *attr.get()));
+                interpolateKernel = createSharedKernel<Kernel, jit_uni_interpolate_kernel_f32<cpu::x64::sse41>>(key, jcp, *attr.get());
             }
         } else {
             // gather ISA(for planar JIT kernel) for avx2 and fp32
             if (mayiuse(cpu::x64::avx2) && inputPrec == Precision::FP32) {
-                interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
+                interpolateKernel = createSharedKernel<Kernel, jit_uni_interpolate_kernel_f32<cpu::x64::avx2>>(key, jcp, *attr.get());
             }
         }
-        if (interpolateKernel)
-            interpolateKernel->create_ker();
     }
 
     // build indices table
@@ -3230,5 +3242,3 @@ bool MKLDNNInterpolateNode::canFuse(const MKLDNNNodePtr& node) const {
 bool MKLDNNInterpolateNode::created() const {
     return getType() == Interpolate;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNInterpolateNode, Interpolate);
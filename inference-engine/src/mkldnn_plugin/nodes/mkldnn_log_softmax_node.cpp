@@ -119,5 +119,3 @@ void MKLDNNLogSoftmaxNode::execute(mkldnn::stream strm) {
 bool MKLDNNLogSoftmaxNode::created() const {
     return getType() == LogSoftmax;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNLogSoftmaxNode, LogSoftmax)
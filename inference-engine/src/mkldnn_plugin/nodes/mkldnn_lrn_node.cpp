@@ -136,5 +136,3 @@ void MKLDNNLrnNode::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc
                                           size, alpha, beta, k)));
     descs.push_back(desc);
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNLrnNode, Lrn);
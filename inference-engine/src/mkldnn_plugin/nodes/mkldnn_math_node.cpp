@@ -265,5 +265,3 @@ std::map<const ngraph::DiscreteTypeInfo, std::function<void(const std::shared_pt
             node.algorithm = MKLDNNPlugin::MathAtanh;
         }}
 };
-
-REG_MKLDNN_PRIM_FOR(MKLDNNMathNode, Math);
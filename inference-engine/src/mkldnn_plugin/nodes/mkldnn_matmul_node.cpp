@@ -154,6 +154,12 @@ void MKLDNNMatMulNode::getSupportedDescriptors() {
         }
     }
 
+    smallGemmParams = {inDims0, inDims1, outDims, transposeIn[0], transposeIn[1]};
+    useSmallGemm = fusedWith.empty() && firstInPortPrec == Precision::FP32 && secondInPortPrec == Precision::FP32 &&
+                   outPortPrec == Precision::FP32 && SmallGemm::isApplicable(smallGemmParams);
+    if (useSmallGemm)
+        return;
+
     /* Example MatMul:
      * 2x128x512(T) * 2x128x512 = 2x512x512
      * First input 2x128x512(T) should be transposed
@@ -198,6 +204,9 @@ void MKLDNNMatMulNode::getSupportedDescriptors() {
 
 void MKLDNNMatMulNode::createDescriptor(const std::vector<MemoryDescPtr>& inputDesc,
                                         const std::vector<MemoryDescPtr>& outputDesc) {
+    if (useSmallGemm)
+        return;
+
     MKLDNNDescriptor desc{
         std::shared_ptr<matmul::desc>(
             new matmul::desc(MemoryDescUtils::convertToDnnlMemoryDesc(inDataDesc[0])->getDnnlDesc(),
@@ -211,6 +220,13 @@ void MKLDNNMatMulNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (useSmallGemm) {
+        addSupportedPrimDesc({{LayoutType::ncsp, Precision::FP32}, {LayoutType::ncsp, Precision::FP32}},
+                             {{LayoutType::ncsp, Precision::FP32}},
+                             SmallGemm::getImplType());
+        return;
+    }
+
     auto attr = initPrimitiveAttr();
 
     for (auto& desc : descs) {
@@ -268,15 +284,22 @@ void MKLDNNMatMulNode::createPrimitive() {
     if (getSelectedPrimitiveDescriptor() == nullptr)
         IE_THROW()  << errorPrefix << " did not set preferable primitive descriptor";
 
+    if (useSmallGemm) {
+        if (!smallGemm)
+            smallGemm = std::make_shared<SmallGemm>(smallGemmParams);
+        return;
+    }
+
     if (prim)
         return;
 
     std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
+    setScratchpadMode(*attr);
     std::shared_ptr<matmul::primitive_desc> prim_desc;
     prim_desc = std::make_shared<matmul::primitive_desc>(
             createPrimitiveDescriptor<matmul::primitive_desc, matmul::desc>(*attr));
 
-    prim.reset(new matmul(*prim_desc));
+    prim = createSharedPrimitive<matmul>(*prim_desc);
 
     auto src0 = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto src1 = getParentEdgesAtPort(1)[0]->getMemoryPtr()->GetPrimitive();
@@ -285,6 +308,17 @@ void MKLDNNMatMulNode::createPrimitive() {
     primArgs = {{DNNL_ARG_SRC_0, src0}, {DNNL_ARG_WEIGHTS_0, src1}, {DNNL_ARG_DST, dst}};
 }
 
+void MKLDNNMatMulNode::execute(mkldnn::stream strm) {
+    if (smallGemm) {
+        smallGemm->execute(reinterpret_cast<const float*>(getParentEdgeAt(0)->getMemory().GetPtr()),
+                           reinterpret_cast<const float*>(getParentEdgeAt(1)->getMemory().GetPtr()),
+                           reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetPtr()));
+        return;
+    }
+
+    MKLDNNNode::execute(strm);
+}
+
 MemoryDescPtr MKLDNNMatMulNode::getSrcMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) {
     auto desc = idx > 0 ? primitive_desc_it.weights_desc(idx - 1): primitive_desc_it.src_desc(idx);
 
@@ -306,5 +340,3 @@ size_t MKLDNNMatMulNode::getMaxBatch() const {
 InferenceEngine::Precision MKLDNNMatMulNode::getRuntimePrecision() const {
     return getMaxPrecision(getInputPrecisions());
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNMatMulNode, MatMul);
@@ -6,6 +6,7 @@
 
 #include <mkldnn_node.h>
 #include <ie_common.h>
+#include "common/small_gemm.h"
 #include <string>
 #include <vector>
 #include <array>
@@ -22,6 +23,7 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     MemoryDescPtr getSrcMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool canFuse(const MKLDNNNodePtr& node) const override;
     bool created() const override;
     size_t getMaxBatch() const override;
@@ -49,6 +51,12 @@ private:
 
     std::array<MemoryDescPtr, 2> inDataDesc;
     MemoryDescPtr outDataDesc;
+
+    /* fp32 matrices of one batch fitting the caches are multiplied by the JIT small GEMM kernels
+     * instead of oneDNN matmul, which overhead dominates on such sizes */
+    bool useSmallGemm = false;
+    SmallGemmParams smallGemmParams;
+    std::shared_ptr<SmallGemm> smallGemm;
 };
 
 }  // namespace MKLDNNPlugin
@@ -383,5 +383,3 @@ void MKLDNNMatrixNmsNode::checkPrecision(const Precision prec, const std::vector
     if (std::find(precList.begin(), precList.end(), prec) == precList.end())
         IE_THROW() << errorPrefix << "has unsupported '" << name << "' " << type << " precision: " << prec;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNMatrixNmsNode, MatrixNms);
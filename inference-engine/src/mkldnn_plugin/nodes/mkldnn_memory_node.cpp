@@ -10,6 +10,7 @@
 #include "utils/general_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/ngraph_utils.hpp"
+#include "mkldnn_concat_node.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -27,8 +28,8 @@ MKLDNNMemoryNode::MKLDNNMemoryNode(const std::shared_ptr<ngraph::Node>& op) {
 
 bool MKLDNNMemoryOutputNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
+        if (op->get_input_partial_shape(0).rank().is_dynamic()) {
+            errorMessage = "Doesn't support op with dynamic rank";
             return false;
         }
 
@@ -83,10 +84,75 @@ void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
     inputMemoryNode->storeState(srcMemory);
 }
 
+static bool isDataShared(const MKLDNNEdgePtr& edge, const std::vector<MKLDNNEdgePtr>& edges) {
+    for (const auto& other : edges) {
+        if (other != edge && other->getMemory().GetData() == edge->getMemory().GetData())
+            return true;
+    }
+    return false;
+}
+
+void MKLDNNMemoryOutputNode::initInPlaceState() {
+    auto inputMemoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(inputNode);
+    if (inputMemoryNode == nullptr)
+        return;
+
+    // The state readers get the data handle of the ReadValue output, so it cannot be propagated further by in-place
+    // or by the optimized concat, which are using different ptrs without offsets. The graph outputs are read after
+    // the whole inference, when the state is already updated.
+    int lastReaderIndex = -1;
+    for (size_t i = 0; i < inputNode->getChildEdges().size(); i++) {
+        auto edge = inputNode->getChildEdgeAt(i);
+        auto child = edge->getChild();
+        if (child.get() == this || child->isConstant() || child->isInplace() || MKLDNNPlugin::one_of(child->getType(), Split, Output))
+            return;
+        auto concat = dynamic_cast<MKLDNNConcatNode*>(child.get());
+        if (concat && concat->isOptimized())
+            return;
+        if (!inputNode->isDynamicNode()) {
+            std::vector<MKLDNNEdgePtr> childEdges;
+            for (size_t j = 0; j < child->getChildEdges().size(); j++)
+                childEdges.push_back(child->getChildEdgeAt(j));
+            if (isDataShared(edge, childEdges))
+                return;
+        }
+        lastReaderIndex = std::max(lastReaderIndex, child->getExecIndex());
+    }
+
+    // The state writer reallocates its output as the shape changes, so only the readers may share the dynamic state store.
+    if (inputNode->isDynamicNode()) {
+        if (getExecIndex() > lastReaderIndex)
+            inputMemoryNode->setStateMode(MKLDNNMemoryInputNode::StateMode::Shared, nullptr);
+        return;
+    }
+
+    auto stateEdge = getParentEdgeAt(0);
+    if (!stateEdge->getMemory().getDesc().isCompatible(inputMemoryNode->getStore()->getDesc()))
+        return;
+
+    // The state writer puts the result right into the state buffer, so it must be the only consumer of its output.
+    auto writer = stateEdge->getParent();
+    if (writer.get() == inputNode || writer->getChildEdges().size() != 1 || writer->isConstant() || writer->isInplace())
+        return;
+    std::vector<MKLDNNEdgePtr> writerEdges;
+    for (size_t i = 0; i < writer->getParentEdges().size(); i++)
+        writerEdges.push_back(writer->getParentEdgeAt(i));
+    if (isDataShared(stateEdge, writerEdges))
+        return;
+
+    // The graph nodes of a stream are executed sequentially if there are any memory nodes, so the execution indices
+    // tell whether the previous state is still needed at the moment the new one is produced.
+    if (writer->getExecIndex() > lastReaderIndex) {
+        inputMemoryNode->setStateMode(MKLDNNMemoryInputNode::StateMode::InPlace, stateEdge);
+    } else if (getExecIndex() > lastReaderIndex) {
+        inputMemoryNode->setStateMode(MKLDNNMemoryInputNode::StateMode::DoubleBuffer, stateEdge);
+    }
+}
+
 bool MKLDNNMemoryInputNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
+        if (op->get_output_partial_shape(0).rank().is_dynamic()) {
+            errorMessage = "Doesn't support op with dynamic rank";
             return false;
         }
 
@@ -116,11 +182,53 @@ MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const std::shared_ptr<ngraph::Node>
 void MKLDNNMemoryInputNode::createPrimitive() {
     MKLDNNInputNode::createPrimitive();
 
+    if (isDynamicNode()) {
+        // the dynamic state has the shape of the initializer or the smallest shape allowed until it is assigned
+        const bool hasStaticInit = !getParentEdges().empty() && getInputShapeAtPort(0).isStatic();
+        resizeStore(hasStaticInit ? getInputShapeAtPort(0).getStaticDims() : getOutputShapeAtPort(0).getMinDims());
+        dataStore->FillZero();
+        stateData = dataStore->GetData();
+        return;
+    }
+
     dataStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
 
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
         dataStore->FillZero();
+    stateData = dataStore->GetData();
+}
+
+void MKLDNNMemoryInputNode::setStateMode(StateMode mode, const MKLDNNEdgePtr& edge) {
+    stateMode = mode;
+    stateEdge = edge;
+    if (stateMode == StateMode::Shared)
+        return;
+    if (stateMode == StateMode::DoubleBuffer) {
+        nextDataStore = std::make_shared<MKLDNNMemory>(getEngine());
+        nextDataStore->Create(dataStore->getDesc());
+    }
+    updateStateEdges();
+}
+
+void MKLDNNMemoryInputNode::setStateData(void* data) {
+    IE_ASSERT(stateMode == StateMode::InPlace) << "The state buffer can be set for the in-place state only";
+    if (stateData == data)
+        return;
+    stateData = data;
+    touchStore();
+    updateStateEdges();
+}
+
+void MKLDNNMemoryInputNode::updateStateEdges() {
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        getChildEdgeAt(i)->getMemory().GetPrimitivePtr()->set_data_handle(stateData);
+    }
+
+    auto edge = stateEdge.lock();
+    IE_ASSERT(edge != nullptr);
+    void* nextStateData = stateMode == StateMode::DoubleBuffer ? nextDataStore->GetData() : stateData;
+    edge->getMemory().GetPrimitivePtr()->set_data_handle(nextStateData);
 }
 
 /**
@@ -149,14 +257,67 @@ MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
     return dataStore;
 }
 
+void MKLDNNMemoryInputNode::resizeStore(const VectorDims& dims) {
+    if (storeBuffer && dataStore->getStaticDims() == dims)
+        return;
+
+    auto desc = getBaseMemDescAtOutputPort(0)->cloneWithNewDims(dims);
+    const size_t size = desc->getCurrentMemSize();
+    if (!storeBuffer || size > storeBuffer->GetSize()) {
+        // The capacity is at least doubled, so the state growing by a step each inference is reallocated
+        // only a logarithmic number of times. The data isn't kept since the whole new state is written next.
+        const size_t capacity = std::max<size_t>(std::max(size, storeBuffer ? 2 * storeBuffer->GetSize() : 0), 1);
+        storeBuffer = std::make_shared<MKLDNNMemory>(getEngine());
+        storeBuffer->Create(DnnlBlockedMemoryDesc(Precision::U8, Shape(VectorDims{capacity})));
+    }
+    dataStore->Create(desc, storeBuffer->GetData(), false);
+    stateData = dataStore->GetData();
+    touchStore();
+}
+
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
-    // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    touchStore();
+    if (isDynamicNode()) {
+        resizeStore(new_state.getStaticDims());
+        simple_copy(*dataStore, new_state);
+        return;
+    }
+
+    switch (stateMode) {
+    case StateMode::InPlace:
+        // the new state has been written right into the state buffer
+        break;
+    case StateMode::DoubleBuffer:
+        // all the readers of the previous state are executed, so its buffer becomes the next state output
+        std::swap(dataStore, nextDataStore);
+        stateData = dataStore->GetData();
+        updateStateEdges();
+        break;
+    default:
+        // TODO: Should be next one call:
+        //           dataStore.SetData(new_state, false);
+        //       But because of performance reason we use simple manual copy
+        simple_copy(*dataStore, new_state);
+    }
+}
+
+void MKLDNNMemoryInputNode::executeDynamicImpl(mkldnn::stream strm) {
+    if (stateMode == StateMode::Shared) {
+        // all the state readers are executed before the new state is stored, so they read the store itself
+        for (size_t i = 0; i < getChildEdges().size(); i++) {
+            getChildEdgeAt(i)->getMemoryPtr()->redefineDesc(dataStore->getDesc(), dataStore->GetData());
+        }
+        return;
+    }
+
+    redefineOutputMemory({dataStore->getStaticDims()});
+    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
+    if (stateMode != StateMode::Copy)
+        return;
+
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
@@ -201,6 +362,3 @@ void MKLDNNMemoryNodeVirtualEdge::remove(MKLDNNMemoryNode * node, Holder* holder
         });
     }
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNMemoryInputNode, MemoryInput);
-REG_MKLDNN_PRIM_FOR(MKLDNNMemoryOutputNode, MemoryOutput);
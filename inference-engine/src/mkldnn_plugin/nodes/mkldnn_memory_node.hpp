@@ -64,14 +64,26 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
     void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override {}
     void execute(mkldnn::stream strm) override;
+    void executeDynamicImpl(mkldnn::stream strm) override {
+        execute(strm);
+    }
     bool created() const override {
         return getType() == MemoryOutput;
     }
 
+    bool needShapeInfer() const override { return false; }
+    bool needPrepareParams() const override { return false; }
+
     void setInputNode(MKLDNNNode* node) override {
         inputNode = node;
     }
 
+    /**
+     * @brief Lets the ReadValue sibling and this node share the state buffers instead of copying the state.
+     * Should be called once the primitives of the graph are created.
+     */
+    void initInPlaceState();
+
  private:
     /**
      * @brief keeps reference to input sibling node
@@ -93,14 +105,70 @@ public:
         return true;
     }
     void execute(mkldnn::stream strm) override;
+    void executeDynamicImpl(mkldnn::stream strm) override;
 
     void createPrimitive() override;
 
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+
+    /**
+     * @brief Sets the dims of the dynamic state. The store keeps its capacity, so a state growing each inference
+     * is reallocated only when it outgrows the capacity.
+     * @param dims new dims of the state
+     */
+    void resizeStore(const VectorDims& dims);
+
+    /**
+     * @brief The version of the store data, it changes each time the store is written. So an infer request can tell
+     * whether the store still holds the state it was synchronized with after the previous inference.
+     */
+    size_t getStoreVersion() const {
+        return storeVersion;
+    }
+    void touchStore() {
+        storeVersion++;
+    }
+
+    /**
+     * @brief The way the state gets from the Assign input to the ReadValue output:
+     * Copy - through the copies to and from the state store,
+     * InPlace - the ReadValue output and the Assign input are the same buffer, the state is written after all its readers,
+     * DoubleBuffer - the ReadValue output and the Assign input are two buffers swapped once the state is written,
+     * Shared - the ReadValue output is the state store, the Assign input is copied to it after all the state readers.
+     */
+    enum class StateMode {
+        Copy,
+        InPlace,
+        DoubleBuffer,
+        Shared
+    };
+
+    void setStateMode(StateMode mode, const MKLDNNEdgePtr& stateEdge);
+    StateMode getStateMode() const {
+        return stateMode;
+    }
+
+    /**
+     * @brief Makes the graph read and write the state in the external buffer. Allowed in the InPlace mode only.
+     * @param data the buffer, which size is equal to the state store size
+     */
+    void setStateData(void* data);
+    void* getStateData() const {
+        return stateData;
+    }
+
  private:
+    void updateStateEdges();
+
     MKLDNNMemoryPtr dataStore;
+    MKLDNNMemoryPtr nextDataStore;
+    MKLDNNMemoryPtr storeBuffer;
+    MKLDNNEdgeWeakPtr stateEdge;
+    StateMode stateMode = StateMode::Copy;
+    void* stateData = nullptr;
+    size_t storeVersion = 0;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
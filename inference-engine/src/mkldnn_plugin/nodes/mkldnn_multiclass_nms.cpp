@@ -17,6 +17,7 @@
 
 #include "ie_parallel.hpp"
 #include "utils/general_utils.h"
+#include "common/nms_kernel.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -98,6 +99,9 @@ MKLDNNMultiClassNmsNode::MKLDNNMultiClassNmsNode(const std::shared_ptr<ngraph::N
         IE_THROW() << errorPrefix << "has unsupported 'valid_outputs' output rank: " << valid_outputs_dims.size();
     if (valid_outputs_dims[0] != boxes_dims[0])  // valid_outputs_dims[0] != num_batches
         IE_THROW() << errorPrefix << "has unsupported 'valid_outputs' output 1st dimension size: " << valid_outputs_dims[0];
+
+    // not normalized boxes have one pixel added to their sides, the scores equal to the threshold are kept to align with reference
+    nmsKernel = std::make_shared<NmsKernel>(normalized ? 0.f : 1.f, true);
 }
 
 void MKLDNNMultiClassNmsNode::initSupportedPrimitiveDescriptors() {
@@ -153,6 +157,8 @@ void MKLDNNMultiClassNmsNode::execute(mkldnn::stream strm) {
     auto boxesStrides = getParentEdgeAt(NMS_BOXES)->getMemory().GetDescWithType<BlockedMemoryDesc>()->getStrides();
     auto scoresStrides = getParentEdgeAt(NMS_SCORES)->getMemory().GetDescWithType<BlockedMemoryDesc>()->getStrides();
 
+    convertBoxes(boxes, boxesStrides);
+
     if ((nms_eta >= 0) && (nms_eta < 1)) {
         nmsWithEta(boxes, scores, boxesStrides, scoresStrides);
     } else {
@@ -276,28 +282,19 @@ bool MKLDNNMultiClassNmsNode::created() const {
     return getType() == MulticlassNms;
 }
 
-float MKLDNNMultiClassNmsNode::intersectionOverUnion(const float* boxesI, const float* boxesJ, const bool normalized) {
-    float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
+void MKLDNNMultiClassNmsNode::convertBoxes(const float* boxes, const SizeVector& boxesStrides) {
     const float norm = static_cast<float>(normalized == false);
-
-    // to align with reference
-    yminI = boxesI[0];
-    xminI = boxesI[1];
-    ymaxI = boxesI[2];
-    xmaxI = boxesI[3];
-    yminJ = boxesJ[0];
-    xminJ = boxesJ[1];
-    ymaxJ = boxesJ[2];
-    xmaxJ = boxesJ[3];
-
-    float areaI = (ymaxI - yminI + norm) * (xmaxI - xminI + norm);
-    float areaJ = (ymaxJ - yminJ + norm) * (xmaxJ - xminJ + norm);
-    if (areaI <= 0.f || areaJ <= 0.f)
-        return 0.f;
-
-    float intersection_area = (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ) + norm, 0.f) *
-                              (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ) + norm, 0.f);
-    return intersection_area / (areaI + areaJ - intersection_area);
+    cornerBoxes.resize(num_batches * num_boxes);
+    parallel_for2d(num_batches, num_boxes, [&](size_t batch_idx, size_t box_idx) {
+        const float* box = boxes + batch_idx * boxesStrides[0] + box_idx * 4;
+        NmsBox& cornerBox = cornerBoxes[batch_idx * num_boxes + box_idx];
+        // to align with reference
+        cornerBox.ymin = box[0];
+        cornerBox.xmin = box[1];
+        cornerBox.ymax = box[2];
+        cornerBox.xmax = box[3];
+        cornerBox.area = (cornerBox.ymax - cornerBox.ymin + norm) * (cornerBox.xmax - cornerBox.xmin + norm);
+    });
 }
 
 void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores, const SizeVector& boxesStrides, const SizeVector& scoresStrides) {
@@ -312,27 +309,35 @@ void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores
     parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
         if (class_idx != background_class) {
             std::vector<filteredBoxes> fb;
-            const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
+            const NmsBox* boxesPtr = cornerBoxes.data() + batch_idx * num_boxes;
             const float* scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
+            std::unique_ptr<float[]> filteredScores(new float[num_boxes]);
+            std::unique_ptr<int[]> filteredIndices(new int[num_boxes]);
+            const size_t filteredNum = nmsKernel->filterScores(scoresPtr, num_boxes, score_threshold, filteredScores.get(), filteredIndices.get());
+
             std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
-            for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-                if (scoresPtr[box_idx] >= score_threshold)  // algin with ref
-                    sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
-            }
+            for (size_t i = 0; i < filteredNum; i++)
+                sorted_boxes.emplace(boxInfo({filteredScores[i], filteredIndices[i], 0}));
             fb.reserve(sorted_boxes.size());
             if (sorted_boxes.size() > 0) {
                 auto adaptive_threshold = iou_threshold;
                 int max_out_box = (max_output_boxes_per_class > sorted_boxes.size()) ? sorted_boxes.size() : max_output_boxes_per_class;
+                NmsSelectedBoxes selected(max_out_box);
+                std::unique_ptr<float[]> ious(new float[max_out_box + NmsSelectedBoxes::padding]);
                 while (max_out_box && !sorted_boxes.empty()) {
                     boxInfo currBox = sorted_boxes.top();
                     float origScore = currBox.score;
                     sorted_boxes.pop();
                     max_out_box--;
 
+                    // IoU with all the boxes selected since the last visit are computed at once and consumed in reverse order
+                    const size_t begin = currBox.suppress_begin_index;
+                    nmsKernel->intersectionOverUnion(boxesPtr[currBox.idx], selected, begin, ious.get());
+
                     bool box_is_selected = true;
                     for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4], normalized);
+                        float iou = ious[idx - begin];
                         currBox.score *= func(iou, adaptive_threshold);
                         if (iou >= adaptive_threshold) {
                             box_is_selected = false;
@@ -349,6 +354,7 @@ void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores
                         }
                         if (currBox.score == origScore) {
                             fb.push_back({currBox.score, batch_idx, class_idx, currBox.idx});
+                            selected.push_back(boxesPtr[currBox.idx]);
                             continue;
                         }
                         if (currBox.score > score_threshold) {
@@ -369,14 +375,17 @@ void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores
 void MKLDNNMultiClassNmsNode::nmsWithoutEta(const float* boxes, const float* scores, const SizeVector& boxesStrides, const SizeVector& scoresStrides) {
     parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
         if (class_idx != background_class) {
-            const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
+            const NmsBox* boxesPtr = cornerBoxes.data() + batch_idx * num_boxes;
             const float* scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
+            std::unique_ptr<float[]> filteredScores(new float[num_boxes]);
+            std::unique_ptr<int[]> filteredIndices(new int[num_boxes]);
+            const size_t filteredNum = nmsKernel->filterScores(scoresPtr, num_boxes, score_threshold, filteredScores.get(), filteredIndices.get());
+
             std::vector<std::pair<float, int>> sorted_boxes;
-            for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-                if (scoresPtr[box_idx] >= score_threshold)  // algin with ref
-                    sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
-            }
+            sorted_boxes.reserve(filteredNum);
+            for (size_t i = 0; i < filteredNum; i++)
+                sorted_boxes.emplace_back(std::make_pair(filteredScores[i], filteredIndices[i]));
 
             int io_selection_size = 0;
             if (sorted_boxes.size() > 0) {
@@ -384,22 +393,16 @@ void MKLDNNMultiClassNmsNode::nmsWithoutEta(const float* boxes, const float* sco
                     return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
                 });
                 int offset = batch_idx * num_classes * max_output_boxes_per_class + class_idx * max_output_boxes_per_class;
+                int max_out_box = (max_output_boxes_per_class > sorted_boxes.size()) ? sorted_boxes.size() : max_output_boxes_per_class;
+                NmsSelectedBoxes selected(max_out_box);
                 filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
+                selected.push_back(boxesPtr[sorted_boxes[0].second]);
                 io_selection_size++;
-                int max_out_box = (max_output_boxes_per_class > sorted_boxes.size()) ? sorted_boxes.size() : max_output_boxes_per_class;
                 for (size_t box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou =
-                            intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4], normalized);
-                        if (iou >= iou_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
-
-                    if (box_is_selected) {
+                    const NmsBox& candidate = boxesPtr[sorted_boxes[box_idx].second];
+                    if (!nmsKernel->isSuppressed(candidate, selected, iou_threshold)) {
                         filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
+                        selected.push_back(candidate);
                         io_selection_size++;
                     }
                 }
@@ -413,5 +416,3 @@ void MKLDNNMultiClassNmsNode::checkPrecision(const Precision prec, const std::ve
     if (std::find(precList.begin(), precList.end(), prec) == precList.end())
         IE_THROW() << errorPrefix << "has unsupported '" << name << "' " << type << " precision: " << prec;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNMultiClassNmsNode, MulticlassNms)
\ No newline at end of file
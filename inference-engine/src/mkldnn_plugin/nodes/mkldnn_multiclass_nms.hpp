@@ -9,6 +9,8 @@
 
 #include <string>
 
+#include "common/nms_kernel.h"
+
 namespace MKLDNNPlugin {
 
 enum MulticlassNmsSortResultType {
@@ -82,7 +84,10 @@ private:
     void checkPrecision(const InferenceEngine::Precision prec, const std::vector<InferenceEngine::Precision> precList, const std::string name,
                         const std::string type);
 
-    float intersectionOverUnion(const float* boxesI, const float* boxesJ, const bool normalized);
+    std::vector<NmsBox> cornerBoxes;
+    std::shared_ptr<NmsKernel> nmsKernel;
+
+    void convertBoxes(const float* boxes, const InferenceEngine::SizeVector& boxesStrides);
 
     void nmsWithEta(const float* boxes, const float* scores, const InferenceEngine::SizeVector& boxesStrides, const InferenceEngine::SizeVector& scoresStrides);
 
@@ -5,12 +5,15 @@
 #include "mkldnn_mvn_node.h"
 
 #include <algorithm>
+#include <functional>
+#include <numeric>
 #include <string>
 #include <vector>
 
 #include "mkldnn_fake_quantize_node.h"
 #include "mkldnn_eltwise_node.h"
 #include <mkldnn_extension_utils.h>
+#include "mkldnn_kernel_cache.hpp"
 #include "utils/bfloat16.hpp"
 #include "ie_parallel.hpp"
 #include "emitters/jit_load_store_emitters.hpp"
@@ -23,6 +26,7 @@
 #include <cpu/x64/injectors/jit_uni_eltwise_injector.hpp>
 
 #include <ngraph/opsets/opset6.hpp>
+#include "ngraph_transformations/op/rms_norm.hpp"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 
 using namespace mkldnn;
@@ -602,6 +606,26 @@ private:
 };
 //////////////////////////////////////////////////////////////////////////////////
 
+namespace {
+
+template <cpu_isa_t isa>
+void createMVNKernels(jit_mvn_config_params jcp, const mkldnn_primitive_attr& attr, const std::string& key, const std::string& mvnKey,
+                      std::shared_ptr<jit_uni_mvn_kernel>& mvnKernel,
+                      std::shared_ptr<jit_uni_mvn_mean_variance_kernel>& meanKernel,
+                      std::shared_ptr<jit_uni_mvn_mean_variance_kernel>& varianceKernel) {
+    mvnKernel = createSharedKernel<jit_uni_mvn_kernel, jit_uni_mvn_kernel_f32<isa>>(mvnKey, jcp, attr);
+
+    const bool normalizeVariance = jcp.normalize_variance;
+    jcp.normalize_variance = false;
+    meanKernel = createSharedKernel<jit_uni_mvn_mean_variance_kernel, jit_uni_mvn_mean_variance_kernel_f32<isa>>(key + "|mean", jcp);
+    if (normalizeVariance) {
+        jcp.normalize_variance = true;
+        varianceKernel = createSharedKernel<jit_uni_mvn_mean_variance_kernel, jit_uni_mvn_mean_variance_kernel_f32<isa>>(key + "|variance", jcp);
+    }
+}
+
+}  // namespace
+
 bool MKLDNNMVNNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (isDynamicNgraphNode(op)) {
@@ -663,6 +687,7 @@ bool MKLDNNMVNNode::isSupportedOperation(const std::shared_ptr<const ngraph::Nod
                 }
             }
         } else if (auto mvnOp = ngraph::as_type_ptr<const ngraph::op::v0::MVN>(op)) {
+        } else if (ngraph::as_type_ptr<const RMSNormNode>(op)) {
         } else {
             errorMessage = "Node is not an instance of the MVN operation.";
             return false;
@@ -698,6 +723,12 @@ MKLDNNMVNNode::MKLDNNMVNNode(const std::shared_ptr<ngraph::Node>& op, const mkld
         epsValue_ = mvnOp->get_eps();
         epsMode_ = INSIDE_SQRT;
         acrossChannels_ = mvnOp->get_across_channels();
+    } else if (auto rmsNormOp = ngraph::as_type_ptr<RMSNormNode>(op)) {
+        rmsNorm_ = true;
+        normalizeVariance_ = true;
+        epsValue_ = rmsNormOp->get_eps();
+        epsMode_ = INSIDE_SQRT;
+        acrossChannels_ = rmsNormOp->get_across_channels();
     }
 }
 
@@ -708,6 +739,19 @@ void MKLDNNMVNNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (isFusedNorm()) {
+        std::vector<PortConfigurator> inDataConf;
+        inDataConf.reserve(inputShapes.size());
+        for (size_t i = 0; i < inputShapes.size(); i++) {
+            if (i == 0 || (withResidual_ && i == residualPort_))
+                inDataConf.emplace_back(LayoutType::ncsp, Precision::FP32);
+            else
+                inDataConf.emplace_back(LayoutType::ncsp, Precision::I32, true);
+        }
+        addSupportedPrimDesc(inDataConf, {{LayoutType::ncsp, Precision::FP32}}, impl_desc_type::ref_any);
+        return;
+    }
+
     setPostOps(attr, true);
 
     Precision inputPrecision = getOriginalInputPrecisionAtPort(0);
@@ -798,6 +842,15 @@ void MKLDNNMVNNode::createPrimitive() {
     if (getSelectedPrimitiveDescriptor() == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set.";
 
+    if (isFusedNorm()) {
+        fusedRowSize_ = getNormalizedSize();
+        fusedRowsNum_ = getInputShapeAtPort(0).getElementsCount() / fusedRowSize_;
+        // the common scale and shift are broadcasted over the row, the missing ones are the identity
+        gamma_.resize(fusedRowSize_, gamma_.size() == 1 ? gamma_[0] : 1.f);
+        beta_.resize(fusedRowSize_, beta_.size() == 1 ? beta_[0] : 0.f);
+        return;
+    }
+
     const SizeVector in_dims = srcMemPtr->getStaticDims();
     transformTo5DCase(in_dims);
     auto selectedPD = getSelectedPrimitiveDescriptor();
@@ -812,43 +865,26 @@ void MKLDNNMVNNode::createPrimitive() {
     int N = 0;
     std::tie(N, jcp.C, jcp.D, jcp.H, jcp.W) = shape5D;
 
-    if (mayiuse(cpu::x64::avx512_common)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx512_common>(jcp, *attr.get()));
+    // the kernel with post ops embeds the data pointers of the fused nodes, so it is not shared
+    std::string key;
+    appendKernelKey(key, jcp.planar_layout);
+    appendKernelKey(key, jcp.across_channels);
+    appendKernelKey(key, jcp.src_data_size);
+    appendKernelKey(key, jcp.dst_data_size);
+    appendKernelKey(key, jcp.C);
+    appendKernelKey(key, jcp.D);
+    appendKernelKey(key, jcp.H);
+    appendKernelKey(key, jcp.W);
+    key.append(jcp.src_prc.name()).append(jcp.dst_prc.name());
+    const std::string mvnKey = fusedWith.empty() ? key + (jcp.normalize_variance ? "|nv" : "|") : std::string();
 
-        jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_common>(jcp));
-        if (normalizeVariance_) {
-            jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_common>(jcp));
-        }
+    if (mayiuse(cpu::x64::avx512_common)) {
+        createMVNKernels<cpu::x64::avx512_common>(jcp, *attr.get(), key, mvnKey, mvn_kernel, mvn_mean_kernel, mvn_variance_kernel);
     } else if (mayiuse(cpu::x64::avx2)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
-
-        jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
-        if (normalizeVariance_) {
-            jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
-        }
+        createMVNKernels<cpu::x64::avx2>(jcp, *attr.get(), key, mvnKey, mvn_kernel, mvn_mean_kernel, mvn_variance_kernel);
     } else if (mayiuse(cpu::x64::sse41)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::sse41>(jcp, *attr.get()));
-
-        jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
-        if (normalizeVariance_) {
-            jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
-        }
+        createMVNKernels<cpu::x64::sse41>(jcp, *attr.get(), key, mvnKey, mvn_kernel, mvn_mean_kernel, mvn_variance_kernel);
     }
-
-    if (mvn_kernel)
-        mvn_kernel->create_ker();
-
-    if (mvn_mean_kernel)
-        mvn_mean_kernel->create_ker();
-
-    if (mvn_variance_kernel)
-        mvn_variance_kernel->create_ker();
 }
 
 void MKLDNNMVNNode::transformTo5DCase(const SizeVector& shape) {
@@ -906,6 +942,13 @@ void MKLDNNMVNNode::execute(mkldnn::stream strm) {
     uint8_t *dst_data = reinterpret_cast<uint8_t*>(dstMemPtr->GetPtr());
     uint8_t *src_data = reinterpret_cast<uint8_t*>(srcMemPtr->GetPtr());
 
+    if (isFusedNorm()) {
+        const float *residual_data = withResidual_ ?
+                reinterpret_cast<const float*>(getParentEdgeAt(residualPort_)->getMemoryPtr()->GetPtr()) : nullptr;
+        mvn_fused(reinterpret_cast<const float*>(src_data), residual_data, reinterpret_cast<float*>(dst_data));
+        return;
+    }
+
     auto dim = srcMemPtr->getStaticDims();
     if (mayiuse(cpu::x64::sse41)) {
         if (!mvn_mean_kernel || (normalizeVariance_ && !mvn_variance_kernel) || !mvn_kernel) {
@@ -1056,6 +1099,48 @@ void MKLDNNMVNNode::mvn_pln(const uint8_t* src_data, uint8_t* dst_data, const Si
     }
 }
 
+void MKLDNNMVNNode::mvn_fused(const float* src_data, const float* residual_data, float* dst_data) {
+    const size_t C = fusedRowSize_;
+    const float Cinv = 1.f / static_cast<float>(C);
+    const float *gamma = gamma_.data();
+    const float *beta = beta_.data();
+
+    parallel_for(fusedRowsNum_, [&](size_t r) {
+        const float *src = src_data + r * C;
+        float *dst = dst_data + r * C;
+
+        // the sum with the residual is stored to dst once, the following sweeps read the row from the cache
+        float mean = 0.f;
+        if (residual_data) {
+            const float *residual = residual_data + r * C;
+            for (size_t i = 0; i < C; i++) {
+                dst[i] = src[i] + residual[i];
+                mean += dst[i];
+            }
+            src = dst;
+        } else if (!rmsNorm_) {
+            for (size_t i = 0; i < C; i++)
+                mean += src[i];
+        }
+        mean = rmsNorm_ ? 0.f : mean * Cinv;
+
+        float scale = 1.f;
+        if (normalizeVariance_) {
+            float variance = 0.f;
+            for (size_t i = 0; i < C; i++)
+                variance += (src[i] - mean) * (src[i] - mean);
+            variance *= Cinv;
+            if (epsMode_ == INSIDE_SQRT)
+                scale = 1.f / sqrtf(variance + epsValue_);
+            else
+                scale = 1.f / (sqrtf(variance) + epsValue_);
+        }
+
+        for (size_t i = 0; i < C; i++)
+            dst[i] = (src[i] - mean) * scale * gamma[i] + beta[i];
+    });
+}
+
 void MKLDNNMVNNode::mvn_ref(const uint8_t* src_data, uint8_t* dst_data, const SizeVector& dims) {
     const float *src_data_ptr = reinterpret_cast<const float *>(src_data);
     float *dst_data_ptr = reinterpret_cast<float *>(dst_data);
@@ -1391,7 +1476,7 @@ void MKLDNNMVNNode::mvn_blk(const uint8_t* src_data, uint8_t* dst_data, const Si
 }
 
 bool MKLDNNMVNNode::canFuse(const MKLDNNNodePtr& node) const {
-    if (!mayiuse(cpu::x64::sse41)) {
+    if (!mayiuse(cpu::x64::sse41) || isFusedNorm()) {
         return false;
     }
     // limit post ops to unary when shape transformed on channel
@@ -1408,8 +1493,22 @@ bool MKLDNNMVNNode::canFuse(const MKLDNNNodePtr& node) const {
     return canFuseSimpleOperation(node);
 }
 
+bool MKLDNNMVNNode::canFuseResidualAndAffine() const {
+    if (!fusedWith.empty() || !getInputShapeAtPort(0).isStatic() || getInputShapeAtPort(0).getRank() < 2)
+        return false;
+    if (getOriginalInputPrecisionAtPort(0) != Precision::FP32 || getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+        return false;
+    return getNormalizedSize() > 1;
+}
+
+size_t MKLDNNMVNNode::getNormalizedSize() const {
+    const auto& dims = getInputShapeAtPort(0).getStaticDims();
+    if (dims.size() == 1)
+        return dims[0];
+    const size_t firstAxis = acrossChannels_ ? 1 : 2;
+    return std::accumulate(dims.begin() + firstAxis, dims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+}
+
 bool MKLDNNMVNNode::created() const {
     return getType() == MVN;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNMVNNode, MVN);
@@ -94,7 +94,26 @@ public:
 
     bool canFuse(const MKLDNNNodePtr& node) const override;
 
+    // LayerNorm and RMSNorm over the trailing axes may take the residual addition before and the affine transformation after
+    bool canFuseResidualAndAffine() const;
+    size_t getNormalizedSize() const;
+    void fuseResidual(size_t port) {
+        withResidual_ = true;
+        residualPort_ = port;
+    }
+    void fuseAffine(const std::vector<float>& gamma, const std::vector<float>& beta) {
+        gamma_ = gamma;
+        beta_ = beta;
+    }
+
 private:
+    // the fused residual, affine and RMSNorm cases are executed row by row on planar fp32 data
+    bool isFusedNorm() const {
+        return rmsNorm_ || withResidual_ || !gamma_.empty() || !beta_.empty();
+    }
+
+    void mvn_fused(const float *src_data, const float *residual_data, float *dst_data);
+
     void mvn_pln(const uint8_t *src_data, uint8_t *dst_data, const InferenceEngine::SizeVector &dims);
 
     void mvn_blk(const uint8_t *src_data, uint8_t *dst_data, const InferenceEngine::SizeVector &dims);
@@ -117,6 +136,14 @@ private:
     };
     MVNEpsMode epsMode_;
 
+    bool rmsNorm_ = false;
+    bool withResidual_ = false;
+    size_t residualPort_ = 0;
+    std::vector<float> gamma_;
+    std::vector<float> beta_;
+    size_t fusedRowsNum_ = 0;
+    size_t fusedRowSize_ = 0;
+
     InferenceEngine::Precision input_prec, output_prec;
     size_t src_data_size, dst_data_size;
 
@@ -14,6 +14,7 @@
 #include <ngraph/opsets/opset5.hpp>
 #include <ngraph_ops/nms_ie_internal.hpp>
 #include "utils/general_utils.h"
+#include "common/nms_kernel.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -102,6 +103,8 @@ MKLDNNNonMaxSuppressionNode::MKLDNNNonMaxSuppressionNode(const std::shared_ptr<n
             IE_THROW() << errorPrefix << "has unsupported 'valid_outputs' output rank: " << valid_outputs_shape.getRank();
         if (valid_outputs_shape.getDims()[0] != 1)
             IE_THROW() << errorPrefix << "has unsupported 'valid_outputs' output 1st dimension size: " << valid_outputs_shape.getDims()[1];
+
+        nmsKernel = std::make_shared<NmsKernel>(0.f, false);
 }
 
 void MKLDNNNonMaxSuppressionNode::initSupportedPrimitiveDescriptors() {
@@ -181,6 +184,8 @@ void MKLDNNNonMaxSuppressionNode::execute(mkldnn::stream strm) {
     const auto maxNumberOfBoxes = max_output_boxes_per_class * num_batches * num_classes;
     std::vector<filteredBoxes> filtBoxes(maxNumberOfBoxes);
 
+    convertBoxes(boxes, boxesStrides);
+
     if (soft_nms_sigma == 0.0f) {
         nmsWithoutSoftSigma(boxes, scores, boxesStrides, scoresStrides, filtBoxes);
     } else {
@@ -253,39 +258,26 @@ bool MKLDNNNonMaxSuppressionNode::created() const {
     return getType() == NonMaxSuppression;
 }
 
-float MKLDNNNonMaxSuppressionNode::intersectionOverUnion(const float *boxesI, const float *boxesJ) {
-    float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
-    if (boxEncodingType == boxEncoding::CENTER) {
-        //  box format: x_center, y_center, width, height
-        yminI = boxesI[1] - boxesI[3] / 2.f;
-        xminI = boxesI[0] - boxesI[2] / 2.f;
-        ymaxI = boxesI[1] + boxesI[3] / 2.f;
-        xmaxI = boxesI[0] + boxesI[2] / 2.f;
-        yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-        xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-        ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-        xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
-    } else {
-        //  box format: y1, x1, y2, x2
-        yminI = (std::min)(boxesI[0], boxesI[2]);
-        xminI = (std::min)(boxesI[1], boxesI[3]);
-        ymaxI = (std::max)(boxesI[0], boxesI[2]);
-        xmaxI = (std::max)(boxesI[1], boxesI[3]);
-        yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-        xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-        ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-        xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
-    }
-
-    float areaI = (ymaxI - yminI) * (xmaxI - xminI);
-    float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
-    if (areaI <= 0.f || areaJ <= 0.f)
-        return 0.f;
-
-    float intersection_area =
-            (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ), 0.f) *
-            (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ), 0.f);
-    return intersection_area / (areaI + areaJ - intersection_area);
+void MKLDNNNonMaxSuppressionNode::convertBoxes(const float *boxes, const VectorDims &boxesStrides) {
+    cornerBoxes.resize(num_batches * num_boxes);
+    parallel_for2d(num_batches, num_boxes, [&](size_t batch_idx, size_t box_idx) {
+        const float *box = boxes + batch_idx * boxesStrides[0] + box_idx * 4;
+        NmsBox &cornerBox = cornerBoxes[batch_idx * num_boxes + box_idx];
+        if (boxEncodingType == boxEncoding::CENTER) {
+            //  box format: x_center, y_center, width, height
+            cornerBox.ymin = box[1] - box[3] / 2.f;
+            cornerBox.xmin = box[0] - box[2] / 2.f;
+            cornerBox.ymax = box[1] + box[3] / 2.f;
+            cornerBox.xmax = box[0] + box[2] / 2.f;
+        } else {
+            //  box format: y1, x1, y2, x2
+            cornerBox.ymin = (std::min)(box[0], box[2]);
+            cornerBox.xmin = (std::min)(box[1], box[3]);
+            cornerBox.ymax = (std::max)(box[0], box[2]);
+            cornerBox.xmax = (std::max)(box[1], box[3]);
+        }
+        cornerBox.area = (cornerBox.ymax - cornerBox.ymin) * (cornerBox.xmax - cornerBox.xmin);
+    });
 }
 
 void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const float *scores, const VectorDims &boxesStrides,
@@ -301,14 +293,21 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
 
     parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
         std::vector<filteredBoxes> fb;
-        const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
+        const NmsBox *boxesPtr = cornerBoxes.data() + batch_idx * num_boxes;
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
+        std::unique_ptr<float[]> filteredScores(new float[num_boxes]);
+        std::unique_ptr<int[]> filteredIndices(new int[num_boxes]);
+        const size_t filteredNum = nmsKernel->filterScores(scoresPtr, num_boxes, score_threshold,
+                                                           filteredScores.get(), filteredIndices.get());
+
         std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
-        for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-            if (scoresPtr[box_idx] > score_threshold)
-                sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
-        }
+        for (size_t i = 0; i < filteredNum; i++)
+            sorted_boxes.emplace(boxInfo({filteredScores[i], filteredIndices[i], 0}));
+
+        const size_t capacity = (std::min)(filteredNum, max_output_boxes_per_class);
+        NmsSelectedBoxes selected(capacity);
+        std::unique_ptr<float[]> ious(new float[capacity + NmsSelectedBoxes::padding]);
 
         fb.reserve(sorted_boxes.size());
         if (sorted_boxes.size() > 0) {
@@ -317,9 +316,13 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
                 float origScore = currBox.score;
                 sorted_boxes.pop();
 
+                // IoU with all the boxes selected since the last visit are computed at once and consumed in reverse order
+                const size_t begin = currBox.suppress_begin_index;
+                nmsKernel->intersectionOverUnion(boxesPtr[currBox.idx], selected, begin, ious.get());
+
                 bool box_is_selected = true;
                 for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                    float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4]);
+                    float iou = ious[idx - begin];
                     currBox.score *= coeff(iou);
                     if (iou >= iou_threshold) {
                         box_is_selected = false;
@@ -333,6 +336,7 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
                 if (box_is_selected) {
                     if (currBox.score == origScore) {
                         fb.push_back({ currBox.score, batch_idx, class_idx, currBox.idx });
+                        selected.push_back(boxesPtr[currBox.idx]);
                         continue;
                     }
                     if (currBox.score > score_threshold) {
@@ -353,14 +357,18 @@ void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *boxes, const
                                                                 const VectorDims &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
     int max_out_box = static_cast<int>(max_output_boxes_per_class);
     parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
-        const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
+        const NmsBox *boxesPtr = cornerBoxes.data() + batch_idx * num_boxes;
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
+        std::unique_ptr<float[]> filteredScores(new float[num_boxes]);
+        std::unique_ptr<int[]> filteredIndices(new int[num_boxes]);
+        const size_t filteredNum = nmsKernel->filterScores(scoresPtr, num_boxes, score_threshold,
+                                                           filteredScores.get(), filteredIndices.get());
+
         std::vector<std::pair<float, int>> sorted_boxes;
-        for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-            if (scoresPtr[box_idx] > score_threshold)
-                sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
-        }
+        sorted_boxes.reserve(filteredNum);
+        for (size_t i = 0; i < filteredNum; i++)
+            sorted_boxes.emplace_back(std::make_pair(filteredScores[i], filteredIndices[i]));
 
         int io_selection_size = 0;
         if (sorted_boxes.size() > 0) {
@@ -369,20 +377,15 @@ void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *boxes, const
                               return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
                           });
             int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
+            NmsSelectedBoxes selected((std::min)(sorted_boxes.size(), max_output_boxes_per_class));
             filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
+            selected.push_back(boxesPtr[sorted_boxes[0].second]);
             io_selection_size++;
             for (size_t box_idx = 1; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
-                bool box_is_selected = true;
-                for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                    float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4]);
-                    if (iou >= iou_threshold) {
-                        box_is_selected = false;
-                        break;
-                    }
-                }
-
-                if (box_is_selected) {
+                const NmsBox &candidate = boxesPtr[sorted_boxes[box_idx].second];
+                if (!nmsKernel->isSuppressed(candidate, selected, iou_threshold)) {
                     filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
+                    selected.push_back(candidate);
                     io_selection_size++;
                 }
             }
@@ -417,6 +420,3 @@ void MKLDNNNonMaxSuppressionNode::checkOutput(const Shape& shape, const std::vec
     if (shape.getDims()[1] != 3)
         IE_THROW() << errorPrefix << "has unsupported '" << name << "' output 2nd dimension size: " << MemoryDescUtils::dim2str(shape.getDims()[1]);
 }
-
-
-REG_MKLDNN_PRIM_FOR(MKLDNNNonMaxSuppressionNode, NonMaxSuppression)
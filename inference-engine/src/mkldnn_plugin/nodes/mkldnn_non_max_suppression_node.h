@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include "common/nms_kernel.h"
 
 using namespace InferenceEngine;
 
@@ -42,8 +43,6 @@ public:
         int suppress_begin_index;
     };
 
-    float intersectionOverUnion(const float *boxesI, const float *boxesJ);
-
     void nmsWithSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides,
                           const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes);
 
@@ -94,8 +93,12 @@ private:
     std::string errorPrefix;
 
     std::vector<std::vector<size_t>> numFiltBox;
+    std::vector<NmsBox> cornerBoxes;
+    std::shared_ptr<NmsKernel> nmsKernel;
     const std::string inType = "input", outType = "output";
 
+    void convertBoxes(const float *boxes, const SizeVector &boxesStrides);
+
     void checkPrecision(const Precision& prec, const std::vector<Precision>& precList, const std::string& name, const std::string& type);
     void check1DInput(const Shape& shape, const std::vector<Precision>& precList, const std::string& name, const size_t port);
     void checkOutput(const Shape& shape, const std::vector<Precision>& precList, const std::string& name, const size_t port);
@@ -1383,5 +1383,3 @@ inline void MKLDNNNormalizeL2Node::apply_post_ops_scalar(float &dst_value, int i
 bool MKLDNNNormalizeL2Node::created() const {
     return getType() == NormalizeL2;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNNormalizeL2Node, NormalizeL2);
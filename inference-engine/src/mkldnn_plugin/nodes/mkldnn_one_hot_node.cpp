@@ -109,15 +109,13 @@ void MKLDNNOneHotNode::one_hot(size_t prefix_size, size_t suffix_size) {
     const out_type on_value = reinterpret_cast<const out_type *>(getParentEdgeAt(2)->getMemoryPtr()->GetPtr())[0];
     const out_type off_value = reinterpret_cast<const out_type *>(getParentEdgeAt(3)->getMemoryPtr()->GetPtr())[0];
 
-    // fill the output with off_value
-    std::size_t dst_size = prefix_size * depth * suffix_size;
-    std::fill(dst_data, dst_data + dst_size, off_value);
-
-    // set on_value at needed locations
+    // every thread fills its part of the output with off_value and sets on_value at needed locations,
+    // so the output is written once while it is in the cache
     auto on_val = on_value;
     parallel_for(prefix_size, [&](std::size_t prefix_idx) {
         const in_type* src_dataPtr = &src_data[prefix_idx * suffix_size];
         out_type* dst_dataPtr = &dst_data[prefix_idx * depth * suffix_size];
+        std::fill(dst_dataPtr, dst_dataPtr + depth * suffix_size, off_value);
         for (std::size_t suffix_idx = 0; suffix_idx < suffix_size; ++suffix_idx, ++src_dataPtr, ++dst_dataPtr) {
             auto v = static_cast<std::size_t>(*src_dataPtr);
             if (v < depth) {
@@ -147,5 +145,3 @@ void MKLDNNOneHotNode::execute(mkldnn::stream strm) {
 bool MKLDNNOneHotNode::created() const {
     return getType() == OneHot;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNOneHotNode, OneHot)
@@ -491,4 +491,3 @@ inline void MKLDNNPadNode::getDstIdx(const InferenceEngine::SizeVector& indexes,
 bool MKLDNNPadNode::created() const {
     return getType() == Pad;
 }
-REG_MKLDNN_PRIM_FOR(MKLDNNPadNode, Pad);
@@ -184,10 +184,11 @@ void MKLDNNPoolingNode::createPrimitive() {
 
     mkldnn::primitive_attr attr;
     setPostOps(attr, true);
+    setScratchpadMode(attr);
 
     auto prim_desc = createPrimitiveDescriptor<pooling_forward::primitive_desc, pooling_forward::desc>(attr);
 
-    prim.reset(new pooling_forward(prim_desc));
+    prim = createSharedPrimitive<pooling_forward>(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -397,5 +398,3 @@ void MKLDNNPoolingNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeight
 
     attr.set_post_ops(ops);
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNPoolingNode, Pooling);
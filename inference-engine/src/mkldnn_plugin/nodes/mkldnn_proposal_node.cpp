@@ -197,5 +197,3 @@ void MKLDNNProposalNode::execute(mkldnn::stream strm) {
 bool MKLDNNProposalNode::created() const {
     return getType() == Proposal;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNProposalNode, Proposal)
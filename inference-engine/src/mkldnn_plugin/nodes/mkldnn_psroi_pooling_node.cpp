@@ -558,5 +558,3 @@ void MKLDNNPSROIPoolingNode::execute(mkldnn::stream strm) {
 bool MKLDNNPSROIPoolingNode::created() const {
     return getType() == PSROIPooling;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNPSROIPoolingNode, PSROIPooling)
@@ -138,5 +138,3 @@ InferenceEngine::StatusCode MKLDNNRangeNode::rangeKernel() noexcept {
 bool MKLDNNRangeNode::created() const {
     return getType() == Range;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNRangeNode, Range)
@@ -11,6 +11,7 @@
 #include <set>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "mkldnn_kernel_cache.hpp"
 #include "utils/bfloat16.hpp"
 #include "emitters/jit_bf16_emitters.hpp"
 #include "ie_parallel.hpp"
@@ -1530,26 +1531,27 @@ void MKLDNNReduceNode::createPrimitive() {
     jcp.planar_layout = planar_layout;
     jcp.reduce_mode = getAlgorithm();
 
+    // the reduce kernels have no post ops, so the nodes with the same params share them
+    std::string key;
+    appendKernelKey(key, jcp.planar_layout);
+    appendKernelKey(key, jcp.reduce_mode);
+    appendKernelKey(key, jcp.src_dt);
+    appendKernelKey(key, jcp.dst_dt);
+
     if (mayiuse(cpu::x64::avx512_common)) {
-        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::avx512_common>(jcp));
-        reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::x64::avx512_common>(jcp));
+        reduce_kernel = createSharedKernel<jit_uni_reduce_kernel, jit_uni_reduce_kernel_f32<cpu::x64::avx512_common>>(key, jcp);
+        reduce_post_kernel = createSharedKernel<jit_uni_reduce_post_kernel, jit_uni_reduce_post_kernel_f32<cpu::x64::avx512_common>>(key, jcp);
         blk_size = 16;
     } else if (mayiuse(cpu::x64::avx2)) {
-        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::avx2>(jcp));
-        reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::x64::avx2>(jcp));
+        reduce_kernel = createSharedKernel<jit_uni_reduce_kernel, jit_uni_reduce_kernel_f32<cpu::x64::avx2>>(key, jcp);
+        reduce_post_kernel = createSharedKernel<jit_uni_reduce_post_kernel, jit_uni_reduce_post_kernel_f32<cpu::x64::avx2>>(key, jcp);
         blk_size = 8;
     } else if (mayiuse(cpu::x64::sse41)) {
-        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::sse41>(jcp));
-        reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::x64::sse41>(jcp));
+        reduce_kernel = createSharedKernel<jit_uni_reduce_kernel, jit_uni_reduce_kernel_f32<cpu::x64::sse41>>(key, jcp);
+        reduce_post_kernel = createSharedKernel<jit_uni_reduce_post_kernel, jit_uni_reduce_post_kernel_f32<cpu::x64::sse41>>(key, jcp);
         blk_size = 8;
     }
 
-    if (reduce_kernel)
-        reduce_kernel->create_ker();
-
-    if (reduce_post_kernel)
-        reduce_post_kernel->create_ker();
-
     jit_mode = jit_mode && reduce_kernel;
 }
 
@@ -1628,53 +1630,41 @@ void MKLDNNReduceNode::reduce_PLN(const uint8_t *in_ptr, uint8_t *out_ptr) {
                 size_t oc = ic, od = id; GET_PTR_NCD_BASE_PTR_N_PLN;
                 reduce_kernel_process(in_ptr_ncd, out_ptr_ncd, IH * IW, 1);
             });
-        } else if (ReduceH && ReduceW) {
-            for (size_t ic = 0; ic < IC; ic++) {
-                size_t oc = ReduceC ? 0 : ic; GET_PTR_NC_PLN;
-                for (size_t id = 0; id < ID; id++) {
-                    size_t od = ReduceD ? 0 : id; GET_PTR_NCD_PLN;
-                    reduce_kernel_process(in_ptr_ncd, out_ptr_ncd, IH * IW, 1);
-                }
-            }
-        } else if (!ReduceH && ReduceW) {
-            for (size_t ic = 0; ic < IC; ic++) {
-                size_t oc = ReduceC ? 0 : ic; GET_PTR_NC_PLN;
-                for (size_t id = 0; id < ID; id++) {
-                    size_t od = ReduceD ? 0 : id; GET_PTR_NCD_PLN;
-                    parallel_for(IH, [&](size_t ih){
-                        size_t oh = ih; GET_PTR_NCDH_PLN;
-                        reduce_kernel_process(in_ptr_ncdh, out_ptr_ncdh, IW, 1);
-                    });
-                }
-            }
-        } else if (ReduceW) {
-            for (size_t ic = 0; ic < IC; ic++) {
-                size_t oc = ReduceC ? 0 : ic; GET_PTR_NC_PLN;
-                for (size_t id = 0; id < ID; id++) {
-                    size_t od = ReduceD ? 0 : id; GET_PTR_NCD_PLN;
-                    for (size_t ih = 0; ih < IH; ih++) {
-                        size_t oh = ReduceH ? 0 : ih; GET_PTR_NCDH_PLN;
-                        reduce_kernel_process(in_ptr_ncdh, out_ptr_ncdh, IW, 1);
-                    }
-                }
-            }
         } else {
-            for (size_t ic = 0; ic < IC; ic++) {
-                size_t oc = ReduceC ? 0 : ic; GET_PTR_NC_PLN;
-                for (size_t id = 0; id < ID; id++) {
-                    size_t od = ReduceD ? 0 : id; GET_PTR_NCD_PLN;
-                    for (size_t ih = 0; ih < IH; ih++) {
-                        size_t oh = ReduceH ? 0 : ih; GET_PTR_NCDH_PLN;
-                        for (size_t ibw = 0; ibw < IW / blk_size; ibw++) {
-                            size_t obw = ibw;
-                            reduce_kernel_process(in_ptr_ncdh + ibw * blk_size * src_data_size,
-                                                  out_ptr_ncdh + obw * blk_size * dst_data_size, blk_size, 0);
+            // The kept dims are split between the threads and each thread accumulates all the reduced dims of its outputs,
+            // so any combination of the reduced axes is done in a single pass. If the width is kept, it is vectorized
+            // and split into the chunks of the vector length multiple to occupy the threads.
+            const size_t KC = ReduceC ? 1 : IC, KD = ReduceD ? 1 : ID, KH = ReduceH ? 1 : IH;
+            const size_t RC = ReduceC ? IC : 1, RD = ReduceD ? ID : 1, RH = ReduceH ? IH : 1;
+            size_t w_chunk = IW;
+            if (!ReduceW) {
+                const size_t threads_per_row = div_up(static_cast<size_t>(parallel_get_max_threads()), KC * KD * KH);
+                w_chunk = rnd_up(div_up(IW, threads_per_row), blk_size);
+            }
+            const size_t KW = div_up(IW, w_chunk);
+            parallel_for4d(KC, KD, KH, KW, [&](size_t kc, size_t kd, size_t kh, size_t kw) {
+                const size_t w_start = kw * w_chunk;
+                const size_t w_work = std::min(w_chunk, IW - w_start);
+                for (size_t rc = 0; rc < RC; rc++) {
+                    size_t ic = ReduceC ? rc : kc, oc = kc; GET_PTR_NC_PLN;
+                    for (size_t rd = 0; rd < RD; rd++) {
+                        size_t id = ReduceD ? rd : kd, od = kd; GET_PTR_NCD_PLN;
+                        if (ReduceH && ReduceW) {
+                            reduce_kernel_process(in_ptr_ncd, out_ptr_ncd, IH * IW, 1);
+                            continue;
+                        }
+                        for (size_t rh = 0; rh < RH; rh++) {
+                            size_t ih = ReduceH ? rh : kh, oh = kh; GET_PTR_NCDH_PLN;
+                            if (ReduceW) {
+                                reduce_kernel_process(in_ptr_ncdh, out_ptr_ncdh, IW, 1);
+                            } else {
+                                reduce_kernel_process(in_ptr_ncdh + w_start * src_data_size, out_ptr_ncdh + w_start * dst_data_size,
+                                                      w_work, 0);
+                            }
                         }
-                        size_t tail_start = IW / blk_size * blk_size;
-                        reduce_kernel_process(in_ptr_ncdh + tail_start * src_data_size, out_ptr_ncdh + tail_start * dst_data_size, IW - tail_start, 0);
                     }
                 }
-            }
+            });
         }
     }
 
@@ -2093,5 +2083,3 @@ inline void MKLDNNReduceNode::reduce_ref_map(float *out_ptr, size_t work_amount_
 bool MKLDNNReduceNode::created() const {
     return getType() == Reduce;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNReduceNode, Reduce);
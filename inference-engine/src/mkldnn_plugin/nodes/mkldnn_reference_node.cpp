@@ -20,8 +20,8 @@ MKLDNNReferenceNode::MKLDNNReferenceNode(const std::shared_ptr<ngraph::Node>& op
     if (!op->has_evaluate()) {
         IE_THROW(NotImplemented) << "Cannot fallback on ngraph reference implementation (Ngraph::Node::evaluate() is not implemented)";
     }
+    // type string keeps the original operation type, so the fallbacks are distinguishable in the performance counters
     setType(Reference);
-    setTypeStr("Reference");
 }
 
 void MKLDNNReferenceNode::getSupportedDescriptors() {}
@@ -23,6 +23,11 @@ public:
     bool needPrepareParams() const override { return false; }
     void executeDynamicImpl(mkldnn::stream strm) override;
 
+    /**
+     * @brief Explains why the operation is not supported natively, e.g. messages of the native nodes rejecting it
+     */
+    const std::string& getFallbackReason() const { return additionalErrorMessage; }
+
 private:
     const std::shared_ptr<ngraph::Node> ngraphOp;
     const std::string additionalErrorMessage;
@@ -430,5 +430,3 @@ void MKLDNNRegionYoloNode::execute(mkldnn::stream strm) {
 bool MKLDNNRegionYoloNode::created() const {
     return getType() == RegionYolo;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNRegionYoloNode, RegionYolo)
@@ -121,7 +121,8 @@ void MKLDNNReorderNode::prepareParams() {
             canUseNspc2Ncsp = inDims[1] <= 64 && inDims[1] >= 16 &&
                               (srcMemPtr->GetDescWithType<BlockedMemoryDesc>()->getPaddedElementsCount() / inDims[1]) >= 128;
         }
-        if (!canUseNcsp2Nspc && !canUseNspc2Ncsp) {
+        reorderKernel.reset();
+        if (!canUseNcsp2Nspc && !canUseNspc2Ncsp && !createReorderKernel(srcMemPtr->getDesc(), dstMemPtr->getDesc())) {
             auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
             auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
             if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
@@ -137,6 +138,63 @@ void MKLDNNReorderNode::prepareParams() {
     }
 }
 
+bool MKLDNNReorderNode::createReorderKernel(const MemoryDesc &srcDesc, const MemoryDesc &dstDesc) {
+    auto isSupportedDesc = [](const MemoryDesc &desc) {
+        bool isSupported = desc.isDefined() && (desc.getType() & MemoryDescType::Blocked);
+        if (desc.getType() == MemoryDescType::DnnlBlocked)
+            isSupported &= desc.as<const DnnlMemoryDesc>()->hasEmptyExtraData();
+        return isSupported;
+    };
+    if (!isSupportedDesc(srcDesc) || !isSupportedDesc(dstDesc))
+        return false;
+
+    const auto &srcBlockedDesc = *srcDesc.as<BlockedMemoryDesc>();
+    const auto &dstBlockedDesc = *dstDesc.as<BlockedMemoryDesc>();
+    if (srcBlockedDesc.getOffsetPadding() != 0 || dstBlockedDesc.getOffsetPadding() != 0)
+        return false;
+
+    ReorderParams params;
+    params.dims = srcDesc.getShape().getStaticDims();
+    params.src_block_dims = srcBlockedDesc.getBlockDims();
+    params.src_block_order = srcBlockedDesc.getOrder();
+    params.src_strides = srcBlockedDesc.getStrides();
+    params.dst_block_dims = dstBlockedDesc.getBlockDims();
+    params.dst_block_order = dstBlockedDesc.getOrder();
+    params.dst_strides = dstBlockedDesc.getStrides();
+    params.src_prc = srcDesc.getPrecision();
+    params.dst_prc = dstDesc.getPrecision();
+    // plain copies with the same precision are left to oneDNN reorder
+    if (params.src_prc == params.dst_prc && params.src_block_order == params.dst_block_order &&
+        params.src_block_dims == params.dst_block_dims)
+        return false;
+    if (dstDesc.getShape().getStaticDims() != params.dims)
+        return false;
+
+    auto builder = [&params]() {
+        return std::make_shared<ReorderKernel>(params);
+    };
+    std::shared_ptr<ReorderKernel> kernel;
+    if (paramsCache) {
+        // the kernel depends only on the source and destination layouts
+        std::string key = "jit_reorder";
+        for (const auto* dims : {&params.dims, &params.src_block_dims, &params.src_block_order, &params.src_strides,
+                                 &params.dst_block_dims, &params.dst_block_order, &params.dst_strides}) {
+            key.append(reinterpret_cast<const char*>(dims->data()), dims->size() * sizeof(size_t));
+            key.push_back('|');
+        }
+        key.append(params.src_prc.name()).append(params.dst_prc.name());
+        kernel = paramsCache->getOrCreate<ReorderKernel>(key, builder);
+    } else {
+        kernel = builder();
+    }
+    if (!kernel->isSupported())
+        return false;
+
+    reorderKernel = kernel;
+    supportedPrimitiveDescriptors[0].setImplementationType(reorderKernel->getImplType());
+    return true;
+}
+
 void MKLDNNReorderNode::createReorderPrimitive(const mkldnn::memory::desc &srcDesc, void* srcPtr, const mkldnn::memory::desc &dstDesc, void* dstPtr) {
     src_blocked = std::make_shared<MKLDNNMemory>(getEngine());
     src_blocked->Create(MKLDNNExtensionUtils::makeDescriptor(srcDesc), srcPtr, false);
@@ -144,49 +202,67 @@ void MKLDNNReorderNode::createReorderPrimitive(const mkldnn::memory::desc &srcDe
     dst_blocked = std::make_shared<MKLDNNMemory>(getEngine());
     dst_blocked->Create(MKLDNNExtensionUtils::makeDescriptor(dstDesc), dstPtr, false);
 
-    mkldnn::primitive_attr attr;
-    auto createReorder = [&]() -> bool {
-        // No autoblocking. Reorder can be applied as is
-        reorder::primitive_desc pd = mkldnn::reorder::primitive_desc(src_blocked->GetPrimitive(), dst_blocked->GetPrimitive(), attr, true);
-
-        if (!pd)
-            return false;
-
-        auto info = pd.impl_info_str();
-        supportedPrimitiveDescriptors[0].setImplementationType(parse_impl_name(info));
-
-        prim.reset(new mkldnn::reorder(pd));
-        return true;
-    };
+    auto builder = [&]() -> std::shared_ptr<ReorderPrimitive> {
+        mkldnn::primitive_attr attr;
+        auto createReorder = [&]() -> std::shared_ptr<ReorderPrimitive> {
+            // No autoblocking. Reorder can be applied as is
+            reorder::primitive_desc pd = mkldnn::reorder::primitive_desc(src_blocked->GetPrimitive(), dst_blocked->GetPrimitive(), attr, true);
+
+            if (!pd)
+                return nullptr;
+
+            auto result = std::make_shared<ReorderPrimitive>();
+            result->prim = std::make_shared<mkldnn::reorder>(pd);
+            result->srcDesc = src_blocked->GetPrimitive().get_desc();
+            result->implType = parse_impl_name(pd.impl_info_str());
+            return result;
+        };
+
+        auto result = createReorder();
+        if (!result) {
+            // TODO: We should keep shape consistency for const and expected shape for node.
+            //       If it requires reshape operation it should explicitly injected into graph.
+            //
+            // There is a limitation for IE representing of weights for grouped convolutions. IE doesn't
+            // split group dimension in separate shape dimension. IE use OIHW, but mkldnn expect GOIHW.
+            // So we will perform implicit reshape to dst shape.
+            //
+            // MKLDNN doesn't support direct reorders for tensors of different rank. The code below tries to
+            // perform such conversion if the source tensor can be reshaped to the destination rank. This is
+            // useful in situations when rank in IR does not much rank that is required by the oneDNN primitive,
+            // but the input tensor can be reshaped (e.g. weights for grouped convolutions, biases etc.)
+            if (src_blocked->getDesc().hasLayoutType(LayoutType::ncsp) &&
+                src_blocked->GetShape().getRank() != dst_blocked->GetShape().getRank()) {
+                const auto newDims = dst_blocked->getStaticDims();
+                const auto newFormat = MKLDNNExtensionUtils::GetPlainFormatByRank(newDims.size());
+
+                auto newDesc = mkldnn::memory::desc(MKLDNNExtensionUtils::convertToDnnlDims(newDims), src_blocked->GetDataType(), newFormat);
+                src_blocked->Create(MKLDNNExtensionUtils::makeDescriptor(newDesc), srcPtr, false);
+
+                result = createReorder();
+            }
+        }
 
-    auto success = createReorder();
-    if (!success) {
-        // TODO: We should keep shape consistency for const and expected shape for node.
-        //       If it requires reshape operation it should explicitly injected into graph.
-        //
-        // There is a limitation for IE representing of weights for grouped convolutions. IE doesn't
-        // split group dimension in separate shape dimension. IE use OIHW, but mkldnn expect GOIHW.
-        // So we will perform implicit reshape to dst shape.
-        //
-        // MKLDNN doesn't support direct reorders for tensors of different rank. The code below tries to
-        // perform such conversion if the source tensor can be reshaped to the destination rank. This is
-        // useful in situations when rank in IR does not much rank that is required by the oneDNN primitive,
-        // but the input tensor can be reshaped (e.g. weights for grouped convolutions, biases etc.)
-        if (src_blocked->getDesc().hasLayoutType(LayoutType::ncsp) &&
-            src_blocked->GetShape().getRank() != dst_blocked->GetShape().getRank()) {
-            const auto newDims = dst_blocked->getStaticDims();
-            const auto newFormat = MKLDNNExtensionUtils::GetPlainFormatByRank(newDims.size());
-
-            auto newDesc = mkldnn::memory::desc(MKLDNNExtensionUtils::convertToDnnlDims(newDims), src_blocked->GetDataType(), newFormat);
-            src_blocked->Create(MKLDNNExtensionUtils::makeDescriptor(newDesc), srcPtr, false);
-
-            success = createReorder();
+        if (!result) {
+            IE_THROW() << "Cannot create reorder primitive: unsupported reorder case";
         }
-    }
+        return result;
+    };
 
-    if (!success) {
-        IE_THROW() << "Cannot create reorder primitive: unsupported reorder case";
+    std::shared_ptr<ReorderPrimitive> reorderPrim;
+    if (paramsCache) {
+        // reorder primitive depends only on the source and destination descriptors
+        std::string key = getName();
+        key.append(reinterpret_cast<const char*>(&srcDesc.data), sizeof(srcDesc.data));
+        key.append(reinterpret_cast<const char*>(&dstDesc.data), sizeof(dstDesc.data));
+        reorderPrim = paramsCache->getOrCreate<ReorderPrimitive>(key, builder);
+        if (reorderPrim->srcDesc != src_blocked->GetPrimitive().get_desc())
+            src_blocked->Create(MKLDNNExtensionUtils::makeDescriptor(reorderPrim->srcDesc), srcPtr, false);
+    } else {
+        reorderPrim = builder();
     }
+    supportedPrimitiveDescriptors[0].setImplementationType(reorderPrim->implType);
+    prim = reorderPrim->prim;
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -269,6 +345,10 @@ void MKLDNNReorderNode::execute(mkldnn::stream strm) {
         optimizedNspc2Ncsp();
     } else if (canUseNcsp2Nspc) {
         optimizedNcsp2Nspc();
+    } else if (reorderKernel) {
+        const auto *srcData = reinterpret_cast<const uint8_t *>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+        auto *dstData = reinterpret_cast<uint8_t *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+        reorderKernel->execute(srcData, dstData, batchToProcess());
     } else {
         src_blocked->GetPrimitivePtr()->set_data_handle(getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle());
         dst_blocked->GetPrimitivePtr()->set_data_handle(getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle());
@@ -323,7 +403,7 @@ void MKLDNNReorderNode::reorderData(const MKLDNNMemory &input, const MKLDNNMemor
         auto dstPtr = static_cast<uint8_t*>(output.GetPtr());
 
         auto copySize = size == 0 ? output.GetSize() : size;
-        cpu_memcpy(dstPtr, srcPtr, copySize);
+        cpu_parallel_memcpy(dstPtr, srcPtr, copySize);
     } else {
         std::unique_ptr<mkldnn::reorder> pReorder;
         std::shared_ptr<mkldnn::memory> srcMemoryPtr;
@@ -367,5 +447,3 @@ void MKLDNNReorderNode::reorderData(const MKLDNNMemory &input, const MKLDNNMemor
 std::vector<VectorDims> MKLDNNReorderNode::shapeInfer() const {
     return {getParentEdgesAtPort(0)[0]->getMemory().getStaticDims()};
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNReorderNode, Reorder);
@@ -10,6 +10,7 @@
 #include <memory>
 #include <vector>
 #include <utils/general_utils.h>
+#include "common/reorder_kernel.h"
 
 namespace MKLDNNPlugin {
 
@@ -70,14 +71,25 @@ private:
     MKLDNNMemoryPtr dst_blocked;
     MKLDNNMemoryPtr src_blocked;
 
+    struct ReorderPrimitive {
+        std::shared_ptr<mkldnn::primitive> prim;
+        // may differ from the node input descriptor if implicit reshape was applied
+        mkldnn::memory::desc srcDesc;
+        impl_desc_type implType;
+    };
+
     bool isOptimized = false;
 
+    // fused layout permutation and precision conversion, used instead of oneDNN reorder when supported
+    std::shared_ptr<ReorderKernel> reorderKernel;
+
     bool isNspc2NcspCase = false;
     bool canUseNspc2Ncsp = false;
     bool canUseNcsp2Nspc = false;
 
     void optimizedNspc2Ncsp();
     void optimizedNcsp2Nspc();
+    bool createReorderKernel(const MemoryDesc &srcDesc, const MemoryDesc &dstDesc);
     void createReorderPrimitive(const mkldnn::memory::desc &srcDesc, void* srcPtr, const mkldnn::memory::desc &dstDesc, void* dstPtr);
 };
 
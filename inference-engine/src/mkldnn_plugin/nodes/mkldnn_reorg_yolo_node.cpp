@@ -92,5 +92,3 @@ void MKLDNNReorgYoloNode::execute(mkldnn::stream strm) {
 bool MKLDNNReorgYoloNode::created() const {
     return getType() == ReorgYolo;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNReorgYoloNode, ReorgYolo)
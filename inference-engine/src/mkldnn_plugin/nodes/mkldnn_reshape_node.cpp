@@ -96,4 +96,3 @@ void MKLDNNReshapeNode::createPrimitive() {
 bool MKLDNNReshapeNode::created() const {
     return getType() == Reshape;
 }
-REG_MKLDNN_PRIM_FOR(MKLDNNReshapeNode, Reshape);
@@ -183,5 +183,3 @@ void MKLDNNReverseSequenceNode::execute(mkldnn::stream strm) {
 bool MKLDNNReverseSequenceNode::created() const {
     return getType() == ReverseSequence;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNReverseSequenceNode, ReverseSequence)
@@ -8,11 +8,17 @@
 #include "nodes/common/cpu_convert.h"
 #include "utils/bfloat16.hpp"
 #include "mkldnn_input_node.h"
+#include "mkldnn_fake_quantize_node.h"
 #include <mkldnn_extension_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "memory_desc/cpu_memory_desc_utils.h"
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include "ie_parallel.hpp"
 
 #include <ngraph/node.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <utility>
 
@@ -387,14 +393,45 @@ void MKLDNNRNN::initSeq(const std::shared_ptr<ngraph::Node>& op) {
     out_data_d.reserve(S + 1);
 }
 
+void MKLDNNRNN::initQuantization() {
+    quantized = false;
+    if (cell_type != mkldnn::algorithm::vanilla_lstm || runtimePrecision != Precision::FP32 ||
+            !impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core))
+        return;
+
+    // The data produced by the FakeQuantize are exactly q * outputScale + outputShift for the integer q in [0, 255],
+    // so the u8 data are restored without a loss. The hidden state is quantized by oneDNN on the same grid,
+    // that is why the grid has to cover the whole range of tanh.
+    auto parent = getParentEdgesAtPort(0)[0]->getParent();
+    const auto& parentFused = parent->getFusedWith();
+    auto fakeQuantize = std::dynamic_pointer_cast<MKLDNNFakeQuantizeNode>(parentFused.empty() ? parent : parentFused.back());
+    if (!fakeQuantize || fakeQuantize->isBinarization() || fakeQuantize->getLevels() != 256)
+        return;
+
+    const auto& outputScale = fakeQuantize->getOutputScale();
+    const auto& outputShift = fakeQuantize->getOutputShift();
+    if (outputScale.size() != 1 || outputShift.size() != 1 || outputScale[0] <= 0.f)
+        return;
+    const float low = outputShift[0];
+    const float high = outputShift[0] + 255.f * outputScale[0];
+    if (low > -1.f || high < 1.f)
+        return;
+
+    dataScale = 1.f / outputScale[0];
+    dataShift = -outputShift[0] / outputScale[0];
+    quantized = true;
+}
+
 void MKLDNNRNN::fillSeqDesc() {
     runtimePrecision = getOriginalInputPrecisionAtPort(0);
     auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
 
     Shape S_4D_shape(VectorDims{L, D, N, SC});
 
+    initQuantization();
+
     // Try to create descriptor and corresponding configuration
-    in_data_d.emplace_back(Shape(VectorDims{in_data_dims}),  dataType, memory::format_tag::tnc);
+    in_data_d.emplace_back(Shape(VectorDims{in_data_dims}), quantized ? memory::data_type::u8 : dataType, memory::format_tag::tnc);
     out_data_d.emplace_back(Shape(VectorDims{out_data_dims}), dataType, memory::format_tag::tnc);
 
     in_data_d.emplace_back(S_4D_shape, dataType, memory::format_tag::ldnc);
@@ -641,10 +678,13 @@ void MKLDNNRNN::copyWeightsData() {
 void MKLDNNRNN::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                  const std::vector<MemoryDescPtr> &outputDesc) {
     auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
+    // the s8 weights are kept in the oneDNN packed format with the compensation
+    auto weightsType = quantized ? memory::data_type::s8 : dataType;
+    auto weightsFormat = quantized ? memory::format_tag::any : w_format;
     auto weightsDims = MKLDNNExtensionUtils::convertToDnnlDims(VectorDims{ L, D, DC, G, SC });
-    mkldnn::memory::desc w_data_d(weightsDims, dataType, w_format);
+    mkldnn::memory::desc w_data_d(weightsDims, weightsType, weightsFormat);
     auto statesDims = MKLDNNExtensionUtils::convertToDnnlDims(VectorDims{ L, D, SC, G, SC });
-    mkldnn::memory::desc w_state_d(statesDims, dataType, w_format);
+    mkldnn::memory::desc w_state_d(statesDims, weightsType, weightsFormat);
     auto biasDims = MKLDNNExtensionUtils::convertToDnnlDims(VectorDims{ L, D, Gb, SC });
     mkldnn::memory::desc w_bias_d(biasDims, memory::data_type::f32, memory::format_tag::ldgo);
 
@@ -725,7 +765,60 @@ void MKLDNNRNN::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
     supportedPrimitiveDescriptors.emplace_back(config, ref_any);
 }
 
+void MKLDNNRNN::createQuantizedPrimitive() {
+    // The weights scales are per gate output channel and common for the layer and the iteration weights,
+    // oneDNN dequantizes the s32 accumulators with them and with the data scale.
+    const size_t OC = G * SC;
+    const auto wLayer = internalBlobs[0]->cbuffer().as<const float*>();
+    const auto wIter = internalBlobs[1]->cbuffer().as<const float*>();
+    std::vector<float> weightsScales(OC, 0.f);
+    for (size_t i = 0; i < DC; i++)
+        for (size_t o = 0; o < OC; o++)
+            weightsScales[o] = std::max(weightsScales[o], std::abs(wLayer[i * OC + o]));
+    for (size_t i = 0; i < SC; i++)
+        for (size_t o = 0; o < OC; o++)
+            weightsScales[o] = std::max(weightsScales[o], std::abs(wIter[i * OC + o]));
+    for (auto& scale : weightsScales)
+        scale = scale > 0.f ? 127.f / scale : 1.f;
+
+    mkldnn::primitive_attr attr;
+    attr.set_rnn_data_qparams(dataScale, dataShift);
+    // the scales vary over the gates and the output channels dims of ldigo
+    attr.set_rnn_weights_qparams((1 << 3) | (1 << 4), weightsScales);
+
+    std::shared_ptr<lstm_forward::desc> desc = descs[0];
+    lstm_forward::primitive_desc prim_desc(*desc, attr, engine);
+
+    auto createWeights = [&](const Blob::Ptr& blob, const mkldnn::memory::desc& dstDesc, bool quantize) {
+        MKLDNNMemory src(engine);
+        src.Create(MemoryDescUtils::convertToDnnlBlockedMemoryDesc(blob->getTensorDesc()), blob->buffer());
+        MKLDNNMemoryPtr dst = std::make_shared<MKLDNNMemory>(engine);
+        dst->Create(MKLDNNExtensionUtils::makeDescriptor(dstDesc));
+        if (quantize) {
+            mkldnn::reorder::primitive_desc reorder_pd(src.GetPrimitive(), dst->GetPrimitive(), attr);
+            mkldnn::stream loc_stream(engine, mkldnn::stream::flags::in_order);
+            mkldnn::reorder(reorder_pd).execute(loc_stream, src.GetPrimitive(), dst->GetPrimitive());
+        } else {
+            dst->SetData(src);
+        }
+        return dst;
+    };
+
+    internalBlobMemory.clear();
+    internalBlobMemory.push_back(createWeights(internalBlobs[0], prim_desc.weights_layer_desc(), true));
+    internalBlobMemory.push_back(createWeights(internalBlobs[1], prim_desc.weights_iter_desc(), true));
+    internalBlobMemory.push_back(createWeights(internalBlobs[2], prim_desc.bias_desc(), false));
+
+    quantizedSrc.resize(getParentEdgeAt(0)->getMemory().GetShape().getElementsCount());
+    prim.reset(new lstm_forward(prim_desc));
+}
+
 void MKLDNNRNN::createPrimitive() {
+    if (quantized) {
+        createQuantizedPrimitive();
+        return;
+    }
+
     if (cell_type == mkldnn::algorithm::vanilla_rnn) {
         auto prim_desc = createPrimitiveDescriptor<vanilla_rnn_forward::primitive_desc, vanilla_rnn_forward::desc>();
         prim.reset(new vanilla_rnn_forward(prim_desc));
@@ -764,8 +857,22 @@ void MKLDNNRNN::execute(mkldnn::stream strm) {
     const auto &wgh_stat_mem = internalBlobMemory[1];
     const auto &wgh_bias_mem = internalBlobMemory[2];
 
+    mkldnn::memory src_data = src_data_mem->GetPrimitive();
+    if (quantized) {
+        // the same layout as the input, the values are put back on the u8 grid of the FakeQuantize
+        const auto src = reinterpret_cast<const float*>(src_data_mem->GetPtr());
+        auto dst = quantizedSrc.data();
+        parallel_for(quantizedSrc.size(), [&](size_t i) {
+            const float q = std::nearbyint(src[i] * dataScale + dataShift);
+            dst[i] = static_cast<uint8_t>(std::min(std::max(q, 0.f), 255.f));
+        });
+        auto quantizedDesc = src_data.get_desc();
+        quantizedDesc.data.data_type = dnnl_u8;
+        src_data = mkldnn::memory(quantizedDesc, engine, dst);
+    }
+
     std::unordered_map<int, memory> args {
-        {DNNL_ARG_SRC_LAYER,     src_data_mem->GetPrimitive()},
+        {DNNL_ARG_SRC_LAYER,     src_data},
         {DNNL_ARG_WEIGHTS_LAYER, wgh_data_mem->GetPrimitive()},
         {DNNL_ARG_WEIGHTS_ITER,  wgh_stat_mem->GetPrimitive()},
         {DNNL_ARG_BIAS,          wgh_bias_mem->GetPrimitive()},
@@ -794,6 +901,4 @@ void MKLDNNRNN::execute(mkldnn::stream strm) {
     (*prim).execute(strm, args);
 }
 
-REG_MKLDNN_PRIM_FOR(MKLDNNRNN, RNNCell);
-REG_MKLDNN_PRIM_FOR(MKLDNNRNN, RNNSeq);
 }  // namespace MKLDNNPlugin
@@ -46,6 +46,9 @@ private:
 
     void copyWeightsData();
 
+    void initQuantization();
+    void createQuantizedPrimitive();
+
 private:
     InferenceEngine::Precision runtimePrecision;
     /** Specify mode Cell or Seq. true - Cell, false - Seq */
@@ -89,6 +92,12 @@ private:
     std::vector<size_t > in_data_dims;
     std::vector<size_t > out_data_dims;
 
+    /** INT8 mode: the sequence data is taken on the u8 grid of the parent FakeQuantize, the weights are s8 */
+    bool quantized = false;
+    float dataScale = 1.f;
+    float dataShift = 0.f;
+    std::vector<uint8_t> quantizedSrc;
+
     size_t wIdx = 0;
     size_t rIdx = 0;
     size_t bIdx = 0;
@@ -14,15 +14,166 @@
 #include "ie_parallel.hpp"
 #include <mkldnn_selective_build.h>
 #include <ngraph/opsets/opset3.hpp>
+#include "emitters/jit_load_store_emitters.hpp"
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace mkldnn;
+using namespace mkldnn::impl;
 using namespace mkldnn::impl::cpu;
 using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
 
 using ngPoolingMode = ngraph::op::v3::ROIAlign::PoolingMode;
 
+#define GET_OFF(field) offsetof(jit_roi_align_call_args, field)
+
+template <cpu_isa_t isa>
+struct jit_uni_roi_align_kernel_f32 : public jit_uni_roi_align_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_roi_align_kernel_f32);
+
+    explicit jit_uni_roi_align_kernel_f32(jit_roi_align_params jcp) : jit_uni_roi_align_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    };
+
+    void generate() override {
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_offsets, ptr[reg_params + GET_OFF(offsets)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_num_samples, ptr[reg_params + GET_OFF(num_samples)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        if (jcp_.alg == Algorithm::ROIAlignAvg) {
+            mov(reg_aux, ptr[reg_params + GET_OFF(scale)]);
+            uni_vbroadcastss(vmm_scale, ptr[reg_aux]);
+        }
+
+        Label main_loop_label;
+        Label tail_loop_label;
+        Label exit_label;
+
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, step);
+            jl(tail_loop_label, T_NEAR);
+
+            pool(step);
+
+            add(reg_src, step * jcp_.src_prc.size());
+            add(reg_dst, step * jcp_.dst_prc.size());
+            sub(reg_work_amount, step);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(tail_loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            je(exit_label, T_NEAR);
+
+            pool(1);
+
+            add(reg_src, jcp_.src_prc.size());
+            add(reg_dst, jcp_.dst_prc.size());
+            sub(reg_work_amount, 1);
+
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+
+        load_emitter->emit_data();
+        store_emitter->emit_data();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int step = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    // the pooled value of the channels vector: the bilinear samples are either accumulated or maxed
+    void pool(int num) {
+        Label samples_loop_label;
+
+        uni_vpxor(vmm_acc, vmm_acc, vmm_acc);
+        mov(aux_reg_offsets, reg_offsets);
+        mov(aux_reg_weights, reg_weights);
+        mov(reg_samples, reg_num_samples);
+
+        L(samples_loop_label);
+        {
+            uni_vpxor(vmm_sample, vmm_sample, vmm_sample);
+            for (int i = 0; i < 4; i++) {
+                mov(reg_aux, reg_src);
+                add(reg_aux, ptr[aux_reg_offsets + i * sizeof(size_t)]);
+                load_emitter->emit_code({static_cast<size_t>(reg_aux.getIdx())}, {static_cast<size_t>(vmm_src.getIdx())},
+                                        std::make_shared<load_emitter_context>(jcp_.src_prc, Precision::FP32, num),
+                                        {}, load_pool_gpr_idxs);
+                uni_vbroadcastss(vmm_weight, ptr[aux_reg_weights + i * sizeof(float)]);
+                uni_vfmadd231ps(vmm_sample, vmm_src, vmm_weight);
+            }
+
+            if (jcp_.alg == Algorithm::ROIAlignMax)
+                uni_vmaxps(vmm_acc, vmm_acc, vmm_sample);
+            else
+                uni_vaddps(vmm_acc, vmm_acc, vmm_sample);
+
+            add(aux_reg_offsets, 4 * sizeof(size_t));
+            add(aux_reg_weights, 4 * sizeof(float));
+            dec(reg_samples);
+            jnz(samples_loop_label, T_NEAR);
+        }
+
+        if (jcp_.alg == Algorithm::ROIAlignAvg)
+            uni_vmulps(vmm_acc, vmm_acc, vmm_scale);
+
+        store_emitter->emit_code({static_cast<size_t>(vmm_acc.getIdx())}, {static_cast<size_t>(reg_dst.getIdx())},
+                                 std::make_shared<store_emitter_context>(Precision::FP32, jcp_.dst_prc, num),
+                                 {static_cast<size_t>(vmm_aux.getIdx())}, store_pool_gpr_idxs);
+    }
+
+    Vmm vmm_acc = Vmm(0);
+    Vmm vmm_sample = Vmm(1);
+    Vmm vmm_src = Vmm(2);
+    Vmm vmm_weight = Vmm(3);
+    Vmm vmm_scale = Vmm(4);
+    Vmm vmm_aux = Vmm(5);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_offsets = r10;
+    Xbyak::Reg64 reg_weights = r11;
+    Xbyak::Reg64 reg_num_samples = r12;
+    Xbyak::Reg64 reg_work_amount = r13;
+    Xbyak::Reg64 aux_reg_offsets = r14;
+    Xbyak::Reg64 aux_reg_weights = r15;
+    Xbyak::Reg64 reg_samples = rbx;
+    Xbyak::Reg64 reg_aux = rdx;
+    Xbyak::Reg64 reg_load_store_mask = rsi;
+    Xbyak::Reg64 reg_load_table = rbp;
+
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+    std::vector<size_t> store_pool_gpr_idxs;
+};
+
 bool MKLDNNROIAlignNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (isDynamicNgraphNode(op)) {
@@ -300,6 +451,42 @@ void MKLDNNROIAlignNode::executeSpecified() {
                 }
             }
         }
+        if (roi_align_kernel) {
+            std::vector<size_t> offsetVector(pointVector.size());
+            for (size_t i = 0; i < pointVector.size(); i++) {
+                offsetVector[i] = (pointVector[i].first * hInputStride + pointVector[i].second * wInputStride) * sizeof(inputType);
+            }
+            const float scale = 1.0f / numSamplesInBin;
+
+            auto poolChannels = [&](int xBinInd_, int yBinInd_, size_t binOffsetInput_, size_t binOffsetOutput_, size_t channels_) {
+                const size_t sampleIndex = 4 * (yBinInd_ * pooledW + xBinInd_) * numSamplesInBin;
+
+                auto arg = jit_roi_align_call_args();
+                arg.src = srcData + binOffsetInput_;
+                arg.dst = dst + binOffsetOutput_ + yBinInd_ * hOutputStride + xBinInd_ * wOutputStride;
+                arg.offsets = &offsetVector[sampleIndex];
+                arg.weights = &weightVector[sampleIndex];
+                arg.scale = &scale;
+                arg.num_samples = numSamplesInBin;
+                arg.work_amount = channels_;
+                (*roi_align_kernel)(&arg);
+            };
+
+            if (isNhwcFmt) {
+                parallel_for2d(pooledH, pooledW, [&](int yBinInd, int xBinInd) {
+                    poolChannels(xBinInd, yBinInd, roiBatchInd * C * H * W, n * C * binCount, C);
+                });
+            } else {  // nChw16c, nChw8c
+                parallel_for3d(blockCount, pooledH, pooledW, [&](int blkIdx, int yBinInd, int xBinInd) {
+                    const int cStart = blkIdx * blockSize;
+                    const int cEnd = (blkIdx == blockCount - 1 ? C : cStart + blockSize);
+                    poolChannels(xBinInd, yBinInd, (roiBatchInd * chPadding + cStart) * H * W,
+                                 (n * chPadding + cStart) * binCount, cEnd - cStart);
+                });
+            }
+            continue;
+        }
+
         auto pool = [&] (int xBinInd_, int yBinInd_, int binOffsetInput_, int binOffsetOutput_, int blockResidual_) {
             float pooledValue = 0;
             unsigned int sampleIndex = 4 * (yBinInd_ * pooledW + xBinInd_) * numSamplesInBin;
@@ -368,6 +555,29 @@ bool MKLDNNROIAlignNode::created() const {
     return getType() == ROIAlign;
 }
 
-void MKLDNNROIAlignNode::createPrimitive() {}
+void MKLDNNROIAlignNode::createPrimitive() {
+    auto selectedPD = getSelectedPrimitiveDescriptor();
+    if (!selectedPD)
+        IE_THROW() << errorPrefix << "didn't set preferable primitive descriptor";
 
-REG_MKLDNN_PRIM_FOR(MKLDNNROIAlignNode, ROIAlign)
+    // the channels are vectorized, so they must be contiguous in the memory
+    const auto& srcDesc = selectedPD->getConfig().inConfs[0].desc;
+    if (srcDesc->hasLayoutType(LayoutType::ncsp))
+        return;
+
+    jit_roi_align_params jcp;
+    jcp.alg = getAlgorithm();
+    jcp.src_prc = srcDesc->getPrecision();
+    jcp.dst_prc = selectedPD->getConfig().outConfs[0].desc->getPrecision();
+
+    if (mayiuse(cpu::x64::avx512_common)) {
+        roi_align_kernel.reset(new jit_uni_roi_align_kernel_f32<cpu::x64::avx512_common>(jcp));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        roi_align_kernel.reset(new jit_uni_roi_align_kernel_f32<cpu::x64::avx2>(jcp));
+    } else if (mayiuse(cpu::x64::sse41)) {
+        roi_align_kernel.reset(new jit_uni_roi_align_kernel_f32<cpu::x64::sse41>(jcp));
+    }
+
+    if (roi_align_kernel)
+        roi_align_kernel->create_ker();
+}
@@ -13,6 +13,42 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_roi_align_params {
+    Algorithm alg;
+    InferenceEngine::Precision src_prc;
+    InferenceEngine::Precision dst_prc;
+};
+
+/*
+ * The kernel computes one output bin for work_amount channels which are contiguous in the memory. Every sample of
+ * the bin is the bilinear interpolation of 4 points given by their byte offsets from src and their weights.
+ */
+struct jit_roi_align_call_args {
+    const void *src;
+    void *dst;
+    const size_t *offsets;
+    const float *weights;
+    const float *scale;  // 1 / num_samples for the average pooling
+    size_t num_samples;
+    size_t work_amount;
+};
+
+struct jit_uni_roi_align_kernel {
+    void (*ker_)(const jit_roi_align_call_args *);
+
+    void operator()(const jit_roi_align_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_roi_align_kernel(jit_roi_align_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_roi_align_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_roi_align_params jcp_;
+};
+
 class MKLDNNROIAlignNode : public MKLDNNNode {
 public:
     MKLDNNROIAlignNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
@@ -35,6 +71,8 @@ private:
     template<typename T>
     struct ROIAlignExecute;
 
+    std::shared_ptr<jit_uni_roi_align_kernel> roi_align_kernel;
+
     std::string errorPrefix;
 };
 
@@ -710,5 +710,3 @@ void MKLDNNROIPoolingNode::execute(mkldnn::stream strm) {
 bool MKLDNNROIPoolingNode::created() const {
     return getType() == ROIPooling;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNROIPoolingNode, ROIPooling);
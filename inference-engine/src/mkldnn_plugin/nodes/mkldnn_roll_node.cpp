@@ -190,5 +190,3 @@ bool MKLDNNRollNode::created() const {
 void MKLDNNRollNode::createPrimitive() {}
 
 const std::vector<size_t> MKLDNNRollNode::supportedPrecisionSizes = {1, 2, 4};
-
-REG_MKLDNN_PRIM_FOR(MKLDNNRollNode, Roll)
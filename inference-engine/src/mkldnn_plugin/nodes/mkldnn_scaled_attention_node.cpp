@@ -0,0 +1,236 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "mkldnn_scaled_attention_node.h"
+#include "ie_parallel.hpp"
+#include "ngraph_transformations/op/scaled_attention.hpp"
+#include "utils/general_utils.h"
+#include "utils/bfloat16.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+bool MKLDNNScaledAttentionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (isDynamicNgraphNode(op)) {
+            errorMessage = "Doesn't support op with dynamic shapes";
+            return false;
+        }
+        if (!std::dynamic_pointer_cast<const ScaledAttentionNode>(op)) {
+            errorMessage = "Only ScaledAttentionCPU operation is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNScaledAttentionNode::MKLDNNScaledAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+        MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "ScaledAttention node with name '" + getName() + "' ";
+
+    const auto attention = std::dynamic_pointer_cast<const ScaledAttentionNode>(op);
+    scale = attention->get_scale();
+    transposeK = attention->get_transpose_k();
+    withMask = getOriginalInputsNumber() == 4;
+
+    const auto& qDims = getInputShapeAtPort(ATTN_Q).getStaticDims();
+    const auto& kDims = getInputShapeAtPort(ATTN_K).getStaticDims();
+    const auto& vDims = getInputShapeAtPort(ATTN_V).getStaticDims();
+    const size_t rank = qDims.size();
+    if (rank < 2 || kDims.size() != rank || vDims.size() != rank)
+        IE_THROW() << errorPrefix << "expects Q, K and V inputs of the same rank not less than 2";
+
+    queriesNum = qDims[rank - 2];
+    headSize = qDims[rank - 1];
+    keysNum = transposeK ? kDims[rank - 1] : kDims[rank - 2];
+    valueHeadSize = vDims[rank - 1];
+    if ((transposeK ? kDims[rank - 2] : kDims[rank - 1]) != headSize || vDims[rank - 2] != keysNum)
+        IE_THROW() << errorPrefix << "has inconsistent Q, K and V shapes";
+
+    batchNum = 1;
+    for (size_t i = 0; i < rank - 2; i++) {
+        if (kDims[i] != qDims[i] || vDims[i] != qDims[i])
+            IE_THROW() << errorPrefix << "expects equal batch dimensions of Q, K and V";
+        batchNum *= qDims[i];
+    }
+
+    if (withMask) {
+        const auto& maskDims = getInputShapeAtPort(ATTN_MASK).getStaticDims();
+        if (maskDims.size() > rank)
+            IE_THROW() << errorPrefix << "has mask of unsupported rank: " << maskDims.size();
+
+        // align the mask to [batch..., Sq, Sk] and zero the strides of the broadcasted dimensions
+        SizeVector fullDims(qDims.begin(), qDims.end() - 1);
+        fullDims.push_back(keysNum);
+        SizeVector strides(rank, 0);
+        size_t stride = 1;
+        for (size_t i = 0; i < maskDims.size(); i++) {
+            const size_t axis = rank - 1 - i;
+            const size_t dim = maskDims[maskDims.size() - 1 - i];
+            if (dim != 1 && dim != fullDims[axis])
+                IE_THROW() << errorPrefix << "has mask which is not broadcastable to the attention scores";
+            strides[axis] = dim == 1 ? 0 : stride;
+            stride *= dim;
+        }
+        maskQueryStride = strides[rank - 2];
+        maskKeyStride = strides[rank - 1];
+
+        maskBatchOffsets.resize(batchNum);
+        for (size_t b = 0; b < batchNum; b++) {
+            size_t offset = 0;
+            size_t rest = b;
+            for (size_t i = rank - 2; i > 0; i--) {
+                offset += (rest % fullDims[i - 1]) * strides[i - 1];
+                rest /= fullDims[i - 1];
+            }
+            maskBatchOffsets[b] = offset;
+        }
+    }
+}
+
+void MKLDNNScaledAttentionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    // bf16 inputs are accumulated in fp32, other precisions are executed in fp32
+    const Precision dataPrecision = getOriginalInputPrecisionAtPort(ATTN_Q) == Precision::BF16 ? Precision::BF16 : Precision::FP32;
+
+    std::vector<PortConfigurator> inDataConf;
+    inDataConf.reserve(inputShapes.size());
+    for (size_t i = 0; i < inputShapes.size(); ++i)
+        inDataConf.emplace_back(LayoutType::ncsp, i == ATTN_MASK ? Precision::FP32 : dataPrecision);
+
+    addSupportedPrimDesc(inDataConf, {{LayoutType::ncsp, dataPrecision}}, impl_desc_type::ref_any);
+}
+
+void MKLDNNScaledAttentionNode::loadTile(const uint8_t* src, Precision prec, size_t rows, size_t cols,
+                                         size_t rowStride, size_t colStride, float* dst) const {
+    if (prec == Precision::BF16) {
+        const auto data = reinterpret_cast<const bfloat16_t*>(src);
+        for (size_t r = 0; r < rows; r++)
+            for (size_t c = 0; c < cols; c++)
+                dst[r * cols + c] = static_cast<float>(data[r * rowStride + c * colStride]);
+    } else {
+        const auto data = reinterpret_cast<const float*>(src);
+        for (size_t r = 0; r < rows; r++)
+            for (size_t c = 0; c < cols; c++)
+                dst[r * cols + c] = data[r * rowStride + c * colStride];
+    }
+}
+
+void MKLDNNScaledAttentionNode::execute(mkldnn::stream strm) {
+    const auto& qMem = getParentEdgeAt(ATTN_Q)->getMemory();
+    const auto prec = qMem.getDesc().getPrecision();
+    const size_t elemSize = prec.size();
+
+    const auto q = reinterpret_cast<const uint8_t*>(qMem.GetPtr());
+    const auto k = reinterpret_cast<const uint8_t*>(getParentEdgeAt(ATTN_K)->getMemoryPtr()->GetPtr());
+    const auto v = reinterpret_cast<const uint8_t*>(getParentEdgeAt(ATTN_V)->getMemoryPtr()->GetPtr());
+    const float* mask = withMask ? reinterpret_cast<const float*>(getParentEdgeAt(ATTN_MASK)->getMemoryPtr()->GetPtr()) : nullptr;
+    auto dst = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const size_t D = headSize;
+    const size_t Dv = valueHeadSize;
+    const size_t Sq = queriesNum;
+    const size_t Sk = keysNum;
+    const size_t queryBlocks = div_up(Sq, queriesTile);
+    const float negInf = -std::numeric_limits<float>::infinity();
+
+    parallel_for2d(batchNum, queryBlocks, [&](size_t b, size_t qb) {
+        const size_t qBegin = qb * queriesTile;
+        const size_t qCount = std::min(queriesTile, Sq - qBegin);
+
+        std::vector<float> qTile(queriesTile * D);
+        std::vector<float> kTile(keysTile * D);
+        std::vector<float> vTile(keysTile * Dv);
+        std::vector<float> scores(keysTile);
+        std::vector<float> rowMax(queriesTile, negInf);
+        std::vector<float> rowSum(queriesTile, 0.f);
+        std::vector<float> acc(queriesTile * Dv, 0.f);
+
+        loadTile(q + ((b * Sq + qBegin) * D) * elemSize, prec, qCount, D, D, 1, qTile.data());
+
+        for (size_t kBegin = 0; kBegin < Sk; kBegin += keysTile) {
+            const size_t kCount = std::min(keysTile, Sk - kBegin);
+            // keys tile is always stored as [key][D] so the dot products below are contiguous
+            if (transposeK)
+                loadTile(k + (b * D * Sk + kBegin) * elemSize, prec, kCount, D, 1, Sk, kTile.data());
+            else
+                loadTile(k + ((b * Sk + kBegin) * D) * elemSize, prec, kCount, D, D, 1, kTile.data());
+            loadTile(v + ((b * Sk + kBegin) * Dv) * elemSize, prec, kCount, Dv, Dv, 1, vTile.data());
+
+            for (size_t i = 0; i < qCount; i++) {
+                const float* qRow = &qTile[i * D];
+                const float* maskRow = withMask ? mask + maskBatchOffsets[b] + (qBegin + i) * maskQueryStride : nullptr;
+
+                float blockMax = negInf;
+                for (size_t j = 0; j < kCount; j++) {
+                    const float* kRow = &kTile[j * D];
+                    float s = 0.f;
+                    for (size_t d = 0; d < D; d++)
+                        s += qRow[d] * kRow[d];
+                    s *= scale;
+                    if (maskRow)
+                        s += maskRow[(kBegin + j) * maskKeyStride];
+                    scores[j] = s;
+                    blockMax = std::max(blockMax, s);
+                }
+
+                const float newMax = std::max(rowMax[i], blockMax);
+                if (newMax == negInf)
+                    continue;
+
+                // rescale what was accumulated for the previous key tiles to the new running maximum
+                float* accRow = &acc[i * Dv];
+                if (rowMax[i] != newMax) {
+                    const float correction = rowMax[i] == negInf ? 0.f : std::exp(rowMax[i] - newMax);
+                    rowSum[i] *= correction;
+                    for (size_t d = 0; d < Dv; d++)
+                        accRow[d] *= correction;
+                    rowMax[i] = newMax;
+                }
+
+                for (size_t j = 0; j < kCount; j++) {
+                    const float p = scores[j] == negInf ? 0.f : std::exp(scores[j] - newMax);
+                    rowSum[i] += p;
+                    const float* vRow = &vTile[j * Dv];
+                    for (size_t d = 0; d < Dv; d++)
+                        accRow[d] += p * vRow[d];
+                }
+            }
+        }
+
+        for (size_t i = 0; i < qCount; i++) {
+            const float norm = rowSum[i] > 0.f ? 1.f / rowSum[i] : 0.f;
+            const size_t dstOffset = (b * Sq + qBegin + i) * Dv;
+            const float* accRow = &acc[i * Dv];
+            if (prec == Precision::BF16) {
+                auto dstRow = reinterpret_cast<bfloat16_t*>(dst) + dstOffset;
+                for (size_t d = 0; d < Dv; d++)
+                    dstRow[d] = accRow[d] * norm;
+            } else {
+                auto dstRow = reinterpret_cast<float*>(dst) + dstOffset;
+                for (size_t d = 0; d < Dv; d++)
+                    dstRow[d] = accRow[d] * norm;
+            }
+        }
+    });
+}
+
+bool MKLDNNScaledAttentionNode::created() const {
+    return getType() == ScaledAttention;
+}
@@ -0,0 +1,64 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Fused scaled dot-product attention. Keys and values are processed by tiles with online softmax
+ * (running maximum and sum per query), so the [..., Sq, Sk] scores tensor is never stored.
+ */
+class MKLDNNScaledAttentionNode : public MKLDNNNode {
+public:
+    MKLDNNScaledAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override {};
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    enum : size_t {
+        ATTN_Q,
+        ATTN_K,
+        ATTN_V,
+        ATTN_MASK
+    };
+
+    // tiles are sized to keep the keys and values tiles and the scores of the queries tile in L1/L2
+    static constexpr size_t queriesTile = 32;
+    static constexpr size_t keysTile = 64;
+
+    void loadTile(const uint8_t* src, InferenceEngine::Precision prec, size_t rows, size_t cols,
+                  size_t rowStride, size_t colStride, float* dst) const;
+
+    float scale = 1.f;
+    bool transposeK = false;
+    bool withMask = false;
+
+    size_t batchNum = 1;
+    size_t queriesNum = 0;
+    size_t keysNum = 0;
+    size_t headSize = 0;
+    size_t valueHeadSize = 0;
+
+    // offsets of the mask for each flattened batch index and strides over queries and keys, 0 for broadcasted dimensions
+    std::vector<size_t> maskBatchOffsets;
+    size_t maskQueryStride = 0;
+    size_t maskKeyStride = 0;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
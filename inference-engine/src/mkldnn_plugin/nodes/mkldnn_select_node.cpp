@@ -222,5 +222,3 @@ void MKLDNNSelectNode::execute(mkldnn::stream strm) {
 bool MKLDNNSelectNode::created() const {
     return getType() == Select;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNSelectNode, Select)
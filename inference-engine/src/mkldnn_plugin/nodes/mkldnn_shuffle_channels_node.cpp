@@ -253,5 +253,3 @@ void MKLDNNShuffleChannelsNode::execute(mkldnn::stream strm) {
 bool MKLDNNShuffleChannelsNode::created() const {
     return getType() == ShuffleChannels;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNShuffleChannelsNode, ShuffleChannels);
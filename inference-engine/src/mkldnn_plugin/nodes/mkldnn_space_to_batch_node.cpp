@@ -244,5 +244,3 @@ void MKLDNNSpaceToBatchNode::execute(mkldnn::stream strm) {
 bool MKLDNNSpaceToBatchNode::created() const {
     return getType() == SpaceToBatch;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNSpaceToBatchNode, SpaceToBatch)
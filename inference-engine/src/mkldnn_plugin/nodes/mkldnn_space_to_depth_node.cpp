@@ -261,4 +261,3 @@ void MKLDNNSpaceToDepthNode::execute(mkldnn::stream strm) {
 bool MKLDNNSpaceToDepthNode::created() const {
     return getType() == SpaceToDepth;
 }
-REG_MKLDNN_PRIM_FOR(MKLDNNSpaceToDepthNode, SpaceToDepth);
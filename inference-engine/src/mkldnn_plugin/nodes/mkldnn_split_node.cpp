@@ -113,23 +113,28 @@ void MKLDNNSplitNode::initSupportedPrimitiveDescriptors() {
 
     //Set plain and tailC formats
     std::vector<LayoutType> tdCreatorTypes{ LayoutType::ncsp, LayoutType::nspc };
+    // blocked formats which are supported only in place
+    std::vector<LayoutType> inPlaceOnlyCreatorTypes;
 
     //Support channel blocked format
     if (srcShape.getRank() > 2) {
         for (auto item : { std::make_pair(8lu, LayoutType::nCsp8c), std::make_pair(16lu, LayoutType::nCsp16c) }) {
-            SizeVector blkDims = srcShape.getStaticDims();
-            if (blkDims[channelsPos] % item.first)
-                continue;
-
-            bool blocked = true;
-            for (size_t i = 0; i < outputShapes.size(); i++) {
+            bool outputsBlocked = true;
+            for (size_t i = 0; i + 1 < outputShapes.size(); i++) {
                 if (outputShapes[i].getStaticDims()[channelsPos] % item.first) {
-                    blocked = false;
+                    outputsBlocked = false;
                     break;
                 }
             }
-            if (blocked) {
+            if (!outputsBlocked)
+                continue;
+
+            if (srcShape.getStaticDims()[channelsPos] % item.first == 0 &&
+                outputShapes.back().getStaticDims()[channelsPos] % item.first == 0) {
                 tdCreatorTypes.push_back(item.second);
+            } else if (axis == channelsPos) {
+                // the channels of the last output may be not aligned, its padding then matches the padding of the input
+                inPlaceOnlyCreatorTypes.push_back(item.second);
             }
         }
     }
@@ -137,15 +142,14 @@ void MKLDNNSplitNode::initSupportedPrimitiveDescriptors() {
     std::vector<size_t> pdIndexesToReuse;
 
     auto& creatorsMap = BlockedDescCreator::getCommonCreators();
-    auto itrRange = BlockedDescCreator::makeFilteredRange(creatorsMap, static_cast<unsigned>(srcShape.getRank()), tdCreatorTypes);
-    for (auto itr = itrRange.first; itr != itrRange.second; ++itr) {
+    auto makeRefConfig = [&](const BlockedDescCreator::CreatorConstPtr& creator) {
         NodeConfig config;
 
         config.dynBatchSupport = dynBatchSupport;
         config.inConfs.resize(INPUTS_NUM);
         config.inConfs[0].inPlace = -1;
         config.inConfs[0].constant = false;
-        config.inConfs[0].desc = std::make_shared<CpuBlockedMemoryDesc>(itr->second->createDesc(inpPrecision, srcShape));
+        config.inConfs[0].desc = std::make_shared<CpuBlockedMemoryDesc>(creator->createDesc(inpPrecision, srcShape));
         config.inConfs[1].inPlace = -1;
         config.inConfs[1].constant = true;
         config.inConfs[1].desc = std::make_shared<CpuBlockedMemoryDesc>(axisPrecision, Shape(SizeVector {1}));
@@ -159,9 +163,14 @@ void MKLDNNSplitNode::initSupportedPrimitiveDescriptors() {
         for (size_t i = 0; i < outputShapes.size(); i++) {
             config.outConfs[i].inPlace = -1;
             config.outConfs[i].constant = false;
-            config.outConfs[i].desc = std::make_shared<CpuBlockedMemoryDesc>(itr->second->createDesc(inpPrecision, outputShapes[i]));
+            config.outConfs[i].desc = std::make_shared<CpuBlockedMemoryDesc>(creator->createDesc(inpPrecision, outputShapes[i]));
         }
-        supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref);
+        return config;
+    };
+
+    auto itrRange = BlockedDescCreator::makeFilteredRange(creatorsMap, static_cast<unsigned>(srcShape.getRank()), tdCreatorTypes);
+    for (auto itr = itrRange.first; itr != itrRange.second; ++itr) {
+        supportedPrimitiveDescriptors.emplace_back(makeRefConfig(itr->second), impl_desc_type::ref);
 
         if (itr->first == LayoutType::ncsp) {
             // at least the plain layout can be optimized inplace.
@@ -174,8 +183,14 @@ void MKLDNNSplitNode::initSupportedPrimitiveDescriptors() {
     }
 
     // Optimized inplace case
-    for (auto refPdIndex : pdIndexesToReuse) {
-        const auto& refConfig = supportedPrimitiveDescriptors[refPdIndex].getConfig();
+    std::vector<NodeConfig> refConfigs;
+    for (auto refPdIndex : pdIndexesToReuse)
+        refConfigs.push_back(supportedPrimitiveDescriptors[refPdIndex].getConfig());
+    auto inPlaceOnlyRange = BlockedDescCreator::makeFilteredRange(creatorsMap, static_cast<unsigned>(srcShape.getRank()), inPlaceOnlyCreatorTypes);
+    for (auto itr = inPlaceOnlyRange.first; itr != inPlaceOnlyRange.second; ++itr)
+        refConfigs.push_back(makeRefConfig(itr->second));
+
+    for (const auto& refConfig : refConfigs) {
         auto config = refConfig;
         const auto inBlockingDesc = refConfig.inConfs[0].desc->as<CpuBlockedMemoryDesc>();
         const auto& order = inBlockingDesc->getOrder();
@@ -570,5 +585,3 @@ void MKLDNNSplitNode::initializeDstMemPtrs() {
         }
     }
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNSplitNode, Split);
@@ -254,6 +254,101 @@ void MKLDNNStridedSliceNode::initSupportedPrimitiveDescriptors() {
         config.outConfs[0].desc = itr->second->createSharedDesc(dataPrecision, getOutputShapeAtPort(DATA_ID));
         supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref);
     }
+
+    // Optimized inplace case: the output is a contiguous part of the planar input, described by the offset
+    size_t viewOffset = 0;
+    if (getContiguousViewOffset(viewOffset)) {
+        config.inConfs[DATA_ID].desc = creators.at(LayoutType::ncsp)->createSharedDesc(dataPrecision, getInputShapeAtPort(DATA_ID));
+        const auto denseDesc = creators.at(LayoutType::ncsp)->createSharedDesc(dataPrecision, getOutputShapeAtPort(0));
+        config.outConfs[0].inPlace = 0;
+        config.outConfs[0].desc = std::make_shared<CpuBlockedMemoryDesc>(dataPrecision, getOutputShapeAtPort(0), denseDesc->getBlockDims(),
+                                                                         denseDesc->getOrder(), viewOffset, denseDesc->getOffsetPaddingToData(),
+                                                                         denseDesc->getStrides());
+        supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+    }
+}
+
+bool MKLDNNStridedSliceNode::getContiguousViewOffset(size_t& offset) const {
+    const auto ellipsisMaskCounter = std::accumulate(ellipsisMask.begin(), ellipsisMask.end(), 0);
+    if (!params.parametersAreConstant || !params.equalDims || ellipsisMaskCounter != 0)
+        return false;
+    if (getParentEdgesAtPort(DATA_ID)[0]->getParent()->isConstant())
+        return false;
+
+    const auto& srcDims = getInputShapeAtPort(DATA_ID).getStaticDims();
+    const auto& dstDims = getOutputShapeAtPort(0).getStaticDims();
+    const size_t nDims = srcDims.size();
+    if (dstDims.size() != nDims || begin.size() != nDims || (!stride.empty() && stride.size() != nDims))
+        return false;
+    if (std::any_of(stride.begin(), stride.end(), [](int s) { return s != 1; }))
+        return false;
+
+    // the dims before the sliced one are 1 in the output and the dims after it are not sliced
+    int slicedDim = -1;
+    for (size_t i = 0; i < nDims; i++) {
+        if (dstDims[i] != srcDims[i] || (slicedDim == -1 && dstDims[i] != 1)) {
+            if (slicedDim != -1)
+                return false;
+            slicedDim = static_cast<int>(i);
+        }
+    }
+    if (slicedDim == -1)
+        return false;
+
+    offset = 0;
+    size_t srcStride = 1;
+    for (int i = static_cast<int>(nDims) - 1; i >= 0; i--) {
+        int b = beginMask[i] ? begin[i] : 0;
+        if (b < 0)
+            b += static_cast<int>(srcDims[i]);
+        b = std::min(std::max(b, 0), static_cast<int>(srcDims[i]));
+        if (b + dstDims[i] > srcDims[i])
+            return false;
+        offset += b * srcStride;
+        srcStride *= srcDims[i];
+    }
+    return true;
+}
+
+void MKLDNNStridedSliceNode::selectOptimalPrimitiveDescriptor() {
+    // The view is worth it only if all the consumers read it as is, otherwise the reorders copy the data anyway
+    for (size_t i = 0; i < supportedPrimitiveDescriptors.size(); i++) {
+        const auto& config = supportedPrimitiveDescriptors[i].getConfig();
+        if (config.outConfs[0].inPlace < 0)
+            continue;
+
+        const auto parentEdge = getParentEdgeAt(DATA_ID);
+        const auto parentSpd = parentEdge->getParent()->getSelectedPrimitiveDescriptor();
+        const int inNum = parentEdge->getInputNum();
+        if (!parentSpd || inNum < 0 || static_cast<size_t>(inNum) >= parentSpd->getConfig().outConfs.size() ||
+                !config.inConfs[DATA_ID].desc->isCompatible(*parentSpd->getConfig().outConfs[inNum].desc))
+            continue;
+
+        bool consumersAcceptView = true;
+        for (size_t j = 0; j < getChildEdges().size() && consumersAcceptView; j++) {
+            const auto childEdge = getChildEdgeAt(j);
+            const auto child = childEdge->getChild();
+            const int outNum = childEdge->getOutputNum();
+            consumersAcceptView = child->getType() != Output && outNum >= 0 &&
+                std::any_of(child->getSupportedPrimitiveDescriptors().begin(), child->getSupportedPrimitiveDescriptors().end(),
+                            [&](const NodeDesc& childSpd) {
+                                return static_cast<size_t>(outNum) < childSpd.getConfig().inConfs.size() &&
+                                       childSpd.getConfig().inConfs[outNum].desc->isCompatible(*config.outConfs[0].desc);
+                            });
+        }
+        if (consumersAcceptView) {
+            selectPrimitiveDescriptorByIndex(static_cast<int>(i));
+            return;
+        }
+    }
+
+    auto priority = getPrimitivesPriority();
+    priority.erase(std::remove(priority.begin(), priority.end(), impl_desc_type::unknown), priority.end());
+    selectPreferPrimitiveDescriptor(priority, false);
+}
+
+bool MKLDNNStridedSliceNode::isOptimized() const {
+    return getSelectedPrimitiveDescriptor() && getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].inPlace >= 0;
 }
 
 void MKLDNNStridedSliceNode::createPrimitive() {
@@ -265,6 +360,8 @@ void MKLDNNStridedSliceNode::createPrimitive() {
         THROW_ERROR << "has not allocated input memory.";
     if (getSelectedPrimitiveDescriptor() == nullptr)
         THROW_ERROR << "has unidentified preferable primitive descriptor.";
+    if (isOptimized())
+        return;
 
     auto srcBlockingDesc = getParentEdgeAt(DATA_ID)->getMemory().GetDescWithType<BlockedMemoryDesc>();
     auto dstBlockingDesc = getChildEdgeAt(0)->getMemory().GetDescWithType<BlockedMemoryDesc>();
@@ -594,6 +691,9 @@ void MKLDNNStridedSliceNode::indicesCalculationForOptimized() {
 }
 
 void MKLDNNStridedSliceNode::execute(mkldnn::stream strm) {
+    if (isOptimized())
+        return;
+
     if (!params.parametersAreConstant) {
         auto srcDims = getParentEdgeAt(DATA_ID)->getMemory().getStaticDims();
         auto dstDims = getChildEdgesAtPort(DATA_ID)[0]->getMemory().getStaticDims();
@@ -647,5 +747,3 @@ inline void MKLDNNStridedSliceNode::stridedSlice() {
 bool MKLDNNStridedSliceNode::created() const {
     return getType() == StridedSlice;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNStridedSliceNode, StridedSlice);
@@ -17,6 +17,7 @@ public:
 
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
+    void selectOptimalPrimitiveDescriptor() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
@@ -29,6 +30,9 @@ public:
 private:
     inline void stridedSlice();
 
+    bool getContiguousViewOffset(size_t& offset) const;
+    bool isOptimized() const;
+
     void addHiddenDims(const size_t nSrcDims);
     void orderParametersByLayouts();
     void dimsNormalization(InferenceEngine::SizeVector& newSrcDims, InferenceEngine::SizeVector& newDstDims);
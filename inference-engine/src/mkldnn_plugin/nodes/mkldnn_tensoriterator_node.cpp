@@ -11,6 +11,7 @@
 #include <ie_ngraph_utils.hpp>
 #include <utils/general_utils.h>
 #include "common/blocked_desc_creator.h"
+#include "common/cpu_memcpy.h"
 #include "utils/ngraph_utils.hpp"
 
 using namespace mkldnn;
@@ -92,7 +93,20 @@ public:
             mem_holder_src = from->GetPrimitive();
             mem_holder_dst = chunk_mem;
         }
-        reorder = {mem_holder_src, mem_holder_dst};
+
+        // plain chunk which is contiguous in the full tensor is moved by memcpy, which is much cheaper than
+        // the reorder primitive call for the small per iteration tensors of recurrent bodies
+        size_t outer_size = 1;
+        for (int i = 0; i < axis; i++)
+            outer_size *= full_dims[i];
+        plain_copy = outer_size == 1 &&
+                     full_blob->getDesc().hasLayoutType(LayoutType::ncsp) &&
+                     part_blob->getDesc().hasLayoutType(LayoutType::ncsp) &&
+                     full_blob->getDesc().getPrecision() == part_blob->getDesc().getPrecision();
+        chunk_size_in_byte = part_blob->GetSize();
+
+        if (!plain_copy)
+            reorder = {mem_holder_src, mem_holder_dst};
     }
 
     void execute(mkldnn::stream strm, int iter) override {
@@ -102,12 +116,17 @@ public:
         chunk_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
                 chunk_offset_in_byte + chunk_stride_in_byte * iter);
 
-        reorder.execute(strm, mem_holder_src, mem_holder_dst);
+        if (plain_copy)
+            cpu_parallel_memcpy(mem_holder_dst.get_data_handle(), mem_holder_src.get_data_handle(), chunk_size_in_byte);
+        else
+            reorder.execute(strm, mem_holder_src, mem_holder_dst);
     }
 
 private:
     ptrdiff_t chunk_stride_in_byte = 0;
     ptrdiff_t chunk_offset_in_byte = 0;
+    size_t chunk_size_in_byte = 0;
+    bool plain_copy = false;
 
     bool sliced_src;
     mkldnn::memory full_mem;
@@ -120,14 +139,27 @@ public:
     BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
         mem_holder_src = from->GetPrimitive();
         mem_holder_dst = to->GetPrimitive();
-        reorder = {mem_holder_src, mem_holder_dst};
+        // tensors with the same layout are copied as is
+        plain_copy = from->getDesc().isCompatible(to->getDesc());
+        size_in_byte = to->GetSize();
+        if (!plain_copy)
+            reorder = {mem_holder_src, mem_holder_dst};
     }
 
     void execute(mkldnn::stream strm, int iter) override {
         if (iter != 0) {
-            reorder.execute(strm, mem_holder_src, mem_holder_dst);
+            if (plain_copy) {
+                if (mem_holder_dst.get_data_handle() != mem_holder_src.get_data_handle())
+                    cpu_parallel_memcpy(mem_holder_dst.get_data_handle(), mem_holder_src.get_data_handle(), size_in_byte);
+            } else {
+                reorder.execute(strm, mem_holder_src, mem_holder_dst);
+            }
         }
     }
+
+private:
+    size_t size_in_byte = 0;
+    bool plain_copy = false;
 };
 
 class IterCountPortHelper : public PortMapHelper {
@@ -499,4 +531,3 @@ void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
 bool MKLDNNTensorIteratorNode::created() const {
     return getType() == TensorIterator;
 }
-REG_MKLDNN_PRIM_FOR(MKLDNNTensorIteratorNode, TensorIterator);
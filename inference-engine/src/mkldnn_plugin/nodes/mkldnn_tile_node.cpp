@@ -159,5 +159,3 @@ void MKLDNNTileNode::execute(mkldnn::stream strm) {
 bool MKLDNNTileNode::created() const {
     return getType() == Tile;
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNTileNode, Tile);
@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
+#include <utility>
 
 #include <ngraph/op/topk.hpp>
 #include "ie_parallel.hpp"
@@ -152,7 +154,12 @@ void MKLDNNTopKNode::execute(mkldnn::stream strm) {
                 top1_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
         }
     } else {
-        if (is_last_dim) {
+        if (is_last_dim && src_k >= heap_k_threshold) {
+            if (mode_max)
+                topk_heap<std::greater>(src, dst_data, dst_idx, 1, 0);
+            else
+                topk_heap<std::less>(src, dst_data, dst_idx, 1, 0);
+        } else if (is_last_dim) {
             if (mode_max)
                 topk<std::greater>(src, dst_data, dst_idx, in_dims);
             else
@@ -345,6 +352,10 @@ void MKLDNNTopKNode::topk_axis(const float* src_data, float* dst_data, int* dst_
             first_index = after_num / block_size * block_size;
         }
 #endif
+    if (src_k >= heap_k_threshold) {
+        topk_heap<Compare2>(src_data, dst_data, dst_idx, after_num, first_index);
+        return;
+    }
     int rest = after_num - first_index;
     parallel_for2d(before_num, rest, [&](int i0, int i1) {
         std::vector<float> max_values(src_k + 1);
@@ -468,6 +479,75 @@ void MKLDNNTopKNode::topk(const float* src_data, float* dst_data, int* dst_idx,
     });
 }
 
+// Selects top k of columns [first_index, after_num) with a binary heap per column, the heap top is the worst selected
+// element, so most of the elements are rejected by single comparison. Columns of the non-innermost axis are processed
+// by blocks, so each row of the block is read contiguously without transposition. The results are the same as
+// of the insertion sort: equal values are ordered by index.
+template <template <typename> class Compare>
+void MKLDNNTopKNode::topk_heap(const float* src_data, float* dst_data, int* dst_idx, int after_num, int first_index) {
+    using element = std::pair<float, int>;
+    auto better = [](const element& l, const element& r) {
+        return Compare<float>()(l.first, r.first) || (l.first == r.first && l.second < r.second);
+    };
+
+    const int rest = after_num - first_index;
+    const int block_size = (std::min)(heap_block_size, rest);
+    if (block_size <= 0)
+        return;
+
+    parallel_for2d(before_num, div_up(rest, block_size), [&](int i0, int ib1) {
+        const int begin = first_index + ib1 * block_size;
+        const int width = (std::min)(block_size, after_num - begin);
+        const float* src = src_data + i0 * dim * after_num + begin;
+
+        std::vector<element> heaps(width * src_k);
+        std::vector<float> worst(width);
+
+        for (int i2 = 0; i2 < src_k; i2++) {
+            for (int j = 0; j < width; j++)
+                heaps[j * src_k + i2] = element(src[i2 * after_num + j], i2);
+        }
+        for (int j = 0; j < width; j++) {
+            element* heap = heaps.data() + j * src_k;
+            std::make_heap(heap, heap + src_k, better);
+            worst[j] = heap[0].first;
+        }
+
+        for (int i2 = src_k; i2 < dim; i2++) {
+            const float* row = src + i2 * after_num;
+            for (int j = 0; j < width; j++) {
+                // elements come in the order of indices, so equal value never replaces the selected one
+                if (Compare<float>()(row[j], worst[j])) {
+                    element* heap = heaps.data() + j * src_k;
+                    std::pop_heap(heap, heap + src_k, better);
+                    heap[src_k - 1] = element(row[j], i2);
+                    std::push_heap(heap, heap + src_k, better);
+                    worst[j] = heap[0].first;
+                }
+            }
+        }
+
+        for (int j = 0; j < width; j++) {
+            element* heap = heaps.data() + j * src_k;
+            if (sort_value) {
+                std::sort_heap(heap, heap + src_k, better);
+            } else {
+                std::sort(heap, heap + src_k, [](const element& l, const element& r) {
+                    return l.second < r.second;
+                });
+            }
+            if (dst_data) {
+                for (int i2 = 0; i2 < src_k; i2++)
+                    dst_data[(i0 * src_k + i2) * after_num + begin + j] = heap[i2].first;
+            }
+            if (dst_idx) {
+                for (int i2 = 0; i2 < src_k; i2++)
+                    dst_idx[(i0 * src_k + i2) * after_num + begin + j] = heap[i2].second;
+            }
+        }
+    });
+}
+
 inline int MKLDNNTopKNode::count(VectorDims dims, size_t start_ind, size_t end_ind) {
     size_t count = 1;
     for (size_t i = start_ind; i < end_ind; i++)
@@ -478,5 +558,3 @@ inline int MKLDNNTopKNode::count(VectorDims dims, size_t start_ind, size_t end_i
 inline int MKLDNNTopKNode::count(VectorDims dims, size_t start_ind) {
     return count(dims, start_ind, dims.size());
 }
-
-REG_MKLDNN_PRIM_FOR(MKLDNNTopKNode, TopK)
@@ -79,6 +79,9 @@ public:
     template<template<typename> class Compare>
     void topk(const float *src_data, float *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
 
+    template<template<typename> class Compare>
+    void topk_heap(const float *src_data, float *dst_data, int *dst_idx, int after_num, int first_index);
+
 private:
     const size_t TOPK_DATA = 0;
     const size_t TOPK_K = 1;
@@ -106,6 +109,11 @@ private:
     const int count_vec = 16;
 #endif
 
+    // insertion sort is quadratic in k, larger k are selected with heaps
+    const int heap_k_threshold = 32;
+    // number of adjacent columns of the non-innermost axis processed together, so rows are read contiguously
+    const int heap_block_size = 16;
+
     inline int count(InferenceEngine::SizeVector dims, size_t start_ind, size_t end_ind);
 
     inline int count(InferenceEngine::SizeVector dims, size_t start_ind = 0);
@@ -120,12 +120,6 @@ void MKLDNNTransposeNode::createPrimitive() {
     if (getSelectedPrimitiveDescriptor() == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set.";
 
-    if (getParentEdgeAt(0)->getMemory().getDesc().hasLayoutType(LayoutType::ncsp) &&
-        std::find(optimizedOrders.begin(), optimizedOrders.end(), order) != optimizedOrders.end()) {
-        isOptimized = true;
-        return;
-    }
-
     PermuteParams params;
     params.data_size = getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc->getPrecision().size();
     params.order = order;
@@ -138,6 +132,13 @@ void MKLDNNTransposeNode::createPrimitive() {
     params.dst_block_order = dstDesc->getOrder();
 
     permuteKernel = std::unique_ptr<PermuteKernel>(new PermuteKernel(params));
+
+    // the hardcoded loops are faster than the generic kernel, but not than the tiled one
+    if (!permuteKernel->isTiled() && getParentEdgeAt(0)->getMemory().getDesc().hasLayoutType(LayoutType::ncsp) &&
+        std::find(optimizedOrders.begin(), optimizedOrders.end(), order) != optimizedOrders.end()) {
+        isOptimized = true;
+        permuteKernel.reset();
+    }
 }
 
 template <typename T>
@@ -265,4 +266,3 @@ void MKLDNNTransposeNode::execute(mkldnn::stream strm) {
 bool MKLDNNTransposeNode::created() const {
     return getType() == Transpose;
 }
-REG_MKLDNN_PRIM_FOR(MKLDNNTransposeNode, Transpose);
@@ -0,0 +1,93 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+
+#include "mkldnn_yolo_detection_node.h"
+#include "ngraph_transformations/op/yolo_detection.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+bool MKLDNNYoloDetectionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (isDynamicNgraphNode(op)) {
+            errorMessage = "Doesn't support op with dynamic shapes";
+            return false;
+        }
+        if (!std::dynamic_pointer_cast<const YoloDetectionNode>(op)) {
+            errorMessage = "Only YoloDetectionCPU operation is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNYoloDetectionNode::MKLDNNYoloDetectionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+        MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "YoloDetection node with name '" + getName() + "' ";
+
+    const auto yolo = std::dynamic_pointer_cast<const YoloDetectionNode>(op);
+    YoloDetectionParams params;
+    params.classes = static_cast<size_t>(yolo->get_classes());
+    params.input_width = static_cast<size_t>(yolo->get_input_width());
+    params.input_height = static_cast<size_t>(yolo->get_input_height());
+    params.do_softmax = yolo->get_do_softmax();
+    params.confidence_threshold = yolo->get_confidence_threshold();
+    params.iou_threshold = yolo->get_iou_threshold();
+    params.keep_top_k = static_cast<size_t>(yolo->get_keep_top_k());
+
+    const auto& anchors = yolo->get_anchors();
+    size_t anchorsOffset = 0;
+    for (size_t i = 0; i < inputShapes.size(); i++) {
+        const auto& dims = getInputShapeAtPort(i).getStaticDims();
+        if (i == 0)
+            params.batch = dims[0];
+        const size_t boxes = dims[1] / (5 + params.classes);
+
+        YoloDetectionParams::Scale scale;
+        scale.height = dims[2];
+        scale.width = dims[3];
+        if (anchorsOffset + 2 * boxes > anchors.size())
+            IE_THROW() << errorPrefix << "has not enough anchors for the boxes of the inputs";
+        scale.anchors.assign(anchors.begin() + anchorsOffset, anchors.begin() + anchorsOffset + 2 * boxes);
+        anchorsOffset += 2 * boxes;
+        params.scales.push_back(scale);
+    }
+
+    detection = std::make_shared<YoloDetectionKernel>(params);
+}
+
+void MKLDNNYoloDetectionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    std::vector<PortConfigurator> inDataConf;
+    inDataConf.reserve(inputShapes.size());
+    for (size_t i = 0; i < inputShapes.size(); ++i)
+        inDataConf.emplace_back(LayoutType::ncsp, Precision::FP32);
+
+    addSupportedPrimDesc(inDataConf, {{LayoutType::ncsp, Precision::FP32}}, impl_desc_type::ref_any);
+}
+
+void MKLDNNYoloDetectionNode::execute(mkldnn::stream strm) {
+    std::vector<const float*> srcs(inputShapes.size());
+    for (size_t i = 0; i < srcs.size(); i++)
+        srcs[i] = reinterpret_cast<const float*>(getParentEdgeAt(i)->getMemoryPtr()->GetPtr());
+    auto dst = reinterpret_cast<float*>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
+
+    detection->execute(srcs, dst);
+}
+
+bool MKLDNNYoloDetectionNode::created() const {
+    return getType() == YoloDetection;
+}
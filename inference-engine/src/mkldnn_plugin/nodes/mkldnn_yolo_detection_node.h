@@ -0,0 +1,38 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <memory>
+#include <vector>
+#include "common/yolo_detection.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * Fused YOLO post-processing on the raw feature maps of the detection head: the activations and the boxes are
+ * computed only for the cells passing the confidence threshold and the selected boxes go through class aware NMS.
+ */
+class MKLDNNYoloDetectionNode : public MKLDNNNode {
+public:
+    MKLDNNYoloDetectionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override {};
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    std::shared_ptr<YoloDetectionKernel> detection;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
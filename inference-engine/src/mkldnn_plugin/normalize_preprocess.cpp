@@ -38,6 +38,13 @@ void NormalizePreprocess::Load(const Shape& inputShape, InputInfo::Ptr inputInfo
                 meanValues[channel] = pp[channel]->meanValue;
                 stdScales[channel] = pp[channel]->stdScale;
             }
+
+            nhwcMeanPattern.resize(inChannels * nhwcPatternPixels);
+            nhwcScalePattern.resize(inChannels * nhwcPatternPixels);
+            for (size_t i = 0; i < nhwcMeanPattern.size(); i++) {
+                nhwcMeanPattern[i] = meanValues[i % inChannels];
+                nhwcScalePattern[i] = stdScales[i % inChannels];
+            }
         }
         break;
         case MEAN_IMAGE: {
@@ -77,8 +84,24 @@ void NormalizePreprocess::Load(const Shape& inputShape, InputInfo::Ptr inputInfo
     }
 }
 
+constexpr int NormalizePreprocess::blockSize;
+constexpr int NormalizePreprocess::nhwcPatternPixels;
+
 void NormalizePreprocess::NormalizeImage(const Shape &inputShape, float *input, InferenceEngine::Layout layout) {
-    IE_ASSERT(input != nullptr);
+    NormalizeImage(inputShape, input, input, layout);
+}
+
+void NormalizePreprocess::NormalizeImage(const Shape &inputShape, const float *src, float *dst, InferenceEngine::Layout layout) {
+    NormalizeImageTo(inputShape, src, dst, layout);
+}
+
+void NormalizePreprocess::NormalizeImage(const Shape &inputShape, const uint8_t *src, float *dst, InferenceEngine::Layout layout) {
+    NormalizeImageTo(inputShape, src, dst, layout);
+}
+
+template<typename T>
+void NormalizePreprocess::NormalizeImageTo(const Shape &inputShape, const T *src, float *dst, InferenceEngine::Layout layout) {
+    IE_ASSERT(src != nullptr && dst != nullptr);
 
     const auto inputDims = inputShape.getStaticDims();
     if (inputDims.size() != 4) {
@@ -95,23 +118,44 @@ void NormalizePreprocess::NormalizeImage(const Shape &inputShape, float *input,
     if (meanBuffer && meanBuffer->size()) {
         const float * meanBufferValues = meanBuffer->readOnly();
 
-        parallel_for2d(MB, srcSize, [&](int mb, int i) {
-            input[srcSize * mb + i] -= meanBufferValues[i];
+        const int blocks = div_up(srcSize, blockSize);
+        parallel_for2d(MB, blocks, [&](int mb, int b) {
+            const int begin = b * blockSize;
+            const int end = (std::min)(begin + blockSize, srcSize);
+            const T* srcData = src + srcSize * mb;
+            float* dstData = dst + srcSize * mb;
+            for (int i = begin; i < end; i++)
+                dstData[i] = srcData[i] - meanBufferValues[i];
         });
     } else if (!meanValues.empty() && !stdScales.empty()) {
         int C = inputDims[1];
         srcSize /= inputDims[1];
 
         if (layout == NCHW) {
-            parallel_for3d(MB, C, srcSize, [&](int mb, int c, int i) {
-                input[mb * C * srcSize + c * srcSize + i] -= meanValues[c];
-                input[mb * C * srcSize + c * srcSize + i] /= stdScales[c];
+            const int blocks = div_up(srcSize, blockSize);
+            parallel_for3d(MB, C, blocks, [&](int mb, int c, int b) {
+                const int begin = b * blockSize;
+                const int end = (std::min)(begin + blockSize, srcSize);
+                const T* srcData = src + (mb * C + c) * srcSize;
+                float* dstData = dst + (mb * C + c) * srcSize;
+                const float mean = meanValues[c];
+                const float scale = stdScales[c];
+                for (int i = begin; i < end; i++)
+                    dstData[i] = (srcData[i] - mean) / scale;
             });
         } else if (layout == NHWC) {
-            parallel_for2d(MB, srcSize, [&](int mb, int i) {
-                for (int c = 0; c < C; c++) {
-                    input[mb * srcSize * C + i * C + c] -= meanValues[c];
-                    input[mb * srcSize * C + i * C + c] /= stdScales[c];
+            const int blockPixels = blockSize / nhwcPatternPixels * nhwcPatternPixels;
+            const int blocks = div_up(srcSize, blockPixels);
+            const float* meanPattern = nhwcMeanPattern.data();
+            const float* scalePattern = nhwcScalePattern.data();
+            parallel_for2d(MB, blocks, [&](int mb, int b) {
+                const int pixelsEnd = (std::min)((b + 1) * blockPixels, srcSize);
+                for (int p = b * blockPixels; p < pixelsEnd; p += nhwcPatternPixels) {
+                    const int count = (std::min)(nhwcPatternPixels, pixelsEnd - p) * C;
+                    const T* srcData = src + (mb * srcSize + p) * C;
+                    float* dstData = dst + (mb * srcSize + p) * C;
+                    for (int i = 0; i < count; i++)
+                        dstData[i] = (srcData[i] - meanPattern[i]) / scalePattern[i];
                 }
             });
         }
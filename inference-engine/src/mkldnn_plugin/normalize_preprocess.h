@@ -20,6 +20,15 @@ public:
 public:
     void Load(const Shape& inputShape, InferenceEngine::InputInfo::Ptr inputInfo);
     void NormalizeImage(const Shape &inputShape, float *input, InferenceEngine::Layout layout);
+    /**
+     * Out of place form: the input data are normalized while they are copied to the graph memory, so the separate
+     * copy pass isn't needed when the input blob has the layout of the graph input
+     */
+    void NormalizeImage(const Shape &inputShape, const float *src, float *dst, InferenceEngine::Layout layout);
+    /**
+     * U8 images are converted while they are normalized, so the FP32 copy of the input blob isn't created
+     */
+    void NormalizeImage(const Shape &inputShape, const uint8_t *src, float *dst, InferenceEngine::Layout layout);
 
     template<typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
     void NormalizeImage(const Shape &inputShape, T *input, InferenceEngine::Layout layout) {
@@ -81,10 +90,22 @@ public:
     }
 
 private:
+    template<typename T>
+    void NormalizeImageTo(const Shape &inputShape, const T *src, float *dst, InferenceEngine::Layout layout);
+
+    // the contiguous data are processed by the blocks of the elements, so the inner loops are vectorized
+    static constexpr int blockSize = 4096;
+    // the channels of NHWC data are repeated over this number of pixels, so a block of the pixels is normalized by plain
+    // elementwise loop
+    static constexpr int nhwcPatternPixels = 16;
+
     std::vector<float> meanValues;
 
     std::vector<float> stdScales;
 
+    std::vector<float> nhwcMeanPattern;
+    std::vector<float> nhwcScalePattern;
+
     InferenceEngine::TBlob<float>::Ptr meanBuffer;
 };
 
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstdint>
 #include <ratio>
 
 namespace MKLDNNPlugin {
@@ -48,6 +50,27 @@ public:
     ~PerfHelper() { counter.finish_itr(); }
 };
 
+/**
+ * Histogram of node execution times: bucket 0 counts executions shorter than 1 us, bucket i - the ones
+ * in [2^(i-1), 2^i) us and the last bucket - all the longer ones
+ */
+class PerfHistogram {
+public:
+    static constexpr size_t numBuckets = 24;
+
+    void add(uint64_t usec) {
+        size_t bucket = 0;
+        for (; usec != 0 && bucket + 1 < numBuckets; usec >>= 1)
+            bucket++;
+        buckets[bucket]++;
+    }
+
+    const std::array<uint64_t, numBuckets>& get() const { return buckets; }
+
+private:
+    std::array<uint64_t, numBuckets> buckets = {};
+};
+
 }  // namespace MKLDNNPlugin
 
 #define GET_PERF(_node) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfCounter()))
@@ -0,0 +1,106 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "huge_pages.h"
+
+#include <atomic>
+#include <cstdlib>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+std::atomic<uint64_t> explicitBytes{0};
+std::atomic<uint64_t> transparentBytes{0};
+std::atomic<uint64_t> fallbackBytes{0};
+
+thread_local HugePagesMode currentMode = HugePagesMode::None;
+
+#ifdef __linux__
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+
+size_t roundUp(size_t size, size_t alignment) {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+std::shared_ptr<void> mapExplicitHugePages(size_t size, size_t pageSize, int pageSizeFlag) {
+    const auto mappedSize = roundUp(size, pageSize);
+    void* ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | pageSizeFlag, -1, 0);
+    if (ptr == MAP_FAILED)
+        return nullptr;
+    explicitBytes += mappedSize;
+    return std::shared_ptr<void>(ptr, [mappedSize](void* p) {
+        munmap(p, mappedSize);
+        explicitBytes -= mappedSize;
+    });
+}
+
+std::shared_ptr<void> allocateTransparentHugePages(size_t size) {
+    // the tail is allocated as well, so the last page may be huge too
+    const auto allocatedSize = roundUp(size, hugePageSize);
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, hugePageSize, allocatedSize) != 0)
+        return nullptr;
+    bool advised = false;
+#ifdef MADV_HUGEPAGE
+    advised = madvise(ptr, allocatedSize, MADV_HUGEPAGE) == 0;
+#endif
+    auto& counter = advised ? transparentBytes : fallbackBytes;
+    counter += allocatedSize;
+    return std::shared_ptr<void>(ptr, [allocatedSize, &counter](void* p) {
+        std::free(p);
+        counter -= allocatedSize;
+    });
+}
+#endif
+
+}  // namespace
+
+std::shared_ptr<void> allocateOnHugePages(size_t size, HugePagesMode mode) {
+    if (mode == HugePagesMode::None || size < hugePageSize)
+        return nullptr;
+#ifdef __linux__
+    if (mode == HugePagesMode::Explicit) {
+        constexpr size_t gigaPageSize = 1024 * 1024 * 1024;
+        std::shared_ptr<void> ptr;
+        if (size >= gigaPageSize)
+            ptr = mapExplicitHugePages(size, gigaPageSize, 30 << MAP_HUGE_SHIFT);
+        if (!ptr)
+            ptr = mapExplicitHugePages(size, hugePageSize, 21 << MAP_HUGE_SHIFT);
+        if (ptr)
+            return ptr;
+    }
+    return allocateTransparentHugePages(size);
+#else
+    // large pages require special privileges on the other systems
+    return nullptr;
+#endif
+}
+
+std::map<std::string, uint64_t> getHugePagesUsage() {
+    return {{"explicit", explicitBytes.load()},
+            {"transparent", transparentBytes.load()},
+            {"fallback", fallbackBytes.load()}};
+}
+
+HugePagesScope::HugePagesScope(HugePagesMode mode) : previous(currentMode) {
+    currentMode = mode;
+}
+
+HugePagesScope::~HugePagesScope() {
+    currentMode = previous;
+}
+
+HugePagesMode HugePagesScope::current() {
+    return currentMode;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,61 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+enum class HugePagesMode {
+    // the memory is allocated by oneDNN on the regular pages
+    None,
+    // the memory is aligned to the huge page and advised to be backed by the transparent huge pages
+    Transparent,
+    // the memory is mapped from the hugetlbfs pool (1 GB pages for the allocations not smaller than them,
+    // 2 MB pages otherwise), the transparent huge pages are used if the pool is exhausted
+    Explicit,
+};
+
+/**
+ * Allocations smaller than this size are never backed by the huge pages, since most of the page would be wasted
+ */
+constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+/**
+ * Allocates the buffer of the given size backed by the huge pages according to the mode
+ * @return nullptr if the mode is None, the size is smaller than hugePageSize or the allocation failed,
+ * the caller is expected to allocate the regular memory then
+ */
+std::shared_ptr<void> allocateOnHugePages(size_t size, HugePagesMode mode);
+
+/**
+ * Process-wide statistics of the currently alive allocations requested on the huge pages in bytes:
+ *  - "explicit" - mapped from the hugetlbfs pool
+ *  - "transparent" - advised to be backed by the transparent huge pages
+ *  - "fallback" - got the regular pages, since neither explicit nor transparent huge pages are available
+ */
+std::map<std::string, uint64_t> getHugePagesUsage();
+
+/**
+ * Sets the huge pages mode used by MKLDNNMemory allocations of the current thread within the scope
+ */
+class HugePagesScope {
+public:
+    explicit HugePagesScope(HugePagesMode mode);
+    ~HugePagesScope();
+
+    HugePagesScope(const HugePagesScope&) = delete;
+    HugePagesScope& operator=(const HugePagesScope&) = delete;
+
+    static HugePagesMode current();
+
+private:
+    HugePagesMode previous;
+};
+
+}  // namespace MKLDNNPlugin
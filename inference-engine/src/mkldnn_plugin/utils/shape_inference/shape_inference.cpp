@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_inference.hpp"
+
+#include <openvino/op/ops.hpp>
+#include <openvino/op/util/binary_elementwise_arithmetic.hpp>
+#include <openvino/op/util/binary_elementwise_comparison.hpp>
+#include <openvino/op/util/binary_elementwise_logical.hpp>
+#include <openvino/op/util/unary_elementwise_arithmetic.hpp>
+
+#include <convolution_shape_inference.hpp>
+#include <concat_shape_inference.hpp>
+#include <elementwise_shape_inference.hpp>
+#include <matmul_shape_inference.hpp>
+#include <shape_of_shape_inference.hpp>
+
+namespace ov {
+
+namespace {
+
+bool is_copy_shape_op(const Node* op) {
+    return dynamic_cast<const op::util::UnaryElementwiseArithmetic*>(op) ||
+           dynamic_cast<const op::v0::Convert*>(op) ||
+           dynamic_cast<const op::v1::LogicalNot*>(op) ||
+           dynamic_cast<const op::v1::Softmax*>(op) ||
+           dynamic_cast<const op::v0::Clamp*>(op) ||
+           dynamic_cast<const op::v0::Elu*>(op) ||
+           dynamic_cast<const op::v0::Selu*>(op) ||
+           dynamic_cast<const op::v0::PRelu*>(op) ||
+           dynamic_cast<const op::v0::NormalizeL2*>(op) ||
+           dynamic_cast<const op::v0::Gelu*>(op) ||
+           dynamic_cast<const op::v6::MVN*>(op) ||
+           dynamic_cast<const op::v0::MVN*>(op);
+}
+
+bool is_eltwise_op(const Node* op) {
+    return dynamic_cast<const op::util::BinaryElementwiseArithmetic*>(op) ||
+           dynamic_cast<const op::util::BinaryElementwiseComparison*>(op) ||
+           dynamic_cast<const op::util::BinaryElementwiseLogical*>(op);
+}
+
+}  // namespace
+
+bool shape_inference(Node* op, const std::vector<StaticShape>& input_shapes, std::vector<StaticShape>& output_shapes) {
+    if (auto node = dynamic_cast<op::v1::Convolution*>(op)) {
+        shape_infer(node, input_shapes, output_shapes);
+    } else if (auto node = dynamic_cast<op::v0::MatMul*>(op)) {
+        shape_infer(node, input_shapes, output_shapes);
+    } else if (auto node = dynamic_cast<op::v0::Concat*>(op)) {
+        shape_infer(node, input_shapes, output_shapes);
+    } else if (auto node = dynamic_cast<op::v0::ShapeOf*>(op)) {
+        shape_infer(node, input_shapes, output_shapes);
+    } else if (auto node = dynamic_cast<op::v3::ShapeOf*>(op)) {
+        shape_infer(node, input_shapes, output_shapes);
+    } else if (is_eltwise_op(op)) {
+        op::eltwise_shape_infer(op, input_shapes, output_shapes);
+    } else if (is_copy_shape_op(op)) {
+        op::copy_shape_infer(op, input_shapes, output_shapes);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+}  // namespace ov
@@ -0,0 +1,20 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+
+#include <openvino/core/node.hpp>
+#include "static_shape.hpp"
+
+namespace ov {
+
+/// \brief Infers the output shapes of the operation with the shape inference templates
+///        without the validation of the ngraph operation.
+/// \return false if the operation type has no shape inference template, so the shapes should be
+///         inferred by validate_and_infer_types() of the operation
+bool shape_inference(Node* op, const std::vector<StaticShape>& input_shapes, std::vector<StaticShape>& output_shapes);
+
+}  // namespace ov
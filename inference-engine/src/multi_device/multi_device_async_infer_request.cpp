@@ -30,6 +30,11 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
         explicit ThisRequestExecutor(MultiDeviceAsyncInferRequest* _this_) : _this{_this_} {}
         void run(Task task) override {
             auto workerInferRequest = _this->_workerInferRequest;
+            // the batched request is started once the batch is gathered (see MultiDeviceExecutableNetwork::StartBatch)
+            if (workerInferRequest->_batchSize > 1) {
+                workerInferRequest->_batchTasks.push_back(std::move(task));
+                return;
+            }
             workerInferRequest->_task = std::move(task);
             workerInferRequest->_inferRequest->StartAsync();
         };
@@ -70,13 +75,20 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
         {
          /*TaskExecutor*/ _multiDeviceExecutableNetwork, /*task*/ [this] {
                _workerInferRequest = MultiDeviceExecutableNetwork::_thisWorkerInferRequest;
-               _inferRequest->SetBlobsToAnotherRequest(_workerInferRequest->_inferRequest);
+               if (_workerInferRequest->_batchSize > 1) {
+                   _batchSlot = _workerInferRequest->_batchTasks.size();
+                   _inferRequest->SetBlobsToBatchSlot(_workerInferRequest->_inferRequest, _batchSlot, _workerInferRequest->_batchSize);
+               } else {
+                   _inferRequest->SetBlobsToAnotherRequest(_workerInferRequest->_inferRequest);
+               }
         }},
         // final task in the pipeline:
         { /*TaskExecutor*/std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
               if (nullptr != _workerInferRequest->_exceptionPtr) {
                   std::rethrow_exception(_workerInferRequest->_exceptionPtr);
               }
+              if (_workerInferRequest->_batchSize > 1)
+                  _inferRequest->GetBlobsFromBatchSlot(_workerInferRequest->_inferRequest, _batchSlot, _workerInferRequest->_batchSize);
               if (_needPerfCounters)
                   _perfMap = _workerInferRequest->_inferRequest->GetPerformanceCounts();
         }}
@@ -35,6 +35,7 @@ protected:
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>  _perfMap;
     bool                                                                _needPerfCounters = false;
     MultiDeviceExecutableNetwork::WorkerInferRequest*                   _workerInferRequest = nullptr;
+    std::size_t                                                         _batchSlot = 0;
 };
 
 }  // namespace MultiDevicePlugin
@@ -10,6 +10,7 @@
 #include <utility>
 #include <map>
 #include <unordered_map>
+#include <limits>
 
 #include "ie_icore.hpp"
 #include "ie_metric_helpers.hpp"
@@ -52,6 +53,43 @@ thread_local MultiDeviceExecutableNetwork::WorkerInferRequest* MultiDeviceExecut
 // TODO: revert to the plain variable (see header file), when we moved to the next CentOS 8.x in our support matrix
 thread_local const char* MultiDeviceExecutableNetwork::_thisPreferredDeviceName = "";
 
+namespace {
+// weight of the new sample in the moving averages, so roughly the last 10 inferences are taken into account
+constexpr double statisticsSmoothing = 0.1;
+}  // namespace
+
+void MultiDeviceExecutableNetwork::DeviceStatistics::Completed(std::chrono::steady_clock::time_point startTime) {
+    const auto now = std::chrono::steady_clock::now();
+    const double latency = std::chrono::duration_cast<std::chrono::microseconds>(now - startTime).count();
+    std::lock_guard<std::mutex> lock(_mutex);
+    _latency = (0 == _completed) ? latency : (1.0 - statisticsSmoothing) * _latency + statisticsSmoothing * latency;
+    if (_completed > 0) {
+        const double interval = std::chrono::duration_cast<std::chrono::microseconds>(now - _lastCompletion).count();
+        _completionInterval = (1 == _completed) ? interval
+                                                : (1.0 - statisticsSmoothing) * _completionInterval + statisticsSmoothing * interval;
+    }
+    _lastCompletion = now;
+    _completed++;
+}
+
+double MultiDeviceExecutableNetwork::DeviceStatistics::EstimateCompletionTime(std::size_t numWorkers) const {
+    double latency = 0.0;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        latency = _latency;
+    }
+    // the device runs up to numWorkers requests in parallel, so the new request waits for
+    // the (running + queued - numWorkers + 1) requests ahead of it to complete at the device throughput rate
+    const auto ahead = _busy + _queued + 1;
+    const double wait = ahead > numWorkers ? static_cast<double>(ahead - numWorkers) / numWorkers : 0.0;
+    return latency * (1.0 + wait);
+}
+
+float MultiDeviceExecutableNetwork::DeviceStatistics::GetThroughput() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _completionInterval > 0.0 ? static_cast<float>(1e6 / _completionInterval) : 0.f;
+}
+
 struct IdleGuard {
     explicit IdleGuard(MultiDeviceExecutableNetwork::WorkerInferRequest* workerInferRequestPtr,
                        MultiDeviceExecutableNetwork::NotBusyWorkerRequests& notBusyWorkerRequests) :
@@ -75,14 +113,19 @@ struct IdleGuard {
 MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::SoExecutableNetworkInternal>&       networksPerDevice,
                                                            const std::vector<DeviceInformation>&                                networkDevices,
                                                            const std::unordered_map<std::string, InferenceEngine::Parameter>&   config,
-                                                           const bool                                                           needPerfCounters) :
+                                                           const bool                                                           needPerfCounters,
+                                                           const DeviceMap<unsigned int>&                                       batchPerDevice) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
     _devicePriorities{networkDevices},
     _devicePrioritiesInitial{networkDevices},
     _networksPerDevice{networksPerDevice},
     _config{config},
-    _needPerfCounters{needPerfCounters} {
+    _needPerfCounters{needPerfCounters},
+    _batchPerDevice{batchPerDevice} {
     _taskExecutor.reset();
+    auto policy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    _scheduleByCompletionTime = policy != _config.end() &&
+                                policy->second.as<std::string>() == MultiDeviceConfigParams::MULTI_COMPLETION_TIME;
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
@@ -110,15 +153,35 @@ void MultiDeviceExecutableNetwork::GenerateWorkers(const std::string& device, co
     _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
     auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
     idleWorkerRequests.set_capacity(numRequests);
+    // AUTO schedules to a single device, so the statistics are collected for MULTI only
+    DeviceStatistics* statisticsPtr = nullptr;
+    if (!_workModeIsAUTO) {
+        _deviceStatistics[device] = std::unique_ptr<DeviceStatistics>(new DeviceStatistics);
+        statisticsPtr = _deviceStatistics[device].get();
+    }
+    auto batch = _batchPerDevice.find(device);
+    const std::size_t batchSize = batch != _batchPerDevice.end() ? batch->second : 1;
     for (auto&& workerRequest : workerRequests) {
         workerRequest._inferRequest = { executableNetwork._so, executableNetwork->CreateInferRequest() };
+        workerRequest._batchSize = batchSize;
+        if (batchSize > 1)
+            workerRequest._batchTasks.reserve(batchSize);
         auto* workerRequestPtr = &workerRequest;
         IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
         workerRequest._inferRequest->SetCallback(
-            [workerRequestPtr, this, device, idleWorkerRequestsPtr] (std::exception_ptr exceptionPtr) mutable {
+            [workerRequestPtr, this, device, idleWorkerRequestsPtr, statisticsPtr] (std::exception_ptr exceptionPtr) mutable {
                 IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                 workerRequestPtr->_exceptionPtr = exceptionPtr;
-                {
+                if (nullptr != statisticsPtr) {
+                    statisticsPtr->Completed(workerRequestPtr->_startTime);
+                    statisticsPtr->_busy--;
+                }
+                if (workerRequestPtr->_batchSize > 1) {
+                    auto capturedTasks = std::move(workerRequestPtr->_batchTasks);
+                    workerRequestPtr->_batchTasks.clear();
+                    for (auto&& capturedTask : capturedTasks)
+                        capturedTask();
+                } else {
                     auto capturedTask = std::move(workerRequestPtr->_task);
                     capturedTask();
                 }
@@ -127,10 +190,19 @@ void MultiDeviceExecutableNetwork::GenerateWorkers(const std::string& device, co
                     // let's try to pop a task, as we know there is at least one idle request, schedule if succeeded
                     // if no device-agnostic tasks, let's try pop the device specific task, schedule if succeeded
                     Task t;
-                    if (_inferPipelineTasks.try_pop(t))
+                    if (_inferPipelineTasks.try_pop(t)) {
                         ScheduleToWorkerInferRequest(std::move(t));
-                    else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t))
+                    } else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t)) {
+                        if (nullptr != statisticsPtr)
+                            statisticsPtr->_queued--;
                         ScheduleToWorkerInferRequest(std::move(t), device);
+                    }
+                }
+                // the accelerator serves the requests now, so the CPU of the AUTO warm start is not needed anymore
+                if (_workModeIsAUTO && device == _acceleratorDevice.deviceName && device != _cpuDevice.deviceName) {
+                    _acceleratorInferred = true;
+                    if (_releaseCpuNetwork)
+                        TryReleaseCpuNetwork();
                 }
             });
     }
@@ -141,12 +213,14 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const std::string&
                                                            const std::vector<DeviceInformation>&      metaDevices,
                                                            const std::string&                         strDevices,
                                                            MultiDeviceInferencePlugin*                plugin,
-                                                           const bool                                needPerfCounters)
+                                                           const bool                                needPerfCounters,
+                                                           const bool                                releaseCpuNetwork)
                                                            : _devicePriorities{metaDevices}
                                                            , _devicePrioritiesInitial{metaDevices}
                                                            , _needPerfCounters(needPerfCounters)
                                                            , _multiPlugin(plugin)
-                                                           , _workModeIsAUTO(true) {
+                                                           , _workModeIsAUTO(true)
+                                                           , _releaseCpuNetwork(releaseCpuNetwork) {
     if (_multiPlugin->GetCore() == nullptr) {
         IE_THROW() << "Please, work with MULTI device via InferencEngine::Core object";
     }
@@ -251,6 +325,33 @@ void MultiDeviceExecutableNetwork::WaitFirstNetworkReady() {
     }
 }
 
+void MultiDeviceExecutableNetwork::TryReleaseCpuNetwork() {
+    if (_cpuReleased || _cpuReleasing.exchange(true)) {
+        return;
+    }
+    // the network is released when all its requests are idle, taking them from the idle list makes sure
+    // no task is scheduled to them meanwhile
+    auto& idleWorkerRequests = _idleWorkerRequests[_cpuDevice.deviceName];
+    auto& workerRequests = _workerRequests[_cpuDevice.deviceName];
+    std::vector<WorkerInferRequest*> idleRequests;
+    WorkerInferRequest* workerRequestPtr = nullptr;
+    while (idleRequests.size() < workerRequests.size() && idleWorkerRequests.try_pop(workerRequestPtr)) {
+        idleRequests.push_back(workerRequestPtr);
+    }
+    if (idleRequests.size() == workerRequests.size()) {
+        idleWorkerRequests.set_capacity(0);
+        workerRequests.clear();
+        _networkFirstReady = {};
+        _cpuReleased = true;
+    } else {
+        // some requests are still in flight, the release is retried on the next accelerator inference
+        for (auto&& idleRequest : idleRequests) {
+            idleWorkerRequests.try_push(idleRequest);
+        }
+    }
+    _cpuReleasing = false;
+}
+
 void MultiDeviceExecutableNetwork::WaitActualNetworkReady() const {
     // Maybe different API will call this function, so add call once here
     // for every MultiDeviceExecutableNetwork instance
@@ -277,6 +378,12 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
             // _acceleratorDevice could be the same as _cpuDevice, such as AUTO:CPU
             if (_alreadyActualNetwork) {
                 devices.push_back(_acceleratorDevice);
+                // the load migrates to the accelerator gradually: until its first inference completes
+                // (the first inferences are slow on e.g. GPU) the requests w/o idle accelerator request go to the CPU
+                if (!_acceleratorInferred && !_cpuReleased && !_cpuDevice.deviceName.empty() &&
+                    _cpuDevice.deviceName != _acceleratorDevice.deviceName) {
+                    devices.push_back(_cpuDevice);
+                }
             } else {
                 devices.push_back(_cpuDevice);
             }
@@ -286,39 +393,137 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
             std::lock_guard<std::mutex> lock(_mutex);
             return _devicePriorities;
         }();
+        if (_scheduleByCompletionTime && preferred_device.empty() && !devices.empty()) {
+            ScheduleByCompletionTime(inferPipelineTask, devices);
+            return;
+        }
     }
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device))
             continue;
-        if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[device.deviceName], preferred_device)) {
+        auto statistics = _deviceStatistics.find(device.deviceName);
+        if (statistics != _deviceStatistics.end())
+            statistics->second->_busy++;
+        if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[device.deviceName], device.deviceName)) {
             return;
         }
+        if (statistics != _deviceStatistics.end())
+            statistics->second->_busy--;
     }
 
     // no vacant requests this time, storing the task to the respective queue
-    if (!preferred_device.empty())
+    if (!preferred_device.empty()) {
+        auto statistics = _deviceStatistics.find(preferred_device);
+        if (statistics != _deviceStatistics.end())
+            statistics->second->_queued++;
         _inferPipelineTasksDeviceSpecific[preferred_device]->push(std::move(inferPipelineTask));
-    else
+    } else {
         _inferPipelineTasks.push(std::move(inferPipelineTask));
+    }
+}
+
+void MultiDeviceExecutableNetwork::ScheduleByCompletionTime(Task& inferPipelineTask, const std::vector<DeviceInformation>& devices) {
+    // devices without statistics yet (no completed inferences) are estimated to complete immediately,
+    // so they are probed first, in the order of priorities
+    const DeviceInformation* bestDevice = nullptr;
+    double bestTime = std::numeric_limits<double>::max();
+    for (auto&& device : devices) {
+        const auto numWorkers = _workerRequests[device.deviceName].size();
+        if (0 == numWorkers)
+            continue;
+        const auto time = _deviceStatistics.at(device.deviceName)->EstimateCompletionTime(numWorkers);
+        if (time < bestTime) {
+            bestTime = time;
+            bestDevice = &device;
+        }
+    }
+    if (nullptr == bestDevice) {
+        _inferPipelineTasks.push(std::move(inferPipelineTask));
+        return;
+    }
+
+    const auto& deviceName = bestDevice->deviceName;
+    auto& statistics = *_deviceStatistics.at(deviceName);
+    auto& idleWorkerRequests = _idleWorkerRequests[deviceName];
+    statistics._busy++;
+    if (RunPipelineTask(inferPipelineTask, idleWorkerRequests, deviceName))
+        return;
+    statistics._busy--;
+
+    // the best device is busy, but it is still expected to complete the task earlier than others,
+    // so the task waits for the device specific request
+    statistics._queued++;
+    _inferPipelineTasksDeviceSpecific[deviceName]->push(std::move(inferPipelineTask));
+
+    // a request could become idle before the task was pushed, so it's re-checked to not leave the task in the queue
+    WorkerInferRequest* workerRequestPtr = nullptr;
+    if (idleWorkerRequests.try_pop(workerRequestPtr)) {
+        idleWorkerRequests.try_push(workerRequestPtr);
+        Task t;
+        if (_inferPipelineTasksDeviceSpecific[deviceName]->try_pop(t)) {
+            statistics._queued--;
+            ScheduleToWorkerInferRequest(std::move(t), deviceName);
+        }
+    }
 }
 
 bool MultiDeviceExecutableNetwork::RunPipelineTask(Task& inferPipelineTask,
                                             NotBusyWorkerRequests& idleWorkerRequests,
-                                            const DeviceName& preferred_device) {
+                                            const DeviceName& device) {
   WorkerInferRequest *workerRequestPtr = nullptr;
   if (idleWorkerRequests.try_pop(workerRequestPtr)) {
       IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
       _thisWorkerInferRequest = workerRequestPtr;
+      workerRequestPtr->_startTime = std::chrono::steady_clock::now();
       {
           auto capturedTask = std::move(inferPipelineTask);
           capturedTask();
       }
+      if (workerRequestPtr->_batchSize > 1 && !StartBatch(*workerRequestPtr, device)) {
+          // the request is not started, so it is returned to the idle ones by the guard
+          auto statistics = _deviceStatistics.find(device);
+          if (statistics != _deviceStatistics.end())
+              statistics->second->_busy--;
+          return true;
+      }
       idleGuard.Release();
       return true;
   }
   return false;
 }
 
+bool MultiDeviceExecutableNetwork::StartBatch(WorkerInferRequest& workerRequest, const DeviceName& device) {
+    // the waiting tasks are coalesced into the rest of the batch, the device specific ones first as they
+    // can't run elsewhere; at the low load the batch is started partially filled to not delay the request
+    auto statistics = _deviceStatistics.find(device);
+    Task t;
+    while (workerRequest._batchTasks.size() < workerRequest._batchSize) {
+        if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t)) {
+            if (statistics != _deviceStatistics.end())
+                statistics->second->_queued--;
+        } else if (!_inferPipelineTasks.try_pop(t)) {
+            break;
+        }
+        _thisWorkerInferRequest = &workerRequest;
+        auto capturedTask = std::move(t);
+        capturedTask();
+    }
+    if (workerRequest._batchTasks.empty())
+        return false;
+    try {
+        workerRequest._inferRequest->StartAsync();
+    } catch (...) {
+        // the coalesced requests are completed with the error, the worker request stays idle
+        workerRequest._exceptionPtr = std::current_exception();
+        auto capturedTasks = std::move(workerRequest._batchTasks);
+        workerRequest._batchTasks.clear();
+        for (auto&& capturedTask : capturedTasks)
+            capturedTask();
+        return false;
+    }
+    return true;
+}
+
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
     ScheduleToWorkerInferRequest(std::move(inferPipelineTask), _thisPreferredDeviceName);
 }
@@ -385,6 +590,9 @@ InferenceEngine::IInferRequestInternal::Ptr MultiDeviceExecutableNetwork::Create
     // borrowing device-specific blobs from the underlying requests for the device-agnostic, user-facing requests
     // this allows to potentially save on the data-copy later (if the requests are scheduled in the same order)
     for (const auto& device : _devicePrioritiesInitial) {
+        auto batch = _batchPerDevice.find(device.deviceName);
+        if (batch != _batchPerDevice.end() && batch->second > 1)
+            continue;  // the blobs of the batched replica are not of the user-facing request size
         auto& dev_requests = _workerRequests[device.deviceName];
         if ((num - sum) < dev_requests.size()) {
             request_to_share_blobs_with = dev_requests.at(num - sum)._inferRequest;
@@ -474,7 +682,10 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
         unsigned int res = 0u;
         for (auto n : _networksPerDevice) {
             try {
-                res += n.second->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+                // every slot of the batched replica serves a user-facing request
+                auto batch = _batchPerDevice.find(n.first);
+                res += n.second->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>() *
+                       (batch != _batchPerDevice.end() ? batch->second : 1u);
             } catch (const InferenceEngine::Exception &iie) {
                   IE_THROW()
                         << "Every device used with the Multi-Device should "
@@ -488,15 +699,24 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
         IE_ASSERT(it != _networksPerDevice.end());
         IE_SET_METRIC_RETURN(NETWORK_NAME, it->second->GetMetric(
             METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == MULTI_METRIC_KEY(DEVICE_THROUGHPUT)) {
+        std::map<std::string, float> throughput;
+        for (auto&& statistics : _deviceStatistics) {
+            throughput[statistics.first] = statistics.second->GetThroughput();
+        }
+        IE_SET_METRIC_RETURN(MULTI_DEVICE_THROUGHPUT, throughput);
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            MULTI_METRIC_KEY(DEVICE_THROUGHPUT)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                                                MultiDeviceConfigParams::KEY_MULTI_DEVICE_BATCH };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         IE_THROW() << "Unsupported Network metric: " << name;
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -17,6 +18,7 @@
 #include <ie_parallel.hpp>
 #include <threading/ie_itask_executor.hpp>
 #include <threading/ie_executor_manager.hpp>
+#include <threading/ie_lock_free_queue.hpp>
 #include "ie_icore.hpp"
 
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -48,57 +50,66 @@ using ThreadSafeQueue = tbb::concurrent_queue<T>;
 template <typename T>
 using ThreadSafeBoundedQueue = tbb::concurrent_bounded_queue<T>;
 #else
+// Unbounded queue: elements go to the lock-free ring buffer, the mutex guarded overflow queue is used only
+// when the ring is full, so the mutex is not touched while the number of pending elements is moderate
 template <typename T>
 class ThreadSafeQueue {
 public:
+    ThreadSafeQueue() : _ring(ringCapacity) {}
     void push(T value) {
+        // while overflow is not empty new elements are put after it to keep the order
+        if (0 == _overflowSize.load(std::memory_order_acquire) && _ring.try_push(value)) {
+            return;
+        }
         std::lock_guard<std::mutex> lock(_mutex);
-        _queue.push(std::move(value));
+        _overflow.push(std::move(value));
+        _overflowSize++;
     }
     bool try_pop(T& value) {
+        if (_ring.try_pop(value)) {
+            return true;
+        }
+        if (0 == _overflowSize.load(std::memory_order_acquire)) {
+            return false;
+        }
         std::lock_guard<std::mutex> lock(_mutex);
-        if (!_queue.empty()) {
-            value = std::move(_queue.front());
-            _queue.pop();
+        if (!_overflow.empty()) {
+            value = std::move(_overflow.front());
+            _overflow.pop();
+            _overflowSize--;
             return true;
         } else {
             return false;
         }
     }
 protected:
-    std::queue<T>   _queue;
-    std::mutex      _mutex;
+    static constexpr std::size_t                  ringCapacity = 256;
+    InferenceEngine::LockFreeBoundedQueue<T>      _ring;
+    std::atomic_size_t                            _overflowSize = {0};
+    std::queue<T>                                 _overflow;
+    std::mutex                                    _mutex;
 };
+// The capacity is set once before use (to the number of worker requests) and reset to zero to stop accepting elements
 template <typename T>
 class ThreadSafeBoundedQueue {
 public:
     ThreadSafeBoundedQueue() = default;
     bool try_push(T value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_capacity) {
-            _queue.push(std::move(value));
-        }
-        return _capacity;
+        return _capacity.load(std::memory_order_acquire) && _queue->try_push(value);
     }
     bool try_pop(T& value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_capacity && !_queue.empty()) {
-            value = std::move(_queue.front());
-            _queue.pop();
-            return true;
-        } else {
-            return false;
-        }
+        return _capacity.load(std::memory_order_acquire) && _queue->try_pop(value);
     }
     void set_capacity(std::size_t newCapacity) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        _capacity = newCapacity;
+        if (newCapacity > 0 && nullptr == _queue) {
+            _queue.reset(new InferenceEngine::LockFreeBoundedQueue<T>(newCapacity));
+        }
+        _capacity.store(newCapacity > 0 && nullptr != _queue, std::memory_order_release);
     }
 
 protected:
-    std::queue<T>   _queue;
-    std::mutex      _mutex;
-    bool            _capacity = false;
+    std::unique_ptr<InferenceEngine::LockFreeBoundedQueue<T>>   _queue;
+    std::atomic<bool>                                           _capacity = {false};
 };
 #endif
 
@@ -110,19 +121,43 @@ public:
         InferenceEngine::SoIInferRequestInternal  _inferRequest;
         InferenceEngine::Task                     _task;
         std::exception_ptr                        _exceptionPtr = nullptr;
+        std::chrono::steady_clock::time_point     _startTime;
+        // the request of the batched replica runs the coalesced requests, each in its own slot of the batch
+        std::size_t                               _batchSize = 1;
+        std::vector<InferenceEngine::Task>        _batchTasks;
     };
     using NotBusyWorkerRequests = ThreadSafeBoundedQueue<WorkerInferRequest*>;
 
+    // Live statistics of the device used by the MULTI_COMPLETION_TIME scheduling policy and DEVICE_THROUGHPUT metric
+    struct DeviceStatistics {
+        void Completed(std::chrono::steady_clock::time_point startTime);
+        double EstimateCompletionTime(std::size_t numWorkers) const;
+        float GetThroughput() const;
+
+        std::atomic_size_t                        _busy = {0};    // requests running on the device
+        std::atomic_size_t                        _queued = {0};  // tasks waiting in the device specific queue
+
+    private:
+        mutable std::mutex                        _mutex;
+        // exponentially weighted moving averages (in microseconds) of the latency and interval between completions
+        double                                    _latency = 0.0;
+        double                                    _completionInterval = 0.0;
+        std::size_t                               _completed = 0;
+        std::chrono::steady_clock::time_point     _lastCompletion;
+    };
+
     explicit MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::SoExecutableNetworkInternal>&        networksPerDevice,
                                           const std::vector<DeviceInformation>&                                 networkDevices,
                                           const std::unordered_map<std::string, InferenceEngine::Parameter>&    config,
-                                          const bool                                                            needPerfCounters = false);
+                                          const bool                                                            needPerfCounters = false,
+                                          const DeviceMap<unsigned int>&                                        batchPerDevice = {});
     MultiDeviceExecutableNetwork(const std::string&                           modelPath,
                                  const InferenceEngine::CNNNetwork&           network,
                                  const std::vector<DeviceInformation>&        metaDevices,
                                  const std::string&                           strDevices,
                                  MultiDeviceInferencePlugin*                  plugin,
-                                 const bool                                   needPerfCounters = false);
+                                 const bool                                   needPerfCounters = false,
+                                 const bool                                   releaseCpuNetwork = false);
 
     void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) override;
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
@@ -153,14 +188,20 @@ public:
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
     std::atomic_size_t                                          _numRequestsCreated = {0};
+    DeviceMap<std::unique_ptr<DeviceStatistics>>                _deviceStatistics;
+    bool                                                        _scheduleByCompletionTime = false;
+    DeviceMap<unsigned int>                                     _batchPerDevice;
 
 private:
     void GenerateWorkers(const std::string& device, const InferenceEngine::SoExecutableNetworkInternal& executableNetwork);
     void WaitActualNetworkReady() const;
     void WaitFirstNetworkReady();
-    static bool RunPipelineTask(InferenceEngine::Task& inferPipelineTask,
-                                NotBusyWorkerRequests& idleWorkerRequests,
-                                const DeviceName& preferred_device);
+    void TryReleaseCpuNetwork();
+    void ScheduleByCompletionTime(InferenceEngine::Task& inferPipelineTask, const std::vector<DeviceInformation>& devices);
+    bool RunPipelineTask(InferenceEngine::Task& inferPipelineTask,
+                         NotBusyWorkerRequests& idleWorkerRequests,
+                         const DeviceName& device);
+    bool StartBatch(WorkerInferRequest& workerRequest, const DeviceName& device);
 
 private:
     std::shared_ptr<InferenceEngine::ICore>                             _core;
@@ -177,6 +218,11 @@ private:
     DeviceInformation                                                   _cpuDevice;
     DeviceInformation                                                   _acceleratorDevice;
     mutable std::once_flag                                              _oc;
+    // AUTO warm start: the CPU serves the requests until the accelerator completes the first inference
+    bool                                                                _releaseCpuNetwork = {false};
+    std::atomic<bool>                                                   _acceleratorInferred = {false};
+    std::atomic<bool>                                                   _cpuReleasing = {false};
+    std::atomic<bool>                                                   _cpuReleased = {false};
 };
 
 }  // namespace MultiDevicePlugin
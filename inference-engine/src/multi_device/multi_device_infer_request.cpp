@@ -9,10 +9,36 @@
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 #include <blob_factory.hpp>
 
+#include <cstring>
+
 namespace MultiDevicePlugin {
 
 using namespace InferenceEngine;
 
+namespace {
+void CopyBatchSlot(const std::string& name, const Blob::Ptr& blob, const Blob::Ptr& batchedBlob,
+                   std::size_t slot, std::size_t batch, bool toBatched) {
+    auto memoryBlob = as<MemoryBlob>(blob);
+    auto batchedMemoryBlob = as<MemoryBlob>(batchedBlob);
+    if (!memoryBlob || !batchedMemoryBlob)
+        IE_THROW() << "The batched device of the MULTI supports the memory blobs only, the blob " << name << " is not";
+    const auto byteSize = memoryBlob->byteSize();
+    if (batchedMemoryBlob->byteSize() != byteSize * batch)
+        IE_THROW() << "The blob " << name << " of " << byteSize << " bytes doesn't match the slot of the batched blob of "
+                   << batchedMemoryBlob->byteSize() << " bytes (batch " << batch << ")";
+    if (toBatched) {
+        auto memory = memoryBlob->rmap();
+        // the other slots of the batched blob are kept intact
+        auto batchedMemory = batchedMemoryBlob->rwmap();
+        std::memcpy(batchedMemory.as<std::uint8_t*>() + slot * byteSize, memory.as<const std::uint8_t*>(), byteSize);
+    } else {
+        auto memory = memoryBlob->wmap();
+        auto batchedMemory = batchedMemoryBlob->rmap();
+        std::memcpy(memory.as<std::uint8_t*>(), batchedMemory.as<const std::uint8_t*>() + slot * byteSize, byteSize);
+    }
+}
+}  // namespace
+
 // ------------------------------MultiDeviceInferRequest----------------------------
 MultiDeviceInferRequest::MultiDeviceInferRequest(const InputsDataMap&   networkInputs,
                                                  const OutputsDataMap&  networkOutputs,
@@ -65,6 +91,21 @@ void MultiDeviceInferRequest::SetBlobsToAnotherRequest(const SoIInferRequestInte
     }
 }
 
+void MultiDeviceInferRequest::SetBlobsToBatchSlot(const SoIInferRequestInternal& req, std::size_t slot, std::size_t batch) {
+    for (const auto &it : _networkInputs) {
+        auto &name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBatchSlot(name, GetBlob(name), req->GetBlob(name), slot, batch, true);
+    }
+}
+
+void MultiDeviceInferRequest::GetBlobsFromBatchSlot(const SoIInferRequestInternal& req, std::size_t slot, std::size_t batch) {
+    for (const auto &it : _networkOutputs) {
+        auto &name = it.first;
+        CopyBatchSlot(name, GetBlob(name), req->GetBlob(name), slot, batch, false);
+    }
+}
+
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MultiDeviceInferRequest::GetPerformanceCounts() const {
     IE_THROW(NotImplemented);
 }
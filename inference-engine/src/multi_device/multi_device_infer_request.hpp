@@ -28,6 +28,9 @@ public:
     void InferImpl() override;
     // Multi-Device impl specific: sets the data (blobs from the device-less requests to the specific device request)
     void SetBlobsToAnotherRequest(const InferenceEngine::SoIInferRequestInternal& req);
+    // copies the inputs to the slot of the request of the batched replica and the outputs back from the slot
+    void SetBlobsToBatchSlot(const InferenceEngine::SoIInferRequestInternal& req, std::size_t slot, std::size_t batch);
+    void GetBlobsFromBatchSlot(const InferenceEngine::SoIInferRequestInternal& req, std::size_t slot, std::size_t batch);
 };
 
 }  // namespace MultiDevicePlugin
@@ -9,11 +9,14 @@
 #include <map>
 #include <unordered_map>
 #include <unordered_set>
+#include <sstream>
+#include <algorithm>
 
 #include <ngraph/opsets/opset1.hpp>
 #include <transformations/utils/utils.hpp>
 
 #include <ie_metric_helpers.hpp>
+#include <ie_ngraph_utils.hpp>
 #include <ie_performance_hints.hpp>
 #include <threading/ie_executor_manager.hpp>
 #include "multi_device_plugin.hpp"
@@ -56,9 +59,71 @@ namespace {
     std::vector<std::string> supported_configKeys = []() -> decltype(PerfHintsConfig::SupportedKeys()) {
                     auto res = PerfHintsConfig::SupportedKeys();
                     res.push_back(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES);
+                    res.push_back(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+                    res.push_back(MultiDeviceConfigParams::KEY_MULTI_DEVICE_BATCH);
                     res.push_back(CONFIG_KEY_INTERNAL(MULTI_WORK_MODE_AS_AUTO));
                     return res;
                 }();
+
+    // parses the comma-separated <device>:<batch> pairs of the MULTI_DEVICE_BATCH value
+    DeviceMap<unsigned int> ParseDeviceBatch(const std::string& value) {
+        DeviceMap<unsigned int> batchPerDevice;
+        std::stringstream stream(value);
+        std::string token;
+        while (std::getline(stream, token, ',')) {
+            if (token.empty())
+                continue;
+            const auto delimiter = token.find_last_of(':');
+            if (delimiter == std::string::npos || delimiter == 0 || delimiter + 1 == token.size())
+                IE_THROW() << "Unsupported " << MultiDeviceConfigParams::KEY_MULTI_DEVICE_BATCH << " value: " << value
+                           << ", the <device>:<batch> pairs are expected";
+            int batch = 0;
+            try {
+                batch = std::stoi(token.substr(delimiter + 1));
+            } catch (...) {
+                batch = 0;
+            }
+            if (batch <= 0)
+                IE_THROW() << "Batch value for '" << token.substr(0, delimiter) << "' must be > 0 in "
+                           << MultiDeviceConfigParams::KEY_MULTI_DEVICE_BATCH << " value: " << value;
+            batchPerDevice[token.substr(0, delimiter)] = static_cast<unsigned int>(batch);
+        }
+        return batchPerDevice;
+    }
+
+    // the replica of the network with the first dimension of all the inputs multiplied by the batch,
+    // each slot of the batch has the memory layout of the original network I/O
+    CNNNetwork MakeBatchedNetwork(const CNNNetwork& network, unsigned int batch, const DeviceName& deviceName) {
+        auto batchedNetwork = details::cloneNetwork(network);
+        auto shapes = batchedNetwork.getInputShapes();
+        for (auto&& shape : shapes) {
+            if (shape.second.empty())
+                IE_THROW() << "Network can't be batched for the " << deviceName << ": the input " << shape.first << " is a scalar";
+            shape.second[0] *= batch;
+        }
+        batchedNetwork.reshape(shapes);
+
+        const auto outputs = network.getOutputsInfo();
+        for (auto&& output : batchedNetwork.getOutputsInfo()) {
+            const auto& dims = output.second->getTensorDesc().getDims();
+            auto expectedDims = outputs.at(output.first)->getTensorDesc().getDims();
+            if (!expectedDims.empty())
+                expectedDims[0] *= batch;
+            if (expectedDims.empty() || dims != expectedDims)
+                IE_THROW() << "Network can't be batched for the " << deviceName << ": the output " << output.first
+                           << " is not batched along the first dimension";
+        }
+        return batchedNetwork;
+    }
+
+    void CheckMultiConfigValue(const std::pair<const std::string, std::string>& kvp) {
+        if (kvp.first == MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY &&
+            kvp.second != MultiDeviceConfigParams::MULTI_PRIORITY &&
+            kvp.second != MultiDeviceConfigParams::MULTI_COMPLETION_TIME)
+            IE_THROW() << "Unsupported " << kvp.first << " value: " << kvp.second;
+        if (kvp.first == MultiDeviceConfigParams::KEY_MULTI_DEVICE_BATCH)
+            ParseDeviceBatch(kvp.second);
+    }
 }  // namespace
 
 std::map<std::string, std::string> MultiDeviceInferencePlugin::GetSupportedConfig(
@@ -165,6 +230,7 @@ void MultiDeviceInferencePlugin::SetConfig(const std::map<std::string, std::stri
         if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), name)) {
             if (std::find(perf_hints_configs.begin(), perf_hints_configs.end(), kvp.first) != perf_hints_configs.end())
                 PerfHintsConfig::CheckConfigAndValue(kvp);
+            CheckMultiConfigValue(kvp);
             _config[name] = kvp.second;
         } else {
             IE_THROW() << "Unsupported config key: " << name;
@@ -266,7 +332,10 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
              strDevices += ((iter + 1) == supportDevices.end()) ? "" : ",";
         }
 
-        return std::make_shared<MultiDeviceExecutableNetwork>(modelPath, network, supportDevices, strDevices, this, needPerfCounters);
+        auto releaseCpu = fullConfig.find(AUTO_CONFIG_KEY(RELEASE_CPU_NETWORK));
+        bool releaseCpuNetwork = releaseCpu != fullConfig.end() && releaseCpu->second == PluginConfigParams::YES;
+        return std::make_shared<MultiDeviceExecutableNetwork>(modelPath, network, supportDevices, strDevices, this,
+                                                              needPerfCounters, releaseCpuNetwork);
     }
 
     if (priorities == fullConfig.end()) {
@@ -274,7 +343,44 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
     } else {  // for use case -d MULTI:xPU or -d AUTO:xPU
         metaDevices = ParseMetaDevices(priorities->second, fullConfig);
         multiNetworkConfig.insert(*priorities);
+
+        // the number of requests from the performance hint is for the whole MULTI, so the devices share it
+        const auto numRequests = fullConfig.find(PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS);
+        if (numRequests != fullConfig.end() && metaDevices.size() > 1) {
+            const auto requests = PerfHintsConfig::CheckPerformanceHintRequestValue(numRequests->second);
+            if (requests > 0) {
+                const auto requestsPerDevice = std::to_string((requests + metaDevices.size() - 1) / metaDevices.size());
+                for (auto& device : metaDevices) {
+                    auto deviceRequests = device.config.find(PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS);
+                    if (deviceRequests != device.config.end()) {
+                        deviceRequests->second = requestsPerDevice;
+                    }
+                }
+            }
+        }
     }
+    auto policy = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (policy != fullConfig.end() &&
+        policy->second != MultiDeviceConfigParams::MULTI_PRIORITY &&
+        policy->second != MultiDeviceConfigParams::MULTI_COMPLETION_TIME) {
+        IE_THROW() << "Unsupported " << policy->first << " value: " << policy->second;
+    }
+    multiNetworkConfig[MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY] =
+        policy != fullConfig.end() ? policy->second : std::string(MultiDeviceConfigParams::MULTI_PRIORITY);
+
+    DeviceMap<unsigned int> batchPerDevice;
+    auto deviceBatch = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_DEVICE_BATCH);
+    if (deviceBatch != fullConfig.end()) {
+        batchPerDevice = ParseDeviceBatch(deviceBatch->second);
+        for (auto&& batch : batchPerDevice) {
+            if (std::none_of(metaDevices.begin(), metaDevices.end(),
+                             [&](const DeviceInformation& d) { return d.deviceName == batch.first; }))
+                IE_THROW() << "The " << batch.first << " device from the " << MultiDeviceConfigParams::KEY_MULTI_DEVICE_BATCH
+                           << " is not in the " << MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES;
+        }
+    }
+    multiNetworkConfig[MultiDeviceConfigParams::KEY_MULTI_DEVICE_BATCH] =
+        deviceBatch != fullConfig.end() ? deviceBatch->second : std::string();
 
     DeviceMap<SoExecutableNetworkInternal> executableNetworkPerDevice;
     std::mutex load_mutex;
@@ -285,7 +391,15 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
             const auto &deviceName = p.deviceName;
             const auto &deviceConfig = p.config;
             SoExecutableNetworkInternal exec_net;
-            if (modelPath.empty()) {
+            auto batch = batchPerDevice.find(deviceName);
+            if (batch != batchPerDevice.end() && batch->second > 1) {
+                if (!modelPath.empty()) {
+                    std::call_once(readNetworkFlag, [&]() {
+                        network = GetCore()->ReadNetwork(modelPath, std::string());
+                    });
+                }
+                exec_net = GetCore()->LoadNetwork(MakeBatchedNetwork(network, batch->second, deviceName), deviceName, deviceConfig);
+            } else if (modelPath.empty()) {
                 exec_net = GetCore()->LoadNetwork(network, deviceName, deviceConfig);
             } else if (GetCore()->DeviceSupportsImportExport(deviceName)) {
                 exec_net = GetCore()->LoadNetwork(modelPath, deviceName, deviceConfig);
@@ -325,13 +439,24 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
     auto impl = std::make_shared<MultiDeviceExecutableNetwork>(executableNetworkPerDevice,
                                                                metaDevices,
                                                                multiNetworkConfig,
-                                                               enablePerfCounters);
+                                                               enablePerfCounters,
+                                                               batchPerDevice);
     if (!modelPath.empty()) {
-        SetExeNetworkInfo(impl,
-                          executableNetworkPerDevice.begin()->second->GetInputsInfo(),
-                          executableNetworkPerDevice.begin()->second->GetOutputsInfo());
-        impl->setInputs(executableNetworkPerDevice.begin()->second->getInputs());
-        impl->setOutputs(executableNetworkPerDevice.begin()->second->getOutputs());
+        // the batched replicas have the I/O of the batch size, so the info is taken from the network as is
+        auto unbatched = std::find_if(executableNetworkPerDevice.begin(), executableNetworkPerDevice.end(),
+                                      [&](const std::pair<const DeviceName, SoExecutableNetworkInternal>& n) {
+                                          auto batch = batchPerDevice.find(n.first);
+                                          return batch == batchPerDevice.end() || batch->second <= 1;
+                                      });
+        if (unbatched != executableNetworkPerDevice.end()) {
+            SetExeNetworkInfo(impl, unbatched->second->GetInputsInfo(), unbatched->second->GetOutputsInfo());
+            impl->setInputs(unbatched->second->getInputs());
+            impl->setOutputs(unbatched->second->getOutputs());
+        } else {
+            SetExeNetworkInfo(impl, constMapCast(network.getInputsInfo()), constMapCast(network.getOutputsInfo()));
+            if (network.getFunction())
+                SetExeNetworkInfo(impl, network.getFunction());
+        }
     }
     return impl;
 }
@@ -520,7 +645,11 @@ void MultiDeviceInferencePlugin::CheckConfig(const std::map<std::string, std::st
     // TODO need to optimize this code, too much duplicated code
     const auto perf_hints_configs = PerfHintsConfig::SupportedKeys();
     for (auto&& kvp : config) {
-        if (kvp.first.find("AUTO_") == 0) {
+        if (kvp.first == AUTO_CONFIG_KEY(RELEASE_CPU_NETWORK)) {
+            if (kvp.second != PluginConfigParams::YES && kvp.second != PluginConfigParams::NO)
+                IE_THROW() << "Unsupported config value: " << kvp.second
+                           << " for key: " << kvp.first;
+        } else if (kvp.first.find("AUTO_") == 0) {
             continue;
         } else if (kvp.first == PluginConfigParams::KEY_PERF_COUNT) {
             if (kvp.second == PluginConfigParams::YES) {
@@ -544,6 +673,8 @@ void MultiDeviceInferencePlugin::CheckConfig(const std::map<std::string, std::st
             PerfHintsConfig::CheckConfigAndValue(kvp);
         } else if (supported_configKeys.end() == std::find(supported_configKeys.begin(), supported_configKeys.end(), kvp.first)) {
             IE_THROW() << "Unsupported config key: " << kvp.first;
+        } else {
+            CheckMultiConfigValue(kvp);
         }
     }
 }
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <exception>
 #include <future>
 #include <map>
@@ -91,6 +92,7 @@ class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
                                                   }
                                               }),
                                _futures.end());
+                _lastInferDirect = false;
                 _promise = {};
                 _futures.emplace_back(_promise.get_future().share());
             } break;
@@ -183,11 +185,17 @@ public:
         }
         auto status = std::future_status::deferred;
 
-        // Just use the last '_futures' member to wait pipeline completion
-        auto future = [&] {
-            std::lock_guard<std::mutex> lock{_mutex};
-            return _futures.empty() ? std::shared_future<void>{} : _futures.back();
-        }();
+        std::shared_future<void> future;
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+            if (_lastInferDirect) {
+                return WaitDirectInfer(lock, millis_timeout);
+            }
+            // Just use the last '_futures' member to wait pipeline completion
+            if (!_futures.empty()) {
+                future = _futures.back();
+            }
+        }
 
         if (!future.valid()) {
             return StatusCode::INFER_NOT_STARTED;
@@ -221,6 +229,10 @@ public:
     }
 
     void Infer() override {
+        if (_directSyncInfer) {
+            InferDirectly();
+            return;
+        }
         DisableCallbackGuard disableCallbackGuard{this};
         InferImpl([&] {
             Infer_ThreadUnsafe();
@@ -257,6 +269,12 @@ public:
         _syncRequest->SetBatch(batch);
     };
 
+    void SetPriority(int priority) override {
+        CheckState();
+        _priority = priority;
+        _syncRequest->SetPriority(priority);
+    }
+
     void SetCallback(Callback callback) override {
         CheckState();
         _callback = std::move(callback);
@@ -304,7 +322,8 @@ protected:
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
         IE_ASSERT(nullptr != firstStageExecutor);
-        firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
+        firstStageExecutor->runWithPriority(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)),
+                                            _priority);
     }
 
     /**
@@ -338,6 +357,13 @@ protected:
     ITaskExecutor::Ptr _syncCallbackExecutor;  //!< Used to run post inference callback in synchronous pipline
     Pipeline _pipeline;                        //!< Pipeline variable that should be filled by inherited class.
     Pipeline _syncPipeline;  //!< Synchronous pipeline variable that should be filled by inherited class.
+    /**
+     * @brief Infer() runs AsyncInferRequestThreadSafeDefault::_syncPipeline stages one by one on the calling thread
+     * without tasks, promises and futures. Can be set by inherited class only if the executors of the synchronous
+     * pipeline run the tasks in place. The callback is not called, Wait() reports the completion of the direct inference
+     * from the request state.
+     */
+    bool _directSyncInfer = false;
 
     /**
      * @brief Starts an asynchronous pipeline thread unsafe.
@@ -363,6 +389,85 @@ protected:
     }
 
 private:
+    void InferDirectly() {
+        _syncRequest->checkBlobs();
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            switch (_state) {
+            case InferState::Busy:
+                IE_THROW(RequestBusy);
+            case InferState::Canceled:
+                IE_THROW(InferCancelled);
+            case InferState::Stop:
+                return;
+            case InferState::Idle:
+                break;
+            }
+            _state = InferState::Busy;
+            _lastInferDirect = true;
+            _directInferException = nullptr;
+        }
+        // the streams executors swallow the exceptions of the tasks, so the exception is passed through the variable
+        std::exception_ptr currentException = nullptr;
+        for (auto&& stage : _syncPipeline) {
+            auto& stageTask = std::get<Stage_e::task>(stage);
+            std::get<Stage_e::executor>(stage)->run([&] {
+                try {
+                    stageTask();
+                } catch (...) {
+                    currentException = std::current_exception();
+                }
+            });
+            if (nullptr != currentException) {
+                break;
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            if (_state != InferState::Stop) {
+                _state = InferState::Idle;
+            }
+            _directInferException = currentException;
+        }
+        _directInferDone.notify_all();
+        if (nullptr != currentException) {
+            std::rethrow_exception(currentException);
+        }
+    }
+
+    /**
+     * @brief Implements Wait() for the direct synchronous inference, which has no future to wait for
+     * @param lock The lock of `_mutex`
+     * @param millis_timeout A timeout is `ms` to wait or special enum value of InferRequest::WaitMode
+     * @return A status code
+     */
+    StatusCode WaitDirectInfer(std::unique_lock<std::mutex>& lock, int64_t millis_timeout) {
+        auto isDone = [&] {
+            return _state != InferState::Busy && _state != InferState::Canceled;
+        };
+        bool done = false;
+        switch (millis_timeout) {
+        case InferRequest::WaitMode::RESULT_READY: {
+            _directInferDone.wait(lock, isDone);
+            done = true;
+        } break;
+        case InferRequest::WaitMode::STATUS_ONLY: {
+            done = isDone();
+        } break;
+        default: {
+            done = _directInferDone.wait_for(lock, std::chrono::milliseconds{millis_timeout}, isDone);
+        } break;
+        }
+
+        if (!done) {
+            return StatusCode::RESULT_NOT_READY;
+        }
+        if (nullptr != _directInferException) {
+            std::rethrow_exception(_directInferException);
+        }
+        return StatusCode::OK;
+    }
+
     /**
      * @brief Create a task with next pipeline stage.
      * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
@@ -391,7 +496,9 @@ private:
                         auto& nextStage = *itNextStage;
                         auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
                         IE_ASSERT(nullptr != nextStageExecutor);
-                        nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
+                        nextStageExecutor->runWithPriority(
+                            MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)),
+                            _priority);
                     }
                 } catch (...) {
                     currentException = std::current_exception();
@@ -427,7 +534,7 @@ private:
                     if (nullptr == callbackExecutor) {
                         lastStageTask();
                     } else {
-                        callbackExecutor->run(std::move(lastStageTask));
+                        callbackExecutor->runWithPriority(std::move(lastStageTask), _priority);
                     }
                 }
             },
@@ -438,5 +545,8 @@ private:
     mutable std::mutex _mutex;
     Futures _futures;
     InferState _state = InferState::Idle;
+    bool _lastInferDirect = false;
+    std::exception_ptr _directInferException = nullptr;
+    std::condition_variable _directInferDone;
 };
 }  // namespace InferenceEngine
@@ -109,6 +109,19 @@ public:
      */
     virtual void SetBatch(int batch);
 
+    /**
+     * @brief Sets the priority of the following inference calls of this request. The task executors keeping a queue
+     * start the pipeline stages of more urgent requests first.
+     * @param priority - the request priority, higher value is more urgent, `0` is the default one
+     */
+    virtual void SetPriority(int priority);
+
+    /**
+     * @brief Gets the priority of the request
+     * @return The request priority
+     */
+    int GetPriority() const;
+
     /**
      * @brief Queries memory states.
      * @return Returns memory states
@@ -234,6 +247,7 @@ protected:
     InferenceEngine::BlobMap _outputs;                //!< A map of user passed blobs for network outputs
     std::map<std::string, PreProcessDataPtr> _preProcData;  //!< A map of pre-process data per input
     int m_curBatch = -1;                                    //!< Current batch value used in dynamic batching
+    int _priority = 0;                                      //!< The priority of the pipeline stages tasks
 
     /**
      * @brief A shared pointer to IInferRequestInternal
@@ -45,6 +45,27 @@ DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
  */
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
+/**
+ * @brief Enables per-stream lock-free task queues with work stealing between streams in CPU Executor Streams
+ *        instead of a single mutex-guarded queue. Accepts YES/NO values, NO by default
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAMS_WORK_STEALING);
+
+/**
+ * @brief Lets the threads of a stream bound with CPU_BIND_THREAD=CACHE_AWARE run on the SMT siblings of its cores,
+ *        so the stream takes fewer cores of the cache group. Accepts YES/NO values, NO by default
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_BIND_SMT_SIBLINGS);
+
+/**
+ * @brief Limit \#threads that are used by the CPU Executor Streams placed on the Little cores of hybrid CPUs,
+ *        0 (default) means the same value as for the Big cores
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_LITTLE_CORE_THREADS_PER_STREAM);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -21,6 +21,7 @@
 #include "ie_input_info.hpp"
 #include "ie_parameter.hpp"
 #include "openvino/pp.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "so_ptr.hpp"
 
 namespace ov {
@@ -241,6 +242,23 @@ public:
                                                                       const std::shared_ptr<RemoteContext>& context,
                                                                       const std::map<std::string, std::string>& config);
 
+    /**
+     * @brief Creates an executable network from a previously exported network mapped into memory
+     *        (e.g. a compiled blob from the model cache)
+     * @note Plugins can override it to reference the data (e.g. weights) in place instead of copying it,
+     *       the memory object has to be kept alive while it is referenced. The default implementation
+     *       imports the network from the stream
+     * @param networkModel Reference to network model input stream on top of the networkMemory,
+     *        the stream positions are the offsets in the memory
+     * @param networkMemory The memory with the network model
+     * @param config A string -> string map of parameters
+     * @return An Executable network
+     */
+    virtual std::shared_ptr<IExecutableNetworkInternal> ImportNetwork(
+        std::istream& networkModel,
+        const std::shared_ptr<ov::util::MappedMemory>& networkMemory,
+        const std::map<std::string, std::string>& config);
+
     /**
      * @brief Sets pointer to ICore interface
      * @param core Pointer to Core interface
@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines fast non-cryptographic hashing of large memory regions
+ * @file ie_data_hash.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief      Computes 64-bit non-cryptographic hash of a memory region
+ * @ingroup    ie_dev_api_memory
+ *
+ * Data is split into fixed-size blocks that are hashed in parallel with xxHash64 algorithm,
+ * block digests are then hashed once more. The result depends only on the data content and
+ * does not depend on the number of threads, so it can be used as a persistent cache key.
+ *
+ * @param data A pointer to the memory region
+ * @param size A size of the memory region in bytes
+ * @return     64-bit hash value
+ */
+INFERENCE_ENGINE_API_CPP(uint64_t) computeDataHash(const void* data, size_t size);
+
+/**
+ * @brief      Computes 64-bit hash of a memory region on the calling thread only
+ * @ingroup    ie_dev_api_memory
+ *
+ * Suitable for small buffers or for callers which are already executed inside parallel region.
+ * Note that the result differs from computeDataHash() for regions larger than one hashing block.
+ *
+ * @param data A pointer to the memory region
+ * @param size A size of the memory region in bytes
+ * @param seed A seed value
+ * @return     64-bit hash value
+ */
+INFERENCE_ENGINE_API_CPP(uint64_t) computeDataHashSequential(const void* data, size_t size, uint64_t seed = 0);
+
+}  // namespace InferenceEngine
@@ -0,0 +1,114 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file with helpers to use a memory mapped file (e.g. compiled blob from the model cache) in place
+ * @file ie_mapped_memory.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <streambuf>
+#include <utility>
+
+#include "ie_allocator.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Part of a mapped memory region starting at the given offset, keeps the whole mapping alive
+ * @ingroup ie_dev_api_plugin_api
+ */
+class MappedMemoryView : public ov::util::MappedMemory {
+    std::shared_ptr<ov::util::MappedMemory> _mapped;
+    std::size_t _offset;
+    std::size_t _size;
+
+public:
+    /**
+     * @brief Constructs a view of the region
+     * @param mapped The mapped memory
+     * @param offset The offset of the view from the beginning of the region
+     * @param size The size of the view, the rest of the region by default
+     */
+    MappedMemoryView(std::shared_ptr<ov::util::MappedMemory> mapped,
+                     std::size_t offset,
+                     std::size_t size = static_cast<std::size_t>(-1))
+        : _mapped(std::move(mapped)),
+          _offset(offset < _mapped->size() ? offset : _mapped->size()),
+          _size(size < _mapped->size() - _offset ? size : _mapped->size() - _offset) {}
+
+    char* data() noexcept override {
+        return _mapped->data() + _offset;
+    }
+
+    std::size_t size() const noexcept override {
+        return _size;
+    }
+};
+
+/**
+ * @brief Allocator which exposes already mapped memory to a Blob.
+ * Keeps the mapping alive while the blob exists, so no copy of the data is made.
+ * @ingroup ie_dev_api_plugin_api
+ */
+class MappedMemoryAllocator : public IAllocator {
+    std::shared_ptr<ov::util::MappedMemory> _mapped;
+
+public:
+    explicit MappedMemoryAllocator(std::shared_ptr<ov::util::MappedMemory> mapped) : _mapped(std::move(mapped)) {}
+
+    void* lock(void* handle, LockOp) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(std::size_t size) noexcept override {
+        if (size > _mapped->size())
+            return nullptr;
+        // zero-size files are mapped to nullptr, return non-null handle to keep Blob allocated
+        return _mapped->size() ? static_cast<void*>(_mapped->data()) : static_cast<void*>(this);
+    }
+
+    bool free(void*) noexcept override {
+        return true;
+    }
+};
+
+/**
+ * @brief Read-only stream buffer on top of a memory region, so the region can be read with std::istream
+ * including seekg/tellg without copying it to the stream buffer first
+ * @ingroup ie_dev_api_plugin_api
+ */
+class MemoryStreamBuf : public std::streambuf {
+public:
+    MemoryStreamBuf(char* data, std::size_t size) {
+        setg(data, data, data + size);
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in)) {
+            return pos_type(off_type(-1));
+        }
+        const off_type size = egptr() - eback();
+        const off_type origin = dir == std::ios_base::beg ? 0 : dir == std::ios_base::cur ? gptr() - eback() : size;
+        const off_type target = origin + off;
+        if (target < 0 || target > size) {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), eback() + target, egptr());
+        return pos_type(target);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
+
+}  // namespace InferenceEngine
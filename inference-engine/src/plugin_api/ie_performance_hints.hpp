@@ -8,6 +8,9 @@
  */
 
 #pragma once
+#include <algorithm>
+#include <map>
+#include <string>
 #include <ie_parameter.hpp>
 #include <ie_plugin_config.hpp>
 
@@ -44,6 +47,19 @@ struct PerfHintsConfig {
         }
     }
 
+    /**
+     * @brief Limits the number of streams deduced from the performance hint by the number of requests
+     * @param num_streams number of streams deduced by a plugin
+     * @param config configuration of the LoadNetwork, its number of requests has priority over the one set with SetConfig
+     * @return number of streams which is not greater than the number of requests, if the latter is set
+     */
+    int LimitNumStreamsByNumRequests(int num_streams, const std::map<std::string, std::string>& config) const {
+        const auto num_requests = config.find(PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS);
+        const int requests = (num_requests != config.end()) ? CheckPerformanceHintRequestValue(num_requests->second)
+                                                            : ovPerfHintNumRequests;
+        return requests ? std::min(num_streams, requests) : num_streams;
+    }
+
     /**
      * @brief Supported Configuration keys
      * @return vector of supported configuration keys
@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines the cache of networks transformed by a plugin
+ * @file ie_transformations_cache.hpp
+ */
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "cpp/ie_cnn_network.h"
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+class ICore;
+class ICacheManager;
+
+/**
+ * @brief      Caches the networks after the plugin transformations pipeline in the cache directory
+ * @ingroup    ie_dev_api_plugin_api
+ *
+ * Intended for the plugins which cannot export the compiled network, so the Core caching does not
+ * apply to them, but the transformations take the notable part of the network loading. The transformed
+ * function is stored as IR produced by ngraph::pass::Serialize and read back with ICore::ReadNetwork,
+ * so only the networks consisting of the standard opsets operations are cached.
+ *
+ * The cache key is computed from the original network, the options affecting the transformations and
+ * the pipeline version, which the plugin must change each time its transformations change.
+ */
+class INFERENCE_ENGINE_API_CLASS(TransformationsCache) final {
+public:
+    /**
+     * @brief Transformations pipeline which gets a clone of the original network
+     */
+    using Transform = std::function<CNNNetwork(const CNNNetwork&)>;
+
+    /**
+     * @brief Constructs the cache
+     * @param cacheDir A directory to store the cache entries, the cache is disabled if it is empty
+     * @param pipelineVersion A version of the plugin transformations pipeline
+     */
+    TransformationsCache(const std::string& cacheDir, const std::string& pipelineVersion);
+
+    /**
+     * @brief Checks whether the cache directory is set
+     * @return true if the networks are cached
+     */
+    bool isEnabled() const;
+
+    /**
+     * @brief Reads the transformed network from cache or transforms the network and stores the result
+     * @param network The original network
+     * @param options The options which affect the transformations
+     * @param core The core used to read the cached network
+     * @param transform The transformations pipeline
+     * @return The transformed network
+     */
+    CNNNetwork getOrTransform(const CNNNetwork& network,
+                              const std::map<std::string, std::string>& options,
+                              const ICore& core,
+                              const Transform& transform) const;
+
+private:
+    std::string computeHash(const CNNNetwork& network, const std::map<std::string, std::string>& options) const;
+    CNNNetwork load(const std::string& hash, const CNNNetwork& network, const ICore& core) const;
+    void store(const std::string& hash, const CNNNetwork& transformed) const;
+
+    std::string m_pipelineVersion;
+    std::shared_ptr<ICacheManager> m_cacheManager;
+};
+
+}  // namespace InferenceEngine
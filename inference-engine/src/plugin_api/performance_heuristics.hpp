@@ -4,6 +4,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
+#include <algorithm>
 #include <cfloat>
 
 #include "ngraph/ngraph.hpp"
@@ -133,4 +134,35 @@ MemBandwidthPressure MemBandwidthPressureTolerance(
     return res;
 }
 
+/**
+ * @brief Deduces the number of streams for the THROUGHPUT hint from the memory bandwidth pressure of the network
+ * @param networkTolerance result of the MemBandwidthPressureTolerance for the network
+ * @param num_cores number of cores, the most aggressive number of streams
+ * @param default_num_streams the most conservative number of streams
+ * @param memThresholdAssumeLimited device specific threshold passed to the MemBandwidthPressureTolerance
+ * @return a stream per core for compute-limited networks, a stream per two cores for moderately memory-limited
+ * ones and the default number of streams otherwise
+ */
+inline int GetNumStreamsForThroughput(const MemBandwidthPressure& networkTolerance,
+                                      const int num_cores,
+                                      const int default_num_streams,
+                                      const float memThresholdAssumeLimited = MemBandwidthPressure::LIMITED) {
+    if (networkTolerance.max_mem_tolerance == MemBandwidthPressure::UNKNOWN) {
+        if ((networkTolerance.ratio_compute_convs == MemBandwidthPressure::ALL) ||
+            (networkTolerance.ratio_compute_deconvs == MemBandwidthPressure::ALL)) {
+            // all relevant layers (convs, etc) are compute-limited, the most aggressive val for #streams
+            return num_cores;
+        }
+        // otherwise (no recognized layers) falling back to the default value
+        return default_num_streams;
+    } else if (networkTolerance.max_mem_tolerance > memThresholdAssumeLimited) {
+        // network is below the device-specific threshold
+        return num_cores;
+    } else if (networkTolerance.max_mem_tolerance > MemBandwidthPressure::LIMITED) {
+        // network is below general threshold
+        return std::max(default_num_streams, num_cores / 2);
+    }
+    return default_num_streams;
+}
+
 }  // namespace ov
\ No newline at end of file
@@ -42,6 +42,16 @@ public:
 
     void run(Task task) override;
 
+    /**
+     * @brief Queues the task with the given priority, the idle streams take the most urgent task first.
+     *        Every few tasks the oldest one is taken regardless of its priority, so the low priority tasks are not
+     *        starved. With the work stealing only the tasks of the default priority are distributed to the streams
+     *        queues, the rest are kept in the shared queue checked by the streams first for the positive priority.
+     * @param task A task to start
+     * @param priority The task priority, higher value is more urgent
+     */
+    void runWithPriority(Task task, int priority) override;
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
@@ -29,6 +29,12 @@ public:
 
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config);
+
+    void setExternalExecutor(const ITaskExecutor::Ptr& executor);
+
+    ITaskExecutor::Ptr getExternalExecutor();
+
     // for tests purposes
     size_t getExecutorsNumber();
 
@@ -40,6 +46,8 @@ public:
 private:
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
     std::vector<std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr>> cpuStreamsExecutors;
+    std::unordered_map<std::string, IStreamsExecutor::Ptr> sharedCpuStreamsExecutors;
+    ITaskExecutor::Ptr externalExecutor;
     std::mutex streamExecutorMutex;
     std::mutex taskExecutorMutex;
 };
@@ -83,6 +91,28 @@ public:
     /// @private
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    /**
+     * @brief Returns the process-wide streams executor with the name of the config, which is shared by all its users
+     * @param config The config to create the executor with, if it doesn't exist yet; ignored otherwise
+     * @return A shared pointer to existing or newly created IStreamsExecutor
+     */
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config);
+
+    /**
+     * @brief Sets the application executor running the inference tasks of the plugins configured to use the external
+     * threading (e.g. CPUConfigParams::KEY_CPU_EXTERNAL_THREADING), so they don't create their own threads. Affects
+     * the networks loaded after the call
+     * @param executor The executor wrapping the thread pool of the application, nullptr to run the tasks on the
+     * threads submitting them
+     */
+    void setExternalExecutor(const ITaskExecutor::Ptr& executor);
+
+    /**
+     * @brief Returns the application executor set with setExternalExecutor()
+     * @return A shared pointer to the executor or nullptr
+     */
+    ITaskExecutor::Ptr getExternalExecutor();
+
     /**
      * @cond
      */
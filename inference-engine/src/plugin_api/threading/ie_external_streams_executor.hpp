@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_external_streams_executor.hpp
+ * @brief A header file for Inference Engine External Streams-based Executor Interface
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "threading/ie_istreams_executor.hpp"
+
+namespace InferenceEngine {
+/**
+ * @class ExternalStreamsExecutor
+ * @ingroup ie_dev_api_threading
+ * @brief Streams executor which doesn't own any threads. The tasks are executed by the threads of the application:
+ *        either by the host executor set with ExecutorManager::setExternalExecutor() or, if there is none, by the
+ *        thread calling run(). At most Config::_streams tasks are executed at once, each of them gets its own stream,
+ *        the rest wait in the queue and are picked up by the threads completing the previous tasks.
+ *        With the TBB threading the `ie_parallel` calls of a task run in the task arena of the executing thread, so
+ *        they share the workers and the work stealing with the application and no extra threads are created.
+ */
+class INFERENCE_ENGINE_API_CLASS(ExternalStreamsExecutor) : public IStreamsExecutor {
+public:
+    /**
+     * @brief A shared pointer to a ExternalStreamsExecutor object
+     */
+    using Ptr = std::shared_ptr<ExternalStreamsExecutor>;
+
+    /**
+     * @brief Constructor
+     * @param config Stream executor parameters, only the number of streams is used
+     * @param host The application executor running the tasks, nullptr to run them on the calling threads
+     */
+    explicit ExternalStreamsExecutor(const Config& config = {}, const ITaskExecutor::Ptr& host = nullptr);
+
+    /**
+     * @brief A class destructor
+     */
+    ~ExternalStreamsExecutor() override;
+
+    void run(Task task) override;
+
+    /**
+     * @brief Queues the task with the given priority, the threads completing the previous tasks take the most
+     *        urgent task first
+     * @param task A task to start
+     * @param priority The task priority, higher value is more urgent
+     */
+    void runWithPriority(Task task, int priority) override;
+
+    /**
+     * @brief Executes the task on the calling thread within the stream of the current task, the stream 0 is used
+     *        outside of the tasks of this executor
+     * @param task A task to execute
+     */
+    void Execute(Task task) override;
+
+    int GetStreamId() override;
+
+    int GetNumaNodeId() override;
+
+private:
+    struct Impl;
+    std::shared_ptr<Impl> _impl;
+    ITaskExecutor::Ptr _host;
+};
+
+}  // namespace InferenceEngine
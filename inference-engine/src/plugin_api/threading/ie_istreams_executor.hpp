@@ -44,8 +44,9 @@ public:
         // the following modes are implemented only for the TBB code-path:
         NUMA,  //!< Bind to the NUMA nodes (default mode for the non-hybrid CPUs on the Win/MacOS, where the 'CORES' is
                //!< not implemeneted)
-        HYBRID_AWARE  //!< Let the runtime bind the inference threads depending on the cores type (default mode for the
-                      //!< hybrid CPUs)
+        HYBRID_AWARE,  //!< Let the runtime bind the inference threads depending on the cores type (default mode for
+                       //!< the hybrid CPUs)
+        CACHE_AWARE    //!< Bind the threads of a stream to the cores sharing the last level cache (Linux only)
     };
 
     /**
@@ -103,6 +104,12 @@ public:
                          // (for large #streams)
         } _threadPreferredCoreType =
             PreferredCoreType::ANY;  //!< In case of @ref HYBRID_AWARE hints the TBB to affinitize
+        bool _workStealing = false;  //!< Use per-stream lock-free task queues with work stealing between streams
+        int _littleCoreThreadsPerStream = 0;  //!< In case of @ref HYBRID_AWARE binding with ROUND_ROBIN core type
+                                              //!< number of threads of the streams on the Little cores.
+                                              //!< Zero means the same as for the Big cores (_threadsPerStream)
+        bool _threadBindingSmt = false;  //!< In case of @ref CACHE_AWARE binding the threads of a stream run on the SMT
+                                         //!< siblings of its cores as well, so a stream takes fewer cores
 
         /**
          * @brief      A constructor with arguments
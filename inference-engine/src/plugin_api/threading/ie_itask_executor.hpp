@@ -61,6 +61,15 @@ public:
      */
     virtual void run(Task task) = 0;
 
+    /**
+     * @brief Execute InferenceEngine::Task with the given priority inside task executor context.
+     *        The executors keeping a queue of the tasks take the more urgent tasks first,
+     *        default implementation ignores the priority and calls run()
+     * @param task A task to start
+     * @param priority The task priority, higher value is more urgent, `0` is the priority of the run() tasks
+     */
+    virtual void runWithPriority(Task task, int priority);
+
     /**
      * @brief Execute all of the tasks and waits for its completion.
      *        Default runAndWait() method implementation uses run() pure virtual method
@@ -0,0 +1,133 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_lock_free_queue.hpp
+ * @brief A header file for lock-free bounded queue implementation
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Lock-free bounded multi-producer multi-consumer queue
+ * @ingroup ie_dev_api_threading
+ * @details The implementation is based on the ring buffer where each cell is guarded by its own sequence counter
+ *          (D. Vyukov's bounded MPMC queue). Producers and consumers only contend on a single atomic index each,
+ *          so the queue scales with the number of threads better than the mutex-guarded one.
+ *          Neither `try_push` nor `try_pop` blocks: they return `false` if the queue is full or empty respectively.
+ * @tparam T A type of the stored element, should be default- and move- constructible
+ */
+template <typename T>
+class LockFreeBoundedQueue {
+public:
+    /**
+     * @brief Constructs the queue
+     * @param capacity Maximal number of the elements, rounded up to the power of two
+     */
+    explicit LockFreeBoundedQueue(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        _mask = size - 1;
+        _cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    LockFreeBoundedQueue(const LockFreeBoundedQueue&) = delete;
+    LockFreeBoundedQueue& operator=(const LockFreeBoundedQueue&) = delete;
+
+    /**
+     * @brief Pushes the element to the end of the queue
+     * @param value The element to push. It is not changed if the queue is full
+     * @return `false` if the queue is full
+     */
+    bool try_push(T& value) {
+        Cell* cell = nullptr;
+        auto pos = _enqueueIndex._value.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto seq = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (_enqueueIndex._value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueueIndex._value.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_data = std::move(value);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pops the element from the beginning of the queue
+     * @param value The popped element
+     * @return `false` if the queue is empty
+     */
+    bool try_pop(T& value) {
+        Cell* cell = nullptr;
+        auto pos = _dequeueIndex._value.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto seq = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeueIndex._value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _dequeueIndex._value.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_data);
+        cell->_data = T{};
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Returns approximate number of elements in the queue
+     * @return Number of elements, may be outdated if the queue is used concurrently
+     */
+    std::size_t size_approx() const {
+        const auto enqueuePos = _enqueueIndex._value.load(std::memory_order_relaxed);
+        const auto dequeuePos = _dequeueIndex._value.load(std::memory_order_relaxed);
+        return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> _sequence;
+        T _data;
+    };
+
+    // producers and consumers indices are padded to the cache line size to avoid false sharing
+    struct PaddedIndex {
+        std::atomic<std::size_t> _value{0};
+        char _pad[64 - sizeof(std::atomic<std::size_t>)];
+    };
+
+    std::unique_ptr<Cell[]> _cells;
+    std::size_t _mask = 0;
+    PaddedIndex _enqueueIndex;
+    PaddedIndex _dequeueIndex;
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_priority_task_queue.hpp
+ * @brief A header file for the task queue with the priority lanes
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <queue>
+#include <utility>
+
+#include "threading/ie_itask_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Task queue with the priority lanes, it is not thread-safe
+ * @ingroup ie_dev_api_threading
+ * @details The tasks of the highest priority are taken first, the tasks of the same priority are taken in the FIFO
+ *          order. To protect the low priority tasks from the starvation every `agingPeriod`-th pop takes the oldest
+ *          queued task regardless of its priority, so a task waits for at most `agingPeriod` pops per each task queued
+ *          before it. When all the tasks have the same priority the queue is a plain FIFO queue.
+ */
+class PriorityTaskQueue {
+public:
+    /**
+     * @brief Constructs the queue
+     * @param agingPeriod Number of pops after which the oldest task is taken, 0 disables the aging
+     */
+    explicit PriorityTaskQueue(std::size_t agingPeriod = 8) : _agingPeriod{agingPeriod} {}
+
+    /**
+     * @brief Checks whether the queue is empty
+     * @return `true` if there are no tasks in the queue
+     */
+    bool empty() const {
+        return 0 == _size;
+    }
+
+    /**
+     * @brief Returns the number of queued tasks
+     * @return Number of tasks
+     */
+    std::size_t size() const {
+        return _size;
+    }
+
+    /**
+     * @brief Adds a task to the queue
+     * @param task A task to add
+     * @param priority The task priority, higher value is more urgent
+     */
+    void push(Task task, int priority = 0) {
+        _lanes[priority].push(Entry{_sequence++, std::move(task)});
+        ++_size;
+    }
+
+    /**
+     * @brief Takes the next task from the non-empty queue
+     * @param priority If not `nullptr` receives the priority of the taken task
+     * @return The task
+     */
+    Task pop(int* priority = nullptr) {
+        // the lanes are kept when they become empty, so the queue doesn't allocate in the steady state
+        auto lane = _lanes.begin();
+        while (lane->second.empty()) {
+            ++lane;
+        }
+        if (0 != _agingPeriod && lane->second.size() != _size && 0 == (++_pops % _agingPeriod)) {
+            for (auto other = std::next(lane); other != _lanes.end(); ++other) {
+                if (!other->second.empty() && other->second.front()._sequence < lane->second.front()._sequence) {
+                    lane = other;
+                }
+            }
+        }
+        Task task = std::move(lane->second.front()._task);
+        lane->second.pop();
+        --_size;
+        if (nullptr != priority) {
+            *priority = lane->first;
+        }
+        return task;
+    }
+
+private:
+    struct Entry {
+        std::uint64_t _sequence;
+        Task _task;
+    };
+    std::map<int, std::queue<Entry>, std::greater<int>> _lanes;
+    std::size_t _agingPeriod = 0;
+    std::size_t _size = 0;
+    std::size_t _pops = 0;
+    std::uint64_t _sequence = 0;
+};
+
+}  // namespace InferenceEngine
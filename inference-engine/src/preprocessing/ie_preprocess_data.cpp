@@ -11,6 +11,7 @@
 #include <ie_input_info.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace InferenceEngine {
 
@@ -23,6 +24,11 @@ class PreProcessData : public IPreProcessData {
      */
     Blob::Ptr _userBlob = nullptr;
 
+    /**
+     * @brief ROIs of the user blob to fill the batch with, empty if the whole blob is pre-processed.
+     */
+    std::vector<ROI> _rois;
+
     /**
      * @brief Pointer-to-implementation (PIMPL) hiding preprocessing implementation details.
      * BEWARE! Will be shared among copies!
@@ -32,6 +38,8 @@ class PreProcessData : public IPreProcessData {
 public:
     void setRoiBlob(const Blob::Ptr &blob) override;
 
+    void setRoiBlob(const Blob::Ptr &blob, const std::vector<ROI> &rois) override;
+
     Blob::Ptr getRoiBlob() const override;
 
     void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial, int batchSize = -1) override;
@@ -47,6 +55,15 @@ INFERENCE_PRERPOC_PLUGIN_API(void) CreatePreProcessData(std::shared_ptr<IPreProc
 
 void PreProcessData::setRoiBlob(const Blob::Ptr &blob) {
     _userBlob = blob;
+    _rois.clear();
+}
+
+void PreProcessData::setRoiBlob(const Blob::Ptr &blob, const std::vector<ROI> &rois) {
+    if (rois.empty()) {
+        IE_THROW() << "Input pre-processing is set with an empty set of ROIs";
+    }
+    _userBlob = blob;
+    _rois = rois;
 }
 
 Blob::Ptr PreProcessData::getRoiBlob() const {
@@ -64,13 +81,18 @@ void PreProcessData::execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &
         IE_THROW() << "Input pre-processing is called with null " << (_userBlob == nullptr ? "_userBlob" : "preprocessedBlob");
     }
 
-    batchSize = PreprocEngine::getCorrectBatchSize(batchSize, _userBlob);
+    if (_rois.empty()) {
+        batchSize = PreprocEngine::getCorrectBatchSize(batchSize, _userBlob);
+    } else if (batchSize > 0 && _rois.size() > static_cast<size_t>(batchSize)) {
+        IE_THROW() << "Input pre-processing is called with batch size " << batchSize
+                   << " less than the number of ROIs " << _rois.size();
+    }
 
     if (!_preproc) {
         _preproc.reset(new PreprocEngine);
     }
 
-    _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, serial, batchSize);
+    _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, serial, batchSize, _rois);
 }
 
 void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
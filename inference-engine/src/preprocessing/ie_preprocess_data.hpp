@@ -7,6 +7,7 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <vector>
 
 #include <ie_blob.h>
 #include <file_utils.h>
@@ -40,6 +41,14 @@ public:
     //FIXME: rename to setUserBlob
     virtual void setRoiBlob(const Blob::Ptr &blob) = 0;
 
+    /**
+     * @brief Sets a single image blob and ROIs inside of it. During pre-processing each ROI is cropped,
+     * resized and placed to its own image of the default input blob: i-th ROI fills i-th batch element.
+     * @param blob Blob with a single image.
+     * @param rois ROIs inside of the blob, the number of ROIs defines the batch size to pre-process.
+     */
+    virtual void setRoiBlob(const Blob::Ptr &blob, const std::vector<ROI> &rois) = 0;
+
     /**
      * @brief Gets pointer to the ROI blob used for a given input.
      * @return Blob pointer.
@@ -177,6 +177,15 @@ std::vector<std::vector<cv::gapi::own::Mat>> bind_to_blob(const I420Blob::Ptr& i
     return batched_input_plane_mats;
 }
 
+std::vector<cv::gapi::own::Size> sizes_of(const std::vector<cv::gapi::own::Mat>& mats) {
+    std::vector<cv::gapi::own::Size> sizes;
+    sizes.reserve(mats.size());
+    for (const auto& m : mats) {
+        sizes.emplace_back(m.cols, m.rows);
+    }
+    return sizes;
+}
+
 template<typename... Ts, int... IIs>
 std::vector<cv::GMat> to_vec_impl(std::tuple<Ts...> &&gmats, cv::detail::Seq<IIs...>) {
     return { std::get<IIs>(gmats)... };
@@ -574,9 +583,11 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
     const auto io_color_formats = std::make_tuple(input_color_format, output_color_format);
     const bool drop_channel = (io_color_formats == std::make_tuple(ColorFormat::RGBX, ColorFormat::RGB)) ||
                               (io_color_formats == std::make_tuple(ColorFormat::BGRX, ColorFormat::BGR));
+    // 8U image resized into the planar 32F network input is handled by the single fused kernel
+    const bool planar_32f_output = (out_desc.prec == CV_32F) && (out_layout == NCHW) && !drop_channel;
     const bool specific_case_of_preproc = ((in_layout == NHWC || specific_yuv420_input_handling)
                                         && (in_desc.d.C == 3 || specific_yuv420_input_handling || drop_channel)
-                                        && ((in_desc.prec == CV_8U) && (in_desc.prec == out_desc.prec))
+                                        && ((in_desc.prec == CV_8U) && (in_desc.prec == out_desc.prec || planar_32f_output))
                                         && (algorithm == RESIZE_BILINEAR)
                                         && (input_color_format == ColorFormat::RAW
                                             || input_color_format == output_color_format
@@ -599,6 +610,9 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
         auto planes = drop_channel ?
                 to_vec(gapi::ScalePlanes4:: on(
                         color_converted_input[0], in_desc.prec, input_sz, scale_sz, cv::INTER_LINEAR))
+              : planar_32f_output ?
+                to_vec(gapi::ScalePlanes32f::on(
+                        color_converted_input[0], input_sz, scale_sz, cv::INTER_LINEAR))
               : to_vec(gapi::ScalePlanes  ::on(
                         color_converted_input[0], in_desc.prec, input_sz, scale_sz, cv::INTER_LINEAR));
 
@@ -686,7 +700,9 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+PreprocEngine::PreprocEngine() :
+    _lastComp(parallel_get_max_threads()), _lastCompGeneration(_lastComp.size(), 0),
+    _lastCompSizes(_lastComp.size()) {}
 
 PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
     // Given our knowledge about Fluid, full graph rebuild is required
@@ -815,76 +831,104 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
     return batch;
 }
 
-void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
-    const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
+void PreprocEngine::executeGraph(const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
     std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial,
     Update update) {
 
-    const int thread_num =
+    // The number of slices is taken from the current parallel runtime context, e.g. the TBB arena of the
+    // stream executing the request, so pre-processing is scaled to the threads owned by the caller and
+    // doesn't oversubscribe cores when many streams are active.
+    const int total_slices =
 #if IE_THREAD == IE_THREAD_OMP
         omp_serial ? 1 :    // disable threading for OpenMP if was asked for
 #endif
-        0;                  // use all available threads
+        parallel_get_max_threads();
 
     // to suppress unused warnings
     (void)(omp_serial);
 
-    // Split the whole graph into `total_slices` slices, where
-    // `total_slices` is provided by the parallel runtime and assumed
-    // to be number of threads used.  However it is not guaranteed
-    // that an actual number of threads will be as assumed, so it
+    // Slices are arranged into groups: images of the batch are distributed between the groups, and
+    // each group splits an image into row tiles between its slices. So a batch is processed in parallel
+    // image-wise first, and only the remaining threads make tiles smaller.
+    const int groups = std::max(1, std::min(batch_size, total_slices));
+    const int tiles = total_slices / groups;
+
+    if (Update::REBUILD == update) {
+        // compiled objects of the previous graph can't be reshaped to the new one
+        std::fill(_lastComp.begin(), _lastComp.end(), cv::GCompiled{});
+    }
+    if (Update::NOTHING != update || tiles != _lastTiles) {
+        ++_compGeneration;
+        _lastTiles = tiles;
+    }
+    if (_lastComp.size() < static_cast<std::size_t>(total_slices)) {
+        _lastComp.resize(total_slices);
+        _lastCompGeneration.resize(total_slices, 0);
+        _lastCompSizes.resize(total_slices);
+    }
+
+    // Not all slices might be used, e.g. if the number of threads is not divisible by the number of groups.
+    // However it is not guaranteed that an actual number of threads will be as assumed, so it
     // possible that all slices are processed by the same thread.
     //
-    parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
+    parallel_nt_static(total_slices, [&, this](int slice_n, const int) {
         OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
 
-        auto& compiled = _lastComp[slice_n];
-        if (Update::REBUILD == update || Update::RESHAPE == update) {
-            //  need to compile (or reshape) own object for a particular ROI
-            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
-
-            using cv::gapi::own::Rect;
-
-            // current design implies all images in batch are equal
-            const auto& input_plane_mats = batched_input_plane_mats[0];
-            const auto& output_plane_mats = batched_output_plane_mats[0];
-
-            auto lines_per_thread = output_plane_mats[0].rows / total_slices;
-            const auto remainder = output_plane_mats[0].rows % total_slices;
-
-            // remainder shows how many threads must calculate 1 additional row. now these additions
-            // must also be addressed in rect's Y coordinate:
-            int roi_y = 0;
-            if (slice_n < remainder) {
-                lines_per_thread++;  // 1 additional row
-                roi_y = slice_n * lines_per_thread;  // all previous rois have lines+1 rows
-            } else {
-                // remainder rois have lines+1 rows, the rest prior to slice_n have lines rows
-                roi_y =
-                    remainder * (lines_per_thread + 1) + (slice_n - remainder) * lines_per_thread;
-            }
+        const int group = slice_n / tiles;
+        const int tile = slice_n % tiles;
+        if (group >= groups) return;  // no job for current thread
 
-            if (lines_per_thread <= 0) return;  // no job for current thread
+        // all images of the batch are resized to the same network's input size, so the output
+        // ROI of the tile is shared by the images
+        const auto& output_plane_mats = batched_output_plane_mats[0];
 
-            auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
-            std::vector<Rect> rois(output_plane_mats.size(), roi);
+        auto lines_per_tile = output_plane_mats[0].rows / tiles;
+        const auto remainder = output_plane_mats[0].rows % tiles;
 
-            // TODO: make a ROI a runtime argument to avoid
-            // recompilations
-            auto args = cv::compile_args(gapi::preprocKernels(), cv::GFluidOutputRois{std::move(rois)});
-            if (Update::REBUILD == update) {
-                auto& computation = lastComputation.value();
-                compiled = computation.compile(descrs_of(input_plane_mats), std::move(args));
-            } else {
-                IE_ASSERT(compiled);
-                compiled.reshape(descrs_of(input_plane_mats), std::move(args));
-            }
+        // remainder shows how many tiles must calculate 1 additional row. now these additions
+        // must also be addressed in rect's Y coordinate:
+        int roi_y = 0;
+        if (tile < remainder) {
+            lines_per_tile++;  // 1 additional row
+            roi_y = tile * lines_per_tile;  // all previous rois have lines+1 rows
+        } else {
+            // remainder rois have lines+1 rows, the rest prior to tile have lines rows
+            roi_y = remainder * (lines_per_tile + 1) + (tile - remainder) * lines_per_tile;
         }
 
-        for (int i = 0; i < batch_size; ++i) {
+        if (lines_per_tile <= 0) return;  // no job for current thread
+
+        auto& compiled = _lastComp[slice_n];
+        auto& compiled_sizes = _lastCompSizes[slice_n];
+        for (int i = group; i < batch_size; i += groups) {
             const auto& input_plane_mats = batched_input_plane_mats[i];
             auto& output_plane_mats = batched_output_plane_mats[i];
 
+            // input images may differ in size (e.g. ROIs of one frame), so the compiled object is
+            // reshaped whenever the image doesn't match the sizes it was compiled for
+            const auto input_sizes = sizes_of(input_plane_mats);
+            if (_lastCompGeneration[slice_n] != _compGeneration || compiled_sizes != input_sizes) {
+                //  need to compile (or reshape) own object for a particular ROI
+                OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
+
+                using cv::gapi::own::Rect;
+
+                auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_tile};
+                std::vector<Rect> rois(output_plane_mats.size(), roi);
+
+                // TODO: make a ROI a runtime argument to avoid
+                // recompilations
+                auto args = cv::compile_args(gapi::preprocKernels(), cv::GFluidOutputRois{std::move(rois)});
+                if (!compiled) {
+                    IE_ASSERT(_lastComputation);
+                    compiled = _lastComputation.value().compile(descrs_of(input_plane_mats), std::move(args));
+                } else {
+                    compiled.reshape(descrs_of(input_plane_mats), std::move(args));
+                }
+                _lastCompGeneration[slice_n] = _compGeneration;
+                compiled_sizes = input_sizes;
+            }
+
             cv::GRunArgs call_ins;
             cv::GRunArgsP call_outs;
             for (const auto & m : input_plane_mats) { call_ins.emplace_back(m);}
@@ -899,7 +943,7 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
 template<typename BlobTypePtr>
 void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
     ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-    int batch_size) {
+    int batch_size, const std::vector<ROI>& rois) {
 
     validateBlob(inBlob);
 
@@ -920,11 +964,20 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
         in_desc =  G::decompose(in_desc_ie),
         out_desc = G::decompose(out_desc_ie);
 
-    // according to the IE's current design, input blob batch size _must_ match networks's expected
-    // batch size, even if the actual processing batch size (set on infer request) is different.
-    if (in_desc.d.N != out_desc.d.N) {
-        IE_THROW()  << "Input blob batch size is invalid: (input blob) "
-                            << in_desc.d.N << " != " << out_desc.d.N << " (expected by network)";
+    if (rois.empty()) {
+        // according to the IE's current design, input blob batch size _must_ match networks's expected
+        // batch size, even if the actual processing batch size (set on infer request) is different.
+        if (in_desc.d.N != out_desc.d.N) {
+            IE_THROW()  << "Input blob batch size is invalid: (input blob) "
+                                << in_desc.d.N << " != " << out_desc.d.N << " (expected by network)";
+        }
+    } else {
+        // ROIs of a single image fill the consecutive images of the network's input
+        if (in_desc.d.N != 1) {
+            IE_THROW()  << "Input blob batch size is invalid: (input blob) "
+                                << in_desc.d.N << " != 1 (expected for a set of ROIs)";
+        }
+        batch_size = static_cast<int>(rois.size());
     }
 
     // sanity check batch size
@@ -933,52 +986,95 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                             << batch_size << " > " << out_desc.d.N << " (expected by network)";
     }
 
-    CallDesc thisCall = CallDesc{ BlobDesc{ in_desc_ie.getPrecision(),
-                                            in_layout,
-                                            in_desc_ie.getDims(),
-                                            in_fmt },
-                                  BlobDesc{ out_desc_ie.getPrecision(),
-                                            out_layout,
-                                            out_desc_ie.getDims(),
-                                            out_fmt },
-                                  algorithm };
-
-    if (algorithm == NO_RESIZE && std::get<0>(thisCall) == std::get<1>(thisCall)) {
-        //if requested output parameters match input blob no need to do anything
-        IE_THROW()  << "No job to do in the PreProcessing ?";
-    }
-
-    const Update update = needUpdate(thisCall);
-
-    Opt<cv::GComputation> _lastComputation;
-    if (Update::REBUILD == update || Update::RESHAPE == update) {
-        _lastCall = cv::util::make_optional(std::move(thisCall));
-
-        if (Update::REBUILD == update) {
-            //  rebuild the graph
-            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
-            // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
-            auto custom_desc = getGDesc(in_desc, inBlob);
-            _lastComputation = cv::util::make_optional(
-                buildGraph(custom_desc,
-                           out_desc,
-                           in_layout,
-                           out_layout,
-                           algorithm,
-                           in_fmt,
-                           out_fmt));
+    // (re)builds the graph for the given input descriptor, returns the required update of the compiled objects
+    const auto update_graph = [&](const TensorDesc& call_in_desc_ie) {
+        CallDesc thisCall = CallDesc{ BlobDesc{ call_in_desc_ie.getPrecision(),
+                                                in_layout,
+                                                call_in_desc_ie.getDims(),
+                                                in_fmt },
+                                      BlobDesc{ out_desc_ie.getPrecision(),
+                                                out_layout,
+                                                out_desc_ie.getDims(),
+                                                out_fmt },
+                                      algorithm };
+
+        if (algorithm == NO_RESIZE && std::get<0>(thisCall) == std::get<1>(thisCall)) {
+            //if requested output parameters match input blob no need to do anything
+            IE_THROW()  << "No job to do in the PreProcessing ?";
         }
-    }
 
-    auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
+        const Update update = needUpdate(thisCall);
+
+        if (Update::REBUILD == update || Update::RESHAPE == update) {
+            _lastCall = cv::util::make_optional(std::move(thisCall));
+
+            if (Update::REBUILD == update) {
+                //  rebuild the graph
+                OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
+                // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
+                auto custom_desc = getGDesc(G::decompose(call_in_desc_ie), inBlob);
+                _lastComputation = cv::util::make_optional(
+                    buildGraph(custom_desc,
+                               out_desc,
+                               in_layout,
+                               out_layout,
+                               algorithm,
+                               in_fmt,
+                               out_fmt));
+            }
+        }
+        return update;
+    };
+
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
-        omp_serial, update);
+    if (rois.empty()) {
+        const Update update = update_graph(in_desc_ie);
+        auto batched_input_plane_mats = bind_to_blob(inBlob, batch_size);
+        executeGraph(batched_input_plane_mats, batched_output_plane_mats, batch_size, omp_serial, update);
+        return;
+    }
+
+    // All ROIs are processed by one graph reshaped to the size of each ROI, except for the AREA
+    // interpolation which has different kernels for upscale and downscale: the ROIs are split into
+    // the groups of the same direction then, a group per graph.
+    using BlobType = typename BlobTypePtr::element_type;
+    std::vector<BlobTypePtr> roi_blobs;
+    roi_blobs.reserve(rois.size());
+    for (const auto& roi : rois) {
+        roi_blobs.push_back(as<BlobType>(inBlob->createROI(roi)));
+        if (!roi_blobs.back()) {
+            IE_THROW() << "Failed to create ROI blob of the input blob";
+        }
+    }
+
+    const auto is_upscale = [&](const ROI& roi) {
+        return algorithm == RESIZE_AREA &&
+               (roi.sizeY < static_cast<size_t>(out_desc.d.H) || roi.sizeX < static_cast<size_t>(out_desc.d.W));
+    };
+
+    for (const bool upscale : {false, true}) {
+        std::vector<std::vector<cv::gapi::own::Mat>> group_input_plane_mats, group_output_plane_mats;
+        const TensorDesc* group_in_desc_ie = nullptr;
+        for (size_t i = 0; i < rois.size(); ++i) {
+            if (is_upscale(rois[i]) != upscale) continue;
+            const auto& roi_desc_ie = getTensorDescAndLayout(roi_blobs[i]).first;
+            validateTensorDesc(roi_desc_ie);
+            if (!group_in_desc_ie) group_in_desc_ie = &roi_desc_ie;
+            group_input_plane_mats.push_back(std::move(bind_to_blob(roi_blobs[i], 1)[0]));
+            group_output_plane_mats.push_back(batched_output_plane_mats[i]);
+        }
+        if (!group_in_desc_ie) continue;
+
+        const Update update = update_graph(*group_in_desc_ie);
+        executeGraph(group_input_plane_mats, group_output_plane_mats,
+                     static_cast<int>(group_input_plane_mats.size()), omp_serial, update);
+    }
 }
 
 void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
-        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
+        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        const std::vector<ROI>& rois) {
     const auto out_fmt = (in_fmt == ColorFormat::RAW) ? ColorFormat::RAW : ColorFormat::BGR;  // FIXME: get expected color format from network
 
     // output is always a memory blob
@@ -998,7 +1094,7 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected NV12Blob";
         }
         return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, rois);
     }
     case ColorFormat::I420: {
         auto inI420Blob = as<I420Blob>(inBlob);
@@ -1007,7 +1103,7 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected I420Blob";
         }
         return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, rois);
     }
 
     default:
@@ -1017,7 +1113,7 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected MemoryBlob";
         }
         return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, rois);
     }
 }
 }  // namespace InferenceEngine
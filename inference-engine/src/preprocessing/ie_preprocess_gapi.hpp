@@ -13,6 +13,7 @@
 #include <opencv2/gapi/gcompiled.hpp>
 #include <opencv2/gapi/gcomputation.hpp>
 #include <opencv2/gapi/util/optional.hpp>
+#include <opencv2/gapi/own/types.hpp>
 #include <openvino/itt.hpp>
 
 // FIXME: Move this definition back to ie_preprocess_data,
@@ -26,7 +27,14 @@ class PreprocEngine {
     template<typename T> using Opt = cv::util::optional<T>;
 
     Opt<CallDesc> _lastCall;
+    Opt<cv::GComputation> _lastComputation;
+    // one compiled object per parallel slice, recompiled when its generation is outdated
     std::vector<cv::GCompiled> _lastComp;
+    std::vector<std::size_t> _lastCompGeneration;
+    // input plane sizes each compiled object is specialized for, images of a batch may differ in size
+    std::vector<std::vector<cv::gapi::own::Size>> _lastCompSizes;
+    std::size_t _compGeneration = 0;
+    int _lastTiles = 0;
 
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
@@ -36,8 +44,7 @@ class PreprocEngine {
     enum class Update { REBUILD, RESHAPE, NOTHING };
     Update needUpdate(const CallDesc &newCall) const;
 
-    void executeGraph(Opt<cv::GComputation>& lastComputation,
-                      const std::vector<std::vector<cv::gapi::own::Mat>>& src,
+    void executeGraph(const std::vector<std::vector<cv::gapi::own::Mat>>& src,
                       std::vector<std::vector<cv::gapi::own::Mat>>& dst,
                       int batch_size,
                       bool omp_serial,
@@ -46,14 +53,14 @@ class PreprocEngine {
     template<typename BlobTypePtr>
     void preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
         ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-        int batch_size);
+        int batch_size, const std::vector<ROI>& rois);
 
 public:
     PreprocEngine();
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
     void preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
-        ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
+        ColorFormat in_fmt, bool omp_serial, int batch_size = -1, const std::vector<ROI>& rois = {});
 };
 
 }  // namespace InferenceEngine
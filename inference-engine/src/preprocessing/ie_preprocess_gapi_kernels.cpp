@@ -440,12 +440,15 @@ template<typename T, typename Mapper, int chanNum = 1>
 static inline void initScratchLinear(const cv::GMatDesc& in,
                                      const         Size& outSz,
                                      cv::gapi::fluid::Buffer& scratch,
-                                     int  lpi) {
+                                     int  lpi,
+                                     int  extraBytes = 0) {
     using alpha_type = typename Mapper::alpha_type;
     static const auto unity = Mapper::unity;
 
     auto inSz = in.size;
-    auto sbufsize = linearScratchDesc<T, Mapper, chanNum>::bufSize(inSz.width, inSz.height, outSz.width, outSz.height, lpi);
+    // extra bytes are reserved at the end of scratch for kernel specific intermediate data
+    auto sbufsize = linearScratchDesc<T, Mapper, chanNum>::bufSize(inSz.width, inSz.height, outSz.width, outSz.height, lpi)
+                  + extraBytes;
 
     Size scratch_size{sbufsize, 1};
 
@@ -1629,16 +1632,13 @@ GAPI_FLUID_KERNEL(FUpscalePlaneArea32f, UpscalePlaneArea32f, true) {
 
 template<typename T, class Mapper, int chs>
 static inline void calcRowLinearC(const cv::gapi::fluid::View& in,
-                                  std::array<std::reference_wrapper<cv::gapi::fluid::Buffer>, chs>& out,
+                                  const Size& outSz, int outY, int lpi, int length,
+                                  std::array<std::array<T*, 4>, chs>& dst,
                                   cv::gapi::fluid::Buffer& scratch) {
     GAPI_DbgAssert(is_cv_type_in_list<resizeLinearU8C3C4_suptypes>(in.meta().depth));
 
     auto  inSz =  in.meta().size;
-    auto outSz = out[0].get().meta().size;
-
     auto inY  = in.y();
-    auto outY = out[0].get().y();
-    auto lpi  = out[0].get().lpi();
 
     GAPI_DbgAssert(outY + lpi <= outSz.height);
     GAPI_DbgAssert(lpi <= 4);
@@ -1655,18 +1655,13 @@ static inline void calcRowLinearC(const cv::gapi::fluid::View& in,
     const auto *beta = beta0 + outY;
     const T *src0[4];
     const T *src1[4];
-    std::array<std::array<T*, 4>, chs> dst;
 
     for (int l = 0; l < lpi; l++) {
         auto index0 = mapsy[outY + l] - inY;
         auto index1 = mapsy[outSz.height + outY + l] - inY;
         src0[l] = in.InLine<const T>(index0);
         src1[l] = in.InLine<const T>(index1);
-        for (int c=0; c < chs; c++) {
-            dst[c][l] = out[c].get().template OutLine<T>(l);
-        }
     }
-    auto length = out[0].get().length();
 
     const auto rowFunc = type_dispatch<resizeLinearU8C3C4_suptypes>(in.meta().depth,
                                                                     cv_type_id{},
@@ -1677,6 +1672,23 @@ static inline void calcRowLinearC(const cv::gapi::fluid::View& in,
     rowFunc(dst, src0, src1, alpha, clone, mapsx, beta, tmp, inSz, outSz, lpi, length);
 }
 
+template<typename T, class Mapper, int chs>
+static inline void calcRowLinearC(const cv::gapi::fluid::View& in,
+                                  std::array<std::reference_wrapper<cv::gapi::fluid::Buffer>, chs>& out,
+                                  cv::gapi::fluid::Buffer& scratch) {
+    auto outSz = out[0].get().meta().size;
+    auto outY = out[0].get().y();
+    auto lpi  = out[0].get().lpi();
+
+    std::array<std::array<T*, 4>, chs> dst;
+    for (int l = 0; l < lpi; l++) {
+        for (int c=0; c < chs; c++) {
+            dst[c][l] = out[c].get().template OutLine<T>(l);
+        }
+    }
+    calcRowLinearC<T, Mapper, chs>(in, outSz, outY, lpi, out[0].get().length(), dst, scratch);
+}
+
 GAPI_FLUID_KERNEL(FScalePlanes, ScalePlanes, true) {
     static const int Window = 1;
     static const int LPI = 4;
@@ -1728,6 +1740,60 @@ GAPI_FLUID_KERNEL(FScalePlanes4, ScalePlanes4, true) {
     }
 };
 
+// Resizes interleaved 8U image and writes the result as 32F planes in a single pass:
+// resized rows stay in the scratch and are converted right away without the separate
+// ConvertDepth stage per plane
+GAPI_FLUID_KERNEL(FScalePlanes32f, ScalePlanes32f, true) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+    static constexpr int numChan = 3;
+
+    using ScratchDesc = linearScratchDesc<uchar, linear::Mapper, numChan>;
+
+    static void initScratch(const cv::GMatDesc& in, Size,
+                            Size outSz, int /*interp*/,
+                            cv::gapi::fluid::Buffer &scratch) {
+        initScratchLinear<uchar, linear::Mapper, numChan>(in, outSz, scratch, LPI, numChan * LPI * outSz.width);
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in, Size, Size/*sz*/, int /*interp*/,
+                    cv::gapi::fluid::Buffer& out1,
+                    cv::gapi::fluid::Buffer& out2,
+                    cv::gapi::fluid::Buffer& out3,
+                    cv::gapi::fluid::Buffer& scratch) {
+        std::array<std::reference_wrapper<cv::gapi::fluid::Buffer>, numChan> out = {out1, out2, out3};
+
+        const auto  inSz = in.meta().size;
+        const auto outSz = out1.meta().size;
+        const auto outY  = out1.y();
+        const auto lpi   = out1.lpi();
+        const auto length = out1.length();
+
+        auto* rows = scratch.OutLineB() + ScratchDesc::bufSize(inSz.width, inSz.height, outSz.width, outSz.height, LPI);
+        std::array<std::array<uchar*, 4>, numChan> dst;
+        for (int l = 0; l < lpi; l++) {
+            for (int c = 0; c < numChan; c++) {
+                dst[c][l] = rows + (c * LPI + l) * outSz.width;
+            }
+        }
+        calcRowLinearC<uchar, linear::Mapper, numChan>(in, outSz, outY, lpi, length, dst, scratch);
+
+        for (int l = 0; l < lpi; l++) {
+            for (int c = 0; c < numChan; c++) {
+                const auto* src = dst[c][l];
+                auto* dstF32 = out[c].get().OutLine<float>(l);
+                for (int x = 0; x < length; x++) {
+                    dstF32[x] = static_cast<float>(src[x]);
+                }
+            }
+        }
+    }
+};
+
 #if defined __GNUC__
 # pragma GCC diagnostic push
 # pragma GCC diagnostic ignored "-Wstrict-aliasing"
@@ -1889,6 +1955,7 @@ struct Split_ResizeISA {
         pckg.include<typename choose_impl<isa_tag_t>::FScalePlane32f>();
         pckg.include<typename choose_impl<isa_tag_t>::FScalePlanes>();
         pckg.include<typename choose_impl<isa_tag_t>::FScalePlanes4>();
+        pckg.include<typename choose_impl<isa_tag_t>::FScalePlanes32f>();
         pckg.include<typename choose_impl<isa_tag_t>::FScalePlaneArea8u>();
         pckg.include<typename choose_impl<isa_tag_t>::FScalePlaneArea32f>();
         pckg.include<typename choose_impl<isa_tag_t>::FUpscalePlaneArea8u>();
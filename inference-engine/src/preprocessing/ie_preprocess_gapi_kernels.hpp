@@ -65,6 +65,19 @@ namespace gapi {
         }
     };
 
+    G_TYPED_KERNEL_M(ScalePlanes32f, <GMat3(cv::GMat, Size, Size, int)>, "com.intel.ie.scale_planes_32f") {
+        static std::tuple<cv::GMatDesc, cv::GMatDesc, cv::GMatDesc> outMeta(const cv::GMatDesc &in, const Size &szIn,
+                                                                            const Size &szOut, int interp) {
+            // This kernel supports only RGB 8U inputs
+            GAPI_Assert(in.depth == CV_8U);
+            GAPI_Assert(in.chan == 3);
+            // cv::INTER_LINEAR is the only supported interpolation
+            GAPI_Assert(interp == cv::INTER_LINEAR);
+            cv::GMatDesc out_desc = in.withType(CV_32F, 1).withSize(szOut);
+            return std::make_tuple(out_desc, out_desc, out_desc);
+        }
+    };
+
     G_TYPED_KERNEL(ScalePlane8u, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie.scale_plane_8u") {
         static cv::GMatDesc outMeta(const cv::GMatDesc & in, const Size & sz, int) {
             GAPI_DbgAssert(in.depth == CV_8U && in.chan == 1);
@@ -42,6 +42,12 @@ public:
      */
     virtual size_t get_lanes() const = 0;
 
+    /**
+     * @brief gets number of vector registers available for allocation
+     * @return number of registers
+     */
+    virtual size_t get_vector_registers() const { return 16; }
+
     /**
      * @brief called by generator to all the emittor for a target machine
      * @return a map by node's type info with callbacks to create an instance of emmitter for corresponding operation type
@@ -82,8 +88,9 @@ public:
      * @param ws work size for kernel execution
      * @param f can this kernel be linearided to 1D range
      * @param p pointer to generated code
+     * @param l number of elements processed by one iteration of the vector tile
      */
-    Schedule(const Shape& ws, bool f, code p) : work_size(ws), is_flat(f), ptr(p) {}
+    Schedule(const Shape& ws, bool f, code p, size_t l = 1) : work_size(ws), is_flat(f), ptr(p), lanes(l) {}
     /**
      * @brief Returns callable instanse of code pointer
      */
@@ -94,6 +101,8 @@ public:
     Shape work_size {};
     bool is_flat {false};
     code ptr {nullptr};
+    // the innermost dimension is better split between threads by multiples of it, so every part is vector tiles only
+    size_t lanes {1};
 };
 
 /**
@@ -113,11 +122,25 @@ public:
     virtual ~Generator() = default;
     /**
      * @brief virtual method any specific implementation should implement
+     * @details Snippet with reductions is emitted as several passes over the innermost dimension, see Kernel.
+     * Target should provide emitters for Scalar, reductions and horizontal ops in this case
      * @param f runction in canonical for for table-based code generation
      * @return pointer to generated code
      */
     code generate(std::shared_ptr<Function>& f) const;
 
+    /**
+     * @brief gets number of lanes supported by target's vector ISA, AVX-512 target processes twice more than AVX2
+     * @return number of lanes
+     */
+    size_t get_lanes() const { return target->get_lanes(); }
+
+    /**
+     * @brief gets number of vector registers of the target available for allocation
+     * @return number of registers
+     */
+    size_t get_vector_registers() const { return target->get_vector_registers(); }
+
 protected:
     std::shared_ptr<TargetMachine> target;
 };
@@ -0,0 +1,41 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/op/op.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface Fill
+ * @brief Generated by register allocation before every use of the spilled value.
+ * Restores the value from the stack slot of Spill operation the input is produced by
+ * @ingroup snippets
+ */
+class TRANSFORMATIONS_API Fill : public ngraph::op::Op {
+public:
+    NGRAPH_RTTI_DECLARATION;
+
+    Fill(const Output<Node>& x);
+    Fill() = default;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    OPENVINO_SUPPRESS_DEPRECATED_START
+    bool evaluate(const HostTensorVector& output_values, const HostTensorVector& input_values) const override;
+    OPENVINO_SUPPRESS_DEPRECATED_END
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <transformations_visibility.hpp>
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface HorizonMax
+ * @brief Generated by generator after a tile with ReduceMax. Reduces vector lanes in-place and broadcasts the result to all lanes
+ * @ingroup snippets
+ */
+class TRANSFORMATIONS_API HorizonMax : public ngraph::op::Op {
+public:
+    NGRAPH_RTTI_DECLARATION;
+
+    HorizonMax(const Output<Node>& x);
+    HorizonMax() = default;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+};
+
+/**
+ * @interface HorizonSum
+ * @brief Generated by generator after a tile with ReduceSum. Reduces vector lanes in-place and broadcasts the result to all lanes
+ * @ingroup snippets
+ */
+class TRANSFORMATIONS_API HorizonSum : public ngraph::op::Op {
+public:
+    NGRAPH_RTTI_DECLARATION;
+
+    HorizonSum(const Output<Node>& x);
+    HorizonSum() = default;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
@@ -16,6 +16,8 @@ namespace op {
 /**
  * @interface Kernel
  * @brief Generated by Canonicalization and represents compute kernel legal for sheduling
+ * Region is a vector Tile followed by a scalar Tile for the tail. If snippet has reductions the region is a sequence of such pairs,
+ * one per pass, surrounded by accumulators initialization and horizontal ops. Data pointers are rewound before every pass
  * @ingroup snippets
  */
 class TRANSFORMATIONS_API Kernel : public ngraph::op::Op {
@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <transformations_visibility.hpp>
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface Reduce
+ * @brief Generated by Canonicalization for a reduction over the innermost dimension.
+ * Output keeps the input rank and has the innermost dimension equal to 1.
+ * The value is accumulated in the output register over the whole tile, so generator splits the kernel into passes
+ * at reductions, sets the accumulator to an identity before the pass and emits a horizontal op after it
+ * @ingroup snippets
+ */
+class TRANSFORMATIONS_API Reduce : public ngraph::op::Op {
+public:
+    NGRAPH_RTTI_DECLARATION;
+
+    Reduce(const Output<Node>& x);
+    Reduce() = default;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    /**
+     * @brief Returns a value the accumulator should be initialized with before the tile
+     */
+    virtual float get_identity() const = 0;
+};
+
+/**
+ * @interface ReduceMax
+ * @brief Maximum over the innermost dimension. Vector version accumulates all lanes
+ * @ingroup snippets
+ */
+class TRANSFORMATIONS_API ReduceMax : public Reduce {
+public:
+    NGRAPH_RTTI_DECLARATION;
+
+    ReduceMax(const Output<Node>& x);
+    ReduceMax() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    float get_identity() const override;
+
+    OPENVINO_SUPPRESS_DEPRECATED_START
+    bool evaluate(const HostTensorVector& output_values, const HostTensorVector& input_values) const override;
+    OPENVINO_SUPPRESS_DEPRECATED_END
+};
+
+/**
+ * @interface ReduceSum
+ * @brief Sum over the innermost dimension. Vector version accumulates all lanes
+ * @ingroup snippets
+ */
+class TRANSFORMATIONS_API ReduceSum : public Reduce {
+public:
+    NGRAPH_RTTI_DECLARATION;
+
+    ReduceSum(const Output<Node>& x);
+    ReduceSum() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    float get_identity() const override;
+
+    OPENVINO_SUPPRESS_DEPRECATED_START
+    bool evaluate(const HostTensorVector& output_values, const HostTensorVector& input_values) const override;
+    OPENVINO_SUPPRESS_DEPRECATED_END
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
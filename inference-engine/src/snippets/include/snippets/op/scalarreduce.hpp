@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/op/op.hpp>
+#include "reduce.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface ScalarReduceMax
+ * @brief Generated for tail processing, accumulates only the first lane of the argument
+ * @ingroup snippets
+ */
+class TRANSFORMATIONS_API ScalarReduceMax : public ReduceMax {
+public:
+    NGRAPH_RTTI_DECLARATION;
+
+    ScalarReduceMax(const Output<Node>& x);
+    ScalarReduceMax() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override {
+        check_new_args_count(this, new_args);
+        return std::make_shared<ScalarReduceMax>(new_args.at(0));
+    }
+};
+
+/**
+ * @interface ScalarReduceSum
+ * @brief Generated for tail processing, accumulates only the first lane of the argument
+ * @ingroup snippets
+ */
+class TRANSFORMATIONS_API ScalarReduceSum : public ReduceSum {
+public:
+    NGRAPH_RTTI_DECLARATION;
+
+    ScalarReduceSum(const Output<Node>& x);
+    ScalarReduceSum() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override {
+        check_new_args_count(this, new_args);
+        return std::make_shared<ScalarReduceSum>(new_args.at(0));
+    }
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
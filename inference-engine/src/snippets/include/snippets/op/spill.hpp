@@ -0,0 +1,41 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/op/op.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface Spill
+ * @brief Generated by register allocation when the live values don't fit vector registers.
+ * Saves the value to the stack slot of the kernel, the slot index is stored to runtime info as "spillSlot"
+ * @ingroup snippets
+ */
+class TRANSFORMATIONS_API Spill : public ngraph::op::Op {
+public:
+    NGRAPH_RTTI_DECLARATION;
+
+    Spill(const Output<Node>& x);
+    Spill() = default;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    OPENVINO_SUPPRESS_DEPRECATED_START
+    bool evaluate(const HostTensorVector& output_values, const HostTensorVector& input_values) const override;
+    OPENVINO_SUPPRESS_DEPRECATED_END
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
@@ -15,14 +15,19 @@ namespace pass {
  * @interface AssignRegisters
  * @brief Assigns internal `vector` register indexes to operations.
  * Changing order of variables or datafrow lead to invalidation of register assignment.
+ * If live values don't fit the registers, the value with the furthest last use is spilled to the stack:
+ * Spill is inserted after its producer and Fill before every its consumer, then registers are assigned again.
  * @ingroup snippets
  */
 class TRANSFORMATIONS_API AssignRegisters : public ngraph::pass::FunctionPass {
 public:
-    AssignRegisters() : FunctionPass() {
+    explicit AssignRegisters(size_t num_registers = 16) : FunctionPass(), m_num_registers(num_registers) {
         set_property(ngraph::pass::PassProperty::REQUIRE_STATIC_SHAPE, true);
     }
     bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+private:
+    size_t m_num_registers;
 };
 
 } // namespace pass
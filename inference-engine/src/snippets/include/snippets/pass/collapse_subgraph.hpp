@@ -54,9 +54,11 @@ public:
  *       1. finally current node is replaced with the new subgraph. We cannot use replace_node because multiple nodes are replaced so
  *       make the replacement manually by redirecting ports
  * Input subgraph is prefented from visiting twice if more than one output of it consumed by currently considered node
- * New subgraph is introduced, if there is a loop introduced
+ * Node is not merged, if there is a loop introduced
  * New subgraph is introduced, if number of inputs and outputs exceeds 7 due to scheduling limitation
- * New subgraph is introduced, if multiple outputs of merged nodes are not broadcastable to each other (equality of all outputs is too much on the other hand)
+ * New subgraph is introduced, if multiple outputs of merged nodes are not numpy broadcastable to a common shape
+ * or differ in the innermost dimension (equality of all outputs is too much on the other hand)
+ * Softmax and MVN over the innermost dimension are tokenized as well and decomposed to reductions during canonicalization
  * Scalar constants are placed as is into subgraph due to optimization purpose
  * @ingroup snippets
  */
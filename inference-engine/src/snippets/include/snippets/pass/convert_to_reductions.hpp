@@ -0,0 +1,40 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pattern/matcher.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface ConvertSoftmaxToReductions
+ * @brief Decomposes Softmax over the innermost dimension into ReduceMax, Subtract, Exp, ReduceSum and Divide.
+ * The pass is used to convert function to a canonical form for code generation
+ * @ingroup snippets
+ */
+class TRANSFORMATIONS_API ConvertSoftmaxToReductions: public ngraph::pass::MatcherPass {
+public:
+    ConvertSoftmaxToReductions();
+};
+
+/**
+ * @interface ConvertMVNToReductions
+ * @brief Decomposes MVN over the innermost dimension into ReduceSum based mean and variance computation.
+ * The pass is used to convert function to a canonical form for code generation
+ * @ingroup snippets
+ */
+class TRANSFORMATIONS_API ConvertMVNToReductions: public ngraph::pass::MatcherPass {
+public:
+    ConvertMVNToReductions();
+};
+
+} // namespace pass
+} // namespace snippets
+} // namespace ngraph
@@ -15,7 +15,7 @@ namespace pass {
 
 /**
  * @interface ReplaceLoadsWithScalarLoads
- * @brief Replases vector loads with scalar versions.
+ * @brief Replaces vector loads with scalar versions.
  * The pass is used to cange alement type of function in a canonical form vector to scalar.
  * Used for tail generation
  * @ingroup snippets
@@ -27,7 +27,7 @@ public:
 
 /**
  * @interface ReplaceStoresWithScalarStores
- * @brief Replases vector stores with scalar versions.
+ * @brief Replaces vector stores with scalar versions.
  * The pass is used to cange alement type of function in a canonical form vector to scalar.
  * Used for tail generation
  * @ingroup snippets
@@ -37,6 +37,17 @@ public:
     ReplaceStoresWithScalarStores();
 };
 
+/**
+ * @interface ReplaceReductionsWithScalarReductions
+ * @brief Replaces vector reductions with scalar versions which accumulate only the first lane.
+ * Used for tail generation
+ * @ingroup snippets
+ */
+class TRANSFORMATIONS_API ReplaceReductionsWithScalarReductions: public ngraph::pass::MatcherPass {
+public:
+    ReplaceReductionsWithScalarReductions();
+};
+
 } // namespace pass
 } // namespace snippets
 } // namespace ngraph
@@ -11,11 +11,16 @@
 #include "op/blockedparameter.hpp"
 #include "op/broadcastload.hpp"
 #include "op/broadcastmove.hpp"
+#include "op/fill.hpp"
+#include "op/horizon.hpp"
 #include "op/load.hpp"
 #include "op/nop.hpp"
+#include "op/reduce.hpp"
 #include "op/scalar.hpp"
 #include "op/scalarload.hpp"
+#include "op/scalarreduce.hpp"
 #include "op/scalarstore.hpp"
+#include "op/spill.hpp"
 #include "op/staticpower.hpp"
 #include "op/store.hpp"
 #include "op/vectorload.hpp"
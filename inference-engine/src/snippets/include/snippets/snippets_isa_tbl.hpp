@@ -20,10 +20,20 @@ NGRAPH_OP(Store, ngraph::snippets::op)
 NGRAPH_OP(ScalarStore, ngraph::snippets::op)
 NGRAPH_OP(VectorStore, ngraph::snippets::op)
 
+NGRAPH_OP(Spill, ngraph::snippets::op)
+NGRAPH_OP(Fill, ngraph::snippets::op)
+
 NGRAPH_OP(BroadcastMove, ngraph::snippets::op)
 NGRAPH_OP(Scalar, ngraph::snippets::op)
 NGRAPH_OP(Nop, ngraph::snippets::op)
 
+NGRAPH_OP(ReduceMax, ngraph::snippets::op)
+NGRAPH_OP(ReduceSum, ngraph::snippets::op)
+NGRAPH_OP(ScalarReduceMax, ngraph::snippets::op)
+NGRAPH_OP(ScalarReduceSum, ngraph::snippets::op)
+NGRAPH_OP(HorizonMax, ngraph::snippets::op)
+NGRAPH_OP(HorizonSum, ngraph::snippets::op)
+
 // Layout-oblivious from opset1
 
 // opset completeness
@@ -32,6 +42,7 @@ NGRAPH_OP(Parameter, ngraph::op::v0)
 NGRAPH_OP(BlockedParameter, ngraph::snippets::op)
 NGRAPH_OP(Result, ngraph::op::v0)
 NGRAPH_OP(Broadcast, ngraph::op::v1)
+NGRAPH_OP(Convert, ngraph::op::v0)
 
 // unary
 NGRAPH_OP(Abs, ngraph::op::v0)
@@ -12,6 +12,10 @@
 
 #include <ngraph/pass/manager.hpp>
 
+#include <algorithm>
+#include <map>
+#include <set>
+
 auto ngraph::snippets::getRegisters(std::shared_ptr<ngraph::Node>& n) -> ngraph::snippets::RegInfo {
     auto rt = n->get_rt_info();
 
@@ -37,6 +41,82 @@ auto ngraph::snippets::getRegisters(std::shared_ptr<ngraph::Node>& n) -> ngraph:
     return std::make_pair(rin, rout);
 }
 
+namespace {
+using lowered_region = std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>>;
+
+auto is_reduction(const ngraph::Node* n) -> bool {
+    return dynamic_cast<const ngraph::snippets::op::Reduce*>(n) != nullptr;
+}
+
+// Splits ordered ops into passes over the innermost dimension. Pass k computes reductions which depend on k other reductions,
+// the last pass computes results. Elementwise producers are recomputed in every pass they are needed instead of being spilled
+// to memory, reductions from the previous passes stay in registers. Snippet without reductions is a single pass of all ops.
+auto split_into_passes(const std::shared_ptr<ngraph::Function>& f) -> std::vector<ngraph::NodeVector> {
+    auto ops = f->get_ordered_ops();
+
+    std::map<const ngraph::Node*, size_t> depth;
+    for (const auto& op : ops) {
+        size_t d = 0;
+        for (const auto& input : op->inputs()) {
+            auto parent = input.get_source_output().get_node();
+            d = std::max(d, depth[parent] + (is_reduction(parent) ? 1 : 0));
+        }
+        depth[op.get()] = d;
+    }
+
+    size_t last = 0;
+    for (const auto& result : f->get_results()) {
+        last = std::max(last, depth[result.get()]);
+        auto value = result->get_input_node_ptr(0);
+        if (dynamic_cast<const ngraph::snippets::op::Store*>(value)) {
+            value = value->get_input_node_ptr(0);
+        }
+        if (is_reduction(value)) {
+            throw ngraph::ngraph_error("reduction can't be a result of snippet");
+        }
+    }
+
+    std::vector<ngraph::NodeVector> passes(last + 1);
+    for (size_t k = 0; k <= last; k++) {
+        std::vector<ngraph::Node*> stack;
+        if (k == last) {
+            for (const auto& result : f->get_results()) {
+                stack.push_back(result.get());
+            }
+        } else {
+            for (const auto& op : ops) {
+                if (is_reduction(op.get()) && depth[op.get()] == k) {
+                    stack.push_back(op.get());
+                }
+            }
+        }
+
+        std::set<const ngraph::Node*> members;
+        while (!stack.empty()) {
+            auto node = stack.back();
+            stack.pop_back();
+            if (!members.insert(node).second) {
+                continue;
+            }
+            for (const auto& input : node->inputs()) {
+                auto parent = input.get_source_output().get_node();
+                // values of reductions computed by previous passes are already in registers
+                if (!is_reduction(parent)) {
+                    stack.push_back(parent);
+                }
+            }
+        }
+
+        for (const auto& op : ops) {
+            if (members.count(op.get())) {
+                passes[k].push_back(op);
+            }
+        }
+    }
+    return passes;
+}
+} // namespace
+
 ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ngraph::Function>& f) const {
     if (!target->is_supported())
         throw ngraph_error("unsupported architecture for code genration");
@@ -49,36 +129,70 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ngr
         throw ngraph_error("snippet signature should not exceed 7 arguments. got " + std::to_string(nptrs));
     }
 
-    // vector tile
-    std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> lowered;
-    for (auto n : f->get_ordered_ops()) {
-        lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
-    }
-
     // scalar tile
     auto f_scalar = ngraph::clone_function(*f.get());
     ngraph::pass::Manager m;
     m.register_pass<ngraph::snippets::pass::ReplaceLoadsWithScalarLoads>();
     m.register_pass<ngraph::snippets::pass::ReplaceStoresWithScalarStores>();
+    m.register_pass<ngraph::snippets::pass::ReplaceReductionsWithScalarReductions>();
     m.run_passes(f_scalar);
 
-    std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> scalar_lowered;
-    for (auto n : f_scalar->get_ordered_ops()) {
-        scalar_lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
+    auto passes = split_into_passes(f);
+    auto scalar_passes = split_into_passes(f_scalar);
+    if (passes.size() != scalar_passes.size()) {
+        throw ngraph_error("vector and scalar tiles of snippet have different number of passes");
     }
 
-    // wrapping into tiles
-    std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> tiles;
-    tiles.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::type_info)(std::make_shared<ngraph::snippets::op::Tile>(lowered)),
-                                   std::make_pair(std::vector<size_t>({target->get_lanes(), nptrs}), std::vector<size_t>{})));
-    tiles.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::type_info)(std::make_shared<ngraph::snippets::op::Tile>(scalar_lowered)),
-                    std::make_pair(std::vector<size_t>{{1, nptrs}}, std::vector<size_t>{})));
+    // kernel region is a sequence of passes, each one is accumulators initialization, vector tile, scalar tile
+    // and horizontal reductions. Snippet without reductions is just a vector tile followed by a scalar one.
+    lowered_region tiles;
+    lowered_region lowered;
+    for (size_t k = 0; k < passes.size(); k++) {
+        lowered_region vector_lowered;
+        lowered_region prologue;
+        lowered_region epilogue;
+        for (auto n : passes[k]) {
+            vector_lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
+
+            if (auto reduce = std::dynamic_pointer_cast<ngraph::snippets::op::Reduce>(n)) {
+                auto reg = ngraph::snippets::getRegisters(n).second;
+                std::shared_ptr<ngraph::Node> init = std::make_shared<ngraph::snippets::op::Scalar>(
+                    reduce->get_output_element_type(0), Shape{1}, reduce->get_identity());
+                prologue.push_back(std::make_pair(target->get(init->get_type_info())(init), std::make_pair(std::vector<size_t>{}, reg)));
+
+                std::shared_ptr<ngraph::Node> horizon;
+                if (ov::as_type_ptr<ngraph::snippets::op::ReduceMax>(n)) {
+                    horizon = std::make_shared<ngraph::snippets::op::HorizonMax>(n);
+                } else {
+                    horizon = std::make_shared<ngraph::snippets::op::HorizonSum>(n);
+                }
+                epilogue.push_back(std::make_pair(target->get(horizon->get_type_info())(horizon), std::make_pair(reg, reg)));
+            }
+        }
+
+        lowered_region scalar_lowered;
+        for (auto n : scalar_passes[k]) {
+            scalar_lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
+        }
+
+        // wrapping into tiles
+        tiles.insert(tiles.end(), prologue.begin(), prologue.end());
+        tiles.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::type_info)(std::make_shared<ngraph::snippets::op::Tile>(vector_lowered)),
+                                       std::make_pair(std::vector<size_t>({target->get_lanes(), nptrs}), std::vector<size_t>{})));
+        tiles.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::type_info)(std::make_shared<ngraph::snippets::op::Tile>(scalar_lowered)),
+                        std::make_pair(std::vector<size_t>{{1, nptrs}}, std::vector<size_t>{})));
+        tiles.insert(tiles.end(), epilogue.begin(), epilogue.end());
+
+        lowered.insert(lowered.end(), prologue.begin(), prologue.end());
+        lowered.insert(lowered.end(), vector_lowered.begin(), vector_lowered.end());
+        lowered.insert(lowered.end(), scalar_lowered.begin(), scalar_lowered.end());
+        lowered.insert(lowered.end(), epilogue.begin(), epilogue.end());
+    }
 
     // emission
     std::shared_ptr<Emitter> kernel = target->get(ngraph::snippets::op::Kernel::type_info)(std::make_shared<ngraph::snippets::op::Kernel>(tiles));
     kernel->emit_code({params.size(), results.size()}, {});
 
-    lowered.insert(lowered.end(), scalar_lowered.begin(), scalar_lowered.end());
     for (auto& op : lowered) {
         op.first->emit_data();
     }
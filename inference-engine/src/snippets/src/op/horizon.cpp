@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "itt.hpp"
+
+#include "snippets/op/horizon.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+NGRAPH_RTTI_DEFINITION(snippets::op::HorizonMax, "HorizonMax", 0);
+NGRAPH_RTTI_DEFINITION(snippets::op::HorizonSum, "HorizonSum", 0);
+
+snippets::op::HorizonMax::HorizonMax(const Output<Node>& x) : Op({x}) {
+    constructor_validate_and_infer_types();
+}
+
+bool snippets::op::HorizonMax::visit_attributes(AttributeVisitor& visitor) {
+    return true;
+}
+
+std::shared_ptr<Node> snippets::op::HorizonMax::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(HorizonMax);
+    check_new_args_count(this, new_args);
+    return std::make_shared<HorizonMax>(new_args.at(0));
+}
+
+void snippets::op::HorizonMax::validate_and_infer_types() {
+    set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+}
+
+snippets::op::HorizonSum::HorizonSum(const Output<Node>& x) : Op({x}) {
+    constructor_validate_and_infer_types();
+}
+
+bool snippets::op::HorizonSum::visit_attributes(AttributeVisitor& visitor) {
+    return true;
+}
+
+std::shared_ptr<Node> snippets::op::HorizonSum::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(HorizonSum);
+    check_new_args_count(this, new_args);
+    return std::make_shared<HorizonSum>(new_args.at(0));
+}
+
+void snippets::op::HorizonSum::validate_and_infer_types() {
+    set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+}
@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "itt.hpp"
+
+#include "snippets/op/reduce.hpp"
+
+#include <ngraph/runtime/host_tensor.hpp>
+
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+using namespace ngraph;
+
+NGRAPH_RTTI_DEFINITION(snippets::op::Reduce, "Reduce", 0);
+NGRAPH_RTTI_DEFINITION(snippets::op::ReduceMax, "ReduceMax", 0, snippets::op::Reduce);
+NGRAPH_RTTI_DEFINITION(snippets::op::ReduceSum, "ReduceSum", 0, snippets::op::Reduce);
+
+namespace {
+template <typename F>
+bool evaluate_innermost(const ngraph::Node* node, const HostTensorVector& output_values, const HostTensorVector& input_values,
+                        float identity, F accumulate) {
+    NGRAPH_CHECK(input_values.size() == node->inputs().size(), "wrong input config");
+    NGRAPH_CHECK(output_values.size() == node->outputs().size(), "wrong output config");
+    NGRAPH_CHECK(input_values.size() == output_values.size() && input_values.size() == 1, "must be 1->1 operation");
+    NGRAPH_CHECK(input_values[0]->get_element_type() == element::f32, "only f32 reductions are supported");
+
+    const auto& ishape = input_values[0]->get_shape();
+    const size_t inner = ishape.empty() ? 1 : ishape.back();
+    const size_t outer = inner == 0 ? 0 : shape_size(ishape) / inner;
+
+    auto src = input_values[0]->get_data_ptr<float>();
+    auto dst = output_values[0]->get_data_ptr<float>();
+    for (size_t o = 0; o < outer; o++) {
+        float acc = identity;
+        for (size_t i = 0; i < inner; i++) {
+            acc = accumulate(acc, src[o * inner + i]);
+        }
+        dst[o] = acc;
+    }
+    return true;
+}
+} // namespace
+
+snippets::op::Reduce::Reduce(const Output<Node>& x) : Op({x}) {
+}
+
+bool snippets::op::Reduce::visit_attributes(AttributeVisitor& visitor) {
+    return true;
+}
+
+void snippets::op::Reduce::validate_and_infer_types() {
+    auto shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, shape.rank().is_static() && shape.rank().get_length() > 0, "reduction requires input of static non-zero rank");
+    shape[shape.rank().get_length() - 1] = 1;
+    set_output_type(0, get_input_element_type(0), shape);
+}
+
+snippets::op::ReduceMax::ReduceMax(const Output<Node>& x) : Reduce(x) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<Node> snippets::op::ReduceMax::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(ReduceMax);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ReduceMax>(new_args.at(0));
+}
+
+float snippets::op::ReduceMax::get_identity() const {
+    return std::numeric_limits<float>::lowest();
+}
+
+bool snippets::op::ReduceMax::evaluate(const HostTensorVector& output_values, const HostTensorVector& input_values) const {
+    INTERNAL_OP_SCOPE(ReduceMax);
+    return evaluate_innermost(this, output_values, input_values, get_identity(), [](float acc, float x) { return std::max(acc, x); });
+}
+
+snippets::op::ReduceSum::ReduceSum(const Output<Node>& x) : Reduce(x) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<Node> snippets::op::ReduceSum::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(ReduceSum);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ReduceSum>(new_args.at(0));
+}
+
+float snippets::op::ReduceSum::get_identity() const {
+    return 0.f;
+}
+
+bool snippets::op::ReduceSum::evaluate(const HostTensorVector& output_values, const HostTensorVector& input_values) const {
+    INTERNAL_OP_SCOPE(ReduceSum);
+    return evaluate_innermost(this, output_values, input_values, get_identity(), [](float acc, float x) { return acc + x; });
+}
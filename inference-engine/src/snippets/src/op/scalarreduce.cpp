@@ -0,0 +1,16 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/op/scalarreduce.hpp"
+
+using namespace ngraph;
+
+NGRAPH_RTTI_DEFINITION(snippets::op::ScalarReduceMax, "ScalarReduceMax", 0, snippets::op::ReduceMax);
+NGRAPH_RTTI_DEFINITION(snippets::op::ScalarReduceSum, "ScalarReduceSum", 0, snippets::op::ReduceSum);
+
+snippets::op::ScalarReduceMax::ScalarReduceMax(const Output<Node>& x) : ReduceMax(x) {
+}
+
+snippets::op::ScalarReduceSum::ScalarReduceSum(const Output<Node>& x) : ReduceSum(x) {
+}
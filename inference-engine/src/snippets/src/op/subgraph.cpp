@@ -10,6 +10,7 @@
 #include "snippets/pass/insert_movebroadcast.hpp"
 #include "snippets/pass/load_movebroadcast_to_broadcastload.hpp"
 #include "snippets/pass/assign_registers.hpp"
+#include "snippets/pass/convert_to_reductions.hpp"
 
 #include <ngraph/pass/manager.hpp>
 #include <openvino/pass/serialize.hpp>
@@ -17,6 +18,7 @@
 #include <algorithm>
 #include <memory>
 #include <array>
+#include <set>
 
 using namespace std;
 using namespace ngraph;
@@ -129,6 +131,66 @@ std::shared_ptr<snippets::op::Subgraph> snippets::op::Subgraph::make_canonical_f
     return snippet;
 }
 
+namespace {
+auto is_blocked(const ngraph::AxisVector& order) -> bool {
+    return std::set<size_t>(order.begin(), order.end()).size() != order.size();
+}
+
+// Reinterprets planar shape of a low-rank input (per-channel scale, bias) in the blocked layout of the reference input.
+// It is legal only if the memory stays the same: single blocked axis which is divisible by its block and no non-unit dims after it.
+auto propagate_blocking(Shape planar, const snippets::op::Subgraph::BlockedShape& reference) -> std::pair<bool, Shape> {
+    const auto& dims = std::get<0>(reference);
+    const auto& order = std::get<1>(reference);
+    const auto rank = std::set<size_t>(order.begin(), order.end()).size();
+    if (planar.size() > rank) {
+        return {false, planar};
+    }
+    planar.insert(planar.begin(), rank - planar.size(), 1);
+
+    std::vector<size_t> block(rank, 1);
+    std::vector<bool> seen(rank, false);
+    std::set<size_t> blocked_axes;
+    for (size_t j = 0; j < order.size(); j++) {
+        if (order[j] >= rank) {
+            return {false, planar};
+        }
+        if (seen[order[j]]) {
+            block[order[j]] *= dims[j];
+            blocked_axes.insert(order[j]);
+        }
+        seen[order[j]] = true;
+    }
+
+    if (blocked_axes.size() != 1) {
+        return {false, planar};
+    }
+    const auto axis = *blocked_axes.begin();
+    if (planar[axis] % block[axis] != 0 && planar[axis] != 1) {
+        return {false, planar};
+    }
+    for (size_t a = axis + 1; a < rank; a++) {
+        if (planar[a] != 1) {
+            return {false, planar};
+        }
+    }
+
+    Shape blocked;
+    std::fill(seen.begin(), seen.end(), false);
+    for (size_t j = 0; j < order.size(); j++) {
+        const auto a = order[j];
+        if (planar[a] == 1) {
+            blocked.push_back(1);
+        } else if (!seen[a]) {
+            blocked.push_back(planar[a] / block[a]);
+        } else {
+            blocked.push_back(dims[j]);
+        }
+        seen[a] = true;
+    }
+    return {true, blocked};
+}
+} // namespace
+
 // We also can think of canonization as of pass to copy original subgraph and transforming it to canonical form suitable for code generation
 // pass actual parameters and results shapes to generate for as well as channel mapping,
 // we need to distinguish between 5d tensors that represents <N, C, H, W, c> and <N, C, D, H, W> somehow like locked dimensions
@@ -141,6 +203,17 @@ void snippets::op::Subgraph::canonicalize(const BlockedShapeVector& output_shape
     NODE_VALIDATION_CHECK(this, output_shapes.size() == m_body->get_results().size(),
         "number of results for snippet doesn't much passed to generate method: ", output_shapes.size(), " vs ", m_body->get_results().size(), ".");
 
+    // normalization blocks are lowered to reductions over the innermost dimension before constants are replaced with scalars
+    ngraph::pass::Manager reductions;
+    reductions.register_pass<snippets::pass::ConvertSoftmaxToReductions>();
+    reductions.register_pass<snippets::pass::ConvertMVNToReductions>();
+    reductions.run_passes(m_body);
+
+    const auto ops = m_body->get_ordered_ops();
+    const bool has_reductions = std::any_of(ops.begin(), ops.end(), [](const std::shared_ptr<Node>& op) {
+        return !!std::dynamic_pointer_cast<snippets::op::Reduce>(op);
+    });
+
     // replace only constants which are actually should be represented as scalars during code generation and probably move this step a bit later
     for (auto op : m_body->get_ordered_ops()) {
         if (auto constant = ngraph::as_type_ptr<opset1::Constant>(op)) {
@@ -165,6 +238,16 @@ void snippets::op::Subgraph::canonicalize(const BlockedShapeVector& output_shape
     }
 
 
+    // blocked layout of the most blocked input is propagated to the planar low-rank ones,
+    // so they are broadcasted inside the blocked loop nest by BroadcastMove/BroadcastLoad instead of a reorder
+    const BlockedShape* blocked_reference = nullptr;
+    for (const auto& input_shape : input_shapes) {
+        if (is_blocked(std::get<1>(input_shape)) &&
+            (!blocked_reference || std::get<1>(input_shape).size() > std::get<1>(*blocked_reference).size())) {
+            blocked_reference = &input_shape;
+        }
+    }
+
     // it should be in subgraph node to be aligned with internal and external parameter list, but adding this for testing
     // TODO: store blocking into to Parameter's rt_info for future propagation
     for (size_t i = 0; i < m_body->get_parameters().size(); i++) {
@@ -172,11 +255,24 @@ void snippets::op::Subgraph::canonicalize(const BlockedShapeVector& output_shape
         if (param->get_shape().size() < 4) {
             std::vector<size_t> shape(4, 1);
             std::copy(param->get_shape().begin(), param->get_shape().end(), &shape.at(4 - (param->get_shape().size() == 0 ? 1 : param->get_shape().size())) );
-            m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(param->get_element_type(), ngraph::Shape(shape)));
+            ngraph::Shape param_shape(shape);
+            if (is_blocked(std::get<1>(input_shapes[i]))) {
+                param_shape = std::get<0>(input_shapes[i]);
+            } else if (blocked_reference) {
+                auto propagated = propagate_blocking(param_shape, *blocked_reference);
+                if (propagated.first) {
+                    param_shape = propagated.second;
+                }
+            }
+            m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(param->get_element_type(), param_shape));
         } else if (param->get_shape().size() >= 4) {
             if (param->get_element_type() != std::get<2>(input_shapes[i])) {
                 throw ngraph::ngraph_error("changes in presision. Is it legal??");
             }
+            // blocking would move the reduced dimension away from the innermost one
+            if (has_reductions && std::get<0>(input_shapes[i]).size() != param->get_shape().size()) {
+                throw ngraph::ngraph_error("snippets with reductions support only planar layouts");
+            }
             m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(std::get<2>(input_shapes[i]), std::get<0>(input_shapes[i])));
         }
     }
@@ -213,7 +309,7 @@ snippets::Schedule snippets::op::Subgraph::generate(const BlockedShapeVector& ou
     opt.run_passes(m_body);
 
     // generation flow
-    snippets::pass::AssignRegisters().run_on_function(m_body);
+    snippets::pass::AssignRegisters(m_generator->get_vector_registers()).run_on_function(m_body);
 
     // shedule generation should go here and be target agnostic
 
@@ -240,18 +336,19 @@ snippets::Schedule snippets::op::Subgraph::generate(const BlockedShapeVector& ou
             throw ngraph_error("rank for all outputs of a snippet should match");
         }
 
+        // outputs broadcasted along outer dimensions are stored by the same loop nest
         for (size_t i = 0; i < work_size.size(); i++) {
             if (work_size[i] != shape[i]) {
                 if (work_size[i] == 1) {
                     work_size[i] = shape[i];
-                } else {
+                } else if (shape[i] != 1 || i == work_size.size() - 1) {
                     throw ngraph_error("incompatible shapes for output graphs");
                 }
             }
         }
     }
 
-    return {work_size, false /*canBeLinearized*/, ptr};
+    return {work_size, false /*canBeLinearized*/, ptr, m_generator->get_lanes()};
 }
 
 bool snippets::op::Subgraph::evaluate(const HostTensorVector& outputs, const HostTensorVector& inputs) const {
@@ -14,6 +14,32 @@
 
 #include <iterator>
 
+namespace {
+// the value is spilled instead of allocating a register for an interval if it isn't needed till the end of the others
+auto can_be_spilled(const std::shared_ptr<ngraph::Node>& op) -> bool {
+    using namespace ngraph;
+    if (ov::is_type<snippets::op::Store>(op) || ov::is_type<snippets::op::Spill>(op) || ov::is_type<snippets::op::Fill>(op) ||
+        ov::is_type<snippets::op::Reduce>(op) || op->get_output_size() != 1) {
+        return false;
+    }
+    auto consumers = op->output(0).get_target_inputs();
+    return !(consumers.size() == 1 && ov::is_type<snippets::op::Spill>(consumers.begin()->get_node()));
+}
+
+auto spill_value(const std::shared_ptr<ngraph::Node>& op, const std::shared_ptr<ngraph::Node>& next) -> void {
+    using namespace ngraph;
+    auto consumers = op->output(0).get_target_inputs();
+    auto spill = std::make_shared<snippets::op::Spill>(op->output(0));
+    for (auto consumer : consumers) {
+        consumer.replace_source_output(std::make_shared<snippets::op::Fill>(spill));
+    }
+    // the value is saved right after it is computed, so its register is released as early as possible
+    if (next) {
+        next->add_control_dependency(spill);
+    }
+}
+} // namespace
+
 bool ngraph::snippets::pass::AssignRegisters::run_on_function(std::shared_ptr<Function> f) {
     RUN_ON_FUNCTION_SCOPE(AssignRegisters);
     int reg64_tmp_start { 8 }; // R8, R9, R10, R11, R12, R13, R14, R15 inputs+outputs+1
@@ -37,7 +63,8 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_function(std::shared_ptr<Fu
 
     for (auto op : stmts) {
         std::set<Reg> u;
-        for (auto input : op->inputs()) {
+        // spilled value is restored from the stack, not from a register
+        for (auto input : std::dynamic_pointer_cast<snippets::op::Fill>(op) ? std::vector<Input<Node>>{} : op->inputs()) {
             if (regs.count(input.get_tensor_ptr())) {
                 u.insert(regs[input.get_tensor_ptr()]);
             }
@@ -112,9 +139,29 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_function(std::shared_ptr<Fu
     std::multiset<std::pair<int, int>, by_ending> active;
     std::map<Reg, Reg> register_map;
     std::stack<Reg> bank;
-    for (int i = 0; i < 16; i++) bank.push(16-1-i);
+    const auto num_registers = static_cast<int>(m_num_registers);
+    for (int i = 0; i < num_registers; i++) bank.push(num_registers-1-i);
+
+    // reduction accumulates in its output register across the whole tile and the kernel is emitted in passes,
+    // so these registers are reserved from the very beginning till the last use
+    std::set<int> pinned;
+    for (auto interval : live_intervals) {
+        if (std::dynamic_pointer_cast<snippets::op::Reduce>(stmts[interval.first])) {
+            if (active.size() == m_num_registers) {
+                throw ngraph_error("caanot allocate registers for a snippet ");
+            }
+            register_map[interval.first] = bank.top();
+            bank.pop();
+            active.insert(interval);
+            pinned.insert(interval.first);
+        }
+    }
 
     for (auto interval : live_intervals) {
+        // spill writes the register of its input to the stack and doesn't need one for itself
+        if (pinned.count(interval.first) || std::dynamic_pointer_cast<snippets::op::Spill>(stmts[interval.first])) {
+            continue;
+        }
         // check expired
         while (!active.empty()) {
             auto x = *active.begin();
@@ -125,8 +172,20 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_function(std::shared_ptr<Fu
             bank.push(register_map[x.first]);
         }
         // allocate
-        if (active.size() == 16) {
-            throw ngraph_error("caanot allocate registers for a snippet ");
+        if (active.size() == m_num_registers) {
+            auto victim = interval;
+            for (auto x : active) {
+                if (!pinned.count(x.first) && can_be_spilled(stmts[x.first]) &&
+                    (!can_be_spilled(stmts[victim.first]) || x.second > victim.second)) {
+                    victim = x;
+                }
+            }
+            if (!can_be_spilled(stmts[victim.first])) {
+                throw ngraph_error("caanot allocate registers for a snippet ");
+            }
+            auto next = static_cast<size_t>(victim.first) + 1 < stmts.size() ? stmts[victim.first + 1] : nullptr;
+            spill_value(stmts[victim.first], next);
+            return run_on_function(f);
         } else {
             register_map[interval.first] = bank.top();
             bank.pop();
@@ -141,6 +200,7 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_function(std::shared_ptr<Fu
     }
 
     size_t constantID = 0;
+    int64_t spillSlot = 0;
 
     for (auto n : f->get_ordered_ops()) {
         auto& rt = n->get_rt_info();
@@ -155,6 +215,11 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_function(std::shared_ptr<Fu
             rt["effectiveAddress"] = std::make_shared<VariantWrapper<int64_t>>(VariantWrapper<int64_t>(ea));
             continue;
         }
+        // spilled value is addressed by its stack slot
+        if (std::dynamic_pointer_cast<snippets::op::Spill>(n)) {
+            rt["spillSlot"] = std::make_shared<VariantWrapper<int64_t>>(VariantWrapper<int64_t>(spillSlot++));
+            continue;
+        }
         // store effective address and procced with vector registers
         if (ov::as_type_ptr<ngraph::snippets::op::Load>(n) || ov::as_type_ptr<ngraph::snippets::op::BroadcastLoad>(n)) {
             auto source = n->get_input_source_output(0).get_node_shared_ptr();
@@ -9,6 +9,7 @@
 #include "snippets/op/subgraph.hpp"
 
 #include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset6.hpp>
 #include <ngraph/rt_info.hpp>
 #include <ngraph/op/loop.hpp>
 
@@ -16,6 +17,7 @@
 #include <vector>
 #include <cassert>
 #include <queue>
+#include <algorithm>
 #include <string>
 #include <numeric>
 
@@ -28,30 +30,31 @@ using namespace snippets;
 
 namespace {
 
+// outputs are stored by the same loop nest, so they should be numpy broadcastable to a common shape.
+// Broadcast of an output along the innermost dimension is not allowed since vector stores always advance
 auto outputs_are_not_broadcastable(const std::shared_ptr<ngraph::Node>& node) -> bool {
     auto outputs = node->outputs();
-    auto find_smallest_output_shape = [](const std::vector<ngraph::Output<ngraph::Node>>& outputs) -> ngraph::Shape {
-        return std::accumulate(std::begin(outputs), std::end(outputs), ngraph::Shape(outputs.begin()->get_shape()),
-            [](ngraph::Shape other_shape, ngraph::Output<ngraph::Node> output){
-                return ngraph::shape_size(output.get_shape()) < ngraph::shape_size(other_shape) ? output.get_shape() : other_shape;
-            });
-    };
-    auto ref_shape = find_smallest_output_shape(outputs);
-
-    auto check_shapes_broadcastable = [ref_shape](const ngraph::Output<ngraph::Node>& output) -> bool {
-        auto other_shape = output.get_shape();
+    size_t max_rank = 0;
+    for (const auto& output : outputs) {
+        max_rank = std::max(max_rank, output.get_shape().size());
+    }
 
-        if (other_shape.size() != ref_shape.size()) {
-            return false;
+    ngraph::Shape work_size(max_rank, 1);
+    for (const auto& output : outputs) {
+        ngraph::Shape shape(output.get_shape());
+        shape.insert(shape.begin(), max_rank - shape.size(), 1);
+        for (size_t i = 0; i < max_rank; i++) {
+            if (work_size[i] != shape[i] && work_size[i] != 1 && shape[i] != 1) {
+                return true;
+            }
+            work_size[i] = std::max(work_size[i], shape[i]);
         }
+    }
 
-        return std::inner_product(std::begin(other_shape), std::end(other_shape), std::begin(ref_shape), true,
-                            std::logical_and<bool>(), [](ngraph::Shape::value_type lsh, ngraph::Shape::value_type rsh){
-                                return rsh == 1 || lsh == rsh;
-                            });
-    };
-
-    return std::find_if_not(std::begin(outputs), std::end(outputs), check_shapes_broadcastable) != std::end(outputs);
+    return std::any_of(std::begin(outputs), std::end(outputs), [&work_size](const ngraph::Output<ngraph::Node>& output) {
+        const auto& shape = output.get_shape();
+        return !work_size.empty() && (shape.empty() ? 1 : shape.back()) != work_size.back();
+    });
 };
 
 auto has_cycles_of_dependencies(const std::vector<std::set<ngraph::Input<ngraph::Node>>>& results,
@@ -111,6 +114,45 @@ auto has_subgraph_as_input(std::shared_ptr<Node> node) -> bool {
     return false;
 };
 
+// normalization blocks which are decomposed to reductions over the innermost dimension during canonicalization
+auto is_lor(std::shared_ptr<Node> n) -> bool {
+    if (n->get_input_size() == 0 || n->get_input_partial_shape(0).is_dynamic()) {
+        return false;
+    }
+    const auto rank = static_cast<int64_t>(n->get_input_shape(0).size());
+
+    if (auto softmax = ov::as_type_ptr<opset1::Softmax>(n)) {
+        return rank > 0 && softmax->get_axis() == static_cast<size_t>(rank - 1);
+    }
+
+    if (auto mvn = ov::as_type_ptr<opset6::MVN>(n)) {
+        auto axes = ov::as_type_ptr<opset1::Constant>(mvn->get_input_node_shared_ptr(1));
+        if (!axes || ngraph::shape_size(axes->get_shape()) != 1) {
+            return false;
+        }
+        auto axis = axes->cast_vector<int64_t>()[0];
+        return rank > 0 && (axis == -1 || axis == rank - 1);
+    }
+
+    return false;
+}
+
+// conversions on the low precision edges of the subgraph: the values are loaded from or stored to U8/I8/BF16 memory
+// while the body computes in f32 registers
+auto is_low_precision_convert(std::shared_ptr<Node> n) -> bool {
+    auto convert = ov::as_type_ptr<opset1::Convert>(n);
+    if (!convert) {
+        return false;
+    }
+
+    auto is_low_precision = [](const element::Type& type) -> bool {
+        return type == element::u8 || type == element::i8 || type == element::bf16;
+    };
+    const auto src = convert->get_input_element_type(0);
+    const auto dst = convert->get_destination_type();
+    return (is_low_precision(src) && dst == element::f32) || (src == element::f32 && is_low_precision(dst));
+}
+
 auto is_lo(std::shared_ptr<Node> n) -> bool {
     auto is_lob = [](std::shared_ptr<Node> n) -> bool {
         using ngraph::as_type_ptr;
@@ -176,12 +218,18 @@ auto is_lo(std::shared_ptr<Node> n) -> bool {
         return false;//!!ov::as_type_ptr<opset1::FakeQuantize>(n); // 4->1
     };
 
-    return is_lou(n) || is_lob(n) ||is_lot(n) || is_fq(n);
+    return is_lou(n) || is_lob(n) ||is_lot(n) || is_fq(n) || is_lor(n) || is_low_precision_convert(n);
 }
 
 auto has_supported_in_out(std::shared_ptr<Node> n) -> bool {
+    const bool convert = is_low_precision_convert(n);
     for (auto in : n->inputs()) {
-        if (in.get_tensor().get_element_type() != ngraph::element::f32) {
+        // reduction axes are consumed by canonicalization
+        if (in.get_index() != 0 && is_lor(n)) {
+            continue;
+        }
+
+        if (in.get_tensor().get_element_type() != ngraph::element::f32 && !convert) {
             return false;
         }
 
@@ -195,7 +243,7 @@ auto has_supported_in_out(std::shared_ptr<Node> n) -> bool {
     }
 
     for (auto out : n->outputs()) {
-        if (out.get_tensor().get_element_type() != ngraph::element::f32) {
+        if (out.get_tensor().get_element_type() != ngraph::element::f32 && !convert) {
             return false;
         }
 
@@ -269,7 +317,9 @@ ngraph::snippets::pass::AttachToSubgraph::AttachToSubgraph(bool tokenize_by_node
         abort
     };
 
-    continuation_strategy strategy = continuation_strategy::abort;
+    // node which can't be merged because of the signature size or output shapes starts a new subgraph,
+    // so the rest of the chain is still fused instead of being left untokenized
+    continuation_strategy strategy = continuation_strategy::reset;
 
     ngraph::graph_rewrite_callback continuation_callback = [strategy](ngraph::pattern::Matcher &m) -> bool {
         auto node = m.get_match_root();
@@ -486,17 +536,10 @@ ngraph::snippets::pass::AttachToSubgraph::AttachToSubgraph(bool tokenize_by_node
             }
         }
 
+        // node which would close a loop through the merged subgraph is kept as a fullstop between subgraphs
         if (has_cycles_of_dependencies(subgraph_result_inputs, subgraph->inputs())) {
-            if (strategy == continuation_strategy::reset) {
-                remark(13) << "New subgraph is created due to loop dependency introduced by one of input subgraphs." << std::endl;
-
-                auto single_node_subgraph = op::Subgraph::wrap_node_as_subgraph(node);
-                single_node_subgraph->validate_and_infer_types();
-                ngraph::replace_node(node, single_node_subgraph);
-                return true;
-            } else {
-                return false;
-            }
+            remark(13) << "Node is not merged due to loop dependency introduced by one of input subgraphs." << std::endl;
+            return false;
         }
 
         for (size_t i = 0; i < subgraph->get_output_size(); ++i) {
@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "itt.hpp"
+
+#include "snippets/pass/convert_to_reductions.hpp"
+#include "snippets/snippets_isa.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+ngraph::snippets::pass::ConvertSoftmaxToReductions::ConvertSoftmaxToReductions() {
+    MATCHER_SCOPE(ConvertSoftmaxToReductions);
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(
+        ngraph::pattern::wrap_type<ngraph::opset1::Softmax>()),
+            [this](ngraph::pattern::Matcher &m) {
+            auto root = ov::as_type_ptr<ngraph::opset1::Softmax>(m.get_match_root());
+            const auto rank = root->get_input_partial_shape(0).rank();
+            if (rank.is_dynamic() || root->get_axis() != static_cast<size_t>(rank.get_length() - 1)) {
+                throw ngraph_error("snippets support Softmax only over the innermost dimension");
+            }
+
+            auto data = root->input_value(0);
+            auto max = std::make_shared<ngraph::snippets::op::ReduceMax>(data);
+            auto sub = std::make_shared<ngraph::opset1::Subtract>(data, max);
+            auto exp = std::make_shared<ngraph::opset1::Exp>(sub);
+            auto sum = std::make_shared<ngraph::snippets::op::ReduceSum>(exp);
+            auto div = std::make_shared<ngraph::opset1::Divide>(exp, sum);
+
+            div->set_friendly_name(root->get_friendly_name());
+            ngraph::copy_runtime_info(root, {max, sub, exp, sum, div});
+            ngraph::replace_node(root, div);
+            return true;
+        });
+}
+
+ngraph::snippets::pass::ConvertMVNToReductions::ConvertMVNToReductions() {
+    MATCHER_SCOPE(ConvertMVNToReductions);
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(
+        ngraph::pattern::wrap_type<ngraph::opset6::MVN>()),
+            [this](ngraph::pattern::Matcher &m) {
+            auto root = ov::as_type_ptr<ngraph::opset6::MVN>(m.get_match_root());
+            auto axes = ov::as_type_ptr<ngraph::opset1::Constant>(root->get_input_node_shared_ptr(1));
+            const auto& shape = root->get_input_partial_shape(0);
+            if (shape.is_dynamic() || !axes || ngraph::shape_size(axes->get_shape()) != 1) {
+                throw ngraph_error("snippets support MVN only over the innermost dimension with a static shape");
+            }
+            const auto rank = shape.rank().get_length();
+            auto axis = axes->cast_vector<int64_t>()[0];
+            if (axis != -1 && axis != rank - 1) {
+                throw ngraph_error("snippets support MVN only over the innermost dimension");
+            }
+
+            const auto type = root->get_input_element_type(0);
+            const auto inner = shape.to_shape().back();
+            auto data = root->input_value(0);
+            auto scale = ngraph::opset1::Constant::create(type, Shape{}, {1.f / static_cast<float>(inner)});
+            auto mean = std::make_shared<ngraph::opset1::Multiply>(std::make_shared<ngraph::snippets::op::ReduceSum>(data), scale);
+            std::shared_ptr<ngraph::Node> result = std::make_shared<ngraph::opset1::Subtract>(data, mean);
+
+            if (root->get_normalize_variance()) {
+                auto sqr = std::make_shared<ngraph::opset1::Multiply>(result, result);
+                auto var = std::make_shared<ngraph::opset1::Multiply>(std::make_shared<ngraph::snippets::op::ReduceSum>(sqr), scale);
+                auto eps = ngraph::opset1::Constant::create(type, Shape{}, {root->get_eps()});
+                std::shared_ptr<ngraph::Node> denom;
+                if (root->get_eps_mode() == ngraph::op::MVNEpsMode::INSIDE_SQRT) {
+                    denom = std::make_shared<ngraph::opset1::Sqrt>(std::make_shared<ngraph::opset1::Add>(var, eps));
+                } else {
+                    denom = std::make_shared<ngraph::opset1::Add>(std::make_shared<ngraph::opset1::Sqrt>(var), eps);
+                }
+                result = std::make_shared<ngraph::opset1::Divide>(result, denom);
+            }
+
+            result->set_friendly_name(root->get_friendly_name());
+            ngraph::copy_runtime_info(root, result);
+            ngraph::replace_node(root, result);
+            return true;
+        });
+}
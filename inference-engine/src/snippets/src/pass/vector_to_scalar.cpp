@@ -38,3 +38,27 @@ ngraph::snippets::pass::ReplaceStoresWithScalarStores::ReplaceStoresWithScalarSt
             return true;
         });
 }
+
+ngraph::snippets::pass::ReplaceReductionsWithScalarReductions::ReplaceReductionsWithScalarReductions() {
+    MATCHER_SCOPE(ReplaceReductionsWithScalarReductions);
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(
+        ngraph::pattern::wrap_type<ngraph::snippets::op::ReduceMax, ngraph::snippets::op::ReduceSum>(
+            [](const Output<Node>& output) {
+                // the scalar reductions are derived from the vector ones, so they are skipped explicitly
+                return !ov::is_type<ngraph::snippets::op::ScalarReduceMax>(output.get_node_shared_ptr()) &&
+                       !ov::is_type<ngraph::snippets::op::ScalarReduceSum>(output.get_node_shared_ptr());
+            })),
+            [this](ngraph::pattern::Matcher &m) {
+            auto root = m.get_match_root();
+            std::shared_ptr<ngraph::Node> reduce;
+            if (ov::as_type_ptr<ngraph::snippets::op::ReduceMax>(root)) {
+                reduce = std::make_shared<ngraph::snippets::op::ScalarReduceMax>(root->input_value(0));
+            } else {
+                reduce = std::make_shared<ngraph::snippets::op::ScalarReduceSum>(root->input_value(0));
+            }
+            reduce->set_friendly_name(root->get_friendly_name());
+            ngraph::copy_runtime_info(root, reduce);
+            ngraph::replace_node(root, reduce);
+            return true;
+        });
+}
@@ -0,0 +1,33 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API CommonSubexpressionElimination;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief CommonSubexpressionElimination transformation merges structurally identical operations: the ones of the
+ * same type with equal attributes, runtime info and inputs, and Constants with equal type, shape and content.
+ * The function is traversed once in topological order, so the duplicated sub-graphs are merged entirely.
+ * Parameters, Results, stateful, random and sub-graph operations are not merged, sub-graph bodies are processed
+ * recursively. The operations producing the function outputs are kept to preserve the output names.
+ */
+class ngraph::pass::CommonSubexpressionElimination : public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+};
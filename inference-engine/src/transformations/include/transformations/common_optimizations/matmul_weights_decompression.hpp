@@ -0,0 +1,34 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API MatMulWeightsDecompression;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief MatMulWeightsDecompression transformation replaces
+ *      Constant (i8/u8) -> Convert (to fp) -> Multiply (per output channel scale) -> MatMul
+ *  with
+ *      Constant (i8/u8) -> Convert (to fp) -> MatMul -> Multiply (scale)
+ *  and disables constant folding of the Convert, so plugins can keep compressed weights in memory
+ *  and execute MatMul with decompression of the weights on the fly.
+ */
+class ngraph::pass::MatMulWeightsDecompression : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MatMulWeightsDecompression();
+};
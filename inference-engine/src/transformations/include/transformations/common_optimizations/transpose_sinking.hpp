@@ -20,6 +20,12 @@ class TRANSFORMATIONS_API TransposeSinking;
 class TRANSFORMATIONS_API TransposeReduction;
 class TRANSFORMATIONS_API TransposeFQReduction;
 class TRANSFORMATIONS_API TransposeFuse;
+class TRANSFORMATIONS_API TransposeUnary;
+class TRANSFORMATIONS_API TransposeEltwise;
+class TRANSFORMATIONS_API TransposeConcat;
+class TRANSFORMATIONS_API TransposeSplit;
+class TRANSFORMATIONS_API TransposePad;
+class TRANSFORMATIONS_API TransposeInterpolate;
 
 }  // namespace pass
 }  // namespace ngraph
@@ -57,7 +63,76 @@ public:
 
 /**
  * @ingroup ie_transformation_common_api
- * @brief TransposeSinking transformation sinks Transposes through known operations
+ * @brief TransposeUnary transformation sinks Transpose through unary element-wise operations and Convert
+ * unless Convert makes the moved Transpose copy more data
+ */
+class ngraph::pass::TransposeUnary : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposeUnary();
+};
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief TransposeEltwise transformation sinks Transposes through binary element-wise operations
+ * whose inputs are either Transposes with the same order or Constants. The Constants are broadcast to the
+ * output rank and transposed back. Applied if it reduces the number of Transposes or moves the single one
+ * to a smaller tensor or to another Transpose
+ */
+class ngraph::pass::TransposeEltwise : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposeEltwise();
+};
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief TransposeConcat transformation replaces Concat of Transposes with the same order (and Constants)
+ * with a single Transpose of Concat along the corresponding axis under the same conditions as TransposeEltwise
+ */
+class ngraph::pass::TransposeConcat : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposeConcat();
+};
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief TransposeSplit transformation sinks Transpose through Split and VariadicSplit if each output is
+ * consumed by Transposes only, so the Transposes inserted on the outputs are fused with them
+ */
+class ngraph::pass::TransposeSplit : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposeSplit();
+};
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief TransposePad transformation sinks Transpose through Pad with constant pads if the output is not larger
+ * than the input or the moved Transpose reaches another Transpose
+ */
+class ngraph::pass::TransposePad : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposePad();
+};
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief TransposeInterpolate transformation sinks Transpose through Interpolate-4 with constant axes and
+ * zero pads if the output is not larger than the input or the moved Transpose reaches another Transpose
+ */
+class ngraph::pass::TransposeInterpolate : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposeInterpolate();
+};
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief TransposeSinking transformation sinks Transposes through known operations, so the ones placed
+ * around each block by the layout conversion meet and cancel each other out in TransposeFuse
  */
 class ngraph::pass::TransposeSinking: public ngraph::pass::GraphRewrite {
 public:
@@ -65,6 +140,12 @@ public:
     TransposeSinking() {
         add_matcher<ngraph::pass::TransposeFQReduction>();
         add_matcher<ngraph::pass::TransposeReduction>();
+        add_matcher<ngraph::pass::TransposeUnary>();
+        add_matcher<ngraph::pass::TransposeEltwise>();
+        add_matcher<ngraph::pass::TransposeConcat>();
+        add_matcher<ngraph::pass::TransposeSplit>();
+        add_matcher<ngraph::pass::TransposePad>();
+        add_matcher<ngraph::pass::TransposeInterpolate>();
         add_matcher<ngraph::pass::TransposeFuse>();
     }
 };
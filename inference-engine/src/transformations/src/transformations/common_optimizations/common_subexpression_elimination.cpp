@@ -0,0 +1,269 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/common_subexpression_elimination.hpp"
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/variant.hpp>
+#include <openvino/op/util/multi_subgraph_base.hpp>
+#include <openvino/op/util/variable_extension.hpp>
+
+#include "itt.hpp"
+#include "transformations/rt_info/fused_names_attribute.hpp"
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::CommonSubexpressionElimination, "CommonSubexpressionElimination", 0);
+
+namespace {
+
+// Writes the attributes into a string, so the equal strings mean the equal attributes
+class AttributesKeyBuilder : public ngraph::AttributeVisitor {
+public:
+    std::string get_key() const {
+        return m_key.str();
+    }
+
+    bool is_supported() const {
+        return m_supported;
+    }
+
+    // the attributes of unknown types can't be compared
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        m_supported = false;
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        m_supported = false;
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override {
+        append(name, static_cast<int64_t>(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override {
+        append(name, static_cast<uint64_t>(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        append(name, adapter.get());
+    }
+
+private:
+    void write(const std::string& value) {
+        // the length prefix keeps the strings with separators unambiguous
+        m_key << value.size() << ':' << value;
+    }
+
+    template <typename T>
+    void write(const T& value) {
+        m_key << value;
+    }
+
+    void write(float value) {
+        m_key.precision(std::numeric_limits<float>::max_digits10);
+        m_key << value;
+    }
+
+    void write(double value) {
+        m_key.precision(std::numeric_limits<double>::max_digits10);
+        m_key << value;
+    }
+
+    template <typename T>
+    void write(const std::vector<T>& values) {
+        m_key << '[' << values.size() << ':';
+        for (const auto& value : values) {
+            write(value);
+            m_key << ',';
+        }
+        m_key << ']';
+    }
+
+    template <typename T>
+    void append(const std::string& name, const T& value) {
+        write(get_name_with_context() + name);
+        m_key << '=';
+        write(value);
+        m_key << ';';
+    }
+
+    std::ostringstream m_key;
+    bool m_supported = true;
+};
+
+bool is_mergeable(const std::shared_ptr<ngraph::Node>& node) {
+    if (ov::is_type<ngraph::opset6::Parameter>(node) || ov::is_type<ngraph::opset6::Result>(node) ||
+        ov::is_type<ngraph::op::Sink>(node) || ov::is_type<ngraph::opset8::RandomUniform>(node) ||
+        ov::is_type<ov::op::util::MultiSubGraphOp>(node) ||
+        std::dynamic_pointer_cast<ov::op::util::VariableExtension>(node))
+        return false;
+    return node->get_control_dependencies().empty() && node->get_control_dependents().empty();
+}
+
+// the outputs of the function keep their names and producers, so such node may be the original only
+bool produces_function_output(const std::shared_ptr<ngraph::Node>& node) {
+    for (const auto& output : node->outputs()) {
+        for (const auto& consumer : output.get_target_inputs()) {
+            if (ov::is_type<ngraph::opset6::Result>(consumer.get_node()))
+                return true;
+        }
+    }
+    return false;
+}
+
+// Returns the key equal for the nodes which compute the same values, empty if the node can't be compared
+std::string get_node_key(const std::shared_ptr<ngraph::Node>& node) {
+    std::ostringstream key;
+    const auto& type_info = node->get_type_info();
+    key << type_info.name << '.' << type_info.version << '.' << type_info.get_version() << '(';
+    for (const auto& input : node->input_values())
+        key << input.get_node()->get_instance_id() << ':' << input.get_index() << ',';
+    key << ')';
+
+    for (const auto& item : node->get_rt_info()) {
+        // fused names are merged, the other attributes have to match
+        if (!item.second || ov::is_type<ngraph::VariantWrapper<ngraph::FusedNames>>(item.second))
+            continue;
+        key << item.first << '=' << item.second->to_string() << ';';
+    }
+
+    if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(node)) {
+        // the content is compared with the bucket entries directly
+        key << constant->get_element_type() << constant->get_shape();
+        return key.str();
+    }
+
+    AttributesKeyBuilder attributes;
+    if (!node->visit_attributes(attributes) || !attributes.is_supported())
+        return {};
+    key << attributes.get_key();
+    return key.str();
+}
+
+bool are_equal(const std::shared_ptr<ngraph::Node>& lhs, const std::shared_ptr<ngraph::Node>& rhs) {
+    auto lhs_constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(lhs);
+    auto rhs_constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(rhs);
+    if (!lhs_constant || !rhs_constant)
+        return true;  // the keys contain everything for the other nodes
+    const auto size = lhs_constant->get_byte_size();
+    return size == rhs_constant->get_byte_size() &&
+           std::memcmp(lhs_constant->get_data_ptr(), rhs_constant->get_data_ptr(), size) == 0;
+}
+
+void merge(const std::shared_ptr<ngraph::Node>& duplicate, const std::shared_ptr<ngraph::Node>& original) {
+    for (size_t i = 0; i < duplicate->get_output_size(); ++i) {
+        auto replacement = original->output(i);
+        // Output::replace overrides the names of the replacement, keep them both
+        auto original_names = replacement.get_tensor().get_names();
+        duplicate->output(i).replace(replacement);
+        replacement.get_tensor().add_names(original_names);
+    }
+    ngraph::copy_runtime_info({original, duplicate}, original);
+}
+
+}  // namespace
+
+bool ngraph::pass::CommonSubexpressionElimination::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    RUN_ON_FUNCTION_SCOPE(CommonSubexpressionElimination);
+    bool rewritten = false;
+
+    // the inputs of each node refer to the already merged producers, so one pass in topological order is enough
+    std::unordered_map<std::string, std::vector<std::shared_ptr<Node>>> buckets;
+    for (const auto& node : f->get_ordered_ops()) {
+        if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
+            for (size_t i = 0; i < sub_graph_node->get_num_internal_subgraphs(); ++i) {
+                if (auto sub_graph = sub_graph_node->get_function(static_cast<int>(i)))
+                    rewritten |= run_on_function(sub_graph);
+            }
+        }
+
+        if (!is_mergeable(node))
+            continue;
+        const auto key = get_node_key(node);
+        if (key.empty())
+            continue;
+
+        auto& bucket = buckets[key];
+        std::shared_ptr<Node> original;
+        for (const auto& candidate : bucket) {
+            if (are_equal(candidate, node)) {
+                original = candidate;
+                break;
+            }
+        }
+        if (!original) {
+            bucket.push_back(node);
+        } else if (!produces_function_output(node)) {
+            merge(node, original);
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
@@ -0,0 +1,72 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/matmul_weights_decompression.hpp"
+
+#include <memory>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/rt_info.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+#include "itt.hpp"
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::MatMulWeightsDecompression, "MatMulWeightsDecompression", 0);
+
+ngraph::pass::MatMulWeightsDecompression::MatMulWeightsDecompression() {
+    MATCHER_SCOPE(MatMulWeightsDecompression);
+
+    const auto weights = pattern::wrap_type<opset8::Constant>([](const Output<Node>& output) {
+        const auto& type = output.get_element_type();
+        return (type == element::i8 || type == element::u8) && output.get_partial_shape().rank() == 2;
+    });
+    const auto convert = pattern::wrap_type<opset8::Convert>({weights}, pattern::consumers_count(1));
+    const auto scale = pattern::wrap_type<opset8::Constant>();
+    const auto multiply = pattern::wrap_type<opset8::Multiply>({convert, scale}, pattern::consumers_count(1));
+    const auto matmul = pattern::wrap_type<opset8::MatMul>({pattern::any_input(), multiply});
+
+    ngraph::matcher_pass_callback callback = [=](pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto matmul_node = std::dynamic_pointer_cast<opset8::MatMul>(pattern_map.at(matmul).get_node_shared_ptr());
+        const auto convert_node = pattern_map.at(convert).get_node_shared_ptr();
+        const auto scale_node = std::dynamic_pointer_cast<opset8::Constant>(pattern_map.at(scale).get_node_shared_ptr());
+        const auto multiply_node = pattern_map.at(multiply).get_node_shared_ptr();
+        if (!matmul_node || !scale_node || transformation_callback(matmul_node))
+            return false;
+
+        // The scale can be moved after MatMul only when it is the same along the reduced K axis,
+        // i.e. it broadcasts to [1, N] for [K, N] weights and to [N, 1] for transposed [N, K] weights
+        const auto& weights_shape = pattern_map.at(weights).get_shape();
+        const bool transpose_b = matmul_node->get_transpose_b();
+        const size_t n_axis = transpose_b ? 0 : 1;
+        const size_t output_channels = weights_shape[n_axis];
+
+        auto scale_shape = scale_node->get_shape();
+        if (scale_shape.size() > 2)
+            return false;
+        while (scale_shape.size() < 2)
+            scale_shape.insert(scale_shape.begin(), 1);
+        if (scale_shape[1 - n_axis] != 1 || (scale_shape[n_axis] != 1 && scale_shape[n_axis] != output_channels))
+            return false;
+
+        // the scale is applied to the last axis of the MatMul output
+        const auto output_scale = std::make_shared<opset8::Constant>(scale_node->get_element_type(),
+                                                                     Shape{scale_shape[n_axis]},
+                                                                     scale_node->get_data_ptr());
+        const auto new_matmul = matmul_node->clone_with_new_inputs({matmul_node->input_value(0), convert_node});
+        const auto new_multiply = std::make_shared<opset8::Multiply>(new_matmul, output_scale);
+        if (new_multiply->get_output_partial_shape(0) != matmul_node->get_output_partial_shape(0))
+            return false;
+
+        new_matmul->set_friendly_name(matmul_node->get_friendly_name() + "/compressed");
+        new_multiply->set_friendly_name(matmul_node->get_friendly_name());
+        copy_runtime_info({matmul_node, multiply_node, scale_node}, {new_matmul, new_multiply, output_scale});
+        replace_node(matmul_node, new_multiply);
+
+        disable_constant_folding(convert_node);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, matcher_name);
+    this->register_matcher(m, callback);
+}
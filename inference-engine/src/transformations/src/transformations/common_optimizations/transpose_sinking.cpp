@@ -9,16 +9,26 @@
 #include <memory>
 #include <vector>
 
+#include <ngraph/opsets/opset4.hpp>
 #include <ngraph/opsets/opset6.hpp>
 #include <ngraph/opsets/opset7.hpp>
 #include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/or.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/validation_util.hpp>
 #include <numeric>
+#include <set>
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeSinking, "TransposeSinking", 0);
 NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeReduction, "TransposeReduction", 0);
 NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeFQReduction, "TransposeFQReduction", 0);
 NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeFuse, "TransposeFuse", 0);
+NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeUnary, "TransposeUnary", 0);
+NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeEltwise, "TransposeEltwise", 0);
+NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeConcat, "TransposeConcat", 0);
+NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeSplit, "TransposeSplit", 0);
+NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposePad, "TransposePad", 0);
+NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeInterpolate, "TransposeInterpolate", 0);
 
 using namespace ngraph;
 
@@ -223,3 +233,354 @@ ngraph::pass::TransposeFuse::TransposeFuse() {
     auto m = std::make_shared<ngraph::pattern::Matcher>(transpose_2, matcher_name);
     register_matcher(m, matcher_pass_callback);
 }
+
+namespace {
+
+std::shared_ptr<opset6::Constant> get_transpose_order(const std::shared_ptr<Node>& node) {
+    if (!ov::is_type<opset6::Transpose>(node))
+        return nullptr;
+    return std::dynamic_pointer_cast<opset6::Constant>(node->get_input_node_shared_ptr(1));
+}
+
+// the Transpose disappears after sinking only if all its consumers are the inputs of the sunk node
+bool is_consumed_only_by(const std::shared_ptr<Node>& transpose, const Node* node) {
+    for (const auto& consumer : transpose->output(0).get_target_inputs()) {
+        if (consumer.get_node() != node)
+            return false;
+    }
+    return true;
+}
+
+// Moving a Transpose from the input to the output of a node pays off if the moved Transpose copies
+// no more data than before or meets another Transpose to be fused with
+bool is_move_profitable(const Output<Node>& input, const Output<Node>& output) {
+    for (const auto& consumer : output.get_target_inputs()) {
+        if (ov::is_type<opset6::Transpose>(consumer.get_node()))
+            return true;
+    }
+    if (output.get_element_type().bitwidth() > input.get_element_type().bitwidth())
+        return false;
+    const auto& input_shape = input.get_partial_shape();
+    const auto& output_shape = output.get_partial_shape();
+    if (input_shape.same_scheme(output_shape))
+        return true;
+    return input_shape.is_static() && output_shape.is_static() &&
+           shape_size(output_shape.get_shape()) <= shape_size(input_shape.get_shape());
+}
+
+// The inputs of a multi-input operation with the Transpose removed from them. Every input must be either
+// a Transpose with the same order or a Constant, which is broadcast to the rank and transposed back.
+// Returns false if the inputs don't fit or sinking isn't worth it.
+bool get_untransposed_inputs(const std::shared_ptr<Node>& node, bool broadcast_constants,
+                             std::shared_ptr<opset6::Constant>& order_const, OutputVector& new_inputs, NodeVector& new_ops) {
+    const auto& rank = node->get_output_partial_shape(0).rank();
+    if (rank.is_dynamic())
+        return false;
+    const auto rank_value = static_cast<size_t>(rank.get_length());
+
+    std::vector<int64_t> order;
+    for (const auto& input : node->input_values()) {
+        if (auto input_order = get_transpose_order(input.get_node_shared_ptr())) {
+            order = input_order->cast_vector<int64_t>();
+            order_const = input_order;
+            break;
+        }
+    }
+    if (!order_const || order.size() != rank_value)
+        return false;
+
+    std::set<std::shared_ptr<Node>> removed_transposes;
+    std::shared_ptr<opset6::Constant> reversed_order;
+    for (const auto& input : node->input_values()) {
+        const auto input_node = input.get_node_shared_ptr();
+        if (auto input_order = get_transpose_order(input_node)) {
+            if (input_order->cast_vector<int64_t>() != order)
+                return false;
+            if (is_consumed_only_by(input_node, node.get()))
+                removed_transposes.insert(input_node);
+            new_inputs.push_back(input_node->input_value(0));
+        } else if (ov::is_type<opset6::Constant>(input_node)) {
+            auto constant = input;
+            const auto ranks_diff = static_cast<int64_t>(rank_value) - input.get_partial_shape().rank().get_length();
+            if (ranks_diff > 0) {
+                if (!broadcast_constants)
+                    return false;
+                std::vector<int64_t> axes(ranks_diff);
+                std::iota(axes.begin(), axes.end(), 0);
+                const auto& axes_const = opset6::Constant::create(element::i64, Shape{axes.size()}, axes);
+                new_ops.push_back(axes_const);
+                constant = op::util::make_try_fold<opset6::Unsqueeze>(constant, axes_const);
+                new_ops.push_back(constant.get_node_shared_ptr());
+            }
+            if (!reversed_order) {
+                reversed_order = get_reversed_order_constant(order_const);
+                new_ops.push_back(reversed_order);
+            }
+            const auto& transposed = op::util::make_try_fold<opset6::Transpose>(constant, reversed_order);
+            new_ops.push_back(transposed);
+            new_inputs.push_back(transposed);
+        } else {
+            return false;
+        }
+    }
+
+    // a single Transpose is added to the output, so at least one has to go away
+    if (removed_transposes.empty())
+        return false;
+    if (removed_transposes.size() == 1) {
+        const auto& transpose = *removed_transposes.begin();
+        return is_move_profitable(transpose->output(0), node->output(0));
+    }
+    return true;
+}
+
+}  // namespace
+
+ngraph::pass::TransposeUnary::TransposeUnary() {
+    MATCHER_SCOPE(TransposeUnary);
+
+    auto transpose_label = pattern::wrap_type<opset6::Transpose>({pattern::any_input(), pattern::wrap_type<opset6::Constant>()},
+                                                                 pattern::consumers_count(1));
+    auto unary_label = pattern::wrap_type<op::util::UnaryElementwiseArithmetic, opset6::Clamp, opset6::Elu, opset6::Convert,
+                                          opset6::LogicalNot, opset6::SoftPlus, opset6::Mish, op::v0::Gelu>({transpose_label});
+
+    ngraph::matcher_pass_callback matcher_pass_callback = [=](ngraph::pattern::Matcher &m) {
+        const auto &pattern_to_output = m.get_pattern_value_map();
+
+        auto transpose = pattern_to_output.at(transpose_label).get_node_shared_ptr();
+        auto unary = pattern_to_output.at(unary_label).get_node_shared_ptr();
+        if (!is_move_profitable(transpose->output(0), unary->output(0)))
+            return false;
+
+        auto new_unary = unary->copy_with_new_inputs({transpose->input_value(0)});
+        auto new_transpose = register_new_node<opset6::Transpose>(new_unary, transpose->input_value(1));
+        new_transpose->set_friendly_name(unary->get_friendly_name());
+
+        ngraph::copy_runtime_info({unary, transpose}, {new_unary, new_transpose});
+        ngraph::replace_node(unary, new_transpose);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(unary_label, matcher_name);
+    register_matcher(m, matcher_pass_callback);
+}
+
+ngraph::pass::TransposeEltwise::TransposeEltwise() {
+    MATCHER_SCOPE(TransposeEltwise);
+
+    auto eltwise_label = pattern::wrap_type<op::util::BinaryElementwiseArithmetic, op::util::BinaryElementwiseComparison,
+                                            opset6::LogicalAnd, opset6::LogicalOr, opset6::LogicalXor>();
+
+    ngraph::matcher_pass_callback matcher_pass_callback = [=](ngraph::pattern::Matcher &m) {
+        auto eltwise = m.get_match_root();
+        const auto& autob = eltwise->get_autob();
+        if (autob.m_type != op::AutoBroadcastType::NONE && autob.m_type != op::AutoBroadcastType::NUMPY)
+            return false;
+
+        std::shared_ptr<opset6::Constant> order;
+        OutputVector new_inputs;
+        NodeVector new_ops;
+        if (!get_untransposed_inputs(eltwise, true, order, new_inputs, new_ops))
+            return false;
+
+        auto new_eltwise = eltwise->copy_with_new_inputs(new_inputs);
+        new_ops.push_back(new_eltwise);
+        auto new_transpose = register_new_node<opset6::Transpose>(new_eltwise, order);
+        new_ops.push_back(new_transpose);
+        new_transpose->set_friendly_name(eltwise->get_friendly_name());
+
+        NodeVector old_ops{eltwise};
+        for (const auto& input : eltwise->input_values())
+            old_ops.push_back(input.get_node_shared_ptr());
+        ngraph::copy_runtime_info(old_ops, new_ops);
+        ngraph::replace_node(eltwise, new_transpose);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(eltwise_label, matcher_name);
+    register_matcher(m, matcher_pass_callback);
+}
+
+ngraph::pass::TransposeConcat::TransposeConcat() {
+    MATCHER_SCOPE(TransposeConcat);
+
+    auto concat_label = pattern::wrap_type<opset6::Concat>();
+
+    ngraph::matcher_pass_callback matcher_pass_callback = [=](ngraph::pattern::Matcher &m) {
+        auto concat = std::dynamic_pointer_cast<opset6::Concat>(m.get_match_root());
+        if (!concat)
+            return false;
+
+        std::shared_ptr<opset6::Constant> order;
+        OutputVector new_inputs;
+        NodeVector new_ops;
+        if (!get_untransposed_inputs(concat, false, order, new_inputs, new_ops))
+            return false;
+
+        const auto axis = ngraph::normalize_axis(concat.get(), concat->get_axis(), concat->get_output_partial_shape(0).rank());
+        const auto new_axis = order->cast_vector<int64_t>()[axis];
+        auto new_concat = std::make_shared<opset6::Concat>(new_inputs, new_axis);
+        new_ops.push_back(new_concat);
+        auto new_transpose = register_new_node<opset6::Transpose>(new_concat, order);
+        new_ops.push_back(new_transpose);
+        new_transpose->set_friendly_name(concat->get_friendly_name());
+
+        NodeVector old_ops{concat};
+        for (const auto& input : concat->input_values())
+            old_ops.push_back(input.get_node_shared_ptr());
+        ngraph::copy_runtime_info(old_ops, new_ops);
+        ngraph::replace_node(concat, new_transpose);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(concat_label, matcher_name);
+    register_matcher(m, matcher_pass_callback);
+}
+
+ngraph::pass::TransposeSplit::TransposeSplit() {
+    MATCHER_SCOPE(TransposeSplit);
+
+    auto transpose_label = pattern::wrap_type<opset6::Transpose>({pattern::any_input(), pattern::wrap_type<opset6::Constant>()},
+                                                                 pattern::consumers_count(1));
+    auto split_label = pattern::wrap_type<opset6::Split>({transpose_label, pattern::wrap_type<opset6::Constant>()});
+    auto variadic_split_label = pattern::wrap_type<opset6::VariadicSplit>(
+            {transpose_label, pattern::wrap_type<opset6::Constant>(), pattern::wrap_type<opset6::Constant>()});
+    auto split_or_variadic_split = std::make_shared<pattern::op::Or>(OutputVector{split_label, variadic_split_label});
+
+    ngraph::matcher_pass_callback matcher_pass_callback = [=](ngraph::pattern::Matcher &m) {
+        const auto &pattern_to_output = m.get_pattern_value_map();
+
+        auto transpose = pattern_to_output.at(transpose_label).get_node_shared_ptr();
+        auto split = m.get_match_root();
+        auto transpose_order = std::dynamic_pointer_cast<opset6::Constant>(transpose->get_input_node_shared_ptr(1));
+        auto split_axis = std::dynamic_pointer_cast<opset6::Constant>(split->get_input_node_shared_ptr(1));
+        if (!transpose_order || !split_axis)
+            return false;
+
+        // N Transposes are inserted instead of one, they have to be fused with the consumers
+        for (const auto& output : split->outputs()) {
+            const auto& consumers = output.get_target_inputs();
+            if (consumers.empty())
+                return false;
+            for (const auto& consumer : consumers) {
+                if (!ov::is_type<opset6::Transpose>(consumer.get_node()))
+                    return false;
+            }
+        }
+
+        const auto axis = ngraph::normalize_axis(split.get(), split_axis->cast_vector<int64_t>()[0], split->get_input_partial_shape(0).rank());
+        const auto new_axis = opset6::Constant::create(split_axis->get_element_type(), {}, {transpose_order->cast_vector<int64_t>()[axis]});
+        OutputVector split_inputs = split->input_values();
+        split_inputs[0] = transpose->input_value(0);
+        split_inputs[1] = new_axis;
+        auto new_split = split->copy_with_new_inputs(split_inputs);
+        NodeVector new_ops{new_axis, new_split};
+
+        OutputVector new_outputs;
+        for (size_t i = 0; i < new_split->get_output_size(); ++i) {
+            auto new_transpose = register_new_node<opset6::Transpose>(new_split->output(i), transpose_order);
+            new_transpose->set_friendly_name(split->get_friendly_name() + "." + std::to_string(i));
+            new_ops.push_back(new_transpose);
+            new_outputs.push_back(new_transpose);
+        }
+        new_split->set_friendly_name(split->get_friendly_name() + "/split");
+
+        ngraph::copy_runtime_info({split, transpose}, new_ops);
+        ngraph::replace_node(split, new_outputs);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(split_or_variadic_split, matcher_name);
+    register_matcher(m, matcher_pass_callback);
+}
+
+ngraph::pass::TransposePad::TransposePad() {
+    MATCHER_SCOPE(TransposePad);
+
+    auto pad_label = pattern::wrap_type<opset6::Pad>();
+
+    ngraph::matcher_pass_callback matcher_pass_callback = [=](ngraph::pattern::Matcher &m) {
+        auto pad = m.get_match_root();
+        auto transpose = pad->get_input_node_shared_ptr(0);
+        auto transpose_order = get_transpose_order(transpose);
+        auto pads_begin = std::dynamic_pointer_cast<opset6::Constant>(pad->get_input_node_shared_ptr(1));
+        auto pads_end = std::dynamic_pointer_cast<opset6::Constant>(pad->get_input_node_shared_ptr(2));
+        if (!transpose_order || !pads_begin || !pads_end || transpose->output(0).get_target_inputs().size() != 1 ||
+            !is_move_profitable(transpose->output(0), pad->output(0)))
+            return false;
+
+        // the pads of the i-th output dimension are applied to the order[i]-th input one
+        const auto& reversed_order = get_reversed_order_constant(transpose_order);
+        const auto& gather_axis = opset6::Constant::create(element::i64, {}, {0});
+        auto new_pads_begin = op::util::make_try_fold<opset6::Gather>(pads_begin, reversed_order, gather_axis);
+        auto new_pads_end = op::util::make_try_fold<opset6::Gather>(pads_end, reversed_order, gather_axis);
+
+        OutputVector pad_inputs = pad->input_values();
+        pad_inputs[0] = transpose->input_value(0);
+        pad_inputs[1] = new_pads_begin;
+        pad_inputs[2] = new_pads_end;
+        auto new_pad = pad->copy_with_new_inputs(pad_inputs);
+        auto new_transpose = register_new_node<opset6::Transpose>(new_pad, transpose_order);
+        new_transpose->set_friendly_name(pad->get_friendly_name());
+
+        ngraph::copy_runtime_info({pad, transpose}, {reversed_order, new_pads_begin, new_pads_end, new_pad, new_transpose});
+        ngraph::replace_node(pad, new_transpose);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(pad_label, matcher_name);
+    register_matcher(m, matcher_pass_callback);
+}
+
+ngraph::pass::TransposeInterpolate::TransposeInterpolate() {
+    MATCHER_SCOPE(TransposeInterpolate);
+
+    auto interpolate_label = pattern::wrap_type<opset4::Interpolate>();
+
+    ngraph::matcher_pass_callback matcher_pass_callback = [=](ngraph::pattern::Matcher &m) {
+        auto interpolate = std::dynamic_pointer_cast<opset4::Interpolate>(m.get_match_root());
+        if (!interpolate)
+            return false;
+        auto transpose = interpolate->get_input_node_shared_ptr(0);
+        auto transpose_order = get_transpose_order(transpose);
+        if (!transpose_order || transpose->output(0).get_target_inputs().size() != 1 ||
+            !is_move_profitable(transpose->output(0), interpolate->output(0)))
+            return false;
+
+        // the pads are given for every dimension, keep the simple case only
+        const auto& attrs = interpolate->get_attrs();
+        auto is_zero = [](size_t pad) { return pad == 0; };
+        if (!std::all_of(attrs.pads_begin.begin(), attrs.pads_begin.end(), is_zero) ||
+            !std::all_of(attrs.pads_end.begin(), attrs.pads_end.end(), is_zero))
+            return false;
+
+        const auto order = transpose_order->cast_vector<int64_t>();
+        std::vector<int64_t> axes;
+        if (interpolate->get_input_size() > 3) {
+            auto axes_const = std::dynamic_pointer_cast<opset6::Constant>(interpolate->get_input_node_shared_ptr(3));
+            if (!axes_const)
+                return false;
+            const auto& non_negative_axes = ngraph::normalize_axes(interpolate->get_friendly_name(), axes_const->cast_vector<int64_t>(),
+                                                                   interpolate->get_input_partial_shape(0).rank());
+            axes.assign(non_negative_axes.begin(), non_negative_axes.end());
+        } else {
+            axes.resize(order.size());
+            std::iota(axes.begin(), axes.end(), 0);
+        }
+        for (auto& axis : axes)
+            axis = order.at(axis);
+
+        auto new_axes = opset6::Constant::create(element::i64, Shape{axes.size()}, axes);
+        auto new_interpolate = std::make_shared<opset4::Interpolate>(transpose->input_value(0), interpolate->input_value(1),
+                                                                     interpolate->input_value(2), new_axes, attrs);
+        auto new_transpose = register_new_node<opset6::Transpose>(new_interpolate, transpose_order);
+        new_transpose->set_friendly_name(interpolate->get_friendly_name());
+
+        ngraph::copy_runtime_info({interpolate, transpose}, {new_axes, new_interpolate, new_transpose});
+        ngraph::replace_node(interpolate, new_transpose);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(interpolate_label, matcher_name);
+    register_matcher(m, matcher_pass_callback);
+}
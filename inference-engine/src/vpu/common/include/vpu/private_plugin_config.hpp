@@ -141,6 +141,19 @@ DECLARE_VPU_CONFIG(MYRIAD_DEVICE_CONNECT_TIMEOUT);
 
 DECLARE_VPU_CONFIG(MYRIAD_ENABLE_ASYNC_DMA);
 
+/**
+ * @brief Number of the elements of the device input and output FIFOs of a loaded network.
+ * The inputs of the next infer requests are sent to the device while the current one is executed,
+ * a deeper FIFO lets more transfers overlap with the execution at the cost of the device memory.
+ * Default is "AUTO": two elements per throughput stream.
+ */
+DECLARE_VPU_CONFIG(MYRIAD_FIFO_DEPTH);
+
+/**
+ * @brief Default key definition for InferenceEngine::MYRIAD_FIFO_DEPTH option.
+ */
+DECLARE_VPU_CONFIG(MYRIAD_FIFO_DEPTH_AUTO);
+
 namespace VPUConfigParams {
 
 IE_SUPPRESS_DEPRECATED_START
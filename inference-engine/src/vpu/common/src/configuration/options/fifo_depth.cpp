@@ -0,0 +1,66 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "vpu/private_plugin_config.hpp"
+#include "vpu/utils/containers.hpp"
+#include "vpu/configuration/options/fifo_depth.hpp"
+#include "vpu/configuration/plugin_configuration.hpp"
+#include "vpu/utils/error.hpp"
+
+namespace vpu {
+
+void FifoDepthOption::validate(const std::string& value) {
+    if (value == defaultValue()) {
+        return;
+    }
+
+    int intValue;
+    try {
+        intValue = std::stoi(value);
+    } catch (const std::exception& e) {
+        VPU_THROW_FORMAT(R"(unexpected {} option value "{}", must be a number)", key(), value);
+    }
+
+    VPU_THROW_UNLESS(intValue > 0,
+        R"(unexpected {} option value "{}", only positive numbers are supported)", key(), value);
+}
+
+void FifoDepthOption::validate(const PluginConfiguration& configuration) {
+    validate(configuration[key()]);
+}
+
+std::string FifoDepthOption::key() {
+    return InferenceEngine::MYRIAD_FIFO_DEPTH;
+}
+
+details::Access FifoDepthOption::access() {
+    return details::Access::Private;
+}
+
+details::Category FifoDepthOption::category() {
+    return details::Category::RunTime;
+}
+
+std::string FifoDepthOption::defaultValue() {
+    return InferenceEngine::MYRIAD_FIFO_DEPTH_AUTO;
+}
+
+FifoDepthOption::value_type FifoDepthOption::parse(const std::string& value) {
+    if (value == defaultValue()) {
+        return FifoDepthOption::value_type();
+    }
+
+    int intValue;
+    try {
+        intValue = std::stoi(value);
+    } catch (const std::exception& e) {
+        VPU_THROW_FORMAT(R"(unexpected {} option value "{}", must be a number)", key(), value);
+    }
+
+    VPU_THROW_UNSUPPORTED_OPTION_UNLESS(intValue > 0,
+        R"(unexpected {} option value "{}", only positive numbers are supported)", key(), value);
+    return intValue;
+}
+
+}  // namespace vpu
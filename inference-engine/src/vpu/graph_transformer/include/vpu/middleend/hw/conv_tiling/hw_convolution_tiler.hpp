@@ -218,6 +218,7 @@ public:
         _dirTiling(dirTiling),
         _convolutionOptions(dirTiling.convolutionOptions()), _hwTiling(std::make_shared<HwConvTiling>()) {
         dirTiling.applyTilingOption(tilingOption);
+        _hwTiling->cost = tilingOption.cost;
 
         if (dirTiling.patternMatching()) {
             dirTiling.correctPlaneSizeAfterPatternMatching();
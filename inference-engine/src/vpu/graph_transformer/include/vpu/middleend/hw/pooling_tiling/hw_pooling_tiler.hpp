@@ -124,6 +124,7 @@ public:
         _convolutionOptions(dirTiling.convolutionOptions()),
         _hwTiling(std::make_shared<HwPoolTiling>()) {
         dirTiling.applyTilingOption(tilingOption);
+        _hwTiling->cost = tilingOption.cost;
 
         const auto& heightTiles = calcHeightTilesP(
             _convolutionOptions,
@@ -99,6 +99,9 @@ struct HwTiling final {
     int sowTiles = 0;
     int socTiles = 0;
 
+    // estimated cost of the tiling, includes both HW compute and DMA transfers
+    double cost = 0.0;
+
     SmallVector<HwPlaneTilePtr<Tiles>> planeTiles;
 };
 
@@ -108,6 +111,7 @@ void printTo(std::ostream& os, const HwTilingPtr<Tiles>& tiling) {
     os << "sohTiles=" << tiling->sohTiles << std::endl;
     os << "sowTiles=" << tiling->sowTiles << std::endl;
     os << "socTiles=" << tiling->socTiles << std::endl;
+    os << "cost=" << tiling->cost << std::endl;
     os << "]";
 }
 
@@ -117,6 +121,7 @@ void printTo(DotLabel& lbl, const HwTilingPtr<Tiles>& tiling) {
     subLbl.appendPair("sohTiles", tiling->sohTiles);
     subLbl.appendPair("sowTiles", tiling->sowTiles);
     subLbl.appendPair("socTiles", tiling->socTiles);
+    subLbl.appendPair("cost", tiling->cost);
 }
 
 template <class Tiles>
@@ -286,6 +291,17 @@ SmallVector<HwPlaneTileInfo> splitIntoPlaneTiles(
         int maxOutputSize,
         bool useCeil);
 
+//
+// DMA cost of tile.
+//
+
+// Every tile is transferred between DDR and CMX, so the halo (junk) of neighbor tiles is read several times
+// and the weights are loaded again for every plane tile. The cost is in the same units as the HW compute cost.
+double calcHwTileDmaCost(
+        double numInputElements,
+        double numOutputElements,
+        double numWeightsElements);
+
 //
 // Check HW-unit memory restrictions for tile.
 //
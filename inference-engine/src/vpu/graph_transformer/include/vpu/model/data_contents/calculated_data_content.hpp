@@ -9,6 +9,9 @@
 #include <vpu/utils/small_vector.hpp>
 #include <vpu/model/data_desc.hpp>
 
+#include <mutex>
+#include <vector>
+
 namespace vpu {
 
 //
@@ -16,6 +19,7 @@ namespace vpu {
 //
 //   * It performs calculation on the first call and stores it in internal buffer.
 //   * Next access will return the pointer to calculated buffer.
+//   * The access is thread safe, so the contents sharing the same base content can be calculated in parallel.
 //
 
 class CalculatedDataContent : public DataContent {
@@ -29,6 +33,7 @@ private:
 
 private:
     mutable std::vector<uint8_t> _temp;
+    mutable std::mutex _mutex;
 };
 
 } // namespace vpu
@@ -14,6 +14,7 @@
 #include <legacy/graph_tools.hpp>
 #include <description_buffer.hpp>
 #include <xml_parse_utils.h>
+#include <ie_parallel.hpp>
 
 #include <climits>
 #include <cstring>
@@ -34,6 +35,7 @@
 #include <sstream>
 #include <iomanip>
 #include <atomic>
+#include <exception>
 
 namespace vpu {
 
@@ -108,6 +110,7 @@ ElfN_Ehdr BackEnd::createElfHeader() {
 }
 
 void BackEnd::serializeConstData(const Model& model, const mv_blob_header& blobHdr, std::vector<char>& blob) {
+    std::vector<Data> constDatas;
     for (const auto& data : model->datas()) {
         if (data->usage() != DataUsage::Const) {
             continue;
@@ -117,11 +120,29 @@ void BackEnd::serializeConstData(const Model& model, const mv_blob_header& blobH
         IE_ASSERT(data->parentDataToDataEdge() == nullptr);
         IE_ASSERT(data->numConsumers() != 0);
         IE_ASSERT(data->dataLocation().location == Location::Blob);
+        IE_ASSERT(data->content() != nullptr);
 
-        const auto content = data->content();
-        IE_ASSERT(content != nullptr);
+        constDatas.push_back(data);
+    }
+
+    // The contents are calculated lazily on the first access (weights relayout, precision conversion, etc.),
+    // so most of the compilation time of a large model is spent here. The contents are written to
+    // the disjoint parts of the blob, so they are calculated in parallel.
+    std::vector<std::exception_ptr> errors(constDatas.size());
+    ie::parallel_for(constDatas.size(), [&](size_t i) {
+        try {
+            const auto& data = constDatas[i];
+            const auto content = data->content();
+            std::copy_n(content->get<uint8_t>(), content->byteSize(), blob.data() + blobHdr.const_data_section_offset + data->dataLocation().offset);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
 
-        std::copy_n(content->get<uint8_t>(), content->byteSize(), blob.data() + blobHdr.const_data_section_offset + data->dataLocation().offset);
+    for (const auto& error : errors) {
+        if (error != nullptr) {
+            std::rethrow_exception(error);
+        }
     }
 }
 
@@ -819,6 +819,15 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
                                         * widthTile.outputWithJunk
                                         * heightTile.outputWithJunk
                                         * outputTileInitial[Dim::C];
+
+                        // DMA of the tile: input and weights of all channel tiles and the output
+                        solutionCost += calcHwTileDmaCost(
+                            static_cast<double>(widthTile.inputWithJunk) * heightTile.inputWithJunk
+                                * tileInfo.extendedInputDimC * numChannelTiles,
+                            static_cast<double>(widthTile.outputWithJunk) * heightTile.outputWithJunk
+                                * tileInfo.extendedOutputDimC,
+                            static_cast<double>(_convolutionOptions._kernelSizeX) * _convolutionOptions._kernelSizeY
+                                * tileInfo.extendedInputDimC * numChannelTiles * tileInfo.extendedOutputDimC);
                     }
 
                     if (!isOK) {
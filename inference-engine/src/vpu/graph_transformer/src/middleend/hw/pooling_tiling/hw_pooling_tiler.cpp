@@ -491,6 +491,14 @@ std::vector<TilingOption> HWPoolingTilingSearcher::selectBetterTiling() const {
                                             * _inputTileDims[Dim::C]
                                             * _inputTileDims[Dim::N];
                         }
+
+                        // DMA of the tile
+                        solutionCost += calcHwTileDmaCost(
+                            static_cast<double>(widthTile.inputWithJunk) * heightTile.inputWithJunk
+                                * _inputTileDims[Dim::C] * _inputTileDims[Dim::N] * numBatchTiles,
+                            static_cast<double>(widthTile.outputWithJunk) * heightTile.outputWithJunk
+                                * _outputTileDims[Dim::C] * _outputTileDims[Dim::N] * numBatchTiles,
+                            0.0);
                     }
 
                     if (!isOK) {
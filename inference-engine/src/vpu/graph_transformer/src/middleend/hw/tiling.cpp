@@ -101,6 +101,18 @@ int calcInputSize(
     return (outputSize - 1) * kernelStride + kernelSize - padBefore - padAfter;
 }
 
+//
+// DMA cost of tile.
+//
+
+double calcHwTileDmaCost(
+        double numInputElements,
+        double numOutputElements,
+        double numWeightsElements) {
+    // CMX transfers CMX_DATA_BYTE_WIDTH bytes per cycle
+    return (numInputElements + numOutputElements + numWeightsElements) * sizeof(fp16_t) / CMX_DATA_BYTE_WIDTH;
+}
+
 //
 // Plane tiles calculation.
 //
@@ -9,6 +9,9 @@
 #include <set>
 #include <memory>
 #include <string>
+#include <utility>
+#include <limits>
+#include <tuple>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/middleend/allocator/allocator.hpp>
@@ -208,7 +211,11 @@ void PassImpl::adjustModelForMemReqs(const Model& model) {
 
     auto& allocator = model->getAllocator();
 
-    StageSet allFailedStages;
+    // Stages which failed after all CMX datas alive at them had been spilled
+    StageSet fullySpilledStages;
+
+    // Number of datas and bytes spilled from CMX to DDR to allocate the stage
+    StageMap<std::pair<int, int>> spillStatistics;
 
     for (;;) {
         auto allocRes = runAllocator(model);
@@ -224,10 +231,9 @@ void PassImpl::adjustModelForMemReqs(const Model& model) {
         env.log->trace("Stage # %d [%s] failed to allocate : %s", failedStageInd, failedStage->name(), allocRes.status);
         VPU_LOGGER_SECTION(env.log);
 
-        VPU_INTERNAL_CHECK(allFailedStages.count(failedStage) == 0,
+        VPU_INTERNAL_CHECK(fullySpilledStages.count(failedStage) == 0,
             "Memory allocation failed: unable to satisfy requirements for stage %v with type %v",
             failedStage->name(), failedStage->type());
-        allFailedStages.emplace(failedStage);
 
         //
         // Try to flush Data allocated in CMX
@@ -249,8 +255,13 @@ void PassImpl::adjustModelForMemReqs(const Model& model) {
             }
         }
 
-        StageInputVector cmxConsumerEdges;
-        cmxConsumerEdges.reserve(allCmxDatas.size() * 4);
+        //
+        // Spill only as many datas as needed to fit the failed one. The datas which keep CMX busy longest
+        // (their last consumer is the farthest one) go first, and the larger ones go first among them.
+        //
+
+        DataVector spillCandidates;
+        DataMap<int> lastConsumerInds;
 
         for (const auto& cmxData : allCmxDatas) {
             IE_ASSERT(cmxData->usage() == DataUsage::Intermediate);
@@ -265,6 +276,58 @@ void PassImpl::adjustModelForMemReqs(const Model& model) {
 
             IE_ASSERT(cmxData->numConsumers() > 0);
 
+            int lastConsumerInd = -1;
+            for (const auto& consumerEdge : cmxData->consumerEdges()) {
+                if (consumerEdge->consumer()->attrs().getOrDefault<bool>("CMX-to-DDR", false)) {
+                    continue;
+                }
+
+                lastConsumerInd = std::max(lastConsumerInd, consumerEdge->consumer()->index());
+            }
+
+            if (lastConsumerInd >= 0) {
+                spillCandidates.emplace_back(cmxData);
+                lastConsumerInds.emplace(cmxData, lastConsumerInd);
+            }
+        }
+
+        std::stable_sort(spillCandidates.begin(), spillCandidates.end(), [&lastConsumerInds](const Data& lhs, const Data& rhs) {
+            return std::make_tuple(lastConsumerInds.at(lhs), calcAllocationSize(lhs)) >
+                   std::make_tuple(lastConsumerInds.at(rhs), calcAllocationSize(rhs));
+        });
+
+        // Free CMX may be fragmented and the amount of CMX required by SHAVEs is unknown,
+        // the same stage fails again in such cases and more datas are spilled
+        auto requiredSize = std::numeric_limits<int>::max();
+        if (allocRes.status == AllocationStatus::DATA_FAILED && failedData != nullptr) {
+            requiredSize = calcAllocationSize(failedData) - static_cast<int>(allocator.freeCMXMemoryAmount());
+        }
+
+        DataVector spilledDatas;
+        int spilledSize = 0;
+        for (const auto& cmxData : spillCandidates) {
+            if (spilledSize >= requiredSize) {
+                break;
+            }
+
+            spilledDatas.emplace_back(cmxData);
+            spilledSize += calcAllocationSize(cmxData);
+        }
+
+        if (spilledDatas.size() == spillCandidates.size()) {
+            fullySpilledStages.emplace(failedStage);
+        }
+
+        env.log->trace("Spill %d of %d datas (%d bytes) : %v", spilledDatas.size(), spillCandidates.size(), spilledSize, spilledDatas);
+
+        auto& stageSpills = spillStatistics[failedStage];
+        stageSpills.first += static_cast<int>(spilledDatas.size());
+        stageSpills.second += spilledSize;
+
+        StageInputVector cmxConsumerEdges;
+        cmxConsumerEdges.reserve(spilledDatas.size() * 4);
+
+        for (const auto& cmxData : spilledDatas) {
             for (const auto& consumerEdge : cmxData->consumerEdges()) {
                 if (consumerEdge->consumer()->attrs().getOrDefault<bool>("CMX-to-DDR", false)) {
                     continue;
@@ -339,6 +402,13 @@ void PassImpl::adjustModelForMemReqs(const Model& model) {
             }
         }
     }
+
+    for (const auto& stage : model->getStages()) {
+        const auto it = spillStatistics.find(stage);
+        if (it != spillStatistics.end()) {
+            env.log->debug("CMX spills for Stage [%s] : %d datas, %d bytes", stage->name(), it->second.first, it->second.second);
+        }
+    }
 }
 
 //
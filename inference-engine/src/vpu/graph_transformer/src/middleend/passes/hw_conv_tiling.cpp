@@ -34,6 +34,8 @@ private:
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwConvTiling);
 
+    const auto& env = CompileEnv::get();
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubConv) {
             continue;
@@ -183,6 +185,8 @@ void PassImpl::run(const Model& model) {
         model->disconnectStage(origStage);
 
         for (const auto &tiling : tiler.getHwTilings()) {
+            env.log->trace("HW stage [%v] tiling: %v", origStage->name(), tiling);
+
             HWConvStageTiler hwStageTiler(
                 stageOptions,
                 stageIO,
@@ -32,6 +32,8 @@ private:
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwPoolTiling);
 
+    const auto& env = CompileEnv::get();
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubMaxPool &&
             origStage->type() != StageType::StubAvgPool) {
@@ -101,6 +103,8 @@ void PassImpl::run(const Model& model) {
 
 
         for (const auto &tiling : tiler.getHwTilings()) {
+            env.log->trace("HW stage [%v] tiling: %v", origStage->name(), tiling);
+
             HWPoolStageTiler hwStageTiler(stageOptions, stageIO, model, origStage, _stageBuilder, tiling);
             //
             // Split/concat input/output tiles
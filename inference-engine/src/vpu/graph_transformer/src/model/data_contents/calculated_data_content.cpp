@@ -4,12 +4,27 @@
 
 #include <vpu/model/data_contents/calculated_data_content.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace vpu {
 
 const void* CalculatedDataContent::getRaw() const {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_temp.empty()) {
+            return _temp.data();
+        }
+    }
+
+    // The calculation may access the contents it is based on, so it runs without the lock.
+    // A concurrent caller may calculate the same buffer, only the first result is stored.
+    std::vector<uint8_t> temp(byteSize());
+    fillTempBuf(temp.data());
+
+    std::lock_guard<std::mutex> lock(_mutex);
     if (_temp.empty()) {
-        _temp.resize(byteSize());
-        fillTempBuf(_temp.data());
+        _temp = std::move(temp);
     }
     return _temp.data();
 }
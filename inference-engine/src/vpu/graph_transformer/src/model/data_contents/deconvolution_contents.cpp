@@ -9,6 +9,8 @@
 
 #include <ie_parallel.hpp>
 
+#include <vector>
+
 namespace vpu {
 
 //
@@ -148,7 +150,6 @@ DeconvolutionWeightsContent::DeconvolutionWeightsContent(
         int KX, int KY,
         int IC, int OC) :
         _origContent(origContent), _desc(desc),
-        _intermBuf(_desc.totalDimSize()),
         _KX(KX), _KY(KY),
         _IC(IC), _OC(OC) {
 }
@@ -162,13 +163,15 @@ void DeconvolutionWeightsContent::fillTempBuf(void* tempBuf) const {
 
     auto dstPtr = static_cast<fp16_t*>(tempBuf);
 
+    std::vector<fp16_t> intermBuf(_desc.totalDimSize());
+
     deconvolutionRelayout(
             _origContent->get<fp16_t>(), _desc.totalDimSize(),
-            _intermBuf.data(), _desc.totalDimSize(),
+            intermBuf.data(), _desc.totalDimSize(),
             _KX, _KY,
             _IC, _OC);
 
-    kchw_to_hwkc(_intermBuf.data(), dstPtr, _desc);
+    kchw_to_hwkc(intermBuf.data(), dstPtr, _desc);
 }
 
 } // namespace vpu
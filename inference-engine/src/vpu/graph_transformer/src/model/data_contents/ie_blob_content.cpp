@@ -22,6 +22,7 @@ size_t IeBlobContent::byteSize() const {
 
 const void* IeBlobContent::getRaw() const {
     if (_resultDataType == DataType::FP16) {
+        std::lock_guard<std::mutex> lock(_mutex);
         if (_blobFp16 == nullptr) {
             _blobFp16 = _blob->getTensorDesc().getPrecision() == ie::Precision::FP16 ?
                         _blob : convertBlobFP32toFP16(_blob);
@@ -9,6 +9,9 @@
 
 #include <ie_parallel.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace vpu {
 
 PReLUBlobContent::PReLUBlobContent(const ie::Blob::CPtr& blob, const DataDesc& desc, int repeat) :
@@ -23,6 +26,7 @@ size_t PReLUBlobContent::byteSize() const {
 }
 
 const void* PReLUBlobContent::getRaw() const {
+    std::unique_lock<std::mutex> lock(_mutex);
     if (_blobFp16 == nullptr) {
         _blobFp16 = _blob->getTensorDesc().getPrecision() == ie::Precision::FP16 ?
                     _blob : convertBlobFP32toFP16(_blob);
@@ -32,24 +36,35 @@ const void* PReLUBlobContent::getRaw() const {
         return _blobFp16->cbuffer();
     }
 
-    if (_tempFp16.empty()) {
-        VPU_PROFILE(PReLUBlobContent);
+    if (!_tempFp16.empty()) {
+        return _tempFp16.data();
+    }
 
-        IE_ASSERT(_desc.totalDimSize() % _repeat == 0);
+    // the replication runs in parallel, so it is done without the lock
+    // to let this thread run the other tasks while it waits
+    const auto blobFp16 = _blobFp16;
+    lock.unlock();
 
-        auto origNumElems = _desc.totalDimSize() / _repeat;
-        IE_ASSERT(checked_cast<size_t>(origNumElems) <= _blobFp16->size());
+    VPU_PROFILE(PReLUBlobContent);
 
-        auto origPtr = _blobFp16->cbuffer().as<const fp16_t*>();
-        IE_ASSERT(origPtr != nullptr);
+    IE_ASSERT(_desc.totalDimSize() % _repeat == 0);
 
-        _tempFp16.resize(checked_cast<size_t>(_desc.totalDimSize()));
+    auto origNumElems = _desc.totalDimSize() / _repeat;
+    IE_ASSERT(checked_cast<size_t>(origNumElems) <= blobFp16->size());
 
-        ie::parallel_for(_repeat, [this, origPtr, origNumElems](int i) {
-            std::copy_n(origPtr, origNumElems, _tempFp16.data() + i * origNumElems);
-        });
-    }
+    auto origPtr = blobFp16->cbuffer().as<const fp16_t*>();
+    IE_ASSERT(origPtr != nullptr);
 
+    std::vector<fp16_t> tempFp16(checked_cast<size_t>(_desc.totalDimSize()));
+
+    ie::parallel_for(_repeat, [&tempFp16, origPtr, origNumElems](int i) {
+        std::copy_n(origPtr, origNumElems, tempFp16.data() + i * origNumElems);
+    });
+
+    lock.lock();
+    if (_tempFp16.empty()) {
+        _tempFp16 = std::move(tempFp16);
+    }
     return _tempFp16.data();
 }
 
@@ -17,6 +17,7 @@
 #include <vpu/compile_env.hpp>
 #include <vpu/configuration/options/log_level.hpp>
 #include <vpu/configuration/options/throughput_streams.hpp>
+#include <vpu/configuration/options/fifo_depth.hpp>
 #include <vpu/configuration/options/exclusive_async_requests.hpp>
 
 using namespace InferenceEngine;
@@ -58,6 +59,11 @@ void ExecutableNetwork::openDevice(std::vector<DevicePtr>& devicePool) {
         ? _config.get<ThroughputStreamsOption>().get() : DefaultAllocation::numStreams(_config);
 }
 
+int ExecutableNetwork::fifoDepth() const {
+    const auto& depth = _config.get<FifoDepthOption>();
+    return depth.hasValue() ? static_cast<int>(depth.get()) : 2 * _actualNumExecutors;
+}
+
 ExecutableNetwork::ExecutableNetwork(
         const ie::CNNNetwork& network,
         std::shared_ptr<IMvnc> mvnc,
@@ -110,7 +116,7 @@ ExecutableNetwork::ExecutableNetwork(
         return;
     }
     openDevice(devicePool);
-    _executor->allocateGraph(_device, _graphDesc, _graphBlob, compiledGraph->blobHeader, compiledGraph->numActiveStages, networkName, _actualNumExecutors);
+    _executor->allocateGraph(_device, _graphDesc, _graphBlob, compiledGraph->blobHeader, compiledGraph->numActiveStages, networkName, _actualNumExecutors, fifoDepth());
 }
 
 void ExecutableNetwork::Import(std::istream& strm, std::vector<DevicePtr> &devicePool, const PluginConfiguration& configuration) {
@@ -134,7 +140,7 @@ void ExecutableNetwork::Import(std::istream& strm, std::vector<DevicePtr> &devic
     _inputInfo  = blobReader.getInputInfo();
     _outputInfo = blobReader.getOutputInfo();
     openDevice(devicePool);
-    _executor->allocateGraph(_device, _graphDesc, _graphBlob, blobHeader, numStages, networkName, _actualNumExecutors);
+    _executor->allocateGraph(_device, _graphDesc, _graphBlob, blobHeader, numStages, networkName, _actualNumExecutors, fifoDepth());
     _graphMetaData.stagesMeta.resize(numStages);
     for (auto &meta : _graphMetaData.stagesMeta) {
         meta.stageName = meta.stageType = meta.layerName = meta.layerType = "UNKNOWN";
@@ -183,7 +189,7 @@ InferenceEngine::Parameter ExecutableNetwork::GetMetric(const std::string &name)
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>());
     } else if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
-        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(2u * _actualNumExecutors));
+        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(fifoDepth()));
     } else if (name == METRIC_KEY(DEVICE_THERMAL)) {
         IE_SET_METRIC_RETURN(DEVICE_THERMAL, _executor->GetThermal(_device));
     } else {
@@ -135,6 +135,11 @@ private:
     }
 
     void openDevice(std::vector<DevicePtr>& devicePool);
+
+    /**
+     * @brief Number of the infer requests which may have their inputs sent to the device at the same time
+     */
+    int fifoDepth() const;
 };
 
 }  // namespace MyriadPlugin
@@ -10,6 +10,7 @@
 #include <utility>
 #include <chrono>
 #include <memory>
+#include <tuple>
 
 #include <mvnc.h>
 #include <ie_common.h>
@@ -98,7 +99,7 @@ ncStatus_t MyriadExecutor::bootNextDevice(std::vector<DevicePtr> &devicePool, co
 
     ncStatus_t statusOpen = NC_ERROR;
 
-    DeviceDesc device;
+    auto device = std::make_shared<DeviceDesc>();
 
     std::string dirName;
 
@@ -141,11 +142,11 @@ ncStatus_t MyriadExecutor::bootNextDevice(std::vector<DevicePtr> &devicePool, co
     deviceOpenParams.customFirmwareDirectory = dirName.c_str();
 
     // Open new device with specific path to FW folder
-    statusOpen = ncDeviceOpen(&device._deviceHandle,
+    statusOpen = ncDeviceOpen(&device->_deviceHandle,
         in_deviceDesc, deviceOpenParams);
 
     if (statusOpen != NC_OK) {
-        ncDeviceClose(&device._deviceHandle, _mvnc->watchdogHndl());
+        ncDeviceClose(&device->_deviceHandle, _mvnc->watchdogHndl());
         return statusOpen;
     }
 
@@ -154,66 +155,66 @@ ncStatus_t MyriadExecutor::bootNextDevice(std::vector<DevicePtr> &devicePool, co
     ncStatus_t status;
 
     // Get device protocol
-    status = ncDeviceGetOption(device._deviceHandle, NC_RO_DEVICE_PLATFORM,
-                                          reinterpret_cast<void*>(&device), &dataLength);
+    status = ncDeviceGetOption(device->_deviceHandle, NC_RO_DEVICE_PLATFORM,
+                                          reinterpret_cast<void*>(device.get()), &dataLength);
     if (status != NC_OK) {
         _log->warning("Failed to get device platform");
-        ncDeviceClose(&device._deviceHandle, _mvnc->watchdogHndl());
+        ncDeviceClose(&device->_deviceHandle, _mvnc->watchdogHndl());
         return status != NC_OK ? status : NC_ERROR;     // for dataLength error
     }
 
     //  Get device platform
-    status = ncDeviceGetOption(device._deviceHandle, NC_RO_DEVICE_PROTOCOL,
-                               reinterpret_cast<void*>(&device._protocol), &dataLength);
-    if (status != NC_OK || dataLength != sizeof(device._protocol)) {
+    status = ncDeviceGetOption(device->_deviceHandle, NC_RO_DEVICE_PROTOCOL,
+                               reinterpret_cast<void*>(&device->_protocol), &dataLength);
+    if (status != NC_OK || dataLength != sizeof(device->_protocol)) {
         _log->warning("Failed to get device protocol");
-        ncDeviceClose(&device._deviceHandle, _mvnc->watchdogHndl());
+        ncDeviceClose(&device->_deviceHandle, _mvnc->watchdogHndl());
         return status != NC_OK ? status : NC_ERROR;     // for dataLength error
     }
 
 
     // Get device max executors
-    status = ncDeviceGetOption(device._deviceHandle, NC_RO_DEVICE_MAX_GRAPH_NUM,
-                               reinterpret_cast<void*>(&device._maxGraphNum), &dataLength);
-    if (status != NC_OK || dataLength != sizeof(device._maxGraphNum)) {
+    status = ncDeviceGetOption(device->_deviceHandle, NC_RO_DEVICE_MAX_GRAPH_NUM,
+                               reinterpret_cast<void*>(&device->_maxGraphNum), &dataLength);
+    if (status != NC_OK || dataLength != sizeof(device->_maxGraphNum)) {
         _log->warning("Failed to get maximum supported number of graphs");
-        ncDeviceClose(&device._deviceHandle, _mvnc->watchdogHndl());
+        ncDeviceClose(&device->_deviceHandle, _mvnc->watchdogHndl());
         return status != NC_OK ? status : NC_ERROR;     // for dataLength error
     }
 
     // Get device name
     char deviceName[NC_MAX_NAME_SIZE];
     dataLength = NC_MAX_NAME_SIZE;
-    status = ncDeviceGetOption(device._deviceHandle, NC_RO_DEVICE_NAME,
+    status = ncDeviceGetOption(device->_deviceHandle, NC_RO_DEVICE_NAME,
                                reinterpret_cast<void*>(&deviceName), &dataLength);
     if (status != NC_OK || dataLength > NC_MAX_NAME_SIZE) {
         _log->warning("Failed to get name of booted device");
-        ncDeviceClose(&device._deviceHandle, _mvnc->watchdogHndl());
+        ncDeviceClose(&device->_deviceHandle, _mvnc->watchdogHndl());
         return status != NC_OK ? status : NC_ERROR;     // for dataLength error
     } else {
-        device._name = deviceName;
+        device->_name = deviceName;
     }
 
-    status = ncDeviceSetOption(device._deviceHandle, NC_RW_DEVICE_POWER_CONFIG, reinterpret_cast<void*>(&powerConfig), sizeof(dataLength));
+    status = ncDeviceSetOption(device->_deviceHandle, NC_RW_DEVICE_POWER_CONFIG, reinterpret_cast<void*>(&powerConfig), sizeof(dataLength));
 
     if (status != NC_OK) {
         _log->warning("Failed to set configuration for Power Manager");
-        ncDeviceClose(&device._deviceHandle, _mvnc->watchdogHndl());
+        ncDeviceClose(&device->_deviceHandle, _mvnc->watchdogHndl());
         return status;
     }
 
-    status = ncDeviceSetOption(device._deviceHandle, NC_RW_ENABLE_ASYNC_DMA, reinterpret_cast<void*>(&enableAsyncDma), sizeof(dataLength));
+    status = ncDeviceSetOption(device->_deviceHandle, NC_RW_ENABLE_ASYNC_DMA, reinterpret_cast<void*>(&enableAsyncDma), sizeof(dataLength));
 
     if (status != NC_OK) {
         _log->warning("Failed to set option for async DMA");
-        ncDeviceClose(&device._deviceHandle, _mvnc->watchdogHndl());
+        ncDeviceClose(&device->_deviceHandle, _mvnc->watchdogHndl());
         return status;
     }
 
     /* TODO: what should we do if we do not know maximum available graphs? What if we got number <= 0? */
-    device._graphNum = 1;
-    device._deviceIdx = lastDeviceIdx + 1;
-    devicePool.push_back(std::make_shared<DeviceDesc>(device));
+    device->_graphNum = 1;
+    device->_deviceIdx = lastDeviceIdx + 1;
+    devicePool.push_back(device);
     return NC_OK;
 }
 
@@ -266,15 +267,21 @@ DevicePtr MyriadExecutor::openDevice(std::vector<DevicePtr>& devicePool,
             });
         // Return mock device. If try infer with it, exception will be thrown
         if (availableDevices.empty()) {
-            DeviceDesc device;
-            device._protocol = config.get<ProtocolOption>();
-            return std::make_shared<DeviceDesc>(device);
+            auto device = std::make_shared<DeviceDesc>();
+            device->_protocol = config.get<ProtocolOption>();
+            return device;
         }
 
-        auto deviceWithMinExecutors = std::min_element(availableDevices.begin(), availableDevices.end(),
-            [](const DevicePtr &lhs, const DevicePtr &rhs) { return lhs->_graphNum < rhs->_graphNum; });
+        printThrottlingStatus(availableDevices);
 
-        auto &device = *deviceWithMinExecutors;
+        // Throttled devices run slower, so they get new graphs only when all devices are throttled
+        auto deviceLoad = [](const DevicePtr &device) {
+            return std::make_tuple(GetThrottlingLevel(device), device->_graphNum, device->_inferencesInFlight.load());
+        };
+        auto leastLoadedDevice = std::min_element(availableDevices.begin(), availableDevices.end(),
+            [&deviceLoad](const DevicePtr &lhs, const DevicePtr &rhs) { return deviceLoad(lhs) < deviceLoad(rhs); });
+
+        auto &device = *leastLoadedDevice;
         device->_graphNum++;
         return device;
     }
@@ -306,10 +313,12 @@ void MyriadExecutor::closeDevices(std::vector<DevicePtr> &devicePool, std::share
 void MyriadExecutor::allocateGraph(DevicePtr &device, GraphDesc &graphDesc,
                                    const std::vector<char> &graphFileContent,
                                    const std::pair<const char*, size_t> &graphHeaderDesc,
-                                   size_t numStages, const std::string & networkName, int executors) {
+                                   size_t numStages, const std::string & networkName, int executors,
+                                   int fifoDepth) {
     VPU_PROFILE(allocateGraph);
     _numStages = static_cast<int>(numStages);
     graphDesc._name = networkName;
+    graphDesc._device = device;
     if (device->_deviceHandle == nullptr) {
         IE_THROW() << "Failed to allocate graph: MYRIAD device is not opened.";
     }
@@ -369,7 +378,12 @@ void MyriadExecutor::allocateGraph(DevicePtr &device, GraphDesc &graphDesc,
         IE_THROW() << "Failed to get output description: " << ncStatusToStr(graphDesc._graphHandle, status);
     }
 
-    unsigned int fifo_elements = 2 * executors;
+    // the FIFOs hold the inputs sent ahead and the results not read yet, so the transfers of the next
+    // infer requests overlap with the execution of the current ones
+    const auto fifo_elements = static_cast<unsigned int>(fifoDepth);
+    if (fifo_elements < static_cast<unsigned int>(executors)) {
+        _log->warning("FIFO depth %d is less than the number of executors %d, some of them stay idle", fifoDepth, executors);
+    }
 
     status = ncFifoCreate("input", NC_FIFO_HOST_WO, &graphDesc._inputFifoHandle);
     if (status != NC_OK) {
@@ -416,6 +430,9 @@ void MyriadExecutor::queueInference(GraphDesc &graphDesc, void *input_data, size
     if (status != NC_OK) {
         IE_THROW() << "Failed to queue inference: " << ncStatusToStr(graphDesc._graphHandle, status);
     }
+    if (graphDesc._device != nullptr) {
+        graphDesc._device->_inferencesInFlight++;
+    }
 
     if (result_data != nullptr && result_bytes != 0) {
         getResult(graphDesc, result_data, static_cast<unsigned>(result_bytes));
@@ -426,6 +443,9 @@ void MyriadExecutor::getResult(GraphDesc &graphDesc, void *result_data, unsigned
     ncStatus_t status;
     void *userParam = nullptr;
     status = ncFifoReadElem(graphDesc._outputFifoHandle, result_data, &result_bytes, &userParam);
+    if (graphDesc._device != nullptr) {
+        graphDesc._device->_inferencesInFlight--;
+    }
     if (status != NC_OK) {
         IE_THROW() << "Failed to read output from FIFO: " << ncStatusToStr(graphDesc._graphHandle, status);
     }
@@ -492,8 +512,24 @@ std::string MyriadExecutor::ncStatusToStr(ncGraphHandle_t *graphHandle, ncStatus
 #undef MVNC_STATUS_TO_STR
 }
 
-void MyriadExecutor::printThrottlingStatus() {
-// TODO: enable when needed
+void MyriadExecutor::printThrottlingStatus(const std::vector<DevicePtr> &devicePool) {
+    for (const auto &device : devicePool) {
+        if (!device->isBooted()) {
+            continue;
+        }
+        _log->debug("Device #%d %s: throttling level %d, graphs %d, queued inferences %d", device->_deviceIdx,
+            device->_name, GetThrottlingLevel(device), device->_graphNum, device->_inferencesInFlight.load());
+    }
+}
+
+int MyriadExecutor::GetThrottlingLevel(const DevicePtr& device) {
+    int throttlingLevel = 0;
+    unsigned int dataLength = sizeof(throttlingLevel);
+    ncStatus_t status = ncDeviceGetOption(device->_deviceHandle,
+                                          NC_RO_DEVICE_THERMAL_THROTTLING_LEVEL,
+                                          reinterpret_cast<void *>(&throttlingLevel),
+                                          &dataLength);
+    return status == NC_OK ? throttlingLevel : 0;
 }
 
 float MyriadExecutor::GetThermal(const DevicePtr& device) {
@@ -10,6 +10,7 @@
 #include <map>
 #include <iomanip>
 #include <utility>
+#include <atomic>
 
 #include <mvnc.h>
 #include "myriad_mvnc_wrapper.h"
@@ -23,17 +24,6 @@
 namespace vpu {
 namespace MyriadPlugin {
 
-struct GraphDesc {
-    ncGraphHandle_t *_graphHandle = nullptr;
-    std::string _name;
-
-    ncTensorDescriptor_t _inputDesc = {};
-    ncTensorDescriptor_t _outputDesc = {};
-
-    ncFifoHandle_t *_inputFifoHandle = nullptr;
-    ncFifoHandle_t *_outputFifoHandle = nullptr;
-};
-
 struct DeviceDesc {
     int _graphNum = 0;
     int _maxGraphNum = 0;
@@ -43,6 +33,11 @@ struct DeviceDesc {
     int _deviceIdx = -1;
     ncDeviceHandle_t *_deviceHandle = nullptr;
 
+    /**
+     * @brief Number of inferences queued to the device by all graphs and not read yet
+     */
+    std::atomic<int> _inferencesInFlight{0};
+
     bool isBooted() const {
         return _deviceHandle != nullptr;
     }
@@ -66,6 +61,18 @@ struct DeviceDesc {
 
 typedef std::shared_ptr<DeviceDesc> DevicePtr;
 
+struct GraphDesc {
+    ncGraphHandle_t *_graphHandle = nullptr;
+    std::string _name;
+
+    ncTensorDescriptor_t _inputDesc = {};
+    ncTensorDescriptor_t _outputDesc = {};
+
+    ncFifoHandle_t *_inputFifoHandle = nullptr;
+    ncFifoHandle_t *_outputFifoHandle = nullptr;
+
+    DevicePtr _device;
+};
 
 class MyriadExecutor {
     Logger::Ptr _log;
@@ -79,7 +86,8 @@ public:
 
     /**
      * @brief Get myriad device
-     * @return Already booted and empty device or new booted device
+     * @return Already booted and empty device or new booted device. When all devices are booted,
+     * the least loaded one is returned: not throttled, with the smallest number of graphs and queued inferences
      */
     DevicePtr openDevice(std::vector<DevicePtr> &devicePool, const PluginConfiguration& config);
 
@@ -91,7 +99,8 @@ public:
                        const std::pair<const char*, size_t> &graphHeaderDesc,
                        size_t numStages,
                        const std::string & networkName,
-                       int executors);
+                       int executors,
+                       int fifoDepth);
 
     void deallocateGraph(DevicePtr &device, GraphDesc &graphDesc);
 
@@ -104,10 +113,16 @@ public:
 
     std::vector<float> getPerfTimeInfo(ncGraphHandle_t *graphHandle);
 
-    void printThrottlingStatus();
+    void printThrottlingStatus(const std::vector<DevicePtr> &devicePool);
 
     static float GetThermal(const DevicePtr& device);
 
+    /**
+     * @brief Get thermal throttling level of device
+     * @return 0 if device is not throttled or level can't be read, 1 and 2 for lower and higher temperature limits
+     */
+    static int GetThrottlingLevel(const DevicePtr& device);
+
     template<typename T>
     static std::vector<T> getGraphInfo(
             ncGraphHandle_t* graphHandle,
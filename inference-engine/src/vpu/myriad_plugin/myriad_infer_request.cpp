@@ -3,6 +3,7 @@
 //
 
 #define NOMINMAX
+#include <string>
 #include <utility>
 #include <ie_blob.h>
 #include <description_buffer.hpp>
@@ -146,8 +147,10 @@ void MyriadInferRequest::InferAsync() {
         }
     }
 
+    const auto sendStart = std::chrono::steady_clock::now();
     _executor->queueInference(_graphDesc, inputBuffer.data(),
                             _inputInfo.totalSize, nullptr, 0);
+    _sendInputTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - sendStart);
 }
 static void copyBlobAccordingUpperBound(
     const Blob::Ptr& in,
@@ -229,12 +232,16 @@ void MyriadInferRequest::GetResult() {
         const auto& blob = (*it).second;
 
         if (blob->getTensorDesc().getLayout() == getVpuLayout(name)) {
+            const auto waitStart = std::chrono::steady_clock::now();
             _executor->getResult(_graphDesc, blob->buffer(), static_cast<unsigned>(blob->byteSize()));
+            _waitResultTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - waitStart);
             return;
         }
     }
 
+    const auto waitStart = std::chrono::steady_clock::now();
     _executor->getResult(_graphDesc, resultBuffer.data(), static_cast<unsigned>(resultBuffer.size()));
+    _waitResultTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - waitStart);
 
     for (const auto& output : _outputs) {
         const auto& ieBlobName = output.first;
@@ -309,8 +316,24 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MyriadInferRe
         }
     }
 
-    return vpu::parsePerformanceReport(
+    auto perfMap = vpu::parsePerformanceReport(
         _stagesMetaData,
         perfInfo.data(), static_cast<int>(perfInfo.size()),
         _config.get<PerfReportModeOption>(), _config.get<EnableReceivingTensorTimeOption>());
+
+    if (_config.get<EnableReceivingTensorTimeOption>()) {
+        const auto addHostTiming = [&perfMap](const std::string& name, std::chrono::microseconds time) {
+            InferenceEngineProfileInfo profInfo = {};
+            profInfo.status = InferenceEngineProfileInfo::EXECUTED;
+            profInfo.cpu_uSec = time.count();
+            profInfo.realTime_uSec = time.count();
+            name.copy(profInfo.layer_type, sizeof(profInfo.layer_type) / sizeof(profInfo.layer_type[0]) - 1, 0);
+            name.copy(profInfo.exec_type, sizeof(profInfo.exec_type) / sizeof(profInfo.exec_type[0]) - 1, 0);
+            perfMap[name] = profInfo;
+        };
+        addHostTiming("<Send-Input>", _sendInputTime);
+        addHostTiming("<Wait-Result>", _waitResultTime);
+    }
+
+    return perfMap;
 }
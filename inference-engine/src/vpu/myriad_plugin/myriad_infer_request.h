@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <string>
 #include <vector>
@@ -36,6 +37,11 @@ class MyriadInferRequest : public InferenceEngine::IInferRequestInternal {
     std::map<std::string, ie::Blob::Ptr> _constDatas;
     bool _isNetworkConstant;
 
+    // host side timings of the last inference: sending the input to the device FIFO
+    // and waiting for the result, which includes the execution and the output transfer
+    std::chrono::microseconds _sendInputTime{0};
+    std::chrono::microseconds _waitResultTime{0};
+
 public:
     typedef std::shared_ptr<MyriadInferRequest> Ptr;
 
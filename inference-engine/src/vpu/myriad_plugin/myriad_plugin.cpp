@@ -66,6 +66,7 @@
 #include <vpu/configuration/options/enable_custom_reshape_param.hpp>
 #include <vpu/configuration/options/none_layers.hpp>
 #include <vpu/configuration/options/enable_async_dma.hpp>
+#include <vpu/configuration/options/fifo_depth.hpp>
 
 #include "myriad_plugin.h"
 
@@ -233,6 +234,7 @@ Engine::Engine(std::shared_ptr<IMvnc> mvnc) :
     _parsedConfig.registerOption<EnableCustomReshapeParamOption>();
     _parsedConfig.registerOption<NoneLayersOption>();
     _parsedConfig.registerOption<EnableAsyncDMAOption>();
+    _parsedConfig.registerOption<FifoDepthOption>();
 
 IE_SUPPRESS_DEPRECATED_START
     _parsedConfig.registerDeprecatedOption<DisableConvertStagesOption>(InferenceEngine::MYRIAD_DISABLE_CONVERT_STAGES);
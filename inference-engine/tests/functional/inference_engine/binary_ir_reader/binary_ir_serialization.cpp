@@ -0,0 +1,138 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fstream>
+
+#include "common_test_utils/data_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "gtest/gtest.h"
+#include "ie_core.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/serialize.hpp"
+
+#ifndef IR_SERIALIZATION_MODELS_PATH  // should be already defined by cmake
+#    error "IR_SERIALIZATION_MODELS_PATH is not defined"
+#endif
+
+class BinaryIRSerializationTest : public ::testing::Test {
+protected:
+    std::string test_name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    std::string m_out_path = test_name + ".ovb";
+
+    void TearDown() override {
+        std::remove(m_out_path.c_str());
+    }
+
+    void serialize_and_compare(InferenceEngine::CNNNetwork expected) {
+        ov::pass::Manager manager;
+        manager.register_pass<ov::pass::BinarySerialize>(m_out_path);
+        manager.run_passes(expected.getFunction());
+
+        InferenceEngine::Core ie;
+        auto result = ie.ReadNetwork(m_out_path);
+
+        bool success;
+        std::string message;
+        std::tie(success, message) =
+            compare_functions(result.getFunction(), expected.getFunction(), true, true, false, true, true);
+        ASSERT_TRUE(success) << message;
+    }
+};
+
+TEST_F(BinaryIRSerializationTest, BasicModel) {
+    const std::string model = CommonTestUtils::getModelFromTestModelZoo(IR_SERIALIZATION_MODELS_PATH "add_abc.xml");
+    const std::string weights = CommonTestUtils::getModelFromTestModelZoo(IR_SERIALIZATION_MODELS_PATH "add_abc.bin");
+
+    InferenceEngine::Core ie;
+    serialize_and_compare(ie.ReadNetwork(model, weights));
+}
+
+TEST_F(BinaryIRSerializationTest, ModelWithConstants) {
+    const std::string model =
+        CommonTestUtils::getModelFromTestModelZoo(IR_SERIALIZATION_MODELS_PATH "add_abc_initializers.xml");
+    const std::string weights =
+        CommonTestUtils::getModelFromTestModelZoo(IR_SERIALIZATION_MODELS_PATH "add_abc_initializers.bin");
+
+    InferenceEngine::Core ie;
+    serialize_and_compare(ie.ReadNetwork(model, weights));
+}
+
+TEST_F(BinaryIRSerializationTest, Loop) {
+    const std::string model =
+        CommonTestUtils::getModelFromTestModelZoo(IR_SERIALIZATION_MODELS_PATH "loop_2d_add.xml");
+    const std::string weights =
+        CommonTestUtils::getModelFromTestModelZoo(IR_SERIALIZATION_MODELS_PATH "loop_2d_add.bin");
+
+    InferenceEngine::Core ie;
+    serialize_and_compare(ie.ReadNetwork(model, weights));
+}
+
+TEST_F(BinaryIRSerializationTest, TensorIterator) {
+    const std::string model_path =
+        CommonTestUtils::getModelFromTestModelZoo(IR_SERIALIZATION_MODELS_PATH "ti_resnet.xml");
+
+    size_t weights_size = 8396840;
+
+    auto weights = InferenceEngine::make_shared_blob<uint8_t>(
+        InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {weights_size}, InferenceEngine::Layout::C));
+    weights->allocate();
+    CommonTestUtils::fill_data(weights->buffer().as<float*>(), weights->size() / sizeof(float));
+
+    auto* data = weights->buffer().as<int64_t*>();
+    data[0] = 1;
+    data[1] = 512;
+    data[1049602] = 1;
+    data[1049603] = 1;
+    data[1049604] = 512;
+
+    std::stringstream buffer;
+    std::ifstream model(model_path);
+    ASSERT_TRUE(model);
+    buffer << model.rdbuf();
+
+    InferenceEngine::Core ie;
+    serialize_and_compare(ie.ReadNetwork(buffer.str(), weights));
+}
+
+TEST_F(BinaryIRSerializationTest, ConstantsAreAligned) {
+    const std::string model =
+        CommonTestUtils::getModelFromTestModelZoo(IR_SERIALIZATION_MODELS_PATH "add_abc_initializers.xml");
+    const std::string weights =
+        CommonTestUtils::getModelFromTestModelZoo(IR_SERIALIZATION_MODELS_PATH "add_abc_initializers.bin");
+
+    InferenceEngine::Core ie;
+    auto expected = ie.ReadNetwork(model, weights);
+    std::stringstream stream;
+    ov::pass::Manager manager;
+    manager.register_pass<ov::pass::BinarySerialize>(stream);
+    manager.run_passes(expected.getFunction());
+
+    // read from the stream, constant data addresses are relative to the aligned in-memory copy of the file
+    auto result = ie.ReadNetwork(stream.str(), InferenceEngine::Blob::CPtr());
+    size_t constants = 0;
+    for (const auto& op : result.getFunction()->get_ops()) {
+        if (const auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(op)) {
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(constant->get_data_ptr()) % ov::pass::BinarySerialize::alignment, 0);
+            ++constants;
+        }
+    }
+    EXPECT_GT(constants, 0);
+}
+
+TEST_F(BinaryIRSerializationTest, CorruptedFileIsRejected) {
+    const std::string model = CommonTestUtils::getModelFromTestModelZoo(IR_SERIALIZATION_MODELS_PATH "add_abc.xml");
+    const std::string weights = CommonTestUtils::getModelFromTestModelZoo(IR_SERIALIZATION_MODELS_PATH "add_abc.bin");
+
+    InferenceEngine::Core ie;
+    auto expected = ie.ReadNetwork(model, weights);
+    std::stringstream stream;
+    ov::pass::Manager manager;
+    manager.register_pass<ov::pass::BinarySerialize>(stream);
+    manager.run_passes(expected.getFunction());
+
+    const auto content = stream.str();
+    const auto truncated = content.substr(0, content.size() - 8);
+    ASSERT_ANY_THROW(ie.ReadNetwork(truncated, InferenceEngine::Blob::CPtr()));
+}
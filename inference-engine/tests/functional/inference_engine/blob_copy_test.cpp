@@ -294,7 +294,7 @@ std::vector<BatchNum> BlobCopy_BatchNum = {
 };
 
 std::vector<ChannelNum > BlobCopy_ChannelNum = {
-        3, 7,
+        1, 3, 4, 7, 33,
 };
 
 std::vector<Dims> BlobCopy_Dims = {
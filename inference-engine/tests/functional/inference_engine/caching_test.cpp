@@ -3,6 +3,7 @@
 //
 
 #include <atomic>
+#include <set>
 #include <string>
 #include <vector>
 #include <thread>
@@ -452,6 +453,70 @@ TEST_P(CachingTest, TestLoad) {
     }
 }
 
+TEST_P(CachingTest, TestLoadAsync) {
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    if (m_remoteContext) {
+        return; // LoadNetworkAsync has no remote context overload
+    }
+    std::vector<LoadNetworkStage> stages;
+    LoadNetworkCallback callback = [&](LoadNetworkStage stage) {
+        stages.push_back(stage);
+        return true;
+    };
+    auto loadAsync = [&](Core& ie) {
+        return m_type == TestLoadType::EModelName ?
+            ie.LoadNetworkAsync(modelName, deviceToLoad, {}, callback) :
+            ie.LoadNetworkAsync(ie.ReadNetwork(modelName), deviceToLoad, {}, callback);
+    };
+    {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(1);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        EXPECT_CALL(*net, Export(_)).Times(1);
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}});
+            ASSERT_NO_THROW(loadAsync(ie).get());
+        });
+        std::vector<LoadNetworkStage> expected = {LoadNetworkStage::COMPILE, LoadNetworkStage::EXPORT_TO_CACHE};
+        if (m_type == TestLoadType::EModelName) {
+            expected.insert(expected.begin(), LoadNetworkStage::READ_NETWORK);
+        }
+        EXPECT_EQ(expected, stages);
+    }
+    stages.clear();
+    {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(1);
+        EXPECT_CALL(*net, Export(_)).Times(0);
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}});
+            ASSERT_NO_THROW(loadAsync(ie).get());
+        });
+        EXPECT_EQ(std::vector<LoadNetworkStage>{LoadNetworkStage::IMPORT_FROM_CACHE}, stages);
+    }
+}
+
+TEST_P(CachingTest, TestLoadAsyncCancel) {
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    if (m_remoteContext) {
+        return; // LoadNetworkAsync has no remote context overload
+    }
+    EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(0);
+    EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+    EXPECT_CALL(*net, Export(_)).Times(0);
+    testLoad([&](Core &ie) {
+        ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}});
+        auto cancelCompile = [](LoadNetworkStage stage) { return stage != LoadNetworkStage::COMPILE; };
+        auto future = m_type == TestLoadType::EModelName ?
+            ie.LoadNetworkAsync(modelName, deviceToLoad, {}, cancelCompile) :
+            ie.LoadNetworkAsync(ie.ReadNetwork(modelName), deviceToLoad, {}, cancelCompile);
+        EXPECT_THROW(future.get(), InferCancelled);
+    });
+}
+
 TEST_P(CachingTest, TestLoadCustomImportExport) {
     const char customData[] = {1, 2, 3, 4, 5};
     EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
@@ -1448,18 +1513,38 @@ TEST_P(CachingTest, Load_threads) {
         EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(0);
         EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(1);
         EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
-        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(THREADS_COUNT - 1);
+        // Every network gets an id: 0 for the loaded one and 1..N for the imported ones
+        std::atomic<int> importsCount{0};
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(AnyNumber())
+                .WillRepeatedly(Invoke([&](std::istream &, const std::map<std::string, std::string> &) {
+            auto imported = createMockIExecutableNet();
+            EXPECT_CALL(*imported, GetMetric("NETWORK_ID")).Times(AnyNumber()).WillRepeatedly(Return(Parameter{++importsCount}));
+            return imported;
+        }));
+        EXPECT_CALL(*net, GetMetric("NETWORK_ID")).Times(AnyNumber()).WillRepeatedly(Return(Parameter{0}));
         EXPECT_CALL(*net, Export(_)).Times(1);
+        std::mutex idsMutex;
+        std::set<int> networkIds;
         testLoad([&](Core &ie) {
             ie.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}});
             std::vector<std::thread> threads;
             for (int i = 0; i < THREADS_COUNT; i++) {
-                threads.emplace_back(([&]() { m_testFunction(ie); }));
+                threads.emplace_back(([&]() {
+                    auto id = m_testFunction(ie).GetMetric("NETWORK_ID").as<int>();
+                    std::lock_guard<std::mutex> lock(idsMutex);
+                    networkIds.insert(id);
+                }));
             }
             for (int i = 0; i < THREADS_COUNT; i++) {
                 threads[i].join();
             }
         });
+        // How many threads arrive while the network is being loaded depends on the scheduling, but each of them
+        // reuses the loaded network, so a network is imported only by the threads which came after the load and
+        // every imported network is returned to at least one thread
+        EXPECT_EQ(1, networkIds.count(0));
+        EXPECT_EQ(importsCount + 1, static_cast<int>(networkIds.size()));
+        EXPECT_LT(importsCount, THREADS_COUNT);
         index++;
     } while (duration_cast<milliseconds>(high_resolution_clock::now() - start).count() < TEST_DURATION_MS);
     std::cout << "Caching Load multiple threads test completed. Tried " << index << " times" << std::endl;
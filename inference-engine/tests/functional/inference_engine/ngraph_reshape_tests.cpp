@@ -1262,3 +1262,49 @@ TEST_F(NGraphReshapeTests, ReshapeEDTopKROIs) {
     newShapes["in1"] = {10000};
     ASSERT_NO_THROW(network.reshape(newShapes));
 }
+
+class ValidationCounterOp : public ngraph::op::Op {
+public:
+    static constexpr ngraph::NodeTypeInfo type_info{"ValidationCounter", 0};
+    const ngraph::NodeTypeInfo& get_type_info() const override { return type_info; }
+
+    ValidationCounterOp() = default;
+    explicit ValidationCounterOp(const ngraph::Output<ngraph::Node>& arg) : Op({arg}) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        ++validations;
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override {
+        return std::make_shared<ValidationCounterOp>(new_args.at(0));
+    }
+
+    size_t validations = 0;
+};
+
+constexpr ngraph::NodeTypeInfo ValidationCounterOp::type_info;
+
+TEST_F(NGraphReshapeTests, CNNReshapeRevalidatesOnlyChangedBranch) {
+    auto changed = std::make_shared<ngraph::op::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 22, 22});
+    changed->set_friendly_name("changed");
+    auto unchanged = std::make_shared<ngraph::op::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 22, 22});
+    unchanged->set_friendly_name("unchanged");
+    auto changedCounter = std::make_shared<ValidationCounterOp>(changed);
+    auto unchangedCounter = std::make_shared<ValidationCounterOp>(unchanged);
+    auto ngraph = std::make_shared<ngraph::Function>(ngraph::OutputVector{changedCounter, unchangedCounter},
+                                                     ngraph::ParameterVector{changed, unchanged});
+
+    CNNNetwork cnnNetwork(ngraph);
+    const size_t changedValidations = changedCounter->validations;
+    const size_t unchangedValidations = unchangedCounter->validations;
+
+    ASSERT_NO_THROW(cnnNetwork.reshape({{"changed", {2, 3, 22, 22}}}));
+
+    EXPECT_EQ(changedCounter->validations, changedValidations + 1);
+    EXPECT_EQ(unchangedCounter->validations, unchangedValidations);
+    EXPECT_EQ(ngraph->get_results()[0]->get_shape(), ngraph::Shape({2, 3, 22, 22}));
+    EXPECT_EQ(ngraph->get_results()[1]->get_shape(), ngraph::Shape({1, 3, 22, 22}));
+}
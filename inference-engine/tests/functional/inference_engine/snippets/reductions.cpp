@@ -0,0 +1,151 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/variant.hpp>
+
+#include <snippets/snippets_isa.hpp>
+#include <snippets/register_info.hpp>
+#include <snippets/pass/convert_to_reductions.hpp>
+#include <snippets/pass/assign_registers.hpp>
+#include <snippets/pass/collapse_subgraph.hpp>
+#include <snippets/op/subgraph.hpp>
+
+#include <transformations/init_node_info.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ngraph;
+
+TEST(TransformationTests, ConvertSoftmaxToReductions) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto softmax = std::make_shared<opset1::Softmax>(data, 1);
+        f = std::make_shared<Function>(NodeVector{softmax}, ParameterVector{data});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::ConvertSoftmaxToReductions>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto max = std::make_shared<snippets::op::ReduceMax>(data);
+        auto exp = std::make_shared<opset1::Exp>(std::make_shared<opset1::Subtract>(data, max));
+        auto sum = std::make_shared<snippets::op::ReduceSum>(exp);
+        auto div = std::make_shared<opset1::Divide>(exp, sum);
+        f_ref = std::make_shared<Function>(NodeVector{div}, ParameterVector{data});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ConvertMVNToReductions) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 4});
+        auto axes = opset1::Constant::create(element::i64, Shape{1}, {-1});
+        auto mvn = std::make_shared<opset6::MVN>(data, axes, true, 1e-5f, op::MVNEpsMode::INSIDE_SQRT);
+        f = std::make_shared<Function>(NodeVector{mvn}, ParameterVector{data});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::ConvertMVNToReductions>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 4});
+        auto scale = opset1::Constant::create(element::f32, Shape{}, {0.25f});
+        auto mean = std::make_shared<opset1::Multiply>(std::make_shared<snippets::op::ReduceSum>(data), scale);
+        auto sub = std::make_shared<opset1::Subtract>(data, mean);
+        auto var = std::make_shared<opset1::Multiply>(
+            std::make_shared<snippets::op::ReduceSum>(std::make_shared<opset1::Multiply>(sub, sub)), scale);
+        auto eps = opset1::Constant::create(element::f32, Shape{}, {1e-5f});
+        auto div = std::make_shared<opset1::Divide>(sub, std::make_shared<opset1::Sqrt>(std::make_shared<opset1::Add>(var, eps)));
+        f_ref = std::make_shared<Function>(NodeVector{div}, ParameterVector{data});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, AttachSoftmaxToSubgraph) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto data1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 3});
+        auto indata0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto indata1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 3});
+        auto add = std::make_shared<snippets::op::Subgraph>(NodeVector{data0, data1},
+            std::make_shared<Function>(NodeVector{std::make_shared<opset1::Add>(indata0, indata1)}, ParameterVector{indata0, indata1}));
+        auto softmax = std::make_shared<opset1::Softmax>(add, 1);
+        auto concat = std::make_shared<opset1::Concat>(NodeVector{add, softmax}, 0);
+        f = std::make_shared<Function>(NodeVector{concat}, ParameterVector{data0, data1});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::AttachToSubgraph>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto data0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto data1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 3});
+        auto indata0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto indata1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 3});
+        auto inner = std::make_shared<opset1::Add>(indata0, indata1);
+        auto add = std::make_shared<snippets::op::Subgraph>(NodeVector{data0, data1},
+            std::make_shared<Function>(NodeVector{std::make_shared<opset1::Softmax>(inner, 1), inner}, ParameterVector{indata0, indata1}));
+        auto concat = std::make_shared<opset1::Concat>(OutputVector{add->output(1), add->output(0)}, 0);
+        f_ref = std::make_shared<Function>(NodeVector{concat}, ParameterVector{data0, data1});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, AssignRegistersKeepsReductionAccumulator) {
+    std::shared_ptr<Function> f(nullptr);
+    {
+        auto p0 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 16});
+        auto y00 = std::make_shared<snippets::isa::Load>(p0); y00->set_friendly_name("y00");
+        auto y01 = std::make_shared<opset1::Exp>(y00); y01->set_friendly_name("y01");
+        auto y02 = std::make_shared<snippets::op::ReduceMax>(y01); y02->set_friendly_name("y02");
+        auto y03 = std::make_shared<opset1::Subtract>(y00, y02); y03->set_friendly_name("y03");
+        auto y04 = std::make_shared<snippets::isa::Store>(y03); y04->set_friendly_name("y04");
+
+        f = std::make_shared<Function>(NodeVector{y04}, ParameterVector{p0});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::AssignRegisters>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    // accumulator is live during the whole kernel, so it can't share a register with any value computed before the reduction
+    {
+        std::map<std::string, size_t> registers;
+        for (auto& op : f->get_ordered_ops()) {
+            auto& rt = op->get_rt_info();
+            if (auto rinfo = rt["reginfo"]) {
+                registers[op->get_friendly_name()] = ov::as_type_ptr<VariantWrapper<std::vector<size_t>>>(rinfo)->get()[0];
+            }
+        }
+        ASSERT_NE(registers.at("y02"), registers.at("y00"));
+        ASSERT_NE(registers.at("y02"), registers.at("y01"));
+    }
+}
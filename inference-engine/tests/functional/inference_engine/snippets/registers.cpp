@@ -135,3 +135,78 @@ TEST(TransformationTests, AssignRegisters2) {
         ASSERT_EQ(total_ops, ref_registers.size());
     }
 }
+
+TEST(TransformationTests, AssignRegistersSpillsWhenRegistersAreExhausted) {
+    const size_t num_registers = 4;
+    std::shared_ptr<Function> f(nullptr);
+    {
+        ParameterVector params;
+        NodeVector loads;
+        for (size_t i = 0; i < 6; i++) {
+            params.push_back(std::make_shared<opset1::Parameter>(element::f32, Shape()));
+            loads.push_back(std::make_shared<snippets::isa::Load>(params.back()));
+        }
+        // every load is used by both chains, so all of them are live when the first chain ends
+        std::shared_ptr<Node> y = loads[0];
+        for (size_t i = 1; i < loads.size(); i++) {
+            y = std::make_shared<opset1::Add>(y, loads[i]);
+        }
+        for (size_t i = 0; i < loads.size(); i++) {
+            y = std::make_shared<opset1::Multiply>(y, loads[i]);
+        }
+        auto store = std::make_shared<snippets::isa::Store>(y);
+
+        f = std::make_shared<Function>(NodeVector{store}, params);
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::AssignRegisters>(num_registers);
+        m.run_passes(f);
+    }
+
+    // instead of comparing to a reference function execute the assignment on the registers file
+    // and check that every operation reads the values it expects
+    {
+        auto get_register = [](const std::shared_ptr<Node>& op) -> size_t {
+            auto rinfo = op->get_rt_info()["reginfo"];
+            return ov::as_type_ptr<VariantWrapper<std::vector<size_t>>>(rinfo)->get()[0];
+        };
+        auto get_value = [](const std::shared_ptr<Node>& op) -> std::shared_ptr<Node> {
+            return ov::is_type<snippets::isa::Fill>(op) ? op->get_input_node_shared_ptr(0)->get_input_node_shared_ptr(0) : op;
+        };
+
+        std::map<size_t, std::shared_ptr<Node>> registers;
+        std::map<int64_t, std::shared_ptr<Node>> slots;
+        size_t spills = 0;
+        for (auto& op : f->get_ordered_ops()) {
+            if (ov::is_type<opset1::Parameter>(op) || ov::is_type<opset1::Result>(op)) {
+                continue;
+            }
+            if (ov::is_type<snippets::isa::Spill>(op)) {
+                auto slot = ov::as_type_ptr<VariantWrapper<int64_t>>(op->get_rt_info()["spillSlot"])->get();
+                auto value = op->get_input_node_shared_ptr(0);
+                ASSERT_EQ(registers[get_register(value)], value);
+                slots[slot] = value;
+                spills++;
+                continue;
+            }
+            if (ov::is_type<snippets::isa::Fill>(op)) {
+                auto spill = op->get_input_node_shared_ptr(0);
+                auto slot = ov::as_type_ptr<VariantWrapper<int64_t>>(spill->get_rt_info()["spillSlot"])->get();
+                ASSERT_EQ(slots[slot], get_value(op));
+            } else {
+                for (auto& input : op->inputs()) {
+                    auto parent = input.get_source_output().get_node_shared_ptr();
+                    if (!ov::is_type<opset1::Parameter>(parent)) {
+                        ASSERT_EQ(registers[get_register(parent)], get_value(parent));
+                    }
+                }
+            }
+            if (!ov::is_type<snippets::isa::Store>(op)) {
+                ASSERT_LT(get_register(op), num_registers);
+                registers[get_register(op)] = get_value(op);
+            }
+        }
+        ASSERT_GT(spills, 0);
+    }
+}
@@ -151,4 +151,159 @@ TEST(TransformationTests, DontAttachToSubgraphIfLoop) {
 
     auto res = compare_functions(f, f_ref);
     ASSERT_TRUE(res.first) << res.second;
-}
\ No newline at end of file
+}
+
+TEST(TransformationTests, AttachToSubgraphOutputsOfDifferentRank) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data0 = std::make_shared<opset1::Parameter>(element::f32, Shape{3});
+        auto data1 = std::make_shared<opset1::Parameter>(element::f32, Shape{3});
+        auto data2 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto indata0 = std::make_shared<opset1::Parameter>(element::f32, Shape{3});
+        auto indata1 = std::make_shared<opset1::Parameter>(element::f32, Shape{3});
+        auto add = std::make_shared<snippets::op::Subgraph>(NodeVector{data0, data1},
+            std::make_shared<Function>(NodeVector{std::make_shared<opset1::Add>(indata0, indata1)}, ParameterVector{indata0, indata1}));
+        auto mul = std::make_shared<opset1::Multiply>(add, data2);
+        auto concat0 = std::make_shared<opset1::Concat>(NodeVector{add, add}, 0);
+        auto concat1 = std::make_shared<opset1::Concat>(NodeVector{mul, mul}, 0);
+        f = std::make_shared<Function>(NodeVector{concat0, concat1}, ParameterVector{data0, data1, data2});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::AttachToSubgraph>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto data0 = std::make_shared<opset1::Parameter>(element::f32, Shape{3});
+        auto data1 = std::make_shared<opset1::Parameter>(element::f32, Shape{3});
+        auto data2 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto indata0 = std::make_shared<opset1::Parameter>(element::f32, Shape{3});
+        auto indata1 = std::make_shared<opset1::Parameter>(element::f32, Shape{3});
+        auto indata2 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto inner = std::make_shared<opset1::Add>(indata0, indata1);
+        auto subgraph = std::make_shared<snippets::op::Subgraph>(NodeVector{data0, data1, data2},
+            std::make_shared<Function>(NodeVector{inner, std::make_shared<opset1::Multiply>(inner, indata2)},
+                                       ParameterVector{indata0, indata1, indata2}));
+        auto concat0 = std::make_shared<opset1::Concat>(OutputVector{subgraph->output(0), subgraph->output(0)}, 0);
+        auto concat1 = std::make_shared<opset1::Concat>(OutputVector{subgraph->output(1), subgraph->output(1)}, 0);
+        f_ref = std::make_shared<Function>(NodeVector{concat0, concat1}, ParameterVector{data0, data1, data2});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, StartNewSubgraphIfInnermostOutputsBroadcast) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 1});
+        auto data1 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 1});
+        auto data2 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto indata0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 1});
+        auto indata1 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 1});
+        auto add = std::make_shared<snippets::op::Subgraph>(NodeVector{data0, data1},
+            std::make_shared<Function>(NodeVector{std::make_shared<opset1::Add>(indata0, indata1)}, ParameterVector{indata0, indata1}));
+        auto mul = std::make_shared<opset1::Multiply>(add, data2);
+        auto concat = std::make_shared<opset1::Concat>(NodeVector{add, mul}, 1);
+        f = std::make_shared<Function>(NodeVector{concat}, ParameterVector{data0, data1, data2});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::AttachToSubgraph>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto data0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 1});
+        auto data1 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 1});
+        auto data2 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto indata0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 1});
+        auto indata1 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 1});
+        auto add = std::make_shared<snippets::op::Subgraph>(NodeVector{data0, data1},
+            std::make_shared<Function>(NodeVector{std::make_shared<opset1::Add>(indata0, indata1)}, ParameterVector{indata0, indata1}));
+        auto inmul0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 1});
+        auto inmul1 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto mul = std::make_shared<snippets::op::Subgraph>(NodeVector{add, data2},
+            std::make_shared<Function>(NodeVector{std::make_shared<opset1::Multiply>(inmul0, inmul1)}, ParameterVector{inmul0, inmul1}));
+        auto concat = std::make_shared<opset1::Concat>(NodeVector{add, mul}, 1);
+        f_ref = std::make_shared<Function>(NodeVector{concat}, ParameterVector{data0, data1, data2});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, AttachLowPrecisionConvertToSubgraph) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto data1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 3});
+        auto indata0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto indata1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 3});
+        auto add = std::make_shared<snippets::op::Subgraph>(NodeVector{data0, data1},
+            std::make_shared<Function>(NodeVector{std::make_shared<opset1::Add>(indata0, indata1)}, ParameterVector{indata0, indata1}));
+        auto convert = std::make_shared<opset1::Convert>(add, element::u8);
+        auto concat = std::make_shared<opset1::Concat>(NodeVector{convert, convert}, 0);
+        f = std::make_shared<Function>(NodeVector{concat}, ParameterVector{data0, data1});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::AttachToSubgraph>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto data0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto data1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 3});
+        auto indata0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto indata1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 3});
+        auto inner = std::make_shared<opset1::Convert>(std::make_shared<opset1::Add>(indata0, indata1), element::u8);
+        auto subgraph = std::make_shared<snippets::op::Subgraph>(NodeVector{data0, data1},
+            std::make_shared<Function>(NodeVector{inner}, ParameterVector{indata0, indata1}));
+        auto concat = std::make_shared<opset1::Concat>(NodeVector{subgraph, subgraph}, 0);
+        f_ref = std::make_shared<Function>(NodeVector{concat}, ParameterVector{data0, data1});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, DontAttachIntegerConvertToSubgraph) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto data1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 3});
+        auto indata0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto indata1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 3});
+        auto add = std::make_shared<snippets::op::Subgraph>(NodeVector{data0, data1},
+            std::make_shared<Function>(NodeVector{std::make_shared<opset1::Add>(indata0, indata1)}, ParameterVector{indata0, indata1}));
+        auto convert = std::make_shared<opset1::Convert>(add, element::i32);
+        auto concat = std::make_shared<opset1::Concat>(NodeVector{convert, convert}, 0);
+        f = std::make_shared<Function>(NodeVector{concat}, ParameterVector{data0, data1});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::AttachToSubgraph>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto data0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto data1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 3});
+        auto indata0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto indata1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 3});
+        auto add = std::make_shared<snippets::op::Subgraph>(NodeVector{data0, data1},
+            std::make_shared<Function>(NodeVector{std::make_shared<opset1::Add>(indata0, indata1)}, ParameterVector{indata0, indata1}));
+        auto convert = std::make_shared<opset1::Convert>(add, element::i32);
+        auto concat = std::make_shared<opset1::Concat>(NodeVector{convert, convert}, 0);
+        f_ref = std::make_shared<Function>(NodeVector{concat}, ParameterVector{data0, data1});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
@@ -69,4 +69,45 @@ TEST(TransformationTests, ReplaceStoresWithScalarStores) {
 
     auto res = compare_functions(f, f_ref);
     ASSERT_TRUE(res.first) << res.second;
-}
\ No newline at end of file
+}
+
+TEST(TransformationTests, ReplaceReductionsWithScalarReductions) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 2});
+        auto load = std::make_shared<snippets::isa::Load>(data);
+        auto max = std::make_shared<snippets::op::ReduceMax>(load);
+        auto sum = std::make_shared<snippets::op::ReduceSum>(std::make_shared<opset1::Subtract>(load, max));
+        auto store = std::make_shared<snippets::isa::Store>(sum);
+        f = std::make_shared<Function>(NodeVector{store}, ParameterVector{data});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::ReplaceReductionsWithScalarReductions>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 2});
+        auto load = std::make_shared<snippets::isa::Load>(data);
+        auto max = std::make_shared<snippets::op::ScalarReduceMax>(load);
+        auto sum = std::make_shared<snippets::op::ScalarReduceSum>(std::make_shared<opset1::Subtract>(load, max));
+        auto store = std::make_shared<snippets::isa::Store>(sum);
+        f_ref = std::make_shared<Function>(NodeVector{store}, ParameterVector{data});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ScalarReductionsAreReductions) {
+    auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 2});
+    auto max = std::make_shared<snippets::op::ScalarReduceMax>(data);
+    auto sum = std::make_shared<snippets::op::ScalarReduceSum>(data);
+
+    ASSERT_TRUE(ov::is_type<snippets::op::ReduceMax>(max));
+    ASSERT_TRUE(ov::is_type<snippets::op::Reduce>(max));
+    ASSERT_FALSE(ov::is_type<snippets::op::ReduceSum>(max));
+    ASSERT_TRUE(ov::is_type<snippets::op::ReduceSum>(sum));
+    ASSERT_TRUE(ov::is_type<snippets::op::Reduce>(sum));
+}
@@ -8,6 +8,7 @@
 
 #include <ie_parallel.hpp>
 #include <threading/ie_cpu_streams_executor.hpp>
+#include <threading/ie_external_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
 #include <ie_system_conf.h>
 
@@ -188,6 +189,55 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
 
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
+TEST(ExternalStreamsExecutorTests, concurrentTasksUseDifferentStreams) {
+    constexpr int streams = 2;
+    auto host = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestHostExecutor", 4});
+    auto executor = std::make_shared<ExternalStreamsExecutor>(
+        IStreamsExecutor::Config{"TestExternalStreamsExecutor", streams}, host);
+    std::atomic_int busy[streams] = {{0}, {0}};
+    std::atomic_int violations = {0};
+    std::vector<Future> futures;
+    for (int i = 0; i < MAX_NUMBER_OF_TASKS_IN_QUEUE; i++) {
+        futures.emplace_back(async(executor, [&] {
+            auto streamId = executor->GetStreamId();
+            ASSERT_GE(streamId, 0);
+            ASSERT_LT(streamId, streams);
+            if (busy[streamId]++ != 0)
+                ++violations;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            --busy[streamId];
+        }));
+    }
+    for (auto&& f : futures) f.wait();
+    for (auto&& f : futures) ASSERT_NO_THROW(f.get());
+    ASSERT_EQ(0, violations);
+}
+
+TEST(CPUStreamsExecutorTests, urgentTaskGoesAheadOfQueuedTasks) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1});
+    std::promise<void> blocked, unblock;
+    auto unblocked = unblock.get_future().share();
+    executor->run([&blocked, unblocked] {
+        blocked.set_value();
+        unblocked.wait();
+    });
+    blocked.get_future().wait();
+    std::mutex mutex;
+    std::vector<int> order;
+    std::vector<std::future<void>> futures;
+    for (int priority : {0, 0, 1, -1, 0}) {
+        auto task = std::make_shared<std::packaged_task<void()>>([&, priority] {
+            std::lock_guard<std::mutex> lock{mutex};
+            order.push_back(priority);
+        });
+        futures.emplace_back(task->get_future());
+        executor->runWithPriority([task] { (*task)(); }, priority);
+    }
+    unblock.set_value();
+    for (auto&& f : futures) f.wait();
+    ASSERT_EQ((std::vector<int>{1, 0, 0, 0, -1}), order);
+}
+
 TEST_F(StreamsExecutorConfigTest, streamsExecutorConfigReturnStrings) {
     auto streams = getNumberOfCPUCores();
     auto threads = parallel_get_max_threads();
@@ -217,8 +267,32 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        auto streams = getNumberOfLogicalCPUCores(false);
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+        config._workStealing = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
+    [] {
+        auto streams = getNumberOfLogicalCPUCores(false);
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams, threads/streams, IStreamsExecutor::ThreadBindingType::CACHE_AWARE};
+        config._threadBindingSmt = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
+    },
+    [] {
+        return std::make_shared<ExternalStreamsExecutor>(IStreamsExecutor::Config{"TestExternalStreamsExecutor", 2});
+    },
+    [] {
+        auto host = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestHostExecutor", 4});
+        return std::make_shared<ExternalStreamsExecutor>(IStreamsExecutor::Config{"TestExternalStreamsExecutor", 2},
+                                                         host);
     }
 );
 
@@ -242,6 +316,23 @@ static auto AsyncExecutors = ::testing::Values(
         auto threads = parallel_get_max_threads();
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
+    },
+    [] {
+        auto streams = getNumberOfLogicalCPUCores(false);
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+        config._workStealing = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
+    [] {
+        auto streams = getNumberOfLogicalCPUCores(false);
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams, threads/streams, IStreamsExecutor::ThreadBindingType::HYBRID_AWARE};
+        config._threadPreferredCoreType = IStreamsExecutor::Config::PreferredCoreType::ROUND_ROBIN;
+        config._littleCoreThreadsPerStream = 1;
+        return std::make_shared<CPUStreamsExecutor>(config);
     }
 );
 
@@ -0,0 +1,112 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <transformations/common_optimizations/common_subexpression_elimination.hpp>
+#include <transformations/init_node_info.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ngraph;
+
+namespace {
+std::shared_ptr<Node> create_block(const Output<Node>& input, float bias, int64_t softmax_axis) {
+    auto bias_const = opset6::Constant::create(element::f32, Shape{1, 3, 1, 1}, {bias});
+    auto add = std::make_shared<opset6::Add>(input, bias_const);
+    auto relu = std::make_shared<opset6::Relu>(add);
+    return std::make_shared<opset6::Softmax>(relu, softmax_axis);
+}
+
+void run_cse(std::shared_ptr<Function>& f) {
+    pass::Manager manager;
+    manager.register_pass<pass::InitNodeInfo>();
+    manager.register_pass<pass::CommonSubexpressionElimination>();
+    manager.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+}
+}  // namespace
+
+TEST(TransformationTests, CommonSubexpressionEliminationMergesRepeatedBlocks) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<opset6::Parameter>(element::f32, Shape{1, 3, 16, 16});
+        auto block1 = create_block(input, 1.f, 1);
+        auto block2 = create_block(input, 1.f, 1);
+        auto block3 = create_block(input, 1.f, 1);
+        auto concat = std::make_shared<opset6::Concat>(OutputVector{block1, block2, block3}, 1);
+
+        f = std::make_shared<Function>(NodeVector{concat}, ParameterVector{input});
+        run_cse(f);
+    }
+
+    {
+        auto input = std::make_shared<opset6::Parameter>(element::f32, Shape{1, 3, 16, 16});
+        auto block = create_block(input, 1.f, 1);
+        auto concat = std::make_shared<opset6::Concat>(OutputVector{block, block, block}, 1);
+
+        f_ref = std::make_shared<Function>(NodeVector{concat}, ParameterVector{input});
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+    ASSERT_EQ(7, f->get_ops().size());
+}
+
+TEST(TransformationTests, CommonSubexpressionEliminationKeepsDifferentNodes) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    auto create_function = [] {
+        auto input = std::make_shared<opset6::Parameter>(element::f32, Shape{1, 3, 16, 16});
+        auto block = create_block(input, 1.f, 1);
+        // different constant content
+        auto other_bias = create_block(input, 2.f, 1);
+        // different attribute
+        auto other_axis = create_block(input, 1.f, 2);
+        auto concat = std::make_shared<opset6::Concat>(OutputVector{block, other_bias, other_axis}, 1);
+        return std::make_shared<Function>(NodeVector{concat}, ParameterVector{input});
+    };
+    f = create_function();
+    run_cse(f);
+
+    {
+        auto input = std::make_shared<opset6::Parameter>(element::f32, Shape{1, 3, 16, 16});
+        auto bias = opset6::Constant::create(element::f32, Shape{1, 3, 1, 1}, {1.f});
+        auto relu = std::make_shared<opset6::Relu>(std::make_shared<opset6::Add>(input, bias));
+        auto block = std::make_shared<opset6::Softmax>(relu, 1);
+        auto other_bias = create_block(input, 2.f, 1);
+        auto other_axis = std::make_shared<opset6::Softmax>(relu, 2);
+        auto concat = std::make_shared<opset6::Concat>(OutputVector{block, other_bias, other_axis}, 1);
+
+        f_ref = std::make_shared<Function>(NodeVector{concat}, ParameterVector{input});
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, CommonSubexpressionEliminationKeepsFunctionOutputs) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    auto create_function = [] {
+        auto input = std::make_shared<opset6::Parameter>(element::f32, Shape{1, 3, 16, 16});
+        auto relu1 = std::make_shared<opset6::Relu>(input);
+        relu1->set_friendly_name("relu1");
+        auto relu2 = std::make_shared<opset6::Relu>(input);
+        relu2->set_friendly_name("relu2");
+        return std::make_shared<Function>(NodeVector{relu1, relu2}, ParameterVector{input});
+    };
+    f = create_function();
+    f_ref = create_function();
+    run_cse(f);
+
+    const FunctionsComparator func_comparator = FunctionsComparator::with_default().enable(FunctionsComparator::NAMES);
+    const FunctionsComparator::Result res = func_comparator(f, f_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+}
@@ -0,0 +1,116 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/pass/constant_folding.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <transformations/common_optimizations/matmul_weights_decompression.hpp>
+#include <transformations/init_node_info.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+
+TEST(TransformationTests, MatMulWeightsDecompressionTransposedWeights) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16});
+        auto weights = ngraph::opset8::Constant::create(ngraph::element::i8, ngraph::Shape{4, 16}, {3});
+        auto convert = std::make_shared<ngraph::opset8::Convert>(weights, ngraph::element::f32);
+        auto scale = ngraph::opset8::Constant::create(ngraph::element::f32, ngraph::Shape{4, 1}, {0.1, 0.2, 0.3, 0.4});
+        auto multiply = std::make_shared<ngraph::opset8::Multiply>(convert, scale);
+        auto matmul = std::make_shared<ngraph::opset8::MatMul>(input, multiply, false, true);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul}, ngraph::ParameterVector{input});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::MatMulWeightsDecompression>();
+        manager.register_pass<ngraph::pass::ConstantFolding>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16});
+        auto weights = ngraph::opset8::Constant::create(ngraph::element::i8, ngraph::Shape{4, 16}, {3});
+        auto convert = std::make_shared<ngraph::opset8::Convert>(weights, ngraph::element::f32);
+        auto matmul = std::make_shared<ngraph::opset8::MatMul>(input, convert, false, true);
+        auto scale = ngraph::opset8::Constant::create(ngraph::element::f32, ngraph::Shape{4}, {0.1, 0.2, 0.3, 0.4});
+        auto multiply = std::make_shared<ngraph::opset8::Multiply>(matmul, scale);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{multiply}, ngraph::ParameterVector{input});
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, MatMulWeightsDecompressionWeights) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, ngraph::Shape{2, 3, 16});
+        auto weights = ngraph::opset8::Constant::create(ngraph::element::u8, ngraph::Shape{16, 4}, {3});
+        auto convert = std::make_shared<ngraph::opset8::Convert>(weights, ngraph::element::f32);
+        auto scale = ngraph::opset8::Constant::create(ngraph::element::f32, ngraph::Shape{4}, {0.1, 0.2, 0.3, 0.4});
+        auto multiply = std::make_shared<ngraph::opset8::Multiply>(convert, scale);
+        auto matmul = std::make_shared<ngraph::opset8::MatMul>(input, multiply);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul}, ngraph::ParameterVector{input});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::MatMulWeightsDecompression>();
+        manager.register_pass<ngraph::pass::ConstantFolding>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, ngraph::Shape{2, 3, 16});
+        auto weights = ngraph::opset8::Constant::create(ngraph::element::u8, ngraph::Shape{16, 4}, {3});
+        auto convert = std::make_shared<ngraph::opset8::Convert>(weights, ngraph::element::f32);
+        auto matmul = std::make_shared<ngraph::opset8::MatMul>(input, convert);
+        auto scale = ngraph::opset8::Constant::create(ngraph::element::f32, ngraph::Shape{4}, {0.1, 0.2, 0.3, 0.4});
+        auto multiply = std::make_shared<ngraph::opset8::Multiply>(matmul, scale);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{multiply}, ngraph::ParameterVector{input});
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, MatMulWeightsDecompressionNegativeScalePerInputChannel) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto create_function = []() {
+        auto input = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, ngraph::Shape{1, 4});
+        auto weights = ngraph::opset8::Constant::create(ngraph::element::i8, ngraph::Shape{2, 4}, {3});
+        auto convert = std::make_shared<ngraph::opset8::Convert>(weights, ngraph::element::f32);
+        auto scale = ngraph::opset8::Constant::create(ngraph::element::f32, ngraph::Shape{1, 4}, {0.1, 0.2, 0.3, 0.4});
+        auto multiply = std::make_shared<ngraph::opset8::Multiply>(convert, scale);
+        auto matmul = std::make_shared<ngraph::opset8::MatMul>(input, multiply, false, true);
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul}, ngraph::ParameterVector{input});
+    };
+    {
+        f = create_function();
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::MatMulWeightsDecompression>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    f_ref = create_function();
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
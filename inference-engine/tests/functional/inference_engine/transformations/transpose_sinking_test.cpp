@@ -272,3 +272,199 @@ TEST(TransformationTests, TransposeFuses) {
     const FunctionsComparator::Result res = func_comparator(f, f_ref);
     ASSERT_TRUE(res.valid) << res.message;
 }
+
+TEST(TransformationTests, TransposeEltwiseBroadcastsConstant) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(input, order);
+        auto add_const = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 3 }, { 1, 2, 3 });
+        auto add = std::make_shared<ngraph::opset6::Add>(transpose, add_const);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ add }, ngraph::ParameterVector{ input });
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::TransposeEltwise>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+        auto add_const = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 3, 1, 1 }, { 1, 2, 3 });
+        auto add = std::make_shared<ngraph::opset6::Add>(input, add_const);
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(add, order);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ transpose }, ngraph::ParameterVector{ input });
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, TransposeEltwiseKeepsTransposeOfNonConstantInput) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto create_function = [] {
+        auto input1 = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+        auto input2 = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16, 16, 3 });
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(input1, order);
+        auto add = std::make_shared<ngraph::opset6::Add>(transpose, input2);
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{ add }, ngraph::ParameterVector{ input1, input2 });
+    };
+    f = create_function();
+    f_ref = create_function();
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.register_pass<ngraph::pass::TransposeSinking>();
+    manager.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, TransposeSinkingCancelsLayoutTransposes) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+        auto to_nhwc = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose1 = std::make_shared<ngraph::opset6::Transpose>(input, to_nhwc);
+        auto relu = std::make_shared<ngraph::opset6::Relu>(transpose1);
+        auto mul_const = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 3 }, { 1, 2, 3 });
+        auto mul = std::make_shared<ngraph::opset6::Multiply>(relu, mul_const);
+        auto to_nchw = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose2 = std::make_shared<ngraph::opset6::Transpose>(mul, to_nchw);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ transpose2 }, ngraph::ParameterVector{ input });
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::TransposeSinking>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+        auto relu = std::make_shared<ngraph::opset6::Relu>(input);
+        auto mul_const = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 3, 1, 1 }, { 1, 2, 3 });
+        auto mul = std::make_shared<ngraph::opset6::Multiply>(relu, mul_const);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ mul }, ngraph::ParameterVector{ input });
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, TransposeConcatMergesTransposes) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input1 = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+        auto input2 = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 5, 16, 16 });
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose1 = std::make_shared<ngraph::opset6::Transpose>(input1, order);
+        auto transpose2 = std::make_shared<ngraph::opset6::Transpose>(input2, order);
+        auto concat = std::make_shared<ngraph::opset6::Concat>(ngraph::OutputVector{ transpose1, transpose2 }, -1);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ concat }, ngraph::ParameterVector{ input1, input2 });
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::TransposeConcat>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input1 = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+        auto input2 = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 5, 16, 16 });
+        auto concat = std::make_shared<ngraph::opset6::Concat>(ngraph::OutputVector{ input1, input2 }, 1);
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(concat, order);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ transpose }, ngraph::ParameterVector{ input1, input2 });
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, TransposeSplitCancelsOutputTransposes) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 4, 16, 16 });
+        auto to_nhwc = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(input, to_nhwc);
+        auto axis = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{}, { 3 });
+        auto split = std::make_shared<ngraph::opset6::Split>(transpose, axis, 2);
+        auto to_nchw = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose1 = std::make_shared<ngraph::opset6::Transpose>(split->output(0), to_nchw);
+        auto transpose2 = std::make_shared<ngraph::opset6::Transpose>(split->output(1), to_nchw);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ transpose1, transpose2 }, ngraph::ParameterVector{ input });
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::TransposeSinking>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 4, 16, 16 });
+        auto axis = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{}, { 1 });
+        auto split = std::make_shared<ngraph::opset6::Split>(input, axis, 2);
+
+        f_ref = std::make_shared<ngraph::Function>(split->outputs(), ngraph::ParameterVector{ input });
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, TransposeInterpolateRemapsAxes) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    ngraph::op::v4::Interpolate::InterpolateAttrs attrs;
+    attrs.mode = ngraph::op::v4::Interpolate::InterpolateMode::nearest;
+    attrs.shape_calculation_mode = ngraph::op::v4::Interpolate::ShapeCalcMode::sizes;
+    attrs.pads_begin = { 0, 0, 0, 0 };
+    attrs.pads_end = { 0, 0, 0, 0 };
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(input, order);
+        auto sizes = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 8, 8 });
+        auto scales = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 2 }, { 0.5f, 0.5f });
+        auto axes = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 1, 2 });
+        auto interpolate = std::make_shared<ngraph::opset6::Interpolate>(transpose, sizes, scales, axes, attrs);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ interpolate }, ngraph::ParameterVector{ input });
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::TransposeInterpolate>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 16 });
+        auto sizes = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 8, 8 });
+        auto scales = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 2 }, { 0.5f, 0.5f });
+        auto axes = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 2, 3 });
+        auto interpolate = std::make_shared<ngraph::opset6::Interpolate>(input, sizes, scales, axes, attrs);
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(interpolate, order);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ transpose }, ngraph::ParameterVector{ input });
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
@@ -0,0 +1,145 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <fstream>
+#include <string>
+
+#include "ie_core.hpp"
+#include "ie_transformations_cache.hpp"
+#include "ie_ngraph_utils.hpp"
+#include "ngraph/opsets/opset6.hpp"
+
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_icore.hpp"
+
+using namespace InferenceEngine;
+using namespace ::testing;
+
+class TransformationsCacheTest : public Test {
+protected:
+    std::string m_cacheDir;
+    Core m_ie;
+    NiceMock<MockICore> m_core;
+    int m_transformCount = 0;
+
+    void SetUp() override {
+        m_cacheDir = "transformationsCacheTest";
+        CommonTestUtils::createDirectory(m_cacheDir);
+        ON_CALL(m_core, ReadNetwork(_, An<const Blob::CPtr&>()))
+            .WillByDefault(Invoke([&](const std::string& model, const Blob::CPtr& weights) {
+                return m_ie.ReadNetwork(model, weights);
+            }));
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "blob");
+        CommonTestUtils::removeDir(m_cacheDir);
+    }
+
+    static CNNNetwork createNetwork() {
+        auto param = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 4, 4});
+        param->set_friendly_name("input");
+        auto constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {2.f});
+        auto multiply = std::make_shared<ngraph::opset6::Multiply>(param, constant);
+        auto relu = std::make_shared<ngraph::opset6::Relu>(multiply);
+        relu->set_friendly_name("relu");
+        auto result = std::make_shared<ngraph::opset6::Result>(relu);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+    }
+
+    // replaces Relu with Clamp, so the cached result is distinguishable from the original network
+    TransformationsCache::Transform transform() {
+        return [&](const CNNNetwork& network) {
+            m_transformCount++;
+            auto cloned = details::cloneNetwork(network);
+            for (const auto& op : cloned.getFunction()->get_ops()) {
+                if (auto relu = std::dynamic_pointer_cast<ngraph::opset6::Relu>(op)) {
+                    auto clamp = std::make_shared<ngraph::opset6::Clamp>(relu->input_value(0), 0., 6.);
+                    clamp->set_friendly_name(relu->get_friendly_name());
+                    ngraph::replace_node(relu, clamp);
+                }
+            }
+            return cloned;
+        };
+    }
+
+    static bool hasClamp(const CNNNetwork& network) {
+        for (const auto& op : network.getFunction()->get_ops()) {
+            if (std::dynamic_pointer_cast<ngraph::opset6::Clamp>(op))
+                return true;
+        }
+        return false;
+    }
+};
+
+TEST_F(TransformationsCacheTest, transformedNetworkIsReadFromCache) {
+    TransformationsCache cache(m_cacheDir, "1");
+    auto network = createNetwork();
+    EXPECT_CALL(m_core, ReadNetwork(_, An<const Blob::CPtr&>())).Times(1);
+
+    auto first = cache.getOrTransform(network, {}, m_core, transform());
+    auto second = cache.getOrTransform(network, {}, m_core, transform());
+
+    EXPECT_EQ(1, m_transformCount);
+    EXPECT_EQ(1, CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size());
+    ASSERT_TRUE(hasClamp(second));
+    auto res = compare_functions(first.getFunction(), second.getFunction(), true);
+    EXPECT_TRUE(res.first) << res.second;
+}
+
+TEST_F(TransformationsCacheTest, pipelineVersionAndOptionsChangeTheEntry) {
+    auto network = createNetwork();
+    TransformationsCache(m_cacheDir, "1").getOrTransform(network, {}, m_core, transform());
+    TransformationsCache(m_cacheDir, "2").getOrTransform(network, {}, m_core, transform());
+    TransformationsCache(m_cacheDir, "2").getOrTransform(network, {{"KEY", "VALUE"}}, m_core, transform());
+
+    EXPECT_EQ(3, m_transformCount);
+    EXPECT_EQ(3, CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size());
+}
+
+TEST_F(TransformationsCacheTest, userSettingsAreRestored) {
+    TransformationsCache cache(m_cacheDir, "1");
+    auto network = createNetwork();
+    cache.getOrTransform(network, {}, m_core, transform());
+
+    network.getInputsInfo().begin()->second->setPrecision(Precision::U8);
+    network.getInputsInfo().begin()->second->setLayout(Layout::NHWC);
+    network.getOutputsInfo().begin()->second->setPrecision(Precision::FP16);
+    auto cached = cache.getOrTransform(network, {}, m_core, transform());
+
+    // the user settings are not a part of the serialized function, so the entry is reused
+    EXPECT_EQ(1, m_transformCount);
+    EXPECT_EQ(Precision::U8, cached.getInputsInfo().begin()->second->getPrecision());
+    EXPECT_EQ(Layout::NHWC, cached.getInputsInfo().begin()->second->getLayout());
+    EXPECT_EQ(Precision::FP16, cached.getOutputsInfo().begin()->second->getPrecision());
+}
+
+TEST_F(TransformationsCacheTest, brokenEntryIsTransformedAgain) {
+    TransformationsCache cache(m_cacheDir, "1");
+    auto network = createNetwork();
+    cache.getOrTransform(network, {}, m_core, transform());
+
+    const auto entry = CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").front();
+    { std::ofstream(entry, std::ios::binary | std::ios::trunc) << "garbage"; }
+    auto transformed = cache.getOrTransform(network, {}, m_core, transform());
+
+    EXPECT_EQ(2, m_transformCount);
+    EXPECT_TRUE(hasClamp(transformed));
+}
+
+TEST_F(TransformationsCacheTest, emptyCacheDirDisablesCache) {
+    TransformationsCache cache("", "1");
+    ASSERT_FALSE(cache.isEnabled());
+    auto network = createNetwork();
+    EXPECT_CALL(m_core, ReadNetwork(_, An<const Blob::CPtr&>())).Times(0);
+
+    cache.getOrTransform(network, {}, m_core, transform());
+    cache.getOrTransform(network, {}, m_core, transform());
+
+    EXPECT_EQ(2, m_transformCount);
+}
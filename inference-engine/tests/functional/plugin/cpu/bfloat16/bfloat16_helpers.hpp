@@ -143,6 +143,7 @@ public:
     InferenceEngine::SizeVector inputShapes, newInputShapes;
     InferenceEngine::Precision inputPrecision, netPrecision;
     std::map<std::string, std::string> expectedPrecisions;
+    std::map<std::string, std::string> additionalConfig;  // plugin config applied on top of the BF16 enforcement
     float threshold = 2e-2f;  // Is enough for tensor having abs maximum values less than 1
 
     static std::string getTestCaseName(testing::TestParamInfo<basicParams> obj) {
@@ -199,6 +200,7 @@ public:
             options[InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16] = InferenceEngine::PluginConfigParams::NO;
         }
         options[InferenceEngine::PluginConfigParams::KEY_PERF_COUNT] = InferenceEngine::PluginConfigParams::YES;
+        options.insert(additionalConfig.begin(), additionalConfig.end());
 
         auto exec_net1 = ie.LoadNetwork(cnnNet, targetDevice, options);
         auto req1 = exec_net1.CreateInferRequest();
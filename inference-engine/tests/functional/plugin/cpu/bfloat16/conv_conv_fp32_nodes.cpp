@@ -0,0 +1,97 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "bfloat16_helpers.hpp"
+
+#include <memory>
+#include <tuple>
+#include <vector>
+#include <string>
+#include <map>
+
+#include <ie_core.hpp>
+#include <cpu/cpu_config.hpp>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "common_test_utils/common_utils.hpp"
+
+#include "ngraph/opsets/opset1.hpp"
+
+using namespace std;
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace LayerTestsDefinitions {
+
+class ConvConvFP32Nodes : public BasicBF16Test {
+protected:
+    std::shared_ptr<ngraph::Function> createGraph(InferenceEngine::Precision netPrecision) override {
+        //     ScaleShift (FP32)
+        //          |
+        //        Conv (BF16)
+        //          |
+        //        Conv (FP32, listed in KEY_CPU_BF16_FP32_NODES)
+
+        auto input1 = std::make_shared<opset1::Parameter>(ngraph::element::f32, ngraph::Shape{inputShapes});
+        auto const1 = opset1::Constant::create(ngraph::element::f32, Shape{1}, { 2.0f });
+        auto mulNode = std::make_shared<opset1::Multiply>(input1, const1);
+        auto const2 = opset1::Constant::create(ngraph::element::f32, Shape{1}, { 1.0f });
+        auto addNode = std::make_shared<opset1::Add>(mulNode, const2);
+        addNode->set_friendly_name("ADD_1");
+
+        auto channelsCount = inputShapes[1];
+        ngraph::Shape convFilterShape = { channelsCount, channelsCount, 3, 3 };  // out channel, /input channels, kernel h, kernel w
+        std::vector<float> weightValues(channelsCount * channelsCount * 3 * 3);
+        FuncTestUtils::fillInputsBySinValues(weightValues.data(), weightValues.size());
+
+        auto weightsNode1 = std::make_shared<ngraph::opset1::Constant>(ngraph::element::f32, convFilterShape, weightValues);
+        std::shared_ptr<ngraph::Node> convNode1 = std::make_shared<ngraph::opset1::Convolution>(
+            addNode, weightsNode1,
+            ngraph::Strides({ 1, 1 }),   // strides
+            ngraph::CoordinateDiff({ 1, 1 }),  // pad begin
+            ngraph::CoordinateDiff({ 1, 1 }),   // pad end
+            ngraph::Strides({ 1, 1 }),        // dilation
+            ngraph::op::PadType::EXPLICIT);   // pad type
+        convNode1->set_friendly_name("CONV_1");
+
+        auto weightsNode2 = std::make_shared<ngraph::opset1::Constant>(ngraph::element::f32, convFilterShape, weightValues);
+        std::shared_ptr<ngraph::Node> convNode2 = std::make_shared<ngraph::opset1::Convolution>(
+            convNode1, weightsNode2,
+            ngraph::Strides({ 1, 1 }),   // strides
+            ngraph::CoordinateDiff({ 0, 0 }),  // pad begin
+            ngraph::CoordinateDiff({ 0, 0 }),   // pad end
+            ngraph::Strides({ 1, 1 }),        // dilation
+            ngraph::op::PadType::EXPLICIT);   // pad type
+        convNode2->set_friendly_name("CONV_2");
+
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{convNode2}, ngraph::ParameterVector{input1});
+    }
+    void SetUp() override {
+        std::tie(inputPrecision, netPrecision, inputShapes, newInputShapes, targetDevice) = this->GetParam();
+        fnPtr = createGraph(netPrecision);
+        additionalConfig[CPUConfigParams::KEY_CPU_BF16_FP32_NODES] = "CONV_2";
+
+        threshold = 1.0f;
+        expectedPrecisions["ADD_1"] = "ndef";
+        expectedPrecisions["CONV_1"] = "BF16";
+        expectedPrecisions["CONV_2"] = "FP32";
+    }
+};
+
+TEST_P(ConvConvFP32Nodes, CompareWithRefImpl) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    test();
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FP32_bfloat16_NoReshape, ConvConvFP32Nodes,
+                        ::testing::Combine(
+                        ::testing::Values(Precision::FP32),
+                        ::testing::Values(Precision::FP32),
+                        ::testing::Values(SizeVector({ 1, 3, 40, 40 })),
+                        ::testing::Values(SizeVector()),
+                        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        ConvConvFP32Nodes::getTestCaseName);
+
+}  // namespace LayerTestsDefinitions
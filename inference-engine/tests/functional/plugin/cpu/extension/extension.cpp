@@ -3,7 +3,10 @@
 //
 
 #include <gtest/gtest.h>
+#include <functional>
+#include <numeric>
 #include <ie_core.hpp>
+#include <cpu/cpu_kernel_extension.hpp>
 #include <ngraph/ngraph.hpp>
 #include <onnx_import/onnx_utils.hpp>
 #include <file_utils.h>
@@ -75,6 +78,44 @@ private:
     const std::shared_ptr<ngraph::Node> node;
 };
 
+class CustomAbsRawKernel : public InferenceEngine::ICPUKernelImpl {
+public:
+    explicit CustomAbsRawKernel(const std::shared_ptr<ngraph::Node>& node): absKernel(node) {}
+
+    InferenceEngine::StatusCode
+    init(InferenceEngine::LayerConfig& config, InferenceEngine::ResponseDesc* resp) noexcept override {
+        return absKernel.init(config, resp);
+    }
+
+    InferenceEngine::StatusCode getSupportedConfigurations(std::vector<InferenceEngine::LayerConfig>& conf,
+                                                            InferenceEngine::ResponseDesc* resp) noexcept override {
+        return absKernel.getSupportedConfigurations(conf, resp);
+    }
+
+    InferenceEngine::StatusCode
+    executeKernel(const std::vector<InferenceEngine::CPUKernelTensor>& inputs,
+                  const std::vector<InferenceEngine::CPUKernelTensor>& outputs,
+                  const InferenceEngine::ICPUExecutionContext& context,
+                  InferenceEngine::ResponseDesc* /*resp*/) noexcept override {
+        if (context.getNumThreads() < 1)
+            return InferenceEngine::StatusCode::GENERAL_ERROR;
+        for (size_t i = 0; i < inputs.size(); i++) {
+            const auto* inputData = static_cast<const float*>(inputs[i].data);
+            auto* outputData = static_cast<float*>(outputs[i].data);
+            const size_t size = std::accumulate(inputs[i].dims.begin(), inputs[i].dims.end(), size_t(1), std::multiplies<size_t>());
+            context.parallelFor(size, [&](size_t begin, size_t end) {
+                for (size_t j = begin; j < end; j++) {
+                    outputData[j] = inputData[j] < 0 ? (-inputData[j] * 2) : inputData[j];
+                }
+            });
+        }
+        return InferenceEngine::StatusCode::OK;
+    }
+
+private:
+    CustomAbsKernel absKernel;
+};
+
 class CustomAbs : public ngraph::op::Op {
 public:
     static constexpr ngraph::NodeTypeInfo type_info{"CustomAbs", 100500};
@@ -261,6 +302,60 @@ TEST(Extension, XmlModelWithCustomAbs) {
 }
 
 
+class CustomAbsRawExtension : public CustomAbsExtension {
+public:
+    InferenceEngine::ILayerImpl::Ptr getImplementation(const std::shared_ptr<ngraph::Node>& node, const std::string& implType) override {
+        return std::make_shared<CustomAbsRawKernel>(node);
+    }
+};
+
+TEST(Extension, XmlModelWithCustomAbsRawKernel) {
+    std::string model = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer name="in1" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="10"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="activation" id="1" type="CustomAbs" version="custom_opset">
+            <input>
+                <port id="1" precision="FP32">
+                    <dim>10</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="2" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>10</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::vector<float> input_values{1, -2, 3, -4, 5, -6, 7, -8, 9, -10};
+    std::vector<float> expected{1, 4, 3, 8, 5, 12, 7, 16, 9, 20};
+    InferenceEngine::Core ie;
+    ie.AddExtension(std::make_shared<CustomAbsRawExtension>());
+    infer_model(ie, model, input_values, expected);
+}
+
+
 static std::string get_extension_path() {
     return FileUtils::makePluginLibraryName<char>({}, std::string("template_extension") + IE_BUILD_POSTFIX);
 }
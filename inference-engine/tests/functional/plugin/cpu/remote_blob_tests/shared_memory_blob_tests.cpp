@@ -0,0 +1,84 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <string>
+#include <memory>
+
+#include <cpu/cpu_params.hpp>
+#include <common_test_utils/test_common.hpp>
+#include <common_test_utils/test_constants.hpp>
+
+#include "ngraph_functions/subgraph_builders.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class SharedMemoryBlob_Test : public CommonTestUtils::TestsCommon {
+protected:
+    std::shared_ptr<ngraph::Function> fn_ptr;
+
+    void SetUp() override {
+#ifndef __linux__
+        GTEST_SKIP();
+#endif
+        fn_ptr = ngraph::builder::subgraph::makeSplitMultiConvConcat();
+    }
+};
+
+TEST_F(SharedMemoryBlob_Test, smoke_blobsShareMemoryByDescriptor) {
+    auto ie = InferenceEngine::Core();
+    auto context = ie.CreateContext(CommonTestUtils::DEVICE_CPU, {});
+    ASSERT_EQ(context->getParams().at(CPU_PARAM_KEY(CONTEXT_TYPE)).as<std::string>(), CPU_PARAM_VALUE(SHARED_MEMORY));
+
+    TensorDesc desc(Precision::FP32, {1, 4, 8, 8}, Layout::NCHW);
+    auto blob = context->CreateBlob(desc);
+    const int fd = blob->getParams().at(CPU_PARAM_KEY(SHARED_MEM_FD)).as<int>();
+    // the same way the receiving process maps the memory by the passed descriptor
+    auto imported = context->CreateBlob(desc, {{CPU_PARAM_KEY(SHARED_MEM_FD), fd}});
+
+    auto data = blob->buffer().as<float*>();
+    for (size_t i = 0; i < blob->size(); i++)
+        data[i] = static_cast<float>(i);
+    auto importedData = imported->cbuffer().as<const float*>();
+    ASSERT_NE(data, importedData);
+    for (size_t i = 0; i < blob->size(); i++)
+        ASSERT_EQ(importedData[i], static_cast<float>(i));
+
+    TensorDesc biggerDesc(Precision::FP32, {2, 4, 8, 8}, Layout::NCHW);
+    ASSERT_THROW(context->CreateBlob(biggerDesc, {{CPU_PARAM_KEY(SHARED_MEM_FD), fd}}), Exception);
+}
+
+TEST_F(SharedMemoryBlob_Test, smoke_canInferOnSharedMemoryBlobs) {
+    CNNNetwork net(fn_ptr);
+    auto ie = InferenceEngine::Core();
+    auto exec_net = ie.LoadNetwork(net, CommonTestUtils::DEVICE_CPU);
+    const auto& inputInfo = *exec_net.GetInputsInfo().begin();
+    const auto& outputInfo = *exec_net.GetOutputsInfo().begin();
+
+    // regular inference
+    auto inf_req_regular = exec_net.CreateInferRequest();
+    auto fakeImageData = FuncTestUtils::createAndFillBlob(inputInfo.second->getTensorDesc());
+    inf_req_regular.SetBlob(inputInfo.first, fakeImageData);
+    inf_req_regular.Infer();
+    auto outputBlob_regular = inf_req_regular.GetBlob(outputInfo.first);
+
+    // inference on the shared memory, the input is written through the re-imported blob
+    auto context = ie.GetDefaultContext(CommonTestUtils::DEVICE_CPU);
+    auto input = context->CreateBlob(inputInfo.second->getTensorDesc());
+    const auto fd = input->getParams().at(CPU_PARAM_KEY(SHARED_MEM_FD));
+    auto inputView = context->CreateBlob(inputInfo.second->getTensorDesc(), {{CPU_PARAM_KEY(SHARED_MEM_FD), fd}});
+    std::copy_n(fakeImageData->cbuffer().as<const uint8_t*>(), fakeImageData->byteSize(),
+                inputView->buffer().as<uint8_t*>());
+    auto output = context->CreateBlob(outputInfo.second->getTensorDesc());
+
+    auto inf_req_shared = exec_net.CreateInferRequest();
+    inf_req_shared.SetBlob(inputInfo.first, input);
+    inf_req_shared.SetBlob(outputInfo.first, output);
+    inf_req_shared.Infer();
+
+    auto thr = FuncTestUtils::GetComparisonThreshold(InferenceEngine::Precision::FP32);
+    FuncTestUtils::compareBlobs(outputBlob_regular, output, thr);
+}
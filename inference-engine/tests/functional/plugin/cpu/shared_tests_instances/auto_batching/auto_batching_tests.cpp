@@ -0,0 +1,16 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "auto_batching/auto_batching_tests.hpp"
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test,
+        ::testing::Combine(
+                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                ::testing::Bool(),
+                ::testing::Values(1, 2, 4)),
+        AutoBatching_Test::getTestCaseName);
+
+}  // namespace
@@ -3,6 +3,7 @@
 //
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "behavior/config.hpp"
 
 using namespace BehaviorTestsDefinitions;
@@ -27,7 +28,22 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "8"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::CACHE_AWARE}},
             {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_WEIGHTS_CACHE_DIR, ""}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_TUNING_CACHE_FILE, ""}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_NUMA_WEIGHTS_REPLICATION, InferenceEngine::PluginConfigParams::NO}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_MEMORY_SOLVER, InferenceEngine::CPUConfigParams::CPU_MEMORY_SOLVER_BEST_FIT}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY, "0"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY, "100"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_FUSION_COST_MODEL, InferenceEngine::CPUConfigParams::CPU_FUSION_COST_MODEL_ANALYTIC}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_SHARED_STREAMS, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_PERF_COUNT_SAMPLING, "100"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_SHAPE_BUCKETS, ""}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_BRANCH_PARALLELISM, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_BF16_FP32_NODES, "Softmax,MVN"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_RATE, "0.8"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_HUGE_PAGES, InferenceEngine::CPUConfigParams::CPU_HUGE_PAGES_TRANSPARENT}},
             // check that hints doesn't override customer value (now for streams and later for other config opts)
             {{InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT, InferenceEngine::PluginConfigParams::THROUGHPUT},
              {InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "3"}},
@@ -42,7 +58,13 @@ namespace {
                 {InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT, InferenceEngine::PluginConfigParams::LATENCY}},
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
                 {InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT, InferenceEngine::PluginConfigParams::LATENCY},
-                    {InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS, "1"}}
+                    {InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS, "1"}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, InferenceEngine::MultiDeviceConfigParams::MULTI_PRIORITY}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, InferenceEngine::MultiDeviceConfigParams::MULTI_COMPLETION_TIME}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_BATCH, "CPU:1"}}
     };
 
     INSTANTIATE_TEST_SUITE_P(smoke_BehaviorTests, CorrectConfigTests,
@@ -74,10 +96,27 @@ namespace {
                     {InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS, "should be int"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_NUMA_WEIGHTS_REPLICATION, "ON"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_MEMORY_SOLVER, "OFF"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY, "-1"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_FUSION_COST_MODEL, "ON"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_SHARED_STREAMS, "ON"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_PERF_COUNT_SAMPLING, "-1"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_SHAPE_BUCKETS, "Param_1[1,x]"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_BRANCH_PARALLELISM, "ON"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_BF16_FP32_NODES, "Softmax,,MVN"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_RATE, "1.5"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_HUGE_PAGES, InferenceEngine::PluginConfigParams::YES}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+             {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, "ROUND_ROBIN"}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+             {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_BATCH, "CPU:0"}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+             {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_BATCH, "CPU:x"}},
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
              {InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT, "DOESN'T EXIST"}},
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
@@ -94,6 +133,19 @@ namespace {
                     {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
     };
 
+    const std::vector<std::map<std::string, std::string>> batchinconfigs = {
+            {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), CommonTestUtils::DEVICE_CPU}},
+            {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), std::string(CommonTestUtils::DEVICE_CPU) + "(0)"}},
+            {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), std::string(CommonTestUtils::DEVICE_CPU) + "(-2)"}},
+            {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), std::string(CommonTestUtils::DEVICE_CPU) + "(x)"}},
+            {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), std::string(CommonTestUtils::DEVICE_CPU) + "(2)"},
+             {CONFIG_KEY(AUTO_BATCH_TIMEOUT), "-1"}},
+            {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), std::string(CommonTestUtils::DEVICE_CPU) + "(2)"},
+             {CONFIG_KEY(AUTO_BATCH_TIMEOUT), "NAN"}},
+            {{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), std::string(CommonTestUtils::DEVICE_CPU) + "(2)"},
+             {"DOESN'T EXIST", "VALUE"}}
+    };
+
     const std::vector<std::map<std::string, std::string>> multiconf = {
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
              {InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT, InferenceEngine::PluginConfigParams::THROUGHPUT}},
@@ -147,6 +199,13 @@ namespace {
             ::testing::ValuesIn(multiinconfigs)),
             IncorrectConfigTests::getTestCaseName);
 
+    INSTANTIATE_TEST_SUITE_P(smoke_Batch_BehaviorTests, IncorrectConfigTests,
+            ::testing::Combine(
+            ::testing::ValuesIn(netPrecisions),
+            ::testing::Values(CommonTestUtils::DEVICE_BATCH),
+            ::testing::ValuesIn(batchinconfigs)),
+            IncorrectConfigTests::getTestCaseName);
+
     INSTANTIATE_TEST_SUITE_P(smoke_BehaviorTests, IncorrectConfigAPITests,
             ::testing::Combine(
             ::testing::ValuesIn(netPrecisions),
@@ -168,4 +227,11 @@ namespace {
             ::testing::ValuesIn(multiinconfigs)),
             IncorrectConfigAPITests::getTestCaseName);
 
+    INSTANTIATE_TEST_SUITE_P(smoke_Batch_BehaviorTests, IncorrectConfigAPITests,
+            ::testing::Combine(
+            ::testing::ValuesIn(netPrecisions),
+            ::testing::Values(CommonTestUtils::DEVICE_BATCH),
+            ::testing::ValuesIn(batchinconfigs)),
+            IncorrectConfigAPITests::getTestCaseName);
+
 } // namespace
@@ -100,8 +100,33 @@ const auto testCase4D = ::testing::Combine(
     ::testing::Values(CommonTestUtils::DEVICE_CPU)
 );
 
+/* Mixed-radix and Bluestein lengths */
+
+const std::vector<std::vector<size_t>> inputShapesNonPowerOfTwo = {
+    {400, 2},
+    {3, 480, 2},
+    {1536, 2},
+};
+
+const std::vector<std::vector<int64_t>> axesNonPowerOfTwo = {
+    {0}, {-1}
+};
+
+const std::vector<std::vector<int64_t>> signalSizesNonPowerOfTwo = {
+    {}, {97}, {1000}
+};
+
+const auto testCaseNonPowerOfTwo = ::testing::Combine(
+    ::testing::ValuesIn(inputShapesNonPowerOfTwo),
+    ::testing::Values(InferenceEngine::Precision::FP32),
+    ::testing::ValuesIn(axesNonPowerOfTwo),
+    ::testing::ValuesIn(signalSizesNonPowerOfTwo),
+    ::testing::ValuesIn(opTypes),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
 
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_1d, DFTLayerTest, testCase1D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_2d, DFTLayerTest, testCase2D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_3d, DFTLayerTest, testCase3D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_4d, DFTLayerTest, testCase4D, DFTLayerTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_NonPowerOfTwo, DFTLayerTest, testCaseNonPowerOfTwo, DFTLayerTest::getTestCaseName);
@@ -236,6 +236,11 @@ const std::vector<ShapeRelatedParams> IS = {
     {{{55, 12}, true}, {{12, 55}, false}},
     {{{55, 12}, false}, {{12, 55}, true}},
     {{{55, 12}, true}, {{12, 55}, true}},
+
+    // per head attention matmuls fitting the caches are executed by the small GEMM kernels
+    {{{8, 128, 64}, false}, {{8, 128, 64}, true}},
+    {{{8, 128, 128}, false}, {{8, 128, 64}, false}},
+    {{{6, 37, 20}, true}, {{1, 20, 45}, false}},
 };
 
 std::vector<fusingSpecificParams> matmulFusingParams {
@@ -0,0 +1,106 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ie_compound_blob.h>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+using BatchedBlobInputTestParams = std::tuple<SizeVector,  // input shape
+                                              bool>;       // samples are adjacent in memory
+
+/*  The input is set as a batched blob made of the per sample blobs. The samples are either
+    separately allocated or the parts of one buffer, the latter ones are used in place.
+
+        ---------
+        |Input  |
+        ---------
+            |
+        ---------
+        |Conv   |
+        ---------
+            |
+        ---------
+        |Output |
+        ---------
+*/
+
+class BatchedBlobInputTest : public testing::WithParamInterface<BatchedBlobInputTestParams>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<BatchedBlobInputTestParams> obj) {
+        SizeVector inputShape;
+        bool adjacentSamples;
+        std::tie(inputShape, adjacentSamples) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "adjacentSamples=" << adjacentSamples;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        SizeVector inputShape;
+        std::tie(inputShape, adjacentSamples) = this->GetParam();
+
+        auto inputParams = builder::makeParams(element::f32, {inputShape});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+        auto conv = builder::makeConvolution(paramOuts[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 8);
+
+        ResultVector results{std::make_shared<opset5::Result>(conv)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "BatchedBlobInput");
+    }
+
+    void Infer() override {
+        inferRequest = executableNetwork.CreateInferRequest();
+
+        const auto& input = inputs.front();
+        const auto& desc = input->getTensorDesc();
+        auto sampleDims = desc.getDims();
+        const auto batch = sampleDims[0];
+        sampleDims[0] = 1;
+        const TensorDesc sampleDesc(desc.getPrecision(), sampleDims, desc.getLayout());
+        const auto sampleSize = input->size() / batch;
+
+        samplesData.assign(adjacentSamples ? 1 : batch, std::vector<float>(adjacentSamples ? input->size() : sampleSize));
+        const auto inputData = input->cbuffer().as<const float*>();
+        std::vector<Blob::Ptr> samples;
+        for (size_t i = 0; i < batch; i++) {
+            float* sampleData = adjacentSamples ? samplesData[0].data() + i * sampleSize : samplesData[i].data();
+            std::copy(inputData + i * sampleSize, inputData + (i + 1) * sampleSize, sampleData);
+            samples.push_back(make_shared_blob<float>(sampleDesc, sampleData, sampleSize));
+        }
+
+        const auto& inputName = executableNetwork.GetInputsInfo().begin()->first;
+        inferRequest.SetBlob(inputName, make_shared_blob<BatchedBlob>(samples));
+        inferRequest.Infer();
+    }
+
+    bool adjacentSamples = false;
+    std::vector<std::vector<float>> samplesData;
+};
+
+TEST_P(BatchedBlobInputTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_BatchedBlobInput, BatchedBlobInputTest,
+                         ::testing::Combine(::testing::Values(SizeVector{4, 3, 16, 16}),
+                                            ::testing::Values(false, true)),
+                         BatchedBlobInputTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,99 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpu/cpu_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using BranchParallelismTestParams = std::tuple<SizeVector,  // input shape
+                                               size_t>;     // number of branches
+
+/*  The branches don't depend on each other, so they are executed concurrently while
+    their intermediate tensors must not share the memory.
+
+            ---------
+            |Input  |
+            ---------
+          /     |     \
+    -------  -------  -------
+    |Conv |  |Conv |  |Conv |
+    -------  -------  -------
+       |        |        |
+    -------  -------  -------
+    |Add  |  |Add  |  |Add  |
+    -------  -------  -------
+          \     |     /
+            ---------
+            |Concat |
+            ---------
+                |
+            ---------
+            |Output |
+            ---------
+*/
+
+class BranchParallelismTest : public testing::WithParamInterface<BranchParallelismTestParams>,
+                              virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<BranchParallelismTestParams> obj) {
+        SizeVector inputShape;
+        size_t numBranches;
+        std::tie(inputShape, numBranches) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "NUM_BRANCHES=" << numBranches;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[CPUConfigParams::KEY_CPU_BRANCH_PARALLELISM] = PluginConfigParams::YES;
+
+        SizeVector inputShape;
+        size_t numBranches;
+        std::tie(inputShape, numBranches) = this->GetParam();
+
+        auto inputParams = builder::makeParams(element::f32, {inputShape});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        OutputVector branches;
+        for (size_t i = 0; i < numBranches; i++) {
+            auto conv = builder::makeConvolution(paramOuts[0], element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                 op::PadType::EXPLICIT, 8 * (i + 1));
+            auto add = std::make_shared<opset5::Add>(conv, opset5::Constant::create(element::f32, Shape{1}, {static_cast<float>(i)}));
+            branches.push_back(add);
+        }
+        auto concat = std::make_shared<opset5::Concat>(branches, 1);
+
+        ResultVector results{std::make_shared<opset5::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "BranchParallelism");
+    }
+};
+
+TEST_P(BranchParallelismTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const auto branchParallelismParams = ::testing::Combine(::testing::Values(SizeVector{1, 16, 10, 10}, SizeVector{2, 3, 19, 19}),
+                                                        ::testing::Values(1, 3, 6));
+
+INSTANTIATE_TEST_SUITE_P(smoke_BranchParallelism, BranchParallelismTest, branchParallelismParams,
+                         BranchParallelismTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,119 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/*  The eltwise nodes between the convolutions follow the layout of the convolutions,
+    so the reorders are left on the graph borders only.
+
+      ---------
+      |Input  |
+      ---------
+          |
+    ---------------
+    |Convolution  |
+    ---------------
+       |       |
+  ---------  --------
+  |Sigmoid|  |  Add |---Input
+  ---------  --------
+       |       |
+      ------------
+      | Multiply |
+      ------------
+           |
+    ---------------
+    |Convolution  |
+    ---------------
+           |
+       ---------
+       |Output |
+       ---------
+*/
+
+class ConvEltwiseLayoutsTest : public testing::WithParamInterface<SizeVector>,
+                               virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<SizeVector> obj) {
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(obj.param);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        const auto inputShape = this->GetParam();
+
+        auto inputParams = builder::makeParams(element::f32, {inputShape, inputShape});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        const size_t numOutChannels = inputShape[1];
+        auto conv1 = builder::makeConvolution(paramOuts[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              op::PadType::EXPLICIT, numOutChannels);
+        auto sigmoid = std::make_shared<opset5::Sigmoid>(conv1);
+        auto add = std::make_shared<opset5::Add>(conv1, paramOuts[1]);
+        auto multiply = std::make_shared<opset5::Multiply>(sigmoid, add);
+        auto conv2 = builder::makeConvolution(multiply, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              op::PadType::EXPLICIT, numOutChannels);
+
+        ResultVector results{std::make_shared<opset5::Result>(conv2)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "ConvEltwiseLayouts");
+    }
+
+    void CheckReordersCount() {
+        auto function = executableNetwork.GetExecGraphInfo().getFunction();
+        ASSERT_NE(nullptr, function);
+
+        auto getExecValue = [](const std::shared_ptr<Node>& node, const std::string& paramName) -> std::string {
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(paramName);
+            IE_ASSERT(rtInfo.end() != it);
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            IE_ASSERT(nullptr != value);
+            return value->get();
+        };
+
+        size_t actualReordersCount = 0;
+        for (const auto& node : function->get_ops()) {
+            if (getExecValue(node, ExecGraphInfoSerialization::LAYER_TYPE) == "Reorder")
+                actualReordersCount++;
+        }
+
+        for (const auto& result : function->get_results()) {
+            ASSERT_EQ(std::to_string(actualReordersCount), getExecValue(result, "reordersCount"));
+        }
+        // the layouts are propagated through the eltwise chain, so only the graph inputs and output may be reordered
+        ASSERT_LE(actualReordersCount, 3);
+    }
+};
+
+TEST_P(ConvEltwiseLayoutsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckReordersCount();
+}
+
+namespace {
+
+const std::vector<SizeVector> inputShapes = {
+    {1, 16, 10, 10},
+    {2, 32, 7, 9},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConvEltwiseLayouts, ConvEltwiseLayoutsTest, ::testing::ValuesIn(inputShapes),
+                         ConvEltwiseLayoutsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,95 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "shared_test_classes/single_layer/activation.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpu/cpu_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using FastMathActivationsTestParams = std::tuple<SizeVector,                 // input shape
+                                                 helpers::ActivationTypes>;  // activation type
+
+/*  The activation is executed by the Eltwise JIT kernel with the fast approximation,
+    so the results are compared with the relaxed threshold.
+
+            ---------
+            |Input  |
+            ---------
+                |
+           ------------
+           |Activation|
+           ------------
+                |
+            ---------
+            |Output |
+            ---------
+*/
+
+class FastMathActivationsTest : public testing::WithParamInterface<FastMathActivationsTestParams>,
+                                virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FastMathActivationsTestParams> obj) {
+        SizeVector inputShape;
+        helpers::ActivationTypes activationType;
+        std::tie(inputShape, activationType) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "Activation=" << LayerTestsDefinitions::activationNames[activationType];
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[CPUConfigParams::KEY_CPU_FAST_MATH] = PluginConfigParams::YES;
+        threshold = 1e-3f;
+
+        SizeVector inputShape;
+        helpers::ActivationTypes activationType;
+        std::tie(inputShape, activationType) = this->GetParam();
+
+        auto inputParams = builder::makeParams(element::f32, {inputShape});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto activation = builder::makeActivation(paramOuts[0], element::f32, activationType, {1}, {0.5f});
+
+        ResultVector results{std::make_shared<opset5::Result>(activation)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "FastMathActivations");
+    }
+};
+
+TEST_P(FastMathActivationsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const std::vector<helpers::ActivationTypes> activationTypes = {
+    helpers::ActivationTypes::Exp,
+    helpers::ActivationTypes::Sigmoid,
+    helpers::ActivationTypes::Tanh,
+    helpers::ActivationTypes::Swish,
+    helpers::ActivationTypes::GeluErf,
+    helpers::ActivationTypes::GeluTanh
+};
+
+const auto fastMathActivationsParams = ::testing::Combine(::testing::Values(SizeVector{1, 16, 10, 10}, SizeVector{2, 3, 19, 19}),
+                                                          ::testing::ValuesIn(activationTypes));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FastMathActivations, FastMathActivationsTest, fastMathActivationsParams,
+                         FastMathActivationsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
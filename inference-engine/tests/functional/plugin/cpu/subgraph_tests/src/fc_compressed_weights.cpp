@@ -0,0 +1,113 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using FCCompressedWeightsTestParams = std::tuple<SizeVector,      // input shape
+                                                 size_t,          // output channels
+                                                 element::Type,   // weights precision
+                                                 bool>;           // per output channel scales
+
+/*  The i8/u8 weights with the scale are kept compressed and converted by the FullyConnected kernel,
+    the scale is applied to the output.
+
+    ---------    ----------
+    |Input  |    |Weights |
+    ---------    ----------
+        |             |
+        |        ----------    ---------
+        |        |Convert |    |Scales |
+        |        ----------    ---------
+        |             |            |
+        |           -----------------
+        |           |   Multiply    |
+        |           -----------------
+        |                  |
+      ------------------------
+      |        MatMul        |
+      ------------------------
+                  |
+              ---------
+              |Output |
+              ---------
+*/
+
+class FCCompressedWeightsTest : public testing::WithParamInterface<FCCompressedWeightsTestParams>,
+                                public CPUTestsBase,
+                                virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCCompressedWeightsTestParams> obj) {
+        SizeVector inputShape;
+        size_t outputChannels;
+        element::Type weightsPrecision;
+        bool perChannelScales;
+        std::tie(inputShape, outputChannels, weightsPrecision, perChannelScales) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "OC=" << outputChannels << "_";
+        result << "WP=" << weightsPrecision << "_";
+        result << "perChannelScales=" << perChannelScales;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        selectedType = "compressed_FP32";
+
+        SizeVector inputShape;
+        size_t outputChannels;
+        element::Type weightsPrecision;
+        bool perChannelScales;
+        std::tie(inputShape, outputChannels, weightsPrecision, perChannelScales) = this->GetParam();
+
+        const size_t inputChannels = inputShape.back();
+        std::vector<int> weightsData(outputChannels * inputChannels);
+        for (size_t i = 0; i < weightsData.size(); i++)
+            weightsData[i] = weightsPrecision == element::i8 ? static_cast<int>(i % 255) - 127 : static_cast<int>(i % 256);
+        std::vector<float> scalesData(perChannelScales ? outputChannels : 1);
+        for (size_t i = 0; i < scalesData.size(); i++)
+            scalesData[i] = 0.001f * static_cast<float>(i % 7 + 1);
+
+        auto inputParams = builder::makeParams(element::f32, {inputShape});
+        auto weights = opset8::Constant::create(weightsPrecision, Shape{outputChannels, inputChannels}, weightsData);
+        auto convert = std::make_shared<opset8::Convert>(weights, element::f32);
+        auto scales = opset8::Constant::create(element::f32, perChannelScales ? Shape{outputChannels, 1} : Shape{1, 1}, scalesData);
+        auto multiply = std::make_shared<opset8::Multiply>(convert, scales);
+        auto matmul = std::make_shared<opset8::MatMul>(inputParams[0], multiply, false, true);
+
+        ResultVector results{std::make_shared<opset8::Result>(matmul)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "FCCompressedWeights");
+    }
+};
+
+TEST_P(FCCompressedWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "FullyConnected");
+}
+
+namespace {
+
+const auto fcCompressedWeightsParams = ::testing::Combine(::testing::Values(SizeVector{1, 256}, SizeVector{7, 70}, SizeVector{2, 5, 96}),
+                                                          ::testing::Values(48, 130),
+                                                          ::testing::Values(element::u8, element::i8),
+                                                          ::testing::Values(true, false));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCCompressedWeights, FCCompressedWeightsTest, fcCompressedWeightsParams,
+                         FCCompressedWeightsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,105 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpu/cpu_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using FCSparseWeightsTestParams = std::tuple<SizeVector,  // input shape
+                                             size_t,      // output channels
+                                             float>;      // fraction of zero weights
+
+/*  The weights with the fraction of zeros exceeding KEY_CPU_SPARSE_WEIGHTS_RATE are executed by the sparse kernel,
+    the Relu isn't fused into it.
+
+      ---------
+      |Input  |
+      ---------
+          |
+    ----------------
+    |FullyConnected|
+    ----------------
+          |
+      ---------
+      | Relu  |
+      ---------
+          |
+      ---------
+      |Output |
+      ---------
+*/
+
+class FCSparseWeightsTest : public testing::WithParamInterface<FCSparseWeightsTestParams>,
+                            public CPUTestsBase,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCSparseWeightsTestParams> obj) {
+        SizeVector inputShape;
+        size_t outputChannels;
+        float sparsity;
+        std::tie(inputShape, outputChannels, sparsity) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "OC=" << outputChannels << "_";
+        result << "Sparsity=" << sparsity;
+        return result.str();
+    }
+
+protected:
+    static constexpr float sparseWeightsRate = 0.7f;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_RATE] = std::to_string(sparseWeightsRate);
+
+        SizeVector inputShape;
+        size_t outputChannels;
+        float sparsity;
+        std::tie(inputShape, outputChannels, sparsity) = this->GetParam();
+        selectedType = sparsity >= sparseWeightsRate ? "sparse_FP32" : "";
+
+        const size_t inputChannels = inputShape.back();
+        std::vector<float> weights(inputChannels * outputChannels);
+        const size_t keepEach = static_cast<size_t>(1.f / (1.f - sparsity) + 0.5f);
+        for (size_t i = 0; i < weights.size(); i++)
+            weights[i] = (i * 7) % keepEach == 0 ? static_cast<float>(i % 13) / 13.f - 0.5f : 0.f;
+
+        auto inputParams = builder::makeParams(element::f32, {inputShape});
+        auto fc = builder::makeFullyConnected(inputParams[0], element::f32, outputChannels, true,
+                                              Shape{inputChannels, outputChannels}, weights);
+        auto relu = std::make_shared<opset5::Relu>(fc);
+
+        ResultVector results{std::make_shared<opset5::Result>(relu)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "FCSparseWeights");
+    }
+};
+
+TEST_P(FCSparseWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    if (!selectedType.empty())
+        CheckPluginRelatedResults(executableNetwork, "FullyConnected");
+}
+
+namespace {
+
+const auto fcSparseWeightsParams = ::testing::Combine(::testing::Values(SizeVector{1, 256}, SizeVector{7, 64}, SizeVector{2, 5, 96}),
+                                                      ::testing::Values(48, 130),
+                                                      ::testing::Values(0.5f, 0.75f, 0.9f));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCSparseWeights, FCSparseWeightsTest, fcSparseWeightsParams,
+                         FCSparseWeightsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
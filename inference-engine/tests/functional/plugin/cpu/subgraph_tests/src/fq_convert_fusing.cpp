@@ -0,0 +1,92 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using FQConvertFusingTestParams = std::tuple<element::Type,        // convert destination type
+                                             std::vector<float>,   // FQ output low and high
+                                             size_t>;              // expected number of Convert nodes
+
+/*  The Convert is folded into the FakeQuantize kernel when the quantized values are integers
+    fitting the destination precision.
+
+      ---------
+      |Input  |
+      ---------
+          |
+    --------------
+    |FakeQuantize|
+    --------------
+          |
+      ---------
+      |Convert|
+      ---------
+          |
+      ---------
+      |Output |
+      ---------
+*/
+
+class FQConvertFusingTest : public testing::WithParamInterface<FQConvertFusingTestParams>,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FQConvertFusingTestParams> obj) {
+        element::Type dstType;
+        std::vector<float> outputRange;
+        size_t expectedConvertCount;
+        std::tie(dstType, outputRange, expectedConvertCount) = obj.param;
+
+        std::ostringstream result;
+        result << "DstType=" << dstType << "_";
+        result << "OutputRange=" << CommonTestUtils::vec2str(outputRange);
+        return result.str();
+    }
+
+protected:
+    size_t expectedConvertCount = 0;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        element::Type dstType;
+        std::vector<float> outputRange;
+        std::tie(dstType, outputRange, expectedConvertCount) = this->GetParam();
+        outPrc = FuncTestUtils::PrecisionUtils::convertNgraphPrc2IEPrc(dstType);
+
+        auto inputParams = builder::makeParams(element::f32, {Shape{1, 16, 8, 8}});
+        auto fq = builder::makeFakeQuantize(inputParams[0], element::f32, 256, {1, 16, 1, 1},
+                                            {-1.f}, {1.f}, {outputRange[0]}, {outputRange[1]});
+        auto convert = std::make_shared<opset5::Convert>(fq, dstType);
+
+        ResultVector results{std::make_shared<opset5::Result>(convert)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "FQConvertFusing");
+    }
+};
+
+TEST_P(FQConvertFusingTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Convert", expectedConvertCount);
+}
+
+namespace {
+
+const auto fqConvertFusingParams = ::testing::Values(
+        FQConvertFusingTestParams{element::u8, {0.f, 255.f}, 0},
+        FQConvertFusingTestParams{element::i8, {-128.f, 127.f}, 0},
+        FQConvertFusingTestParams{element::u8, {0.f, 2.55f}, 1});
+
+INSTANTIATE_TEST_SUITE_P(smoke_FQConvertFusing, FQConvertFusingTest, fqConvertFusingParams, FQConvertFusingTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,107 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using InputConvertEltwiseTestParams = std::tuple<element::Type,   // input precision
+                                                 bool,            // mean and scale before the convolution
+                                                 size_t>;         // expected number of Convert nodes
+
+/*  The Convert of the integer input is dropped when it feeds Eltwise nodes only,
+    the Eltwise kernel reads the input precision directly.
+
+      ---------
+      |Input  |
+      ---------
+          |
+      ---------
+      |Convert|
+      ---------
+          |
+    --------------
+    |Subtract    |   (optional)
+    --------------
+          |
+    --------------
+    |Multiply    |   (optional)
+    --------------
+          |
+    --------------
+    |Convolution |
+    --------------
+          |
+      ---------
+      |Output |
+      ---------
+*/
+
+class InputConvertEltwiseTest : public testing::WithParamInterface<InputConvertEltwiseTestParams>,
+                                virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<InputConvertEltwiseTestParams> obj) {
+        element::Type inputType;
+        bool meanScale;
+        size_t expectedConvertCount;
+        std::tie(inputType, meanScale, expectedConvertCount) = obj.param;
+
+        std::ostringstream result;
+        result << "InputType=" << inputType << "_";
+        result << "MeanScale=" << meanScale;
+        return result.str();
+    }
+
+protected:
+    size_t expectedConvertCount = 0;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        element::Type inputType;
+        bool meanScale;
+        std::tie(inputType, meanScale, expectedConvertCount) = this->GetParam();
+
+        const size_t channels = 3;
+        auto inputParams = builder::makeParams(inputType, {Shape{1, channels, 32, 32}});
+        std::shared_ptr<Node> node = std::make_shared<opset8::Convert>(inputParams[0], element::f32);
+        if (meanScale) {
+            auto mean = opset8::Constant::create(element::f32, Shape{1, channels, 1, 1}, {123.7f, 116.3f, 103.5f});
+            auto scale = opset8::Constant::create(element::f32, Shape{1, channels, 1, 1}, {0.017f, 0.018f, 0.0174f});
+            node = std::make_shared<opset8::Subtract>(node, mean);
+            node = std::make_shared<opset8::Multiply>(node, scale);
+        }
+        auto conv = builder::makeConvolution(node, element::f32, {3, 3}, {2, 2}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+
+        ResultVector results{std::make_shared<opset8::Result>(conv)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "InputConvertEltwise");
+    }
+};
+
+TEST_P(InputConvertEltwiseTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Convert", expectedConvertCount);
+}
+
+namespace {
+
+const auto inputConvertEltwiseParams = ::testing::Values(
+        InputConvertEltwiseTestParams{element::u8, true, 0},
+        InputConvertEltwiseTestParams{element::i8, true, 0},
+        InputConvertEltwiseTestParams{element::u8, false, 1});
+
+INSTANTIATE_TEST_SUITE_P(smoke_InputConvertEltwise, InputConvertEltwiseTest, inputConvertEltwiseParams,
+                         InputConvertEltwiseTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,106 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using LSTMSequenceInt8TestParams = std::tuple<size_t,     // batch
+                                              size_t,     // sequence length
+                                              size_t,     // input size
+                                              size_t>;    // hidden size
+
+/*  The sequence data on the u8 grid of the FakeQuantize are executed by the int8 oneDNN LSTM
+    with the s8 weights, the states and the outputs stay FP32.
+
+    ---------
+    |Input  |
+    ---------
+        |
+    --------------
+    |FakeQuantize|    ---------------
+    --------------    |H0, C0, W, R, B|
+        |             ---------------
+      ------------------------
+      |     LSTMSequence     |
+      ------------------------
+                  |
+              ---------
+              |Output |
+              ---------
+*/
+
+class LSTMSequenceInt8Test : public testing::WithParamInterface<LSTMSequenceInt8TestParams>,
+                             public CPUTestsBase,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<LSTMSequenceInt8TestParams> obj) {
+        size_t batch, seqLength, inputSize, hiddenSize;
+        std::tie(batch, seqLength, inputSize, hiddenSize) = obj.param;
+
+        std::ostringstream result;
+        result << "N=" << batch << "_";
+        result << "T=" << seqLength << "_";
+        result << "IS=" << inputSize << "_";
+        result << "HS=" << hiddenSize;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        // the s8 weights are compared to the FP32 reference
+        abs_threshold = 0.05f;
+
+        size_t batch, seqLength, inputSize, hiddenSize;
+        std::tie(batch, seqLength, inputSize, hiddenSize) = this->GetParam();
+
+        auto params = builder::makeParams(element::f32, {{batch, seqLength, inputSize}, {batch, 1, hiddenSize}, {batch, 1, hiddenSize}});
+        auto fakeQuantize = builder::makeFakeQuantize(params[0], element::f32, 256, {}, {-2.f}, {2.f}, {-2.f}, {2.f});
+
+        auto makeWeights = [](const Shape& shape) {
+            std::vector<float> data(shape_size(shape));
+            for (size_t i = 0; i < data.size(); i++)
+                data[i] = 0.01f * static_cast<float>(static_cast<int>(i % 41) - 20);
+            return opset5::Constant::create(element::f32, shape, data);
+        };
+        auto seqLengths = opset5::Constant::create(element::i64, Shape{batch}, std::vector<int64_t>(batch, seqLength));
+        auto lstm = std::make_shared<opset5::LSTMSequence>(fakeQuantize, params[1], params[2], seqLengths,
+                                                           makeWeights({1, 4 * hiddenSize, inputSize}),
+                                                           makeWeights({1, 4 * hiddenSize, hiddenSize}),
+                                                           makeWeights({1, 4 * hiddenSize}),
+                                                           hiddenSize, op::RecurrentSequenceDirection::FORWARD);
+
+        ResultVector results{std::make_shared<opset5::Result>(lstm->output(0)),
+                             std::make_shared<opset5::Result>(lstm->output(1)),
+                             std::make_shared<opset5::Result>(lstm->output(2))};
+        function = std::make_shared<ngraph::Function>(results, params, "LSTMSequenceInt8");
+    }
+};
+
+TEST_P(LSTMSequenceInt8Test, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const auto lstmSequenceInt8Params = ::testing::Combine(::testing::Values(1, 10),
+                                                       ::testing::Values(2, 5),
+                                                       ::testing::Values(16),
+                                                       ::testing::Values(10, 32));
+
+INSTANTIATE_TEST_SUITE_P(smoke_LSTMSequenceInt8, LSTMSequenceInt8Test, lstmSequenceInt8Params,
+                         LSTMSequenceInt8Test::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,123 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <ngraph/opsets/opset6.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using MemoryGrowingStateTestParams = std::tuple<size_t,   // feature size
+                                                size_t>;  // number of inferences
+
+/*  The state is dynamic along the time axis, so each inference appends a step to it like the past keys and values
+    of an autoregressive decoder.
+
+    --------------  ---------
+    |ReadValue   |  |Input  |
+    |[1, ?, C]   |  |[1,1,C]|
+    --------------  ---------
+             \        /
+             ----------
+             | Concat |
+             ----------
+              /      \
+        --------   --------
+        |Assign|   |Output|
+        --------   --------
+*/
+
+class MemoryGrowingStateTest : public testing::WithParamInterface<MemoryGrowingStateTestParams>,
+                               virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MemoryGrowingStateTestParams> obj) {
+        size_t featureSize, inferCount;
+        std::tie(featureSize, inferCount) = obj.param;
+
+        std::ostringstream result;
+        result << "C=" << featureSize << "_";
+        result << "InferCount=" << inferCount;
+        return result.str();
+    }
+
+protected:
+    size_t featureSize = 0;
+    size_t inferCount = 0;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::tie(featureSize, inferCount) = this->GetParam();
+
+        const Shape stepShape{1, 1, featureSize};
+        auto param = std::make_shared<opset6::Parameter>(element::f32, stepShape);
+        auto variable = std::make_shared<Variable>(VariableInfo{PartialShape{1, Dimension::dynamic(), featureSize},
+                                                                element::f32, "past"});
+        auto init = opset6::Constant::create(element::f32, stepShape, {0.f});
+        auto readValue = std::make_shared<opset6::ReadValue>(init, variable);
+        auto concat = std::make_shared<opset6::Concat>(OutputVector{readValue, param}, 1);
+        auto assign = std::make_shared<opset6::Assign>(concat, variable);
+
+        function = std::make_shared<ngraph::Function>(ResultVector{std::make_shared<opset6::Result>(concat)},
+                                                      SinkVector{assign}, ParameterVector{param}, "MemoryGrowingState");
+    }
+};
+
+TEST_P(MemoryGrowingStateTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+    auto request = executableNetwork.CreateInferRequest();
+
+    // the initializer is the first step of the state
+    std::vector<float> expected(featureSize, 0.f);
+    for (size_t iteration = 0; iteration < inferCount; iteration++) {
+        auto inputBlob = request.GetBlob(inputName);
+        auto inputData = inputBlob->buffer().as<float*>();
+        for (size_t i = 0; i < featureSize; i++)
+            inputData[i] = static_cast<float>(iteration * featureSize + i + 1);
+        expected.insert(expected.end(), inputData, inputData + featureSize);
+
+        request.Infer();
+
+        const SizeVector expectedDims{1, iteration + 2, featureSize};
+        auto outputBlob = request.GetBlob(outputName);
+        ASSERT_EQ(expectedDims, outputBlob->getTensorDesc().getDims());
+        auto outputData = outputBlob->cbuffer().as<const float*>();
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_FLOAT_EQ(expected[i], outputData[i]) << "iteration " << iteration << ", element " << i;
+        }
+
+        auto states = request.QueryState();
+        ASSERT_EQ(1, states.size());
+        auto stateBlob = states.front().GetState();
+        ASSERT_EQ(expectedDims, stateBlob->getTensorDesc().getDims());
+        auto stateData = stateBlob->cbuffer().as<const float*>();
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_FLOAT_EQ(expected[i], stateData[i]) << "iteration " << iteration << ", element " << i;
+        }
+    }
+
+    // reset makes the state the initializer again
+    request.QueryState().front().Reset();
+    ASSERT_EQ((SizeVector{1, 1, featureSize}), request.QueryState().front().GetState()->getTensorDesc().getDims());
+}
+
+namespace {
+
+const auto memoryGrowingStateParams = ::testing::Combine(::testing::Values(4, 64),
+                                                         ::testing::Values(1, 9));
+
+INSTANTIATE_TEST_SUITE_P(smoke_MemoryGrowingState, MemoryGrowingStateTest, memoryGrowingStateParams,
+                         MemoryGrowingStateTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,141 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <ngraph/opsets/opset6.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+enum class StateUpdate {
+    Accumulate,  // the state is read by its writer, so the state buffers are swapped
+    Independent  // the state writer doesn't read the state
+};
+
+using MemoryInPlaceStatesTestParams = std::tuple<SizeVector,    // input shape
+                                                 StateUpdate>;  // how the state is updated
+
+/*  The ReadValue output and the Assign input are the state buffers, so the state is passed between the inferences
+    without copies. Each infer request keeps its own state.
+
+        Accumulate:                      Independent:
+
+    ---------  -----------          -----------  ---------
+    |Input  |  |ReadValue|          |ReadValue|  |Input  |
+    ---------  -----------          -----------  ---------
+         \       /                       \       /     |
+         ---------                      ----------  ---------
+         |  Add  |                      |Multiply|  |  Add  |
+         ---------                      ----------  ---------
+          /     \                           |           |
+    --------   --------                 --------    --------
+    |Assign|   |Output|                 |Output|    |Assign|
+    --------   --------                 --------    --------
+*/
+
+class MemoryInPlaceStatesTest : public testing::WithParamInterface<MemoryInPlaceStatesTestParams>,
+                                virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MemoryInPlaceStatesTestParams> obj) {
+        SizeVector inputShape;
+        StateUpdate stateUpdate;
+        std::tie(inputShape, stateUpdate) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "Update=" << (stateUpdate == StateUpdate::Accumulate ? "Accumulate" : "Independent");
+        return result.str();
+    }
+
+    // the expected output and the next state for the input and the state filled with the same values
+    std::pair<float, float> reference(float input, float state) const {
+        if (stateUpdate == StateUpdate::Accumulate)
+            return {state + input, state + input};
+        return {state * input, input + 1.f};
+    }
+
+protected:
+    StateUpdate stateUpdate;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape;
+        std::tie(inputShape, stateUpdate) = this->GetParam();
+
+        auto param = std::make_shared<opset6::Parameter>(element::f32, Shape(inputShape));
+        auto variable = std::make_shared<Variable>(VariableInfo{PartialShape(inputShape), element::f32, "state"});
+        auto init = opset6::Constant::create(element::f32, Shape(inputShape), {0.f});
+        auto readValue = std::make_shared<opset6::ReadValue>(init, variable);
+
+        std::shared_ptr<Node> output, newState;
+        if (stateUpdate == StateUpdate::Accumulate) {
+            output = std::make_shared<opset6::Add>(readValue, param);
+            newState = output;
+        } else {
+            output = std::make_shared<opset6::Multiply>(readValue, param);
+            newState = std::make_shared<opset6::Add>(param, opset6::Constant::create(element::f32, Shape{1}, {1.f}));
+        }
+        auto assign = std::make_shared<opset6::Assign>(newState, variable);
+
+        function = std::make_shared<ngraph::Function>(ResultVector{std::make_shared<opset6::Result>(output)},
+                                                      SinkVector{assign}, ParameterVector{param}, "MemoryInPlaceStates");
+    }
+};
+
+TEST_P(MemoryInPlaceStatesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+
+    std::vector<InferRequest> requests{executableNetwork.CreateInferRequest(), executableNetwork.CreateInferRequest()};
+    std::vector<float> states(requests.size(), 0.f);
+    const std::vector<size_t> inferOrder = {0, 0, 1, 0, 1, 1, 0};
+
+    for (size_t iteration = 0; iteration < inferOrder.size(); iteration++) {
+        const auto id = inferOrder[iteration];
+        const float input = static_cast<float>(iteration + id + 1);
+
+        auto inputBlob = requests[id].GetBlob(inputName);
+        auto inputData = inputBlob->buffer().as<float*>();
+        std::fill(inputData, inputData + inputBlob->size(), input);
+
+        requests[id].Infer();
+
+        const auto expected = reference(input, states[id]);
+        states[id] = expected.second;
+
+        auto outputBlob = requests[id].GetBlob(outputName);
+        auto outputData = outputBlob->cbuffer().as<const float*>();
+        for (size_t i = 0; i < outputBlob->size(); i++) {
+            ASSERT_FLOAT_EQ(expected.first, outputData[i]) << "iteration " << iteration << ", element " << i;
+        }
+
+        for (auto&& state : requests[id].QueryState()) {
+            auto stateBlob = state.GetState();
+            auto stateData = stateBlob->cbuffer().as<const float*>();
+            for (size_t i = 0; i < stateBlob->size(); i++) {
+                ASSERT_FLOAT_EQ(states[id], stateData[i]) << "iteration " << iteration << ", element " << i;
+            }
+        }
+    }
+}
+
+namespace {
+
+const auto memoryInPlaceStatesParams = ::testing::Combine(::testing::Values(SizeVector{1, 16, 8, 8}, SizeVector{3, 100}),
+                                                          ::testing::Values(StateUpdate::Accumulate, StateUpdate::Independent));
+
+INSTANTIATE_TEST_SUITE_P(smoke_MemoryInPlaceStates, MemoryInPlaceStatesTest, memoryInPlaceStatesParams,
+                         MemoryInPlaceStatesTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,136 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <blob_factory.hpp>
+#include <ngraph/opsets/opset6.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+enum class StateAction {
+    None,
+    Set,
+    Reset
+};
+
+using MemoryStateStepsTestParams = std::tuple<SizeVector>;  // input shape
+
+/*  The state is read by the network output, so it is copied to and from the state store. The state pulled after
+    a step isn't pushed again at the next step of the same request, unless it is changed by the user or the store
+    is used by another request in between.
+
+    ---------  -----------
+    |Input  |  |ReadValue|
+    ---------  -----------
+         \       /     \
+         ---------   --------
+         |  Add  |   |Output|
+         ---------   --------
+             |
+         --------
+         |Assign|
+         --------
+*/
+
+class MemoryStateStepsTest : public testing::WithParamInterface<MemoryStateStepsTestParams>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MemoryStateStepsTestParams> obj) {
+        SizeVector inputShape;
+        std::tie(inputShape) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape;
+        std::tie(inputShape) = this->GetParam();
+
+        auto param = std::make_shared<opset6::Parameter>(element::f32, Shape(inputShape));
+        auto variable = std::make_shared<Variable>(VariableInfo{PartialShape(inputShape), element::f32, "state"});
+        auto init = opset6::Constant::create(element::f32, Shape(inputShape), {0.f});
+        auto readValue = std::make_shared<opset6::ReadValue>(init, variable);
+        auto add = std::make_shared<opset6::Add>(readValue, param);
+        auto assign = std::make_shared<opset6::Assign>(add, variable);
+
+        function = std::make_shared<ngraph::Function>(ResultVector{std::make_shared<opset6::Result>(readValue)},
+                                                      SinkVector{assign}, ParameterVector{param}, "MemoryStateSteps");
+    }
+};
+
+TEST_P(MemoryStateStepsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+
+    std::vector<InferRequest> requests{executableNetwork.CreateInferRequest(), executableNetwork.CreateInferRequest()};
+    std::vector<float> states(requests.size(), 0.f);
+    const std::vector<std::pair<size_t, StateAction>> steps = {
+        {0, StateAction::None}, {0, StateAction::None}, {0, StateAction::None}, {1, StateAction::None},
+        {0, StateAction::None}, {0, StateAction::Set}, {0, StateAction::None}, {1, StateAction::Reset},
+        {1, StateAction::None}, {0, StateAction::None}};
+
+    for (size_t iteration = 0; iteration < steps.size(); iteration++) {
+        const auto id = steps[iteration].first;
+        const float input = static_cast<float>(iteration + 1);
+
+        for (auto&& state : requests[id].QueryState()) {
+            if (steps[iteration].second == StateAction::Set) {
+                auto newState = make_blob_with_precision(state.GetState()->getTensorDesc());
+                newState->allocate();
+                auto newStateData = newState->buffer().as<float*>();
+                std::fill(newStateData, newStateData + newState->size(), 100.f);
+                state.SetState(newState);
+                states[id] = 100.f;
+            } else if (steps[iteration].second == StateAction::Reset) {
+                state.Reset();
+                states[id] = 0.f;
+            }
+        }
+
+        auto inputBlob = requests[id].GetBlob(inputName);
+        auto inputData = inputBlob->buffer().as<float*>();
+        std::fill(inputData, inputData + inputBlob->size(), input);
+
+        requests[id].Infer();
+
+        auto outputBlob = requests[id].GetBlob(outputName);
+        auto outputData = outputBlob->cbuffer().as<const float*>();
+        for (size_t i = 0; i < outputBlob->size(); i++) {
+            ASSERT_FLOAT_EQ(states[id], outputData[i]) << "iteration " << iteration << ", element " << i;
+        }
+
+        states[id] += input;
+        for (auto&& state : requests[id].QueryState()) {
+            auto stateBlob = state.GetState();
+            auto stateData = stateBlob->cbuffer().as<const float*>();
+            for (size_t i = 0; i < stateBlob->size(); i++) {
+                ASSERT_FLOAT_EQ(states[id], stateData[i]) << "iteration " << iteration << ", element " << i;
+            }
+        }
+    }
+}
+
+namespace {
+
+const auto memoryStateStepsParams = ::testing::Combine(::testing::Values(SizeVector{1, 16, 8, 8}, SizeVector{3, 100}));
+
+INSTANTIATE_TEST_SUITE_P(smoke_MemoryStateSteps, MemoryStateStepsTest, memoryStateStepsParams,
+                         MemoryStateStepsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
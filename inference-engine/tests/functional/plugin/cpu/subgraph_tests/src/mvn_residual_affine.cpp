@@ -0,0 +1,126 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using MVNResidualAffineTestParams = std::tuple<SizeVector,   // input shape
+                                               bool,         // RMS normalization
+                                               bool>;        // per element gamma and beta
+
+/*  The residual addition and the affine transformation are executed by MVN in one pass,
+    RMSNorm is recognized from x / Sqrt(ReduceMean(x * x) + eps).
+
+    ---------    ----------
+    |Input  |    |Residual|
+    ---------    ----------
+        |             |
+      -----------------
+      |      Add      |
+      -----------------
+              |
+      -----------------
+      | MVN / RMSNorm |
+      -----------------
+              |
+      -----------------    ---------
+      |   Multiply    |----| Gamma |
+      -----------------    ---------
+              |
+      -----------------    ---------
+      |      Add      |----| Beta  |
+      -----------------    ---------
+              |
+          ---------
+          |Output |
+          ---------
+*/
+
+class MVNResidualAffineTest : public testing::WithParamInterface<MVNResidualAffineTestParams>,
+                              public CPUTestsBase,
+                              virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MVNResidualAffineTestParams> obj) {
+        SizeVector inputShape;
+        bool rmsNorm;
+        bool perElementAffine;
+        std::tie(inputShape, rmsNorm, perElementAffine) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "RMS=" << rmsNorm << "_";
+        result << "perElementAffine=" << perElementAffine;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        selectedType = "ref_any_FP32";
+
+        SizeVector inputShape;
+        bool rmsNorm;
+        bool perElementAffine;
+        std::tie(inputShape, rmsNorm, perElementAffine) = this->GetParam();
+
+        const size_t rowSize = inputShape.back();
+        const std::vector<int64_t> axes = {static_cast<int64_t>(inputShape.size()) - 1};
+        const float eps = 1e-5f;
+
+        auto inputParams = builder::makeParams(element::f32, {inputShape, inputShape});
+        auto sum = std::make_shared<opset8::Add>(inputParams[0], inputParams[1]);
+
+        std::shared_ptr<Node> norm;
+        if (rmsNorm) {
+            auto square = std::make_shared<opset8::Multiply>(sum, sum);
+            auto mean = std::make_shared<opset8::ReduceMean>(square, opset8::Constant::create(element::i64, Shape{axes.size()}, axes), true);
+            auto addEps = std::make_shared<opset8::Add>(mean, opset8::Constant::create(element::f32, Shape{}, {eps}));
+            norm = std::make_shared<opset8::Divide>(sum, std::make_shared<opset8::Sqrt>(addEps));
+        } else {
+            norm = std::make_shared<opset8::MVN>(sum, opset8::Constant::create(element::i64, Shape{axes.size()}, axes),
+                                                 true, eps, op::MVNEpsMode::INSIDE_SQRT);
+        }
+
+        const Shape affineShape = perElementAffine ? Shape{rowSize} : Shape{1};
+        std::vector<float> gammaData(shape_size(affineShape));
+        std::vector<float> betaData(shape_size(affineShape));
+        for (size_t i = 0; i < gammaData.size(); i++) {
+            gammaData[i] = 0.5f + 0.1f * static_cast<float>(i % 9);
+            betaData[i] = -0.2f + 0.05f * static_cast<float>(i % 5);
+        }
+        auto gamma = std::make_shared<opset8::Multiply>(norm, opset8::Constant::create(element::f32, affineShape, gammaData));
+        auto beta = std::make_shared<opset8::Add>(gamma, opset8::Constant::create(element::f32, affineShape, betaData));
+
+        ResultVector results{std::make_shared<opset8::Result>(beta)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "MVNResidualAffine");
+    }
+};
+
+TEST_P(MVNResidualAffineTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "MVN");
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+}
+
+namespace {
+
+const auto mvnResidualAffineParams = ::testing::Combine(::testing::Values(SizeVector{1, 256}, SizeVector{2, 10, 96}, SizeVector{3, 7, 33}),
+                                                        ::testing::Values(false, true),
+                                                        ::testing::Values(true, false));
+
+INSTANTIATE_TEST_SUITE_P(smoke_MVNResidualAffine, MVNResidualAffineTest, mvnResidualAffineParams,
+                         MVNResidualAffineTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
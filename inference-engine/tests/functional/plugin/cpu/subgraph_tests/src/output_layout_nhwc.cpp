@@ -0,0 +1,95 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using OutputLayoutTestParams = std::tuple<SizeVector,   // input shape
+                                          Layout,       // output layout
+                                          bool>;        // convolution or eltwise producer
+
+/*  The output node takes the channels last layout of the output blob, so the producer writes the blob directly.
+
+      ---------
+      |Input  |
+      ---------
+          |
+    ----------------------
+    |Convolution/Eltwise |
+    ----------------------
+          |
+      ---------
+      |Output |   (NHWC/NDHWC)
+      ---------
+*/
+
+class OutputLayoutTest : public testing::WithParamInterface<OutputLayoutTestParams>,
+                         virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<OutputLayoutTestParams> obj) {
+        SizeVector inputShape;
+        Layout layout;
+        bool convolution;
+        std::tie(inputShape, layout, convolution) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "OutLayout=" << layout << "_";
+        result << (convolution ? "Convolution" : "Eltwise");
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape;
+        bool convolution;
+        std::tie(inputShape, outLayout, convolution) = this->GetParam();
+
+        auto inputParams = builder::makeParams(element::f32, {inputShape});
+        std::shared_ptr<Node> node;
+        if (convolution) {
+            const std::vector<size_t> ones(inputShape.size() - 2, 1);
+            const std::vector<ptrdiff_t> zeros(inputShape.size() - 2, 0);
+            node = builder::makeConvolution(inputParams[0], element::f32, ones, ones, zeros, zeros, ones,
+                                            op::PadType::EXPLICIT, 24);
+        } else {
+            node = builder::makeActivation(inputParams[0], element::f32, helpers::ActivationTypes::Relu);
+        }
+
+        ResultVector results{std::make_shared<opset8::Result>(node)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "OutputLayout");
+    }
+};
+
+TEST_P(OutputLayoutTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const auto outputLayout4DParams = ::testing::Combine(::testing::Values(SizeVector{1, 16, 7, 9}, SizeVector{2, 3, 10, 10}),
+                                                     ::testing::Values(Layout::NCHW, Layout::NHWC),
+                                                     ::testing::Values(true, false));
+
+INSTANTIATE_TEST_SUITE_P(smoke_OutputLayout4D, OutputLayoutTest, outputLayout4DParams, OutputLayoutTest::getTestCaseName);
+
+const auto outputLayout5DParams = ::testing::Combine(::testing::Values(SizeVector{1, 16, 3, 5, 7}),
+                                                     ::testing::Values(Layout::NCDHW, Layout::NDHWC),
+                                                     ::testing::Values(true, false));
+
+INSTANTIATE_TEST_SUITE_P(smoke_OutputLayout5D, OutputLayoutTest, outputLayout5DParams, OutputLayoutTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,126 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+enum class ReduceInputEltwise {
+    SquareByMultiply,
+    SquareByPower,
+    Abs
+};
+
+using ReduceInputEltwiseTestParams = std::tuple<SizeVector,             // input shape
+                                                std::vector<int64_t>,   // axes
+                                                bool,                   // keep dims
+                                                ReduceInputEltwise>;
+
+/*  The eltwise before ReduceSum is computed by the reduce kernel: x * x and x ^ 2 give ReduceSumSquare,
+    abs(x) gives ReduceL1.
+
+    ---------
+    |Input  |
+    ---------
+        |
+    ---------
+    |Eltwise|
+    ---------
+        |
+    -----------
+    |ReduceSum|
+    -----------
+        |
+    ---------
+    |Output |
+    ---------
+*/
+
+class ReduceInputEltwiseTest : public testing::WithParamInterface<ReduceInputEltwiseTestParams>,
+                               public CPUTestsBase,
+                               virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ReduceInputEltwiseTestParams> obj) {
+        SizeVector inputShape;
+        std::vector<int64_t> axes;
+        bool keepDims;
+        ReduceInputEltwise eltwise;
+        std::tie(inputShape, axes, keepDims, eltwise) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "axes=" << CommonTestUtils::vec2str(axes) << "_";
+        result << "keepDims=" << keepDims << "_";
+        result << "eltwise=" << (eltwise == ReduceInputEltwise::SquareByMultiply ? "Multiply" :
+                                 eltwise == ReduceInputEltwise::SquareByPower ? "Power" : "Abs");
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        SizeVector inputShape;
+        std::vector<int64_t> axes;
+        bool keepDims;
+        ReduceInputEltwise eltwise;
+        std::tie(inputShape, axes, keepDims, eltwise) = this->GetParam();
+
+        auto inputParams = builder::makeParams(element::f32, {inputShape});
+        std::shared_ptr<Node> eltwiseNode;
+        if (eltwise == ReduceInputEltwise::SquareByMultiply) {
+            eltwiseNode = std::make_shared<opset8::Multiply>(inputParams[0], inputParams[0]);
+        } else if (eltwise == ReduceInputEltwise::SquareByPower) {
+            eltwiseNode = std::make_shared<opset8::Power>(inputParams[0], opset8::Constant::create(element::f32, Shape{}, {2.f}));
+        } else {
+            eltwiseNode = std::make_shared<opset8::Abs>(inputParams[0]);
+        }
+        auto axesNode = opset8::Constant::create(element::i64, Shape{axes.size()}, axes);
+        auto reduce = std::make_shared<opset8::ReduceSum>(eltwiseNode, axesNode, keepDims);
+
+        ResultVector results{std::make_shared<opset8::Result>(reduce)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "ReduceInputEltwise");
+    }
+};
+
+TEST_P(ReduceInputEltwiseTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+}
+
+namespace {
+
+const std::vector<SizeVector> inputShapes = {
+    {2, 19, 7, 23},
+    {1, 3, 5, 8, 33},
+};
+
+const std::vector<std::vector<int64_t>> axes = {
+    {1},
+    {1, 3},
+    {0, 2},
+    {-1},
+};
+
+const auto reduceInputEltwiseParams = ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                                         ::testing::ValuesIn(axes),
+                                                         ::testing::Values(true, false),
+                                                         ::testing::Values(ReduceInputEltwise::SquareByMultiply,
+                                                                           ReduceInputEltwise::SquareByPower,
+                                                                           ReduceInputEltwise::Abs));
+
+INSTANTIATE_TEST_SUITE_P(smoke_ReduceInputEltwise, ReduceInputEltwiseTest, reduceInputEltwiseParams,
+                         ReduceInputEltwiseTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,159 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+#include <cmath>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using ScaledAttentionTestParams = std::tuple<SizeVector,  // Q shape [..., Sq, D]
+                                             size_t,      // keys number Sk
+                                             bool,        // K is [..., D, Sk]
+                                             bool,        // scale the scores
+                                             bool,        // add the mask to the scores
+                                             Precision>;  // execution precision
+
+/*  The attention subgraph is executed by the single ScaledAttention node, the result must match
+    the reference of the original graph.
+
+    -------     -------
+    |  Q  |     |  K  |
+    -------     -------
+        \         /
+        -----------
+        | MatMul  |
+        -----------
+             |
+        ------------
+        | Multiply |  optional, 1 / sqrt(D)
+        ------------
+             |
+        ------------
+        |   Add    |  optional, mask [..., 1, Sk]
+        ------------
+             |
+        -----------
+        | Softmax |
+        -----------     -------
+                \       |  V  |
+                 \      -------
+                  \     /
+                 ----------
+                 | MatMul |
+                 ----------
+                     |
+                 ----------
+                 | Output |
+                 ----------
+*/
+
+class ScaledAttentionFusionTest : public testing::WithParamInterface<ScaledAttentionTestParams>,
+                                  public CPUTestsBase,
+                                  virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ScaledAttentionTestParams> obj) {
+        SizeVector qShape;
+        size_t keysNum;
+        bool transposeK, withScale, withMask;
+        Precision precision;
+        std::tie(qShape, keysNum, transposeK, withScale, withMask, precision) = obj.param;
+
+        std::ostringstream result;
+        result << "Q=" << CommonTestUtils::vec2str(qShape) << "_";
+        result << "Sk=" << keysNum << "_";
+        result << "transposeK=" << transposeK << "_";
+        result << "scale=" << withScale << "_";
+        result << "mask=" << withMask << "_";
+        result << "Prc=" << precision.name();
+        return result.str();
+    }
+
+protected:
+    InferenceEngine::Blob::Ptr GenerateInput(const InferenceEngine::InputInfo& info) const override {
+        // small values keep the softmax far from saturation, so the result depends on every input
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 2, -1, 100);
+    }
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        SizeVector qShape;
+        size_t keysNum;
+        bool transposeK, withScale, withMask;
+        Precision precision;
+        std::tie(qShape, keysNum, transposeK, withScale, withMask, precision) = this->GetParam();
+
+        if (precision == Precision::BF16) {
+            configuration[PluginConfigParams::KEY_ENFORCE_BF16] = PluginConfigParams::YES;
+            threshold = 0.05f;
+        }
+        selectedType = std::string("ref_any_") + precision.name();
+
+        const size_t rank = qShape.size();
+        const size_t headSize = qShape[rank - 1];
+        SizeVector kShape = qShape, vShape = qShape;
+        kShape[rank - 2] = keysNum;
+        if (transposeK)
+            std::swap(kShape[rank - 2], kShape[rank - 1]);
+        vShape[rank - 2] = keysNum;
+
+        std::vector<SizeVector> inputShapes = {qShape, kShape, vShape};
+        if (withMask) {
+            SizeVector maskShape(rank, 1);
+            maskShape[rank - 1] = keysNum;
+            inputShapes.push_back(maskShape);
+        }
+        auto inputParams = builder::makeParams(element::f32, inputShapes);
+
+        std::shared_ptr<Node> scores = std::make_shared<opset1::MatMul>(inputParams[0], inputParams[1], false, !transposeK);
+        if (withScale)
+            scores = std::make_shared<opset1::Multiply>(scores, opset1::Constant::create(element::f32, Shape{},
+                                                                                         {1.f / std::sqrt(static_cast<float>(headSize))}));
+        if (withMask)
+            scores = std::make_shared<opset1::Add>(scores, inputParams[3]);
+        auto softmax = std::make_shared<opset1::Softmax>(scores, rank - 1);
+        auto output = std::make_shared<opset1::MatMul>(softmax, inputParams[2]);
+
+        ResultVector results{std::make_shared<opset1::Result>(output)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "ScaledAttention");
+    }
+};
+
+TEST_P(ScaledAttentionFusionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "ScaledAttention", 1);
+    CheckNodeOfTypeCount(executableNetwork, "MatMul", 0);
+    CheckNodeOfTypeCount(executableNetwork, "Softmax", 0);
+    CheckPluginRelatedResults(executableNetwork, "ScaledAttention");
+}
+
+namespace {
+
+// the node processes 32 queries by 64 keys, the shapes cover both the full tiles and the tails
+const std::vector<SizeVector> queryShapes = {
+    {2, 4, 40, 16},
+    {3, 33, 24},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ScaledAttentionFusion, ScaledAttentionFusionTest,
+                         ::testing::Combine(::testing::ValuesIn(queryShapes),
+                                            ::testing::Values(64, 80),
+                                            ::testing::Bool(),
+                                            ::testing::Bool(),
+                                            ::testing::Bool(),
+                                            ::testing::Values(Precision::FP32, Precision::BF16)),
+                         ScaledAttentionFusionTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
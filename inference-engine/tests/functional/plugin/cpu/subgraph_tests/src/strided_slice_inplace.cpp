@@ -0,0 +1,98 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using StridedSliceInPlaceTestParams = std::tuple<SizeVector,              // input shape
+                                                 std::vector<int64_t>,    // begin
+                                                 std::vector<int64_t>>;   // end
+
+/*  The contiguous part of the planar input is passed to the convolution as the memory view with the offset,
+    the slices of the strided or noncontiguous regions are still copied.
+
+    ---------
+    |Input  |
+    ---------
+        |
+    --------------
+    |StridedSlice|
+    --------------
+        |
+    -------------
+    |Convolution|
+    -------------
+        |
+    ---------
+    |Output |
+    ---------
+*/
+
+class StridedSliceInPlaceTest : public testing::WithParamInterface<StridedSliceInPlaceTestParams>,
+                                public CPUTestsBase,
+                                virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<StridedSliceInPlaceTestParams> obj) {
+        SizeVector inputShape;
+        std::vector<int64_t> begin, end;
+        std::tie(inputShape, begin, end) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "begin=" << CommonTestUtils::vec2str(begin) << "_";
+        result << "end=" << CommonTestUtils::vec2str(end);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        SizeVector inputShape;
+        std::vector<int64_t> begin, end;
+        std::tie(inputShape, begin, end) = this->GetParam();
+
+        auto inputParams = builder::makeParams(element::f32, {inputShape});
+        const std::vector<int64_t> mask(inputShape.size(), 0);
+        auto stridedSlice = builder::makeStridedSlice(inputParams[0], begin, end, std::vector<int64_t>(inputShape.size(), 1),
+                                                      element::f32, mask, mask);
+        auto conv = builder::makeConvolution(stridedSlice, element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                             op::PadType::EXPLICIT, 8);
+
+        ResultVector results{std::make_shared<opset8::Result>(conv)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "StridedSliceInPlace");
+    }
+};
+
+TEST_P(StridedSliceInPlaceTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const std::vector<StridedSliceInPlaceTestParams> stridedSliceInPlaceParams = {
+    // contiguous views
+    StridedSliceInPlaceTestParams{{1, 16, 10, 10}, {0, 4, 0, 0}, {1, 12, 10, 10}},
+    StridedSliceInPlaceTestParams{{1, 16, 10, 10}, {0, -8, 0, 0}, {1, 16, 10, 10}},
+    StridedSliceInPlaceTestParams{{4, 8, 6, 6}, {1, 0, 0, 0}, {3, 8, 6, 6}},
+    // noncontiguous regions
+    StridedSliceInPlaceTestParams{{2, 16, 10, 10}, {0, 4, 0, 0}, {2, 12, 10, 10}},
+    StridedSliceInPlaceTestParams{{1, 16, 10, 10}, {0, 4, 2, 0}, {1, 12, 8, 10}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_StridedSliceInPlace, StridedSliceInPlaceTest, ::testing::ValuesIn(stridedSliceInPlaceParams),
+                         StridedSliceInPlaceTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,135 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using NearestModes = std::pair<op::v4::Interpolate::CoordinateTransformMode, op::v4::Interpolate::NearestMode>;
+
+using UpsampleConvTestParams = std::tuple<SizeVector,    // input shape
+                                          size_t,        // output channels
+                                          size_t,        // kernel size
+                                          NearestModes>; // coordinate transformation and nearest modes
+
+/*  The nearest x2 upsampling followed by the "same" convolution is executed as a stride 2 deconvolution
+    on the original input, the result must match the reference of the original graph.
+
+    ---------
+    |Input  |
+    ---------
+        |
+    ---------------------
+    |Interpolate nearest|
+    |        x2         |
+    ---------------------
+        |
+    ---------------------
+    |Convolution K x K  |
+    |pads K / 2         |
+    ---------------------
+        |
+    ---------
+    |Output |
+    ---------
+*/
+
+class UpsampleConvToDeconvTest : public testing::WithParamInterface<UpsampleConvTestParams>,
+                                 public CPUTestsBase,
+                                 virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<UpsampleConvTestParams> obj) {
+        SizeVector inputShape;
+        size_t outChannels, kernel;
+        NearestModes modes;
+        std::tie(inputShape, outChannels, kernel, modes) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "OC=" << outChannels << "_";
+        result << "K=" << kernel << "_";
+        result << "coordMode=" << modes.first << "_";
+        result << "nearestMode=" << modes.second;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        SizeVector inputShape;
+        size_t outChannels, kernel;
+        NearestModes modes;
+        std::tie(inputShape, outChannels, kernel, modes) = this->GetParam();
+
+        const size_t spatialRank = inputShape.size() - 2;
+        std::vector<int64_t> sizes, axes;
+        std::vector<float> scales(spatialRank, 2.f);
+        for (size_t i = 2; i < inputShape.size(); i++) {
+            sizes.push_back(static_cast<int64_t>(2 * inputShape[i]));
+            axes.push_back(static_cast<int64_t>(i));
+        }
+
+        auto inputParams = builder::makeParams(element::f32, {inputShape});
+        const op::v4::Interpolate::InterpolateAttrs attrs(op::v4::Interpolate::InterpolateMode::NEAREST,
+                                                          op::v4::Interpolate::ShapeCalcMode::SIZES,
+                                                          std::vector<size_t>(inputShape.size(), 0),
+                                                          std::vector<size_t>(inputShape.size(), 0),
+                                                          modes.first, modes.second);
+        auto interp = std::make_shared<opset4::Interpolate>(inputParams[0],
+                                                            opset4::Constant::create(element::i64, Shape{sizes.size()}, sizes),
+                                                            opset4::Constant::create(element::f32, Shape{scales.size()}, scales),
+                                                            opset4::Constant::create(element::i64, Shape{axes.size()}, axes),
+                                                            attrs);
+        auto conv = builder::makeConvolution(interp, element::f32, std::vector<size_t>(spatialRank, kernel),
+                                             std::vector<size_t>(spatialRank, 1),
+                                             std::vector<ptrdiff_t>(spatialRank, kernel / 2),
+                                             std::vector<ptrdiff_t>(spatialRank, kernel / 2),
+                                             std::vector<size_t>(spatialRank, 1), op::PadType::EXPLICIT, outChannels);
+
+        ResultVector results{std::make_shared<opset4::Result>(conv)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "UpsampleConvToDeconv");
+    }
+};
+
+TEST_P(UpsampleConvToDeconvTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Interpolate", 0);
+    CheckNodeOfTypeCount(executableNetwork, "Convolution", 0);
+    CheckNodeOfTypeCount(executableNetwork, "Deconvolution", 1);
+}
+
+namespace {
+
+const std::vector<NearestModes> replicationModes = {
+    {op::v4::Interpolate::CoordinateTransformMode::ASYMMETRIC, op::v4::Interpolate::NearestMode::FLOOR},
+    {op::v4::Interpolate::CoordinateTransformMode::HALF_PIXEL, op::v4::Interpolate::NearestMode::ROUND_PREFER_FLOOR},
+    {op::v4::Interpolate::CoordinateTransformMode::TF_HALF_PIXEL_FOR_NN, op::v4::Interpolate::NearestMode::SIMPLE},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_UpsampleConvToDeconv_2D, UpsampleConvToDeconvTest,
+                         ::testing::Combine(::testing::Values(SizeVector{1, 8, 7, 9}, SizeVector{2, 3, 16, 16}),
+                                            ::testing::Values(4, 16),
+                                            ::testing::Values(1, 3, 5),
+                                            ::testing::ValuesIn(replicationModes)),
+                         UpsampleConvToDeconvTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_UpsampleConvToDeconv_3D, UpsampleConvToDeconvTest,
+                         ::testing::Combine(::testing::Values(SizeVector{1, 4, 5, 6, 7}),
+                                            ::testing::Values(8),
+                                            ::testing::Values(3),
+                                            ::testing::Values(replicationModes[0])),
+                         UpsampleConvToDeconvTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
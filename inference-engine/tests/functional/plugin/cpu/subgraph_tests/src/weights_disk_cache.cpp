@@ -0,0 +1,82 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include <cpu/cpu_config.hpp>
+
+#include <algorithm>
+#include <fstream>
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *      Parameter    Constant (weights are reordered to the blocked layout
+ *             \    /         and persisted in the cache directory)
+ *          Convolution
+ *               |
+ *             Result
+ */
+
+class WeightsDiskCacheTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        cacheDir = GetTestName() + "_weights_cache";
+        configuration[CPUConfigParams::KEY_CPU_WEIGHTS_CACHE_DIR] = cacheDir;
+
+        auto inputParams = ngraph::builder::makeParams(ngraph::element::f32, {{1, 32, 10, 10}});
+        auto conv = ngraph::builder::makeConvolution(inputParams[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 32);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset8::Result>(conv)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "WeightsDiskCache");
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "wblob");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    std::vector<std::string> getEntries() const {
+        auto entries = CommonTestUtils::listFilesWithExt(cacheDir, "wblob");
+        std::sort(entries.begin(), entries.end());
+        return entries;
+    }
+
+    std::string cacheDir;
+};
+
+namespace {
+    TEST_F(WeightsDiskCacheTest, smoke_WeightsDiskCache_StoreAndReload_CPU) {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+        // the first load stores the reordered weights
+        Run();
+        const auto entries = getEntries();
+        ASSERT_FALSE(entries.empty());
+
+        // the second load takes them from the cache, the entries are found by the same names
+        Run();
+        ASSERT_EQ(entries, getEntries());
+
+        // corrupted entries are rejected by the checksum and the weights are reordered again
+        for (const auto& entry : entries) {
+            std::fstream file(entry, std::ios::in | std::ios::out | std::ios::binary);
+            ASSERT_TRUE(file.is_open()) << entry;
+            file.seekg(-1, std::ios::end);
+            const char last = static_cast<char>(file.get());
+            file.seekp(-1, std::ios::end);
+            file.put(static_cast<char>(~last));
+        }
+        Run();
+        ASSERT_EQ(entries, getEntries());
+    }
+} // namespace
+} // namespace SubgraphTestsDefinitions
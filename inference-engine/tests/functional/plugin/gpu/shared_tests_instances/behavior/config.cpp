@@ -25,7 +25,9 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CONFIG_FILE, "unknown_file"}},
             {{InferenceEngine::PluginConfigParams::KEY_DUMP_KERNELS, "ON"}},
             {{InferenceEngine::PluginConfigParams::KEY_TUNING_MODE, "TUNING_UNKNOWN_MODE"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DEVICE_ID, "DEVICE_UNKNOWN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DEVICE_ID, "DEVICE_UNKNOWN"}},
+            {{InferenceEngine::GPUConfigParams::KEY_GPU_KERNELS_CACHE_MAX_SIZE, "-1"}},
+            {{InferenceEngine::GPUConfigParams::KEY_GPU_BRANCH_QUEUES, "0"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
@@ -134,6 +136,14 @@ namespace {
             {{InferenceEngine::GPUConfigParams::KEY_GPU_MAX_NUM_THREADS, "4"}},
             {{InferenceEngine::GPUConfigParams::KEY_GPU_ENABLE_LOOP_UNROLLING, InferenceEngine::PluginConfigParams::YES}},
             {{InferenceEngine::GPUConfigParams::KEY_GPU_ENABLE_LOOP_UNROLLING, InferenceEngine::PluginConfigParams::NO}},
+            {{InferenceEngine::GPUConfigParams::KEY_GPU_KERNELS_CACHE_MAX_SIZE, "0"}},
+            {{InferenceEngine::GPUConfigParams::KEY_GPU_KERNELS_CACHE_MAX_SIZE, "512"}},
+            {{InferenceEngine::GPUConfigParams::KEY_GPU_SIZE_CLASS_MEMORY_POOL, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::GPUConfigParams::KEY_GPU_SIZE_CLASS_MEMORY_POOL, InferenceEngine::PluginConfigParams::NO}},
+            {{InferenceEngine::GPUConfigParams::KEY_GPU_BRANCH_QUEUES, "1"}},
+            {{InferenceEngine::GPUConfigParams::KEY_GPU_BRANCH_QUEUES, "4"}},
+            {{InferenceEngine::GPUConfigParams::KEY_GPU_SHARE_CONSTANTS, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::GPUConfigParams::KEY_GPU_SHARE_CONSTANTS, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT, InferenceEngine::PluginConfigParams::THROUGHPUT}},
             {{InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT, InferenceEngine::PluginConfigParams::LATENCY}},
             {{InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT, InferenceEngine::PluginConfigParams::LATENCY},
@@ -188,6 +188,47 @@ INSTANTIATE_TEST_SUITE_P(
         ::testing::Values("GPU")
 );
 
+using IEClassExecutableNetworkGetMetricTest_GPU_MEMORY_FOOTPRINT = IEClassBaseTestP;
+TEST_P(IEClassExecutableNetworkGetMetricTest_GPU_MEMORY_FOOTPRINT, GetMetricNoThrow) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    Core ie;
+    Parameter p;
+
+    // single stream, so the records of the first graph describe all buffers of the network
+    ExecutableNetwork exeNetwork = ie.LoadNetwork(simpleNetwork, deviceName,
+                                                  {{PluginConfigParams::KEY_GPU_THROUGHPUT_STREAMS, "1"}});
+
+    ASSERT_NO_THROW(p = exeNetwork.GetMetric(GPU_METRIC_KEY(MEMORY_FOOTPRINT)));
+    std::map<std::string, uint64_t> t = p;
+    ASSERT_EQ(5u, t.size());
+    ASSERT_EQ(t.at("total"), t.at("weights") + t.at("intermediates") + t.at("inputs_outputs") + t.at("kernels"));
+    ASSERT_GT(t.at("weights"), 0u);
+    ASSERT_GT(t.at("inputs_outputs"), 0u);
+    ASSERT_GT(t.at("kernels"), 0u);
+
+    ASSERT_NO_THROW(p = exeNetwork.GetMetric(GPU_METRIC_KEY(PRIMITIVES_MEMORY_RECORDS)));
+    std::map<std::string, std::pair<uint64_t, uint64_t>> records = p;
+    ASSERT_FALSE(records.empty());
+
+    // primitives which share a record report the same buffer, every buffer is counted once in the footprint
+    std::map<uint64_t, uint64_t> recordBytes;
+    for (auto &&record : records) {
+        ASSERT_GT(record.second.second, 0u) << record.first;
+        auto inserted = recordBytes.insert(record.second);
+        ASSERT_EQ(inserted.first->second, record.second.second) << record.first;
+    }
+    uint64_t buffersBytes = 0;
+    for (auto &&record : recordBytes) {
+        buffersBytes += record.second;
+    }
+    ASSERT_EQ(t.at("weights") + t.at("intermediates") + t.at("inputs_outputs"), buffersBytes);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+        nightly_IEClassExecutableNetworkGetMetricTest, IEClassExecutableNetworkGetMetricTest_GPU_MEMORY_FOOTPRINT,
+        ::testing::Values("GPU")
+);
+
 INSTANTIATE_TEST_SUITE_P(
         nightly_IEClassExecutableNetworkGetMetricTest, IEClassExecutableNetworkGetMetricTest_OPTIMAL_NUMBER_OF_INFER_REQUESTS,
         ::testing::Values("GPU", "MULTI:GPU", "HETERO:GPU", "AUTO:GPU,CPU")
@@ -150,6 +150,10 @@ std::vector<std::map<std::string, std::string>> getCorrectConfigs() {
         {{InferenceEngine::MYRIAD_ENABLE_ASYNC_DMA, CONFIG_VALUE(YES)}},
         {{InferenceEngine::MYRIAD_ENABLE_ASYNC_DMA, CONFIG_VALUE(NO)}},
 
+        {{InferenceEngine::MYRIAD_FIFO_DEPTH, InferenceEngine::MYRIAD_FIFO_DEPTH_AUTO}},
+        {{InferenceEngine::MYRIAD_FIFO_DEPTH, "1"}},
+        {{InferenceEngine::MYRIAD_FIFO_DEPTH, "8"}},
+
         // Deprecated
         {{VPU_CONFIG_KEY(LOG_LEVEL), LOG_NONE}},
         {{VPU_CONFIG_KEY(LOG_LEVEL), LOG_ERROR}},
@@ -312,6 +316,7 @@ const std::vector<std::pair<std::string, InferenceEngine::Parameter>>& getDefaul
         {InferenceEngine::MYRIAD_ENABLE_CUSTOM_RESHAPE_PARAM, {false}},
         {InferenceEngine::MYRIAD_NONE_LAYERS, {std::string()}},
         {InferenceEngine::MYRIAD_ENABLE_ASYNC_DMA, {true}},
+        {InferenceEngine::MYRIAD_FIFO_DEPTH, {InferenceEngine::MYRIAD_FIFO_DEPTH_AUTO}},
     };
     return defaultEntries;
 }
@@ -564,6 +569,9 @@ const std::vector<std::tuple<std::string, std::string, InferenceEngine::Paramete
             InferenceEngine::Parameter{true}),
         std::make_tuple(InferenceEngine::MYRIAD_ENABLE_ASYNC_DMA, InferenceEngine::PluginConfigParams::NO,
             InferenceEngine::Parameter{false}),
+
+        std::make_tuple(InferenceEngine::MYRIAD_FIFO_DEPTH, "1", InferenceEngine::Parameter{"1"}),
+        std::make_tuple(InferenceEngine::MYRIAD_FIFO_DEPTH, "8", InferenceEngine::Parameter{"8"}),
     };
     return customEntries;
 }
@@ -642,6 +650,7 @@ const std::vector<std::string>& getPrivateOptions() {
         InferenceEngine::MYRIAD_ENABLE_CUSTOM_RESHAPE_PARAM,
         InferenceEngine::MYRIAD_NONE_LAYERS,
         InferenceEngine::MYRIAD_ENABLE_ASYNC_DMA,
+        InferenceEngine::MYRIAD_FIFO_DEPTH,
     };
     return privateOptions;
 }
@@ -767,6 +776,10 @@ const std::vector<std::map<std::string, std::string>>& getIncorrectConfigs() {
         {{InferenceEngine::MYRIAD_ENABLE_ASYNC_DMA, "ON"}},
         {{InferenceEngine::MYRIAD_ENABLE_ASYNC_DMA, "OFF"}},
 
+        {{InferenceEngine::MYRIAD_FIFO_DEPTH, "0"}},
+        {{InferenceEngine::MYRIAD_FIFO_DEPTH, "-1"}},
+        {{InferenceEngine::MYRIAD_FIFO_DEPTH, "Two"}},
+
         // Deprecated
         {{VPU_CONFIG_KEY(LOG_LEVEL), "INCORRECT_LOG_LEVEL"}},
 
@@ -0,0 +1,161 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+
+using AutoBatchParams = std::tuple<
+        std::string,    // device name
+        bool,           // set the user blobs, otherwise the blobs of the request are filled
+        size_t>;        // batch size
+
+class AutoBatching_Test : public CommonTestUtils::TestsCommon,
+                          public testing::WithParamInterface<AutoBatchParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchParams>& obj) {
+        std::string deviceName;
+        bool useSetBlob;
+        size_t batchSize;
+        std::tie(deviceName, useSetBlob, batchSize) = obj.param;
+        return "device_name=" + deviceName + "_" +
+               (useSetBlob ? "set_blob" : "get_blob") + "_" +
+               "batch_size=" + std::to_string(batchSize);
+    }
+
+protected:
+    void SetUp() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+        std::tie(deviceName, useSetBlob, batchSize) = this->GetParam();
+        function = ngraph::builder::subgraph::makeSingleConv();
+    }
+
+    void TearDown() override {
+        PluginCache::get().reset();
+    }
+
+    std::string batchDevice() const {
+        return std::string(CommonTestUtils::DEVICE_BATCH) + ":" + deviceName + "(" + std::to_string(batchSize) + ")";
+    }
+
+    // runs the requests twice and compares every result with the reference of its own input,
+    // so the data of the different slots of the batch can not be mixed up unnoticed
+    void RunRequests(size_t numRequests, const std::string& timeout, int64_t waitMs) {
+        InferenceEngine::CNNNetwork net(function);
+        const auto inputName = net.getInputsInfo().begin()->first;
+        const auto outputName = net.getOutputsInfo().begin()->first;
+
+        auto ie = PluginCache::get().ie();
+        auto execNet = ie->LoadNetwork(net, batchDevice(), {{CONFIG_KEY(AUTO_BATCH_TIMEOUT), timeout}});
+        const auto inputDesc = execNet.GetInputsInfo().at(inputName)->getTensorDesc();
+        const auto outputDesc = execNet.GetOutputsInfo().at(outputName)->getTensorDesc();
+
+        std::vector<InferenceEngine::InferRequest> requests;
+        std::vector<InferenceEngine::Blob::Ptr> outputs;
+        std::vector<std::vector<uint8_t>> refs;
+        for (size_t i = 0; i < numRequests; i++) {
+            auto request = execNet.CreateInferRequest();
+            auto input = FuncTestUtils::createAndFillBlob(inputDesc, 10, 0, 1, static_cast<int>(i + 1));
+            if (useSetBlob) {
+                // the blobs of the user are copied to the slot of the batch and back
+                request.SetBlob(inputName, input);
+                auto output = make_blob_with_precision(outputDesc);
+                output->allocate();
+                request.SetBlob(outputName, output);
+            } else {
+                // the blobs of the request are the views to its slot of the batch
+                auto slot = InferenceEngine::as<InferenceEngine::MemoryBlob>(request.GetBlob(inputName));
+                ASSERT_NE(nullptr, slot);
+                ASSERT_EQ(input->byteSize(), slot->byteSize());
+                auto inputMemory = InferenceEngine::as<InferenceEngine::MemoryBlob>(input)->rmap();
+                std::memcpy(slot->wmap().as<uint8_t*>(), inputMemory.as<const uint8_t*>(), input->byteSize());
+            }
+            outputs.push_back(request.GetBlob(outputName));
+            auto inputMemory = InferenceEngine::as<InferenceEngine::MemoryBlob>(input)->rmap();
+            const auto inputData = inputMemory.as<const uint8_t*>();
+            refs.push_back(ngraph::helpers::interpreterFunction(function,
+                                                                {std::vector<uint8_t>(inputData, inputData + input->byteSize())})
+                                   .front().second);
+            requests.push_back(request);
+        }
+
+        for (int iteration = 0; iteration < 2; iteration++) {
+            // the results of the previous iteration must not pass for the new ones
+            for (auto& output : outputs) {
+                std::memset(InferenceEngine::as<InferenceEngine::MemoryBlob>(output)->wmap().as<uint8_t*>(), 0, output->byteSize());
+            }
+            for (auto& request : requests) {
+                request.StartAsync();
+            }
+            for (auto& request : requests) {
+                ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(waitMs));
+            }
+            for (size_t i = 0; i < numRequests; i++) {
+                const auto output = requests[i].GetBlob(outputName);
+                ASSERT_EQ(outputs[i], output);
+                ASSERT_EQ(refs[i].size(), output->byteSize());
+                auto outputMemory = InferenceEngine::as<InferenceEngine::MemoryBlob>(output)->rmap();
+                FuncTestUtils::compareRawBuffers(outputMemory.as<const float*>(), reinterpret_cast<const float*>(refs[i].data()),
+                                                 output->size(), output->size(), thr);
+            }
+        }
+    }
+
+    std::string deviceName;
+    bool useSetBlob;
+    size_t batchSize;
+    std::shared_ptr<ngraph::Function> function;
+    const float thr = 0.01f;
+};
+
+TEST_P(AutoBatching_Test, canInferFullBatches) {
+    // the timeout is far longer than the wait, so the requests are completed by the batched inference only
+    RunRequests(2 * batchSize, "60000", 10000);
+}
+
+TEST_P(AutoBatching_Test, canInferNotFullBatchOnTimeout) {
+    // the batch is never full, so the requests are executed one by one by the network without batch
+    if (batchSize < 2)
+        GTEST_SKIP();
+    RunRequests(batchSize - 1, "1", InferenceEngine::InferRequest::RESULT_READY);
+}
+
+TEST_P(AutoBatching_Test, canSetTimeoutOfExecutableNetwork) {
+    InferenceEngine::CNNNetwork net(function);
+    auto ie = PluginCache::get().ie();
+    auto execNet = ie->LoadNetwork(net, batchDevice());
+    ASSERT_EQ(std::string("1000"), execNet.GetConfig(CONFIG_KEY(AUTO_BATCH_TIMEOUT)).as<std::string>());
+    ASSERT_EQ(deviceName + "(" + std::to_string(batchSize) + ")",
+              execNet.GetConfig(CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG)).as<std::string>());
+
+    ASSERT_NO_THROW(execNet.SetConfig({{CONFIG_KEY(AUTO_BATCH_TIMEOUT), std::string("10")}}));
+    ASSERT_EQ(std::string("10"), execNet.GetConfig(CONFIG_KEY(AUTO_BATCH_TIMEOUT)).as<std::string>());
+
+    ASSERT_THROW(execNet.SetConfig({{CONFIG_KEY(AUTO_BATCH_TIMEOUT), std::string("-1")}}), InferenceEngine::Exception);
+    ASSERT_THROW(execNet.SetConfig({{CONFIG_KEY(AUTO_BATCH_TIMEOUT), std::string("ten")}}), InferenceEngine::Exception);
+    ASSERT_THROW(execNet.SetConfig({{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), deviceName + "(1)"}}), InferenceEngine::Exception);
+    ASSERT_EQ(std::string("10"), execNet.GetConfig(CONFIG_KEY(AUTO_BATCH_TIMEOUT)).as<std::string>());
+}
+
+TEST_P(AutoBatching_Test, canNotLoadNetworkWithoutBatchInInputs) {
+    InferenceEngine::CNNNetwork net(ngraph::builder::subgraph::makeSingleConv({2, 3, 24, 24}));
+    auto ie = PluginCache::get().ie();
+    ASSERT_THROW(ie->LoadNetwork(net, batchDevice()), InferenceEngine::NotImplemented);
+}
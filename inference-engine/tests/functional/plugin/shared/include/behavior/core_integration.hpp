@@ -421,6 +421,15 @@ TEST(IEClassBasicTest, smoke_SetConfigHeteroNoThrow) {
     ASSERT_NO_THROW(ie.SetConfig({{HETERO_CONFIG_KEY(DUMP_GRAPH_DOT), NO}}, CommonTestUtils::DEVICE_HETERO));
     ASSERT_NO_THROW(value = ie.GetConfig("HETERO", HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)).as<bool>());
     ASSERT_FALSE(value);
+
+    ASSERT_NO_THROW(ie.SetConfig({{HETERO_CONFIG_KEY(COST_MODEL_AFFINITY), YES}}, CommonTestUtils::DEVICE_HETERO));
+    ASSERT_NO_THROW(value = ie.GetConfig("HETERO", HETERO_CONFIG_KEY(COST_MODEL_AFFINITY)).as<bool>());
+    ASSERT_TRUE(value);
+
+    ASSERT_NO_THROW(ie.SetConfig({{HETERO_CONFIG_KEY(COST_MODEL_AFFINITY), NO}}, CommonTestUtils::DEVICE_HETERO));
+    ASSERT_NO_THROW(value = ie.GetConfig("HETERO", HETERO_CONFIG_KEY(COST_MODEL_AFFINITY)).as<bool>());
+    ASSERT_FALSE(value);
+    ASSERT_THROW(ie.SetConfig({{HETERO_CONFIG_KEY(COST_MODEL_AFFINITY), "ON"}}, CommonTestUtils::DEVICE_HETERO), Exception);
 }
 
 //
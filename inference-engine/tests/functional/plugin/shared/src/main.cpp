@@ -6,6 +6,7 @@
 
 #include "functional_test_utils/layer_test_utils/environment.hpp"
 #include "functional_test_utils/layer_test_utils/summary.hpp"
+#include "functional_test_utils/layer_test_utils/benchmark.hpp"
 #include "functional_test_utils/skip_tests_config.hpp"
 
 int main(int argc, char *argv[]) {
@@ -32,6 +33,22 @@ int main(int argc, char *argv[]) {
                 throw std::runtime_error("Incorrect value of \"--save_report_timeout\" argument");
             }
             LayerTestsUtils::Summary::setSaveReportTimeout(timeout);
+        } else if (std::string(argv[i]) == "--benchmark") {
+            LayerTestsUtils::BenchmarkReport::setEnabled(true);
+        } else if (std::string(argv[i]).find("--benchmark_warmup") != std::string::npos) {
+            try {
+                LayerTestsUtils::BenchmarkReport::setWarmup(std::stoi(std::string(argv[i]).substr(std::string("--benchmark_warmup").length() + 1)));
+            } catch (...) {
+                throw std::runtime_error("Incorrect value of \"--benchmark_warmup\" argument");
+            }
+        } else if (std::string(argv[i]).find("--benchmark_repeats") != std::string::npos) {
+            try {
+                LayerTestsUtils::BenchmarkReport::setRepeats(std::stoi(std::string(argv[i]).substr(std::string("--benchmark_repeats").length() + 1)));
+            } catch (...) {
+                throw std::runtime_error("Incorrect value of \"--benchmark_repeats\" argument");
+            }
+        } else if (std::string(argv[i]).find("--benchmark_report") != std::string::npos) {
+            LayerTestsUtils::BenchmarkReport::setReportPath(std::string(argv[i]).substr(std::string("--benchmark_report").length() + 1));
         }
     }
 
@@ -51,6 +68,19 @@ int main(int argc, char *argv[]) {
                   "Mutually exclusive with --extend_report." << std::endl;
         std::cout << "  --save_report_timeout" << std::endl;
         std::cout << "       Allow to try to save report in cycle using timeout (in seconds). " << std::endl;
+        std::cout << "  --benchmark" << std::endl;
+        std::cout << "       Time the layer tests after the validation and save the median times of the inference" <<
+                  " and of every executed node to the JSON report. The kernels of the other ISA are timed by the runs" <<
+                  " with ONEDNN_MAX_CPU_ISA set (e.g. AVX2, AVX512_CORE, AVX512_CORE_AMX)" << std::endl;
+        std::cout << "  --benchmark_warmup" << std::endl;
+        std::cout << "       Number of the inferences before the timing (10 by default). Example is --benchmark_warmup=20"
+                  << std::endl;
+        std::cout << "  --benchmark_repeats" << std::endl;
+        std::cout << "       Number of the timed inferences (100 by default). Example is --benchmark_repeats=1000"
+                  << std::endl;
+        std::cout << "  --benchmark_report" << std::endl;
+        std::cout << "       Path of the benchmark report (benchmark_report.json by default)."
+                  << " Example is --benchmark_report=/home/user/avx2.json" << std::endl;
         std::cout << std::endl;
     }
 
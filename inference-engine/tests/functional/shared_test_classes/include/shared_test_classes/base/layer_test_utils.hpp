@@ -140,6 +140,9 @@ protected:
 
     virtual void Infer();
 
+    // Times the inference request of the validated test case in the benchmark mode
+    virtual void Benchmark();
+
     TargetDevice targetDevice;
     std::shared_ptr<ngraph::Function> function;
     std::shared_ptr<ngraph::Function> functionRefs;
@@ -7,6 +7,7 @@
 #include <process.h>
 #endif
 
+#include <chrono>
 #include <thread>
 
 #include "pugixml.hpp"
@@ -59,6 +60,9 @@ void LayerTestsCommon::Run() {
     }
 
     try {
+        if (BenchmarkReport::isEnabled()) {
+            configuration[InferenceEngine::PluginConfigParams::KEY_PERF_COUNT] = InferenceEngine::PluginConfigParams::YES;
+        }
         LoadNetwork();
         size_t i = 0;
         do {
@@ -71,6 +75,9 @@ void LayerTestsCommon::Run() {
                 GenerateInputs();
                 Infer();
                 Validate();
+                if (BenchmarkReport::isEnabled()) {
+                    Benchmark();
+                }
                 s.updateOPsStats(functionRefs, PassRate::Statuses::PASSED);
             } catch (const std::exception &ex) {
                 std::string errorMessage;
@@ -439,6 +446,38 @@ void LayerTestsCommon::Infer() {
     inferRequest.Infer();
 }
 
+void LayerTestsCommon::Benchmark() {
+    // the tests with own inference don't keep the request
+    if (!inferRequest) {
+        return;
+    }
+
+    for (size_t i = 0; i < BenchmarkReport::getWarmup(); i++) {
+        inferRequest.Infer();
+    }
+
+    const size_t repeats = std::max<size_t>(1, BenchmarkReport::getRepeats());
+    std::vector<double> inferUs;
+    std::map<std::string, std::vector<InferenceEngine::InferenceEngineProfileInfo>> counters;
+    for (size_t i = 0; i < repeats; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        inferRequest.Infer();
+        inferUs.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+
+        for (const auto& counter : inferRequest.GetPerformanceCounts()) {
+            if (counter.second.status == InferenceEngine::InferenceEngineProfileInfo::EXECUTED) {
+                counters[counter.first].push_back(counter.second);
+            }
+        }
+    }
+
+    std::string testName = GetTestName();
+    if (!targetStaticShapes.empty()) {
+        testName += "_TS=" + CommonTestUtils::vec2str(targetStaticShapes[index]);
+    }
+    BenchmarkReport::getInstance().addTiming(testName, targetDevice, inferUs, counters);
+}
+
 std::vector<std::pair<ngraph::element::Type, std::vector<std::uint8_t>>> LayerTestsCommon::CalculateRefs() {
     ngraph::pass::ConvertPrecision<ngraph::element::Type_t::f16, ngraph::element::Type_t::f32>().run_on_function(functionRefs);
     ngraph::pass::ConvertPrecision<ngraph::element::Type_t::bf16, ngraph::element::Type_t::f32>().run_on_function(functionRefs);
@@ -7,6 +7,7 @@
 namespace CommonTestUtils {
 
 const char DEVICE_AUTO[] = "AUTO";
+const char DEVICE_BATCH[] = "BATCH";
 const char DEVICE_CPU[] = "CPU";
 const char DEVICE_GNA[] = "GNA";
 const char DEVICE_GPU[] = "GPU";
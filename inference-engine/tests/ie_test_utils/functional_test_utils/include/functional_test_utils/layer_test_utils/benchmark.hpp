@@ -0,0 +1,71 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <ie_common.h>
+
+namespace LayerTestsUtils {
+
+// Timings of the layer tests collected in the benchmark mode (--benchmark): every test case is inferred the warmup
+// times and then the repeats times with the performance counters, the medians of the executed nodes and of the whole
+// inference are saved to the JSON report when the tests are finished
+class BenchmarkReport {
+public:
+    struct NodeTiming {
+        std::string name;
+        std::string layerType;
+        std::string execType;
+        double medianUs;
+        double minUs;
+    };
+
+    struct TestTiming {
+        std::string test;
+        std::string device;
+        size_t repeats;
+        double inferMedianUs;
+        double inferMinUs;
+        std::vector<NodeTiming> nodes;
+    };
+
+    static BenchmarkReport &getInstance();
+
+    // the samples of the node are taken from the same repeats as the samples of the inference
+    void addTiming(const std::string &test, const std::string &device, const std::vector<double> &inferUs,
+                   const std::map<std::string, std::vector<InferenceEngine::InferenceEngineProfileInfo>> &counters);
+
+    void saveReport();
+
+    static void setEnabled(bool val) { enabled = val; }
+
+    static bool isEnabled() { return enabled; }
+
+    static void setWarmup(size_t val) { warmup = val; }
+
+    static size_t getWarmup() { return warmup; }
+
+    static void setRepeats(size_t val) { repeats = val; }
+
+    static size_t getRepeats() { return repeats; }
+
+    static void setReportPath(const std::string &val) { reportPath = val; }
+
+private:
+    BenchmarkReport() = default;
+
+    static bool enabled;
+    static size_t warmup;
+    static size_t repeats;
+    static std::string reportPath;
+
+    std::vector<TestTiming> timings;
+    bool isReported = false;
+};
+
+}  // namespace LayerTestsUtils
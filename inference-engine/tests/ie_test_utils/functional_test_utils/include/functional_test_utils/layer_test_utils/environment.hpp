@@ -9,6 +9,7 @@
 #include "ngraph/ngraph.hpp"
 
 #include "functional_test_utils/layer_test_utils/summary.hpp"
+#include "functional_test_utils/layer_test_utils/benchmark.hpp"
 
 namespace LayerTestsUtils {
 
@@ -16,6 +17,7 @@ class TestEnvironment : public ::testing::Environment {
 public:
     void TearDown() override {
         Summary::getInstance().saveReport();
+        BenchmarkReport::getInstance().saveReport();
     };
 };
 }  // namespace LayerTestsUtils
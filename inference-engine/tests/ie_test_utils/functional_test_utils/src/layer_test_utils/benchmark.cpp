@@ -0,0 +1,115 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "functional_test_utils/layer_test_utils/benchmark.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+
+using namespace LayerTestsUtils;
+
+bool BenchmarkReport::enabled = false;
+size_t BenchmarkReport::warmup = 10;
+size_t BenchmarkReport::repeats = 100;
+std::string BenchmarkReport::reportPath = "benchmark_report.json";
+
+namespace {
+double median(std::vector<double> values) {
+    if (values.empty())
+        return 0.0;
+    const auto middle = values.begin() + values.size() / 2;
+    std::nth_element(values.begin(), middle, values.end());
+    return *middle;
+}
+
+double minimum(const std::vector<double> &values) {
+    return values.empty() ? 0.0 : *std::min_element(values.begin(), values.end());
+}
+
+std::string quoted(const std::string &value) {
+    std::string result = "\"";
+    for (const char c : value) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+            result += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            result += ' ';
+        } else {
+            result += c;
+        }
+    }
+    return result + "\"";
+}
+
+// the ISA the kernels are limited to, the results for every ISA are collected by the runs with the variable set
+std::string maxCpuIsa() {
+    for (const char *name : {"ONEDNN_MAX_CPU_ISA", "DNNL_MAX_CPU_ISA"}) {
+        if (const char *value = std::getenv(name))
+            return value;
+    }
+    return "ALL";
+}
+}  // namespace
+
+BenchmarkReport &BenchmarkReport::getInstance() {
+    static BenchmarkReport instance;
+    return instance;
+}
+
+void BenchmarkReport::addTiming(const std::string &test, const std::string &device, const std::vector<double> &inferUs,
+                                const std::map<std::string, std::vector<InferenceEngine::InferenceEngineProfileInfo>> &counters) {
+    TestTiming timing{test, device, inferUs.size(), median(inferUs), minimum(inferUs), {}};
+    for (const auto &node : counters) {
+        if (node.second.empty())
+            continue;
+        std::vector<double> nodeUs;
+        for (const auto &info : node.second)
+            nodeUs.push_back(static_cast<double>(info.realTime_uSec));
+        const auto &info = node.second.back();
+        timing.nodes.push_back({node.first, info.layer_type, info.exec_type, median(nodeUs), minimum(nodeUs)});
+    }
+    timings.push_back(std::move(timing));
+}
+
+void BenchmarkReport::saveReport() {
+    if (!enabled || isReported)
+        return;
+
+    std::ofstream file(reportPath);
+    if (!file.is_open())
+        throw std::runtime_error("Can't open the benchmark report " + reportPath);
+
+    file << std::fixed << std::setprecision(3);
+    file << "{\n";
+    file << "  \"max_cpu_isa\": " << quoted(maxCpuIsa()) << ",\n";
+    file << "  \"warmup\": " << warmup << ",\n";
+    file << "  \"tests\": [";
+    for (size_t t = 0; t < timings.size(); t++) {
+        const auto &timing = timings[t];
+        file << (t ? "," : "") << "\n    {\n";
+        file << "      \"test\": " << quoted(timing.test) << ",\n";
+        file << "      \"device\": " << quoted(timing.device) << ",\n";
+        file << "      \"repeats\": " << timing.repeats << ",\n";
+        file << "      \"infer_median_us\": " << timing.inferMedianUs << ",\n";
+        file << "      \"infer_min_us\": " << timing.inferMinUs << ",\n";
+        file << "      \"nodes\": [";
+        for (size_t n = 0; n < timing.nodes.size(); n++) {
+            const auto &node = timing.nodes[n];
+            file << (n ? "," : "") << "\n        {";
+            file << "\"name\": " << quoted(node.name) << ", ";
+            file << "\"type\": " << quoted(node.layerType) << ", ";
+            file << "\"exec_type\": " << quoted(node.execType) << ", ";
+            file << "\"median_us\": " << node.medianUs << ", ";
+            file << "\"min_us\": " << node.minUs << "}";
+        }
+        file << (timing.nodes.empty() ? "]\n" : "\n      ]\n");
+        file << "    }";
+    }
+    file << (timings.empty() ? "]\n" : "\n  ]\n");
+    file << "}\n";
+    isReported = true;
+}
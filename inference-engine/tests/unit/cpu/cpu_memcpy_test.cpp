@@ -0,0 +1,43 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "nodes/common/cpu_memcpy.h"
+
+namespace {
+
+// the copies of the misaligned buffers of the sizes around the thresholds of the parallel and the streaming copies
+class CpuParallelMemcpyTest : public ::testing::TestWithParam<std::tuple<size_t, size_t>> {};
+
+TEST_P(CpuParallelMemcpyTest, CopiesAllBytes) {
+    size_t size, offset;
+    std::tie(size, offset) = GetParam();
+
+    std::vector<uint8_t> src(size + offset);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<uint8_t>(i * 131 + 7);
+    // the guard bytes around the destination detect the writes out of the range
+    std::vector<uint8_t> dst(size + 2 * offset + 2, 0xA5);
+
+    cpu_parallel_memcpy(dst.data() + offset + 1, src.data() + offset, size);
+
+    for (size_t i = 0; i < offset + 1; i++)
+        ASSERT_EQ(dst[i], 0xA5) << "i=" << i;
+    for (size_t i = 0; i < size; i++)
+        ASSERT_EQ(dst[offset + 1 + i], src[offset + i]) << "i=" << i;
+    for (size_t i = offset + 1 + size; i < dst.size(); i++)
+        ASSERT_EQ(dst[i], 0xA5) << "i=" << i;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_CpuParallelMemcpy, CpuParallelMemcpyTest,
+                         ::testing::Combine(::testing::Values(0, 1, 1000, 256 * 1024 - 1, 256 * 1024 + 3,
+                                                              3 * 1024 * 1024 + 17, 80 * 1024 * 1024 + 5),
+                                            ::testing::Values(0, 13)));
+
+}  // namespace
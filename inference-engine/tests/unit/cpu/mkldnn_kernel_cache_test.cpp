@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "mkldnn_kernel_cache.hpp"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+struct TestKernelBase {
+    virtual ~TestKernelBase() = default;
+    virtual void create_ker() = 0;
+    bool created = false;
+};
+
+struct TestKernel : public TestKernelBase {
+    explicit TestKernel(int param) : param(param) {}
+    void create_ker() override { created = true; }
+    int param;
+};
+
+}  // namespace
+
+TEST(KernelCacheTest, SharesKernelWithSameKey) {
+    std::string key;
+    appendKernelKey(key, 42);
+
+    auto first = createSharedKernel<TestKernelBase, TestKernel>(key, 42);
+    auto second = createSharedKernel<TestKernelBase, TestKernel>(key, 42);
+
+    EXPECT_TRUE(first->created);
+    EXPECT_EQ(first, second);
+}
+
+TEST(KernelCacheTest, EmptyKeyIsNotShared) {
+    auto first = createSharedKernel<TestKernelBase, TestKernel>("", 1);
+    auto second = createSharedKernel<TestKernelBase, TestKernel>("", 1);
+
+    EXPECT_TRUE(first->created);
+    EXPECT_NE(first, second);
+}
+
+TEST(KernelCacheTest, ReleasedKernelIsCreatedAgain) {
+    std::weak_ptr<TestKernelBase> released = createSharedKernel<TestKernelBase, TestKernel>("released", 1);
+    EXPECT_TRUE(released.expired());
+
+    auto kernel = createSharedKernel<TestKernelBase, TestKernel>("released", 2);
+    EXPECT_EQ(std::static_pointer_cast<TestKernel>(kernel)->param, 2);
+}
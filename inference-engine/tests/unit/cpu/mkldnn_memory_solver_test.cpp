@@ -273,3 +273,64 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+TEST(MemSolverTest, BestFitLinearAndEven) {
+    int n = 0;
+    std::vector<Box> boxes{   //  |
+            {n, ++n, 2},      //  |      ____
+            {n, ++n, 2},      //  |   __|____|__
+            {n, ++n, 2},      //  |__|____||____|__
+    };                        //      0  1  2  3
+
+    MKLDNNPlugin::MemorySolver ms(boxes, MKLDNNPlugin::MemorySolver::Strategy::BestFit);
+    EXPECT_EQ(ms.solve(), 4);
+    EXPECT_EQ(ms.maxDepth(), 4);
+    EXPECT_EQ(ms.maxTopDepth(), 2);
+}
+
+TEST(MemSolverTest, BestFitNoOverlapping) {
+    int n = 0;                //  |         _____________
+    std::vector<Box> boxes{   //  |   _____|___1_________|
+            {4, 8, 1, n++},   //  |  |_2_____|    ____
+            {6, 7, 3, n++},   //  |  |    |      |    |
+            {2, 3, 3, n++},   //  |__|_3__|______|_3__|___
+            {2, 4, 2, n++},   //      2  3  4  5  6  7  8
+            {5, 8, 2, n++},
+            {0, 9, 1, n++},
+    };
+
+    MKLDNNPlugin::MemorySolver ms(boxes, MKLDNNPlugin::MemorySolver::Strategy::BestFit);
+    const auto total = ms.solve();
+    EXPECT_GE(total, ms.maxDepth());
+
+    auto no_overlap = [&](Box box1, Box box2) -> bool {
+        int off1 = ms.getOffset(box1.id);
+        int off2 = ms.getOffset(box2.id);
+        return box1.finish < box2.start || box1.start > box2.finish ||
+               off1 + box1.size <= off2 || off1 >= off2 + box2.size;
+    };
+
+    for (int i = 0; i < n; i++) {
+        EXPECT_LE(ms.getOffset(boxes[i].id) + boxes[i].size, total);
+        for (int j = i + 1; j < n; j++)
+            ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
+    }
+}
+
+TEST(MemSolverTest, AlignedOffsets) {
+    int n = 0;
+    std::vector<Box> boxes{
+            {0, 1, 3, n++},
+            {1, 2, 5, n++},
+            {1, 3, 1, n++},
+            {2, 3, 2, n++},
+    };
+    const std::map<int64_t, int64_t> alignments{{1, 4}, {2, 4}, {3, 8}};
+
+    for (auto strategy : {MKLDNNPlugin::MemorySolver::Strategy::Greedy, MKLDNNPlugin::MemorySolver::Strategy::BestFit}) {
+        MKLDNNPlugin::MemorySolver ms(boxes, strategy, alignments);
+        ms.solve();
+        for (const auto& alignment : alignments)
+            EXPECT_EQ(ms.getOffset(alignment.first) % alignment.second, 0);
+    }
+}
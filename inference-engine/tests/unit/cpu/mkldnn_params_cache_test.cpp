@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "mkldnn_params_cache.hpp"
+
+using namespace MKLDNNPlugin;
+
+TEST(ParamsCacheTest, ReturnsCachedObject) {
+    MKLDNNParamsCache cache(4);
+    int created = 0;
+    auto builder = [&]() { created++; return std::make_shared<int>(42); };
+
+    auto first = cache.getOrCreate<int>("key", builder);
+    auto second = cache.getOrCreate<int>("key", builder);
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(created, 1);
+    EXPECT_EQ(cache.hits(), 1);
+    EXPECT_EQ(cache.misses(), 1);
+    EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(ParamsCacheTest, DistinguishesTypes) {
+    MKLDNNParamsCache cache(4);
+    auto intValue = cache.getOrCreate<int>("key", [] { return std::make_shared<int>(1); });
+    auto strValue = cache.getOrCreate<std::string>("key", [] { return std::make_shared<std::string>("1"); });
+
+    EXPECT_EQ(*intValue, 1);
+    EXPECT_EQ(*strValue, "1");
+    EXPECT_EQ(cache.size(), 2);
+}
+
+TEST(ParamsCacheTest, EvictsLeastRecentlyUsed) {
+    MKLDNNParamsCache cache(2);
+    auto builder = [](int value) { return [value] { return std::make_shared<int>(value); }; };
+
+    cache.getOrCreate<int>("a", builder(1));
+    cache.getOrCreate<int>("b", builder(2));
+    cache.getOrCreate<int>("a", builder(1));  // "b" becomes the least recently used
+    cache.getOrCreate<int>("c", builder(3));
+
+    EXPECT_EQ(cache.size(), 2);
+    int created = 0;
+    cache.getOrCreate<int>("a", [&] { created++; return std::make_shared<int>(1); });
+    EXPECT_EQ(created, 0);
+    cache.getOrCreate<int>("b", [&] { created++; return std::make_shared<int>(2); });
+    EXPECT_EQ(created, 1);
+}
+
+TEST(ParamsCacheTest, ZeroCapacityDoesNotStore) {
+    MKLDNNParamsCache cache(0);
+    int created = 0;
+    auto builder = [&]() { created++; return std::make_shared<int>(42); };
+
+    cache.getOrCreate<int>("key", builder);
+    cache.getOrCreate<int>("key", builder);
+
+    EXPECT_EQ(created, 2);
+    EXPECT_EQ(cache.size(), 0);
+}
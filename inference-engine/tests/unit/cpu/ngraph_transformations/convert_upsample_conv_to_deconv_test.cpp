@@ -0,0 +1,169 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <transformations/init_node_info.hpp>
+
+#include "ngraph_transformations/convert_upsample_conv_to_deconv.hpp"
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+
+namespace {
+
+using Interpolate = ngraph::opset4::Interpolate;
+
+Interpolate::InterpolateAttrs nearestAttrs(Interpolate::ShapeCalcMode shapeCalcMode = Interpolate::ShapeCalcMode::SIZES,
+                                           Interpolate::CoordinateTransformMode coordMode = Interpolate::CoordinateTransformMode::ASYMMETRIC,
+                                           Interpolate::NearestMode nearestMode = Interpolate::NearestMode::FLOOR) {
+    return Interpolate::InterpolateAttrs(Interpolate::InterpolateMode::NEAREST, shapeCalcMode, {0, 0, 0, 0}, {0, 0, 0, 0},
+                                         coordMode, nearestMode);
+}
+
+std::shared_ptr<ngraph::Function> createUpsampleConvolution(const ngraph::Shape& inputShape,
+                                                            const ngraph::Shape& upsampledShape,
+                                                            const Interpolate::InterpolateAttrs& attrs,
+                                                            const ngraph::Shape& weightsShape,
+                                                            const std::vector<float>& weights,
+                                                            const ngraph::Strides& strides,
+                                                            const ngraph::CoordinateDiff& pads) {
+    const size_t rank = inputShape.size();
+    std::vector<int64_t> sizes, axes;
+    std::vector<float> scales;
+    for (size_t i = 2; i < rank; i++) {
+        sizes.push_back(static_cast<int64_t>(upsampledShape[i]));
+        scales.push_back(static_cast<float>(upsampledShape[i]) / static_cast<float>(inputShape[i]));
+        axes.push_back(static_cast<int64_t>(i));
+    }
+
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, inputShape);
+    auto interp = std::make_shared<Interpolate>(input,
+                                                ngraph::opset1::Constant::create(ngraph::element::i64, {sizes.size()}, sizes),
+                                                ngraph::opset1::Constant::create(ngraph::element::f32, {scales.size()}, scales),
+                                                ngraph::opset1::Constant::create(ngraph::element::i64, {axes.size()}, axes),
+                                                attrs);
+    auto weightsConst = ngraph::opset1::Constant::create(ngraph::element::f32, weightsShape, weights);
+    auto conv = std::make_shared<ngraph::opset1::Convolution>(interp, weightsConst, strides, pads, pads,
+                                                              ngraph::Strides(rank - 2, 1));
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{conv}, ngraph::ParameterVector{input});
+}
+
+std::shared_ptr<ngraph::Function> createDeconvolution(const ngraph::Shape& inputShape,
+                                                      const ngraph::Shape& weightsShape,
+                                                      const std::vector<float>& weights,
+                                                      const ngraph::CoordinateDiff& pads) {
+    const size_t spatialRank = inputShape.size() - 2;
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, inputShape);
+    auto weightsConst = ngraph::opset1::Constant::create(ngraph::element::f32, weightsShape, weights);
+    auto deconv = std::make_shared<ngraph::opset1::ConvolutionBackpropData>(input, weightsConst, ngraph::Strides(spatialRank, 2),
+                                                                            pads, pads, ngraph::Strides(spatialRank, 1));
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{deconv}, ngraph::ParameterVector{input});
+}
+
+void runTransformation(const std::shared_ptr<ngraph::Function>& f) {
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.register_pass<MKLDNNPlugin::ConvertUpsampleConvolutionToDeconvolution>();
+    manager.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+}
+
+void compareWithReference(const std::shared_ptr<ngraph::Function>& f, const std::shared_ptr<ngraph::Function>& f_ref) {
+    const auto fc = FunctionsComparator::with_default()
+            .enable(FunctionsComparator::CONST_VALUES)
+            .enable(FunctionsComparator::ATTRIBUTES);
+    const auto res = fc.compare(f, f_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+}
+
+void checkNotConverted(const std::shared_ptr<ngraph::Function>& f) {
+    const auto f_ref = ngraph::clone_function(*f);
+    runTransformation(f);
+    compareWithReference(f, f_ref);
+}
+
+}  // namespace
+
+TEST(TransformationTests, ConvertUpsampleConvolutionToDeconvolutionFoldsWeights) {
+    // every deconvolution tap k sums the convolution taps 2 - k and 3 - k along each axis:
+    // rows {2}, {1, 2}, {0, 1}, {0} of the 3x3 kernel for k = 0..3
+    auto f = createUpsampleConvolution({1, 1, 4, 4}, {1, 1, 8, 8}, nearestAttrs(), {1, 1, 3, 3},
+                                       {1, 2, 3, 4, 5, 6, 7, 8, 9}, {1, 1}, {1, 1});
+    runTransformation(f);
+
+    auto f_ref = createDeconvolution({1, 1, 4, 4}, {1, 1, 4, 4},
+                                     { 9, 17, 15,  7,
+                                      15, 28, 24, 11,
+                                       9, 16, 12,  5,
+                                       3,  5,  3,  1}, {1, 1});
+    compareWithReference(f, f_ref);
+}
+
+TEST(TransformationTests, ConvertUpsampleConvolutionToDeconvolutionTransposesChannels) {
+    // 1x1 kernel is just replicated into 2x2, convolution weights OIHW become deconvolution weights IOHW
+    auto f = createUpsampleConvolution({1, 3, 4, 4}, {1, 3, 8, 8}, nearestAttrs(), {2, 3, 1, 1},
+                                       {0, 1, 2, 3, 4, 5}, {1, 1}, {0, 0});
+    runTransformation(f);
+
+    auto f_ref = createDeconvolution({1, 3, 4, 4}, {3, 2, 2, 2},
+                                     {0, 0, 0, 0, 3, 3, 3, 3,
+                                      1, 1, 1, 1, 4, 4, 4, 4,
+                                      2, 2, 2, 2, 5, 5, 5, 5}, {0, 0});
+    compareWithReference(f, f_ref);
+}
+
+TEST(TransformationTests, ConvertUpsampleConvolutionToDeconvolution3DScales) {
+    auto f = createUpsampleConvolution({1, 1, 2, 2, 2}, {1, 1, 4, 4, 4},
+                                       nearestAttrs(Interpolate::ShapeCalcMode::SCALES, Interpolate::CoordinateTransformMode::HALF_PIXEL,
+                                                    Interpolate::NearestMode::ROUND_PREFER_FLOOR),
+                                       {1, 1, 1, 1, 1}, {3}, {1, 1, 1}, {0, 0, 0});
+    runTransformation(f);
+
+    auto f_ref = createDeconvolution({1, 1, 2, 2, 2}, {1, 1, 2, 2, 2}, std::vector<float>(8, 3), {0, 0, 0});
+    compareWithReference(f, f_ref);
+}
+
+TEST(TransformationTests, ConvertUpsampleConvolutionToDeconvolutionSkipsLinear) {
+    auto attrs = nearestAttrs();
+    attrs.mode = Interpolate::InterpolateMode::LINEAR;
+    checkNotConverted(createUpsampleConvolution({1, 1, 4, 4}, {1, 1, 8, 8}, attrs, {1, 1, 3, 3},
+                                                std::vector<float>(9, 1), {1, 1}, {1, 1}));
+}
+
+TEST(TransformationTests, ConvertUpsampleConvolutionToDeconvolutionSkipsScale3) {
+    checkNotConverted(createUpsampleConvolution({1, 1, 4, 4}, {1, 1, 12, 12}, nearestAttrs(), {1, 1, 3, 3},
+                                                std::vector<float>(9, 1), {1, 1}, {1, 1}));
+}
+
+TEST(TransformationTests, ConvertUpsampleConvolutionToDeconvolutionSkipsNotReplicatingRounding) {
+    // half_pixel with floor rounding maps the output pixels 0, 1, 2 to the input pixels 0, 0, 0
+    checkNotConverted(createUpsampleConvolution({1, 1, 4, 4}, {1, 1, 8, 8},
+                                                nearestAttrs(Interpolate::ShapeCalcMode::SIZES, Interpolate::CoordinateTransformMode::HALF_PIXEL,
+                                                             Interpolate::NearestMode::FLOOR),
+                                                {1, 1, 3, 3}, std::vector<float>(9, 1), {1, 1}, {1, 1}));
+}
+
+TEST(TransformationTests, ConvertUpsampleConvolutionToDeconvolutionSkipsEvenKernel) {
+    checkNotConverted(createUpsampleConvolution({1, 1, 4, 4}, {1, 1, 8, 8}, nearestAttrs(), {1, 1, 2, 2},
+                                                std::vector<float>(4, 1), {1, 1}, {1, 1}));
+}
+
+TEST(TransformationTests, ConvertUpsampleConvolutionToDeconvolutionSkipsStridedConvolution) {
+    checkNotConverted(createUpsampleConvolution({1, 1, 4, 4}, {1, 1, 8, 8}, nearestAttrs(), {1, 1, 3, 3},
+                                                std::vector<float>(9, 1), {2, 2}, {1, 1}));
+}
+
+TEST(TransformationTests, ConvertUpsampleConvolutionToDeconvolutionSkipsNotSamePads) {
+    checkNotConverted(createUpsampleConvolution({1, 1, 4, 4}, {1, 1, 8, 8}, nearestAttrs(), {1, 1, 3, 3},
+                                                std::vector<float>(9, 1), {1, 1}, {0, 0}));
+}
@@ -0,0 +1,227 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <transformations/init_node_info.hpp>
+
+#include "ngraph_transformations/scaled_attention_fusion.hpp"
+#include "ngraph_transformations/op/scaled_attention.hpp"
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+
+namespace {
+
+enum class ScaleType {
+    None,
+    Multiply,
+    Divide
+};
+
+// Q [2, 4, 16, 8] x K -> [Multiply/Divide] -> [Add(mask)] -> Softmax -> x V [2, 4, 24, 12]
+struct AttentionGraph {
+    ngraph::element::Type precision = ngraph::element::f32;
+    ngraph::Shape kShape = {2, 4, 24, 8};
+    bool transposeK = false;                   // K is [..., D, Sk], so the first MatMul doesn't transpose it
+    ScaleType scaleType = ScaleType::None;
+    float scaleValue = 0.125f;
+    ngraph::Shape scaleShape = {};
+    bool withMask = false;
+    ngraph::Shape maskShape = {1, 1, 1, 24};
+    bool softmaxOverLastAxis = true;
+    bool scoresOutput = false;                 // the scores are an output of the network as well
+    bool transposeV = false;
+};
+
+const ngraph::Shape qShape = {2, 4, 16, 8};
+const ngraph::Shape vShape = {2, 4, 24, 12};
+
+ngraph::ParameterVector createInputs(const AttentionGraph& graph) {
+    ngraph::Shape v = vShape;
+    if (graph.transposeV)
+        std::swap(v[2], v[3]);
+    ngraph::ParameterVector params {
+        std::make_shared<ngraph::opset1::Parameter>(graph.precision, qShape),
+        std::make_shared<ngraph::opset1::Parameter>(graph.precision, graph.kShape),
+        std::make_shared<ngraph::opset1::Parameter>(graph.precision, v)
+    };
+    if (graph.withMask)
+        params.push_back(std::make_shared<ngraph::opset1::Parameter>(graph.precision, graph.maskShape));
+    return params;
+}
+
+std::shared_ptr<ngraph::Function> createAttention(const AttentionGraph& graph) {
+    auto params = createInputs(graph);
+    auto qk = std::make_shared<ngraph::opset1::MatMul>(params[0], params[1], false, !graph.transposeK);
+
+    std::shared_ptr<ngraph::Node> scores = qk;
+    if (graph.scaleType != ScaleType::None) {
+        const float value = graph.scaleType == ScaleType::Multiply ? graph.scaleValue : 1.f / graph.scaleValue;
+        auto scale = ngraph::opset1::Constant::create(graph.precision, graph.scaleShape, {value});
+        if (graph.scaleType == ScaleType::Multiply)
+            scores = std::make_shared<ngraph::opset1::Multiply>(scores, scale);
+        else
+            scores = std::make_shared<ngraph::opset1::Divide>(scores, scale);
+    }
+    if (graph.withMask)
+        scores = std::make_shared<ngraph::opset1::Add>(scores, params[3]);
+
+    const size_t scoresRank = scores->get_output_shape(0).size();
+    auto softmax = std::make_shared<ngraph::opset1::Softmax>(scores, graph.softmaxOverLastAxis ? scoresRank - 1 : scoresRank - 2);
+    auto output = std::make_shared<ngraph::opset1::MatMul>(softmax, params[2], false, graph.transposeV);
+
+    ngraph::NodeVector results{output};
+    if (graph.scoresOutput)
+        results.push_back(qk);
+    return std::make_shared<ngraph::Function>(results, params);
+}
+
+std::shared_ptr<ngraph::Function> createFusedAttention(const AttentionGraph& graph) {
+    auto params = createInputs(graph);
+    const float scale = graph.scaleType == ScaleType::None ? 1.f : graph.scaleValue;
+    std::shared_ptr<ngraph::Node> attention;
+    if (graph.withMask)
+        attention = std::make_shared<MKLDNNPlugin::ScaledAttentionNode>(params[0], params[1], params[2], params[3], scale, graph.transposeK);
+    else
+        attention = std::make_shared<MKLDNNPlugin::ScaledAttentionNode>(params[0], params[1], params[2], scale, graph.transposeK);
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{attention}, params);
+}
+
+void runFusion(const std::shared_ptr<ngraph::Function>& f) {
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.register_pass<MKLDNNPlugin::ScaledAttentionFusion>();
+    manager.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+}
+
+void checkFused(const AttentionGraph& graph) {
+    auto f = createAttention(graph);
+    runFusion(f);
+
+    const auto fc = FunctionsComparator::with_default()
+            .enable(FunctionsComparator::CONST_VALUES)
+            .enable(FunctionsComparator::ATTRIBUTES);
+    const auto res = fc.compare(f, createFusedAttention(graph));
+    ASSERT_TRUE(res.valid) << res.message;
+}
+
+void checkNotFused(const AttentionGraph& graph) {
+    auto f = createAttention(graph);
+    const auto f_ref = ngraph::clone_function(*f);
+    runFusion(f);
+
+    const auto fc = FunctionsComparator::with_default()
+            .enable(FunctionsComparator::CONST_VALUES)
+            .enable(FunctionsComparator::ATTRIBUTES);
+    const auto res = fc.compare(f, f_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+}
+
+}  // namespace
+
+TEST(TransformationTests, ScaledAttentionFusion) {
+    checkFused(AttentionGraph{});
+}
+
+TEST(TransformationTests, ScaledAttentionFusionMultiplyScale) {
+    AttentionGraph graph;
+    graph.scaleType = ScaleType::Multiply;
+    checkFused(graph);
+}
+
+TEST(TransformationTests, ScaledAttentionFusionDivideScale) {
+    AttentionGraph graph;
+    graph.scaleType = ScaleType::Divide;
+    graph.scaleShape = {1, 1, 1, 1};
+    checkFused(graph);
+}
+
+TEST(TransformationTests, ScaledAttentionFusionMask) {
+    AttentionGraph graph;
+    graph.withMask = true;
+    checkFused(graph);
+}
+
+TEST(TransformationTests, ScaledAttentionFusionFullMask) {
+    AttentionGraph graph;
+    graph.withMask = true;
+    graph.maskShape = {2, 4, 16, 24};
+    checkFused(graph);
+}
+
+TEST(TransformationTests, ScaledAttentionFusionTransposedK) {
+    AttentionGraph graph;
+    graph.kShape = {2, 4, 8, 24};
+    graph.transposeK = true;
+    checkFused(graph);
+}
+
+TEST(TransformationTests, ScaledAttentionFusionScaleMaskTransposedK) {
+    AttentionGraph graph;
+    graph.kShape = {2, 4, 8, 24};
+    graph.transposeK = true;
+    graph.scaleType = ScaleType::Multiply;
+    graph.withMask = true;
+    checkFused(graph);
+}
+
+TEST(TransformationTests, ScaledAttentionFusionBF16) {
+    AttentionGraph graph;
+    graph.precision = ngraph::element::bf16;
+    graph.scaleType = ScaleType::Multiply;
+    graph.withMask = true;
+    checkFused(graph);
+}
+
+TEST(TransformationTests, ScaledAttentionFusionNegativeSoftmaxAxis) {
+    AttentionGraph graph;
+    graph.softmaxOverLastAxis = false;
+    checkNotFused(graph);
+}
+
+TEST(TransformationTests, ScaledAttentionFusionNegativeNotScalarScale) {
+    AttentionGraph graph;
+    graph.scaleType = ScaleType::Multiply;
+    graph.scaleShape = {1, 1, 1, 24};
+    checkNotFused(graph);
+}
+
+TEST(TransformationTests, ScaledAttentionFusionNegativeMaskChangesScoresShape) {
+    AttentionGraph graph;
+    graph.withMask = true;
+    graph.maskShape = {3, 1, 1, 1, 24};
+    checkNotFused(graph);
+}
+
+TEST(TransformationTests, ScaledAttentionFusionNegativeBroadcastedBatch) {
+    AttentionGraph graph;
+    graph.kShape = {1, 4, 24, 8};
+    checkNotFused(graph);
+}
+
+TEST(TransformationTests, ScaledAttentionFusionNegativeScoresOutput) {
+    AttentionGraph graph;
+    graph.scoresOutput = true;
+    checkNotFused(graph);
+}
+
+TEST(TransformationTests, ScaledAttentionFusionNegativeTransposedV) {
+    AttentionGraph graph;
+    graph.transposeV = true;
+    checkNotFused(graph);
+}
+
+TEST(TransformationTests, ScaledAttentionFusionNegativeF16) {
+    AttentionGraph graph;
+    graph.precision = ngraph::element::f16;
+    checkNotFused(graph);
+}
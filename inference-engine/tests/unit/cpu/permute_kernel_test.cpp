@@ -0,0 +1,87 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <vector>
+
+#include "nodes/common/permute_kernel.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+template <typename T>
+void checkPermute(const SizeVector& srcDims, const SizeVector& order, bool expectTiled) {
+    SizeVector dstDims(order.size());
+    for (size_t i = 0; i < order.size(); i++)
+        dstDims[i] = srcDims[order[i]];
+
+    SizeVector plainOrder(srcDims.size());
+    std::iota(plainOrder.begin(), plainOrder.end(), 0);
+
+    PermuteParams params;
+    params.src_block_dims = srcDims;
+    params.src_block_order = plainOrder;
+    params.dst_block_dims = dstDims;
+    params.dst_block_order = plainOrder;
+    params.order = order;
+    params.data_size = sizeof(T);
+
+    PermuteKernel kernel(params);
+    ASSERT_EQ(expectTiled, kernel.isTiled());
+
+    const size_t size = std::accumulate(srcDims.begin(), srcDims.end(), size_t(1), std::multiplies<size_t>());
+    std::vector<T> srcData(size);
+    for (size_t i = 0; i < size; i++)
+        srcData[i] = static_cast<T>(i % 251);
+    std::vector<T> dstData(size, 0);
+
+    kernel.execute(reinterpret_cast<const uint8_t*>(srcData.data()), reinterpret_cast<uint8_t*>(dstData.data()));
+
+    SizeVector srcStrides(srcDims.size(), 1);
+    for (size_t i = srcDims.size() - 1; i > 0; i--)
+        srcStrides[i - 1] = srcStrides[i] * srcDims[i];
+
+    SizeVector dstIdx(dstDims.size(), 0);
+    for (size_t i = 0; i < size; i++) {
+        size_t rest = i;
+        for (size_t j = dstDims.size(); j-- > 0;) {
+            dstIdx[j] = rest % dstDims[j];
+            rest /= dstDims[j];
+        }
+        size_t srcOffset = 0;
+        for (size_t j = 0; j < order.size(); j++)
+            srcOffset += dstIdx[j] * srcStrides[order[j]];
+        ASSERT_EQ(srcData[srcOffset], dstData[i]) << "element " << i;
+    }
+}
+
+}  // namespace
+
+TEST(PermuteKernelTest, AttentionHeadsF32) {
+    checkPermute<float>({2, 7, 12, 64}, {0, 2, 1, 3}, true);
+}
+
+TEST(PermuteKernelTest, PlanarToChannelsLastF32) {
+    checkPermute<float>({2, 24, 9, 13}, {0, 2, 3, 1}, true);
+}
+
+TEST(PermuteKernelTest, PlanarToChannelsLastU8) {
+    checkPermute<uint8_t>({1, 19, 17, 33}, {0, 2, 3, 1}, true);
+}
+
+TEST(PermuteKernelTest, Rank6F32) {
+    checkPermute<float>({2, 3, 8, 4, 9, 16}, {0, 3, 1, 5, 2, 4}, true);
+}
+
+TEST(PermuteKernelTest, BatchPermutedF32) {
+    checkPermute<float>({3, 5, 16}, {1, 0, 2}, false);
+}
+
+TEST(PermuteKernelTest, SmallInnerDimBF16) {
+    checkPermute<uint16_t>({2, 3, 5, 7}, {0, 3, 1, 2}, false);
+}
@@ -0,0 +1,104 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "nodes/common/reorder_kernel.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+struct Layout {
+    SizeVector blockDims;
+    SizeVector order;
+
+    SizeVector strides() const {
+        SizeVector result(blockDims.size(), 1);
+        for (size_t i = blockDims.size() - 1; i > 0; i--)
+            result[i - 1] = result[i] * blockDims[i];
+        return result;
+    }
+
+    size_t offset(SizeVector idx) const {
+        const auto blockStrides = strides();
+        size_t result = 0;
+        for (size_t i = blockDims.size(); i-- > 0;) {
+            result += (idx[order[i]] % blockDims[i]) * blockStrides[i];
+            idx[order[i]] /= blockDims[i];
+        }
+        return result;
+    }
+};
+
+template <typename Src, typename Dst>
+void checkReorder(const SizeVector& dims, const Layout& src, const Layout& dst, Precision srcPrc, Precision dstPrc, size_t mb) {
+    ReorderParams params;
+    params.dims = dims;
+    params.src_block_dims = src.blockDims;
+    params.src_block_order = src.order;
+    params.src_strides = src.strides();
+    params.dst_block_dims = dst.blockDims;
+    params.dst_block_order = dst.order;
+    params.dst_strides = dst.strides();
+    params.src_prc = srcPrc;
+    params.dst_prc = dstPrc;
+
+    ReorderKernel kernel(params);
+    ASSERT_TRUE(kernel.isSupported());
+
+    const size_t size = std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>());
+    std::vector<Src> srcData(size);
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 120);
+    for (auto& value : srcData)
+        value = static_cast<Src>(dist(gen));
+    std::vector<Dst> dstData(size, 0);
+
+    kernel.execute(reinterpret_cast<const uint8_t*>(srcData.data()), reinterpret_cast<uint8_t*>(dstData.data()), mb);
+
+    SizeVector idx(dims.size(), 0);
+    for (size_t i = 0; i < size; i++) {
+        size_t rest = i;
+        for (size_t j = dims.size(); j-- > 0;) {
+            idx[j] = rest % dims[j];
+            rest /= dims[j];
+        }
+        const auto expected = idx[0] < mb ? static_cast<Dst>(srcData[src.offset(idx)]) : Dst(0);
+        ASSERT_EQ(expected, dstData[dst.offset(idx)]) << "element " << i;
+    }
+}
+
+}  // namespace
+
+TEST(ReorderKernelTest, BlockedToPlanarF32) {
+    checkReorder<float, float>({2, 32, 5, 7}, {{2, 2, 5, 7, 16}, {0, 1, 2, 3, 1}}, {{2, 32, 5, 7}, {0, 1, 2, 3}},
+                               Precision::FP32, Precision::FP32, 2);
+}
+
+TEST(ReorderKernelTest, BlockedToNspcF32ToU8) {
+    checkReorder<float, uint8_t>({1, 48, 9, 11}, {{1, 3, 9, 11, 16}, {0, 1, 2, 3, 1}}, {{1, 9, 11, 48}, {0, 2, 3, 1}},
+                                 Precision::FP32, Precision::U8, 1);
+}
+
+TEST(ReorderKernelTest, NcspToNspcI8ToF32) {
+    checkReorder<int8_t, float>({3, 19, 6, 5}, {{3, 19, 6, 5}, {0, 1, 2, 3}}, {{3, 6, 5, 19}, {0, 2, 3, 1}},
+                                Precision::I8, Precision::FP32, 3);
+}
+
+TEST(ReorderKernelTest, NspcToBlocked8cU8ToI32) {
+    checkReorder<uint8_t, int32_t>({2, 24, 3, 3, 4}, {{2, 3, 3, 4, 24}, {0, 2, 3, 4, 1}}, {{2, 3, 3, 3, 4, 8}, {0, 1, 2, 3, 4, 1}},
+                                   Precision::U8, Precision::I32, 2);
+}
+
+TEST(ReorderKernelTest, DynamicBatchF32ToI8) {
+    checkReorder<float, int8_t>({4, 16, 8, 8}, {{4, 16, 8, 8}, {0, 1, 2, 3}}, {{4, 8, 8, 16}, {0, 2, 3, 1}},
+                                Precision::FP32, Precision::I8, 2);
+}
@@ -9,6 +9,7 @@
 #include <convolution_shape_inference.hpp>
 #include <openvino/op/ops.hpp>
 #include "utils/shape_inference/static_shape.hpp"
+#include "utils/shape_inference/shape_inference.hpp"
 
 using namespace ov;
 
@@ -40,6 +41,72 @@ TEST(StaticShapeInferenceTest, ConvolutionTest) {
     ASSERT_EQ(conv->get_pads_end(), (CoordinateDiff{1, 1}));
 }
 
+TEST(StaticShapeInferenceTest, MatMulTest) {
+    auto A = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1, -1});
+    auto B = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto matmul = std::make_shared<op::v0::MatMul>(A, B, false, true);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 12, 128, 64}, StaticShape{1, 256, 64}},
+                             static_output_shapes = {StaticShape{}};
+    ASSERT_TRUE(shape_inference(matmul.get(), static_input_shapes, static_output_shapes));
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 12, 128, 256}));
+
+    static_input_shapes = {StaticShape{64}, StaticShape{256, 64}};
+    ASSERT_TRUE(shape_inference(matmul.get(), static_input_shapes, static_output_shapes));
+    ASSERT_EQ(static_output_shapes[0], StaticShape({256}));
+
+    static_input_shapes = {StaticShape{2, 12, 128, 64}, StaticShape{256, 32}};
+    ASSERT_THROW(shape_inference(matmul.get(), static_input_shapes, static_output_shapes), NodeValidationFailure);
+}
+
+TEST(StaticShapeInferenceTest, ConcatTest) {
+    auto A = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto B = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto concat = std::make_shared<op::v0::Concat>(OutputVector{A, B}, -2);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{1, 3, 8}, StaticShape{1, 5, 8}},
+                             static_output_shapes = {StaticShape{}};
+    ASSERT_TRUE(shape_inference(concat.get(), static_input_shapes, static_output_shapes));
+    ASSERT_EQ(static_output_shapes[0], StaticShape({1, 8, 8}));
+
+    static_input_shapes = {StaticShape{1, 3, 8}, StaticShape{1, 5, 4}};
+    ASSERT_THROW(shape_inference(concat.get(), static_input_shapes, static_output_shapes), NodeValidationFailure);
+}
+
+TEST(StaticShapeInferenceTest, EltwiseTest) {
+    auto A = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto B = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1});
+    auto add = std::make_shared<op::v1::Add>(A, B);
+    auto relu = std::make_shared<op::v0::Relu>(add);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 1, 16}, StaticShape{5, 1}},
+                             static_output_shapes = {StaticShape{}};
+    ASSERT_TRUE(shape_inference(add.get(), static_input_shapes, static_output_shapes));
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 5, 16}));
+
+    static_input_shapes = {StaticShape{2, 5, 16}};
+    ASSERT_TRUE(shape_inference(relu.get(), static_input_shapes, static_output_shapes));
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 5, 16}));
+}
+
+TEST(StaticShapeInferenceTest, ShapeOfTest) {
+    auto data = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto shape_of = std::make_shared<op::v3::ShapeOf>(data);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{1, 3, 8}}, static_output_shapes = {StaticShape{}};
+    ASSERT_TRUE(shape_inference(shape_of.get(), static_input_shapes, static_output_shapes));
+    ASSERT_EQ(static_output_shapes[0], StaticShape({3}));
+}
+
+TEST(StaticShapeInferenceTest, UnsupportedOpTest) {
+    auto data = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1});
+    auto pattern = std::make_shared<ov::op::v0::Parameter>(element::i64, PartialShape{1});
+    auto reshape = std::make_shared<op::v1::Reshape>(data, pattern, false);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3}, StaticShape{1}}, static_output_shapes = {StaticShape{}};
+    ASSERT_FALSE(shape_inference(reshape.get(), static_input_shapes, static_output_shapes));
+}
+
 #if 0
 TEST(StaticShapeInferenceTest, ConvolutionTimeTest) {
     Strides strides{1, 1};
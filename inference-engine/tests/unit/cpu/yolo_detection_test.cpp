@@ -0,0 +1,169 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "nodes/common/yolo_detection.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+struct Detection {
+    float image;
+    float label;
+    float score;
+    float box[4];
+};
+
+float logistic(float x) {
+    return 1.f / (1.f + std::exp(-x));
+}
+
+float iou(const float* a, const float* b) {
+    const float areaA = (a[2] - a[0]) * (a[3] - a[1]);
+    const float areaB = (b[2] - b[0]) * (b[3] - b[1]);
+    if (areaA <= 0.f || areaB <= 0.f)
+        return 0.f;
+    const float width = std::max(std::min(a[2], b[2]) - std::max(a[0], b[0]), 0.f);
+    const float height = std::max(std::min(a[3], b[3]) - std::max(a[1], b[1]), 0.f);
+    return width * height / (areaA + areaB - width * height);
+}
+
+// decodes every box of every cell and runs NMS of each class over all of them
+std::vector<Detection> referenceDetections(const YoloDetectionParams& params, const std::vector<std::vector<float>>& srcs) {
+    const size_t C = params.classes;
+    std::vector<Detection> result;
+    for (size_t n = 0; n < params.batch; n++) {
+        std::vector<std::vector<Detection>> classCandidates(C);
+        for (size_t s = 0; s < params.scales.size(); s++) {
+            const auto& scale = params.scales[s];
+            const size_t H = scale.height, W = scale.width, B = scale.anchors.size() / 2;
+            auto at = [&](size_t b, size_t c, size_t h, size_t w) {
+                return srcs[s][(((n * B + b) * (5 + C) + c) * H + h) * W + w];
+            };
+            for (size_t b = 0; b < B; b++) {
+                for (size_t h = 0; h < H; h++) {
+                    for (size_t w = 0; w < W; w++) {
+                        const float objectness = logistic(at(b, 4, h, w));
+                        std::vector<float> probs(C);
+                        float maxRaw = at(b, 5, h, w), sum = 0.f;
+                        for (size_t c = 0; c < C; c++)
+                            maxRaw = std::max(maxRaw, at(b, 5 + c, h, w));
+                        for (size_t c = 0; c < C; c++)
+                            sum += std::exp(at(b, 5 + c, h, w) - maxRaw);
+                        for (size_t c = 0; c < C; c++)
+                            probs[c] = params.do_softmax ? std::exp(at(b, 5 + c, h, w) - maxRaw) / sum : logistic(at(b, 5 + c, h, w));
+
+                        const float x = (w + logistic(at(b, 0, h, w))) / W;
+                        const float y = (h + logistic(at(b, 1, h, w))) / H;
+                        const float bw = std::exp(at(b, 2, h, w)) * scale.anchors[2 * b] / (params.do_softmax ? W : params.input_width);
+                        const float bh = std::exp(at(b, 3, h, w)) * scale.anchors[2 * b + 1] / (params.do_softmax ? H : params.input_height);
+                        for (size_t c = 0; c < C; c++) {
+                            const float score = objectness * probs[c];
+                            if (score < params.confidence_threshold)
+                                continue;
+                            classCandidates[c].push_back({static_cast<float>(n), static_cast<float>(c), score,
+                                                          {x - bw / 2, y - bh / 2, x + bw / 2, y + bh / 2}});
+                        }
+                    }
+                }
+            }
+        }
+
+        std::vector<Detection> detections;
+        for (auto& candidates : classCandidates) {
+            std::stable_sort(candidates.begin(), candidates.end(),
+                             [](const Detection& l, const Detection& r) { return l.score > r.score; });
+            std::vector<Detection> selected;
+            for (const auto& candidate : candidates) {
+                bool suppressed = false;
+                for (const auto& s : selected)
+                    suppressed = suppressed || iou(candidate.box, s.box) >= params.iou_threshold;
+                if (!suppressed)
+                    selected.push_back(candidate);
+            }
+            detections.insert(detections.end(), selected.begin(), selected.end());
+        }
+        std::stable_sort(detections.begin(), detections.end(),
+                         [](const Detection& l, const Detection& r) { return l.score > r.score; });
+        if (detections.size() > params.keep_top_k)
+            detections.resize(params.keep_top_k);
+        std::stable_sort(detections.begin(), detections.end(), [](const Detection& l, const Detection& r) {
+            return l.label < r.label || (l.label == r.label && l.score > r.score);
+        });
+        result.insert(result.end(), detections.begin(), detections.end());
+    }
+    return result;
+}
+
+YoloDetectionParams makeParams(bool doSoftmax, size_t batch, size_t keepTopK) {
+    YoloDetectionParams params;
+    params.scales = {{13, 13, {116, 90, 156, 198, 373, 326}}, {26, 26, {30, 61, 62, 45, 59, 119}}};
+    params.batch = batch;
+    params.classes = 20;
+    params.input_width = 416;
+    params.input_height = 416;
+    params.do_softmax = doSoftmax;
+    params.confidence_threshold = 0.3f;
+    params.iou_threshold = 0.45f;
+    params.keep_top_k = keepTopK;
+    if (doSoftmax) {
+        // the region anchors are measured in the cells
+        for (auto& scale : params.scales)
+            for (auto& anchor : scale.anchors)
+                anchor /= 32.f;
+    }
+    return params;
+}
+
+void checkDetections(const YoloDetectionParams& params) {
+    std::mt19937 gen(7);
+    std::normal_distribution<float> dist(-1.f, 2.f);
+    std::vector<std::vector<float>> srcs;
+    std::vector<const float*> srcPtrs;
+    for (const auto& scale : params.scales) {
+        srcs.emplace_back(params.batch * scale.anchors.size() / 2 * (5 + params.classes) * scale.height * scale.width);
+        for (auto& value : srcs.back())
+            value = dist(gen);
+        srcPtrs.push_back(srcs.back().data());
+    }
+
+    YoloDetectionKernel kernel(params);
+    std::vector<float> dst(params.batch * params.keep_top_k * YoloDetectionKernel::detectionSize, 42.f);
+    kernel.execute(srcPtrs, dst.data());
+
+    const auto expected = referenceDetections(params, srcs);
+    ASSERT_FALSE(expected.empty());
+    ASSERT_LE(expected.size(), params.batch * params.keep_top_k);
+    for (size_t i = 0; i < expected.size(); i++) {
+        const float* row = &dst[i * YoloDetectionKernel::detectionSize];
+        ASSERT_EQ(row[0], expected[i].image) << "detection " << i;
+        ASSERT_EQ(row[1], expected[i].label) << "detection " << i;
+        ASSERT_NEAR(row[2], expected[i].score, 1e-5f) << "detection " << i;
+        for (size_t k = 0; k < 4; k++)
+            ASSERT_NEAR(row[3 + k], expected[i].box[k], 1e-5f) << "detection " << i;
+    }
+    if (expected.size() < params.batch * params.keep_top_k)
+        ASSERT_EQ(dst[expected.size() * YoloDetectionKernel::detectionSize], -1.f);
+}
+
+}  // namespace
+
+TEST(YoloDetectionKernelTest, LogisticHeadMatchesReference) {
+    checkDetections(makeParams(false, 2, 200));
+}
+
+TEST(YoloDetectionKernelTest, SoftmaxHeadMatchesReference) {
+    checkDetections(makeParams(true, 1, 200));
+}
+
+TEST(YoloDetectionKernelTest, KeepTopKLimitsDetections) {
+    checkDetections(makeParams(false, 2, 5));
+}
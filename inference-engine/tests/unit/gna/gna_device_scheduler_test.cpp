@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "gna_device_scheduler.hpp"
+
+using GNAPluginNS::GNADeviceScheduler;
+
+class GNADeviceSchedulerTest : public ::testing::Test {
+};
+
+TEST_F(GNADeviceSchedulerTest, SingleClientIsNotLimitedByQueueCapacity) {
+    auto& scheduler = GNADeviceScheduler::instance();
+    const auto client = scheduler.registerClient();
+    for (uint32_t i = 0; i < 2 * GNADeviceScheduler::queueCapacity; i++) {
+        scheduler.acquireSlot(client);
+    }
+    for (uint32_t i = 0; i < 2 * GNADeviceScheduler::queueCapacity; i++) {
+        scheduler.releaseSlot(client);
+    }
+    scheduler.unregisterClient(client);
+}
+
+TEST_F(GNADeviceSchedulerTest, ClientsOverTheirShareAreNotBlockedByEachOther) {
+    auto& scheduler = GNADeviceScheduler::instance();
+    const auto first = scheduler.registerClient();
+    const auto second = scheduler.registerClient();
+
+    // both clients submit all their requests before waiting for them
+    auto submit = [&scheduler](uint32_t client) {
+        for (uint32_t i = 0; i < GNADeviceScheduler::queueCapacity; i++) {
+            scheduler.acquireSlot(client);
+        }
+    };
+    std::thread firstThread(submit, first);
+    std::thread secondThread(submit, second);
+    firstThread.join();
+    secondThread.join();
+
+    scheduler.unregisterClient(first);
+    scheduler.unregisterClient(second);
+}
+
+TEST_F(GNADeviceSchedulerTest, ClientBelowShareIsAdmittedWhileOtherIsOverShare) {
+    auto& scheduler = GNADeviceScheduler::instance();
+    const auto busy = scheduler.registerClient();
+    const auto idle = scheduler.registerClient();
+    for (uint32_t i = 0; i < GNADeviceScheduler::queueCapacity; i++) {
+        scheduler.acquireSlot(busy);
+    }
+    scheduler.acquireSlot(idle);
+    scheduler.releaseSlot(idle);
+
+    scheduler.unregisterClient(busy);
+    scheduler.unregisterClient(idle);
+}
+
+TEST_F(GNADeviceSchedulerTest, UtilizationCountsTimeWithRequestsInFlight) {
+    auto& scheduler = GNADeviceScheduler::instance();
+    const auto client = scheduler.registerClient();
+    scheduler.acquireSlot(client);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_GT(scheduler.getUtilization(), 0.f);
+    scheduler.releaseSlot(client);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    const auto utilization = scheduler.getUtilization();
+    EXPECT_GT(utilization, 0.f);
+    EXPECT_LT(utilization, 100.f);
+    scheduler.unregisterClient(client);
+}
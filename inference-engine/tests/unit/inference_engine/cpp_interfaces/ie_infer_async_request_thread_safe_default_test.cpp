@@ -3,6 +3,8 @@
 //
 
 #include <deque>
+#include <future>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
@@ -47,6 +49,14 @@ struct DeferedExecutor : public ITaskExecutor {
     std::deque<Task> tasks;
 };
 
+struct DirectSyncInferRequest : public AsyncInferRequestThreadSafeDefault {
+    DirectSyncInferRequest(const IInferRequestInternal::Ptr& request,
+                           const ITaskExecutor::Ptr& taskExecutor)
+        : AsyncInferRequestThreadSafeDefault(request, taskExecutor, taskExecutor) {
+        _directSyncInfer = true;
+    }
+};
+
 class InferRequestThreadSafeDefaultTests : public ::testing::Test {
 protected:
     shared_ptr<AsyncInferRequestThreadSafeDefault> testRequest;
@@ -119,6 +129,94 @@ TEST_F(InferRequestThreadSafeDefaultTests, canResetBusyStatusIfInferFails) {
     taskExecutor->executeAll();
 }
 
+TEST_F(InferRequestThreadSafeDefaultTests, directInferRunsOnCallingThreadWithoutPipeline) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    testRequest = make_shared<DirectSyncInferRequest>(mockInferRequestInternal, taskExecutor);
+    std::thread::id inferThreadId;
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1).WillOnce(Invoke([&] {
+        inferThreadId = std::this_thread::get_id();
+    }));
+    ASSERT_NO_THROW(testRequest->Infer());
+    ASSERT_EQ(std::this_thread::get_id(), inferThreadId);
+    ASSERT_EQ(OK, testRequest->Wait(InferRequest::WaitMode::STATUS_ONLY));
+    ASSERT_EQ(OK, testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, waitReportsRunningDirectInfer) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    testRequest = make_shared<DirectSyncInferRequest>(mockInferRequestInternal, taskExecutor);
+    std::promise<void> started;
+    std::promise<void> finish;
+    auto finishFuture = finish.get_future().share();
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1).WillOnce(Invoke([&] {
+        started.set_value();
+        finishFuture.wait();
+    }));
+    ASSERT_EQ(INFER_NOT_STARTED, testRequest->Wait(InferRequest::WaitMode::STATUS_ONLY));
+    auto infer = std::async(std::launch::async, [&] { testRequest->Infer(); });
+    started.get_future().wait();
+
+    ASSERT_EQ(RESULT_NOT_READY, testRequest->Wait(InferRequest::WaitMode::STATUS_ONLY));
+    ASSERT_EQ(RESULT_NOT_READY, testRequest->Wait(1));
+    finish.set_value();
+    ASSERT_EQ(OK, testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+    ASSERT_NO_THROW(infer.get());
+    ASSERT_EQ(OK, testRequest->Wait(InferRequest::WaitMode::STATUS_ONLY));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, waitRethrowsDirectInferException) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    testRequest = make_shared<DirectSyncInferRequest>(mockInferRequestInternal, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1).WillOnce(Throw(GeneralError{""}));
+    ASSERT_THROW(testRequest->Infer(), GeneralError);
+    ASSERT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), GeneralError);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, canCancelRunningDirectInferFromOtherThread) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    auto request = make_shared<DirectSyncInferRequest>(mockInferRequestInternal, taskExecutor);
+    testRequest = request;
+    std::promise<void> canceled;
+    auto canceledFuture = canceled.get_future().share();
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1).WillOnce(Invoke([&] {
+        canceledFuture.wait();
+        request->ThrowIfCanceled();
+    }));
+    auto infer = std::async(std::launch::async, [&] { testRequest->Infer(); });
+    // the same polling as the cancellation behavior tests do
+    while (testRequest->Wait(InferRequest::WaitMode::STATUS_ONLY) == INFER_NOT_STARTED) {
+    }
+
+    ASSERT_NO_THROW(testRequest->Cancel());
+    canceled.set_value();
+    ASSERT_THROW(infer.get(), InferCancelled);
+    ASSERT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), InferCancelled);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, canResetBusyStatusIfDirectInferFails) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    testRequest = make_shared<DirectSyncInferRequest>(mockInferRequestInternal, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(2)
+            .WillOnce(Throw(GeneralError{""}))
+            .WillOnce(Return());
+    ASSERT_THROW(testRequest->Infer(), GeneralError);
+    ASSERT_NO_THROW(testRequest->Infer());
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, canCancelDirectInfer) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    auto request = make_shared<DirectSyncInferRequest>(mockInferRequestInternal, taskExecutor);
+    testRequest = request;
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(2)
+            .WillOnce(Invoke([&] {
+                request->Cancel();
+                request->ThrowIfCanceled();
+            }))
+            .WillOnce(Return());
+    ASSERT_THROW(testRequest->Infer(), InferCancelled);
+    ASSERT_NO_THROW(testRequest->Infer());
+}
+
 // GetPerformanceCounts
 TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnGetPerformanceCounts) {
     auto taskExecutor = std::make_shared<DeferedExecutor>();
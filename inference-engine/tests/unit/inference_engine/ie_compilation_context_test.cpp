@@ -341,6 +341,46 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstantValues) {
+    auto updateConstant = [](CNNNetwork& cnnNet) {
+        for (const auto& op : cnnNet.getFunction()->get_ops()) {
+            if (op->get_friendly_name() == "add_constant") {
+                auto constant = opset6::Constant::create(element::i8, Shape{1}, {5});
+                constant->set_friendly_name("add_constant");
+                constant->get_output_tensor(0).set_names({"add_constant"});
+                replace_node(op, constant);
+            }
+        }
+    };
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    updateConstant(net2);
+    auto net3 = createNetwork();
+    updateConstant(net3);
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net2, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentAttributes) {
+    auto updateBroadcast = [](CNNNetwork& cnnNet) {
+        for (const auto& op : cnnNet.getFunction()->get_ops()) {
+            if (auto add = std::dynamic_pointer_cast<opset6::Add>(op))
+                add->set_autob(op::AutoBroadcastType::NONE);
+        }
+    };
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    updateBroadcast(net2);
+    auto net3 = createNetwork();
+    updateBroadcast(net3);
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net2, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_data_hash.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace InferenceEngine;
+
+using DataHashTests = ::testing::Test;
+
+TEST_F(DataHashTests, SmallDataMatchesReferenceXXHash64) {
+    const std::string empty;
+    ASSERT_EQ(0xEF46DB3751D8E999ull, computeDataHash(empty.data(), empty.size()));
+
+    const std::string abc = "abc";
+    ASSERT_EQ(0x44BC2CF5AD770999ull, computeDataHash(abc.data(), abc.size()));
+    ASSERT_EQ(computeDataHash(abc.data(), abc.size()), computeDataHashSequential(abc.data(), abc.size()));
+}
+
+TEST_F(DataHashTests, LargeDataIsStable) {
+    std::vector<uint8_t> data(5 * 1024 * 1024 + 7);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<uint8_t>(i * 31 + (i >> 8));
+
+    const auto hash = computeDataHash(data.data(), data.size());
+    for (int i = 0; i < 3; i++)
+        ASSERT_EQ(hash, computeDataHash(data.data(), data.size()));
+}
+
+TEST_F(DataHashTests, LargeDataDependsOnEveryBlock) {
+    std::vector<uint8_t> data(3 * 1024 * 1024, 0);
+    const auto hash = computeDataHash(data.data(), data.size());
+
+    data.back() = 1;
+    const auto hashModifiedLast = computeDataHash(data.data(), data.size());
+    ASSERT_NE(hash, hashModifiedLast);
+
+    data.back() = 0;
+    data.front() = 1;
+    const auto hashModifiedFirst = computeDataHash(data.data(), data.size());
+    ASSERT_NE(hash, hashModifiedFirst);
+    ASSERT_NE(hashModifiedLast, hashModifiedFirst);
+}
+
+TEST_F(DataHashTests, SizeIsPartOfHash) {
+    std::vector<uint8_t> data(2 * 1024 * 1024 + 1, 0);
+    ASSERT_NE(computeDataHash(data.data(), data.size()), computeDataHash(data.data(), data.size() - 1));
+}
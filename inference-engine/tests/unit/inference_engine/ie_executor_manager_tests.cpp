@@ -36,3 +36,14 @@ TEST(ExecutorManagerTests, returnTheSameExecutorForTheSameDevice) {
     ASSERT_EQ(executor, executor2);
     ASSERT_EQ(2, _manager.getExecutorsNumber());
 }
+
+TEST(ExecutorManagerTests, returnTheSameSharedStreamsExecutorForAnyConfig) {
+    ExecutorManagerImpl _manager;
+    auto executor1 = _manager.getSharedCPUStreamsExecutor(IStreamsExecutor::Config{"Shared", 2});
+    auto executor2 = _manager.getSharedCPUStreamsExecutor(IStreamsExecutor::Config{"Shared", 4});
+    auto idleExecutor = _manager.getIdleCPUStreamsExecutor(IStreamsExecutor::Config{"Shared", 2});
+
+    ASSERT_EQ(executor1, executor2);
+    ASSERT_NE(executor1, idleExecutor);
+    _manager.clear("Shared");
+}
@@ -6,7 +6,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
 #include <limits>
+#include <vector>
 
 using namespace InferenceEngine;
 
@@ -46,3 +48,32 @@ TEST_F(PrecisionUtilsTests, FP32ToFP16LowestValue) {
     const auto fp16ConvertedLowestValue = InferenceEngine::PrecisionUtils::f32tof16(std::numeric_limits<float>::lowest());
     ASSERT_EQ(fp16ConvertedLowestValue, lowestNumber);
 }
+
+TEST_F(PrecisionUtilsTests, FP16ToFP32ArraysMatchScalarConversion) {
+    std::vector<ie_fp16> src(1 << 16);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<ie_fp16>(i);
+    }
+    std::vector<float> dst(src.size());
+    InferenceEngine::PrecisionUtils::f16tof32Arrays(dst.data(), src.data(), src.size());
+    for (size_t i = 0; i < src.size(); i++) {
+        const auto expected = InferenceEngine::PrecisionUtils::f16tof32(src[i]);
+        ASSERT_EQ(0, std::memcmp(&expected, &dst[i], sizeof(float))) << "for FP16 value " << i;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, FP32ToFP16ArraysMatchScalarConversion) {
+    // the size is not a multiple of the vector length and is big enough to be converted in parallel
+    std::vector<float> src;
+    for (uint64_t v = 0; v <= std::numeric_limits<uint32_t>::max(); v += 4099) {
+        const auto bits = static_cast<uint32_t>(v);
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        src.push_back(value);
+    }
+    std::vector<ie_fp16> dst(src.size());
+    InferenceEngine::PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), src.size());
+    for (size_t i = 0; i < src.size(); i++) {
+        ASSERT_EQ(InferenceEngine::PrecisionUtils::f32tof16(src[i]), dst[i]) << "for FP32 value " << src[i];
+    }
+}
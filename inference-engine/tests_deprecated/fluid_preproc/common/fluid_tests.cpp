@@ -370,6 +370,56 @@ TEST_P(ResizeRGB8UTestGAPI, AccuracyTest)
     }
 }
 
+TEST_P(ResizeRGB8UTo32FTestGAPI, AccuracyTest)
+{
+    int interp = 0;
+    cv::Size sz_in, sz_out;
+    double tolerance = 0.0;
+    std::pair<cv::Size, cv::Size> sizes;
+    std::tie(interp, sizes, tolerance) = GetParam();
+    std::tie(sz_in, sz_out) = sizes;
+
+    cv::Mat in_mat1 (sz_in, CV_8UC3);
+    cv::Scalar mean = cv::Scalar::all(127);
+    cv::Scalar stddev = cv::Scalar::all(40.f);
+
+    cv::randn(in_mat1, mean, stddev);
+
+    std::vector<cv::Mat> out_mats;
+    for (int p = 0; p < 3; p++) {
+        out_mats.emplace_back(sz_out, CV_32FC1);
+    }
+
+    // G-API code //////////////////////////////////////////////////////////////
+    FluidResizeRGB8UTo32FComputation rc(to_test(in_mat1), to_test(out_mats), interp);
+    rc.warmUp();
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ rc.apply(); },
+            100, "Resize GAPI %s 8UC3 -> 32FC1 planes %dx%d -> %dx%d",
+            interpToString(interp).c_str(),
+            sz_in.width, sz_in.height, sz_out.width, sz_out.height);
+#endif
+
+    // OpenCV code /////////////////////////////////////////////////////////////
+    std::vector<cv::Mat> out_mats_ocv;
+    {
+        cv::Mat resized;
+        cv::resize(in_mat1, resized, sz_out, 0, 0, interp);
+        cv::split(resized, out_mats_ocv);
+        for (auto& m : out_mats_ocv) {
+            m.convertTo(m, CV_32F);
+        }
+    }
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        for (int p = 0; p < 3; p++) {
+            EXPECT_LE(cv::norm(out_mats[p], out_mats_ocv[p], cv::NORM_INF), tolerance);
+        }
+    }
+}
+
 TEST_P(ResizeRoiTestGAPI, AccuracyTest)
 {
     int type = 0, interp = 0;
@@ -830,6 +880,70 @@ TEST_P(ResizeTestIE, AccuracyTest)
     }
 }
 
+TEST_P(ResizeRoisTestIE, AccuracyTest)
+{
+    int type = 0, interp = 0;
+    cv::Size sz_in, sz_out;
+    std::vector<cv::Rect> rois;
+    double tolerance = 0.0;
+    std::tie(type, interp, sz_in, rois, sz_out, tolerance) = GetParam();
+
+    cv::Mat in_mat1(sz_in, type);
+    cv::Scalar mean = cv::Scalar::all(127);
+    cv::Scalar stddev = cv::Scalar::all(40.f);
+
+    cv::randn(in_mat1, mean, stddev);
+
+    // one more image than ROIs to check the remaining batch is not touched
+    const int batch = static_cast<int>(rois.size()) + 1;
+    cv::Mat out_mat(sz_out.height * batch, sz_out.width, type, cv::Scalar::all(0));
+
+    // Inference Engine code ///////////////////////////////////////////////////
+
+    size_t channels = out_mat.channels();
+    int depth = CV_MAT_DEPTH(type);
+
+    using namespace InferenceEngine;
+
+    SizeVector  in_sv = { 1, channels, static_cast<size_t>(sz_in.height), static_cast<size_t>(sz_in.width) };
+    SizeVector out_sv = { static_cast<size_t>(batch), channels,
+                          static_cast<size_t>(sz_out.height), static_cast<size_t>(sz_out.width) };
+
+    // HWC blob: channels are interleaved
+    Precision precision = CV_8U == depth ? Precision::U8 : Precision::FP32;
+    TensorDesc  in_desc(precision,  in_sv, Layout::NHWC);
+    TensorDesc out_desc(precision, out_sv, Layout::NHWC);
+
+    Blob::Ptr in_blob, out_blob;
+    in_blob  = make_blob_with_precision(in_desc , in_mat1.data);
+    out_blob = make_blob_with_precision(out_desc, out_mat.data);
+
+    std::vector<ROI> ie_rois;
+    for (const auto& r : rois) {
+        ie_rois.push_back(ROI{0, static_cast<size_t>(r.x), static_cast<size_t>(r.y),
+                              static_cast<size_t>(r.width), static_cast<size_t>(r.height)});
+    }
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(in_blob, ie_rois);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(cv::INTER_AREA == interp ? RESIZE_AREA : RESIZE_BILINEAR);
+
+    preprocess->execute(out_blob, info, false);
+
+    // OpenCV code and comparison //////////////////////////////////////////////
+    for (size_t i = 0; i < rois.size(); i++) {
+        cv::Mat out_mat_ocv;
+        cv::resize(in_mat1(rois[i]), out_mat_ocv, sz_out, 0, 0, interp);
+
+        cv::Mat out_roi = out_mat(cv::Rect(0, static_cast<int>(i) * sz_out.height, sz_out.width, sz_out.height));
+        EXPECT_LE(cv::norm(out_mat_ocv, out_roi, cv::NORM_INF), tolerance) << "ROI " << i;
+    }
+    cv::Mat out_tail = out_mat(cv::Rect(0, static_cast<int>(rois.size()) * sz_out.height, sz_out.width, sz_out.height));
+    EXPECT_EQ(0, cv::norm(out_tail, cv::NORM_INF));
+}
+
 TEST_P(ColorConvertTestIE, AccuracyTest)
 {
     using namespace InferenceEngine;
@@ -12,6 +12,7 @@
 
 struct ResizeTestGAPI: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, double>> {};
 struct ResizeRGB8UTestGAPI: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, double>> {};
+struct ResizeRGB8UTo32FTestGAPI: public testing::TestWithParam<std::tuple<int, std::pair<cv::Size, cv::Size>, double>> {};
 struct SplitTestGAPI: public TestParams<std::tuple<int, int, cv::Size, double>> {};
 struct ChanToPlaneTestGAPI: public TestParams<std::tuple<int, int, cv::Size, double>> {};
 struct MergeTestGAPI: public TestParams<std::tuple<int, int, cv::Size, double>> {};
@@ -40,6 +41,13 @@ struct MeanValueGAPI: public TestParams<std::tuple<cv::Size, double>> {};
 //------------------------------------------------------------------------------
 
 struct ResizeTestIE: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, double>> {};
+struct ResizeRoisTestIE: public testing::TestWithParam<std::tuple<int,                    // matrix type
+                                                                  int,                    // interpolation
+                                                                  cv::Size,               // input size
+                                                                  std::vector<cv::Rect>,  // ROIs of the input
+                                                                  cv::Size,               // output size
+                                                                  double>>                // tolerance
+{};
 
 struct SplitTestIE: public TestParams<std::tuple<int, cv::Size, double>> {};
 struct MergeTestIE: public TestParams<std::tuple<int, cv::Size, double>> {};
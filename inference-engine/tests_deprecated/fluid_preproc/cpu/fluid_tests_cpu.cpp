@@ -109,6 +109,11 @@ INSTANTIATE_TEST_SUITE_P(ResizeRGB8UTestFluid_U8, ResizeRGB8UTestGAPI,
                                 Values(cv::INTER_LINEAR),
                                 Values(TEST_RESIZE_PAIRS),
                                 Values(4))); // error not more than 4 unit
+
+INSTANTIATE_TEST_SUITE_P(ResizeRGB8UTo32FTestFluid, ResizeRGB8UTo32FTestGAPI,
+                        Combine(Values(cv::INTER_LINEAR),
+                                Values(TEST_RESIZE_PAIRS),
+                                Values(4))); // error not more than 4 unit
 #else
 INSTANTIATE_TEST_SUITE_P(ResizeTestFluid_U8, ResizeTestGAPI,
                         Combine(Values(CV_8UC1, CV_8UC3),
@@ -121,6 +126,11 @@ INSTANTIATE_TEST_SUITE_P(ResizeRGB8UTestFluid_U8, ResizeRGB8UTestGAPI,
                                 Values(cv::INTER_LINEAR),
                                 Values(TEST_RESIZE_PAIRS),
                                 Values(1))); // error not more than 1 unit
+
+INSTANTIATE_TEST_SUITE_P(ResizeRGB8UTo32FTestFluid, ResizeRGB8UTo32FTestGAPI,
+                        Combine(Values(cv::INTER_LINEAR),
+                                Values(TEST_RESIZE_PAIRS),
+                                Values(1))); // error not more than 1 unit
 #endif
 
 INSTANTIATE_TEST_SUITE_P(ResizeTestFluid_F32, ResizeTestGAPI,
@@ -239,6 +249,28 @@ INSTANTIATE_TEST_SUITE_P(ResizeTestFluid_F32, ResizeTestIE,
                                 Values(TEST_RESIZE_PAIRS),
                                 Values(0.05))); // error within 0.05 units
 
+// ROIs of different sizes, both smaller and larger than the output
+#define TEST_RESIZE_ROIS                                                                       \
+    std::vector<cv::Rect>{cv::Rect(0, 0, 320, 200)},                                           \
+    std::vector<cv::Rect>{cv::Rect(10, 20, 300, 180), cv::Rect(317, 211, 640, 480),           \
+                          cv::Rect(1000, 5, 113, 71), cv::Rect(600, 500, 50, 40)}
+
+INSTANTIATE_TEST_SUITE_P(ResizeRoisTestFluid_U8, ResizeRoisTestIE,
+                        Combine(Values(CV_8UC1, CV_8UC3),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(cv::Size(1280, 720)),
+                                Values(TEST_RESIZE_ROIS),
+                                Values(cv::Size(224, 224)),
+                                Values(1))); // error not more than 1 unit
+
+INSTANTIATE_TEST_SUITE_P(ResizeRoisTestFluid_F32, ResizeRoisTestIE,
+                        Combine(Values(CV_32FC1, CV_32FC3),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(cv::Size(1280, 720)),
+                                Values(TEST_RESIZE_ROIS),
+                                Values(cv::Size(224, 224)),
+                                Values(0.05))); // error within 0.05 units
+
 INSTANTIATE_TEST_SUITE_P(SplitTestFluid, SplitTestIE,
                         Combine(Values(CV_8UC2, CV_8UC3, CV_8UC4,
                                        CV_32FC2, CV_32FC3, CV_32FC4),
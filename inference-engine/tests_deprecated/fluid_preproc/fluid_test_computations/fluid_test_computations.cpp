@@ -166,6 +166,25 @@ FluidResizeRGB8UComputation::FluidResizeRGB8UComputation(test::Mat inMat, test::
                                })
 {}
 
+static cv::GComputation buildResizeRGB8UTo32FComputation(test::Mat inMat, test::Mat outMat, int interp)
+{
+    cv::gapi::own::Size sz_in  { inMat.cols,  inMat.rows};
+    cv::gapi::own::Size sz_out {outMat.cols, outMat.rows};
+    cv::GMat in, out_r, out_g, out_b;
+
+    std::tie(out_r, out_g, out_b) = InferenceEngine::gapi::ScalePlanes32f::on(in, sz_in, sz_out, interp);
+
+    return cv::GComputation(cv::GIn(in), cv::GOut(out_r, out_g, out_b));
+}
+
+FluidResizeRGB8UTo32FComputation::FluidResizeRGB8UTo32FComputation(test::Mat inMat, std::vector<test::Mat> outMats,
+                                                                   int interp)
+    : FluidComputation(new Priv{buildResizeRGB8UTo32FComputation(inMat, outMats[0], interp)
+                               ,to_own(inMat)
+                               ,to_own(outMats)
+                               })
+{}
+
 static cv::GComputation buildSplitComputation(int planes)
 {
     std::vector<cv::GMat> ins(1);
@@ -74,6 +74,12 @@ public:
     FluidResizeRGB8UComputation(test::Mat inMat, test::Mat outMat, int interp);
 };
 
+class FLUID_COMPUTATION_VISIBILITY FluidResizeRGB8UTo32FComputation : public FluidComputation
+{
+public:
+    FluidResizeRGB8UTo32FComputation(test::Mat inMat, std::vector<test::Mat> outMats, int interp);
+};
+
 class FLUID_COMPUTATION_VISIBILITY FluidSplitComputation : public FluidComputation
 {
 public:
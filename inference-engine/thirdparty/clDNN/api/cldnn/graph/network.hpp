@@ -47,6 +47,23 @@ private:
     friend struct network;
 };
 
+/// @brief Device memory used by a network split by purpose.
+struct network_memory_footprint {
+    uint64_t weights = 0;         ///< Buffers of data primitives: weights, biases and other constants.
+    uint64_t intermediates = 0;   ///< Distinct buffers of the intermediate primitives, i.e. the memory pool records.
+    uint64_t inputs_outputs = 0;  ///< Buffers of the network inputs and outputs.
+    uint64_t kernels = 0;         ///< Binaries of the compiled kernels of the program.
+
+    uint64_t total() const { return weights + intermediates + inputs_outputs + kernels; }
+};
+
+/// @brief Device buffer which holds output of a primitive.
+/// @details Primitives which reuse the same buffer (via the memory pool or in-place optimizations) share a record.
+struct primitive_memory_info {
+    size_t record;   ///< Index of the buffer record within the network.
+    uint64_t bytes;  ///< Size of the buffer in bytes.
+};
+
 class primitive_inst;
 
 struct network {
@@ -146,6 +163,11 @@ public:
     const program::primitives_info& get_primitives_info() const;
     const program::graph_optimizer_info& get_optimizer_passes_info() const;
     std::map<primitive_id, primitive_id> get_ext_id_mapping() const;
+
+    /// @brief Returns device memory used by the network. Buffers shared by several primitives are counted once.
+    network_memory_footprint get_memory_footprint() const;
+    /// @brief Returns the buffer record of each primitive which has its output in device memory.
+    std::map<primitive_id, primitive_memory_info> get_primitives_memory_info() const;
     void execute_impl(const std::vector<event::ptr>& events);
 
     /// @brief Executes network and returns the list of @ref network_output.
@@ -200,6 +222,23 @@ private:
     std::unordered_map<primitive_id, event::ptr> _events;
     output_chains_map _output_chains;
 
+    // Static networks which consist of kernels only are recorded into a stream command buffer once and replayed
+    // by a single submission. The buffers used at recording time are kept to detect when re-recording is needed.
+    bool _recordable = false;
+    uint64_t _recording_id = 0;
+    size_t _recordings_count = 0;
+    std::vector<memory::ptr> _recorded_memory;
+
+    bool is_recordable() const;
+    std::vector<memory::ptr> get_kernel_memory() const;
+    bool is_recording_valid() const;
+
+    // Queue of the stream for each primitive of _exec_order, empty when the whole network runs on the main queue.
+    // Chains of primitives stay on one queue, so independent branches are executed concurrently.
+    std::vector<size_t> _exec_queues;
+
+    void assign_exec_queues();
+
     void build_exec_order();
     void allocate_primitive_instance(program_node const& node);
     void transfer_memory_to_device(std::shared_ptr<primitive_inst> instance, program_node const& node);
@@ -229,6 +229,8 @@ public:
     void init_kernels();
     kernel_id add_kernel(const std::shared_ptr<kernel_string> kernel_sring);
     kernel::ptr get_kernel(kernel_id id);
+    // Size of device binaries of the compiled kernels in bytes
+    uint64_t get_kernels_binaries_size() const;
 
     void load_tuning_cache();
     std::shared_ptr<kernel_selector::TuningCache> get_tuning_cache() const { return tuning_cache; }
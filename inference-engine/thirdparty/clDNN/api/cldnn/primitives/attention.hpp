@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "primitive.hpp"
+#include <vector>
+
+namespace cldnn {
+/// @addtogroup cpp_api C++ API
+/// @{
+/// @addtogroup cpp_topology Network Topology
+/// @{
+/// @addtogroup cpp_primitives Primitives
+/// @{
+
+/// @brief Scaled dot-product attention.
+/// @details Computes softmax(scale * query x key' + mask) x value over the two innermost dimensions (y - rows,
+/// x - columns) of the 4D inputs, the outer dimensions (b, f) are the batch and the heads.
+/// key' is the key or the transposed key, the optional mask is added to the scores with the broadcast along its
+/// dimensions of size 1. The scores matrix is not stored in the memory: the keys and the values are processed by the
+/// tiles in the local memory and the softmax is normalized on the fly.
+/// @n
+/// @n@b Requirements:
+/// @n - @c query - [b, f, M, D]
+/// @n - @c key - [b, f, N, D] if transposed, [b, f, D, N] otherwise
+/// @n - @c value - [b, f, N, Dv]
+/// @n - @c output - [b, f, M, Dv]
+struct attention : public primitive_base<attention> {
+    CLDNN_DECLARE_PRIMITIVE(attention)
+
+    /// @brief Constructs attention primitive.
+    /// @param id This primitive id.
+    /// @param query Query primitive id.
+    /// @param key Key primitive id.
+    /// @param value Value primitive id.
+    /// @param mask Mask primitive id added to the scores, empty if there is no mask.
+    /// @param transpose_key Flag for transposing the key matrix.
+    /// @param scale Scale of the scores.
+    /// @param output_dt Output data type, the query data type is used if not set.
+    attention(const primitive_id& id,
+              const primitive_id& query,
+              const primitive_id& key,
+              const primitive_id& value,
+              const primitive_id& mask,
+              const bool transpose_key,
+              const float scale,
+              const optional_data_type& output_dt = {},
+              const primitive_id& ext_prim_id = "",
+              const padding& output_padding = padding())
+        : primitive_base(id,
+                         mask.empty() ? std::vector<primitive_id>{query, key, value}
+                                      : std::vector<primitive_id>{query, key, value, mask},
+                         ext_prim_id,
+                         output_padding,
+                         output_dt),
+          transpose_key(transpose_key),
+          scale(scale) {}
+
+    /// @brief Flag for transposing the key matrix.
+    bool transpose_key;
+    /// @brief Scale of the scores.
+    float scale;
+};
+/// @}
+/// @}
+/// @}
+}  // namespace cldnn
@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "primitive.hpp"
+#include <vector>
+
+namespace cldnn {
+/// @addtogroup cpp_api C++ API
+/// @{
+/// @addtogroup cpp_topology Network Topology
+/// @{
+/// @addtogroup cpp_primitives Primitives
+/// @{
+
+/// @brief Layer normalization with the optional residual connection.
+/// @details Normalizes x = input + residual to 0-mean and unit variance within each b, f over the innermost
+/// dimensions (y, x) and applies the per element scale and shift:
+/// output = gamma * (x - mean(x)) / sqrt(variance(x) + epsilon) + beta.
+/// The input is read from the memory once, the sum of the residual connection is not stored.
+/// @n
+/// @n@b Requirements:
+/// @n - @c gamma and @c beta - [1, 1, y, x] of the input
+struct layer_norm : public primitive_base<layer_norm> {
+    CLDNN_DECLARE_PRIMITIVE(layer_norm)
+
+    /// @brief Constructs layer_norm primitive.
+    /// @param id This primitive id.
+    /// @param input Input primitive id.
+    /// @param residual Primitive id added to the input before the normalization, empty if there is no residual.
+    /// @param gamma Scale primitive id.
+    /// @param beta Shift primitive id.
+    /// @param epsilon Epsilon for not dividing by zero while normalizing.
+    /// @param eps_inside_sqrt The mode of applying epsilon.
+    /// @param output_dt Output data type, the input data type is used if not set.
+    layer_norm(const primitive_id& id,
+               const primitive_id& input,
+               const primitive_id& residual,
+               const primitive_id& gamma,
+               const primitive_id& beta,
+               const float epsilon,
+               const bool eps_inside_sqrt = true,
+               const optional_data_type& output_dt = {},
+               const primitive_id& ext_prim_id = "",
+               const padding& output_padding = padding())
+        : primitive_base(id, {input, gamma, beta}, ext_prim_id, output_padding, output_dt),
+          residual(residual),
+          epsilon(epsilon),
+          eps_inside_sqrt(eps_inside_sqrt) {}
+
+    /// @brief Primitive id added to the input before the normalization.
+    primitive_id residual;
+    /// @brief Epsilon for not dividing by zero while normalizing.
+    float epsilon;
+    /// @brief The mode of applying epsilon.
+    bool eps_inside_sqrt;
+
+protected:
+    std::vector<std::reference_wrapper<const primitive_id>> get_dependencies() const override {
+        if (residual.empty())
+            return {};
+        else
+            return {residual};
+    }
+};
+/// @}
+/// @}
+/// @}
+}  // namespace cldnn
@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "layout.hpp"
+#include "memory_caps.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace cldnn {
+
+struct memory;
+class engine;
+class stream;
+
+using memory_ptr = std::shared_ptr<memory>;
+
+// constants_cache is an engine-wide store of the constant buffers of the programs built for the engine.
+// The buffers are looked up by the layout and the hash of the content, and the matches are compared byte by byte,
+// so the programs built from the same weights (e.g. the same model loaded with another batch size) reference the
+// buffers already uploaded and reordered by the previous programs instead of allocating their own copies.
+// Only weak references are kept, the buffer is released when the last program using it is destroyed.
+class constants_cache {
+public:
+    explicit constants_cache(engine& engine);
+
+    // Returns the registered buffer of the given allocation type with the layout and the content of the given memory,
+    // nullptr if there is none. The hash of the content is returned in any case, so the buffer created for the content
+    // is registered without reading it again.
+    memory_ptr find(const memory_ptr& content, allocation_type type, stream& stream, size_t& hash);
+
+    // Registers the buffer with the content hash returned by find(), the writes to the buffer must be completed
+    void add(const memory_ptr& mem, size_t hash);
+
+    // Bytes of the device memory which are not allocated because the registered buffers were reused
+    uint64_t get_reused_bytes() const;
+
+private:
+    struct entry {
+        layout _layout;
+        allocation_type _type;
+        std::weak_ptr<memory> _memory;
+    };
+
+    template <typename Func>
+    void with_host_data(const memory_ptr& mem, stream& stream, Func func);
+
+    bool has_same_content(const memory_ptr& mem, const char* data, stream& stream);
+
+    engine& _engine;
+    mutable std::mutex _mutex;
+    std::unordered_multimap<size_t, entry> _entries;
+    size_t _prune_size;
+    uint64_t _reused_bytes;
+};
+
+}  // namespace cldnn
@@ -9,6 +9,7 @@
 #include "event.hpp"
 #include "memory_caps.hpp"
 #include "memory_pool.hpp"
+#include "constants_cache.hpp"
 #include "layout.hpp"
 
 #include <memory>
@@ -119,12 +120,22 @@ public:
     /// Subtracts @p bytes count from currently used memory size of the specified allocation @p type
     void subtract_memory_used(uint64_t bytes, allocation_type type);
 
+    /// Returns engine-wide pool of buffers grouped by size classes or nullptr if it's disabled in engine configuration
+    size_class_pool* get_size_class_pool() const { return _size_class_pool.get(); }
+
+    /// Returns engine-wide store of constant buffers shared by programs or nullptr if it's disabled in engine configuration
+    constants_cache* get_constants_cache() const { return _constants_cache.get(); }
+
     /// Returns true if USM is enabled in engine config and device/driver supports required features
     bool use_unified_shared_memory() const;
 
     /// Create stream object for current engine
     virtual stream_ptr create_stream() const = 0;
 
+    /// Create stream object with queue @p priority and @p throttle hints which override the ones of engine configuration.
+    /// Allows the networks sharing the engine to run on the queues of different priorities
+    virtual stream_ptr create_stream(priority_mode_types priority, throttle_mode_types throttle) const = 0;
+
     /// Returns service stream which can be used during program build and optimizations
     virtual stream& get_program_stream() const = 0;
 
@@ -161,6 +172,8 @@ protected:
 
     std::map<allocation_type, std::atomic<uint64_t>> _memory_usage_map;
     std::map<allocation_type, std::atomic<uint64_t>> _peak_memory_usage_map;
+    std::shared_ptr<size_class_pool> _size_class_pool;
+    std::unique_ptr<constants_cache> _constants_cache;
 };
 
 }  // namespace cldnn
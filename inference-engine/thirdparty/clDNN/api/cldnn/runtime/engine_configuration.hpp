@@ -69,6 +69,10 @@ struct engine_configuration {
     uint16_t n_threads;                       ///< Max number of host threads used in gpu plugin
     uint16_t n_streams;                       ///< Number of queues executed in parallel
     const std::string tuning_cache_path;      ///< Path to tuning kernel cache
+    const size_t kernels_cache_max_size;      ///< Max size of compiled kernels cache in bytes (0 means unlimited)
+    bool use_size_class_memory_pool;          ///< Enables engine-wide pool of device buffers grouped by size classes and shared by all networks
+    uint16_t n_branch_queues;                 ///< Number of in-order queues per stream used to execute independent branches concurrently
+    bool share_constants;                     ///< Enables engine-wide store of constant buffers shared by the programs with the same weights
 
     /// @brief Constructs engine configuration with specified options.
     /// @param enable_profiling Enable per-primitive profiling.
@@ -82,6 +86,10 @@ struct engine_configuration {
     /// @param n_threads Max number of host threads used in gpu plugin
     /// @param n_streams Number of queues executed in parallel
     /// @param tuning_cache_path Path to tuning kernel cache
+    /// @param kernels_cache_max_size Max size in bytes of binaries stored in kernels_cache_path, least recently used ones are evicted
+    /// @param use_size_class_memory_pool Controls whether buffers released by one network can be reused by other networks of the engine
+    /// @param n_branch_queues Number of queues each stream distributes independent network branches to (1 means single queue)
+    /// @param share_constants Controls whether programs reuse the constant buffers with the same content uploaded by other programs of the engine
     engine_configuration(
         bool enable_profiling = false,
         queue_types queue_type = queue_types::out_of_order,
@@ -93,7 +101,11 @@ struct engine_configuration {
         const std::string& kernels_cache_path = "",
         uint16_t n_threads = std::max(static_cast<uint16_t>(std::thread::hardware_concurrency()), static_cast<uint16_t>(1)),
         uint16_t n_streams = 1,
-        const std::string& tuning_cache_path = "cache.json")
+        const std::string& tuning_cache_path = "cache.json",
+        size_t kernels_cache_max_size = 0,
+        bool use_size_class_memory_pool = false,
+        uint16_t n_branch_queues = 1,
+        bool share_constants = true)
         : enable_profiling(enable_profiling)
         , queue_type(queue_type)
         , sources_dumps_dir(sources_dumps_dir)
@@ -104,7 +116,11 @@ struct engine_configuration {
         , kernels_cache_path(kernels_cache_path)
         , n_threads(n_threads)
         , n_streams(n_streams)
-        , tuning_cache_path(tuning_cache_path) { }
+        , tuning_cache_path(tuning_cache_path)
+        , kernels_cache_max_size(kernels_cache_max_size)
+        , use_size_class_memory_pool(use_size_class_memory_pool)
+        , n_branch_queues(n_branch_queues)
+        , share_constants(share_constants) { }
 };
 
 /// @}
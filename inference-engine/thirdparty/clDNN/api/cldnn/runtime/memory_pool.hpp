@@ -13,6 +13,9 @@
 #include <list>
 #include <string>
 #include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
 
 namespace cldnn {
 
@@ -82,11 +85,44 @@ struct padded_pool_comparer {
 // - images 2d - not implemented yet
 // - images 2d arrays - not implemented yet
 // - immutable - if user request for non reusable resource don't use pool, return
+// New non padded buffers are taken from the engine's size_class_pool if it's enabled
 
 // TODO list:
 // - Move from runtime to graph part
 // - Improve memory consumption
 
+// size_class_pool is an engine-wide tier under memory_pool which keeps device allocations grouped by size classes.
+// Buffers released by one network return to the free list of their class and can be reused by any other network
+// of the same engine regardless of the layout. Requested sizes are rounded up to one of 4 classes per power of two,
+// so the internal fragmentation is bounded by 25%, while the number of distinct allocation sizes stays small.
+class size_class_pool : public std::enable_shared_from_this<size_class_pool> {
+public:
+    explicit size_class_pool(engine& engine);
+
+    // Returns buffer of at least layout.bytes_count() size reinterpreted with the given layout.
+    // The block goes back to the free list when the returned object and all its copies are destroyed.
+    memory_ptr get_memory(const layout& layout, allocation_type type);
+
+    // Releases all free blocks to the device
+    void trim();
+
+    // Bytes of device memory held by the pool (both used and free blocks)
+    uint64_t get_reserved_bytes() const;
+    // Bytes requested by users of currently used blocks
+    uint64_t get_used_bytes() const;
+
+    static size_t get_size_class(size_t bytes);
+
+private:
+    void release_block(const memory_ptr& block, size_t requested_bytes);
+
+    engine& _engine;
+    mutable std::mutex _mutex;
+    std::map<std::pair<allocation_type, size_t>, std::vector<memory_ptr>> _free_blocks;
+    uint64_t _reserved_bytes;
+    uint64_t _used_bytes;
+};
+
 class memory_pool {
     memory_pool();
 
@@ -8,6 +8,7 @@
 #include "kernel.hpp"
 #include "kernel_args.hpp"
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -34,6 +35,8 @@ public:
                                       bool is_output_event = false) = 0;
     virtual event::ptr enqueue_marker(std::vector<event::ptr> const& deps, bool is_output_event = false) = 0;
     virtual void enqueue_barrier() = 0;
+    /// Commands enqueued after the barrier don't start on the device until @p deps are completed
+    virtual void enqueue_barrier(std::vector<event::ptr> const& deps) = 0;
     virtual event::ptr group_events(std::vector<event::ptr> const& deps) = 0;
     virtual void wait_for_events(const std::vector<event::ptr>& events) = 0;
     virtual event::ptr create_user_event(bool set) = 0;
@@ -41,6 +44,24 @@ public:
 
     queue_types get_queue_type() const { return queue_type; }
 
+    /// Returns true if kernels enqueued to the stream can be recorded once and replayed by a single submission
+    virtual bool supports_recording() const { return false; }
+    /// Starts recording: enqueued kernels are stored in a new command buffer with their current arguments instead of being submitted
+    virtual void begin_recording() {}
+    /// Finalizes the command buffer started by begin_recording() and returns its id, the previous command buffer is released
+    virtual uint64_t end_recording() { return 0; }
+    /// Returns id of the command buffer which is currently held by the stream, 0 if there is no one
+    virtual uint64_t get_recording_id() const { return 0; }
+    /// Submits the recorded command buffer after @p deps and returns the event of its completion
+    virtual event::ptr replay(std::vector<event::ptr> const& deps) { return enqueue_marker(deps); }
+
+    /// Returns number of device queues the stream can distribute enqueued commands to
+    virtual size_t get_queues_count() const { return 1; }
+    /// Routes subsequent enqueue calls to the queue @p idx, 0 is the main queue
+    virtual void set_queue_index(size_t /* idx */) {}
+    /// Makes every queue of the stream wait for the commands enqueued to all the other queues so far
+    virtual void sync_queues() {}
+
 
 #ifdef ENABLE_ONEDNN_FOR_GPU
     virtual dnnl::stream& get_onednn_stream() = 0;
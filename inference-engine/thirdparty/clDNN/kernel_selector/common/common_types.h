@@ -72,7 +72,9 @@ enum class KernelType {
     EXTRACT_IMAGE_PATCHES,
     LOOP,
     NON_MAX_SUPPRESSION,
-    DETECTION_OUTPUT
+    DETECTION_OUTPUT,
+    ATTENTION,
+    LAYER_NORM
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,14 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "attention_kernel_selector.h"
+#include "attention_kernel_tiled.h"
+
+namespace kernel_selector {
+attention_kernel_selector::attention_kernel_selector() { Attach<AttentionKernelTiled>(); }
+
+KernelsData attention_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
+    return GetNaiveBestKernel(params, options, KernelType::ATTENTION);
+}
+}  // namespace kernel_selector
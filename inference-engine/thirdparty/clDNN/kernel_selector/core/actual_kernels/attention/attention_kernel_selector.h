@@ -0,0 +1,23 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "kernel_selector.h"
+
+namespace kernel_selector {
+class attention_kernel_selector : public kernel_selector_base {
+public:
+    static attention_kernel_selector& Instance() {
+        static attention_kernel_selector instance_;
+        return instance_;
+    }
+
+    attention_kernel_selector();
+
+    virtual ~attention_kernel_selector() {}
+
+    KernelsData GetBestKernels(const Params& params, const optional_params& options) const override;
+};
+}  // namespace kernel_selector
@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "attention_kernel_tiled.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector {
+// number of the query rows processed by a work group, one per work item
+static constexpr size_t tile_m = 16;
+// number of the keys loaded to the local memory at once
+static constexpr size_t tile_n = 16;
+
+ParamsKey AttentionKernelTiled::GetSupportedKey() const {
+    ParamsKey k;
+    k.EnableInputDataType(Datatype::F16);
+    k.EnableInputDataType(Datatype::F32);
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableOutputDataType(Datatype::F32);
+    k.EnableInputLayout(DataLayout::bfyx);
+    k.EnableOutputLayout(DataLayout::bfyx);
+    k.EnableTensorOffset();
+    k.EnableTensorPitches();
+    k.EnableBatching();
+    k.EnableDifferentTypes();
+    return k;
+}
+
+bool AttentionKernelTiled::Validate(const Params& p, const optional_params& o) const {
+    if (p.GetType() != KernelType::ATTENTION || o.GetType() != KernelType::ATTENTION) {
+        return false;
+    }
+
+    const attention_params& params = static_cast<const attention_params&>(p);
+    if (params.inputs.size() != 3 && params.inputs.size() != 4) {
+        return false;
+    }
+
+    const auto& query = params.inputs[0];
+    const auto& key = params.inputs[1];
+    const auto& value = params.inputs[2];
+    for (const auto& t : {key, value, params.output}) {
+        if (t.Batch().v != query.Batch().v || t.Feature().v != query.Feature().v) {
+            return false;
+        }
+    }
+
+    if (query.X().v > max_head_size || value.X().v > max_head_size) {
+        return false;
+    }
+
+    return true;
+}
+
+CommonDispatchData AttentionKernelTiled::SetDefault(const attention_params& params) const {
+    CommonDispatchData dispatchData;
+    const auto& query = params.inputs[0];
+
+    dispatchData.gws = { CeilDiv(query.Y().v, tile_m) * tile_m, query.Feature().v, query.Batch().v };
+    dispatchData.lws = { tile_m, 1, 1 };
+
+    return dispatchData;
+}
+
+JitConstants AttentionKernelTiled::GetJitConstants(const attention_params& params) const {
+    JitConstants jit = MakeBaseParamsJitConstants(params);
+
+    const auto& key = params.inputs[1];
+    jit.AddConstants({
+        MakeJitConstant("TILE_M", tile_m),
+        MakeJitConstant("TILE_N", tile_n),
+        MakeJitConstant("QUERIES_NUM", params.inputs[0].Y().v),
+        MakeJitConstant("KEYS_NUM", params.transpose_key ? key.Y().v : key.X().v),
+        MakeJitConstant("HEAD_SIZE", params.inputs[0].X().v),
+        MakeJitConstant("VALUE_HEAD_SIZE", params.inputs[2].X().v),
+        MakeJitConstant("TRANSPOSE_KEY", params.transpose_key),
+        MakeJitConstant("HAS_MASK", params.inputs.size() == 4),
+        MakeJitConstant("SCALE", params.scale),
+    });
+
+    return jit;
+}
+
+KernelsData AttentionKernelTiled::GetKernelsData(const Params& params, const optional_params& options) const {
+    if (!Validate(params, options)) {
+        return {};
+    }
+
+    KernelData kd = KernelData::Default<attention_params>(params);
+    const attention_params& newParams = *static_cast<attention_params*>(kd.params.get());
+
+    auto dispatchData = SetDefault(newParams);
+    auto cldnn_jit = GetJitConstants(newParams);
+    auto entry_point = GetEntryPoint(kernelName, newParams.layerID, params, options);
+    auto jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+    auto& kernel = kd.kernels[0];
+    FillCLKernelData(kernel, dispatchData, params.engineInfo, kernelName, jit, entry_point, "", false, false,
+                     static_cast<int>(newParams.inputs.size()));
+
+    return { kd };
+}
+
+KernelsPriority AttentionKernelTiled::GetKernelsPriority(const Params& /*params*/, const optional_params& /*options*/) const {
+    return FORCE_PRIORITY_7;
+}
+}  // namespace kernel_selector
@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "kernel_base_opencl.h"
+
+namespace kernel_selector {
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// attention_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct attention_params : public base_params {
+    attention_params() : base_params(KernelType::ATTENTION) {}
+
+    bool transpose_key = false;
+    float scale = 1.0f;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// attention_optional_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct attention_optional_params : optional_params {
+    attention_optional_params() : optional_params(KernelType::ATTENTION) {}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// AttentionKernelTiled
+// Each work group computes a tile of the query rows of one batch and head. The keys and the values are loaded to the
+// local memory by the tiles and the softmax is normalized on the fly, so the scores are never stored.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class AttentionKernelTiled : public KernelBaseOpenCL {
+public:
+    AttentionKernelTiled() : KernelBaseOpenCL("attention_gpu_tiled") {}
+    virtual ~AttentionKernelTiled() {}
+
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+    KernelsPriority GetKernelsPriority(const Params& params, const optional_params& options) const override;
+    ParamsKey GetSupportedKey() const override;
+
+    // the query row and the output accumulator of a work item are kept in the registers
+    static constexpr size_t max_head_size = 128;
+
+protected:
+    bool Validate(const Params& p, const optional_params& o) const override;
+    JitConstants GetJitConstants(const attention_params& params) const;
+    CommonDispatchData SetDefault(const attention_params& params) const;
+};
+}  // namespace kernel_selector
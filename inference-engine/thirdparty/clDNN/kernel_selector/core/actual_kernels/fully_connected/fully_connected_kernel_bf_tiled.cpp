@@ -40,6 +40,8 @@ ParamsKey FullyConnected_bf_tiled::GetSupportedKey() const {
     k.EnableOutputDataType(Datatype::UINT8);
     k.EnableInputWeightsType(WeightsType::F16);
     k.EnableInputWeightsType(WeightsType::F32);
+    k.EnableInputWeightsType(WeightsType::INT8);
+    k.EnableInputWeightsType(WeightsType::UINT8);
     k.EnableInputLayout(DataLayout::bf);
     k.EnableInputLayout(DataLayout::bfyx);
     k.EnableOutputLayout(DataLayout::bf);
@@ -62,6 +64,14 @@ bool FullyConnected_bf_tiled::Validate(const Params& params, const optional_para
     auto& input = fc_params.inputs[0];
     auto& output = fc_params.output;
 
+    // Compressed i8/u8 weights are converted to the input type inside the kernel and loaded with char block reads.
+    if (fc_params.weights.GetDType() == WeightsType::INT8 || fc_params.weights.GetDType() == WeightsType::UINT8) {
+        if (!fc_params.engineInfo.bSubGroupCharSupport)
+            return false;
+        if (input.GetDType() != Datatype::F16 && input.GetDType() != Datatype::F32)
+            return false;
+    }
+
     // Block reads must be aligned to 4 bytes, for fp16 we can correct for offset misalignment,
     // but we need to ensure that batch pitch preserves alignment.
     if (input.GetDType() == Datatype::F16) {
@@ -262,8 +272,12 @@ KernelsPriority FullyConnected_bf_tiled::GetKernelsPriority(const Params& params
     if (fc_params.output.GetLayout() == DataLayout::bfyx)
         output_b *= fc_params.output.Feature().v;
 
+    bool compressed_weights = fc_params.weights.GetDType() == WeightsType::INT8 || fc_params.weights.GetDType() == WeightsType::UINT8;
+
     float estimated_time = DONT_USE_IF_HAVE_SOMETHING_ELSE;
-    if (output_b > 1 && fc_params.inputs[0].GetDType() == Datatype::F32)
+    if (compressed_weights)
+        estimated_time = FORCE_PRIORITY_4;
+    else if (output_b > 1 && fc_params.inputs[0].GetDType() == Datatype::F32)
         estimated_time = FORCE_PRIORITY_3;
     else if (output_b > 1 && fc_params.inputs[0].GetDType() == Datatype::F16)
         estimated_time = FORCE_PRIORITY_4;
@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "layer_norm_kernel_bfyx_opt.h"
+#include "kernel_selector_utils.h"
+
+#include <algorithm>
+
+namespace kernel_selector {
+ParamsKey LayerNormKernelBfyxOpt::GetSupportedKey() const {
+    ParamsKey k;
+    k.EnableInputDataType(Datatype::F16);
+    k.EnableInputDataType(Datatype::F32);
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableOutputDataType(Datatype::F32);
+    k.EnableInputLayout(DataLayout::bfyx);
+    k.EnableOutputLayout(DataLayout::bfyx);
+    k.EnableTensorOffset();
+    k.EnableTensorPitches();
+    k.EnableBatching();
+    k.EnableDifferentTypes();
+    return k;
+}
+
+bool LayerNormKernelBfyxOpt::Validate(const Params& p, const optional_params& o) const {
+    if (p.GetType() != KernelType::LAYER_NORM || o.GetType() != KernelType::LAYER_NORM) {
+        return false;
+    }
+
+    const layer_norm_params& params = static_cast<const layer_norm_params&>(p);
+    if (params.inputs.size() != (params.has_residual ? 4u : 3u)) {
+        return false;
+    }
+
+    const auto& input = params.inputs[0];
+    if (input.X().v * input.Y().v > max_items_per_work_item * params.engineInfo.maxWorkGroupSize) {
+        return false;
+    }
+
+    return true;
+}
+
+LayerNormKernelBfyxOpt::DispatchData LayerNormKernelBfyxOpt::SetDefault(const layer_norm_params& params) const {
+    DispatchData dispatchData;
+    const auto& input = params.inputs[0];
+
+    dispatchData.dataSetSize = input.X().v * input.Y().v;
+
+    // the smallest power of two work group keeping the data set in the registers, the tree reduction expects the
+    // power of two
+    size_t lws = 16;
+    while (lws * max_items_per_work_item < dispatchData.dataSetSize && 2 * lws <= params.engineInfo.maxWorkGroupSize) {
+        lws *= 2;
+    }
+    dispatchData.itemsNum = CeilDiv(dispatchData.dataSetSize, lws);
+
+    dispatchData.gws = { lws, input.Batch().v * input.Feature().v, 1 };
+    dispatchData.lws = { lws, 1, 1 };
+
+    return dispatchData;
+}
+
+JitConstants LayerNormKernelBfyxOpt::GetJitConstants(const layer_norm_params& params,
+                                                     const DispatchData& dispatchData) const {
+    JitConstants jit = MakeBaseParamsJitConstants(params);
+
+    jit.AddConstants({
+        MakeJitConstant("LWS", dispatchData.lws[0]),
+        MakeJitConstant("ITEMS_NUM", dispatchData.itemsNum),
+        MakeJitConstant("DATA_SET_SIZE", dispatchData.dataSetSize),
+        MakeJitConstant("HAS_RESIDUAL", params.has_residual),
+        MakeJitConstant("EPSILON", params.epsilon),
+        MakeJitConstant(params.eps_mode == MVNEpsMode::INSIDE_SQRT ? "EPS_INSIDE_SQRT" : "EPS_OUTSIDE_SQRT", true),
+    });
+
+    return jit;
+}
+
+KernelsData LayerNormKernelBfyxOpt::GetKernelsData(const Params& params, const optional_params& options) const {
+    if (!Validate(params, options)) {
+        return {};
+    }
+
+    KernelData kd = KernelData::Default<layer_norm_params>(params);
+    const layer_norm_params& newParams = *static_cast<layer_norm_params*>(kd.params.get());
+
+    auto dispatchData = SetDefault(newParams);
+    auto cldnn_jit = GetJitConstants(newParams, dispatchData);
+    auto entry_point = GetEntryPoint(kernelName, newParams.layerID, params, options);
+    auto jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+    auto& kernel = kd.kernels[0];
+    FillCLKernelData(kernel, dispatchData, params.engineInfo, kernelName, jit, entry_point, "", false, false,
+                     static_cast<int>(newParams.inputs.size()));
+
+    return { kd };
+}
+
+KernelsPriority LayerNormKernelBfyxOpt::GetKernelsPriority(const Params& /*params*/, const optional_params& /*options*/) const {
+    return FORCE_PRIORITY_7;
+}
+}  // namespace kernel_selector
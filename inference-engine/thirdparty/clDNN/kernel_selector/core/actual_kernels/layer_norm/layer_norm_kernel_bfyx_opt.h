@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "kernel_base_opencl.h"
+
+namespace kernel_selector {
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// layer_norm_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct layer_norm_params : public base_params {
+    layer_norm_params() : base_params(KernelType::LAYER_NORM) {}
+
+    bool has_residual = false;
+    float epsilon = 0.0f;
+    MVNEpsMode eps_mode = MVNEpsMode::INSIDE_SQRT;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// layer_norm_optional_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct layer_norm_optional_params : optional_params {
+    layer_norm_optional_params() : optional_params(KernelType::LAYER_NORM) {}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// LayerNormKernelBfyxOpt
+// A work group normalizes one data set (b, f). The values of the data set are kept in the registers of the work
+// items between the mean and the variance reductions, so the input and the residual are read once.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class LayerNormKernelBfyxOpt : public KernelBaseOpenCL {
+public:
+    LayerNormKernelBfyxOpt() : KernelBaseOpenCL("layer_norm_gpu_bfyx_opt") {}
+    virtual ~LayerNormKernelBfyxOpt() {}
+
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+    KernelsPriority GetKernelsPriority(const Params& params, const optional_params& options) const override;
+    ParamsKey GetSupportedKey() const override;
+
+    // maximal number of the values kept in the registers of a work item
+    static constexpr size_t max_items_per_work_item = 16;
+
+protected:
+    struct DispatchData : public CommonDispatchData {
+        size_t dataSetSize = 0;
+        size_t itemsNum = 0;
+    };
+
+    bool Validate(const Params& p, const optional_params& o) const override;
+    JitConstants GetJitConstants(const layer_norm_params& params, const DispatchData& dispatchData) const;
+    DispatchData SetDefault(const layer_norm_params& params) const;
+};
+}  // namespace kernel_selector
@@ -0,0 +1,14 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "layer_norm_kernel_selector.h"
+#include "layer_norm_kernel_bfyx_opt.h"
+
+namespace kernel_selector {
+layer_norm_kernel_selector::layer_norm_kernel_selector() { Attach<LayerNormKernelBfyxOpt>(); }
+
+KernelsData layer_norm_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
+    return GetNaiveBestKernel(params, options, KernelType::LAYER_NORM);
+}
+}  // namespace kernel_selector
@@ -0,0 +1,23 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "kernel_selector.h"
+
+namespace kernel_selector {
+class layer_norm_kernel_selector : public kernel_selector_base {
+public:
+    static layer_norm_kernel_selector& Instance() {
+        static layer_norm_kernel_selector instance_;
+        return instance_;
+    }
+
+    layer_norm_kernel_selector();
+
+    virtual ~layer_norm_kernel_selector() {}
+
+    KernelsData GetBestKernels(const Params& params, const optional_params& options) const override;
+};
+}  // namespace kernel_selector
@@ -14,6 +14,7 @@
 #include <memory>
 #include <utility>
 #include <tuple>
+#include <limits>
 
 namespace kernel_selector {
 
@@ -166,11 +167,12 @@ TuningCache::Entry TuningCache::LoadKernel_v2(const Params& params, uint32_t com
     return std::make_tuple(prog[0].GetString(), prog[1].GetInt());
 }
 
-void TuningCache::StoreKernel(const Params& params, const std::string& implementationName, int tuneIndex) {
-    StoreKernel(params, params.engineInfo.computeUnitsCount, implementationName, tuneIndex);
+void TuningCache::StoreKernel(const Params& params, const std::string& implementationName, int tuneIndex, uint64_t runTime) {
+    StoreKernel(params, params.engineInfo.computeUnitsCount, implementationName, tuneIndex, runTime);
 }
 
-void TuningCache::StoreKernel(const Params& params, uint32_t computeUnitsCount, const std::string& implementationName, int tuneIndex) {
+void TuningCache::StoreKernel(const Params& params, uint32_t computeUnitsCount, const std::string& implementationName, int tuneIndex,
+                              uint64_t runTime) {
     auto kTypeStr = toString(params.GetType());
     auto paramStr = params.to_cache_string_v2();
     auto computeUnitsStr = std::to_string(computeUnitsCount);
@@ -196,7 +198,14 @@ void TuningCache::StoreKernel(const Params& params, uint32_t computeUnitsCount,
     auto implIndex = rapidjson::Value(tuneIndex);
     implDetails.PushBack(implName, cache.GetAllocator());
     implDetails.PushBack(implIndex, cache.GetAllocator());
+    // Loaders read only the first two elements, so the run time doesn't break older readers of the cache
+    if (runTime != 0 && runTime != std::numeric_limits<uint64_t>::max()) {
+        auto implTime = rapidjson::Value(runTime);
+        implDetails.PushBack(implTime, cache.GetAllocator());
+    }
 
+    // rapidjson doesn't check names uniqueness, so retuned entry must replace the existing one
+    deviceCache.RemoveMember(paramStr.c_str());
     deviceCache.AddMember(paramName, implDetails, cache.GetAllocator());
 
     // Remove from old version if present
@@ -292,13 +301,14 @@ std::tuple<std::string, int> AutoTuner::LoadKernelOnline(const TuningMode tuning
 void AutoTuner::StoreKernel(const std::string& cacheFilePath,
                             const Params& params,
                             std::string implementationName,
-                            const int tuneIndex) {
+                            const int tuneIndex,
+                            const uint64_t runTime) {
     std::lock_guard<std::mutex> lock(mutex);
     if (!onlineCache || lastCachePath != cacheFilePath) {
         onlineCache = std::make_shared<TuningCache>(cacheFilePath, true);
         lastCachePath = cacheFilePath;
     }
-    onlineCache->StoreKernel(params, implementationName, tuneIndex);
+    onlineCache->StoreKernel(params, implementationName, tuneIndex, runTime);
     onlineCache->Save(cacheFilePath);
 }
 
@@ -36,10 +36,12 @@ public:
     Entry LoadKernel(const Params& params, bool update = true);
     // Overrides the compute units count in params.
     Entry LoadKernel(const Params& params, uint32_t computeUnitsCount, bool update = true);
-    // Stores kernel for specified params.
-    void StoreKernel(const Params& params, const std::string& implementationName, int tuneIndex);
+    // Stores kernel for specified params, replacing the entry stored before.
+    // runTime - measured kernel run time in nanoseconds, kept in the entry for reference only if not 0.
+    void StoreKernel(const Params& params, const std::string& implementationName, int tuneIndex, uint64_t runTime = 0);
     // Overrides the compute units count in params.
-    void StoreKernel(const Params& params, uint32_t computeUnitsCount, const std::string& implementationName, int tuneIndex);
+    void StoreKernel(const Params& params, uint32_t computeUnitsCount, const std::string& implementationName, int tuneIndex,
+                     uint64_t runTime = 0);
     // Removes the cached kernel for specified params if it exists, for all cache versions.
     void RemoveKernel(const Params& params);
     // Saves the internal cache to specified file.
@@ -71,7 +73,8 @@ public:
     void StoreKernel(const std::string& cacheFilePath,
                      const Params& params,
                      std::string implementationName,
-                     const int tuneIndex);
+                     const int tuneIndex,
+                     const uint64_t runTime = 0);
     void RemoveKernel(const std::string& cacheFilePath,
                       const Params& params);
     std::tuple<std::string, int> LoadKernelOffline(TuningCache* cache,
@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "include/batch_headers/data_types.cl"
+#include "include/batch_headers/fetch_data.cl"
+
+// query [b, f, QUERIES_NUM, HEAD_SIZE], key [b, f, KEYS_NUM, HEAD_SIZE] if TRANSPOSE_KEY or [b, f, HEAD_SIZE, KEYS_NUM]
+// otherwise, value [b, f, KEYS_NUM, VALUE_HEAD_SIZE], mask broadcastable to [b, f, QUERIES_NUM, KEYS_NUM]
+__attribute__((reqd_work_group_size(TILE_M, 1, 1)))
+KERNEL(attention_gpu_tiled)(
+    const __global INPUT0_TYPE* query,
+    const __global INPUT1_TYPE* key,
+    const __global INPUT2_TYPE* value,
+#if HAS_MASK
+    const __global INPUT3_TYPE* mask,
+#endif
+    __global OUTPUT_TYPE* output)
+{
+    const uint m = (uint)get_global_id(0);
+    const uint lid = (uint)get_local_id(0);
+    const uint f = (uint)get_global_id(1);
+    const uint b = (uint)get_global_id(2);
+    // the work items out of the queries range only help to load the tiles
+    const bool active = m < QUERIES_NUM;
+
+    __local INPUT1_TYPE key_tile[TILE_N * HEAD_SIZE];
+    __local INPUT2_TYPE value_tile[TILE_N * VALUE_HEAD_SIZE];
+
+    // the scale is applied to the query once instead of every score
+    float q[HEAD_SIZE];
+    for (uint d = 0; d < HEAD_SIZE; d++) {
+        q[d] = active ? (float)query[INPUT0_GET_INDEX(b, f, m, d)] * SCALE : 0.f;
+    }
+
+    float acc[VALUE_HEAD_SIZE];
+    for (uint d = 0; d < VALUE_HEAD_SIZE; d++) {
+        acc[d] = 0.f;
+    }
+    float max_score = -FLT_MAX;
+    float sum = 0.f;
+
+    for (uint n0 = 0; n0 < KEYS_NUM; n0 += TILE_N) {
+        const uint tile_size = min((uint)TILE_N, (uint)(KEYS_NUM - n0));
+
+        // the previous tile is consumed by all the work items
+        barrier(CLK_LOCAL_MEM_FENCE);
+        for (uint i = lid; i < tile_size * HEAD_SIZE; i += TILE_M) {
+            const uint n = i / HEAD_SIZE;
+            const uint d = i % HEAD_SIZE;
+#if TRANSPOSE_KEY
+            key_tile[i] = key[INPUT1_GET_INDEX(b, f, n0 + n, d)];
+#else
+            key_tile[i] = key[INPUT1_GET_INDEX(b, f, d, n0 + n)];
+#endif
+        }
+        for (uint i = lid; i < tile_size * VALUE_HEAD_SIZE; i += TILE_M) {
+            const uint n = i / VALUE_HEAD_SIZE;
+            const uint d = i % VALUE_HEAD_SIZE;
+            value_tile[i] = value[INPUT2_GET_INDEX(b, f, n0 + n, d)];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        if (active) {
+            float scores[TILE_N];
+            float tile_max = max_score;
+            for (uint n = 0; n < tile_size; n++) {
+                float score = 0.f;
+                for (uint d = 0; d < HEAD_SIZE; d++) {
+                    score = mad(q[d], (float)key_tile[n * HEAD_SIZE + d], score);
+                }
+#if HAS_MASK
+                score += (float)mask[INPUT3_GET_INDEX(b % INPUT3_BATCH_NUM,
+                                                      f % INPUT3_FEATURE_NUM,
+                                                      m % INPUT3_SIZE_Y,
+                                                      (n0 + n) % INPUT3_SIZE_X)];
+#endif
+                scores[n] = score;
+                tile_max = fmax(tile_max, score);
+            }
+
+            // online softmax: the accumulated values are rescaled when the maximal score grows
+            const float correction = native_exp(max_score - tile_max);
+            sum *= correction;
+            for (uint d = 0; d < VALUE_HEAD_SIZE; d++) {
+                acc[d] *= correction;
+            }
+            for (uint n = 0; n < tile_size; n++) {
+                const float weight = native_exp(scores[n] - tile_max);
+                sum += weight;
+                for (uint d = 0; d < VALUE_HEAD_SIZE; d++) {
+                    acc[d] = mad(weight, (float)value_tile[n * VALUE_HEAD_SIZE + d], acc[d]);
+                }
+            }
+            max_score = tile_max;
+        }
+    }
+
+    if (active) {
+        const float inv_sum = 1.f / sum;
+        for (uint d = 0; d < VALUE_HEAD_SIZE; d++) {
+            output[OUTPUT_GET_INDEX(b, f, m, d)] = ACTIVATION(TO_OUTPUT_TYPE(acc[d] * inv_sum), ACTIVATION_PARAMS);
+        }
+    }
+}
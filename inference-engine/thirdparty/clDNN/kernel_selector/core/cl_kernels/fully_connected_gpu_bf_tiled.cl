@@ -45,6 +45,7 @@
 #define ACTIVATION_VEC_TYPE       MAKE_VECTOR_TYPE(ACTIVATION_TYPE, TILE_OFM)
 #define TO_OUTPUT_VEC_TYPE(x)     CAT(convert_, OUTPUT_VEC_TYPE)(x)
 #define TO_ACTIVATION_VEC_TYPE(x) CAT(convert_, ACTIVATION_VEC_TYPE)(x)
+#define TO_ACCUMULATOR_VEC_TYPE(x) CAT(convert_, ACCUMULATOR_VEC_TYPE)(x)
 
 #define INPUT_BLOCK_READ(ptr, offset)        BLOCK_READN(INPUT0_TYPE, TILE_IFM, ptr, offset)
 #define FILTER_BLOCK_READ(ptr, offset)       BLOCK_READN(FILTER_TYPE, TILE_K_OFM, ptr, offset)
@@ -123,7 +124,7 @@ KERNEL(fc)(
 
         __attribute__((opencl_unroll_hint))
         for (uint bi = 0; bi < TILE_B; ++bi) {
-            acc[bi] = intel_sub_group_shuffle(tmp_input, bi) * tmp_wei;
+            acc[bi] = intel_sub_group_shuffle(tmp_input, bi) * TO_ACCUMULATOR_VEC_TYPE(tmp_wei);
         }
 
         weights_offset += TILE_OFM * SIMD;
@@ -301,6 +302,7 @@ KERNEL(fc)(
 #undef ACTIVATION_VEC_TYPE
 #undef TO_OUTPUT_VEC_TYPE
 #undef TO_ACTIVATION_VEC_TYPE
+#undef TO_ACCUMULATOR_VEC_TYPE
 
 #undef INPUT_BLOCK_READ
 #undef FILTER_BLOCK_READ
@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "include/batch_headers/data_types.cl"
+#include "include/batch_headers/fetch_data.cl"
+
+__attribute__((reqd_work_group_size(LWS, 1, 1)))
+KERNEL(layer_norm_gpu_bfyx_opt)(
+    const __global INPUT0_TYPE* input,
+    const __global INPUT1_TYPE* gamma,
+    const __global INPUT2_TYPE* beta,
+#if HAS_RESIDUAL
+    const __global INPUT3_TYPE* residual,
+#endif
+    __global OUTPUT_TYPE* output)
+{
+    const uint lid = (uint)get_local_id(0);
+    const uint data_set_idx = (uint)get_global_id(1);
+    const uint b = data_set_idx / INPUT0_FEATURE_NUM;
+    const uint f = data_set_idx % INPUT0_FEATURE_NUM;
+
+    __local float lg_storage[LWS];
+
+    // the data set is kept in the registers between the reductions, so the input is read once
+    float values[ITEMS_NUM];
+    float my_sum = 0.f;
+    for (uint i = 0; i < ITEMS_NUM; ++i) {
+        const uint idx = lid + i * LWS;
+        float val = 0.f;
+        if (idx < DATA_SET_SIZE) {
+            const uint y = idx / INPUT0_SIZE_X;
+            const uint x = idx % INPUT0_SIZE_X;
+            val = (float)input[INPUT0_GET_INDEX(b, f, y, x)];
+#if HAS_RESIDUAL
+            val += (float)residual[INPUT3_GET_INDEX(b, f, y, x)];
+#endif
+        }
+        values[i] = val;
+        my_sum += val;
+    }
+
+    lg_storage[lid] = my_sum;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    for (uint offset = LWS / 2; offset > 0; offset /= 2) {
+        if (lid < offset)
+            lg_storage[lid] += lg_storage[lid + offset];
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+    const float mean = lg_storage[0] / DATA_SET_SIZE;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    float my_variance = 0.f;
+    for (uint i = 0; i < ITEMS_NUM; ++i) {
+        if (lid + i * LWS < DATA_SET_SIZE) {
+            const float tmp = values[i] - mean;
+            my_variance = fma(tmp, tmp, my_variance);
+        }
+    }
+
+    lg_storage[lid] = my_variance;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    for (uint offset = LWS / 2; offset > 0; offset /= 2) {
+        if (lid < offset)
+            lg_storage[lid] += lg_storage[lid + offset];
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+    const float variance = lg_storage[0] / DATA_SET_SIZE;
+#if defined EPS_OUTSIDE_SQRT
+    const float inv_std = native_powr(native_sqrt(variance) + (float)EPSILON, -1.f);
+#else
+    const float inv_std = native_powr(variance + (float)EPSILON, -0.5f);
+#endif
+
+    for (uint i = 0; i < ITEMS_NUM; ++i) {
+        const uint idx = lid + i * LWS;
+        if (idx < DATA_SET_SIZE) {
+            const uint y = idx / INPUT0_SIZE_X;
+            const uint x = idx % INPUT0_SIZE_X;
+            const float result = fma((values[i] - mean) * inv_std,
+                                     (float)gamma[INPUT1_GET_INDEX(0, 0, y, x)],
+                                     (float)beta[INPUT2_GET_INDEX(0, 0, y, x)]);
+            output[OUTPUT_GET_INDEX(b, f, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(result), ACTIVATION_PARAMS);
+        }
+    }
+}
@@ -64,13 +64,71 @@ kernel_selector_base::kernel_selector_base() {
 #endif
 }
 
+// The key of the naive selection: the implementation selected for a key is validated again with the actual params,
+// so the parts of the params which aren't in the key can only make the search run again
+static std::string GetSelectionKey(const Params& params, const optional_params& options) {
+    std::stringstream s;
+    s << params.to_string() << ";" << params.to_cache_string_v2() << ";" << params.forceImplementation << ";";
+    s << params.engineInfo.deviceId << "_" << params.engineInfo.driverVersion << "_" << params.engineInfo.computeUnitsCount << ";";
+
+    if (auto base = dynamic_cast<const base_params*>(&params)) {
+        for (const auto& activation : base->activations) {
+            s << activation.to_string() << "_";
+        }
+        for (const auto& fused_op : base->fused_ops) {
+            s << toString(fused_op.GetType()) << "_" << fused_op.dep_size << "_" << toString_v2(fused_op.output_tensor) << "_";
+            for (const auto& tensor : fused_op.tensors) {
+                s << toString_v2(tensor) << "_";
+            }
+        }
+        s << ";";
+    }
+
+    for (auto l : options.inputLayouts) {
+        s << toString(l) << "_";
+    }
+    s << ";";
+    for (auto l : options.outputLayouts) {
+        s << toString(l) << "_";
+    }
+    s << ";" << options.meaningfulKernelsNames << options.allowStaticInputReordering << options.allowInputReordering
+      << options.allowOutputReordering;
+
+    return s.str();
+}
+
 KernelsData kernel_selector_base::GetNaiveBestKernel(const Params& params,
                                                      const optional_params& options,
                                                      KernelType kType) const {
     KernelsData kernelsData;
     std::string kernelName;
 
-    auto allImplementations = GetAllImplementations(params, options, kType);
+    if (params.GetType() != kType || options.GetType() != kType)
+        return kernelsData;
+
+    const auto selectionKey = GetSelectionKey(params, options);
+    std::shared_ptr<KernelBase> selectedImplementation;
+    {
+        std::lock_guard<std::mutex> lock(selectedImplementationsMutex);
+        auto it = selectedImplementations.find(selectionKey);
+        if (it != selectedImplementations.end())
+            selectedImplementation = it->second;
+    }
+
+    if (selectedImplementation) {
+        try {
+            KernelsData kds = selectedImplementation->GetKernelsData(params, options);
+            if (kds.size() && kds[0].kernels.size()) {
+                kernelsData = kds;
+                kernelName = selectedImplementation->GetName();
+            }
+        } catch (std::runtime_error&) {
+            // the params differ in the part which isn't in the key, the full search is done below
+        }
+        selectedImplementation = nullptr;
+    }
+
+    auto allImplementations = kernelsData.empty() ? GetAllImplementations(params, options, kType) : KernelList{};
 
     for (const auto& implementation : allImplementations) {
         // TODO: Unify this check with the Validate virtual method. Make
@@ -93,6 +151,7 @@ KernelsData kernel_selector_base::GetNaiveBestKernel(const Params& params,
 #endif
                     kernelsData = kds;
                     kernelName = implementation->GetName();
+                    selectedImplementation = implementation;
                     break;
 #ifdef ENABLE_ENV
                 }
@@ -103,6 +162,11 @@ KernelsData kernel_selector_base::GetNaiveBestKernel(const Params& params,
         }
     }
 
+    if (selectedImplementation) {
+        std::lock_guard<std::mutex> lock(selectedImplementationsMutex);
+        selectedImplementations[selectionKey] = selectedImplementation;
+    }
+
     // TODO: find a better place to located this assignment
     if (kernelsData.size()) {
         kernelsData[0].kernelName = kernelName;
@@ -223,7 +287,8 @@ KernelsData kernel_selector_base::GetAutoTuneBestKernel(const Params& params,
         autoTuner.StoreKernel(options.tuningParams.cacheFilePath,
                                 params,
                                 kernelName,
-                                kernelsData[0].autoTuneIndex);
+                                kernelsData[0].autoTuneIndex,
+                                kernelsData[0].runTime);
     } else {
         // Tuning failed, fall back to naive path
         return GetNaiveBestKernel(params, options, kType);
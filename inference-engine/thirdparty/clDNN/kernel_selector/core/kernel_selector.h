@@ -11,6 +11,8 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <mutex>
+#include <unordered_map>
 
 namespace kernel_selector {
 class KernelBase;
@@ -44,6 +46,11 @@ protected:
     KernelList implementations;
     ForceList forceKernels;
 
+    // Implementations selected by GetNaiveBestKernel for the params keys, so the repeated identical layers
+    // only validate the selected implementation instead of searching through all of them
+    mutable std::mutex selectedImplementationsMutex;
+    mutable std::unordered_map<std::string, std::shared_ptr<KernelBase>> selectedImplementations;
+
     static AutoTuner autoTuner;
 };
 }  // namespace kernel_selector
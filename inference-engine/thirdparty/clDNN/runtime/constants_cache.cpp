@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cldnn/runtime/constants_cache.hpp"
+#include "cldnn/runtime/engine.hpp"
+#include "cldnn/runtime/event.hpp"
+#include "cldnn/runtime/memory.hpp"
+#include "cldnn/runtime/stream.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace cldnn {
+
+namespace {
+size_t hash_bytes(const char* data, size_t size) {
+    // FNV-1a over 8 byte words, the hash only narrows the candidates which are then compared byte by byte
+    const uint64_t prime = 1099511628211ULL;
+    uint64_t hash = 14695981039346656037ULL ^ size;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < size; i++) {
+        hash = (hash ^ static_cast<unsigned char>(data[i])) * prime;
+    }
+    return static_cast<size_t>(hash);
+}
+}  // namespace
+
+constants_cache::constants_cache(engine& engine) : _engine(engine), _prune_size(64), _reused_bytes(0) { }
+
+template <typename Func>
+void constants_cache::with_host_data(const memory_ptr& mem, stream& stream, Func func) {
+    if (mem->get_allocation_type() != allocation_type::usm_device) {
+        mem_lock<char, mem_lock_type::read> lock{mem, stream};
+        func(lock.data());
+        return;
+    }
+
+    // The device memory can't be locked, so it is read back
+    auto host_mem = _engine.allocate_memory(mem->get_layout(), allocation_type::usm_host, false);
+    host_mem->copy_from(stream, *mem)->wait();
+    mem_lock<char, mem_lock_type::read> lock{host_mem, stream};
+    func(lock.data());
+}
+
+bool constants_cache::has_same_content(const memory_ptr& mem, const char* data, stream& stream) {
+    bool same = false;
+    with_host_data(mem, stream, [&](const char* mem_data) {
+        same = std::memcmp(mem_data, data, mem->size()) == 0;
+    });
+    return same;
+}
+
+memory_ptr constants_cache::find(const memory_ptr& content, allocation_type type, stream& stream, size_t& hash) {
+    memory_ptr found = nullptr;
+    with_host_data(content, stream, [&](const char* data) {
+        hash = hash_bytes(data, content->size());
+
+        std::vector<memory_ptr> candidates;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto range = _entries.equal_range(hash);
+            for (auto it = range.first; it != range.second;) {
+                auto mem = it->second._memory.lock();
+                if (!mem) {
+                    it = _entries.erase(it);
+                    continue;
+                }
+                if (it->second._type == type && it->second._layout == content->get_layout())
+                    candidates.push_back(mem);
+                ++it;
+            }
+        }
+
+        for (auto& mem : candidates) {
+            if (has_same_content(mem, data, stream)) {
+                found = mem;
+                break;
+            }
+        }
+    });
+
+    if (found) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _reused_bytes += found->size();
+    }
+    return found;
+}
+
+void constants_cache::add(const memory_ptr& mem, size_t hash) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    // The entries of the released buffers are dropped when the number of entries doubles
+    if (_entries.size() >= _prune_size) {
+        for (auto it = _entries.begin(); it != _entries.end();) {
+            if (it->second._memory.expired())
+                it = _entries.erase(it);
+            else
+                ++it;
+        }
+        _prune_size = std::max<size_t>(64, 2 * _entries.size());
+    }
+    _entries.emplace(hash, entry{mem->get_layout(), mem->get_allocation_type(), mem});
+}
+
+uint64_t constants_cache::get_reused_bytes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _reused_bytes;
+}
+
+}  // namespace cldnn
@@ -21,7 +21,12 @@ namespace cldnn {
 
 engine::engine(const device::ptr device, const engine_configuration& configuration)
 : _device(device)
-, _configuration(configuration) {}
+, _configuration(configuration) {
+    if (_configuration.use_size_class_memory_pool)
+        _size_class_pool = std::make_shared<size_class_pool>(*this);
+    if (_configuration.share_constants)
+        _constants_cache.reset(new constants_cache(*this));
+}
 
 device_info engine::get_device_info() const {
     return _device->get_info();
@@ -159,6 +164,13 @@ void engine::get_memory_statistics(std::map<std::string, uint64_t>* statistics)
         oss << m.first << "_peak";
         (*statistics)[oss.str()] = m.second.load();
     }
+    if (_size_class_pool) {
+        (*statistics)["size_class_pool_reserved"] = _size_class_pool->get_reserved_bytes();
+        (*statistics)["size_class_pool_used"] = _size_class_pool->get_used_bytes();
+    }
+    if (_constants_cache) {
+        (*statistics)["constants_cache_reused"] = _constants_cache->get_reused_bytes();
+    }
 }
 
 void engine::add_memory_used(size_t bytes, allocation_type type) {
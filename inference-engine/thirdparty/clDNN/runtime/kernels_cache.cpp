@@ -6,15 +6,21 @@
 #include "kernels_cache.hpp"
 #include "ocl/ocl_engine.hpp"
 #include "cldnn/runtime/debug_configuration.hpp"
+#include "openvino/util/file_util.hpp"
 
 #include <algorithm>
 #include <cassert>
+#include <cstdio>
+#include <ctime>
 #include <sstream>
 #include <fstream>
 #include <set>
 #include <string>
 #include <memory>
+#include <thread>
 #include <utility>
+#include <sys/types.h>
+#include <sys/stat.h>
 
 #include "cldnn_itt.hpp"
 #if (CLDNN_THREADING == CLDNN_THREADING_TBB)
@@ -45,8 +51,12 @@
 #include <locale>
 #include <codecvt>
 #endif
+#include <unistd.h>
+#include <utime.h>
 #else
 #include <Windows.h>
+#include <process.h>
+#include <sys/utime.h>
 #endif
 
 #if (CLDNN_THREADING != CLDNN_THREADING_SEQ)
@@ -99,18 +109,86 @@ static std::vector<unsigned char> loadBinaryFromFile(std::string path) {
 
     return {};
 }
+static bool getFileStat(const std::string& path, size_t& size, time_t& mtime) {
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    struct _stat64 st;
+    if (_wstat64(multiByteCharToWString(path.c_str()).c_str(), &st) != 0)
+        return false;
+#elif defined(_WIN32)
+    struct _stat64 st;
+    if (_stat64(path.c_str(), &st) != 0)
+        return false;
+#else
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0)
+        return false;
+#endif
+    size = static_cast<size_t>(st.st_size);
+    mtime = st.st_mtime;
+    return true;
+}
+
+static bool fileExists(const std::string& path) {
+    size_t size = 0;
+    time_t mtime = 0;
+    return getFileStat(path, size, mtime) && size > 0;
+}
+
+static void removeFile(const std::string& path) {
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    _wremove(multiByteCharToWString(path.c_str()).c_str());
+#else
+    std::remove(path.c_str());
+#endif
+}
+
+// Updates modification time of the file which is used as a last access time for LRU eviction
+static void touchFile(const std::string& path) {
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    _wutime(multiByteCharToWString(path.c_str()).c_str(), nullptr);
+#elif defined(_WIN32)
+    _utime(path.c_str(), nullptr);
+#else
+    utime(path.c_str(), nullptr);
+#endif
+}
+
+// Cache directory may be shared by several threads and processes, so the file is written under a temporary
+// name which is unique for the writer and then renamed, thus readers never observe partially written files
 static void saveBinaryToFile(std::string path, const std::vector<unsigned char> buffer) {
     std::lock_guard<std::mutex> lock(cacheAccessMutex);
+#ifdef _WIN32
+    auto pid = _getpid();
+#else
+    auto pid = getpid();
+#endif
+    std::string tmp_path = path + "." + std::to_string(pid) + "_" +
+                           std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-    std::wstring widefilename = multiByteCharToWString(path.c_str());
+    std::wstring widefilename = multiByteCharToWString(tmp_path.c_str());
     const wchar_t* filename = widefilename.c_str();
 #else
-    const char* filename = path.c_str();
+    const char* filename = tmp_path.c_str();
 #endif
-    std::ofstream out_file(filename, std::ios::out | std::ios::binary);
-    if (out_file.is_open()) {
+    {
+        std::ofstream out_file(filename, std::ios::out | std::ios::binary);
+        if (!out_file.is_open())
+            return;
         out_file.write(reinterpret_cast<const char*>(&buffer[0]), buffer.size());
+        if (!out_file.good()) {
+            out_file.close();
+            removeFile(tmp_path);
+            return;
+        }
     }
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    bool renamed = _wrename(filename, multiByteCharToWString(path.c_str()).c_str()) == 0;
+#else
+    bool renamed = std::rename(filename, path.c_str()) == 0;
+#endif
+    // Rename fails on Windows if the target exists, it means that the same entry has been stored by another writer
+    if (!renamed)
+        removeFile(tmp_path);
 }
 
 std::string reorder_options(const std::string& org_options) {
@@ -162,10 +240,84 @@ size_t kernels_cache::get_max_kernels_per_batch() const {
     return 10;
 }
 
+// Each compiled kernel has an index entry ${kernel_hash}.cl_kernel in the cache directory which stores the name of
+// the ${batch_hash}.cl_cache binary containing this kernel. Thus a kernel can be reused from the cache even if the other
+// kernels of its original batch have changed, or it has been compiled for another model.
+std::string kernels_cache::find_cached_binary(size_t kernel_hash) const {
+    std::string index_name = get_cache_path() + std::to_string(kernel_hash) + ".cl_kernel";
+    auto index = loadBinaryFromFile(index_name);
+    if (index.empty())
+        return {};
+
+    std::string bin_name(index.begin(), index.end());
+    if (!fileExists(get_cache_path() + bin_name)) {
+        // Binary has been evicted, so the entry is stale
+        std::lock_guard<std::mutex> lock(cacheAccessMutex);
+        removeFile(index_name);
+        return {};
+    }
+    return bin_name;
+}
+
+// Removes least recently used binaries when the total size of the cache exceeds the limit.
+// Index entries pointing to removed binaries are dropped lazily on lookup.
+void kernels_cache::evict_cache_entries() const {
+    OV_ITT_SCOPED_TASK(itt::domains::CLDNN, "KernelsCache::EvictCacheEntries");
+    const size_t max_size = _engine.configuration().kernels_cache_max_size;
+    if (max_size == 0)
+        return;
+
+    struct cache_entry {
+        std::string path;
+        size_t size;
+        time_t mtime;
+    };
+    std::vector<cache_entry> entries;
+    size_t total_size = 0;
+
+    std::lock_guard<std::mutex> lock(cacheAccessMutex);
+    try {
+        ov::util::iterate_files(_engine.configuration().kernels_cache_path, [&](const std::string& file, bool is_dir) {
+            if (is_dir || ov::util::get_file_ext(file) != ".cl_cache")
+                return;
+            cache_entry entry = { file, 0, 0 };
+            if (getFileStat(file, entry.size, entry.mtime)) {
+                total_size += entry.size;
+                entries.push_back(entry);
+            }
+        });
+    } catch (const std::exception&) {
+        // Cache directory can't be listed, nothing to evict
+        return;
+    }
+
+    if (total_size <= max_size)
+        return;
+
+    std::sort(entries.begin(), entries.end(), [](const cache_entry& lhs, const cache_entry& rhs) {
+        return lhs.mtime < rhs.mtime;
+    });
+    for (const auto& entry : entries) {
+        if (total_size <= max_size)
+            break;
+        removeFile(entry.path);
+        total_size -= entry.size;
+    }
+}
+
 
 void kernels_cache::get_program_source(const kernels_code& kernels_source_code, std::vector<kernels_cache::batch_program>* all_batches) const {
     OV_ITT_SCOPED_TASK(itt::domains::CLDNN, "KernelsCache::BuildAll::GetProgramSource");
     std::map<std::string, std::vector<batch_program>> program_buckets;
+    // Batches of kernels which are found in the cache, grouped by the cached binary
+    std::map<std::string, batch_program> cached_batches;
+
+    std::string kernel_hash_prefix;
+    if (is_cache_enabled()) {
+        kernel_hash_prefix = _engine.get_device_info().driver_version;
+        for (auto& h : batch_header_str)
+            kernel_hash_prefix += h;
+    }
 
     for (const auto& code : kernels_source_code) {
         std::string full_code = code.kernel_strings->jit + code.kernel_strings->str + code.kernel_strings->undefs;
@@ -181,6 +333,27 @@ void kernels_cache::get_program_source(const kernels_code& kernels_source_code,
             options = reorder_options(options);
         }
 
+        size_t kernel_hash = 0;
+        if (is_cache_enabled()) {
+            kernel_hash = std::hash<std::string>()(options + " " + kernel_hash_prefix + full_code);
+            auto cached_binary = find_cached_binary(kernel_hash);
+            if (!cached_binary.empty()) {
+                auto cached_batch = cached_batches.find(cached_binary);
+                if (cached_batch == cached_batches.end()) {
+                    const auto& bucket_id = static_cast<int32_t>(cached_batches.size());
+                    cached_batch = cached_batches.emplace(cached_binary, batch_program(bucket_id, 0, options, batch_header_str)).first;
+                    cached_batch->second.cached_binary = cached_binary;
+                }
+                // Sources are kept to recompile the batch if the binary is evicted before it's loaded
+                auto& b = cached_batch->second;
+                b.entry_point_to_id[entry_point] = code.id;
+                b.source.push_back(std::move(org_source_code.front()));
+                b.kernels_hashes.push_back(kernel_hash);
+                b.kernels_counter++;
+                continue;
+            }
+        }
+
         std::string key = options;
 
         if (batch_compilation == false) {
@@ -212,9 +385,20 @@ void kernels_cache::get_program_source(const kernels_code& kernels_source_code,
         assert(org_source_code.size() == 1);
 
         current_batch.source.push_back(std::move(org_source_code.front()));
+        current_batch.kernels_hashes.push_back(kernel_hash);
         current_batch.kernels_counter++;
     }
 
+    for (auto& c : cached_batches) {
+        auto& b = c.second;
+        b.bucket_id += static_cast<int32_t>(program_buckets.size());
+        std::string full_code = b.options + " " + _engine.get_device_info().driver_version;
+        for (auto& ss : b.source)
+            full_code += ss;
+        b.hash_value = std::hash<std::string>()(full_code);
+        all_batches->push_back(b);
+    }
+
     // Compute hash value for each batch
     // Hash calculation might require additional optimizations, but currently execution time of this part is much smaller than loading
     // of the precompiled binaries or get_undef_jit calls
@@ -302,15 +486,21 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
         }
     }
 
-    std::string cached_bin_name = get_cache_path() + std::to_string(batch.hash_value) + ".cl_cache";
+    std::string batch_bin_name = std::to_string(batch.hash_value) + ".cl_cache";
     cl::Program::Binaries precompiled_kernels = {};
 
     if (is_cache_enabled()) {
-        // Try to load file with name ${hash_value}.cl_cache which contains precompiled kernels for current bucket
-        // If read is successful, then remove kernels from compilation bucket
-        auto bin = loadBinaryFromFile(cached_bin_name);
-        if (!bin.empty()) {
-            precompiled_kernels.push_back(bin);
+        // Try to load the binary found via kernels index, or file with name ${hash_value}.cl_cache which contains
+        // precompiled kernels for current bucket. If read is successful, then remove kernels from compilation bucket
+        for (const auto& name : { batch.cached_binary, batch_bin_name }) {
+            if (name.empty())
+                continue;
+            auto bin = loadBinaryFromFile(get_cache_path() + name);
+            if (!bin.empty()) {
+                precompiled_kernels.push_back(bin);
+                touchFile(get_cache_path() + name);
+                break;
+            }
         }
     }
     try {
@@ -333,21 +523,26 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
             }
 
             program.createKernels(&kernels);
+            _binaries_size += program.getInfo<CL_PROGRAM_BINARY_SIZES>().front();
 
             if (is_cache_enabled()) {
                 // If kernels caching is enabled, then we save compiled bucket to binary file with name ${code_hash_value}.cl_cache
-                // Note: Bin file contains full bucket, not separate kernels, so kernels reuse across different models is quite limited
-                // Bucket size can be changed in get_max_kernels_per_batch() method, but forcing it to 1 will lead to much longer
-                // compile time.
-                saveBinaryToFile(cached_bin_name, getProgramBinaries(program));
+                // and an index entry ${kernel_hash}.cl_kernel for each kernel of the bucket, so kernels can be found in the cache
+                // separately from the rest of the bucket. Index entry is written after the binary, so it never refers to a missing file.
+                saveBinaryToFile(get_cache_path() + batch_bin_name, getProgramBinaries(program));
+                const std::vector<unsigned char> index_entry(batch_bin_name.begin(), batch_bin_name.end());
+                for (auto kernel_hash : batch.kernels_hashes)
+                    saveBinaryToFile(get_cache_path() + std::to_string(kernel_hash) + ".cl_kernel", index_entry);
             }
         } else {
             cl::Program program(cl_build_engine.get_cl_context(), {cl_build_engine.get_cl_device()}, precompiled_kernels);
             program.build(cl_build_engine.get_cl_device(), batch.options.c_str());
             program.createKernels(&kernels);
+            _binaries_size += precompiled_kernels.front().size();
         }
         {
             std::lock_guard<std::mutex> lock(_mutex);
+            size_t found_kernels = 0;
             for (auto& k : kernels) {
                 const auto& entry_point = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
                 const auto& k_id = batch.entry_point_to_id.find(entry_point);
@@ -357,10 +552,14 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
                     kernel::ptr kernel = kernels_factory::create(_engine, context, kern, entry_point);
                     const auto& kmap = std::make_pair(k_id->second, kernel);
                     _kernels.insert(kmap);
-                } else {
+                    found_kernels++;
+                } else if (precompiled_kernels.empty()) {
+                    // Unknown kernels are skipped for cached binaries only, as they may contain kernels of other models
                     throw std::runtime_error("Could not find entry point");
                 }
             }
+            if (found_kernels != batch.entry_point_to_id.size())
+                throw std::runtime_error("Could not find entry point");
         }
     } catch (const cl::BuildError& err) {
         if (dump_sources && dump_file.good())
@@ -439,6 +638,9 @@ void kernels_cache::build_all() {
     }
 #endif
 
+    if (is_cache_enabled())
+        evict_cache_entries();
+
     {
         std::lock_guard<std::mutex> lock(_mutex);
         _kernels_code.clear();
@@ -464,6 +666,7 @@ void kernels_cache::build_all() {
 
 void kernels_cache::reset() {
     _kernels.clear();
+    _binaries_size = 0;
     _kernels_code.clear();
     _pending_compilation = false;
 }
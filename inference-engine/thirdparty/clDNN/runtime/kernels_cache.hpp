@@ -101,6 +101,8 @@ public:
         std::string options;
         bool dump_custom_program;
         std::map<std::string, std::string> entry_point_to_id;
+        std::vector<size_t> kernels_hashes;     // per-kernel hashes used as keys of cache index entries
+        std::string cached_binary;              // name of cached binary containing all kernels of the batch (if found via index)
 
         explicit batch_program(int32_t _bucket_id, int32_t _batch_id, std::string _options, const std::vector<std::string>& batch_header_str)
             : bucket_id(_bucket_id),
@@ -110,7 +112,9 @@ public:
               source(std::move(batch_header_str)),
               options(_options),
               dump_custom_program(false),
-              entry_point_to_id({}) {
+              entry_point_to_id({}),
+              kernels_hashes({}),
+              cached_binary("") {
         }
     };
 
@@ -147,6 +151,7 @@ private:
     kernels_code _kernels_code;
     std::atomic<bool> _pending_compilation{false};
     std::map<const std::string, kernel::ptr> _kernels;
+    std::atomic<uint64_t> _binaries_size{0};
 #if (CLDNN_THREADING == CLDNN_THREADING_TBB)
     std::unique_ptr<tbb::task_arena> arena;
 #elif(CLDNN_THREADING == CLDNN_THREADING_THREADPOOL)
@@ -159,6 +164,8 @@ private:
 
     std::string get_cache_path() const;
     bool is_cache_enabled() const;
+    std::string find_cached_binary(size_t kernel_hash) const;
+    void evict_cache_entries() const;
     size_t get_max_kernels_per_batch() const;
 
 public:
@@ -171,6 +178,8 @@ public:
     }
     // forces compilation of all pending kernels/programs
     void build_all();
+    // total size of the binaries of the built programs
+    uint64_t get_binaries_size() const { return _binaries_size; }
     void reset();
 };
 
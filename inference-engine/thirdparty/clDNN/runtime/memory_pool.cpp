@@ -12,12 +12,100 @@
 #include "cldnn/runtime/debug_configuration.hpp"
 
 #include <list>
+#include <limits>
 #include <string>
 #include <utility>
 #include <set>
 #include <stdexcept>
 
 namespace cldnn {
+size_class_pool::size_class_pool(engine& engine) : _engine(engine), _reserved_bytes(0), _used_bytes(0) { }
+
+size_t size_class_pool::get_size_class(size_t bytes) {
+    // Allocations are done with at least page granularity by the driver anyway
+    const size_t min_class_size = 4096;
+    if (bytes <= min_class_size)
+        return min_class_size;
+
+    size_t pow2 = min_class_size;
+    while (pow2 < bytes)
+        pow2 <<= 1;
+    // 4 classes between pow2 / 2 and pow2
+    const size_t step = pow2 / 8;
+    return (bytes + step - 1) / step * step;
+}
+
+memory_ptr size_class_pool::get_memory(const layout& layout, allocation_type type) {
+    const size_t requested_bytes = layout.bytes_count();
+    size_t class_size = get_size_class(requested_bytes);
+    if (class_size > _engine.get_device_info().max_alloc_mem_size)
+        class_size = requested_bytes;
+    if (class_size > static_cast<size_t>(std::numeric_limits<tensor::value_type>::max()))
+        return _engine.allocate_memory(layout, type);
+
+    memory_ptr block = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _free_blocks.find({type, class_size});
+        if (it != _free_blocks.end() && !it->second.empty()) {
+            block = it->second.back();
+            it->second.pop_back();
+        }
+    }
+
+    if (!block) {
+        cldnn::layout block_layout(data_types::u8, format::bfyx, tensor(1, 1, static_cast<tensor::value_type>(class_size), 1));
+        try {
+            block = _engine.allocate_memory(block_layout, type, false);
+        } catch (const std::runtime_error&) {
+            // Device memory may be held by free blocks of other size classes, so release them and try again
+            trim();
+            block = _engine.allocate_memory(block_layout, type, false);
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        _reserved_bytes += class_size;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _used_bytes += requested_bytes;
+    }
+
+    auto mem = _engine.reinterpret_buffer(*block, layout);
+    // The same as for the new allocation, as the block may contain data of another network
+    mem->fill(_engine.get_program_stream());
+
+    std::weak_ptr<size_class_pool> weak_pool = shared_from_this();
+    return memory_ptr(mem.get(), [mem, block, requested_bytes, weak_pool](memory*) mutable {
+        mem.reset();
+        if (auto pool = weak_pool.lock())
+            pool->release_block(block, requested_bytes);
+    });
+}
+
+void size_class_pool::release_block(const memory_ptr& block, size_t requested_bytes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _used_bytes -= requested_bytes;
+    _free_blocks[{block->get_allocation_type(), block->size()}].push_back(block);
+}
+
+void size_class_pool::trim() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& free_list : _free_blocks) {
+        _reserved_bytes -= free_list.first.second * free_list.second.size();
+    }
+    _free_blocks.clear();
+}
+
+uint64_t size_class_pool::get_reserved_bytes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _reserved_bytes;
+}
+
+uint64_t size_class_pool::get_used_bytes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _used_bytes;
+}
+
 memory_record::memory_record(memory_set users,
                              std::shared_ptr<memory>& memory,
                              uint32_t net_id,
@@ -33,20 +121,20 @@ memory_pool::~memory_pool() {}
 bool memory_pool::has_conflict(const memory_set& a,
                                const std::set<primitive_id>& b,
                                uint32_t b_network_id) {
-    std::set<primitive_id> a_same_network;
-    for (auto const& mem_usr : a) {
-        if (mem_usr._network_id == b_network_id) {
-            a_same_network.insert(mem_usr._id);
+    // the users are ordered by the network first, so the users of the network are a sorted range of ids
+    // which is merged with the sorted restrictions without building the intersection
+    auto a_it = a.lower_bound(memory_user(primitive_id(), b_network_id));
+    auto b_it = b.begin();
+    while (a_it != a.end() && a_it->_network_id == b_network_id && b_it != b.end()) {
+        if (a_it->_id < *b_it) {
+            ++a_it;
+        } else if (*b_it < a_it->_id) {
+            ++b_it;
+        } else {
+            return true;
         }
     }
-    std::vector<primitive_id> intersection;
-    intersection.reserve(std::min(a_same_network.size(), b.size()));
-    set_intersection(a_same_network.begin(),
-                     a_same_network.end(),
-                     b.begin(),
-                     b.end(),
-                     std::back_inserter(intersection));
-    return !intersection.empty();
+    return false;
 }
 
 void memory_pool::release_memory(memory* mem, const primitive_id& id, uint32_t network_id) {
@@ -142,7 +230,8 @@ memory::ptr memory_pool::get_from_non_padded_pool(const layout& layout,
         GPU_DEBUG_COUT << "[" << id << ": output]" << std::endl;
     }
     // didn't find anything for you? create new resource
-    auto mem = alloc_memory(layout, type);
+    auto size_classes = _engine->get_size_class_pool();
+    auto mem = size_classes ? size_classes->get_memory(layout, type) : alloc_memory(layout, type);
     {
         _non_padded_pool.emplace(layout.bytes_count(),
                                  memory_record({{id, network_id}}, mem, network_id, type));
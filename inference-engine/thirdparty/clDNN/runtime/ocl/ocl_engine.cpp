@@ -52,12 +52,23 @@ ocl_engine::ocl_engine(const device::ptr dev, runtime_types runtime_type, const
 
     _usm_helper.reset(new cl::UsmHelper(get_cl_context(), get_cl_device(), use_unified_shared_memory()));
 
+    if (extension_supported("cl_khr_command_buffer")) {
+        _command_buffer_helper.reset(new cl::CommandBufferHelper(get_cl_context()));
+        if (!_command_buffer_helper->is_supported())
+            _command_buffer_helper.reset();
+    }
+
 #ifdef ENABLE_ONEDNN_FOR_GPU
     _onednn_engine = std::make_shared<dnnl::engine>(dnnl::ocl_interop::make_engine(casted->get_device().get(), casted->get_context().get()));
 #endif
     _program_stream.reset(new ocl_stream(*this));
 }
 
+ocl_engine::~ocl_engine() {
+    // Free blocks of the pool must be released while USM helper and program stream are still alive
+    _size_class_pool.reset();
+}
+
 #ifdef ENABLE_ONEDNN_FOR_GPU
 dnnl::engine& ocl_engine::get_onednn_engine() const {
     if (!_onednn_engine)
@@ -84,6 +95,10 @@ const cl::UsmHelper& ocl_engine::get_usm_helper() const {
     return *_usm_helper;
 }
 
+const cl::CommandBufferHelper* ocl_engine::get_command_buffer_helper() const {
+    return _command_buffer_helper.get();
+}
+
 memory::ptr ocl_engine::allocate_memory(const layout& layout, allocation_type type, bool reset) {
     if (layout.bytes_count() > get_device_info().max_alloc_mem_size) {
         throw std::runtime_error("exceeded max size of memory object allocation");
@@ -213,6 +228,10 @@ stream::ptr ocl_engine::create_stream() const {
     return std::make_shared<ocl_stream>(*this);
 }
 
+stream::ptr ocl_engine::create_stream(priority_mode_types priority, throttle_mode_types throttle) const {
+    return std::make_shared<ocl_stream>(*this, priority, throttle);
+}
+
 stream& ocl_engine::get_program_stream() const {
     return *_program_stream;
 }
@@ -21,6 +21,7 @@ namespace ocl {
 class ocl_engine : public engine {
 public:
     ocl_engine(const device::ptr dev, runtime_types runtime_type, const engine_configuration& conf);
+    ~ocl_engine() override;
     engine_types type() const override { return engine_types::ocl; };
     runtime_types runtime_type() const override { return runtime_types::ocl; };
 
@@ -36,10 +37,13 @@ public:
     const cl::Context& get_cl_context() const;
     const cl::Device& get_cl_device() const;
     const cl::UsmHelper& get_usm_helper() const;
+    /// Returns nullptr if the device doesn't support cl_khr_command_buffer
+    const cl::CommandBufferHelper* get_command_buffer_helper() const;
 
     bool extension_supported(std::string extension) const;
 
     stream_ptr create_stream() const override;
+    stream_ptr create_stream(priority_mode_types priority, throttle_mode_types throttle) const override;
     stream& get_program_stream() const override;
 
 #ifdef ENABLE_ONEDNN_FOR_GPU
@@ -53,6 +57,7 @@ private:
     std::string _extensions;
     std::unique_ptr<stream> _program_stream;
     std::unique_ptr<cl::UsmHelper> _usm_helper;
+    std::unique_ptr<cl::CommandBufferHelper> _command_buffer_helper;
 
 #ifdef ENABLE_ONEDNN_FOR_GPU
     std::shared_ptr<dnnl::engine> _onednn_engine;
@@ -38,6 +38,15 @@ typedef cl_bitfield         cl_device_feature_capabilities_intel;
 #define CL_DEVICE_FEATURE_FLAG_DP4A_INTEL         (1 << 0)
 #define CL_DEVICE_FEATURE_FLAG_DPAS_INTEL         (1 << 1)
 
+// cl_khr_command_buffer
+#ifndef cl_khr_command_buffer
+typedef struct _cl_command_buffer_khr* cl_command_buffer_khr;
+typedef struct _cl_mutable_command_khr* cl_mutable_command_khr;
+typedef cl_uint     cl_sync_point_khr;
+typedef cl_bitfield cl_command_buffer_properties_khr;
+typedef cl_bitfield cl_ndrange_kernel_command_properties_khr;
+#endif
+
 #define CL_HPP_PARAM_NAME_CL_INTEL_COMMAND_QUEUE_FAMILIES_(F) \
     F(cl_device_info, CL_DEVICE_QUEUE_FAMILY_PROPERTIES_INTEL, cl::vector<cl_queue_family_properties_intel>) \
     \
@@ -716,6 +725,84 @@ private:
     const UsmHelper& _usmHelper;
 };
 
+/*
+    Wrapper for cl_khr_command_buffer entry points.
+    Kernels recorded into a command buffer keep the arguments which were set at the moment of recording,
+    so the whole buffer can be submitted many times with a single enqueue call.
+*/
+class CommandBufferHelper {
+public:
+    using create_fn = cl_command_buffer_khr (CL_API_CALL *)(cl_uint num_queues, const cl_command_queue* queues,
+                                                            const cl_command_buffer_properties_khr* properties, cl_int* errcode_ret);
+    using finalize_fn = cl_int (CL_API_CALL *)(cl_command_buffer_khr command_buffer);
+    using release_fn = cl_int (CL_API_CALL *)(cl_command_buffer_khr command_buffer);
+    using enqueue_fn = cl_int (CL_API_CALL *)(cl_uint num_queues, cl_command_queue* queues, cl_command_buffer_khr command_buffer,
+                                              cl_uint num_events_in_wait_list, const cl_event* event_wait_list, cl_event* event);
+    using ndrange_kernel_fn = cl_int (CL_API_CALL *)(cl_command_buffer_khr command_buffer, cl_command_queue command_queue,
+                                                     const cl_ndrange_kernel_command_properties_khr* properties, cl_kernel kernel,
+                                                     cl_uint work_dim, const size_t* global_work_offset, const size_t* global_work_size,
+                                                     const size_t* local_work_size, cl_uint num_sync_points_in_wait_list,
+                                                     const cl_sync_point_khr* sync_point_wait_list, cl_sync_point_khr* sync_point,
+                                                     cl_mutable_command_khr* mutable_handle);
+
+    explicit CommandBufferHelper(const cl::Context& ctx) {
+        _create_fn         = try_load_entrypoint<create_fn>(ctx.get(), "clCreateCommandBufferKHR");
+        _finalize_fn       = try_load_entrypoint<finalize_fn>(ctx.get(), "clFinalizeCommandBufferKHR");
+        _release_fn        = try_load_entrypoint<release_fn>(ctx.get(), "clReleaseCommandBufferKHR");
+        _enqueue_fn        = try_load_entrypoint<enqueue_fn>(ctx.get(), "clEnqueueCommandBufferKHR");
+        _ndrange_kernel_fn = try_load_entrypoint<ndrange_kernel_fn>(ctx.get(), "clCommandNDRangeKernelKHR");
+    }
+
+    bool is_supported() const {
+        return _create_fn && _finalize_fn && _release_fn && _enqueue_fn && _ndrange_kernel_fn;
+    }
+
+    cl_command_buffer_khr create(const cl::CommandQueue& queue) const {
+        cl_command_queue q = queue.get();
+        cl_int err = CL_SUCCESS;
+        auto command_buffer = _create_fn(1, &q, nullptr, &err);
+        detail::errHandler(err, "[CL_EXT] clCreateCommandBufferKHR failed");
+        return command_buffer;
+    }
+
+    void record_kernel(cl_command_buffer_khr command_buffer, const cl::Kernel& kernel, const cl::NDRange& global,
+                       const cl::NDRange& local, const cl_sync_point_khr* wait_sync_point, cl_sync_point_khr* sync_point) const {
+        cl_int err = _ndrange_kernel_fn(command_buffer, nullptr, nullptr, kernel.get(), static_cast<cl_uint>(global.dimensions()),
+                                        nullptr, static_cast<const size_t*>(global),
+                                        local.dimensions() != 0 ? static_cast<const size_t*>(local) : nullptr,
+                                        wait_sync_point ? 1 : 0, wait_sync_point, sync_point, nullptr);
+        detail::errHandler(err, "[CL_EXT] clCommandNDRangeKernelKHR failed");
+    }
+
+    void finalize(cl_command_buffer_khr command_buffer) const {
+        detail::errHandler(_finalize_fn(command_buffer), "[CL_EXT] clFinalizeCommandBufferKHR failed");
+    }
+
+    void release(cl_command_buffer_khr command_buffer) const {
+        _release_fn(command_buffer);
+    }
+
+    void enqueue(const cl::CommandQueue& queue, cl_command_buffer_khr command_buffer,
+                 const std::vector<cl::Event>* wait_list, cl::Event* ret_event) const {
+        cl_command_queue q = queue.get();
+        cl_event tmp;
+        cl_int err = _enqueue_fn(1, &q, command_buffer,
+                                 (wait_list == nullptr || wait_list->empty()) ? 0 : static_cast<cl_uint>(wait_list->size()),
+                                 (wait_list == nullptr || wait_list->empty()) ? nullptr : reinterpret_cast<const cl_event*>(&wait_list->front()),
+                                 ret_event == nullptr ? nullptr : &tmp);
+        detail::errHandler(err, "[CL_EXT] clEnqueueCommandBufferKHR failed");
+        if (ret_event != nullptr && err == CL_SUCCESS)
+            *ret_event = tmp;
+    }
+
+private:
+    create_fn _create_fn = nullptr;
+    finalize_fn _finalize_fn = nullptr;
+    release_fn _release_fn = nullptr;
+    enqueue_fn _enqueue_fn = nullptr;
+    ndrange_kernel_fn _ndrange_kernel_fn = nullptr;
+};
+
 inline bool operator==(const UsmMemory &lhs, const UsmMemory &rhs) {
     return lhs.get() == rhs.get();
 }
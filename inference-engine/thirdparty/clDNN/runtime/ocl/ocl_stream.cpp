@@ -255,7 +255,11 @@ void set_arguments_impl(ocl_kernel_type& kernel,
 }
 }  // namespace
 
-ocl_stream::ocl_stream(const ocl_engine& engine) : stream(engine.configuration().queue_type), _engine(engine) {
+ocl_stream::ocl_stream(const ocl_engine& engine)
+    : ocl_stream(engine, engine.configuration().priority_mode, engine.configuration().throttle_mode) {}
+
+ocl_stream::ocl_stream(const ocl_engine& engine, priority_mode_types priority, throttle_mode_types throttle)
+    : stream(engine.configuration().queue_type), _engine(engine) {
     auto context = engine.get_cl_context();
     auto device = engine.get_cl_device();
     auto config = engine.configuration();
@@ -263,7 +267,7 @@ ocl_stream::ocl_stream(const ocl_engine& engine) : stream(engine.configuration()
     queue_builder.set_profiling(config.enable_profiling);
     queue_builder.set_out_of_order((config.queue_type == queue_types::out_of_order));
 
-    sync_method = _engine.configuration().enable_profiling ? sync_methods::events :
+    sync_method = (_engine.configuration().enable_profiling || config.n_branch_queues > 1) ? sync_methods::events :
                   config.queue_type == queue_types::out_of_order ? sync_methods::barriers : sync_methods::none;
 
     if (sync_method == sync_methods::none && config.queue_type == queue_types::out_of_order) {
@@ -271,15 +275,20 @@ ocl_stream::ocl_stream(const ocl_engine& engine) : stream(engine.configuration()
     }
 
     bool priorty_extensions = engine.extension_supported("cl_khr_priority_hints") && engine.extension_supported("cl_khr_create_command_queue");
-    queue_builder.set_priority_mode(config.priority_mode, priorty_extensions);
+    queue_builder.set_priority_mode(priority, priorty_extensions);
 
     bool throttle_extensions = engine.extension_supported("cl_khr_throttle_hints") && engine.extension_supported("cl_khr_create_command_queue");
-    queue_builder.set_throttle_mode(config.throttle_mode, throttle_extensions);
+    queue_builder.set_throttle_mode(throttle, throttle_extensions);
 
     bool queue_families_extension = engine.get_device_info().supports_queue_families;
     queue_builder.set_supports_queue_families(queue_families_extension);
 
     _command_queue = queue_builder.build(context, device);
+
+    queue_builder.set_out_of_order(false);
+    for (uint16_t i = 1; i < config.n_branch_queues; i++) {
+        _branch_queues.push_back(queue_builder.build(context, device));
+    }
 #ifdef ENABLE_ONEDNN_FOR_GPU
     if (config.queue_type == queue_types::in_order) {
         auto onednn_engine = engine.get_onednn_engine();
@@ -321,6 +330,20 @@ event::ptr ocl_stream::enqueue_kernel(kernel& kernel,
     auto& kern = ocl_kernel.get_handle();
     auto global = toNDRange(args_desc.workGroups.global);
     auto local = toNDRange(args_desc.workGroups.local);
+
+    if (_recording) {
+        cl_sync_point_khr sync_point = 0;
+        try {
+            _engine.get_command_buffer_helper()->record_kernel(_command_buffer.get(), kern, global, local,
+                                                               _has_sync_point ? &_last_sync_point : nullptr, &sync_point);
+        } catch (cl::Error const& err) {
+            throw ocl_error(err);
+        }
+        _last_sync_point = sync_point;
+        _has_sync_point = true;
+        return std::make_shared<ocl_user_event>(_engine.get_cl_context(), true);
+    }
+
     std::vector<cl::Event> dep_events;
     std::vector<cl::Event>* dep_events_ptr = nullptr;
     if (sync_method == sync_methods::events) {
@@ -340,7 +363,7 @@ event::ptr ocl_stream::enqueue_kernel(kernel& kernel,
     bool set_output_event = sync_method == sync_methods::events || is_output;
 
     try {
-        _command_queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, set_output_event ? &ret_ev : nullptr);
+        get_current_queue().enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, set_output_event ? &ret_ev : nullptr);
     } catch (cl::Error const& err) {
         throw ocl_error(err);
     }
@@ -349,11 +372,38 @@ event::ptr ocl_stream::enqueue_kernel(kernel& kernel,
 }
 
 void ocl_stream::enqueue_barrier() {
-    _command_queue.enqueueBarrierWithWaitList(nullptr, nullptr);
+    if (_recording)
+        return;
+    get_current_queue().enqueueBarrierWithWaitList(nullptr, nullptr);
+}
+
+void ocl_stream::enqueue_barrier(std::vector<event::ptr> const& deps) {
+    // with events every command waits for its dependencies explicitly
+    if (_recording || sync_method == sync_methods::events)
+        return;
+
+    std::vector<cl::Event> dep_events;
+    for (auto& dep : deps) {
+        if (auto ocl_base_ev = dynamic_cast<ocl_base_event*>(dep.get()))
+            if (ocl_base_ev->get().get() != nullptr)
+                dep_events.push_back(ocl_base_ev->get());
+    }
+
+    if (dep_events.empty())
+        return;
+
+    try {
+        get_current_queue().enqueueBarrierWithWaitList(&dep_events, nullptr);
+    } catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+
+    _last_barrier = ++_queue_counter;
 }
 
 event::ptr ocl_stream::enqueue_marker(std::vector<event::ptr> const& deps, bool is_output) {
-    if (deps.empty())
+    // recorded commands are serialized already
+    if (deps.empty() || _recording)
         return std::make_shared<ocl_user_event>(_engine.get_cl_context(), true);
 
     if (sync_method == sync_methods::events) {
@@ -369,7 +419,7 @@ event::ptr ocl_stream::enqueue_marker(std::vector<event::ptr> const& deps, bool
             if (dep_events.empty()) {
                 return create_user_event(true);
             }
-            _command_queue.enqueueMarkerWithWaitList(&dep_events, &ret_ev);
+            get_current_queue().enqueueMarkerWithWaitList(&dep_events, &ret_ev);
         } catch (cl::Error const& err) {
             throw ocl_error(err);
         }
@@ -396,8 +446,93 @@ event::ptr ocl_stream::create_base_event() {
     return std::make_shared<ocl_event>(ret_ev, ++_queue_counter);
 }
 
-void ocl_stream::flush() const { get_cl_queue().flush(); }
-void ocl_stream::finish() const { get_cl_queue().finish(); }
+bool ocl_stream::supports_recording() const {
+    return _engine.get_command_buffer_helper() != nullptr;
+}
+
+void ocl_stream::begin_recording() {
+    if (!supports_recording())
+        throw std::runtime_error("[CLDNN] cl_khr_command_buffer is not supported by the device");
+
+    auto helper = _engine.get_command_buffer_helper();
+    try {
+        _command_buffer = command_buffer_ptr(helper->create(_command_queue),
+                                             [helper](cl_command_buffer_khr command_buffer) { helper->release(command_buffer); });
+    } catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+    _recording = true;
+    _has_sync_point = false;
+}
+
+uint64_t ocl_stream::end_recording() {
+    _recording = false;
+    if (!_command_buffer)
+        return 0;
+
+    try {
+        _engine.get_command_buffer_helper()->finalize(_command_buffer.get());
+    } catch (cl::Error const& err) {
+        _command_buffer.reset();
+        throw ocl_error(err);
+    }
+    return ++_recording_id;
+}
+
+event::ptr ocl_stream::replay(std::vector<event::ptr> const& deps) {
+    if (!_command_buffer || _recording)
+        throw std::runtime_error("[CLDNN] No finalized command buffer to replay");
+
+    std::vector<cl::Event> dep_events;
+    for (auto& dep : deps) {
+        if (auto ocl_base_ev = dynamic_cast<ocl_base_event*>(dep.get()))
+            if (ocl_base_ev->get().get() != nullptr)
+                dep_events.push_back(ocl_base_ev->get());
+    }
+
+    cl::Event ret_ev;
+    try {
+        _engine.get_command_buffer_helper()->enqueue(_command_queue, _command_buffer.get(), &dep_events, &ret_ev);
+    } catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+
+    return std::make_shared<ocl_event>(ret_ev, ++_queue_counter);
+}
+
+void ocl_stream::sync_queues() {
+    if (_branch_queues.empty() || _recording)
+        return;
+
+    // join: the main queue waits for everything submitted to the branch queues,
+    // fork: the branch queues wait for everything submitted to the main queue including the join barrier
+    try {
+        std::vector<cl::Event> branch_events(_branch_queues.size());
+        for (size_t i = 0; i < _branch_queues.size(); i++) {
+            _branch_queues[i].enqueueMarkerWithWaitList(nullptr, &branch_events[i]);
+        }
+
+        std::vector<cl::Event> join_events(1);
+        _command_queue.enqueueBarrierWithWaitList(&branch_events, &join_events[0]);
+        for (auto& queue : _branch_queues) {
+            queue.enqueueBarrierWithWaitList(&join_events, nullptr);
+        }
+    } catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+}
+
+void ocl_stream::flush() const {
+    get_cl_queue().flush();
+    for (auto& queue : _branch_queues)
+        queue.flush();
+}
+
+void ocl_stream::finish() const {
+    for (auto& queue : _branch_queues)
+        queue.finish();
+    get_cl_queue().finish();
+}
 
 void ocl_stream::wait_for_events(const std::vector<event::ptr>& events) {
     if (events.empty())
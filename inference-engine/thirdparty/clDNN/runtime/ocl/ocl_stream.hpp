@@ -10,6 +10,7 @@
 #include "ocl_engine.hpp"
 
 #include <memory>
+#include <type_traits>
 #include <chrono>
 #include <thread>
 #include <iostream>
@@ -50,14 +51,19 @@ public:
     const ocl_queue_type& get_cl_queue() const { return _command_queue; }
 
     explicit ocl_stream(const ocl_engine& engine);
+    ocl_stream(const ocl_engine& engine, priority_mode_types priority, throttle_mode_types throttle);
     ocl_stream(ocl_stream&& other)
         : stream(other._engine.configuration().queue_type)
         , _engine(other._engine)
         , _command_queue(other._command_queue)
+        , _branch_queues(std::move(other._branch_queues))
+        , _queue_index(other._queue_index)
         , _queue_counter(other._queue_counter.load())
         , _last_barrier(other._last_barrier.load())
         , _last_barrier_ev(other._last_barrier_ev)
-        , sync_method(other.sync_method) {}
+        , sync_method(other.sync_method)
+        , _command_buffer(std::move(other._command_buffer))
+        , _recording_id(other._recording_id) {}
 
     ~ocl_stream() = default;
 
@@ -74,9 +80,20 @@ public:
     event::ptr group_events(std::vector<event::ptr> const& deps) override;
     void wait_for_events(const std::vector<event::ptr>& events) override;
     void enqueue_barrier() override;
+    void enqueue_barrier(std::vector<event::ptr> const& deps) override;
     event::ptr create_user_event(bool set) override;
     event::ptr create_base_event() override;
 
+    bool supports_recording() const override;
+    void begin_recording() override;
+    uint64_t end_recording() override;
+    uint64_t get_recording_id() const override { return _command_buffer ? _recording_id : 0; }
+    event::ptr replay(std::vector<event::ptr> const& deps) override;
+
+    size_t get_queues_count() const override { return _branch_queues.size() + 1; }
+    void set_queue_index(size_t idx) override { _queue_index = idx % get_queues_count(); }
+    void sync_queues() override;
+
     const cl::UsmHelper& get_usm_helper() const { return _engine.get_usm_helper(); }
 
 #ifdef ENABLE_ONEDNN_FOR_GPU
@@ -85,15 +102,28 @@ public:
 
 private:
     void sync_events(std::vector<event::ptr> const& deps, bool is_output = false);
+    ocl_queue_type& get_current_queue() { return _queue_index == 0 ? _command_queue : _branch_queues[_queue_index - 1]; }
 
     const ocl_engine& _engine;
     ocl_queue_type _command_queue;
+    // in-order queues which get independent branches of the network, commands of different queues are
+    // synchronized by events, so sync_methods::events is used whenever the stream has branch queues
+    std::vector<ocl_queue_type> _branch_queues;
+    size_t _queue_index = 0;
     std::atomic<uint64_t> _queue_counter{0};
     std::atomic<uint64_t> _last_barrier{0};
     cl::Event _last_barrier_ev;
 
     sync_methods sync_method;
 
+    // recorded kernels are executed one by one, each of them waits for the sync point of the previous one
+    using command_buffer_ptr = std::shared_ptr<std::remove_pointer<cl_command_buffer_khr>::type>;
+    command_buffer_ptr _command_buffer = nullptr;
+    bool _recording = false;
+    bool _has_sync_point = false;
+    cl_sync_point_khr _last_sync_point = 0;
+    uint64_t _recording_id = 0;
+
 #ifdef ENABLE_ONEDNN_FOR_GPU
     std::shared_ptr<dnnl::stream> _onednn_stream = nullptr;
 #endif
@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "attention_inst.h"
+#include "primitive_type_base.h"
+#include "cldnn/runtime/error_handler.hpp"
+#include "json_object.h"
+#include <string>
+#include <utility>
+
+namespace cldnn {
+primitive_type_id attention::type_id() {
+    static primitive_type_base<attention> instance;
+    return &instance;
+}
+
+layout attention_inst::calc_output_layout(attention_node const& node) {
+    auto prim = node.get_primitive();
+
+    auto query_layout = node.query().get_output_layout();
+    auto value_layout = node.value().get_output_layout();
+
+    auto output_size = query_layout.size;
+    output_size.spatial[0] = value_layout.size.spatial[0];
+
+    auto output_type = prim->output_data_type ? *prim->output_data_type : query_layout.data_type;
+
+    return layout(output_type, query_layout.format, output_size, prim->output_padding);
+}
+
+std::string attention_inst::to_string(attention_node const& node) {
+    auto desc = node.get_primitive();
+    auto node_info = node.desc_to_json();
+    std::stringstream primitive_description;
+
+    json_composite attention_info;
+    attention_info.add("query", node.query().id());
+    attention_info.add("key", node.key().id());
+    attention_info.add("value", node.value().id());
+    attention_info.add("mask", node.has_mask() ? node.mask().id() : "none");
+    attention_info.add("transpose_key", desc->transpose_key ? "true" : "false");
+    attention_info.add("scale", desc->scale);
+    node_info->add("attention info", attention_info);
+    node_info->dump(primitive_description);
+
+    return primitive_description.str();
+}
+
+attention_inst::typed_primitive_inst(network& network, attention_node const& node) : parent(network, node) {
+    auto query_layout = node.query().get_output_layout();
+    auto key_layout = node.key().get_output_layout();
+    auto value_layout = node.value().get_output_layout();
+
+    auto key_depth = key_layout.size.spatial[0];
+    auto keys_count = key_layout.size.spatial[1];
+    if (!node.get_primitive()->transpose_key) {
+        std::swap(key_depth, keys_count);
+    }
+
+    CLDNN_ERROR_NOT_EQUAL(node.id(),
+                          "Query depth",
+                          query_layout.size.spatial[0],
+                          "Key depth",
+                          key_depth,
+                          "");
+    CLDNN_ERROR_NOT_EQUAL(node.id(),
+                          "Keys number",
+                          keys_count,
+                          "Values number",
+                          value_layout.size.spatial[1],
+                          "");
+}
+}  // namespace cldnn
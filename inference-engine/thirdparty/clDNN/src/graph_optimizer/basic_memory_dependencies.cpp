@@ -21,7 +21,7 @@ using namespace cldnn;
 void basic_memory_dependencies::run(program& p) {
     OV_ITT_SCOPED_TASK(itt::domains::CLDNN, "CLDNN::pass::BasicMemoryDependencies");
     auto itr = p.get_processing_order().begin();
-    std::vector<primitive_id> past_outputs;
+    std::vector<size_t> past_outputs;
     while (itr != p.get_processing_order().end()) {
         auto& node = *itr;
         itr++;
@@ -72,9 +72,11 @@ void basic_memory_dependencies::run(program& p) {
 
         // Note we iterate over processing order, it means if primitve has processing num greater than any of outputs,
         // this output has to land on the primitve restriction list. Otherwise memory reuse can corrupt final results.
-        node->add_memory_dependency(past_outputs);
+        size_t node_idx = memory_deps.get_index(node);
+        for (auto output_idx : past_outputs)
+            memory_deps.add(node_idx, output_idx);
         // if current node is an output add it to the outputs list after restriction.
         if (node->is_output())
-            past_outputs.push_back(node->id());
+            past_outputs.push_back(node_idx);
     }
 }
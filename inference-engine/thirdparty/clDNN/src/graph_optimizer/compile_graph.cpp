@@ -8,11 +8,16 @@
 #include "data_inst.h"
 #include "mutable_data_inst.h"
 #include "program_node.h"
+#include "convolution_inst.h"
 #include "cldnn/runtime/engine.hpp"
+#include "cldnn/runtime/debug_configuration.hpp"
 #include "runtime/cldnn_itt.hpp"
 #include <iostream>
 #include <cmath>
 #include <iomanip>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 #if (CLDNN_THREADING == CLDNN_THREADING_TBB)
 #include <tbb/parallel_for.h>
@@ -21,6 +26,81 @@
 
 using namespace cldnn;
 
+namespace {
+
+// Implementation types selected by measurement, shared by all programs of the process so equal nodes are measured once
+std::mutex measured_impls_mutex;
+std::unordered_map<std::string, impl_types> measured_impls;
+
+bool is_impl_measurement_enabled(const program& p) {
+    auto mode = p.get_options().get<build_option_type::tuning_config>()->config.mode;
+    return mode == tuning_mode::tuning_tune_and_cache || mode == tuning_mode::tuning_retune_and_cache;
+}
+
+// Nodes preferring oneDNN are also measured with the OCL implementation when kernels are tuned, and the faster one is used
+std::unique_ptr<primitive_impl> choose_impl(program& p, program_node& node) {
+    if (node.get_preferred_impl_type() != impl_types::onednn)
+        return node.type()->choose_impl(node);
+
+    // oneDNN convolution converts activations zero points in place, so they can't be used by OCL kernels afterwards
+    if (!is_impl_measurement_enabled(p) ||
+        (node.is_type<convolution>() && node.as<convolution>().activations_zero_points_term()))
+        return node.type()->choose_impl(node);
+
+    node.set_preferred_impl_type(impl_types::ocl);
+    if (!node.type()->does_an_implementation_exist(node)) {
+        node.set_preferred_impl_type(impl_types::onednn);
+        return node.type()->choose_impl(node);
+    }
+
+    auto ocl_impl = node.type()->choose_impl(node);
+    auto params_key = ocl_impl->get_params_key();
+    if (params_key.empty()) {
+        node.set_preferred_impl_type(impl_types::onednn);
+        return node.type()->choose_impl(node);
+    }
+
+    auto key = p.get_engine().get_device_info().dev_name + "_" + params_key;
+    {
+        std::lock_guard<std::mutex> lock(measured_impls_mutex);
+        auto it = measured_impls.find(key);
+        if (it != measured_impls.end()) {
+            if (it->second == impl_types::ocl)
+                return ocl_impl;
+            node.set_preferred_impl_type(impl_types::onednn);
+            return node.type()->choose_impl(node);
+        }
+    }
+
+    auto ocl_time = ocl_impl->measure_execution_time();
+    node.set_preferred_impl_type(impl_types::onednn);
+    auto onednn_impl = node.type()->choose_impl(node);
+    auto onednn_time = onednn_impl->measure_execution_time();
+
+    // Static choice is kept if any of implementations can't be measured
+    if (ocl_time == std::chrono::nanoseconds::max() || onednn_time == std::chrono::nanoseconds::max())
+        return onednn_impl;
+
+    auto selected = ocl_time < onednn_time ? impl_types::ocl : impl_types::onednn;
+    {
+        std::lock_guard<std::mutex> lock(measured_impls_mutex);
+        measured_impls[key] = selected;
+    }
+
+    GPU_DEBUG_GET_INSTANCE(debug_config);
+    GPU_DEBUG_IF(debug_config->verbose >= 1) {
+        GPU_DEBUG_COUT << node.id() << ": ocl " << ocl_time.count() << " ns, onednn " << onednn_time.count() << " ns" << std::endl;
+    }
+
+    if (selected == impl_types::ocl) {
+        node.set_preferred_impl_type(impl_types::ocl);
+        return ocl_impl;
+    }
+    return onednn_impl;
+}
+
+}  // namespace
+
 void compile_graph::run(program& p) {
     OV_ITT_SCOPED_TASK(itt::domains::CLDNN, "CLDNN::pass::CompileGraph");
     size_t order_idx = 0;
@@ -42,7 +122,7 @@ void compile_graph::run(program& p) {
                 auto& node = *(std::next(proc_order.begin(), i));
                 node->set_unique_id(std::to_string(i));
                 if (!node->is_type<data>() && !(node->is_type<mutable_data>() && node->get_dependencies().empty())) {
-                    node->selected_impl = node->type()->choose_impl(*node);
+                    node->selected_impl = choose_impl(p, *node);
                 }
             }
         });
@@ -51,7 +131,7 @@ void compile_graph::run(program& p) {
 #else
     for (auto& node : p.get_processing_order()) {
         if (!node->is_type<data>() && !(node->is_type<mutable_data>() && node->get_dependencies().empty())) {
-            node->selected_impl = node->type()->choose_impl(*node);
+            node->selected_impl = choose_impl(p, *node);
         }
     }
 #endif
@@ -19,112 +19,43 @@
 
 using namespace cldnn;
 
-namespace {
-
-class bits_64 {
-public:
-    explicit bits_64(size_t size, bool set = false) : storage((size / 64) + 1, (set ? ~0ULL : 0ULL)) {}
-    bool is_set(size_t idx) const {
-        size_t storage_idx = idx >> 6;
-        uint64_t mask = 1ULL << (idx & 0x3F);
-        return storage[storage_idx] & mask;
-    }
-    void set(size_t idx) {
-        size_t storage_idx = idx >> 6;
-        uint64_t mask = 1ULL << (idx & 0x3F);
-        storage[storage_idx] |= mask;
-    }
-    bool _or(const bits_64& that) {
-        bool changed = false;
-        size_t sz = std::min(storage.size(), that.storage.size());
-        for (size_t i = 0; i < sz; i++) {
-            uint64_t myval = storage[i];
-            uint64_t thatval = myval | that.storage[i];
-            bool local_change = myval != thatval;
-            changed |= local_change;
-            if (local_change)
-                storage[i] = thatval;
-        }
-        return changed;
-    }
-#if 0
-    void dump(std::ostream& s, size_t cols) {
-        size_t idx = 0;
-        size_t rows = (storage.size() * 64) / cols;
-
-        s << storage.size() << " items" << std::endl;
-        for (size_t i = 0; i < rows; i++) {
-            for (size_t j = 0; j < cols; j++) {
-                s << is_set(idx);
-                idx++;
-            }
-            s << std::endl;
-        }
-    }
-#endif
-
-protected:
-    std::vector<uint64_t> storage;
-};
-
-}  // namespace
-
 void oooq_memory_dependencies::run(program& p) {
     OV_ITT_SCOPED_TASK(itt::domains::CLDNN, "CLDNN::pass::OooqMemoryDependencies");
     // For oooq memory dependencies nodes A and B can't share memory if
     // processing_num(A) < processing_num(B) and there is no path from A to B.
-    // Assuming precalculation of reachability this function has complexity O(N^2 log N).
+    // Assuming precalculation of reachability this function has complexity O(N^2).
 
     // First create transitive closure of the graph,
     // giving us mapping of node to set of all users that can be reached from this node.
     auto& processing_order = p.get_processing_order();
+    unsigned int num_nodes = static_cast<unsigned int>(memory_deps.size());
 
-    // maps program nodes to bimap vector ids
-    auto user_map = std::map<program_node*, unsigned int>();
-    unsigned int processing_order_idx = 0;
-    for (auto node : processing_order) {
-        user_map[node] = processing_order_idx++;
-    }
-
-    unsigned int num_nodes = static_cast<unsigned int>(user_map.size());
-
-    // full cross ref [node<->node] bitmap.
+    // full cross ref [node<->node] bitmap indexed by processing order.
     // every node has a bit array assigned to it
     // users or the node are marked with 1 bit in this array
     std::vector<bits_64> user_bitmap(num_nodes, bits_64(num_nodes));
     bits_64 suspect_nodes(num_nodes);
 
-    // init bitmaps from direct node users
-    for (const auto& node : user_map) {
-        for (const auto& user : node.first->get_users()) {
-            user_bitmap[node.second].set(user_map.at(user));
+    // users always follow their dependencies in processing order, so a single pass in reverse processing order
+    // completes the users sets of a node from the already closed sets of its direct users
+    for (unsigned int n = num_nodes; n-- > 0;) {
+        auto node = memory_deps.get_node(n);
+        for (const auto& user : node->get_users()) {
+            auto user_id = memory_deps.get_index(user);
+            if (user_id == num_nodes)
+                continue;
+            user_bitmap[n].set(user_id);
+            user_bitmap[n]._or(user_bitmap[user_id]);
         }
 
         size_t num_dep_nodes = 0;
-        for (const auto& dep : node.first->get_dependencies()) {
+        for (const auto& dep : node->get_dependencies()) {
             if (!dep->is_constant()) {
                 ++num_dep_nodes;
             }
         }
         if (num_dep_nodes > 1) {
-            suspect_nodes.set(user_map.at(node.first));
-        }
-    }
-
-    // Iteratively extend the users set by adding closure over existing users until no change occurs.
-    bool changed = true;
-    while (changed) {
-        changed = false;
-        for (unsigned int n = 0; n < num_nodes; n++) {
-            auto& users = user_bitmap[n];
-
-            // iterate over all users
-            for (unsigned int user_id = 0; user_id < num_nodes; user_id++) {
-                // if we have this user set, then add its sub-users to the map
-                if (users.is_set(user_id)) {
-                    changed |= users._or(user_bitmap[user_id]);
-                }
-            }
+            suspect_nodes.set(n);
         }
     }
 
@@ -140,7 +71,7 @@ void oooq_memory_dependencies::run(program& p) {
         if (suspect_nodes.is_set(A)) {
             std::vector<std::pair<program_node*, unsigned int>> deps;
             for (const auto& dep : (*itr_A)->get_dependencies()) {
-                deps.emplace_back(dep, user_map.at(dep));
+                deps.emplace_back(dep, static_cast<unsigned int>(memory_deps.get_index(dep)));
             }
 
             std::sort(deps.begin(), deps.end(),
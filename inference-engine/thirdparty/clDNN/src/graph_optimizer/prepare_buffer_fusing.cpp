@@ -20,6 +20,7 @@
 
 #include "pass_manager.h"
 #include "program_helpers.h"
+#include "cldnn/runtime/debug_configuration.hpp"
 
 #include <utility>
 #include <list>
@@ -29,6 +30,15 @@ using namespace cldnn;
 
 namespace {
 
+// Returns the size of the feature block of the blocked formats which are handled by in-place concatenation, 0 for others
+int feature_block_size(const format& fmt) {
+    if (fmt == format::b_fs_yx_fsv16 || fmt == format::b_fs_zyx_fsv16)
+        return 16;
+    if (fmt == format::b_fs_yx_fsv32 || fmt == format::b_fs_zyx_fsv32)
+        return 32;
+    return 0;
+}
+
 struct concat_noop_optimization : pattern_match_optimization_typed<concat_noop_optimization, concatenation> {
     // Removes concatenation nodes with single input.
     using base = pattern_match_optimization_typed<concat_noop_optimization, concatenation>;
@@ -99,12 +109,13 @@ bool concat_in_place_optimization::match(concatenation_node& node) {
             return false;
     }
 
-    for (auto& input : node.get_dependencies()) {
-        if (input->is_type<reshape>())
+    for (size_t i = 0; i < node.get_dependencies().size(); i++) {
+        auto& input = node.get_dependency(i);
+        if (input.is_type<reshape>())
             // reshapes should be optimized out.
             return false;
 
-        layout l = input->get_output_layout();
+        layout l = input.get_output_layout();
 
         if (output_format != l.format || output_datatype != l.data_type)
             return false;
@@ -112,15 +123,17 @@ bool concat_in_place_optimization::match(concatenation_node& node) {
         // TODO: Below condition should be moved to program_node::supports_padding.
         // This hovewer will need updating the algorithm as it may make cascade adjustment impossible in some cases.
         // It hovewer would make normal optimizations possible in others, so this is a trade-off to be investigated.
-        if (l.format == format::b_fs_yx_fsv16 && (l.size.feature[0] % 16 != 0 || node.get_primitive()->axis != concatenation::along_f))
-            return false;
-
-        if (l.format == format::b_fs_zyx_fsv16 && (l.size.feature[0] % 16 != 0 || node.get_primitive()->axis != concatenation::along_f))
-            return false;
-
-        if ((l.format == format::b_fs_yx_fsv32 || l.format == format::b_fs_zyx_fsv32) &&
-            (l.size.feature[0] % 32 != 0 || node.get_primitive()->axis != concatenation::along_f))
-            return false;
+        // Along the features the inputs have to start at the block boundary, so only the last input may have the
+        // feature count not aligned to the block, its tail is in the padded part of the last block of the output.
+        // Along the spatial axes the blocks of the inputs and the output are the same.
+        auto block_size = feature_block_size(l.format);
+        if (block_size != 0) {
+            if (concat_axis == concatenation::along_b)
+                return false;
+            if (concat_axis == concatenation::along_f && l.size.feature[0] % block_size != 0 &&
+                i != node.get_dependencies().size() - 1)
+                return false;
+        }
 
         if (l.format == format::bs_fs_yx_bsv16_fsv16)
             return false;
@@ -152,10 +165,18 @@ bool concat_in_place_optimization::match(concatenation_node& node) {
             !input->is_padding_supported(concat_axis, lower_padd_in_axis))
             return false;
 
+        // Other users read the input through the padding of the concatenated buffer. The feature padding is handled by
+        // all the clDNN kernels, the other axes are checked for at most one more user.
         // TODO: Investigate if this condition is needed
-        if (input->get_users().size() > 2)
+        if (input->get_users().size() > 2 && concat_axis != concatenation::along_f)
             return false;
 
+        // oneDNN users don't support the padded inputs
+        for (auto& user : input->get_users()) {
+            if (user != &node && user->get_preferred_impl_type() == impl_types::onednn)
+                return false;
+        }
+
         // Check that input isn't optimized out concatenation along different axis.
         if (input->is_type<concatenation>() && input->can_be_optimized() &&
             input->as<concatenation>().get_primitive()->axis != concat_axis)
@@ -301,8 +322,11 @@ void prepare_buffer_fusing::run(program& p) {
                 auto input_layout = node.get_dependency(0).get_output_layout();
                 const auto& crop_size = crop_layout.size;
                 const auto& out_padd = crop_layout.data_padding;
-                const auto opt_lower_pad = crop_prim->offsets.feature[0];
-                const auto opt_upper_pad = input_layout.size.feature[0] - crop_prim->offsets.feature[0] - crop_size.feature[0];
+                // The input may already be a part of the concatenated buffer, so its feature padding is kept
+                const auto& in_padd = input_layout.data_padding;
+                const auto opt_lower_pad = in_padd.lower_size().feature[0] + crop_prim->offsets.feature[0];
+                const auto opt_upper_pad = in_padd.upper_size().feature[0] + input_layout.size.feature[0] -
+                                           crop_prim->offsets.feature[0] - crop_size.feature[0];
 
                 // do not optimize crop if paddings are not properly aligned
                 for (auto& usr : node.get_users()) {
@@ -369,4 +393,24 @@ void prepare_buffer_fusing::run(program& p) {
                 node.can_be_optimized(false);
         });
     }
+
+    GPU_DEBUG_GET_INSTANCE(debug_config);
+    GPU_DEBUG_IF(debug_config->verbose >= 1) {
+        // Each input of in-place concatenation and each in-place crop or reshape is a buffer which is not copied
+        size_t concats = 0, concat_inputs = 0, crops = 0, reshapes = 0;
+        for (auto& node : p.get_processing_order()) {
+            if (!node->can_be_optimized())
+                continue;
+            if (node->is_type<concatenation>()) {
+                concats++;
+                concat_inputs += node->get_dependencies().size();
+            } else if (node->is_type<crop>()) {
+                crops++;
+            } else if (node->is_type<reshape>()) {
+                reshapes++;
+            }
+        }
+        GPU_DEBUG_COUT << "prepare_buffer_fusing: " << concat_inputs << " buffers fused into " << concats
+                       << " concatenations, " << crops << " crops and " << reshapes << " reshapes in place" << std::endl;
+    }
 }
@@ -44,6 +44,10 @@
 #include "embedding_bag_inst.h"
 #include "extract_image_patches_inst.h"
 #include "reduce_inst.h"
+#include "attention_inst.h"
+#include "layer_norm_inst.h"
+#include "data_inst.h"
+#include "attention/attention_kernel_tiled.h"
 #include <vector>
 #include <map>
 #include <list>
@@ -56,6 +60,8 @@
 void prepare_primitive_fusing::run(program& p) {
     fuse_reorders(p);
     fuse_sigmoid_mul_to_swish(p);
+    fuse_attention(p);
+    fuse_layer_norm(p);
     fuse_bias(p);
     fuse_simple_primitives(p);
     fuse_activations(p);
@@ -127,6 +133,288 @@ void prepare_primitive_fusing::fuse_sigmoid_mul_to_swish(program &p) {
     }
 }
 
+namespace {
+bool is_single_use(const program_node& node) {
+    return !node.is_output() && node.get_users().size() == 1 && node.get_fused_activations_funcs().empty() &&
+           !node.has_fused_primitives();
+}
+
+bool is_plain_eltwise(const program_node& node, eltwise_mode mode) {
+    if (!node.is_type<eltwise>())
+        return false;
+    auto prim = node.as<eltwise>().get_primitive();
+    return node.get_dependencies().size() == 2 && prim->mode == mode && prim->coefficients.empty() && prim->stride.empty();
+}
+
+bool is_fusable_layout(const layout& l) {
+    return l.format == format::bfyx && (l.data_type == data_types::f32 || l.data_type == data_types::f16);
+}
+
+bool get_scalar_value(program& p, program_node& node, float& value) {
+    if (!node.is_type<data>() || node.get_output_layout().count() != 1)
+        return false;
+
+    auto mem = node.as<data>().get_attached_memory_ptr();
+    switch (node.get_output_layout().data_type) {
+        case data_types::f32: {
+            mem_lock<float, mem_lock_type::read> lock{mem, p.get_stream()};
+            value = lock[0];
+            return true;
+        }
+        case data_types::f16: {
+            mem_lock<half_t, mem_lock_type::read> lock{mem, p.get_stream()};
+            value = static_cast<float>(lock[0]);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+}  // namespace
+
+void prepare_primitive_fusing::fuse_attention(program &p) {
+    // Replaces the scaled dot product attention subgraph with the attention primitive:
+    // gemm(query, key) -> [eltwise prod by scalar] -> [eltwise sum with mask] -> softmax(x) -> gemm(value)
+    // The scores matrix is not stored to the memory, it is computed tile by tile in the kernel.
+    auto itr = p.get_processing_order().begin();
+    while (itr != p.get_processing_order().end()) {
+        auto node_itr = itr++;
+        auto& node = (*node_itr);
+
+        if (node->is_output())
+            continue;
+
+        program_helpers::do_for_types<gemm>(*node, [&p](gemm_node& node) {
+            auto& gemm2 = node;
+            auto gemm2_prim = gemm2.get_primitive();
+            if (gemm2.inputs_count() != 2 || gemm2_prim->transpose_input0 || gemm2_prim->transpose_input1 ||
+                gemm2_prim->alpha != 1.0f || !gemm2.get_fused_activations_funcs().empty() || gemm2.has_fused_primitives())
+                return;
+
+            if (!gemm2.input(0).is_type<softmax>() || !is_single_use(gemm2.input(0)))
+                return;
+
+            auto& sm = gemm2.input(0).as<softmax>();
+            if (sm.get_primitive()->dimension != softmax::normalize_x)
+                return;
+
+            std::vector<program_node*> fused_nodes = {&sm};
+            std::vector<program_node*> scalars;
+
+            // matches gemm(query, key) optionally multiplied by the scalar
+            auto match_scores = [&p](program_node& scores, float& scale, std::vector<program_node*>& nodes,
+                                     std::vector<program_node*>& constants) -> program_node* {
+                program_node* cur = &scores;
+                if (is_plain_eltwise(*cur, eltwise_mode::prod) && is_single_use(*cur)) {
+                    float value = 1.0f;
+                    size_t scores_idx = 0;
+                    if (get_scalar_value(p, cur->get_dependency(1), value))
+                        scores_idx = 0;
+                    else if (get_scalar_value(p, cur->get_dependency(0), value))
+                        scores_idx = 1;
+                    else
+                        return nullptr;
+                    scale *= value;
+                    nodes.push_back(cur);
+                    constants.push_back(&cur->get_dependency(1 - scores_idx));
+                    cur = &cur->get_dependency(scores_idx);
+                }
+
+                if (!cur->is_type<gemm>() || !is_single_use(*cur))
+                    return nullptr;
+
+                auto& gemm1 = cur->as<gemm>();
+                if (gemm1.inputs_count() != 2 || gemm1.get_primitive()->transpose_input0)
+                    return nullptr;
+
+                scale *= gemm1.get_primitive()->alpha;
+                nodes.push_back(cur);
+                return cur;
+            };
+
+            float scale = 1.0f;
+            program_node* gemm1 = nullptr;
+            program_node* mask = nullptr;
+            auto& scores = sm.input();
+            if (is_plain_eltwise(scores, eltwise_mode::sum) && is_single_use(scores)) {
+                for (size_t i = 0; i < 2 && !gemm1; i++) {
+                    float s = 1.0f;
+                    std::vector<program_node*> nodes = {&scores};
+                    std::vector<program_node*> constants;
+                    gemm1 = match_scores(scores.get_dependency(i), s, nodes, constants);
+                    if (gemm1) {
+                        scale = s;
+                        mask = &scores.get_dependency(1 - i);
+                        fused_nodes.insert(fused_nodes.end(), nodes.begin(), nodes.end());
+                        scalars = constants;
+                    }
+                }
+            } else {
+                gemm1 = match_scores(scores, scale, fused_nodes, scalars);
+            }
+
+            if (!gemm1)
+                return;
+
+            auto& query = gemm1->get_dependency(0);
+            auto& key = gemm1->get_dependency(1);
+            auto& value = gemm2.input(1);
+            auto out_layout = gemm2.get_output_layout();
+            auto scores_size = gemm1->get_output_layout().size;
+
+            for (auto n : {&query, &key, &value}) {
+                auto l = n->get_output_layout();
+                if (!is_fusable_layout(l) || l.size.batch[0] != out_layout.size.batch[0] ||
+                    l.size.feature[0] != out_layout.size.feature[0])
+                    return;
+            }
+
+            const size_t max_head_size = kernel_selector::AttentionKernelTiled::max_head_size;
+            if (!is_fusable_layout(out_layout) ||
+                static_cast<size_t>(query.get_output_layout().size.spatial[0]) > max_head_size ||
+                static_cast<size_t>(value.get_output_layout().size.spatial[0]) > max_head_size)
+                return;
+
+            if (mask) {
+                // the mask is broadcasted to the scores
+                auto mask_layout = mask->get_output_layout();
+                if (!is_fusable_layout(mask_layout))
+                    return;
+                auto mask_dims = mask_layout.size.sizes(format::bfyx);
+                auto scores_dims = scores_size.sizes(format::bfyx);
+                for (size_t i = 0; i < mask_dims.size(); i++) {
+                    if (mask_dims[i] != 1 && mask_dims[i] != scores_dims[i])
+                        return;
+                }
+            }
+
+            auto transpose_key = gemm1->as<gemm>().get_primitive()->transpose_input1;
+            auto attention_prim = std::make_shared<cldnn::attention>(gemm2.id() + "_attention", query.id(), key.id(),
+                                                                     value.id(), mask ? mask->id() : "", transpose_key,
+                                                                     scale, optional_data_type{out_layout.data_type});
+            auto& attn = p.get_or_create(attention_prim);
+
+            fused_nodes.push_back(&gemm2);
+            for (auto n : fused_nodes)
+                p.add_optimized_primitive_info(n->id(), {attn.id()});
+
+            p.add_connection(query, attn);
+            p.add_connection(key, attn);
+            p.add_connection(value, attn);
+            if (mask)
+                p.add_connection(*mask, attn);
+
+            p.get_processing_order().insert_next(&gemm2, &attn);
+            p.replace_all_usages(gemm2, attn);
+
+            for (auto n : fused_nodes)
+                p.remove_all_connections(*n);
+            for (auto n : fused_nodes)
+                p.remove_if_dangling(*n);
+            for (auto n : scalars)
+                p.remove_if_dangling(*n);
+
+            attn.calc_output_layout();
+        });
+    }
+}
+
+void prepare_primitive_fusing::fuse_layer_norm(program &p) {
+    // Replaces the layer normalization subgraph with the layer_norm primitive:
+    // [eltwise sum (input, residual)] -> mvn(within channels) -> eltwise prod by gamma -> eltwise sum with beta
+    // The match starts from the last node, so all the removed nodes precede the iterator in the processing order.
+    auto itr = p.get_processing_order().begin();
+    while (itr != p.get_processing_order().end()) {
+        auto node_itr = itr++;
+        auto& node = (*node_itr);
+
+        if (node->is_output())
+            continue;
+
+        program_helpers::do_for_types<eltwise>(*node, [&p](eltwise_node& node) {
+            auto& add = node;
+            auto out_layout = add.get_output_layout();
+            if (!is_fusable_layout(out_layout) || !add.get_fused_activations_funcs().empty() || add.has_fused_primitives())
+                return;
+
+            // matches the eltwise with the [1, 1, y, x] constant, returns the index of the constant
+            auto params_size = tensor(1, 1, out_layout.size.spatial[0], out_layout.size.spatial[1]);
+            auto match_params = [&params_size](program_node& n, eltwise_mode mode) -> int {
+                if (!is_plain_eltwise(n, mode))
+                    return -1;
+                for (size_t i = 0; i < 2; i++) {
+                    auto& dep = n.get_dependency(i);
+                    if (dep.is_type<data>() && dep.get_output_layout().size == params_size &&
+                        is_fusable_layout(dep.get_output_layout()))
+                        return static_cast<int>(i);
+                }
+                return -1;
+            };
+
+            auto beta_idx = match_params(add, eltwise_mode::sum);
+            if (beta_idx < 0)
+                return;
+
+            auto& mul = add.get_dependency(1 - beta_idx);
+            auto gamma_idx = match_params(mul, eltwise_mode::prod);
+            if (gamma_idx < 0 || !is_single_use(mul))
+                return;
+
+            auto& norm = mul.get_dependency(1 - gamma_idx);
+            if (!norm.is_type<mvn>() || !is_single_use(norm))
+                return;
+
+            auto norm_prim = norm.as<mvn>().get_primitive();
+            auto in_layout = norm.get_dependency(0).get_output_layout();
+            if (!norm_prim->normalize_variance || norm_prim->across_channels || !is_fusable_layout(in_layout) ||
+                in_layout.size != out_layout.size)
+                return;
+
+            auto& gamma = mul.get_dependency(gamma_idx);
+            auto& beta = add.get_dependency(beta_idx);
+            std::vector<program_node*> fused_nodes = {&norm, &mul, &add};
+            program_node* input = &norm.get_dependency(0);
+            program_node* residual = nullptr;
+            auto& sum = norm.get_dependency(0);
+            if (is_plain_eltwise(sum, eltwise_mode::sum) && is_single_use(sum) &&
+                sum.get_dependency(0).get_output_layout().size == in_layout.size &&
+                sum.get_dependency(1).get_output_layout().size == in_layout.size &&
+                is_fusable_layout(sum.get_dependency(0).get_output_layout()) &&
+                is_fusable_layout(sum.get_dependency(1).get_output_layout())) {
+                input = &sum.get_dependency(0);
+                residual = &sum.get_dependency(1);
+                fused_nodes.insert(fused_nodes.begin(), &sum);
+            }
+
+            auto layer_norm_prim = std::make_shared<cldnn::layer_norm>(add.id() + "_layer_norm", input->id(),
+                                                                       residual ? residual->id() : "", gamma.id(),
+                                                                       beta.id(), norm_prim->epsilon,
+                                                                       norm_prim->eps_inside_sqrt,
+                                                                       optional_data_type{out_layout.data_type});
+            auto& ln = p.get_or_create(layer_norm_prim);
+
+            for (auto n : fused_nodes)
+                p.add_optimized_primitive_info(n->id(), {ln.id()});
+
+            p.add_connection(*input, ln);
+            p.add_connection(gamma, ln);
+            p.add_connection(beta, ln);
+            if (residual)
+                p.add_connection(*residual, ln);
+
+            p.get_processing_order().insert_next(&add, &ln);
+            p.replace_all_usages(add, ln);
+
+            for (auto n : fused_nodes)
+                p.remove_all_connections(*n);
+            for (auto n : fused_nodes)
+                p.remove_if_dangling(*n);
+
+            ln.calc_output_layout();
+        });
+    }
+}
+
 void prepare_primitive_fusing::fuse_reorders(program &p) {
     // This loop tries fusing several reorders one by one (if present) into one reorder
     auto itr = p.get_processing_order().begin();
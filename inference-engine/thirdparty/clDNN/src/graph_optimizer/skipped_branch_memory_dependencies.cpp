@@ -30,11 +30,11 @@ void skipped_branch_memory_dependencies::run(program& p) {
         if (nodeB->get_users().size() == 0)
             continue;
 
-        // find the last user of B in processing order
+        // find the last user of B in processing order, the matrix indices are the processing order positions
         auto itrUsr = nodeB->get_users().begin();
         auto lastUsr = itrUsr++;
         while (itrUsr != nodeB->get_users().end()) {
-            if (processing_order.get_processing_number(*lastUsr) < processing_order.get_processing_number(*itrUsr))
+            if (memory_deps.get_index(*lastUsr) < memory_deps.get_index(*itrUsr))
                 lastUsr = itrUsr;
             itrUsr++;
         }
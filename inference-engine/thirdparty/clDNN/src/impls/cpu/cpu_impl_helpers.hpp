@@ -4,9 +4,22 @@
 
 #pragma once
 
+#include "primitive_inst.h"
+#include "cldnn/runtime/stream.hpp"
+
 #include <algorithm>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
+#if (CLDNN_THREADING == CLDNN_THREADING_TBB)
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#endif
+
 namespace cldnn {
 namespace cpu {
 
@@ -74,5 +87,99 @@ using vector3D = vector2D<vector1D<T>>;
 template <typename T>
 using vector4D = vector2D<vector2D<T>>;
 
+// Runs func(i) for every i in [0, count) on the host threads
+template <typename F>
+void parallel_for(size_t count, const F& func) {
+#if (CLDNN_THREADING == CLDNN_THREADING_TBB)
+    tbb::parallel_for(static_cast<size_t>(0), count, func);
+#else
+    for (size_t i = 0; i < count; i++)
+        func(i);
+#endif
+}
+
+// Executes host work of a cpu impl. When all memories of the instance are usm host allocations, the work is done on
+// a worker thread, so the thread which enqueues the network doesn't wait for it and may enqueue the following
+// primitives. Commands enqueued afterwards wait for the returned event on the device. Memories are locked before the
+// work is started, so the locks taken by the work don't synchronize the stream which waits for it. Buffers are
+// unmapped with an enqueued command which would run after their consumers, so the work is done synchronously for them.
+class host_executor {
+public:
+    host_executor() : _state(std::make_shared<state>()) {}
+    host_executor(const host_executor&) : host_executor() {}
+    host_executor& operator=(const host_executor&) { return *this; }
+
+    event::ptr execute(primitive_inst& instance, const std::vector<event::ptr>& events, std::function<void()> work) {
+        for (auto& e : events) {
+            e->wait();
+        }
+
+        // failure of the previous asynchronous run is reported on the next one
+        {
+            std::lock_guard<std::mutex> lock(_state->mutex);
+            if (_state->error) {
+                auto error = _state->error;
+                _state->error = nullptr;
+                std::rethrow_exception(error);
+            }
+        }
+
+        auto& stream = instance.get_network().get_stream();
+        auto ev = stream.create_user_event(false);
+
+        std::vector<memory::ptr> memories;
+        for (size_t i = 0; i < instance.dependencies().size(); i++) {
+            memories.push_back(instance.dep_memory_ptr(i));
+        }
+        memories.push_back(instance.output_memory_ptr());
+
+        bool host_memories = std::all_of(memories.begin(), memories.end(), [](const memory::ptr& mem) {
+            return mem->get_allocation_type() == allocation_type::usm_host || mem->get_allocation_type() == allocation_type::usm_shared;
+        });
+
+        if (!host_memories) {
+            work();
+            ev->set();
+            return ev;
+        }
+
+        auto locks = std::make_shared<std::vector<std::unique_ptr<mem_lock<uint8_t>>>>();
+        for (auto& mem : memories) {
+            locks->emplace_back(new mem_lock<uint8_t>(mem, stream));
+        }
+
+        auto task_state = _state;
+        run_on_worker([work, locks, ev, task_state]() {
+            try {
+                work();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(task_state->mutex);
+                task_state->error = std::current_exception();
+            }
+            locks->clear();
+            ev->set();
+        });
+
+        stream.enqueue_barrier({ev});
+        return ev;
+    }
+
+private:
+    struct state {
+        std::mutex mutex;
+        std::exception_ptr error;
+    };
+    std::shared_ptr<state> _state;
+
+    static void run_on_worker(std::function<void()> task) {
+#if (CLDNN_THREADING == CLDNN_THREADING_TBB)
+        static tbb::task_arena arena;
+        arena.enqueue(std::move(task));
+#else
+        std::thread(std::move(task)).detach();
+#endif
+    }
+};
+
 }  // namespace cpu
 }  // namespace cldnn
@@ -16,12 +16,6 @@
 #include <vector>
 #include <utility>
 
-#ifdef FIX_OPENMP_RELEASE_ISSUE
-#ifdef OPENMP_FOUND
-#include <omp.h>
-#endif
-#endif
-
 namespace cldnn {
 namespace cpu {
 
@@ -46,6 +40,7 @@ struct detection_output_impl : typed_primitive_impl<detection_output> {
     enum NMSType {CAFFE, MXNET};
     const detection_output_node& outer;
     NMSType nms_type;
+    host_executor executor;
 
     std::unique_ptr<primitive_impl> clone() const override {
         return make_unique<detection_output_impl>(*this);
@@ -268,31 +263,29 @@ struct detection_output_impl : typed_primitive_impl<detection_output> {
 
         const auto& args = instance.argument;
         // Per image -> For each label: Pair (score, prior index)
-        std::vector<std::vector<std::vector<std::pair<float, int>>>> final_detections;
-        for (int image = 0; image < num_of_images; ++image) {
+        std::vector<std::vector<std::vector<std::pair<float, int>>>> final_detections(num_of_images);
+        // Images are processed independently, as well as the classes of an image for Caffe NMS
+        parallel_for(num_of_images, [&](size_t image) {
             const std::vector<std::vector<bounding_box>>& bboxes_per_image = all_bboxes[image];
             std::vector<std::vector<std::pair<float, int>>>& conf_per_image = confidences[image];
             std::map<int, std::vector<int>> indices;
             int num_det = 0;
-#ifdef FIX_OPENMP_RELEASE_ISSUE
-#ifdef OPENMP_FOUND
-            int num_available_threads = omp_get_max_threads();
-            // half available threads usage shows the best perf results for both SKL (4c8t) and APL (4c4t) for this part
-            // of detection output
-            int num_threads_to_use = (omp_in_parallel() == 0) ? num_available_threads / 2 : 1;
-#pragma omp parallel for num_threads(num_threads_to_use) reduction(+ : num_det)
-#endif
-#endif
             if (nms_type == CAFFE) {
-                for (int cls = 0; cls < static_cast<int>(args.num_classes); ++cls) {
+                std::vector<std::vector<int>> class_indices(args.num_classes);
+                parallel_for(args.num_classes, [&](size_t cls) {
                     if (static_cast<int>(cls) == args.background_label_id) {
                         conf_per_image[cls].clear();
-                        continue;  // Skip background class.
+                        return;  // Skip background class.
                     }
                     std::vector<std::pair<float, int>>& scores = conf_per_image[cls];
-                    const int label = args.share_location ? 0 : cls;
-                    caffe_nms(bboxes_per_image[label], scores, args.nms_threshold, args.top_k, indices[cls]);
-                    num_det += static_cast<int>(indices[cls].size());
+                    const int label = args.share_location ? 0 : static_cast<int>(cls);
+                    caffe_nms(bboxes_per_image[label], scores, args.nms_threshold, args.top_k, class_indices[cls]);
+                });
+                for (int cls = 0; cls < static_cast<int>(args.num_classes); ++cls) {
+                    if (cls == args.background_label_id)
+                        continue;
+                    num_det += static_cast<int>(class_indices[cls].size());
+                    indices[cls] = std::move(class_indices[cls]);
                 }
             } else {
                 std::vector<std::pair<float, std::pair<int, int>>>& score_image = scoreIndexPairs[image];
@@ -329,7 +322,7 @@ struct detection_output_impl : typed_primitive_impl<detection_output> {
                     int idx = score_index_pairs[j].second.second;
                     new_indices[label].emplace_back(score_index_pairs[j].first, idx);
                 }
-                final_detections.emplace_back(new_indices);
+                final_detections[image] = std::move(new_indices);
             } else {
                 std::vector<std::vector<std::pair<float, int>>> new_indices(args.num_classes);
                 for (auto it = indices.begin(); it != indices.end(); ++it) {
@@ -345,9 +338,9 @@ struct detection_output_impl : typed_primitive_impl<detection_output> {
                         }
                     }
                 }
-                final_detections.emplace_back(new_indices);
+                final_detections[image] = std::move(new_indices);
             }
-        }
+        });
 
         int count = 0;
         for (int image = 0; image < num_of_images; ++image) {
@@ -751,7 +744,7 @@ struct detection_output_impl : typed_primitive_impl<detection_output> {
                                                  prior_variances);
 
         // Create the decoded bounding boxes according to locations predictions and prior-boxes.
-        for (int image = 0; image < num_of_images; ++image) {
+        parallel_for(num_of_images, [&](size_t image) {
             std::vector<std::vector<bounding_box>>& bboxes_per_image = bboxes[image];
             bboxes_per_image.resize(num_loc_classes);
             locations[image].resize(num_loc_classes);
@@ -767,8 +760,8 @@ struct detection_output_impl : typed_primitive_impl<detection_output> {
 
                 for (int i = 0; i < label_loc_preds_size; ++i) {
                     bounding_box decoded_bbox;
-                    int32_t pb_offset = (batches_in_prior_boxes > 1) ? (image * num_of_priors + i) : i;
-                    int32_t var_offset = (batches_in_prior_boxes > 1) ? (image * num_of_priors + i) : i;
+                    int32_t pb_offset = (batches_in_prior_boxes > 1) ? (static_cast<int32_t>(image) * num_of_priors + i) : i;
+                    int32_t var_offset = (batches_in_prior_boxes > 1) ? (static_cast<int32_t>(image) * num_of_priors + i) : i;
                     decode_bounding_box(prior_bboxes[pb_offset],
                                         prior_variances[var_offset],
                                         args.code_type,
@@ -782,7 +775,7 @@ struct detection_output_impl : typed_primitive_impl<detection_output> {
                     bboxes_per_image[label].emplace_back(decoded_bbox);
                 }
             }
-        }
+        });
         // Extract confidences per image.
         if (nms_type == CAFFE) {
             extract_confidences_per_image_caffe<dtype>(stream, instance, confidences, num_of_priors);
@@ -792,13 +785,12 @@ struct detection_output_impl : typed_primitive_impl<detection_output> {
     }
 
     event::ptr execute_impl(const std::vector<event::ptr>& events, detection_output_inst& instance) override {
-        for (auto& a : events) {
-            a->wait();
-        }
+        return executor.execute(instance, events, [this, &instance]() { run(instance); });
+    }
 
+    void run(detection_output_inst& instance) {
         auto& stream = instance.get_network().get_stream();
 
-        auto ev = stream.create_user_event(false);
         const int num_of_images = instance.location_memory()->get_layout().size.batch[0];  // batch size
         // Per image : label -> decoded bounding boxes.
         std::vector<std::vector<std::vector<bounding_box>>> bboxes(num_of_images);
@@ -813,9 +805,6 @@ struct detection_output_impl : typed_primitive_impl<detection_output> {
             prepare_data<data_type_to_type<data_types::f16>::type>(stream, instance, bboxes, confidences, scoreIndexPairs);
             generate_detections<data_type_to_type<data_types::f16>::type>(stream, instance, num_of_images, bboxes, confidences, scoreIndexPairs);
         }
-
-        ev->set();
-        return ev;
     }
 
     void init_kernels() override {}
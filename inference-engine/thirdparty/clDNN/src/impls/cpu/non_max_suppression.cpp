@@ -52,49 +52,55 @@ std::vector<result_indices> run_nms(
         const float weight = std::exp(scale * iou * iou);
         return iou <= iou_threshold ? weight : 0.0f;
     };
-    std::vector<result_indices> result;
+    // classes of all batches are processed independently and their results are concatenated in the original order
+    const size_t classes_num = boxes.empty() ? 0 : scores[0].size();
+    vector2D<result_indices> class_results(boxes.size() * classes_num);
+
+    parallel_for(class_results.size(), [&](size_t i) {
+        const size_t bi = i / classes_num;
+        const size_t ci = i % classes_num;
+        std::vector<result_indices>& fb = class_results[i];
+
+        std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
+        for (size_t bbi = 0; bbi < boxes[bi].size(); ++bbi) {
+            if (scores[bi][ci][bbi] > score_threshold)
+                sorted_boxes.emplace(boxInfo({scores[bi][ci][bbi], static_cast<int>(bbi), 0}));
+        }
+        fb.reserve(sorted_boxes.size());
+
+        while (static_cast<int>(fb.size()) < num_select_per_class && !sorted_boxes.empty()) {
+            boxInfo currBox = sorted_boxes.top();
+            float origScore = currBox.score;
+            sorted_boxes.pop();
 
-    for (size_t bi = 0; bi < boxes.size(); ++bi) {
-        for (size_t ci = 0; ci < scores[bi].size(); ++ci) {
-            std::vector<result_indices> fb;
+            bool box_is_selected = true;
+            for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
+                float iou_boxes = iou(boxes[bi][currBox.idx], boxes[bi][fb[idx].box_index]);
 
-            std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
-            for (size_t bbi = 0; bbi < boxes[bi].size(); ++bbi) {
-                if (scores[bi][ci][bbi] > score_threshold)
-                    sorted_boxes.emplace(boxInfo({scores[bi][ci][bbi], static_cast<int>(bbi), 0}));
+                currBox.score *= coeff(iou_boxes);
+                if (iou_boxes >= iou_threshold) {
+                    box_is_selected = false;
+                    break;
+                }
+                if (currBox.score <= score_threshold)
+                    break;
             }
-            fb.reserve(sorted_boxes.size());
-
-            while (static_cast<int>(fb.size()) < num_select_per_class && !sorted_boxes.empty()) {
-                boxInfo currBox = sorted_boxes.top();
-                float origScore = currBox.score;
-                sorted_boxes.pop();
-
-                bool box_is_selected = true;
-                for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                    float iou_boxes = iou(boxes[bi][currBox.idx], boxes[bi][fb[idx].box_index]);
-
-                    currBox.score *= coeff(iou_boxes);
-                    if (iou_boxes >= iou_threshold) {
-                        box_is_selected = false;
-                        break;
-                    }
-                    if (currBox.score <= score_threshold)
-                        break;
+            currBox.suppress_begin_index = static_cast<int>(fb.size());
+            if (box_is_selected) {
+                if (currBox.score == origScore) {
+                    fb.push_back(result_indices{ currBox.score, static_cast<int>(bi), static_cast<int>(ci), currBox.idx });
+                    continue;
                 }
-                currBox.suppress_begin_index = static_cast<int>(fb.size());
-                if (box_is_selected) {
-                    if (currBox.score == origScore) {
-                        fb.push_back(result_indices{ currBox.score, static_cast<int>(bi), static_cast<int>(ci), currBox.idx });
-                        continue;
-                    }
-                    if (currBox.score > score_threshold) {
-                        sorted_boxes.push(currBox);
-                    }
+                if (currBox.score > score_threshold) {
+                    sorted_boxes.push(currBox);
                 }
             }
-            std::move(fb.begin(), fb.end(), std::back_inserter(result));
         }
+    });
+
+    std::vector<result_indices> result;
+    for (auto& fb : class_results) {
+        std::move(fb.begin(), fb.end(), std::back_inserter(result));
     }
 
     if (sort_result_descending) {
@@ -379,20 +385,12 @@ struct non_max_suppression_impl : typed_primitive_impl<non_max_suppression> {
         return make_unique<non_max_suppression_impl>(*this);
     }
 
+    host_executor executor;
+
     non_max_suppression_impl() : parent(kernel_selector::weights_reorder_params(), "non_max_suppression_impl") {}
 
     event::ptr execute_impl(const std::vector<event::ptr>& event, typed_primitive_inst<non_max_suppression>& instance) override {
-        for (auto e : event) {
-            e->wait();
-        }
-
-        auto& stream = instance.get_network().get_stream();
-        auto ev = stream.create_user_event(false);
-
-        run(instance);
-
-        ev->set();
-        return ev;
+        return executor.execute(instance, event, [&instance]() { run(instance); });
     }
 
     static primitive_impl* create(const non_max_suppression_node&) {
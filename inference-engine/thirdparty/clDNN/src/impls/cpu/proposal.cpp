@@ -7,6 +7,7 @@
 #include "impls/implementation_map.hpp"
 #include "cldnn/runtime/error_handler.hpp"
 #include "register.hpp"
+#include "cpu_impl_helpers.hpp"
 
 #include <algorithm>
 #include <string>
@@ -191,6 +192,7 @@ struct im_info_t {
 
 struct proposal_impl : typed_primitive_impl<proposal> {
     const proposal_node& outer;
+    host_executor executor;
 
     explicit proposal_impl(const proposal_node& arg) : outer(arg) {}
 
@@ -289,7 +291,12 @@ struct proposal_impl : typed_primitive_impl<proposal> {
         const dtype* cls_scores_mem = cls_scores_ptr.data();
         const dtype* bbox_pred_mem = bbox_pred_ptr.data();
 
-        for (int n = 0; n < score_size.batch[0]; n++) {
+        auto output = instance.output_memory_ptr();
+        mem_lock<dtype, mem_lock_type::write> output_ptr{output, stream};
+
+        // proposals of the images are generated independently and written to disjoint parts of the outputs
+        parallel_for(score_size.batch[0], [&](size_t batch) {
+            const int n = static_cast<int>(batch);
             std::vector<proposal_t> sorted_proposals_confidence;
             size_t num_proposals = fm_h * fm_w * anchors_num;
             sorted_proposals_confidence.reserve(num_proposals);
@@ -348,9 +355,6 @@ struct proposal_impl : typed_primitive_impl<proposal> {
                                                  instance.argument.post_nms_topn,
                                                  coordinates_offset);
 
-            auto output = instance.output_memory_ptr();
-
-            mem_lock<dtype, mem_lock_type::write> output_ptr{output, stream};
             dtype* top_data = output_ptr.data() + n * instance.argument.post_nms_topn * 5;
 
             dtype* top_data_prob = proposal_prob_ptr == nullptr ? nullptr : proposal_prob_ptr + n * instance.argument.post_nms_topn;
@@ -384,17 +388,20 @@ struct proposal_impl : typed_primitive_impl<proposal> {
                 if (top_data_prob != nullptr)
                     float_write_helper(top_data_prob + i, 0.0f);
             }
-        }
+        });
     }
 
     event::ptr execute_impl(const std::vector<event::ptr>& events, proposal_inst& instance) override {
-        for (auto& a : events) {
-            a->wait();
-        }
+        if (instance.dep_memory(proposal_inst::cls_scores_index).get_layout().data_type !=
+            instance.dep_memory(proposal_inst::bbox_pred_index).get_layout().data_type)
+            throw std::runtime_error("clDNN: proposal primitive doesn't support mixed bbox and scores types");
 
+        return executor.execute(instance, events, [this, &instance]() { run(instance); });
+    }
+
+    void run(proposal_inst& instance) {
         auto& stream = instance.get_network().get_stream();
 
-        auto ev = instance.get_network().get_stream().create_user_event(false);
         im_info_t im_info;
         if (instance.dep_memory(proposal_inst::image_info_index).get_layout().data_type == data_types::f16) {
             read_image_info<data_type_to_type<data_types::f16>::type>(stream, instance, im_info);
@@ -402,10 +409,6 @@ struct proposal_impl : typed_primitive_impl<proposal> {
             read_image_info<data_type_to_type<data_types::f32>::type>(stream, instance, im_info);
         }
 
-        if (instance.dep_memory(proposal_inst::cls_scores_index).get_layout().data_type !=
-            instance.dep_memory(proposal_inst::bbox_pred_index).get_layout().data_type)
-            throw std::runtime_error("clDNN: proposal primitive doesn't support mixed bbox and scores types");
-
         if (instance.dependencies().size() == 4) {
             auto proposal_probabilities = instance.dep_memory_ptr(proposal_inst::proposal_probabilities_out);
             if (instance.dep_memory(proposal_inst::cls_scores_index).get_layout().data_type == data_types::f16) {
@@ -422,9 +425,6 @@ struct proposal_impl : typed_primitive_impl<proposal> {
                 execute<data_type_to_type<data_types::f32>::type>(stream, instance, im_info);
             }
         }
-
-        ev->set();
-        return ev;
     }
 
     void init_kernels() override {}
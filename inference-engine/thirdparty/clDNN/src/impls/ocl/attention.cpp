@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "attention_inst.h"
+#include "primitive_base.hpp"
+#include "impls/implementation_map.hpp"
+#include "cldnn/runtime/error_handler.hpp"
+#include "kernel_selector_helper.h"
+#include "attention/attention_kernel_selector.h"
+#include "attention/attention_kernel_tiled.h"
+
+using namespace cldnn;
+
+namespace cldnn {
+namespace ocl {
+
+struct attention_impl : typed_primitive_impl_ocl<attention> {
+    using parent = typed_primitive_impl_ocl<attention>;
+    using parent::parent;
+
+    std::unique_ptr<primitive_impl> clone() const override {
+        return make_unique<attention_impl>(*this);
+    }
+
+public:
+    static primitive_impl* create(const attention_node& arg) {
+        auto attention_params = get_default_params<kernel_selector::attention_params>(arg);
+        auto attention_optional_params =
+            get_default_optional_params<kernel_selector::attention_optional_params>(arg.get_program());
+
+        for (size_t i = 1; i < arg.get_dependencies().size(); i++) {
+            attention_params.inputs.push_back(convert_data_tensor(arg.get_dependency(i).get_output_layout()));
+        }
+        attention_params.transpose_key = arg.get_primitive()->transpose_key;
+        attention_params.scale = arg.get_primitive()->scale;
+
+        auto& kernel_selector = kernel_selector::attention_kernel_selector::Instance();
+        auto best_kernels = kernel_selector.GetBestKernels(attention_params, attention_optional_params);
+
+        CLDNN_ERROR_BOOL(arg.id(),
+                         "Best_kernel.empty()",
+                         best_kernels.empty(),
+                         "Cannot find a proper kernel with this arguments");
+
+        return new attention_impl(arg, best_kernels[0]);
+    }
+};
+
+namespace detail {
+
+attach_attention_impl::attach_attention_impl() {
+    implementation_map<attention>::add(impl_types::ocl, attention_impl::create, {
+        std::make_tuple(data_types::f32, format::bfyx),
+        std::make_tuple(data_types::f16, format::bfyx),
+    });
+}
+
+}  // namespace detail
+}  // namespace ocl
+}  // namespace cldnn
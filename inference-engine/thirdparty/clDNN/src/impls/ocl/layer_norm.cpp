@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "layer_norm_inst.h"
+#include "primitive_base.hpp"
+#include "impls/implementation_map.hpp"
+#include "cldnn/runtime/error_handler.hpp"
+#include "kernel_selector_helper.h"
+#include "layer_norm/layer_norm_kernel_selector.h"
+#include "layer_norm/layer_norm_kernel_bfyx_opt.h"
+
+using namespace cldnn;
+
+namespace cldnn {
+namespace ocl {
+
+struct layer_norm_impl : typed_primitive_impl_ocl<layer_norm> {
+    using parent = typed_primitive_impl_ocl<layer_norm>;
+    using parent::parent;
+
+    std::unique_ptr<primitive_impl> clone() const override {
+        return make_unique<layer_norm_impl>(*this);
+    }
+
+public:
+    static primitive_impl* create(const layer_norm_node& arg) {
+        auto layer_norm_params = get_default_params<kernel_selector::layer_norm_params>(arg);
+        auto layer_norm_optional_params =
+            get_default_optional_params<kernel_selector::layer_norm_optional_params>(arg.get_program());
+
+        for (size_t i = 1; i < arg.get_dependencies().size(); i++) {
+            layer_norm_params.inputs.push_back(convert_data_tensor(arg.get_dependency(i).get_output_layout()));
+        }
+        layer_norm_params.has_residual = arg.has_residual();
+        layer_norm_params.epsilon = arg.get_primitive()->epsilon;
+        layer_norm_params.eps_mode = arg.get_primitive()->eps_inside_sqrt ? kernel_selector::mvn_eps_mode::INSIDE_SQRT
+                                                                          : kernel_selector::mvn_eps_mode::OUTSIDE_SQRT;
+
+        auto& kernel_selector = kernel_selector::layer_norm_kernel_selector::Instance();
+        auto best_kernels = kernel_selector.GetBestKernels(layer_norm_params, layer_norm_optional_params);
+
+        CLDNN_ERROR_BOOL(arg.id(),
+                         "Best_kernel.empty()",
+                         best_kernels.empty(),
+                         "Cannot find a proper kernel with this arguments");
+
+        return new layer_norm_impl(arg, best_kernels[0]);
+    }
+};
+
+namespace detail {
+
+attach_layer_norm_impl::attach_layer_norm_impl() {
+    implementation_map<layer_norm>::add(impl_types::ocl, layer_norm_impl::create, {
+        std::make_tuple(data_types::f32, format::bfyx),
+        std::make_tuple(data_types::f16, format::bfyx),
+    });
+}
+
+}  // namespace detail
+}  // namespace ocl
+}  // namespace cldnn
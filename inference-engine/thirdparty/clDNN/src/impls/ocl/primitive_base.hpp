@@ -10,6 +10,7 @@
 #include "cldnn/graph/program.hpp"
 #include "cldnn/runtime/error_handler.hpp"
 #include "kernel_selector_helper.h"
+#include "kernel_runner.h"
 #include "cldnn/graph/network.hpp"
 #include "register.hpp"
 #include <vector>
@@ -60,6 +61,31 @@ struct typed_primitive_impl_ocl : public typed_primitive_impl<PType> {
 
     bool is_cpu() const override { return false; }
 
+    std::string get_params_key() const override {
+        if (!_kernel_data.params)
+            return {};
+        return kernel_selector::toString(_kernel_data.params->GetType()) + "_" + _kernel_data.params->to_cache_string_v2();
+    }
+
+    std::chrono::nanoseconds measure_execution_time() const override {
+        if (!_kernel_data.params || _kernel_data.kernels.size() != 1)
+            return std::chrono::nanoseconds::max();
+
+        auto kernel_type = _kernel_data.params->GetType();
+        bool weights_and_bias_exist = kernel_type == kernel_selector::KernelType::CONVOLUTION ||
+                                      kernel_type == kernel_selector::KernelType::DECONVOLUTION ||
+                                      kernel_type == kernel_selector::KernelType::FULLY_CONNECTED;
+        bool zero_points_exist = kernel_type == kernel_selector::KernelType::CONVOLUTION;
+
+        try {
+            auto& program = _outer.get_program();
+            gpu::kernel_runner runner(program.get_engine(), program.get_id(), weights_and_bias_exist, zero_points_exist);
+            return runner.run_kernels({_kernel_data}).front();
+        } catch (...) {
+            return std::chrono::nanoseconds::max();
+        }
+    }
+
 protected:
     virtual bool optimized_out(typed_primitive_inst<PType>&) const { return false; }
 
@@ -14,6 +14,7 @@ namespace ocl {
 void register_implementations() {
     REGISTER_OCL(activation);
     REGISTER_OCL(arg_max_min);
+    REGISTER_OCL(attention);
     REGISTER_OCL(average_unpooling);
     REGISTER_OCL(binary_convolution);
     REGISTER_OCL(border);
@@ -34,6 +35,7 @@ void register_implementations() {
     REGISTER_OCL(gather_elements);
     REGISTER_OCL(gather_nd);
     REGISTER_OCL(gemm);
+    REGISTER_OCL(layer_norm);
     REGISTER_OCL(lrn);
     REGISTER_OCL(lstm_gemm);
     REGISTER_OCL(lstm_elt);
@@ -7,6 +7,7 @@
 
 #include "cldnn/primitives/activation.hpp"
 #include "cldnn/primitives/arg_max_min.hpp"
+#include "cldnn/primitives/attention.hpp"
 #include "cldnn/primitives/average_unpooling.hpp"
 #include "cldnn/primitives/batch_to_space.hpp"
 #include "cldnn/primitives/binary_convolution.hpp"
@@ -25,6 +26,7 @@
 #include "cldnn/primitives/gather_nd.hpp"
 #include "cldnn/primitives/gather_elements.hpp"
 #include "cldnn/primitives/gemm.hpp"
+#include "cldnn/primitives/layer_norm.hpp"
 #include "cldnn/primitives/lrn.hpp"
 #include "cldnn/primitives/lstm.hpp"
 #include "cldnn/primitives/lstm_dynamic.hpp"
@@ -78,6 +80,7 @@ namespace detail {
 
 REGISTER_OCL(activation);
 REGISTER_OCL(arg_max_min);
+REGISTER_OCL(attention);
 REGISTER_OCL(average_unpooling);
 REGISTER_OCL(batch_to_space);
 REGISTER_OCL(binary_convolution);
@@ -100,6 +103,7 @@ REGISTER_OCL(gather);
 REGISTER_OCL(gather_nd);
 REGISTER_OCL(gather_elements);
 REGISTER_OCL(gemm);
+REGISTER_OCL(layer_norm);
 REGISTER_OCL(lrn);
 REGISTER_OCL(lstm_gemm);
 REGISTER_OCL(lstm_elt);
@@ -0,0 +1,76 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mvn_inst.h"
+#include "primitive_onednn_base.h"
+#include "impls/implementation_map.hpp"
+
+#include "kernel_selector_common.h"
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <algorithm>
+#include <memory>
+namespace cldnn {
+namespace onednn {
+
+struct mvn_onednn : typed_primitive_onednn_impl<mvn, dnnl::layer_normalization_forward::desc> {
+    using parent = typed_primitive_onednn_impl<mvn, dnnl::layer_normalization_forward::desc>;
+    using parent::parent;
+
+protected:
+    std::unique_ptr<primitive_impl> clone() const override {
+        return make_unique<mvn_onednn>(*this);
+    }
+
+    // oneDNN layer normalization computes statistics over the last logical axis only, so the plain
+    // input is viewed as [b, f, spatials] or as [b, f * spatials] when mean is computed across channels
+    static std::shared_ptr<dnnl::layer_normalization_forward::desc> get_mvn_descriptor(const mvn_node& arg) {
+        auto prim = arg.get_primitive();
+
+        if (!prim->normalize_variance || !prim->eps_inside_sqrt)
+            throw std::runtime_error("oneDNN layer normalization supports only (x - mean) / sqrt(variance + eps) mode of mvn");
+
+        auto input_layout = arg.get_dependency(0).get_output_layout();
+        dnnl::memory::dim batch = input_layout.size.batch[0];
+        dnnl::memory::dim feature = input_layout.size.feature[0];
+        dnnl::memory::dim spatials = input_layout.size.count() / (batch * feature);
+
+        dnnl::memory::desc data_md = prim->across_channels
+            ? dnnl::memory::desc({batch, feature * spatials}, onednn::convert_data_type(input_layout.data_type), dnnl::memory::format_tag::ab)
+            : dnnl::memory::desc({batch, feature, spatials}, onednn::convert_data_type(input_layout.data_type), dnnl::memory::format_tag::abc);
+
+        return std::make_shared<dnnl::layer_normalization_forward::desc>(
+            dnnl::prop_kind::forward_inference,
+            data_md,
+            prim->epsilon,
+            dnnl::normalization_flags::none);
+    }
+
+public:
+    static primitive_impl* create(const mvn_node& arg) {
+        auto& engine = arg.get_program().get_engine();
+        auto desc = get_mvn_descriptor(arg);
+        auto attr = get_primitive_attributes(arg);
+        dnnl::primitive_desc prim_desc{&desc->data, attr.get(), engine.get_onednn_engine(), nullptr};
+
+        return new mvn_onednn(arg, desc, attr, prim_desc);
+    }
+};
+
+namespace detail {
+
+attach_mvn_onednn::attach_mvn_onednn() {
+    implementation_map<mvn>::add(impl_types::onednn, mvn_onednn::create, {
+        std::make_tuple(data_types::f32, format::bfyx),
+        std::make_tuple(data_types::f16, format::bfyx),
+
+        std::make_tuple(data_types::f32, format::bfzyx),
+        std::make_tuple(data_types::f16, format::bfzyx),
+    });
+}
+
+}  // namespace detail
+}  // namespace onednn
+}  // namespace cldnn
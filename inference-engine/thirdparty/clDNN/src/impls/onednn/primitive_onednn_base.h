@@ -16,6 +16,7 @@
 #include "reorder/reorder_weights_kernel_selector.h"
 #include "reorder/reorder_kernel_base.h"
 
+#include <chrono>
 #include <vector>
 #include <list>
 #include <utility>
@@ -78,6 +79,40 @@ struct typed_primitive_onednn_impl : public typed_primitive_impl<PType> {
 
     bool is_cpu() const override { return false; }
 
+    std::chrono::nanoseconds measure_execution_time() const override {
+        // oneDNN doesn't expose device events, so the wall time of back-to-back runs on a separate stream is used
+        const int runs = 15;
+        try {
+            auto& onednn_engine = _outer.get_program().get_engine().get_onednn_engine();
+            dnnl::stream stream(onednn_engine);
+
+            std::vector<int> arg_ids = { DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_BIAS, DNNL_ARG_DST, DNNL_ARG_SCRATCHPAD,
+                                         DNNL_ARG_ATTR_OUTPUT_SCALES, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC };
+            for (int i = 0; i < _attrs->get_post_ops().len(); i++)
+                arg_ids.push_back(DNNL_ARG_ATTR_MULTIPLE_POST_OP(i) | DNNL_ARG_SRC_1);
+
+            std::unordered_map<int, dnnl::memory> args;
+            for (auto arg_id : arg_ids) {
+                auto md = _pd.query_md(dnnl::query::exec_arg_md, arg_id);
+                if (md.get_size() != 0)
+                    args.insert({arg_id, dnnl::memory(md, onednn_engine)});
+            }
+
+            _prim.execute(stream, args);
+            stream.wait();
+
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < runs; i++)
+                _prim.execute(stream, args);
+            stream.wait();
+            auto time = std::chrono::high_resolution_clock::now() - start;
+
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(time) / runs;
+        } catch (...) {
+            return std::chrono::nanoseconds::max();
+        }
+    }
+
 protected:
     virtual bool optimized_out(typed_primitive_inst<PType>&) const { return false; }
 
@@ -13,10 +13,14 @@ namespace onednn {
 void register_implementations() {
     REGISTER_ONEDNN_IMPL(convolution);
     REGISTER_ONEDNN_IMPL(concatenation);
+    REGISTER_ONEDNN_IMPL(deconvolution);
     REGISTER_ONEDNN_IMPL(eltwise);
     REGISTER_ONEDNN_IMPL(gemm);
+    REGISTER_ONEDNN_IMPL(mvn);
     REGISTER_ONEDNN_IMPL(pooling);
+    REGISTER_ONEDNN_IMPL(reduce);
     REGISTER_ONEDNN_IMPL(reorder);
+    REGISTER_ONEDNN_IMPL(softmax);
     REGISTER_ONEDNN_IMPL(fully_connected);}
 
 }  // namespace onednn
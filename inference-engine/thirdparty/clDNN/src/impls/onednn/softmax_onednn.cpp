@@ -0,0 +1,83 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "softmax_inst.h"
+#include "primitive_onednn_base.h"
+#include "impls/implementation_map.hpp"
+
+#include "kernel_selector_common.h"
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <algorithm>
+#include <memory>
+namespace cldnn {
+namespace onednn {
+
+struct softmax_onednn : typed_primitive_onednn_impl<softmax, dnnl::softmax_forward::desc> {
+    using parent = typed_primitive_onednn_impl<softmax, dnnl::softmax_forward::desc>;
+    using parent::parent;
+
+protected:
+    std::unique_ptr<primitive_impl> clone() const override {
+        return make_unique<softmax_onednn>(*this);
+    }
+
+    static int get_softmax_axis(const softmax_node& arg, size_t rank) {
+        switch (arg.get_primitive()->dimension) {
+            case softmax::normalize_f: return 1;
+            case softmax::normalize_z: return 2;
+            case softmax::normalize_y: return static_cast<int>(rank) - 2;
+            case softmax::normalize_x: return static_cast<int>(rank) - 1;
+            default: throw std::runtime_error("unsupported softmax dimension");
+        }
+    }
+
+    static std::shared_ptr<dnnl::softmax_forward::desc> get_softmax_descriptor(const softmax_node& arg) {
+        auto& input = arg.get_dependency(0);
+
+        auto input_md = onednn::layout_to_memory_desc(input.get_output_layout());
+        auto axis = get_softmax_axis(arg, input_md.dims().size());
+
+        return std::make_shared<dnnl::softmax_forward::desc>(
+            dnnl::prop_kind::forward_inference,
+            input_md,
+            axis);
+    }
+
+public:
+    static primitive_impl* create(const softmax_node& arg) {
+        auto& engine = arg.get_program().get_engine();
+        auto desc = get_softmax_descriptor(arg);
+        auto attr = get_primitive_attributes(arg);
+        dnnl::primitive_desc prim_desc{&desc->data, attr.get(), engine.get_onednn_engine(), nullptr};
+
+        return new softmax_onednn(arg, desc, attr, prim_desc);
+    }
+};
+
+namespace detail {
+
+attach_softmax_onednn::attach_softmax_onednn() {
+    implementation_map<softmax>::add(impl_types::onednn, softmax_onednn::create, {
+        std::make_tuple(data_types::f32, format::bfyx),
+        std::make_tuple(data_types::f16, format::bfyx),
+
+        std::make_tuple(data_types::f32, format::b_fs_yx_fsv16),
+        std::make_tuple(data_types::f16, format::b_fs_yx_fsv16),
+
+        std::make_tuple(data_types::f32, format::b_fs_yx_fsv32),
+        std::make_tuple(data_types::f16, format::b_fs_yx_fsv32),
+
+        std::make_tuple(data_types::f32, format::bs_fs_yx_bsv16_fsv16),
+        std::make_tuple(data_types::f16, format::bs_fs_yx_bsv16_fsv16),
+
+        std::make_tuple(data_types::f32, format::bs_fs_yx_bsv32_fsv32),
+        std::make_tuple(data_types::f16, format::bs_fs_yx_bsv32_fsv32),
+    });
+}
+
+}  // namespace detail
+}  // namespace onednn
+}  // namespace cldnn
@@ -0,0 +1,46 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "cldnn/primitives/attention.hpp"
+#include "primitive_inst.h"
+
+#include <string>
+
+namespace cldnn {
+
+template <>
+struct typed_program_node<attention> : public typed_program_node_base<attention> {
+    using parent = typed_program_node_base<attention>;
+
+public:
+    using parent::parent;
+
+    program_node& input() const { return get_dependency(0); }
+    program_node& query() const { return get_dependency(0); }
+    program_node& key() const { return get_dependency(1); }
+    program_node& value() const { return get_dependency(2); }
+    program_node& mask() const { return get_dependency(3); }
+
+    bool has_mask() const { return get_primitive()->input.size() == 4; }
+};
+
+using attention_node = typed_program_node<attention>;
+
+template <>
+class typed_primitive_inst<attention> : public typed_primitive_inst_base<attention> {
+    using parent = typed_primitive_inst_base<attention>;
+
+public:
+    static layout calc_output_layout(attention_node const& node);
+    static std::string to_string(attention_node const& node);
+
+public:
+    typed_primitive_inst(network& network, attention_node const& node);
+};
+
+using attention_inst = typed_primitive_inst<attention>;
+
+}  // namespace cldnn
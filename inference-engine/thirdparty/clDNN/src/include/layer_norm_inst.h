@@ -0,0 +1,45 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "cldnn/primitives/layer_norm.hpp"
+#include "primitive_inst.h"
+
+#include <string>
+
+namespace cldnn {
+
+template <>
+struct typed_program_node<layer_norm> : public typed_program_node_base<layer_norm> {
+    using parent = typed_program_node_base<layer_norm>;
+
+public:
+    using parent::parent;
+
+    program_node& input() const { return get_dependency(0); }
+    program_node& gamma() const { return get_dependency(1); }
+    program_node& beta() const { return get_dependency(2); }
+    program_node& residual() const { return get_dependency(3); }
+
+    bool has_residual() const { return !get_primitive()->residual.empty(); }
+};
+
+using layer_norm_node = typed_program_node<layer_norm>;
+
+template <>
+class typed_primitive_inst<layer_norm> : public typed_primitive_inst_base<layer_norm> {
+    using parent = typed_primitive_inst_base<layer_norm>;
+
+public:
+    static layout calc_output_layout(layer_norm_node const& node);
+    static std::string to_string(layer_norm_node const& node);
+
+public:
+    typed_primitive_inst(network& network, layer_norm_node const& node);
+};
+
+using layer_norm_inst = typed_primitive_inst<layer_norm>;
+
+}  // namespace cldnn
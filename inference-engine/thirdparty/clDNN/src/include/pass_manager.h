@@ -18,6 +18,8 @@
 #include <list>
 #include <utility>
 #include <set>
+#include <unordered_map>
+#include <algorithm>
 #include <functional>
 
 #include <fstream>
@@ -191,6 +193,8 @@ public:
 private:
     void run(program& p) override;
     void fuse_sigmoid_mul_to_swish(program &p);
+    void fuse_attention(program &p);
+    void fuse_layer_norm(program &p);
     void fuse_bias(program &p);
     void fuse_reorders(program& p);
     void fuse_activations(program& p);
@@ -348,12 +352,102 @@ public:
     void run(program& p) override;
 };
 
+class bits_64 {
+public:
+    explicit bits_64(size_t size, bool set = false) : storage((size / 64) + 1, (set ? ~0ULL : 0ULL)) {}
+    bool is_set(size_t idx) const {
+        size_t storage_idx = idx >> 6;
+        uint64_t mask = 1ULL << (idx & 0x3F);
+        return storage[storage_idx] & mask;
+    }
+    void set(size_t idx) {
+        size_t storage_idx = idx >> 6;
+        uint64_t mask = 1ULL << (idx & 0x3F);
+        storage[storage_idx] |= mask;
+    }
+    bool _or(const bits_64& that) {
+        bool changed = false;
+        size_t sz = std::min(storage.size(), that.storage.size());
+        for (size_t i = 0; i < sz; i++) {
+            uint64_t myval = storage[i];
+            uint64_t thatval = myval | that.storage[i];
+            bool local_change = myval != thatval;
+            changed |= local_change;
+            if (local_change)
+                storage[i] = thatval;
+        }
+        return changed;
+    }
+    // calls func for the index of every set bit in the ascending order
+    template <typename Func>
+    void for_each_set(Func func) const {
+        for (size_t i = 0; i < storage.size(); i++) {
+            uint64_t word = storage[i];
+            for (size_t bit = 0; word != 0; bit++, word >>= 1) {
+                if (word & 1ULL)
+                    func((i << 6) + bit);
+            }
+        }
+    }
+
+protected:
+    std::vector<uint64_t> storage;
+};
+
+// Memory restrictions of the program nodes collected by the memory dependency passes:
+// every node has a bitmap row indexed by the processing order positions of the nodes it can't share buffer with.
+// The rows are converted to the primitive id sets of the nodes once all the passes are done.
+class memory_dependency_matrix {
+public:
+    explicit memory_dependency_matrix(program& p) {
+        for (auto node : p.get_processing_order()) {
+            indices[node] = nodes.size();
+            nodes.push_back(node);
+        }
+        rows.assign(nodes.size(), bits_64(nodes.size()));
+    }
+
+    size_t size() const { return nodes.size(); }
+    program_node* get_node(size_t idx) const { return nodes[idx]; }
+    // returns size() for the nodes outside of the processing order
+    size_t get_index(program_node* node) const {
+        auto it = indices.find(node);
+        return it == indices.end() ? nodes.size() : it->second;
+    }
+
+    void add(program_node* node, program_node* dep) {
+        size_t node_idx = get_index(node);
+        size_t dep_idx = get_index(dep);
+        if (node_idx == nodes.size() || dep_idx == nodes.size()) {
+            node->add_memory_dependency(dep->id());
+            return;
+        }
+        rows[node_idx].set(dep_idx);
+    }
+    void add(size_t node_idx, size_t dep_idx) { rows[node_idx].set(dep_idx); }
+
+    void apply() const {
+        for (size_t i = 0; i < nodes.size(); i++) {
+            std::vector<primitive_id> deps;
+            rows[i].for_each_set([&](size_t idx) { deps.push_back(nodes[idx]->id()); });
+            if (!deps.empty())
+                nodes[i]->add_memory_dependency(std::move(deps));
+        }
+    }
+
+private:
+    std::vector<program_node*> nodes;
+    std::unordered_map<program_node*, size_t> indices;
+    std::vector<bits_64> rows;
+};
+
 class memory_dependency_pass : public base_pass {
 public:
-    explicit memory_dependency_pass(const std::string& pass_name) : base_pass(pass_name) {}
+    memory_dependency_pass(const std::string& pass_name, memory_dependency_matrix& deps)
+        : base_pass(pass_name), memory_deps(deps) {}
     void add_memory_dependency(program_node* node, program_node* dep) {
         if (node->can_be_optimized() || !dep->can_be_optimized()) {
-            node->add_memory_dependency(dep->id());
+            memory_deps.add(node, dep);
         } else {
             if (node->id() == dep->id()) {
                 return;
@@ -364,23 +458,29 @@ public:
             }
         }
     }
+
+protected:
+    memory_dependency_matrix& memory_deps;
 };
 
 class basic_memory_dependencies : public memory_dependency_pass {
 public:
-    basic_memory_dependencies() : memory_dependency_pass("basic_memory_dependencies") {}
+    explicit basic_memory_dependencies(memory_dependency_matrix& deps)
+        : memory_dependency_pass("basic_memory_dependencies", deps) {}
     void run(program& p) override;
 };
 
 class skipped_branch_memory_dependencies : public memory_dependency_pass {
 public:
-    skipped_branch_memory_dependencies() : memory_dependency_pass("skipped_branch_memory_dependencies") {}
+    explicit skipped_branch_memory_dependencies(memory_dependency_matrix& deps)
+        : memory_dependency_pass("skipped_branch_memory_dependencies", deps) {}
     void run(program& p) override;
 };
 
 class oooq_memory_dependencies : public memory_dependency_pass {
 public:
-    oooq_memory_dependencies() : memory_dependency_pass("oooq_memory_dependencies") {}
+    explicit oooq_memory_dependencies(memory_dependency_matrix& deps)
+        : memory_dependency_pass("oooq_memory_dependencies", deps) {}
     void run(program& p) override;
 };
 
@@ -15,6 +15,7 @@
 #include "program_node.h"
 #include "primitive_type.h"
 
+#include <chrono>
 #include <memory>
 #include <vector>
 #include <string>
@@ -57,6 +58,10 @@ struct primitive_impl {
     virtual bool is_cpu() const { return true; }
     virtual void init_kernels() = 0;
     virtual std::unique_ptr<primitive_impl> clone() const = 0;
+    // key of the parameters of implemented operation, empty if the implementation doesn't provide it
+    virtual std::string get_params_key() const { return {}; }
+    // execution time of the implementation on the device with dummy buffers, max() if it can't be measured
+    virtual std::chrono::nanoseconds measure_execution_time() const { return std::chrono::nanoseconds::max(); }
 
 protected:
     std::string _kernel_name;
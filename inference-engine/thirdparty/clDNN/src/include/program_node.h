@@ -115,7 +115,7 @@ public:
     void remove_dependency(size_t idx);
     void remove_dependency(program_node& node);
 
-    std::set<primitive_id> get_memory_dependencies() const;
+    const std::set<primitive_id>& get_memory_dependencies() const;
     void add_memory_dependency(primitive_id);
     void add_memory_dependency(std::vector<primitive_id>);
 
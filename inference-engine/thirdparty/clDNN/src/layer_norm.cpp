@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "layer_norm_inst.h"
+#include "primitive_type_base.h"
+#include "cldnn/runtime/error_handler.hpp"
+#include "json_object.h"
+#include <string>
+
+namespace cldnn {
+primitive_type_id layer_norm::type_id() {
+    static primitive_type_base<layer_norm> instance;
+    return &instance;
+}
+
+layout layer_norm_inst::calc_output_layout(layer_norm_node const& node) {
+    auto prim = node.get_primitive();
+    auto input_layout = node.input().get_non_padded_output_layout();
+    auto output_type = prim->output_data_type ? *prim->output_data_type : input_layout.data_type;
+
+    return layout(output_type, input_layout.format, input_layout.size, prim->output_padding);
+}
+
+std::string layer_norm_inst::to_string(layer_norm_node const& node) {
+    auto desc = node.get_primitive();
+    auto node_info = node.desc_to_json();
+    std::stringstream primitive_description;
+
+    json_composite layer_norm_info;
+    layer_norm_info.add("input id", node.input().id());
+    layer_norm_info.add("residual id", node.has_residual() ? node.residual().id() : "none");
+    layer_norm_info.add("gamma id", node.gamma().id());
+    layer_norm_info.add("beta id", node.beta().id());
+    layer_norm_info.add("epsilon", desc->epsilon);
+    layer_norm_info.add("eps_inside_sqrt", desc->eps_inside_sqrt ? "true" : "false");
+    node_info->add("layer_norm info", layer_norm_info);
+    node_info->dump(primitive_description);
+
+    return primitive_description.str();
+}
+
+layer_norm_inst::typed_primitive_inst(network& network, layer_norm_node const& node) : parent(network, node) {
+    auto input_size = node.input().get_output_layout().size;
+    auto norm_size = input_size;
+    norm_size.batch[0] = 1;
+    norm_size.feature[0] = 1;
+
+    if (node.has_residual()) {
+        CLDNN_ERROR_BOOL(node.id(),
+                         "Residual size",
+                         node.residual().get_output_layout().size != input_size,
+                         "Residual should have the same size as the input");
+    }
+    CLDNN_ERROR_BOOL(node.id(),
+                     "Gamma size",
+                     node.gamma().get_output_layout().size != norm_size,
+                     "Gamma should have the size of the normalized dimensions of the input");
+    CLDNN_ERROR_BOOL(node.id(),
+                     "Beta size",
+                     node.beta().get_output_layout().size != norm_size,
+                     "Beta should have the size of the normalized dimensions of the input");
+}
+}  // namespace cldnn
@@ -18,6 +18,8 @@
 #include "permute_inst.h"
 #include "quantize_inst.h"
 #include "mvn_inst.h"
+#include "reduce_inst.h"
+#include "softmax_inst.h"
 #include <vector>
 #include <memory>
 #include <utility>
@@ -1039,6 +1041,89 @@ impl_types layout_optimizer::get_preferred_impl_type(program_node& node, format
         // }
 
         preferred_impl = impl_candidate;
+    } else if (node.is_type<deconvolution>()) {
+        if (!_optimization_attributes.use_onednn_impls)
+            return impl_types::ocl;
+
+        std::vector<format> onednn_optimized_formats = {
+            format::b_fs_yx_fsv16,
+            format::b_fs_yx_fsv32,
+            format::bs_fs_yx_bsv16_fsv16,
+            format::bs_fs_yx_bsv32_fsv32,
+        };
+
+        auto& deconv = node.as<deconvolution>();
+        auto input_layout = deconv.input().get_output_layout();
+        bool valid_format = std::find(onednn_optimized_formats.begin(), onednn_optimized_formats.end(), preferred_format) !=
+                            onednn_optimized_formats.end();
+        bool valid_ic = input_layout.size.feature[0] >= 16;
+        bool valid_groups = deconv.get_primitive()->groups == 1 && !deconv.get_primitive()->grouped_weights_shape;
+        bool valid_post_ops = get_post_ops_count(node) <= 10;
+        bool valid_batch = input_layout.size.batch[0] < 16;  // oneDNNs optimized kernel doesn't support big batches yet
+
+        impl_types impl_candidate = impl_types::onednn;
+        if (!valid_format || !valid_ic || !valid_groups || !valid_post_ops || !valid_batch)
+            impl_candidate = impl_types::ocl;
+
+        // OneDNN doesn't support sum post ops for deconvolutions
+        for (auto& fused_op : node.get_fused_primitives()) {
+            if (fused_op.node->is_type<eltwise>() && fused_op.deps.size() == 1) {
+                auto eltw_in_layout = node.get_dependency(fused_op.dep_start_idx).get_output_layout();
+                if (fused_op.node->as<eltwise>().get_primitive()->needs_onednn_sum_post_op(eltw_in_layout)) {
+                    impl_candidate = impl_types::ocl;
+                    break;
+                }
+            }
+        }
+
+        preferred_impl = impl_candidate;
+    } else if (node.is_type<softmax>() || node.is_type<reduce>() || node.is_type<mvn>()) {
+        if (!_optimization_attributes.use_onednn_impls)
+            return impl_types::ocl;
+
+        auto input_layout = node.get_dependency(0).get_output_layout();
+        auto output_layout = node.get_output_layout();
+
+        preferred_impl = impl_types::onednn;
+
+        // onednn doesn't support paddings and post-ops are not passed to these primitives
+        if (input_layout.data_padding || output_layout.data_padding || node.has_fused_primitives()) {
+            preferred_impl = impl_types::ocl;
+        }
+
+        if (node.is_type<softmax>()) {
+            // onednn softmax normalizes along a single axis and writes the output in the input layout
+            auto dimension = node.as<softmax>().get_primitive()->dimension;
+            if ((dimension != softmax::normalize_f && dimension != softmax::normalize_y && dimension != softmax::normalize_x) ||
+                input_layout.format != output_layout.format || input_layout.data_type != output_layout.data_type) {
+                preferred_impl = impl_types::ocl;
+            }
+        } else if (node.is_type<reduce>()) {
+            std::vector<reduce_mode> onednn_supported_modes = {
+                reduce_mode::max,
+                reduce_mode::min,
+                reduce_mode::mean,
+                reduce_mode::prod,
+                reduce_mode::sum,
+                reduce_mode::sum_square,
+                reduce_mode::l1,
+                reduce_mode::l2,
+            };
+
+            auto prim = node.as<reduce>().get_primitive();
+            if (!prim->keep_dims || input_layout.format.dimension() != output_layout.format.dimension() ||
+                std::find(onednn_supported_modes.begin(), onednn_supported_modes.end(), prim->mode) == onednn_supported_modes.end()) {
+                preferred_impl = impl_types::ocl;
+            }
+        } else {
+            // onednn layer normalization is used, so only plain layouts and division by the standard deviation are supported
+            auto prim = node.as<mvn>().get_primitive();
+            if (!prim->normalize_variance || !prim->eps_inside_sqrt ||
+                (input_layout.format != format::bfyx && input_layout.format != format::bfzyx) ||
+                input_layout.format != output_layout.format || input_layout.data_type != output_layout.data_type) {
+                preferred_impl = impl_types::ocl;
+            }
+        }
     } else if (node.is_type<concatenation>()) {
         if (!_optimization_attributes.use_onednn_impls)
             return impl_types::ocl;
@@ -7,6 +7,7 @@
 #include "cldnn/primitives/data.hpp"
 #include "cldnn/primitives/mutable_data.hpp"
 #include "cldnn/primitives/input_layout.hpp"
+#include "cldnn/primitives/prior_box.hpp"
 
 #include "cldnn/runtime/error_handler.hpp"
 #include "cldnn/runtime/memory.hpp"
@@ -21,6 +22,7 @@
 #include "to_string_utils.h"
 #include "primitive_inst.h"
 #include "input_layout_inst.h"
+#include "data_inst.h"
 #include "mutable_data_inst.h"
 #include "condition_inst.h"
 #include "loop_inst.h"
@@ -43,6 +45,55 @@
 
 namespace cldnn {
 
+namespace {
+// networks which keep changing their buffers are executed without recording after this number of attempts
+constexpr size_t max_recordings_count = 4;
+
+// Ordered by priority: a buffer shared with a constant or a network input/output is attributed to it
+enum class memory_category { intermediates, inputs_outputs, weights };
+
+struct buffer_record {
+    size_t index;
+    uint64_t bytes;
+    memory_category category;
+};
+
+// Groups device buffers of the primitives by the memory handle, so buffers shared via the memory pool, in-place
+// optimizations or reinterpretation are taken into account once
+std::map<primitive_id, buffer_record*> collect_buffer_records(const program& program,
+                                                              const std::map<primitive_id, std::shared_ptr<primitive_inst>>& primitives,
+                                                              std::vector<std::unique_ptr<buffer_record>>& records) {
+    std::map<shared_handle, buffer_record*> handles;
+    std::map<primitive_id, buffer_record*> result;
+    for (auto node : program.get_processing_order()) {
+        auto prim = primitives.find(node->id());
+        if (prim == primitives.end() || prim->second->output_memory_ptr() == nullptr)
+            continue;
+
+        auto mem = prim->second->output_memory_ptr();
+        auto handle = mem->get_internal_params().mem;
+        if (handle == nullptr)
+            continue;  // host memory attached by the user
+
+        auto category = memory_category::intermediates;
+        if (node->is_type<data>())
+            category = memory_category::weights;
+        else if (node->is_type<input_layout>() || node->is_output())
+            category = memory_category::inputs_outputs;
+
+        auto& record = handles[handle];
+        if (record == nullptr) {
+            records.emplace_back(new buffer_record{records.size(), 0, category});
+            record = records.back().get();
+        }
+        record->bytes = std::max<uint64_t>(record->bytes, mem->size());
+        record->category = std::max(record->category, category);
+        result[node->id()] = record;
+    }
+    return result;
+}
+}  // namespace
+
 #ifdef GPU_DEBUG_CONFIG
 static float convert_half_to_float(half_t val, bool flush_denorm_to_zero = false) {
 #if defined HALF_HALF_HPP
@@ -219,6 +270,8 @@ network::network(program::ptr program, stream::ptr stream, bool is_internal, boo
     build_exec_order();
     validate_primitives();
     add_default_output_chains();
+    _recordable = is_recordable();
+    assign_exec_queues();
 }
 
 network::network(engine& engine,
@@ -531,6 +584,88 @@ void network::build_exec_order() {
         }
     }
 }
+bool network::is_recordable() const {
+    GPU_DEBUG_GET_INSTANCE(debug_config);
+    GPU_DEBUG_IF(debug_config->dump_layers_path.length() > 0) {
+        return false;
+    }
+    if (_internal || get_engine().configuration().enable_profiling || !get_stream().supports_recording() ||
+        get_stream().get_queues_count() > 1)
+        return false;
+
+    // host side primitives and oneDNN ones don't submit their work through stream kernels
+    for (auto& inst : _exec_order) {
+        const auto& node = inst->get_node();
+        if (node.is_type<input_layout>() || node.is_type<prior_box>())
+            continue;
+        if (!inst->get_impl() || inst->get_impl()->is_cpu() || node.get_preferred_impl_type() == impl_types::onednn)
+            return false;
+    }
+    return true;
+}
+
+void network::assign_exec_queues() {
+    const size_t queues_count = get_stream().get_queues_count();
+    if (_internal || queues_count < 2)
+        return;
+
+    // oneDNN primitives are submitted to the main queue without event dependencies
+    for (auto& inst : _exec_order) {
+        if (inst->get_node().get_preferred_impl_type() == impl_types::onednn)
+            return;
+    }
+
+    // A primitive continues the queue of its dependency if that dependency is the last primitive of the queue,
+    // otherwise it starts a new branch on the next queue. Cross-queue dependencies are resolved by events.
+    std::unordered_map<const primitive_inst*, size_t> inst_queue;
+    std::vector<const primitive_inst*> queue_tails(queues_count, nullptr);
+    size_t next_queue = 0;
+    _exec_queues.reserve(_exec_order.size());
+    for (auto& inst : _exec_order) {
+        size_t queue = queues_count;
+        for (auto& dep : inst->dependencies()) {
+            auto it = inst_queue.find(dep.get());
+            if (it != inst_queue.end() && queue_tails[it->second] == dep.get()) {
+                queue = it->second;
+                break;
+            }
+        }
+        if (queue == queues_count) {
+            queue = next_queue;
+            next_queue = (next_queue + 1) % queues_count;
+        }
+        inst_queue[inst.get()] = queue;
+        queue_tails[queue] = inst.get();
+        _exec_queues.push_back(queue);
+    }
+}
+
+std::vector<memory::ptr> network::get_kernel_memory() const {
+    std::vector<memory::ptr> mem;
+    for (auto& inst : _exec_order) {
+        mem.push_back(inst->output_memory_ptr());
+        for (size_t i = 0; i < inst->dependencies().size(); i++)
+            mem.push_back(inst->dep_memory_ptr(i));
+    }
+    return mem;
+}
+
+bool network::is_recording_valid() const {
+    if (!_recordable || _recording_id == 0 || get_stream().get_recording_id() != _recording_id)
+        return false;
+
+    // kernels keep the arguments set at recording time, so any buffer substitution requires new recording
+    auto mem = get_kernel_memory();
+    if (mem.size() != _recorded_memory.size())
+        return false;
+    auto& engine = get_engine();
+    for (size_t i = 0; i < mem.size(); i++) {
+        if (mem[i] != _recorded_memory[i] && (!mem[i] || !_recorded_memory[i] || !engine.is_the_same_buffer(*mem[i], *_recorded_memory[i])))
+            return false;
+    }
+    return true;
+}
+
 void network::add_to_exec_order(const primitive_id& id) {
     auto inst = get_primitive(id);
     _exec_order.push_back(inst);
@@ -568,45 +703,77 @@ void network::execute_impl(const std::vector<event::ptr>& events) {
 
     set_arguments();
 
-    for (auto& inst : _exec_order) {
-        GPU_DEBUG_IF(debug_config->dump_layers_path.length() > 0) {
-            auto& node = _program->get_node(inst->id());
-            std::string layer_name = node.id();
-            GPU_DEBUG_IF(debug_config->verbose >= 2) {
-                std::cerr << get_primitive_info(inst->id()) << std::endl;
+    const bool replay = is_recording_valid();
+    const bool record = !replay && _recordable && _recordings_count < max_recordings_count;
+    if (!replay) {
+        if (record)
+            get_stream().begin_recording();
+
+        // branch queues must not start before the inputs are ready and the previous execution is completed
+        if (!_exec_queues.empty())
+            get_stream().sync_queues();
+
+        auto exec_queue = _exec_queues.begin();
+        for (auto& inst : _exec_order) {
+            GPU_DEBUG_IF(debug_config->dump_layers_path.length() > 0) {
+                auto& node = _program->get_node(inst->id());
+                std::string layer_name = node.id();
+                GPU_DEBUG_IF(debug_config->verbose >= 2) {
+                    std::cerr << get_primitive_info(inst->id()) << std::endl;
+                }
+
+                GPU_DEBUG_IF(debug_config->dump_layers_dst_only == 0 &&
+                                (debug_config->dump_layers.length() == 0 ||
+                                (debug_config->dump_layers.length() != 0 && debug_config->dump_layers.find(" " + layer_name + " ") != std::string::npos))) {
+                    std::cout << "Dump " << layer_name << " layer src" << std::endl;
+                    for (size_t i = 0; i < get_primitive(inst->id())->dependencies().size(); i++) {
+                        log_memory_to_file(get_primitive(inst->id())->dep_memory_ptr(i), get_stream(),
+                                        layer_name + "_src_" + std::to_string(i));
+                    }
+                }
             }
 
-            GPU_DEBUG_IF(debug_config->dump_layers_dst_only == 0 &&
-                            (debug_config->dump_layers.length() == 0 ||
-                            (debug_config->dump_layers.length() != 0 && debug_config->dump_layers.find(" " + layer_name + " ") != std::string::npos))) {
-                std::cout << "Dump " << layer_name << " layer src" << std::endl;
-                for (size_t i = 0; i < get_primitive(inst->id())->dependencies().size(); i++) {
-                    log_memory_to_file(get_primitive(inst->id())->dep_memory_ptr(i), get_stream(),
-                                    layer_name + "_src_" + std::to_string(i));
+            GPU_DEBUG_IF(debug_config->verbose >= 1) {
+                GPU_DEBUG_COUT << "Execute " << inst->id() << std::endl;
+            }
+
+            // If a node has mutable input or it's an output, then the input/output buffers might be changed
+            // So we need to set arguments on each execution.
+            if (inst->has_mutable_input() || inst->is_output()) {
+                inst->set_arguments();
+            }
+            if (exec_queue != _exec_queues.end())
+                get_stream().set_queue_index(*exec_queue++);
+            execute_primitive(inst, events);
+
+            GPU_DEBUG_IF(debug_config->dump_layers_path.length() > 0) {
+                get_stream().finish();
+                auto& node = _program->get_node(inst->id());
+                std::string layer_name = node.id();
+                GPU_DEBUG_IF(debug_config->dump_layers.length() == 0 ||
+                            (debug_config->dump_layers.length() != 0 && debug_config->dump_layers.find(" " + layer_name + " ") != std::string::npos)) {
+                    std::cout << "Dump " << layer_name << " layer dst" << std::endl;
+                    log_memory_to_file(get_primitive(inst->id())->output_memory_ptr(), get_stream(), layer_name + "_dst_0");
                 }
             }
         }
-
-        GPU_DEBUG_IF(debug_config->verbose >= 1) {
-            GPU_DEBUG_COUT << "Execute " << inst->id() << std::endl;
+        if (!_exec_queues.empty()) {
+            get_stream().set_queue_index(0);
+            get_stream().sync_queues();
         }
 
-        // If a node has mutable input or it's an output, then the input/output buffers might be changed
-        // So we need to set arguments on each execution.
-        if (inst->has_mutable_input() || inst->is_output()) {
-            inst->set_arguments();
+        if (record) {
+            _recording_id = get_stream().end_recording();
+            _recorded_memory = get_kernel_memory();
+            _recordings_count++;
         }
-        execute_primitive(inst, events);
-
-        GPU_DEBUG_IF(debug_config->dump_layers_path.length() > 0) {
-            get_stream().finish();
-            auto& node = _program->get_node(inst->id());
-            std::string layer_name = node.id();
-            GPU_DEBUG_IF(debug_config->dump_layers.length() == 0 ||
-                        (debug_config->dump_layers.length() != 0 && debug_config->dump_layers.find(" " + layer_name + " ") != std::string::npos)) {
-                std::cout << "Dump " << layer_name << " layer dst" << std::endl;
-                log_memory_to_file(get_primitive(inst->id())->output_memory_ptr(), get_stream(), layer_name + "_dst_0");
-            }
+    }
+
+    if (replay || record) {
+        // all the primitives are completed by the same submission
+        auto ev = get_stream().replay(events);
+        for (auto& inst : _exec_order) {
+            _events[inst->id()] = ev;
         }
     }
 
@@ -714,6 +881,31 @@ std::map<primitive_id, primitive_id> network::get_ext_id_mapping() const {
     return result;
 }
 
+network_memory_footprint network::get_memory_footprint() const {
+    std::vector<std::unique_ptr<buffer_record>> records;
+    collect_buffer_records(*_program, _primitives, records);
+
+    network_memory_footprint footprint;
+    for (auto& record : records) {
+        switch (record->category) {
+            case memory_category::weights: footprint.weights += record->bytes; break;
+            case memory_category::inputs_outputs: footprint.inputs_outputs += record->bytes; break;
+            default: footprint.intermediates += record->bytes; break;
+        }
+    }
+    footprint.kernels = _program->get_kernels_binaries_size();
+    return footprint;
+}
+
+std::map<primitive_id, primitive_memory_info> network::get_primitives_memory_info() const {
+    std::vector<std::unique_ptr<buffer_record>> records;
+    std::map<primitive_id, primitive_memory_info> result;
+    for (auto& prim : collect_buffer_records(*_program, _primitives, records)) {
+        result[prim.first] = primitive_memory_info{prim.second->index, prim.second->bytes};
+    }
+    return result;
+}
+
 std::shared_ptr<primitive_inst> network::get_primitive(const primitive_id& id) {
     if (!_primitives.count(id))
         allocate_primitive_instance(_program->get_node(id));
@@ -5,6 +5,7 @@
 #include "pass_manager.h"
 #include "program_dump_graph.h"
 #include "cldnn/graph/program.hpp"
+#include "runtime/cldnn_itt.hpp"
 
 #include <chrono>
 #include <ctime>
@@ -48,6 +49,7 @@ void pass_manager::run(program& p, base_pass& pass) {
     using ms = std::chrono::duration<double, std::ratio<1, 1000>>;
     using Time = std::chrono::high_resolution_clock;
 
+    OV_ITT_SCOPED_TASK(itt::domains::CLDNN, openvino::itt::handle("pass_manager::" + pass.get_name()));
     auto start = Time::now();
     pass.run(p);
     auto stop = Time::now();
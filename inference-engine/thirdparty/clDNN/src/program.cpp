@@ -72,6 +72,7 @@
 
 #include <algorithm>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <list>
 #include <map>
@@ -143,10 +144,12 @@ void program::init_primitives() {
 }
 
 void program::compile() {
+    OV_ITT_SCOPED_TASK(itt::domains::CLDNN, "ProgramImpl::Compile");
     _kernels_cache->build_all();
 }
 
 void program::init_kernels() {
+    OV_ITT_SCOPED_TASK(itt::domains::CLDNN, "ProgramImpl::InitKernels");
     for (auto& n : get_processing_order()) {
         if (n->get_selected_impl())
             n->get_selected_impl()->init_kernels();
@@ -170,6 +173,10 @@ kernel::ptr program::get_kernel(kernel_id id) {
     return _kernels_cache->get_kernel(id);
 }
 
+uint64_t program::get_kernels_binaries_size() const {
+    return _kernels_cache->get_binaries_size();
+}
+
 program::ptr program::build_program(engine& engine,
                                     const topology& topology,
                                     const build_options& options,
@@ -433,13 +440,21 @@ void program::build_program(bool is_internal) {
     {
 #endif
         prepare_memory_dependencies();
-        compile();
+        // Constant data upload doesn't depend on kernels, so it is done while kernels batches are being built
+        auto kernels_build = std::async(std::launch::async, [this] { compile(); });
+        if (!is_internal)
+            transfer_memory_to_device();
+        kernels_build.get();
         init_kernels();
     }
+#ifdef GPU_DEBUG_CONFIG
+    else if (!is_internal) {
+        transfer_memory_to_device();
+    }
+#endif
 
     if (!is_internal) {
         prim_info = get_current_stage_info();
-        transfer_memory_to_device();
     }
 
     cleanup();
@@ -459,7 +474,10 @@ void program::init_graph() {
     apply_opt_pass<mark_nodes>();
 }
 
-void program::run_graph_compilation() { apply_opt_pass<compile_graph>(); }
+void program::run_graph_compilation() {
+    OV_ITT_SCOPED_TASK(itt::domains::CLDNN, "ProgramImpl::RunGraphCompilation");
+    apply_opt_pass<compile_graph>();
+}
 
 void program::pre_optimize_graph(bool is_internal) {
     OV_ITT_SCOPED_TASK(itt::domains::CLDNN, "ProgramImpl::PreOptimizeGraph");
@@ -600,9 +618,15 @@ void program::mark_if_data_flow(program_node& node) {
 
 void program::transfer_memory_to_device() {
     OV_ITT_SCOPED_TASK(itt::domains::CLDNN, "ProgramImpl::TransferMemory");
-    if (!get_engine().supports_allocation(allocation_type::usm_device))
+    auto constants = get_engine().get_constants_cache();
+    const bool use_usm_device = get_engine().supports_allocation(allocation_type::usm_device);
+    if (!use_usm_device && !constants)
         return;
 
+    // Host buffers are kept alive until all copies are finished, so the transfers are not serialized
+    std::vector<memory::ptr> host_buffers;
+    // Buffers of this program which are shared with the programs built later, they are registered once filled
+    std::vector<std::pair<memory::ptr, size_t>> new_constants;
     for (auto& node : processing_order) {
         if (node->is_type<data>() && !node->need_lockable_memory()) {
             auto& data_node = node->as<data>();
@@ -616,8 +640,21 @@ void program::transfer_memory_to_device() {
                 throw std::invalid_argument(err_str);
             }
 
+            const bool transfer = use_usm_device &&
+                                  (alloc_type == allocation_type::usm_host || alloc_type == allocation_type::usm_shared);
+            size_t hash = 0;
+            if (constants) {
+                auto target_type = transfer ? allocation_type::usm_device : alloc_type;
+                auto shared_mem = constants->find(data_node.get_attached_memory_ptr(), target_type, get_stream(), hash);
+                if (shared_mem) {
+                    data_node.attach_memory(shared_mem);
+                    if (transfer)
+                        const_cast<memory::ptr&>(data_node.get_primitive()->mem).reset();
+                    continue;
+                }
+            }
 
-            if (alloc_type == allocation_type::usm_host || alloc_type == allocation_type::usm_shared) {
+            if (transfer) {
                 GPU_DEBUG_GET_INSTANCE(debug_config);
                 GPU_DEBUG_IF(debug_config->verbose >= 2) {
                     GPU_DEBUG_COUT << "[" << data_node.id() << ": constant]" << std::endl;
@@ -625,13 +662,19 @@ void program::transfer_memory_to_device() {
                 // Allocate and transfer memory
                 auto device_mem = mem.get_engine()->allocate_memory(data_node_layout, allocation_type::usm_device, false);
                 device_mem->copy_from(get_stream(), mem);
+                host_buffers.push_back(data_node.get_attached_memory_ptr());
                 data_node.attach_memory(device_mem);
                 const_cast<memory::ptr&>(data_node.get_primitive()->mem).reset();
-                // TODO: Do we need finish call here? Maybe call it in network::execute() ?
-                get_stream().finish();
             }
+
+            if (constants)
+                new_constants.emplace_back(data_node.get_attached_memory_ptr(), hash);
         }
     }
+    if (!host_buffers.empty())
+        get_stream().finish();
+    for (auto& constant : new_constants)
+        constants->add(constant.first, constant.second);
 }
 
 void program::cleanup() {
@@ -682,9 +725,11 @@ void program::prepare_memory_dependencies() {
     if (!get_engine().configuration().use_memory_pool)
         return;
 
-    apply_opt_pass<basic_memory_dependencies>();
-    apply_opt_pass<skipped_branch_memory_dependencies>();
-    apply_opt_pass<oooq_memory_dependencies>();
+    memory_dependency_matrix memory_deps(*this);
+    apply_opt_pass<basic_memory_dependencies>(memory_deps);
+    apply_opt_pass<skipped_branch_memory_dependencies>(memory_deps);
+    apply_opt_pass<oooq_memory_dependencies>(memory_deps);
+    memory_deps.apply();
 }
 
 std::string program::get_memory_dependencies_string() const {
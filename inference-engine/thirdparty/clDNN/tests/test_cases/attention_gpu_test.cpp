@@ -0,0 +1,153 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "test_utils.h"
+
+#include <cldnn/primitives/input_layout.hpp>
+#include <cldnn/primitives/attention.hpp>
+#include <cldnn/primitives/activation.hpp>
+#include <cldnn/primitives/data.hpp>
+#include <cldnn/primitives/eltwise.hpp>
+#include <cldnn/primitives/gemm.hpp>
+#include <cldnn/primitives/softmax.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+using namespace cldnn;
+using namespace ::tests;
+
+namespace {
+// query [b, f, m, d], key [b, f, n, d], value [b, f, n, dv], mask [n]
+std::vector<float> attention_ref(const std::vector<float>& query, const std::vector<float>& key,
+                                 const std::vector<float>& value, const std::vector<float>& mask,
+                                 size_t heads, size_t queries, size_t keys, size_t head_size, size_t value_head_size,
+                                 float scale) {
+    std::vector<float> output(heads * queries * value_head_size, 0.f);
+    std::vector<float> scores(keys);
+    for (size_t h = 0; h < heads; h++) {
+        for (size_t m = 0; m < queries; m++) {
+            float max_score = -std::numeric_limits<float>::max();
+            for (size_t n = 0; n < keys; n++) {
+                float dot = 0.f;
+                for (size_t d = 0; d < head_size; d++)
+                    dot += query[(h * queries + m) * head_size + d] * key[(h * keys + n) * head_size + d];
+                scores[n] = dot * scale + (mask.empty() ? 0.f : mask[n]);
+                max_score = std::max(max_score, scores[n]);
+            }
+            float sum = 0.f;
+            for (size_t n = 0; n < keys; n++) {
+                scores[n] = std::exp(scores[n] - max_score);
+                sum += scores[n];
+            }
+            for (size_t n = 0; n < keys; n++) {
+                for (size_t d = 0; d < value_head_size; d++)
+                    output[(h * queries + m) * value_head_size + d] +=
+                        scores[n] / sum * value[(h * keys + n) * value_head_size + d];
+            }
+        }
+    }
+    return output;
+}
+}  // namespace
+
+TEST(attention_gpu, basic_transposed_key_with_mask) {
+    // The number of keys is not a multiple of the tile size
+    const size_t heads = 2, queries = 5, keys = 19, head_size = 8, value_head_size = 4;
+    const float scale = 0.125f;
+
+    auto& engine = get_test_engine();
+    auto query = engine.allocate_memory({ data_types::f32, format::bfyx, { 1, (int)heads, (int)head_size, (int)queries } });
+    auto key = engine.allocate_memory({ data_types::f32, format::bfyx, { 1, (int)heads, (int)head_size, (int)keys } });
+    auto value = engine.allocate_memory({ data_types::f32, format::bfyx, { 1, (int)heads, (int)value_head_size, (int)keys } });
+    auto mask = engine.allocate_memory({ data_types::f32, format::bfyx, { 1, 1, (int)keys, 1 } });
+
+    auto query_data = generate_random_1d<float>(heads * queries * head_size, -2, 2);
+    auto key_data = generate_random_1d<float>(heads * keys * head_size, -2, 2);
+    auto value_data = generate_random_1d<float>(heads * keys * value_head_size, -2, 2);
+    std::vector<float> mask_data(keys, 0.f);
+    for (size_t n = keys - 3; n < keys; n++)
+        mask_data[n] = -10000.f;
+
+    set_values(query, query_data);
+    set_values(key, key_data);
+    set_values(value, value_data);
+    set_values(mask, mask_data);
+
+    topology topology;
+    topology.add(input_layout("query", query->get_layout()));
+    topology.add(input_layout("key", key->get_layout()));
+    topology.add(input_layout("value", value->get_layout()));
+    topology.add(data("mask", mask));
+    topology.add(attention("output", "query", "key", "value", "mask", true, scale));
+
+    network network(engine, topology);
+    network.set_input_data("query", query);
+    network.set_input_data("key", key);
+    network.set_input_data("value", value);
+    auto outputs = network.execute();
+
+    auto output = outputs.at("output").get_memory();
+    cldnn::mem_lock<float> output_ptr(output, get_test_stream());
+
+    auto expected = attention_ref(query_data, key_data, value_data, mask_data,
+                                  heads, queries, keys, head_size, value_head_size, scale);
+    ASSERT_EQ(output_ptr.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_NEAR(output_ptr[i], expected[i], 1e-4f) << "i=" << i;
+    }
+}
+
+TEST(attention_gpu, decomposed_subgraph_is_fused) {
+    const size_t heads = 3, queries = 17, keys = 33, head_size = 16;
+
+    auto& engine = get_test_engine();
+    auto query = engine.allocate_memory({ data_types::f32, format::bfyx, { 2, (int)heads, (int)head_size, (int)queries } });
+    auto key = engine.allocate_memory({ data_types::f32, format::bfyx, { 2, (int)heads, (int)head_size, (int)keys } });
+    auto value = engine.allocate_memory({ data_types::f32, format::bfyx, { 2, (int)heads, (int)head_size, (int)keys } });
+    auto scale = engine.allocate_memory({ data_types::f32, format::bfyx, { 1, 1, 1, 1 } });
+
+    set_values(query, generate_random_1d<float>(2 * heads * queries * head_size, -2, 2));
+    set_values(key, generate_random_1d<float>(2 * heads * keys * head_size, -2, 2));
+    set_values(value, generate_random_1d<float>(2 * heads * keys * head_size, -2, 2));
+    set_values(scale, { 0.25f });
+
+    topology topology;
+    topology.add(input_layout("query", query->get_layout()));
+    topology.add(input_layout("key", key->get_layout()));
+    topology.add(input_layout("value", value->get_layout()));
+    topology.add(data("scale", scale));
+    topology.add(gemm("scores", { "query", "key" }, data_types::f32, false, true));
+    topology.add(eltwise("scaled_scores", "scores", "scale", eltwise_mode::prod));
+    topology.add(softmax("probs", "scaled_scores", softmax::normalize_x));
+    topology.add(gemm("context", { "probs", "value" }, data_types::f32));
+    topology.add(activation("output", "context", activation_func::abs));
+
+    auto execute = [&](bool optimize_data) {
+        build_options options;
+        options.set_option(build_option::optimize_data(optimize_data));
+        network network(engine, topology, options);
+        network.set_input_data("query", query);
+        network.set_input_data("key", key);
+        network.set_input_data("value", value);
+        auto outputs = network.execute();
+
+        auto executed_prims = network.get_executed_primitive_ids();
+        bool fused = std::find(executed_prims.begin(), executed_prims.end(), "context_attention") != executed_prims.end();
+        EXPECT_EQ(fused, optimize_data);
+
+        cldnn::mem_lock<float> output_ptr(outputs.at("output").get_memory(), get_test_stream());
+        return std::vector<float>(output_ptr.begin(), output_ptr.end());
+    };
+
+    auto ref = execute(false);
+    auto opt = execute(true);
+    ASSERT_EQ(ref.size(), opt.size());
+    for (size_t i = 0; i < ref.size(); i++) {
+        EXPECT_NEAR(ref[i], opt[i], 1e-4f) << "i=" << i;
+    }
+}
@@ -20,7 +20,8 @@ enum class cache_version {
     version_2,
     version_2_invalid,
     version_2_from_1,
-    version_2_empty
+    version_2_empty,
+    version_2_timed  // version 2 cache with measured run times of the kernels
 };
 
 std::string reference_impl_name = "fused_conv_eltwise_gpu_ref";
@@ -89,6 +90,17 @@ R"__a({
     }
 })__a";
 
+std::string cache_v2_timed =
+R"__a({
+    "version_2": {
+        "__EUs__": {
+            "CONVOLUTION": {
+                "F32_BFYX_v3_p0_0_v3_p0_0_v16_p0_0_v1_p0_0;F32_BFYX_v3_p0_0_v3_p0_0_v16_p0_0_v1_p0_0;1_1_1;1_1_1;1_1_1;0_0_0;1;1": ["fused_conv_eltwise_gpu_ref", 0, 15360]
+            }
+        }
+    }
+})__a";
+
 std::string get_cache_version(cache_version version) {
     std::string cache;
     switch (version) {
@@ -110,6 +122,9 @@ std::string get_cache_version(cache_version version) {
     case cache_version::version_2_empty:
         cache = cache_v2_empty;
         break;
+    case cache_version::version_2_timed:
+        cache = cache_v2_timed;
+        break;
     default:
         throw std::invalid_argument("invalid cache version");
     }
@@ -294,6 +309,9 @@ public:
         case cache_version::version_2_empty:
             result = "version_2_empty";
             break;
+        case cache_version::version_2_timed:
+            result = "version_2_timed";
+            break;
         default:
             result = std::to_string(static_cast<int>(param.param));
             break;
@@ -354,3 +372,13 @@ TEST(cache_test, remove_invalid) {
         .expect_cache(cache_version::version_2_empty)
         .test();
 }
+
+TEST(cache_test, use_timed) {
+    auto& engine = tests::get_test_engine();
+
+    cache_test_helper helper(engine, cache_version::version_2_timed);
+    helper.with_mode(cldnn::tuning_mode::tuning_use_cache)
+        .expect_implementation(reference_impl_name)
+        .expect_cache(cache_version::version_2_timed)
+        .test();
+}
@@ -99,3 +99,19 @@ TEST(command_queue_test, test_priority_and_throttle_hints) {
     auto engine = engine::create(engine_types::ocl, runtime_types::ocl, configuration);
     exexute_network(*engine);
 }
+
+TEST(command_queue_test, test_stream_priority_hints_override_engine_ones) {
+    engine_configuration configuration =
+        engine_configuration(
+            false,          // profiling
+            queue_types::out_of_order,
+            "",             // sources_dumps_dir
+            priority_mode_types::low,
+            throttle_mode_types::disabled);
+    auto engine = engine::create(engine_types::ocl, runtime_types::ocl, configuration);
+    auto high_priority_stream = engine->create_stream(priority_mode_types::high, throttle_mode_types::disabled);
+    auto low_priority_stream = engine->create_stream();
+    high_priority_stream->finish();
+    low_priority_stream->finish();
+    exexute_network(*engine);
+}
@@ -7,12 +7,14 @@
 #include "test_utils.h"
 
 #include <cldnn/primitives/input_layout.hpp>
+#include <cldnn/primitives/activation.hpp>
 #include <cldnn/primitives/convolution.hpp>
 #include <cldnn/primitives/data.hpp>
 #include <cldnn/primitives/reorder.hpp>
 
 #include <algorithm>
 #include <cmath>
+#include <numeric>
 #include <iostream>
 #include <iomanip>
 #include <thread>
@@ -785,6 +787,70 @@ INSTANTIATE_TEST_SUITE_P(smoke_low_precision,
                         concat_gpu::PrintToStringParamName);
 
 
+TEST(concat_gpu, b_fs_yx_fsv16_unaligned_last_input_in_place) {
+    // Only the last input is not aligned to the feature block, so the concatenation is done in place
+    const int batch_num = 2, input_y = 3, input_x = 2;
+    const std::vector<int> in_features = { 16, 32, 8 };
+
+    auto& engine = get_test_engine();
+
+    topology topology;
+    std::vector<memory::ptr> in_memory;
+    std::vector<std::vector<float>> in_data;
+    std::vector<primitive_id> act_ids;
+    build_options options;
+    std::map<primitive_id, implementation_desc> forcing;
+    for (size_t i = 0; i < in_features.size(); i++) {
+        auto in_lay = layout(data_types::f32, format::bfyx, { batch_num, in_features[i], input_x, input_y });
+        auto data = generate_random_1d<float>(in_lay.count(), -10, 10);
+        auto in_mem = engine.allocate_memory(in_lay);
+        set_values(in_mem, data);
+        in_memory.push_back(in_mem);
+        in_data.push_back(data);
+
+        auto id = std::to_string(i);
+        topology.add(input_layout("input" + id, in_lay));
+        topology.add(activation("act" + id, "input" + id, activation_func::abs));
+        forcing["act" + id] = implementation_desc{ format::b_fs_yx_fsv16, std::string() };
+        act_ids.push_back("act" + id);
+    }
+    topology.add(concatenation("concat", act_ids, concatenation::concatenation_axis::along_f));
+    topology.add(reorder("output", "concat", format::bfyx, data_types::f32));
+
+    options.set_option(build_option::optimize_data(true));
+    options.set_option(build_option::force_implementations(forcing));
+    network network(engine, topology, options);
+    for (size_t i = 0; i < in_features.size(); i++) {
+        network.set_input_data("input" + std::to_string(i), in_memory[i]);
+    }
+    auto outputs = network.execute();
+
+    auto executed_prims = network.get_executed_primitive_ids();
+    EXPECT_TRUE(std::find(executed_prims.begin(), executed_prims.end(), "concat") == executed_prims.end());
+
+    auto out_mem = outputs.at("output").get_memory();
+    cldnn::mem_lock<float> out_ptr(out_mem, get_test_stream());
+    const int output_f = std::accumulate(in_features.begin(), in_features.end(), 0);
+    const int spatial = input_y * input_x;
+    ASSERT_EQ(out_ptr.size(), static_cast<size_t>(batch_num * output_f * spatial));
+
+    for (int bi = 0; bi < batch_num; bi++) {
+        int f_sum = 0;
+        for (size_t in_i = 0; in_i < in_features.size(); in_i++) {
+            for (int fi = 0; fi < in_features[in_i]; fi++) {
+                for (int si = 0; si < spatial; si++) {
+                    auto ref_val = std::abs(in_data[in_i][(bi * in_features[in_i] + fi) * spatial + si]);
+                    auto actual_val = out_ptr[(bi * output_f + f_sum + fi) * spatial + si];
+                    ASSERT_EQ(ref_val, actual_val)
+                        << " b=" << bi << ", f=" << f_sum + fi << "(input " << in_i << "), yx=" << si;
+                }
+            }
+            f_sum += in_features[in_i];
+        }
+    }
+}
+
+
 #ifdef ENABLE_ONEDNN_FOR_GPU
 TEST(concat_gpu_onednn, basic_input_types) {
     auto& engine = get_onednn_test_engine();
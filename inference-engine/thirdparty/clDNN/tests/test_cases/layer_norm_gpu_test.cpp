@@ -0,0 +1,128 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "test_utils.h"
+
+#include <cldnn/primitives/input_layout.hpp>
+#include <cldnn/primitives/layer_norm.hpp>
+#include <cldnn/primitives/activation.hpp>
+#include <cldnn/primitives/data.hpp>
+#include <cldnn/primitives/eltwise.hpp>
+#include <cldnn/primitives/mvn.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+using namespace cldnn;
+using namespace ::tests;
+
+TEST(layer_norm_gpu, basic_with_residual) {
+    // The normalized size is not a multiple of the work group size
+    const size_t batch = 2, tokens = 3, hidden = 70;
+    const float epsilon = 1e-5f;
+
+    auto& engine = get_test_engine();
+    auto input = engine.allocate_memory({ data_types::f32, format::bfyx, { (int)batch, (int)tokens, 1, (int)hidden } });
+    auto residual = engine.allocate_memory({ data_types::f32, format::bfyx, { (int)batch, (int)tokens, 1, (int)hidden } });
+    auto gamma = engine.allocate_memory({ data_types::f32, format::bfyx, { 1, 1, 1, (int)hidden } });
+    auto beta = engine.allocate_memory({ data_types::f32, format::bfyx, { 1, 1, 1, (int)hidden } });
+
+    auto input_data = generate_random_1d<float>(batch * tokens * hidden, -5, 5);
+    auto residual_data = generate_random_1d<float>(batch * tokens * hidden, -5, 5);
+    auto gamma_data = generate_random_1d<float>(hidden, -2, 2);
+    auto beta_data = generate_random_1d<float>(hidden, -2, 2);
+
+    set_values(input, input_data);
+    set_values(residual, residual_data);
+    set_values(gamma, gamma_data);
+    set_values(beta, beta_data);
+
+    topology topology;
+    topology.add(input_layout("input", input->get_layout()));
+    topology.add(input_layout("residual", residual->get_layout()));
+    topology.add(data("gamma", gamma));
+    topology.add(data("beta", beta));
+    topology.add(layer_norm("output", "input", "residual", "gamma", "beta", epsilon));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    network.set_input_data("residual", residual);
+    auto outputs = network.execute();
+
+    auto output = outputs.at("output").get_memory();
+    cldnn::mem_lock<float> output_ptr(output, get_test_stream());
+    ASSERT_EQ(output_ptr.size(), batch * tokens * hidden);
+
+    for (size_t i = 0; i < batch * tokens; i++) {
+        float mean = 0.f;
+        for (size_t h = 0; h < hidden; h++)
+            mean += input_data[i * hidden + h] + residual_data[i * hidden + h];
+        mean /= hidden;
+
+        float variance = 0.f;
+        for (size_t h = 0; h < hidden; h++) {
+            float diff = input_data[i * hidden + h] + residual_data[i * hidden + h] - mean;
+            variance += diff * diff;
+        }
+        variance /= hidden;
+
+        for (size_t h = 0; h < hidden; h++) {
+            float x = input_data[i * hidden + h] + residual_data[i * hidden + h];
+            float expected = gamma_data[h] * (x - mean) / std::sqrt(variance + epsilon) + beta_data[h];
+            EXPECT_NEAR(output_ptr[i * hidden + h], expected, 1e-4f) << "i=" << i << " h=" << h;
+        }
+    }
+}
+
+TEST(layer_norm_gpu, decomposed_subgraph_is_fused) {
+    const size_t batch = 1, tokens = 5, hidden = 768;
+
+    auto& engine = get_test_engine();
+    auto input = engine.allocate_memory({ data_types::f32, format::bfyx, { (int)batch, (int)tokens, 1, (int)hidden } });
+    auto residual = engine.allocate_memory({ data_types::f32, format::bfyx, { (int)batch, (int)tokens, 1, (int)hidden } });
+    auto gamma = engine.allocate_memory({ data_types::f32, format::bfyx, { 1, 1, 1, (int)hidden } });
+    auto beta = engine.allocate_memory({ data_types::f32, format::bfyx, { 1, 1, 1, (int)hidden } });
+
+    set_values(input, generate_random_1d<float>(batch * tokens * hidden, -5, 5));
+    set_values(residual, generate_random_1d<float>(batch * tokens * hidden, -5, 5));
+    set_values(gamma, generate_random_1d<float>(hidden, -2, 2));
+    set_values(beta, generate_random_1d<float>(hidden, -2, 2));
+
+    topology topology;
+    topology.add(input_layout("input", input->get_layout()));
+    topology.add(input_layout("residual", residual->get_layout()));
+    topology.add(data("gamma", gamma));
+    topology.add(data("beta", beta));
+    topology.add(eltwise("sum", "input", "residual", eltwise_mode::sum));
+    topology.add(mvn("mvn", "sum", true, 1e-5f, true));
+    topology.add(eltwise("scaled", "mvn", "gamma", eltwise_mode::prod));
+    topology.add(eltwise("shifted", "scaled", "beta", eltwise_mode::sum));
+    topology.add(activation("output", "shifted", activation_func::abs));
+
+    auto execute = [&](bool optimize_data) {
+        build_options options;
+        options.set_option(build_option::optimize_data(optimize_data));
+        network network(engine, topology, options);
+        network.set_input_data("input", input);
+        network.set_input_data("residual", residual);
+        auto outputs = network.execute();
+
+        auto executed_prims = network.get_executed_primitive_ids();
+        bool fused = std::find(executed_prims.begin(), executed_prims.end(), "shifted_layer_norm") != executed_prims.end();
+        EXPECT_EQ(fused, optimize_data);
+
+        cldnn::mem_lock<float> output_ptr(outputs.at("output").get_memory(), get_test_stream());
+        return std::vector<float>(output_ptr.begin(), output_ptr.end());
+    };
+
+    auto ref = execute(false);
+    auto opt = execute(true);
+    ASSERT_EQ(ref.size(), opt.size());
+    for (size_t i = 0; i < ref.size(); i++) {
+        EXPECT_NEAR(ref[i], opt[i], 1e-4f) << "i=" << i;
+    }
+}
@@ -556,3 +556,141 @@ TEST(memory_pool, add_mem_dep_test) {
     EXPECT_EQ(out2_ptr[2], 7.0f);
     EXPECT_EQ(out2_ptr[3], 8.0f);
 }
+
+TEST(memory_pool, memory_footprint) {
+    auto engine = create_test_engine();
+
+    auto input = engine->allocate_memory({ data_types::f32, format::bfyx, { 1, 4, 1, 1 } });
+    set_values(input, { -1.f, 2.f, -3.f, 4.f });
+
+    topology topology;
+    topology.add(input_layout("input", input->get_layout()));
+    topology.add(activation("relu", "input", activation_func::relu));
+    topology.add(activation("relu1", "relu", activation_func::relu));
+    topology.add(activation("relu2", "relu1", activation_func::relu));
+    topology.add(activation("relu3", "relu2", activation_func::relu));
+
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+
+    network network(*engine, topology, bo);
+    network.set_input_data("input", input);
+    network.execute();
+
+    auto records = network.get_primitives_memory_info();
+    ASSERT_EQ(records.size(), (size_t)5);
+    // intermediate primitives alternate between two buffers of the pool
+    EXPECT_EQ(records.at("relu").record, records.at("relu2").record);
+    EXPECT_NE(records.at("relu").record, records.at("relu1").record);
+    EXPECT_NE(records.at("relu3").record, records.at("relu1").record);
+    EXPECT_EQ(records.at("relu1").bytes, (uint64_t)16);
+
+    auto footprint = network.get_memory_footprint();
+    EXPECT_EQ(footprint.weights, (uint64_t)0);
+    EXPECT_EQ(footprint.intermediates, (uint64_t)32);
+    EXPECT_EQ(footprint.inputs_outputs, (uint64_t)32);
+    EXPECT_EQ(footprint.total(), footprint.intermediates + footprint.inputs_outputs + footprint.kernels);
+}
+
+TEST(size_class_pool, size_classes) {
+    EXPECT_EQ(size_class_pool::get_size_class(1), (size_t)4096);
+    EXPECT_EQ(size_class_pool::get_size_class(4096), (size_t)4096);
+    EXPECT_EQ(size_class_pool::get_size_class(4097), (size_t)5120);
+    EXPECT_EQ(size_class_pool::get_size_class(6000), (size_t)6144);
+    EXPECT_EQ(size_class_pool::get_size_class(8192), (size_t)8192);
+    EXPECT_EQ(size_class_pool::get_size_class(3 * 1024 * 1024 + 1), (size_t)3670016);
+}
+
+TEST(size_class_pool, reuse_across_networks) {
+    auto config = get_test_engine_config(queue_types::out_of_order);
+    auto engine = engine::create(engine_types::ocl, runtime_types::ocl,
+                                 engine_configuration(config.enable_profiling, config.queue_type, config.sources_dumps_dir,
+                                                      config.priority_mode, config.throttle_mode, config.use_memory_pool,
+                                                      config.use_unified_shared_memory, config.kernels_cache_path,
+                                                      config.n_threads, config.n_streams, config.tuning_cache_path,
+                                                      config.kernels_cache_max_size, true));
+    ASSERT_NE(engine->get_size_class_pool(), nullptr);
+
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+
+    auto run_network = [&](int feature_num) {
+        auto input = engine->allocate_memory({ data_types::f32, format::bfyx, { 1, feature_num, 1, 1 } });
+        std::vector<float> input_vec(feature_num);
+        for (int i = 0; i < feature_num; i++)
+            input_vec[i] = i % 2 ? static_cast<float>(i) : static_cast<float>(-i);
+        set_values(input, input_vec);
+
+        topology topology;
+        topology.add(input_layout("input", input->get_layout()));
+        topology.add(activation("relu", "input", activation_func::relu));
+        topology.add(activation("relu1", "relu", activation_func::relu));
+        topology.add(activation("relu2", "relu1", activation_func::relu));
+
+        network network(*engine, topology, bo);
+        network.set_input_data("input", input);
+        auto outputs = network.execute();
+
+        auto output = outputs.at("relu2").get_memory();
+        cldnn::mem_lock<float> output_ptr(output, get_test_stream());
+        for (int i = 0; i < feature_num; i++)
+            EXPECT_EQ(output_ptr[i], std::max(input_vec[i], 0.f));
+    };
+
+    run_network(4);
+    auto reserved = engine->get_size_class_pool()->get_reserved_bytes();
+    EXPECT_GT(reserved, (uint64_t)0);
+    EXPECT_EQ(engine->get_size_class_pool()->get_used_bytes(), (uint64_t)0);
+
+    // Buffers of the different size within the same size class are taken from the pool
+    run_network(8);
+    EXPECT_EQ(engine->get_size_class_pool()->get_reserved_bytes(), reserved);
+    EXPECT_EQ(engine->get_size_class_pool()->get_used_bytes(), (uint64_t)0);
+
+    engine->get_size_class_pool()->trim();
+    EXPECT_EQ(engine->get_size_class_pool()->get_reserved_bytes(), (uint64_t)0);
+}
+
+TEST(constants_cache, weights_shared_across_programs) {
+    auto engine = create_test_engine();
+    ASSERT_NE(engine->get_constants_cache(), nullptr);
+
+    auto input = engine->allocate_memory({ data_types::f32, format::bfyx, { 1, 4, 1, 1 } });
+    set_values(input, { 1.f, 2.f, 3.f, 4.f });
+
+    auto build_network = [&](const std::vector<float>& scales) {
+        auto scale_mem = engine->allocate_memory({ data_types::f32, format::bfyx, { 1, 4, 1, 1 } });
+        set_values(scale_mem, scales);
+
+        topology topology;
+        topology.add(input_layout("input", input->get_layout()));
+        topology.add(data("scale_data", scale_mem));
+        topology.add(scale("scale", "input", "scale_data"));
+
+        auto net = std::make_shared<network>(*engine, topology);
+        net->set_input_data("input", input);
+        return net;
+    };
+
+    auto check_output = [&](network& net, const std::vector<float>& expected) {
+        auto outputs = net.execute();
+        cldnn::mem_lock<float> output_ptr(outputs.at("scale").get_memory(), get_test_stream());
+        for (size_t i = 0; i < expected.size(); i++)
+            EXPECT_EQ(output_ptr[i], expected[i]);
+    };
+
+    auto net1 = build_network({ 1.f, 2.f, 3.f, 4.f });
+    EXPECT_EQ(engine->get_constants_cache()->get_reused_bytes(), (uint64_t)0);
+
+    // The same weights in another buffer are taken from the first program
+    auto net2 = build_network({ 1.f, 2.f, 3.f, 4.f });
+    EXPECT_EQ(engine->get_constants_cache()->get_reused_bytes(), (uint64_t)16);
+
+    // The content is compared, not the layout only
+    auto net3 = build_network({ 4.f, 3.f, 2.f, 1.f });
+    EXPECT_EQ(engine->get_constants_cache()->get_reused_bytes(), (uint64_t)16);
+
+    check_output(*net1, { 1.f, 4.f, 9.f, 16.f });
+    check_output(*net2, { 1.f, 4.f, 9.f, 16.f });
+    check_output(*net3, { 4.f, 6.f, 6.f, 4.f });
+}
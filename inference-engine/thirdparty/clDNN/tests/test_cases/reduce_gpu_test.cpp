@@ -808,6 +808,42 @@ TEST(reduce_gpu, common_bfyx_keepdims) {
     }
 }
 
+#ifdef ENABLE_ONEDNN_FOR_GPU
+TEST(reduce_gpu_onednn, common_bfyx_keepdims) {
+    auto& engine = get_onednn_test_engine();
+    auto input = engine.allocate_memory({data_types::f32, format::bfyx, {1, 3, 4, 1}});
+
+    set_values(input, {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f});
+
+    topology topology;
+    topology.add(input_layout("input", input->get_layout()));
+    topology.add(reduce("reduce", "input", reduce_mode::sum, {cldnn::reduce::along_x, cldnn::reduce::along_y}, 1));
+
+    build_options options;
+    implementation_desc impl = {format::bfyx, std::string(""), impl_types::onednn};
+    options.set_option(build_option::force_implementations({{"reduce", impl}}));
+
+    network network(engine, topology, options);
+
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "reduce");
+
+    auto output = outputs.at("reduce").get_memory();
+
+    std::vector<float> ref_data = {6.0f, 22.0f, 38.0f};
+
+    cldnn::mem_lock<float> output_ptr(output, network.get_stream());
+
+    for (size_t i = 0; i < ref_data.size(); ++i) {
+        EXPECT_TRUE(are_equal(ref_data[i], output_ptr[i]));
+    }
+}
+#endif   // ENABLE_ONEDNN_FOR_GPU
+
 TEST(reduce_gpu, regr_bfyx_keepdims) {
     auto& engine = get_test_engine();
     auto input = engine.allocate_memory({ data_types::f32, format::bfyx, {1, 3, 2, 2} });
@@ -7,6 +7,8 @@
 #include <cldnn/primitives/input_layout.hpp>
 #include <cldnn/primitives/softmax.hpp>
 
+#include <cmath>
+
 using namespace cldnn;
 using namespace std;
 using namespace ::tests;
@@ -425,6 +427,44 @@ TEST(softmax_gpu_bfyx_f32, normalize_f) {
     }
 }
 
+#ifdef ENABLE_ONEDNN_FOR_GPU
+TEST(softmax_gpu_bfyx_f32_onednn, normalize_x) {
+    //  Input  : 1x2x1x4
+    auto& engine = get_onednn_test_engine();
+
+    auto input = engine.allocate_memory({ data_types::f32, format::bfyx, { 1, 2, 4, 1 } });
+    topology topology;
+    topology.add(input_layout("input", input->get_layout()));
+    topology.add(softmax("softmax", "input", softmax::normalize_x));
+
+    vector<float> input_vec = {
+        /*f0*/0.0f, 1.0f, 2.0f, 3.0f,
+        /*f1*/1.0f, 1.0f, 1.0f, 1.0f
+    };
+    set_values(input, input_vec);
+
+    build_options options;
+    implementation_desc impl = {format::bfyx, std::string(""), impl_types::onednn};
+    options.set_option(build_option::force_implementations({{"softmax", impl}}));
+
+    network network(engine, topology, options);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "softmax");
+
+    auto output = outputs.at("softmax").get_memory();
+    cldnn::mem_lock<float> output_ptr(output, network.get_stream());
+
+    float exp_sum = std::exp(0.0f) + std::exp(1.0f) + std::exp(2.0f) + std::exp(3.0f);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_NEAR(output_ptr[i], std::exp(static_cast<float>(i)) / exp_sum, 1e-5f);
+        EXPECT_NEAR(output_ptr[4 + i], 0.25f, 1e-5f);
+    }
+}
+#endif   // ENABLE_ONEDNN_FOR_GPU
+
 TEST(softmax_gpu_yxfb_f32, normalize_f) {
 
     static const int32_t x_size = 1, y_size = 2, feature_num = 1,
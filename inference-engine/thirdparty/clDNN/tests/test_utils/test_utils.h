@@ -45,6 +45,7 @@
 
 namespace tests {
 
+cldnn::engine_configuration get_test_engine_config(cldnn::queue_types queue_type);
 std::shared_ptr<cldnn::engine> create_test_engine(cldnn::queue_types queue_type = cldnn::queue_types::out_of_order);
 cldnn::engine& get_test_engine();
 #ifdef ENABLE_ONEDNN_FOR_GPU
@@ -0,0 +1,197 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ov {
+namespace descriptor {
+/// \brief Sequence container which never moves its elements, like std::deque with only emplace_back and
+/// clear, but the first N elements are stored inline without any allocation.
+///
+/// Node input and output descriptors are referenced by pointers from the connected descriptors, so their
+/// addresses must be stable, while most of the nodes have a few inputs and outputs only.
+template <typename T, size_t N>
+class SmallStableVector {
+public:
+    template <typename Container, typename Value>
+    class Iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = typename std::remove_const<Value>::type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        Iterator(Container* container, size_t index) : m_container(container), m_index(index) {}
+
+        reference operator*() const {
+            return (*m_container)[m_index];
+        }
+        pointer operator->() const {
+            return &(*m_container)[m_index];
+        }
+        Iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator result = *this;
+            ++m_index;
+            return result;
+        }
+        Iterator& operator--() {
+            --m_index;
+            return *this;
+        }
+        Iterator& operator+=(difference_type offset) {
+            m_index += offset;
+            return *this;
+        }
+        Iterator operator+(difference_type offset) const {
+            return Iterator(m_container, m_index + offset);
+        }
+        Iterator operator-(difference_type offset) const {
+            return Iterator(m_container, m_index - offset);
+        }
+        difference_type operator-(const Iterator& other) const {
+            return static_cast<difference_type>(m_index) - static_cast<difference_type>(other.m_index);
+        }
+        reference operator[](difference_type offset) const {
+            return (*m_container)[m_index + offset];
+        }
+        bool operator==(const Iterator& other) const {
+            return m_index == other.m_index;
+        }
+        bool operator!=(const Iterator& other) const {
+            return m_index != other.m_index;
+        }
+        bool operator<(const Iterator& other) const {
+            return m_index < other.m_index;
+        }
+
+    private:
+        Container* m_container;
+        size_t m_index;
+    };
+
+    using value_type = T;
+    using iterator = Iterator<SmallStableVector, T>;
+    using const_iterator = Iterator<const SmallStableVector, const T>;
+
+    SmallStableVector() = default;
+
+    SmallStableVector(const SmallStableVector& other) {
+        for (const auto& value : other) {
+            emplace_back(value);
+        }
+    }
+
+    SmallStableVector& operator=(const SmallStableVector& other) {
+        if (this != &other) {
+            clear();
+            for (const auto& value : other) {
+                emplace_back(value);
+            }
+        }
+        return *this;
+    }
+
+    ~SmallStableVector() {
+        clear();
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+
+    bool empty() const {
+        return m_size == 0;
+    }
+
+    T& operator[](size_t index) {
+        return index < N ? *inline_element(index) : (*m_overflow)[index - N];
+    }
+
+    const T& operator[](size_t index) const {
+        return index < N ? *inline_element(index) : (*m_overflow)[index - N];
+    }
+
+    T& at(size_t index) {
+        check_range(index);
+        return (*this)[index];
+    }
+
+    const T& at(size_t index) const {
+        check_range(index);
+        return (*this)[index];
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        T* element = nullptr;
+        if (m_size < N) {
+            element = new (&m_storage[m_size]) T(std::forward<Args>(args)...);
+        } else {
+            if (!m_overflow) {
+                m_overflow.reset(new std::deque<T>());
+            }
+            m_overflow->emplace_back(std::forward<Args>(args)...);
+            element = &m_overflow->back();
+        }
+        ++m_size;
+        return *element;
+    }
+
+    /// \brief Destroys the elements in the order of their insertion
+    void clear() {
+        for (size_t i = 0; i < m_size && i < N; ++i) {
+            inline_element(i)->~T();
+        }
+        m_overflow.reset();
+        m_size = 0;
+    }
+
+    iterator begin() {
+        return iterator(this, 0);
+    }
+    iterator end() {
+        return iterator(this, m_size);
+    }
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+    const_iterator end() const {
+        return const_iterator(this, m_size);
+    }
+
+private:
+    T* inline_element(size_t index) {
+        return reinterpret_cast<T*>(&m_storage[index]);
+    }
+
+    const T* inline_element(size_t index) const {
+        return reinterpret_cast<const T*>(&m_storage[index]);
+    }
+
+    void check_range(size_t index) const {
+        if (index >= m_size) {
+            throw std::out_of_range("SmallStableVector index is out of range");
+        }
+    }
+
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type m_storage[N];
+    std::unique_ptr<std::deque<T>> m_overflow;
+    size_t m_size = 0;
+};
+}  // namespace descriptor
+}  // namespace ov
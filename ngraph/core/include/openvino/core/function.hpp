@@ -146,6 +146,17 @@ public:
 
     void validate_nodes_and_infer_types() const;
 
+    /// \brief Revalidates only the nodes which depend on the given parameters
+    ///
+    /// Nodes are revalidated in topological order starting from the parameters. Propagation stops at
+    /// nodes whose output element types and shapes are not changed by revalidation, except for the nodes
+    /// depending on ShapeOf outputs, since their values change together with the shapes. The structural
+    /// checks of the full validation (registered parameters and variables) are skipped, so the function
+    /// is expected to be valid before the parameters are changed.
+    ///
+    /// \param changed_parameters Parameters whose partial shapes or element types were changed
+    void validate_nodes_and_infer_types(const ov::ParameterVector& changed_parameters) const;
+
     /// \brief Returns the sum of the size of all nodes in the graph plus the size of
     /// all constant data. This has little value beyond comparing the relative size of
     /// graphs and should not be considered the actual memory consumption of a graph.
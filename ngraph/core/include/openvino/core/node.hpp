@@ -25,6 +25,7 @@
 #include "openvino/core/deprecated.hpp"
 #include "openvino/core/descriptor/input.hpp"
 #include "openvino/core/descriptor/output.hpp"
+#include "openvino/core/descriptor/small_stable_vector.hpp"
 #include "openvino/core/descriptor/tensor.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node_input.hpp"
@@ -536,8 +537,9 @@ private:
     static std::atomic<size_t> m_next_instance_id;
     std::unordered_set<std::string> m_provenance_tags;
     std::set<std::shared_ptr<Node>> m_provenance_group;
-    std::deque<descriptor::Input> m_inputs;
-    std::deque<descriptor::Output> m_outputs;
+    // the descriptors of the typical number of inputs and outputs are stored inside the node
+    descriptor::SmallStableVector<descriptor::Input, 2> m_inputs;
+    descriptor::SmallStableVector<descriptor::Output, 1> m_outputs;
     OPENVINO_SUPPRESS_DEPRECATED_START
     std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
     OPENVINO_SUPPRESS_DEPRECATED_END
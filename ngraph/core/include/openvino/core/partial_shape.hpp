@@ -10,6 +10,7 @@
 #include "openvino/core/dimension.hpp"
 #include "openvino/core/rank.hpp"
 #include "openvino/core/shape.hpp"
+#include "openvino/core/small_vector.hpp"
 #include "openvino/op/util/attr_types.hpp"
 
 namespace ov {
@@ -28,7 +29,8 @@ struct AutoBroadcastSpec;
 /// \li Static rank, and static dimensions on all axes.
 ///     (Informal notation examples: `{1,2,3,4}`, `{6}`, `{}`)
 class OPENVINO_API PartialShape {
-    using Dimensions = std::vector<Dimension>;
+    // The dimensions of rank up to 6 are stored inline, so the shapes are copied without the allocations
+    using Dimensions = SmallVector<Dimension, 6>;
 
 public:
     using iterator = Dimensions::iterator;
@@ -172,7 +174,7 @@ public:
     Dimension& operator[](size_t i);
     /// \brief Returns a vector of the dimensions. This has no meaning if dynamic.
     explicit operator std::vector<Dimension>() const {
-        return m_dimensions;
+        return std::vector<Dimension>(m_dimensions.begin(), m_dimensions.end());
     }
     friend OPENVINO_API std::ostream& operator<<(std::ostream& str, const PartialShape& shape);
     friend PartialShape operator+(const PartialShape& s1, const PartialShape& s2);
@@ -307,7 +309,7 @@ public:
 
 private:
     // Private constructor for PartialShape::dynamic().
-    PartialShape(bool rank_is_static, std::vector<Dimension> dimensions);
+    PartialShape(bool rank_is_static, Dimensions dimensions);
 
     // True if the shape's rank is static.
     bool m_rank_is_static;
@@ -0,0 +1,312 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ov {
+/// \brief Sequence container keeping up to N elements in the inline storage.
+///
+/// The heap is used only when the size exceeds N, so the containers of the typical small size (e.g. the
+/// dimensions of a shape) are copied without the allocations. The iterators are the plain pointers and are
+/// invalidated by any operation changing the capacity, as well as by the move of the inline storage.
+template <typename T, size_t N>
+class SmallVector {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    SmallVector() noexcept = default;
+
+    explicit SmallVector(size_type count) {
+        resize(count);
+    }
+
+    SmallVector(size_type count, const T& value) {
+        resize(count, value);
+    }
+
+    template <typename InputIt,
+              typename = typename std::enable_if<
+                  std::is_convertible<typename std::iterator_traits<InputIt>::iterator_category,
+                                      std::input_iterator_tag>::value>::type>
+    SmallVector(InputIt first, InputIt last) {
+        append(first, last);
+    }
+
+    SmallVector(std::initializer_list<T> init) {
+        append(init.begin(), init.end());
+    }
+
+    SmallVector(const SmallVector& other) {
+        append(other.begin(), other.end());
+    }
+
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        steal(std::move(other));
+    }
+
+    ~SmallVector() {
+        clear();
+        release_heap();
+    }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            clear();
+            append(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this != &other) {
+            clear();
+            release_heap();
+            steal(std::move(other));
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(std::initializer_list<T> init) {
+        clear();
+        append(init.begin(), init.end());
+        return *this;
+    }
+
+    T* data() noexcept {
+        return m_heap ? m_heap : inline_data();
+    }
+    const T* data() const noexcept {
+        return m_heap ? m_heap : inline_data();
+    }
+
+    size_type size() const noexcept {
+        return m_size;
+    }
+    bool empty() const noexcept {
+        return m_size == 0;
+    }
+    size_type capacity() const noexcept {
+        return m_heap ? m_capacity : N;
+    }
+
+    T& operator[](size_type i) {
+        return data()[i];
+    }
+    const T& operator[](size_type i) const {
+        return data()[i];
+    }
+    T& front() {
+        return data()[0];
+    }
+    const T& front() const {
+        return data()[0];
+    }
+    T& back() {
+        return data()[m_size - 1];
+    }
+    const T& back() const {
+        return data()[m_size - 1];
+    }
+
+    iterator begin() noexcept {
+        return data();
+    }
+    const_iterator begin() const noexcept {
+        return data();
+    }
+    iterator end() noexcept {
+        return data() + m_size;
+    }
+    const_iterator end() const noexcept {
+        return data() + m_size;
+    }
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+    const_iterator cend() const noexcept {
+        return end();
+    }
+    reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+    reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+    const_reverse_iterator crbegin() const noexcept {
+        return rbegin();
+    }
+    const_reverse_iterator crend() const noexcept {
+        return rend();
+    }
+
+    void reserve(size_type new_capacity) {
+        if (new_capacity <= capacity())
+            return;
+        T* new_data = static_cast<T*>(::operator new(new_capacity * sizeof(T)));
+        T* old_data = data();
+        for (size_type i = 0; i < m_size; i++) {
+            new (new_data + i) T(std::move(old_data[i]));
+            old_data[i].~T();
+        }
+        release_heap();
+        m_heap = new_data;
+        m_capacity = new_capacity;
+    }
+
+    void resize(size_type count) {
+        resize_with(count, [](T* p) {
+            new (p) T();
+        });
+    }
+
+    void resize(size_type count, const T& value) {
+        resize_with(count, [&value](T* p) {
+            new (p) T(value);
+        });
+    }
+
+    void clear() noexcept {
+        T* d = data();
+        for (size_type i = 0; i < m_size; i++)
+            d[i].~T();
+        m_size = 0;
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (m_size == capacity()) {
+            // the argument may refer to the element of this container, so it is constructed before the growth
+            T value(std::forward<Args>(args)...);
+            reserve(grown_capacity(m_size + 1));
+            new (data() + m_size) T(std::move(value));
+        } else {
+            new (data() + m_size) T(std::forward<Args>(args)...);
+        }
+        return data()[m_size++];
+    }
+
+    void pop_back() {
+        data()[--m_size].~T();
+    }
+
+    bool operator==(const SmallVector& other) const {
+        return m_size == other.m_size && std::equal(begin(), end(), other.begin());
+    }
+
+    bool operator!=(const SmallVector& other) const {
+        return !(*this == other);
+    }
+
+private:
+    T* inline_data() noexcept {
+        return reinterpret_cast<T*>(&m_inline);
+    }
+    const T* inline_data() const noexcept {
+        return reinterpret_cast<const T*>(&m_inline);
+    }
+
+    size_type grown_capacity(size_type required) const {
+        return std::max(required, 2 * capacity());
+    }
+
+    template <typename InputIt>
+    void append(InputIt first, InputIt last) {
+        append(first, last, typename std::iterator_traits<InputIt>::iterator_category());
+    }
+
+    template <typename ForwardIt>
+    void append(ForwardIt first, ForwardIt last, std::forward_iterator_tag) {
+        reserve(m_size + static_cast<size_type>(std::distance(first, last)));
+        T* d = data();
+        for (; first != last; ++first)
+            new (d + m_size++) T(*first);
+    }
+
+    template <typename InputIt>
+    void append(InputIt first, InputIt last, std::input_iterator_tag) {
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+
+    template <typename Construct>
+    void resize_with(size_type count, Construct construct) {
+        if (count < m_size) {
+            T* d = data();
+            for (size_type i = count; i < m_size; i++)
+                d[i].~T();
+            m_size = count;
+            return;
+        }
+        reserve(count);
+        T* d = data();
+        for (; m_size < count; m_size++)
+            construct(d + m_size);
+    }
+
+    // expects the empty container without the heap storage
+    void steal(SmallVector&& other) {
+        if (other.m_heap) {
+            m_heap = other.m_heap;
+            m_capacity = other.m_capacity;
+            m_size = other.m_size;
+            other.m_heap = nullptr;
+            other.m_capacity = 0;
+            other.m_size = 0;
+        } else {
+            T* d = inline_data();
+            T* src = other.inline_data();
+            for (size_type i = 0; i < other.m_size; i++)
+                new (d + i) T(std::move(src[i]));
+            m_size = other.m_size;
+            other.clear();
+        }
+    }
+
+    void release_heap() noexcept {
+        if (m_heap) {
+            ::operator delete(m_heap);
+            m_heap = nullptr;
+            m_capacity = 0;
+        }
+    }
+
+    T* m_heap = nullptr;
+    size_type m_size = 0;
+    size_type m_capacity = 0;
+    typename std::aligned_storage<sizeof(T) * N, alignof(T)>::type m_inline;
+};
+}  // namespace ov
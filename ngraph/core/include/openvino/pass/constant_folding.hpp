@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <unordered_set>
+
 #include "openvino/core/variant.hpp"
 #include "openvino/pass/pass.hpp"
 
@@ -13,10 +15,16 @@ namespace pass {
  * @brief Constant folding iterates over the function and tries to evaluate nodes
  *        with constant inputs. Such nodes are then replaced with new Constants containing
  *        the result of a folded operation.
+ *        Independent nodes with constant inputs are evaluated in parallel, the total size of
+ *        the outputs evaluated at once is limited by the memory limit.
  */
 class OPENVINO_API ConstantFolding : public FunctionPass {
 public:
     OPENVINO_RTTI("ConstantFolding");
+
+    /// \param memory_limit Maximal size in bytes of the outputs folded in parallel
+    explicit ConstantFolding(size_t memory_limit = 1ul << 30) : m_memory_limit(memory_limit) {}
+
     bool run_on_function(std::shared_ptr<ov::Function> f) override;
 
 private:
@@ -24,6 +32,14 @@ private:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Function>& f);
+    /// \brief Folds nodes which have only constant inputs wave by wave, nodes of the same wave
+    /// are independent and evaluated in parallel. Nodes which can't be folded are stored to
+    /// `not_folded` to avoid evaluating them twice.
+    bool parallel_folding(const std::shared_ptr<ov::Function>& f, std::unordered_set<Node*>& not_folded);
+    /// \brief Replaces outputs of the node with the folded values
+    bool replace_outputs(const std::shared_ptr<Node>& node, const OutputVector& replacements);
+
+    size_t m_memory_limit;
 };
 
 OPENVINO_API void disable_constant_folding(const std::shared_ptr<Node>& node);
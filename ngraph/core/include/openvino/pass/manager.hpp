@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <list>
 #include <memory>
+#include <ostream>
+#include <string>
 #include <typeinfo>
 #include <vector>
 
@@ -14,6 +17,20 @@
 
 namespace ov {
 namespace pass {
+/// \brief Statistics of a single pass execution collected by Manager
+struct PassStatistics {
+    std::string name;
+    /// \brief Wall time of the pass execution in microseconds
+    uint64_t time_us = 0;
+    size_t nodes_before = 0;
+    size_t nodes_after = 0;
+    /// \brief Size of the nodes and constant data of the function in bytes, see Function::get_graph_size()
+    int64_t graph_size_before = 0;
+    int64_t graph_size_after = 0;
+};
+
+OPENVINO_API std::ostream& operator<<(std::ostream& s, const PassStatistics& statistics);
+
 class OPENVINO_API Manager {
 public:
     Manager();
@@ -47,7 +64,10 @@ public:
         return rc;
     }
 
-    void run_passes(std::shared_ptr<Function>);
+    /// \brief Runs the registered passes over the function
+    ///
+    /// \return true if any of the passes changed the function
+    bool run_passes(std::shared_ptr<Function>);
 
     void set_pass_visualization(bool new_state) {
         m_visualize = new_state;
@@ -58,6 +78,18 @@ public:
     void set_per_pass_validation(bool new_state) {
         m_per_pass_validation = new_state;
     }
+    /// \brief Set flag to enable/disable collecting of statistics for each executed pass.
+    /// Statistics are also collected if NGRAPH_PASS_STATISTICS environment variable is set,
+    /// in which case they are printed to the log as well.
+    /// Passes containing own Manager (like CommonOptimizations) are reported as a whole.
+    /// \param new_state Value "true" enables statistics; "false", otherwise
+    void set_per_pass_statistics(bool new_state) {
+        m_per_pass_statistics = new_state;
+    }
+    /// \return Statistics of the passes executed by the last run_passes() call, Validate passes are skipped
+    const std::vector<PassStatistics>& get_pass_statistics() const {
+        return m_pass_statistics;
+    }
     /// \brief Callback is a lambda function that can be used by registered transformations.
     /// The main purpose of this callback is to provide a way for plugins to disable/enable
     /// transformations based on some conditions. In some cases plugins may want not to
@@ -111,6 +143,8 @@ protected:
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     bool m_visualize = false;
     bool m_per_pass_validation = true;
+    bool m_per_pass_statistics = false;
+    std::vector<PassStatistics> m_pass_statistics;
 };
 }  // namespace pass
 }  // namespace ov
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <string>
 
@@ -45,6 +46,17 @@ public:
               Version version = Version::UNSPECIFIED);
     Serialize(const std::string& xmlPath, const std::string& binPath, Version version = Version::UNSPECIFIED);
 
+    /// \brief Alignment of constants data in the bin file when the alignment is enabled
+    static constexpr size_t constant_alignment = 64;
+    /// \brief Alignment of constants data not smaller than it, the page size
+    static constexpr size_t page_alignment = 4096;
+
+    /// \brief Enables alignment of constants data offsets in the bin file, so the weights can be used directly
+    /// from the mapped file. The gaps between constants are filled with zeros. Disabled by default.
+    void set_align_constants(bool align) {
+        m_align_constants = align;
+    }
+
 private:
     std::ostream* m_xmlFile;
     std::ostream* m_binFile;
@@ -52,6 +64,7 @@ private:
     const std::string m_binPath;
     const Version m_version;
     const std::map<std::string, ngraph::OpSet> m_custom_opsets;
+    bool m_align_constants = false;
 };
 
 /**
@@ -86,5 +99,71 @@ private:
     const Serialize::Version m_version;
 };
 
+/**
+ * @brief BinarySerialize transformation converts ngraph::Function into single binary file
+ * which is loaded by binary IR frontend without any text parsing
+ * @attention
+ * - legacy pre-processing information and execution graphs are not supported
+ *
+ * Format:
+ *   [ DataHeader ]
+ *   [  Weights   ] - constants data, each blob is aligned to `alignment` bytes from the
+ *                    beginning of the file, so constants can be created on top of a mapped file
+ *   [   Model    ] - topology, attributes and runtime info of the function in tagged binary form
+ */
+class OPENVINO_API BinarySerialize : public ov::pass::FunctionPass {
+public:
+    OPENVINO_RTTI("BinarySerialize");
+
+    /// \brief File signature, first bytes of each binary IR
+    static const char magic[8];
+    /// \brief Version of the format, readers must reject files with greater version
+    static constexpr uint32_t format_version = 1;
+    /// \brief Alignment of constants data in the file
+    static constexpr uint64_t alignment = 64;
+
+    struct DataHeader {
+        char magic[8];
+        uint32_t format_version;
+        /// \brief Value of "version" runtime info of the function, it is equivalent to IR version
+        uint32_t ir_version;
+        uint64_t consts_offset;
+        uint64_t consts_size;
+        uint64_t model_offset;
+        uint64_t model_size;
+    };
+
+    /// \brief Tag of an attribute value stored in the model section
+    enum class AttributeKind : uint8_t {
+        BOOL = 0,
+        STRING,
+        INT64,
+        DOUBLE,
+        VEC_INT32,
+        VEC_INT64,
+        VEC_UINT64,
+        VEC_FLOAT,
+        VEC_STRING,
+        FUNCTION,
+        INPUT_DESCRIPTIONS,
+        OUTPUT_DESCRIPTIONS,
+        SPECIAL_BODY_PORTS,
+        VARIABLE,
+        CONSTANT_DATA,
+        FRAMEWORK_NODE_ATTRS,
+        TYPE_VECTOR
+    };
+
+    bool run_on_function(std::shared_ptr<ov::Function> f) override;
+
+    BinarySerialize(std::ostream& stream, std::map<std::string, ngraph::OpSet> custom_opsets = {});
+    BinarySerialize(const std::string& path, std::map<std::string, ngraph::OpSet> custom_opsets = {});
+
+private:
+    std::ostream* m_stream;
+    const std::string m_path;
+    const std::map<std::string, ngraph::OpSet> m_custom_opsets;
+};
+
 }  // namespace pass
 }  // namespace ov
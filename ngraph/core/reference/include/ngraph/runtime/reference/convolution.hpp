@@ -16,6 +16,7 @@
 #include "ngraph/runtime/reference/helpers.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/runtime/reference/split.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph {
@@ -234,15 +235,23 @@ void convolution(const T* in,
     const Shape filter_shape(++filters_shape.begin(), filters_shape.end());
     const size_t filter_size = shape_size(filter_shape);
 
-    auto batch = in;
-    for (size_t batch_idx = 0; batch_idx < batches_count; ++batch_idx) {
-        auto filter = f;
-        for (size_t f_idx = 0; f_idx < filters_count; ++f_idx) {
-            convolve_3D_channels(params, batch, batch_shape, filter, filter_shape, out);
-            filter += filter_size;
+    // each pair of the batch and the filter produces its own output channel
+    if (batches_count * filters_count == 0)
+        return;
+    const size_t out_channel_size = shape_size(out_shape) / (batches_count * filters_count);
+    parallel_for(batches_count * filters_count, [&](size_t begin, size_t end) {
+        for (size_t idx = begin; idx < end; ++idx) {
+            const size_t batch_idx = idx / filters_count;
+            const size_t f_idx = idx % filters_count;
+            T* channel_out = out + idx * out_channel_size;
+            convolve_3D_channels(params,
+                                 in + batch_idx * batch_size,
+                                 batch_shape,
+                                 f + f_idx * filter_size,
+                                 filter_shape,
+                                 channel_out);
         }
-        batch += batch_size;
-    }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
@@ -7,6 +7,7 @@
 #include <numeric>
 
 #include "ngraph/shape.hpp"
+#include "utils/parallel.hpp"
 #include "utils/span.hpp"
 
 namespace ngraph {
@@ -32,18 +33,19 @@ void gather(const T* const data,
     int64_t batch_indices_mul = shape_size(span(indices_shape).subspan(batch_dims));
 
     int64_t axis_size = data_shape[axis];
-    int64_t data_offset, out_offset, idx;
 
-    for (int64_t batch = 0; batch < batch_size; batch++)
-        for (int64_t outer_idx = 0; outer_idx < outer_size; outer_idx++) {
-            data_offset = batch_data_mul * batch + inner_size * axis_size * outer_idx;
-            out_offset = batch_out_mul * batch + indices_size * inner_size * outer_idx;
+    parallel_for(batch_size * outer_size, [&](size_t begin, size_t end) {
+        for (int64_t work_idx = begin; work_idx < static_cast<int64_t>(end); work_idx++) {
+            const int64_t batch = work_idx / outer_size;
+            const int64_t outer_idx = work_idx % outer_size;
+            const int64_t data_offset = batch_data_mul * batch + inner_size * axis_size * outer_idx;
+            const int64_t out_offset = batch_out_mul * batch + indices_size * inner_size * outer_idx;
             for (int64_t i = 0; i < indices_size; i++) {
-                idx = indices[i + batch_indices_mul * batch];
+                int64_t idx = indices[i + batch_indices_mul * batch];
                 // clang-format off
-                            // todo: check if bound check is needed
-                            // if (idx >= axis_size || (idx < 0 && -idx >= axis_size))
-                            //    throw std::domain_error{"indices values of Gather exceed size along axis"};
+                // todo: check if bound check is needed
+                // if (idx >= axis_size || (idx < 0 && -idx >= axis_size))
+                //    throw std::domain_error{"indices values of Gather exceed size along axis"};
                 // clang-format on
                 if (idx < 0)
                     idx += axis_size;
@@ -54,6 +56,7 @@ void gather(const T* const data,
                 std::copy(src_begin, src_end, out_ptr);
             }
         }
+    });
 }
 
 }  // namespace reference
@@ -20,6 +20,12 @@ namespace runtime {
 namespace reference {
 template <typename T>
 void mean(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes) {
+    const auto mean_block = [](const T* a, T* o, const Shape& s, const AxisSet& r) {
+        mean(a, o, s, r);
+    };
+    if (get_parallel_threads() > 1 && details::parallel_reduce(arg, out, in_shape, reduction_axes, mean_block))
+        return;
+
     constexpr bool dont_keep_dims_in_output = false;
     const auto out_shape = reduce(in_shape, reduction_axes, dont_keep_dims_in_output);
     std::vector<T> cs(shape_size(out_shape), 0);
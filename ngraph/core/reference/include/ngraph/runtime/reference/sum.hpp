@@ -8,6 +8,7 @@
 #include <numeric>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
@@ -54,10 +55,49 @@ void kahan_summation(const T& elem, T& compensation, T& sum) {
         sum = sum + elem;
     }
 }
+
+///
+/// \brief      Splits the reduction into the independent blocks along the leading axes which
+///             are not reduced and calls reduce_block(arg, out, block_shape, block_axes) for
+///             each of them in parallel.
+///
+/// \return     false if there are no such axes, so the reduction can't be split.
+///
+template <typename T, typename F>
+bool parallel_reduce(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes, const F& reduce_block) {
+    size_t outer_rank = 0;
+    while (outer_rank < in_shape.size() && reduction_axes.count(outer_rank) == 0)
+        outer_rank++;
+    if (outer_rank == 0 || outer_rank == in_shape.size())
+        return false;
+
+    const size_t outer_size = shape_size(Shape(in_shape.begin(), in_shape.begin() + outer_rank));
+    if (outer_size <= 1)
+        return false;
+
+    const Shape block_shape(in_shape.begin() + outer_rank, in_shape.end());
+    AxisSet block_axes;
+    for (const auto axis : reduction_axes)
+        block_axes.insert(axis - outer_rank);
+    const size_t in_block_size = shape_size(block_shape);
+    const size_t out_block_size = shape_size(reduce(block_shape, block_axes, false));
+
+    parallel_for(outer_size, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+            reduce_block(arg + i * in_block_size, out + i * out_block_size, block_shape, block_axes);
+    });
+    return true;
+}
 }  // namespace details
 
 template <typename T>
 void sum(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes) {
+    const auto sum_block = [](const T* a, T* o, const Shape& s, const AxisSet& r) {
+        sum(a, o, s, r);
+    };
+    if (get_parallel_threads() > 1 && details::parallel_reduce(arg, out, in_shape, reduction_axes, sum_block))
+        return;
+
     constexpr bool dont_keep_dims_in_output = false;
     const auto out_shape = reduce(in_shape, reduction_axes, dont_keep_dims_in_output);
 
@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+/// \brief Returns the number of threads the reference kernels split the work between.
+///
+/// The value is taken from NGRAPH_REFERENCE_NUM_THREADS environment variable, where 0 means
+/// all the hardware threads. The default is 1, so the kernels are executed sequentially.
+/// The calls made from the parallel region get 1 to avoid the nested parallelism.
+size_t get_parallel_threads();
+
+/// \brief Sets the number of threads the reference kernels split the work between.
+///
+/// \param threads The number of threads, 0 means all the hardware threads.
+void set_parallel_threads(size_t threads);
+
+namespace details {
+void run_parallel(size_t work_amount, size_t threads, const std::function<void(size_t, size_t)>& body);
+}  // namespace details
+
+/// \brief Splits [0, work_amount) into contiguous ranges and calls body(begin, end) for each of
+///        them on its own thread.
+///
+/// The kernels only partition the outer dimensions, so each output element is computed by one
+/// call in the same order as the sequential loop and the results are bit exact.
+/// The first exception thrown by the body is rethrown after all the threads are joined.
+template <typename F>
+void parallel_for(size_t work_amount, const F& body) {
+    const size_t threads = std::min(get_parallel_threads(), work_amount);
+    if (threads <= 1) {
+        if (work_amount > 0)
+            body(size_t(0), work_amount);
+        return;
+    }
+    details::run_parallel(work_amount, threads, body);
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
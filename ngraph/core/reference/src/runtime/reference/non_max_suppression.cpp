@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "ngraph/runtime/reference/non_max_suppression.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape.hpp"
 
 using namespace ngraph;
@@ -137,13 +138,14 @@ void non_max_suppression(const float* boxes_data,
 
     size_t boxes_per_class = static_cast<size_t>(max_output_boxes_per_class);
 
-    std::vector<BoxInfo> filteredBoxes;
-
-    for (int64_t batch = 0; batch < num_batches; batch++) {
-        const float* boxesPtr = boxes_data + batch * num_boxes * 4;
-        Rectangle* r = reinterpret_cast<Rectangle*>(const_cast<float*>(boxesPtr));
-
-        for (int64_t class_idx = 0; class_idx < num_classes; class_idx++) {
+    // the boxes are selected for each batch and class independently, the results are gathered in the same order
+    std::vector<std::vector<BoxInfo>> selected_per_class(num_batches * num_classes);
+    parallel_for(selected_per_class.size(), [&](size_t begin, size_t end) {
+        for (size_t work_idx = begin; work_idx < end; work_idx++) {
+            const int64_t batch = static_cast<int64_t>(work_idx) / num_classes;
+            const int64_t class_idx = static_cast<int64_t>(work_idx) % num_classes;
+            const float* boxesPtr = boxes_data + batch * num_boxes * 4;
+            Rectangle* r = reinterpret_cast<Rectangle*>(const_cast<float*>(boxesPtr));
             const float* scoresPtr = scores_data + batch * (num_classes * num_boxes) + class_idx * num_boxes;
 
             std::vector<BoxInfo> candidate_boxes;
@@ -157,7 +159,7 @@ void non_max_suppression(const float* boxes_data,
 
             std::priority_queue<BoxInfo> sorted_boxes(std::less<BoxInfo>(), std::move(candidate_boxes));
 
-            std::vector<BoxInfo> selected;
+            std::vector<BoxInfo>& selected = selected_per_class[work_idx];
             // Get the next box with top score, filter by iou_threshold
 
             BoxInfo next_candidate;
@@ -196,11 +198,12 @@ void non_max_suppression(const float* boxes_data,
                     }
                 }
             }
-
-            for (const auto& box_info : selected) {
-                filteredBoxes.push_back(box_info);
-            }
         }
+    });
+
+    std::vector<BoxInfo> filteredBoxes;
+    for (const auto& selected : selected_per_class) {
+        filteredBoxes.insert(filteredBoxes.end(), selected.begin(), selected.end());
     }
 
     if (sort_result_descending) {
@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "ngraph/env_util.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+namespace {
+size_t hardware_threads() {
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+std::atomic<size_t>& threads_setting() {
+    static std::atomic<size_t> threads{[] {
+        const int32_t value = getenv_int("NGRAPH_REFERENCE_NUM_THREADS", 1);
+        return value == 0 ? hardware_threads() : static_cast<size_t>(std::max(value, 1));
+    }()};
+    return threads;
+}
+
+thread_local bool in_parallel_region = false;
+
+class ParallelRegionGuard {
+public:
+    ParallelRegionGuard() : previous(in_parallel_region) {
+        in_parallel_region = true;
+    }
+    ~ParallelRegionGuard() {
+        in_parallel_region = previous;
+    }
+
+private:
+    bool previous;
+};
+}  // namespace
+
+size_t get_parallel_threads() {
+    return in_parallel_region ? 1 : threads_setting().load();
+}
+
+void set_parallel_threads(size_t threads) {
+    threads_setting() = threads == 0 ? hardware_threads() : threads;
+}
+
+void details::run_parallel(size_t work_amount, size_t threads, const std::function<void(size_t, size_t)>& body) {
+    std::vector<std::exception_ptr> errors(threads);
+    auto run_chunk = [&](size_t ithr) {
+        const size_t chunk = work_amount / threads;
+        const size_t tail = work_amount % threads;
+        const size_t begin = ithr * chunk + std::min(ithr, tail);
+        const size_t end = begin + chunk + (ithr < tail ? 1 : 0);
+
+        ParallelRegionGuard guard;
+        try {
+            body(begin, end);
+        } catch (...) {
+            errors[ithr] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (size_t ithr = 1; ithr < threads; ithr++)
+        workers.emplace_back(run_chunk, ithr);
+    run_chunk(0);
+    for (auto& worker : workers)
+        worker.join();
+
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
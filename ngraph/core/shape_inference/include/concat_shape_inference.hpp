@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/op/concat.hpp>
+
+namespace ov {
+namespace op {
+namespace v0 {
+
+/// \brief Concat shape inference for the inputs of the static ranks
+template <class T>
+void shape_infer(const Concat* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() >= 1 && output_shapes.size() == 1);
+    NODE_VALIDATION_CHECK(op, input_shapes[0].rank().is_static());
+
+    const auto rank = input_shapes[0].rank().get_length();
+    const auto concat_axis = op->get_axis() < 0 ? op->get_axis() + rank : op->get_axis();
+    NODE_VALIDATION_CHECK(op,
+                          concat_axis < rank && concat_axis >= 0,
+                          "Concatenation axis (",
+                          op->get_axis(),
+                          ") is out of bounds [",
+                          -rank,
+                          ", ",
+                          rank - 1,
+                          "].");
+
+    auto output_shape = input_shapes[0];
+    for (size_t i = 1; i < input_shapes.size(); i++) {
+        const auto& input_shape = input_shapes[i];
+        NODE_VALIDATION_CHECK(op,
+                              input_shape.rank().is_static() && input_shape.rank().get_length() == rank,
+                              "Argument shapes are inconsistent; they must have the same rank.");
+        for (int64_t axis = 0; axis < rank; axis++) {
+            if (axis == concat_axis) {
+                output_shape[axis] = output_shape[axis] + input_shape[axis];
+            } else {
+                NODE_VALIDATION_CHECK(op,
+                                      output_shape[axis].compatible(input_shape[axis]),
+                                      "Argument shapes are inconsistent; they must have equal dimension everywhere ",
+                                      "except on the concatenation axis (axis ",
+                                      concat_axis,
+                                      ").");
+            }
+        }
+    }
+    output_shapes[0] = output_shape;
+}
+
+}  // namespace v0
+}  // namespace op
+}  // namespace ov
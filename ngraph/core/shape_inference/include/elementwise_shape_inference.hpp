@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/core/node.hpp>
+
+namespace ov {
+namespace op {
+
+/// \brief Shape inference of the operations which produce the output of the first input shape
+template <class T>
+void copy_shape_infer(const Node* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() >= 1 && output_shapes.size() == 1);
+    output_shapes[0] = input_shapes[0];
+}
+
+/// \brief Shape inference of the binary elementwise operations broadcasting the inputs by their auto broadcast spec
+template <class T>
+void eltwise_shape_infer(const Node* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 2 && output_shapes.size() == 1);
+    auto output_shape = input_shapes[0];
+    const auto& autob = op->get_autob();
+    if (autob.m_type == AutoBroadcastType::NONE) {
+        NODE_VALIDATION_CHECK(op, T::merge_into(output_shape, input_shapes[1]), "Argument shapes are inconsistent.");
+    } else if (autob.m_type == AutoBroadcastType::NUMPY || autob.m_type == AutoBroadcastType::PDPD) {
+        NODE_VALIDATION_CHECK(op,
+                              T::broadcast_merge_into(output_shape, input_shapes[1], autob),
+                              "Argument shapes are inconsistent.");
+    } else {
+        NODE_VALIDATION_CHECK(op, false, "Unsupported auto broadcast specification");
+    }
+    output_shapes[0] = output_shape;
+}
+
+}  // namespace op
+}  // namespace ov
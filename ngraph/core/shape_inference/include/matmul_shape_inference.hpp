@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/op/matmul.hpp>
+
+namespace ov {
+namespace op {
+namespace v0 {
+
+/// \brief MatMul shape inference for the inputs of the static ranks
+///
+/// The batch dimensions are broadcast by the numpy rules, the bounds of the dynamic dimensions aren't refined
+/// the way MatMul::validate_and_infer_types does it.
+template <class T>
+void shape_infer(const MatMul* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 2 && output_shapes.size() == 1);
+    NODE_VALIDATION_CHECK(op, input_shapes[0].rank().is_static() && input_shapes[1].rank().is_static());
+    using DimType = typename std::decay<decltype(input_shapes[0][0])>::type;
+    std::vector<DimType> arg0_shape(input_shapes[0].begin(), input_shapes[0].end());
+    std::vector<DimType> arg1_shape(input_shapes[1].begin(), input_shapes[1].end());
+
+    const auto arg0_rank_original = arg0_shape.size(), arg1_rank_original = arg1_shape.size();
+    NODE_VALIDATION_CHECK(op,
+                          arg0_rank_original != 0 && arg1_rank_original != 0,
+                          "Scalars are not supported as MatMul inputs.");
+
+    // transpositions swap the two right-most dimensions and are ignored for 1D tensors
+    if (op->get_transpose_a() && arg0_rank_original > 1)
+        std::swap(arg0_shape[arg0_rank_original - 2], arg0_shape[arg0_rank_original - 1]);
+    if (op->get_transpose_b() && arg1_rank_original > 1)
+        std::swap(arg1_shape[arg1_rank_original - 2], arg1_shape[arg1_rank_original - 1]);
+
+    // 1D tensors are unsqueezed to a row vector and to a column vector respectively
+    if (arg0_rank_original == 1)
+        arg0_shape.insert(arg0_shape.begin(), 1);
+    if (arg1_rank_original == 1)
+        arg1_shape.insert(arg1_shape.end(), 1);
+
+    // the smaller tensor is unsqueezed from the left side to the same rank
+    if (arg0_shape.size() < arg1_shape.size())
+        arg0_shape.insert(arg0_shape.begin(), arg1_shape.size() - arg0_shape.size(), 1);
+    else if (arg0_shape.size() > arg1_shape.size())
+        arg1_shape.insert(arg1_shape.begin(), arg0_shape.size() - arg1_shape.size(), 1);
+    const auto rank = arg0_shape.size();
+
+    const auto& arg0_col_dim = arg0_shape[rank - 1];
+    const auto& arg1_row_dim = arg1_shape[rank - 2];
+    NODE_VALIDATION_CHECK(op,
+                          arg0_col_dim.compatible(arg1_row_dim),
+                          "Incompatible MatMul matrix dimension. First input dimension=",
+                          arg0_col_dim,
+                          " at COL_INDEX_DIM=",
+                          (rank - 1),
+                          " doesn't match the second input dimension=",
+                          arg1_row_dim,
+                          " at ROW_INDEX_DIM=",
+                          (rank - 2));
+
+    std::vector<DimType> output_shape(rank);
+    for (size_t i = 0; i < rank - 2; i++) {
+        NODE_VALIDATION_CHECK(op,
+                              DimType::broadcast_merge(output_shape[i], arg0_shape[i], arg1_shape[i]),
+                              "Incompatible MatMul batch dimension. Can't merge first input dimension=",
+                              arg0_shape[i],
+                              " with second input dimension=",
+                              arg1_shape[i],
+                              " at index=",
+                              i);
+    }
+    output_shape[rank - 2] = arg0_shape[rank - 2];
+    output_shape[rank - 1] = arg1_shape[rank - 1];
+
+    // the temporary axes of the originally 1D tensors are removed
+    if (arg0_rank_original == 1)
+        output_shape.erase(output_shape.begin() + output_shape.size() - 2);
+    if (arg1_rank_original == 1)
+        output_shape.erase(output_shape.begin() + output_shape.size() - 1);
+    output_shapes[0] = T(output_shape);
+}
+
+}  // namespace v0
+}  // namespace op
+}  // namespace ov
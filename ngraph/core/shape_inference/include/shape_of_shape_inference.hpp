@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/op/shape_of.hpp>
+
+namespace ov {
+namespace op {
+
+/// \brief ShapeOf shape inference: the output is a 1D tensor of the input rank elements
+template <class T>
+void shape_of_shape_infer(const Node* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 1 && output_shapes.size() == 1);
+    NODE_VALIDATION_CHECK(op, input_shapes[0].rank().is_static());
+    auto& output_shape = output_shapes[0];
+    output_shape.resize(1);
+    output_shape[0] = input_shapes[0].rank().get_length();
+}
+
+namespace v0 {
+template <class T>
+void shape_infer(const ShapeOf* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    shape_of_shape_infer(op, input_shapes, output_shapes);
+}
+}  // namespace v0
+
+namespace v3 {
+template <class T>
+void shape_infer(const ShapeOf* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    shape_of_shape_infer(op, input_shapes, output_shapes);
+}
+}  // namespace v3
+
+}  // namespace op
+}  // namespace ov
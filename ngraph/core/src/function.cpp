@@ -5,13 +5,15 @@
 #include "ngraph/function.hpp"
 
 #include <algorithm>
+#include <deque>
 #include <list>
 #include <memory>
+#include <stack>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "itt.hpp"
-#include "ngraph/evaluator.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/ops.hpp"
@@ -252,6 +254,89 @@ void ov::Function::validate_nodes_and_infer_types() const {
                             "network.");
 }
 
+void ov::Function::validate_nodes_and_infer_types(const ov::ParameterVector& changed_parameters) const {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "Function::validate_nodes_and_infer_types(changed_parameters)");
+
+    // Assign and ReadValue operations share shapes through variables, not through the graph edges
+    if (!m_variables.empty()) {
+        validate_nodes_and_infer_types();
+        return;
+    }
+
+    // collect the nodes reachable from the changed parameters and count their inputs produced inside this subgraph
+    std::unordered_map<Node*, size_t> pending_inputs;
+    std::stack<Node*, std::vector<Node*>> remaining_ops;
+    for (const auto& param : changed_parameters) {
+        if (pending_inputs.emplace(param.get(), 0).second)
+            remaining_ops.push(param.get());
+    }
+    while (!remaining_ops.empty()) {
+        auto node = remaining_ops.top();
+        remaining_ops.pop();
+        for (const auto& output : node->outputs()) {
+            for (const auto& input : output.get_target_inputs()) {
+                auto consumer = input.get_node();
+                auto it = pending_inputs.find(consumer);
+                if (it == pending_inputs.end()) {
+                    pending_inputs.emplace(consumer, 1);
+                    remaining_ops.push(consumer);
+                } else {
+                    it->second++;
+                }
+            }
+        }
+    }
+
+    // nodes with changed output shapes and nodes whose output values may depend on the changed shapes
+    std::unordered_set<Node*> changed_shapes;
+    std::unordered_set<Node*> changed_values;
+    std::deque<Node*> ready_ops;
+    for (const auto& param : changed_parameters)
+        ready_ops.push_back(param.get());
+    std::unordered_set<Node*> processed;
+    while (!ready_ops.empty()) {
+        auto node = ready_ops.front();
+        ready_ops.pop_front();
+        if (!processed.insert(node).second)
+            continue;
+
+        bool depends_on_values = false;
+        bool need_revalidation = op::util::is_parameter(node);
+        for (const auto& input : node->input_values()) {
+            auto producer = input.get_node();
+            depends_on_values |= changed_values.count(producer) > 0;
+            need_revalidation |= depends_on_values || changed_shapes.count(producer) > 0;
+        }
+
+        if (need_revalidation) {
+            std::vector<std::pair<element::Type, PartialShape>> original_outputs;
+            original_outputs.reserve(node->get_output_size());
+            for (const auto& output : node->outputs())
+                original_outputs.emplace_back(output.get_element_type(), output.get_partial_shape());
+
+            node->revalidate_and_infer_types();
+
+            bool outputs_changed = original_outputs.size() != node->get_output_size();
+            for (size_t i = 0; i < original_outputs.size() && !outputs_changed; ++i) {
+                outputs_changed = original_outputs[i].first != node->get_output_element_type(i) ||
+                                  original_outputs[i].second != node->get_output_partial_shape(i);
+            }
+            if (outputs_changed)
+                changed_shapes.insert(node);
+            if (depends_on_values || ov::is_type<op::v0::ShapeOf>(node) || ov::is_type<op::v3::ShapeOf>(node))
+                changed_values.insert(node);
+        }
+
+        for (const auto& output : node->outputs()) {
+            for (const auto& input : output.get_target_inputs()) {
+                auto consumer = input.get_node();
+                if (--pending_inputs[consumer] == 0)
+                    ready_ops.push_back(consumer);
+            }
+        }
+    }
+}
+
 std::vector<shared_ptr<ov::Node>> ov::Function::get_ordered_ops() const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "Function::get_ordered_ops");
 
@@ -466,6 +551,56 @@ inline void update_output_tensors(const ngraph::HostTensorVector& output_values,
         }
     }
 }
+
+// A static intermediate value of a function placed into the evaluation arena
+struct ArenaBox {
+    ov::RawNodeOutput value;
+    size_t start;   // index of the op producing the value
+    size_t finish;  // index of the last op consuming the value
+    size_t size;
+    size_t offset;
+};
+
+inline size_t arena_box_size(const ov::Output<ov::Node>& value) {
+    constexpr size_t alignment = 64;
+    const size_t bytes = (ov::shape_size(value.get_shape()) * value.get_element_type().bitwidth() + 7) / 8;
+    return (std::max<size_t>(bytes, 1) + alignment - 1) / alignment * alignment;
+}
+
+// Greedy placement from the largest box as in MemorySolver: each box takes the lowest offset where it
+// doesn't overlap the boxes alive at the same time. Returns the size of the arena.
+size_t place_arena_boxes(std::vector<ArenaBox>& boxes) {
+    std::vector<ArenaBox*> order;
+    for (auto& box : boxes) {
+        order.push_back(&box);
+    }
+    std::stable_sort(order.begin(), order.end(), [](const ArenaBox* a, const ArenaBox* b) {
+        return a->size > b->size;
+    });
+
+    size_t total = 0;
+    std::vector<ArenaBox*> placed;
+    for (auto box : order) {
+        std::vector<ArenaBox*> alive;
+        for (auto other : placed) {
+            if (other->start <= box->finish && box->start <= other->finish)
+                alive.push_back(other);
+        }
+        std::sort(alive.begin(), alive.end(), [](const ArenaBox* a, const ArenaBox* b) {
+            return a->offset < b->offset;
+        });
+        size_t offset = 0;
+        for (auto other : alive) {
+            if (offset + box->size <= other->offset)
+                break;
+            offset = std::max(offset, other->offset + other->size);
+        }
+        box->offset = offset;
+        total = std::max(total, offset + box->size);
+        placed.push_back(box);
+    }
+    return total;
+}
 }  // namespace
 
 bool ov::Function::evaluate(const HostTensorVector& output_tensors,
@@ -488,54 +623,82 @@ bool ov::Function::evaluate(ov::runtime::TensorVector& output_tensors,
     for (size_t i = 0; i < m_parameters.size(); ++i) {
         value_map[m_parameters.at(i)->output(0)] = input_tensors.at(i);
     }
-    OutputVector outputs;
     std::map<RawNodeOutput, ov::runtime::Tensor> output_tensor_map;
     for (size_t i = 0; i < m_results.size(); ++i) {
         auto result = m_results.at(i)->output(0);
         output_tensor_map[result] = output_tensors.at(i);
-        outputs.push_back(result);
-    }
-    for (const auto& m_sink : m_sinks) {
-        outputs.push_back(m_sink);
-    }
-    // evaluate nodes
-    OPENVINO_SUPPRESS_DEPRECATED_START
-    ngraph::Evaluator<ov::runtime::Tensor> evaluator({}, value_map);
-    evaluator.set_universal_handler(
-        [&output_tensor_map,
-         &evaluation_context](Node* node, const ov::runtime::TensorVector& input_tensors) -> ov::runtime::TensorVector {
-            ov::runtime::TensorVector output_tensors;
-            for (const auto& v : node->outputs()) {
-                auto it = output_tensor_map.find(v);
-                if (it == output_tensor_map.end()) {
-                    if (v.get_partial_shape().is_dynamic() || v.get_element_type().is_dynamic()) {
-                        ov::runtime::Tensor c = create_tmp_tensor(std::make_shared<HostTensor>(v));
-                        output_tensors.push_back(c);
-                    } else {
-                        ov::runtime::Tensor c(v.get_element_type(), v.get_shape());
-                        output_tensors.push_back(c);
-                    }
-                } else {
-                    output_tensors.push_back(it->second);
-                }
+    }
+
+    const auto ordered_ops = get_ordered_ops();
+    std::unordered_map<const Node*, size_t> op_indices;
+    for (size_t i = 0; i < ordered_ops.size(); ++i) {
+        op_indices[ordered_ops[i].get()] = i;
+    }
+
+    // A value is alive from the op producing it till its last consumer. The static intermediate
+    // values share one arena, the values which are not alive at the same time reuse the same memory.
+    std::map<RawNodeOutput, size_t> last_uses;
+    std::vector<ArenaBox> boxes;
+    for (size_t i = 0; i < ordered_ops.size(); ++i) {
+        const auto& node = ordered_ops[i];
+        for (const auto& output : node->outputs()) {
+            size_t last_use = i;
+            for (const auto& target : output.get_target_inputs()) {
+                auto it = op_indices.find(target.get_node());
+                if (it != op_indices.end())
+                    last_use = std::max(last_use, it->second);
             }
-            if (node->evaluate(output_tensors, input_tensors, evaluation_context)) {
-                for (size_t i = 0; i < node->outputs().size(); i++) {
-                    const auto& v = node->output(i);
-                    auto it = output_tensor_map.find(v);
-                    if (it != output_tensor_map.end()) {
-                        it->second = output_tensors[i];
-                    }
-                }
-                return output_tensors;
+            last_uses[output] = last_use;
+            if (op::util::is_parameter(node) || output_tensor_map.count(output) ||
+                output.get_partial_shape().is_dynamic() || output.get_element_type().is_dynamic())
+                continue;
+            boxes.push_back({output, i, last_use, arena_box_size(output), 0});
+        }
+    }
+    ov::runtime::Tensor arena(element::u8, Shape{std::max<size_t>(place_arena_boxes(boxes), 1)});
+    std::map<RawNodeOutput, size_t> arena_offsets;
+    for (const auto& box : boxes) {
+        arena_offsets[box.value] = box.offset;
+    }
+
+    for (size_t i = 0; i < ordered_ops.size(); ++i) {
+        const auto& node = ordered_ops[i];
+        if (op::util::is_parameter(node))
+            continue;
+        ov::runtime::TensorVector node_inputs;
+        for (const auto& v : node->input_values()) {
+            node_inputs.push_back(value_map.at(v));
+        }
+        ov::runtime::TensorVector node_outputs;
+        for (const auto& v : node->outputs()) {
+            auto it = output_tensor_map.find(v);
+            auto offset_it = arena_offsets.find(v);
+            if (it != output_tensor_map.end()) {
+                node_outputs.push_back(it->second);
+            } else if (offset_it != arena_offsets.end()) {
+                node_outputs.emplace_back(v.get_element_type(),
+                                          v.get_shape(),
+                                          static_cast<uint8_t*>(arena.data()) + offset_it->second);
             } else {
-                OPENVINO_ASSERT(false, "Evaluation failed on ", node);
+                node_outputs.push_back(create_tmp_tensor(std::make_shared<HostTensor>(v)));
             }
-        });
-    for (const auto& value : outputs) {
-        evaluator.evaluate(value);
+        }
+        OPENVINO_ASSERT(node->evaluate(node_outputs, node_inputs, evaluation_context), "Evaluation failed on ", node);
+        for (size_t j = 0; j < node_outputs.size(); ++j) {
+            const auto& v = node->output(j);
+            auto it = output_tensor_map.find(v);
+            if (it != output_tensor_map.end()) {
+                it->second = node_outputs[j];
+            }
+            value_map[v] = node_outputs[j];
+        }
+        // the values consumed for the last time are released, the arena memory is reused by the later ops
+        for (const auto& v : node->input_values()) {
+            if (last_uses.at(v) == i)
+                value_map.erase(v);
+        }
     }
-    OPENVINO_SUPPRESS_DEPRECATED_END
+
     for (size_t i = 0; i < m_results.size(); ++i) {
         auto result = m_results.at(i)->output(0);
         output_tensors.at(i) = output_tensor_map[result];
@@ -799,11 +962,14 @@ void ov::Function::reshape(const std::map<std::string, ov::PartialShape>& partia
     }
 
     auto reshape_only = [&](const std::map<std::string, ov::PartialShape>& pshapes) {
+        ov::ParameterVector changed_params;
         for (const auto& pshape : pshapes) {
-            tensor_param_map[pshape.first]->set_partial_shape(pshape.second);
+            const auto& param = tensor_param_map[pshape.first];
+            param->set_partial_shape(pshape.second);
+            changed_params.push_back(param);
         }
 
-        validate_nodes_and_infer_types();
+        validate_nodes_and_infer_types(changed_params);
     };
 
     try {
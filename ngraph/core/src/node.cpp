@@ -919,10 +919,13 @@ bool ov::Node::constant_fold(OutputVector& output_values, const OutputVector& in
     if (!all_constants)
         return false;
 
+    // inputs are not modified by evaluate, so the tensors share data with the constants instead of copying it
     HostTensorVector input_tensors;
     for (const auto& input : input_values) {
-        auto host_tensor = make_shared<ngraph::runtime::HostTensor>(
-            ov::as_type_ptr<ngraph::op::v0::Constant>(input.get_node_shared_ptr()));
+        auto constant = ov::as_type_ptr<ngraph::op::v0::Constant>(input.get_node_shared_ptr());
+        auto host_tensor = make_shared<ngraph::runtime::HostTensor>(constant->get_output_element_type(0),
+                                                                    constant->get_output_shape(0),
+                                                                    const_cast<void*>(constant->get_data_ptr()));
         input_tensors.push_back(host_tensor);
     }
     HostTensorVector output_tensors;
@@ -23,13 +23,13 @@ ov::PartialShape::PartialShape(const Shape& shape)
       m_shape_type(ShapeType::SHAPE_IS_STATIC),
       m_dimensions(shape.begin(), shape.end()) {}
 
-ov::PartialShape::PartialShape(bool rank_is_static, std::vector<Dimension> dimensions)
+ov::PartialShape::PartialShape(bool rank_is_static, Dimensions dimensions)
     : m_rank_is_static(rank_is_static),
       m_dimensions(std::move(dimensions)) {}
 
 ov::PartialShape::PartialShape(std::vector<Dimension> dimensions)
     : m_rank_is_static(true),
-      m_dimensions(std::move(dimensions)) {}
+      m_dimensions(dimensions.begin(), dimensions.end()) {}
 
 bool ov::PartialShape::is_static() const {
     ShapeType shape_type = m_shape_type;
@@ -140,8 +140,7 @@ std::ostream& ov::operator<<(std::ostream& str, const PartialShape& shape) {
 }
 
 ov::PartialShape ov::PartialShape::dynamic(Rank r) {
-    return PartialShape(r.is_static(),
-                        std::vector<Dimension>(r.is_static() ? r.get_length() : 0, Dimension::dynamic()));
+    return PartialShape(r.is_static(), Dimensions(r.is_static() ? r.get_length() : 0, Dimension::dynamic()));
 }
 
 bool ov::PartialShape::compatible(const PartialShape& s) const {
@@ -224,7 +223,7 @@ bool ov::PartialShape::merge_rank(Rank r) {
         return true;
     } else if (!m_rank_is_static) {
         m_rank_is_static = true;
-        m_dimensions = std::vector<Dimension>(r.get_length(), Dimension::dynamic());
+        m_dimensions = Dimensions(r.get_length(), Dimension::dynamic());
         m_shape_type = ShapeType::SHAPE_IS_UNKNOWN;
         return true;
     } else {
@@ -280,14 +279,14 @@ bool ov::PartialShape::broadcast_merge_into(PartialShape& dst,
             auto dst_rank = dst.rank().get_length();
             auto src_rank = src.rank().get_length();
             auto new_rank = std::max(dst_rank, src_rank);
-            std::vector<Dimension> dims(new_rank);
+            Dimensions dims(new_rank);
             bool success = true;
             for (int64_t i = 0; i < new_rank; i++) {
                 auto dsti = i < (new_rank - dst_rank) ? Dimension(1) : dst[i - (new_rank - dst_rank)];
                 auto srci = i < (new_rank - src_rank) ? Dimension(1) : src[i - (new_rank - src_rank)];
                 success &= Dimension::broadcast_merge(dims[i], dsti, srci);
             }
-            dst = PartialShape(std::move(dims));
+            dst = PartialShape(true, std::move(dims));
             return success;
         }
     }
@@ -4,45 +4,93 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
 #include <ngraph/op/constant.hpp>
+#include <thread>
 
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/rt_info.hpp"
 #include "ngraph/validation_util.hpp"
+#include "openvino/op/util/op_types.hpp"
 
 using namespace std;
 
+namespace {
+// nodes which may be folded without looking at the rest of the graph
+bool is_parallel_folding_candidate(const std::shared_ptr<ov::Node>& node) {
+    if (node->get_input_size() == 0 || ov::op::util::is_output(node) || ov::op::util::is_sink(node) ||
+        ov::is_type<ov::op::util::MultiSubGraphOp>(node))
+        return false;
+    for (const auto& output : node->outputs()) {
+        if (output.get_partial_shape().is_dynamic())
+            return false;
+    }
+    for (const auto& input : node->input_values()) {
+        if (!ov::is_type<ov::op::v0::Constant>(input.get_node()))
+            return false;
+    }
+    return true;
+}
+
+size_t get_outputs_size(const std::shared_ptr<ov::Node>& node) {
+    size_t size = 0;
+    for (const auto& output : node->outputs())
+        size += ov::shape_size(output.get_shape()) * output.get_element_type().size();
+    return size;
+}
+
+template <typename F>
+void parallel_for(size_t work_amount, const F& func) {
+    const size_t threads_num = std::min<size_t>(work_amount, std::max(1u, std::thread::hardware_concurrency()));
+    if (threads_num <= 1) {
+        for (size_t i = 0; i < work_amount; ++i)
+            func(i);
+        return;
+    }
+
+    std::atomic<size_t> next_work{0};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto worker = [&]() {
+        for (size_t i = next_work++; i < work_amount; i = next_work++) {
+            try {
+                func(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(threads_num - 1);
+    for (size_t i = 0; i < threads_num - 1; ++i)
+        threads.emplace_back(worker);
+    worker();
+    for (auto& thread : threads)
+        thread.join();
+    if (error)
+        std::rethrow_exception(error);
+}
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_function(std::shared_ptr<ov::Function> f) {
     bool rewritten = pre_calculated_values_folding(f);
 
+    std::unordered_set<Node*> not_folded;
+    rewritten |= parallel_folding(f, not_folded);
+
     for (const auto& node : f->get_ordered_ops()) {
         if (rewritten) {
             node->validate_and_infer_types();
         }
 
         OutputVector replacements(node->get_output_size());
-        if (node->constant_fold(replacements, node->input_values())) {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    if (replacements.size() == 1) {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
-                    } else {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
-                                                                             std::to_string(i));
-                    }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
-
-                    rewritten = true;
-                }
-            }
+        if (!not_folded.count(node.get()) && node->constant_fold(replacements, node->input_values())) {
+            rewritten |= replace_outputs(node, replacements);
         } else {
             // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
             if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
@@ -57,6 +105,89 @@ bool ov::pass::ConstantFolding::run_on_function(std::shared_ptr<ov::Function> f)
     return rewritten;
 }
 
+bool ov::pass::ConstantFolding::replace_outputs(const std::shared_ptr<Node>& node, const OutputVector& replacements) {
+    NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                 "constant_fold_default returned incorrect number of replacements for ",
+                 node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i) {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+            if (replacements.size() == 1) {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+            } else {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
+                                                                     std::to_string(i));
+            }
+            node_output.replace(replacement);
+            // Propagate runtime info attributes to replacement consumer nodes
+            copy_runtime_info_to_target_inputs(node, replacement);
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::parallel_folding(const std::shared_ptr<ov::Function>& f,
+                                                 std::unordered_set<Node*>& not_folded) {
+    std::vector<std::shared_ptr<Node>> wave;
+    for (const auto& node : f->get_ordered_ops()) {
+        if (is_parallel_folding_candidate(node))
+            wave.push_back(node);
+    }
+
+    bool rewritten = false;
+    while (!wave.empty()) {
+        std::vector<std::shared_ptr<Node>> next_wave;
+        std::unordered_set<Node*> next_wave_nodes;
+        for (size_t begin = 0; begin < wave.size();) {
+            // the batch is limited by the size of the outputs which are alive at the same time
+            size_t end = begin + 1;
+            size_t batch_size = get_outputs_size(wave[begin]);
+            while (end < wave.size() && batch_size + get_outputs_size(wave[end]) <= m_memory_limit) {
+                batch_size += get_outputs_size(wave[end]);
+                end++;
+            }
+
+            std::vector<OutputVector> replacements(end - begin);
+            std::unique_ptr<std::atomic<bool>[]> folded(new std::atomic<bool>[end - begin]);
+            parallel_for(end - begin, [&](size_t i) {
+                const auto& node = wave[begin + i];
+                replacements[i].resize(node->get_output_size());
+                folded[i] = node->constant_fold(replacements[i], node->input_values());
+            });
+
+            for (size_t i = 0; i < end - begin; ++i) {
+                // the folded node is released right after replacement together with the input constants
+                // which are not used by other nodes
+                const auto node = std::move(wave[begin + i]);
+                if (!folded[i]) {
+                    not_folded.insert(node.get());
+                    continue;
+                }
+                if (!replace_outputs(node, replacements[i]))
+                    continue;
+                rewritten = true;
+                for (const auto& replacement : replacements[i]) {
+                    for (const auto& input : replacement.get_target_inputs()) {
+                        auto consumer = input.get_node()->shared_from_this();
+                        if (!next_wave_nodes.count(consumer.get()) && is_parallel_folding_candidate(consumer)) {
+                            next_wave_nodes.insert(consumer.get());
+                            next_wave.push_back(consumer);
+                        }
+                    }
+                }
+            }
+            begin = end;
+        }
+        wave = std::move(next_wave);
+    }
+    return rewritten;
+}
+
 void ngraph::pass::ConstantFolding::copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                                        const Output<Node>& replacement) {
     for (auto& input : replacement.get_target_inputs()) {
@@ -7,8 +7,10 @@
 #include <algorithm>
 #include <deque>
 #include <iostream>
+#include <ngraph/pattern/op/or.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <regex>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -61,6 +63,38 @@ PerfCounters& perf_counters_graph_rewrite() {
 }  // namespace pass
 }  // namespace ov
 
+namespace {
+// Collects the types of the nodes the pattern root can match. Returns false if the root can match a node
+// of any type.
+bool collect_root_types(std::shared_ptr<ov::Node> root, std::vector<ov::NodeTypeInfo>& root_types) {
+    // pattern::op::AnyOutput operation automatically appends for multi output operations inside
+    // Matcher and to gen actual root node we need to take it's parent.
+    if (auto any_output = std::dynamic_pointer_cast<ov::pass::pattern::op::AnyOutput>(root)) {
+        root = any_output->input_value(0).get_node_shared_ptr();
+    }
+
+    // if root is an operation from opset or has pattern::op::WrapType type then we can extract
+    // it's type
+    if (auto wrap_type = std::dynamic_pointer_cast<ov::pass::pattern::op::WrapType>(root)) {
+        const auto& wrapped_types = wrap_type->get_wrapped_types();
+        root_types.insert(root_types.end(), wrapped_types.begin(), wrapped_types.end());
+        return true;
+    }
+    // pattern::op::Or matches if one of its alternatives matches
+    if (std::dynamic_pointer_cast<ov::pass::pattern::op::Or>(root)) {
+        for (const auto& alternative : root->input_values()) {
+            if (!collect_root_types(alternative.get_node_shared_ptr(), root_types))
+                return false;
+        }
+        return true;
+    }
+    if (std::dynamic_pointer_cast<ov::pass::pattern::op::Pattern>(root))
+        return false;
+    root_types.push_back(root->get_type_info());
+    return true;
+}
+}  // namespace
+
 bool ov::pass::BackwardGraphRewrite::run_on_function(std::shared_ptr<ov::Function> f) {
     // Initialize execution queue with nodes in topological order
     std::deque<std::weak_ptr<Node>> nodes_to_run;
@@ -86,47 +120,55 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Function> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // Matchers with type based root are indexed by the root type, the others are tried on every node
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> untyped_matchers;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
             continue;
 
         auto matcher = m_matchers[matcher_index]->get_matcher();
-        if (!matcher) {
-            all_roots_has_type = false;
-            break;
+        std::vector<NodeTypeInfo> root_types;
+        if (!matcher || !collect_root_types(matcher->get_pattern_value().get_node_shared_ptr(), root_types)) {
+            untyped_matchers.push_back(matcher_index);
+            continue;
         }
-
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = std::dynamic_pointer_cast<pattern::op::AnyOutput>(root)) {
-            root = any_type->input_value(0).get_node_shared_ptr();
+        for (const auto& root_type_info : root_types) {
+            type_to_matcher[root_type_info].push_back(matcher_index);
         }
+    }
 
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
-        if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
-            if (auto any_type = std::dynamic_pointer_cast<pattern::op::WrapType>(p)) {
-                for (const auto& root_type_info : any_type->get_wrapped_types()) {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
-                }
-            } else {
-                all_roots_has_type = false;
-                break;
-            }
-        } else {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
+    // Matchers for every node type including the ones registered for its parent types, in order of
+    // the registration. Computed once for each type met in the function.
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> matchers_for_type;
+    auto get_matchers = [&](const std::shared_ptr<Node>& node) -> const std::vector<size_t>& {
+        const auto& type_info = node->get_type_info();
+        auto it = matchers_for_type.find(type_info);
+        if (it != matchers_for_type.end())
+            return it->second;
+
+        std::vector<size_t> matchers = untyped_matchers;
+        for (auto node_type_info = &type_info; node_type_info; node_type_info = node_type_info->parent) {
+            auto typed = type_to_matcher.find(*node_type_info);
+            if (typed != type_to_matcher.end())
+                matchers.insert(matchers.end(), typed->second.begin(), typed->second.end());
         }
+        std::sort(matchers.begin(), matchers.end());
+        matchers.erase(std::unique(matchers.begin(), matchers.end()), matchers.end());
+        return matchers_for_type.emplace(type_info, std::move(matchers)).first->second;
+    };
 
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
-    }
+    // Function::is_dynamic traverses the whole function, so its result is kept until the graph is changed
+    bool dynamic_state_known = false;
+    bool is_dynamic = false;
+    auto function_is_dynamic = [&]() {
+        if (!dynamic_state_known || m_enable_shape_inference) {
+            is_dynamic = f->is_dynamic();
+            dynamic_state_known = true;
+        }
+        return is_dynamic;
+    };
 
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
@@ -134,7 +176,7 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Function> f,
     auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass, std::shared_ptr<Node> node) -> bool {
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
-        if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic()) {
+        if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && function_is_dynamic()) {
             NGRAPH_DEBUG << "matcher callback requires static shape but the "
                             "function is dynamic, skipping this "
                             "optimization till the shapes are fully "
@@ -156,13 +198,13 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Function> f,
                 nodes_to_run.emplace_front(*it);
             }
             m_pass->clear_new_nodes();
+            dynamic_state_known = false;
         }
+        if (status)
+            dynamic_state_known = false;
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
         nodes_to_run.pop_front();
@@ -183,47 +225,11 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Function> f,
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
 
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
-            }
-        }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
-                }
+        for (size_t matcher_index : get_matchers(node)) {
+            if (run_matcher_pass(m_matchers[matcher_index], node)) {
+                rewritten = true;
+                break;
             }
         }
     }
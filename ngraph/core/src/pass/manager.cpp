@@ -36,6 +36,12 @@ PerfCounters& perf_counters() {
 }  // namespace pass
 }  // namespace ov
 
+std::ostream& ov::pass::operator<<(std::ostream& s, const PassStatistics& statistics) {
+    return s << "Pass " << statistics.name << ": " << statistics.time_us << "us, nodes " << statistics.nodes_before
+             << " -> " << statistics.nodes_after << ", graph size " << statistics.graph_size_before << " -> "
+             << statistics.graph_size_after << " bytes";
+}
+
 ov::pass::Manager::Manager()
     : m_pass_config(std::make_shared<PassConfig>()),
       m_visualize(ov::util::getenv_bool("NGRAPH_ENABLE_VISUALIZE_TRACING")) {}
@@ -44,17 +50,21 @@ ov::pass::Manager::~Manager() = default;
 
 ov::pass::Manager::Manager(std::shared_ptr<ov::pass::PassConfig> pass_config) : m_pass_config(std::move(pass_config)) {}
 
-void ov::pass::Manager::run_passes(shared_ptr<ov::Function> func) {
+bool ov::pass::Manager::run_passes(shared_ptr<ov::Function> func) {
     NGRAPH_SUPPRESS_DEPRECATED_START
     OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "pass::Manager::run_passes");
 
     static bool profile_enabled = ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+    static bool log_statistics = ov::util::getenv_bool("NGRAPH_PASS_STATISTICS");
+    const bool collect_statistics = m_per_pass_statistics || log_statistics;
+    m_pass_statistics.clear();
 
     size_t index = 0;
     ngraph::stopwatch pass_timer;
     ngraph::stopwatch overall_timer;
     overall_timer.start();
     bool function_changed = false;
+    bool any_pass_changed = false;
     for (auto& pass : m_pass_list) {
         if (m_pass_config->is_disabled(pass->get_type_info())) {
             NGRAPH_DEBUG << "Pass " << pass->get_name() << " is disabled";
@@ -65,6 +75,14 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Function> func) {
                      ov::itt::domains::nGraphPass_LT,
                      pass::internal::perf_counters()[pass->get_type_info()]);
 
+        const bool pass_statistics = collect_statistics && !dynamic_pointer_cast<Validate>(pass);
+        PassStatistics statistics;
+        if (pass_statistics) {
+            statistics.name = pass->get_name();
+            statistics.nodes_before = func->get_ops().size();
+            statistics.graph_size_before = static_cast<int64_t>(func->get_graph_size());
+        }
+
         pass_timer.start();
 
         if (auto matcher_pass = dynamic_pointer_cast<MatcherPass>(pass)) {
@@ -105,6 +123,7 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Function> func) {
                 function_changed |= node_pass->run_on_node(n);
             }
         }
+        any_pass_changed |= function_changed;
 
         if (m_visualize) {
             // visualizations and serializations will be named after the outermost function
@@ -122,6 +141,14 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Function> func) {
         }
         index++;
         pass_timer.stop();
+        if (pass_statistics) {
+            statistics.time_us = static_cast<uint64_t>(pass_timer.get_microseconds());
+            statistics.nodes_after = func->get_ops().size();
+            statistics.graph_size_after = static_cast<int64_t>(func->get_graph_size());
+            if (log_statistics)
+                NGRAPH_INFO << statistics;
+            m_pass_statistics.push_back(std::move(statistics));
+        }
         if (profile_enabled) {
             cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
         }
@@ -130,4 +157,5 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Function> func) {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
     }
     NGRAPH_SUPPRESS_DEPRECATED_END
+    return any_pass_changed;
 }
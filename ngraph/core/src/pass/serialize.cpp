@@ -79,41 +79,64 @@ class ConstantWriter {
 public:
     using FilePosition = int64_t;
     using HashValue = size_t;
-    using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const*>>;
+    struct WrittenConstant {
+        FilePosition offset;
+        void const* ptr;
+        size_t size;
+    };
+    using ConstWritePositions = std::unordered_multimap<HashValue, WrittenConstant>;
 
-    ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
+    ConstantWriter(std::ostream& bin_data, bool enable_compression = true, bool enable_alignment = false)
         : m_binary_output(bin_data),
           m_enable_compression(enable_compression),
+          m_enable_alignment(enable_alignment),
           m_blob_offset(bin_data.tellp()) {}
 
     FilePosition write(const char* ptr, size_t size) {
-        const FilePosition write_pos = m_binary_output.tellp();
-        const auto offset = write_pos - m_blob_offset;
         if (!m_enable_compression) {
-            m_binary_output.write(ptr, size);
-            return offset;
+            return write_data(ptr, size);
         }
         // This hash is weak (but efficient) and must be replace with some other
         // more stable hash algorithm. For example current hash algorithms gives
         // the same hash for {2, 2} and {0, 128} arrays. So we have to compare
-        // values when finding a match in hash map.
+        // values of all constants with the same hash when finding a match.
         const HashValue hash = hash_combine(ptr, size);
-        const auto found = m_hash_to_file_positions.find(hash);
-        if (found != end(m_hash_to_file_positions) &&
-            memcmp(static_cast<void const*>(ptr), found->second.second, size) == 0) {
-            return found->second.first;
+        const auto found = m_hash_to_file_positions.equal_range(hash);
+        for (auto it = found.first; it != found.second; ++it) {
+            const auto& written = it->second;
+            if (written.size == size && (written.ptr == ptr || memcmp(ptr, written.ptr, size) == 0)) {
+                return written.offset;
+            }
         }
 
-        m_binary_output.write(ptr, size);
-        m_hash_to_file_positions.insert({hash, {offset, static_cast<void const*>(ptr)}});
-
+        const auto offset = write_data(ptr, size);
+        m_hash_to_file_positions.insert({hash, {offset, static_cast<void const*>(ptr), size}});
         return offset;
     }
 
 private:
+    FilePosition write_data(const char* ptr, size_t size) {
+        auto offset = static_cast<FilePosition>(m_binary_output.tellp()) - m_blob_offset;
+        if (m_enable_alignment) {
+            // large constants are aligned to page, so they can be mapped from the file directly
+            const FilePosition alignment = size >= ov::pass::Serialize::page_alignment
+                                               ? ov::pass::Serialize::page_alignment
+                                               : ov::pass::Serialize::constant_alignment;
+            const auto padding_size = (alignment - offset % alignment) % alignment;
+            if (padding_size > 0) {
+                static const std::array<char, ov::pass::Serialize::page_alignment> padding{};
+                m_binary_output.write(padding.data(), padding_size);
+                offset += padding_size;
+            }
+        }
+        m_binary_output.write(ptr, size);
+        return offset;
+    }
+
     ConstWritePositions m_hash_to_file_positions;
     std::ostream& m_binary_output;
     bool m_enable_compression;
+    bool m_enable_alignment;
     FilePosition m_blob_offset;  // blob offset inside output stream
 };
 
@@ -1054,6 +1077,382 @@ std::string provide_bin_path(const std::string& xmlPath, const std::string& binP
     return bestPath;
 }
 
+namespace binary_ir {
+using AttributeKind = ov::pass::BinarySerialize::AttributeKind;
+
+// Appends values to the memory buffer, all values are stored in native byte order
+class Writer {
+public:
+    template <typename T>
+    void write(const T& value) {
+        m_data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void write_string(const std::string& value) {
+        write<uint64_t>(value.size());
+        m_data.append(value);
+    }
+
+    template <typename T>
+    void write_vector(const std::vector<T>& value) {
+        write<uint64_t>(value.size());
+        m_data.append(reinterpret_cast<const char*>(value.data()), value.size() * sizeof(T));
+    }
+
+    void write_strings(const std::vector<std::string>& value) {
+        write<uint64_t>(value.size());
+        for (const auto& item : value) {
+            write_string(item);
+        }
+    }
+
+    void append(const std::string& data) {
+        m_data.append(data);
+    }
+
+    const std::string& data() const {
+        return m_data;
+    }
+
+private:
+    std::string m_data;
+};
+
+// Writes constants data aligned relatively to the beginning of the file,
+// data of constants sharing the same buffer is written once
+class ConstantWriter {
+public:
+    ConstantWriter(std::ostream& stream, std::streamoff file_begin) : m_stream(stream), m_file_begin(file_begin) {}
+
+    uint64_t write(const char* ptr, size_t size) {
+        const auto found = m_positions.find({ptr, size});
+        if (found != m_positions.end()) {
+            return found->second;
+        }
+        static const std::array<char, ov::pass::BinarySerialize::alignment> padding{};
+        auto offset = static_cast<uint64_t>(m_stream.tellp() - m_file_begin);
+        const auto padding_size = (padding.size() - offset % padding.size()) % padding.size();
+        m_stream.write(padding.data(), padding_size);
+        offset += padding_size;
+        m_stream.write(ptr, size);
+        m_positions.insert({{ptr, size}, offset});
+        return offset;
+    }
+
+private:
+    std::ostream& m_stream;
+    std::streamoff m_file_begin;
+    std::map<std::pair<const char*, size_t>, uint64_t> m_positions;
+};
+
+void serialize_function(Writer& out,
+                        const ngraph::Function& f,
+                        ConstantWriter& constant_writer,
+                        const std::map<std::string, ngraph::OpSet>& custom_opsets);
+
+// Stores each visited attribute as a (name, kind, payload) record
+class AttributeWriter : public ngraph::AttributeVisitor {
+public:
+    // constant_writer is nullptr for runtime info attributes which must not contain data blobs
+    AttributeWriter(ConstantWriter* constant_writer, const std::map<std::string, ngraph::OpSet>& custom_opsets)
+        : m_constant_writer(constant_writer),
+          m_custom_opsets(custom_opsets) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        using InputDescriptions = std::vector<std::shared_ptr<ngraph::op::util::MultiSubGraphOp::InputDescription>>;
+        using OutputDescriptions = std::vector<std::shared_ptr<ngraph::op::util::MultiSubGraphOp::OutputDescription>>;
+
+        Writer payload;
+        if (auto a = ov::as_type<ov::AttributeAdapter<std::set<std::string>>>(&adapter)) {
+            const auto& value = a->get();
+            payload.write_strings({value.begin(), value.end()});
+            append(name, AttributeKind::VEC_STRING, payload);
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<InputDescriptions>>(&adapter)) {
+            payload.write<uint64_t>(a->get().size());
+            for (const auto& input_description : a->get()) {
+                uint8_t input_kind;
+                if (ov::as_type_ptr<ngraph::op::util::SubGraphOp::SliceInputDescription>(input_description)) {
+                    input_kind = 0;
+                } else if (ov::as_type_ptr<ngraph::op::util::SubGraphOp::MergedInputDescription>(input_description)) {
+                    input_kind = 1;
+                } else if (ov::as_type_ptr<ngraph::op::util::SubGraphOp::InvariantInputDescription>(
+                               input_description)) {
+                    input_kind = 2;
+                } else {
+                    throw ngraph_error("Unsupported input description type for serialization: " + name);
+                }
+                payload.write(input_kind);
+                payload.write(input_description->m_input_index);
+                payload.write(input_description->m_body_parameter_index);
+                if (const auto slice =
+                        ov::as_type_ptr<ngraph::op::util::SubGraphOp::SliceInputDescription>(input_description)) {
+                    payload.write(slice->m_start);
+                    payload.write(slice->m_stride);
+                    payload.write(slice->m_part_size);
+                    payload.write(slice->m_end);
+                    payload.write(slice->m_axis);
+                } else if (const auto merged = ov::as_type_ptr<ngraph::op::util::SubGraphOp::MergedInputDescription>(
+                               input_description)) {
+                    payload.write(merged->m_body_value_index);
+                }
+            }
+            append(name, AttributeKind::INPUT_DESCRIPTIONS, payload);
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<OutputDescriptions>>(&adapter)) {
+            payload.write<uint64_t>(a->get().size());
+            for (const auto& output_description : a->get()) {
+                const auto body =
+                    ov::as_type_ptr<ngraph::op::util::SubGraphOp::BodyOutputDescription>(output_description);
+                const auto concat =
+                    ov::as_type_ptr<ngraph::op::util::SubGraphOp::ConcatOutputDescription>(output_description);
+                if (!body && !concat) {
+                    throw ngraph_error("Unsupported output description type for serialization: " + name);
+                }
+                payload.write<uint8_t>(body ? 0 : 1);
+                payload.write(output_description->m_body_value_index);
+                payload.write(output_description->m_output_index);
+                if (body) {
+                    payload.write(body->m_iteration);
+                } else {
+                    payload.write(concat->m_start);
+                    payload.write(concat->m_stride);
+                    payload.write(concat->m_part_size);
+                    payload.write(concat->m_end);
+                    payload.write(concat->m_axis);
+                }
+            }
+            append(name, AttributeKind::OUTPUT_DESCRIPTIONS, payload);
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(
+                       &adapter)) {
+            payload.write(a->get().current_iteration_input_idx);
+            payload.write(a->get().body_condition_output_idx);
+            append(name, AttributeKind::SPECIAL_BODY_PORTS, payload);
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+            payload.write_string(a->get()->get_info().variable_id);
+            append(name, AttributeKind::VARIABLE, payload);
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+                       &adapter)) {
+            NGRAPH_CHECK(m_constant_writer, "Data blobs are not supported in runtime info: ", name);
+            const uint64_t size = a->get()->size();
+            payload.write(m_constant_writer->write(static_cast<const char*>(a->get()->get_ptr()), size));
+            payload.write(size);
+            append(name, AttributeKind::CONSTANT_DATA, payload);
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(&adapter)) {
+            const auto& attrs = a->get();
+            // sorted to keep the output deterministic
+            const std::map<std::string, std::string> sorted_attrs(attrs.begin(), attrs.end());
+            payload.write_string(attrs.get_type_name());
+            payload.write_string(attrs.get_opset_name());
+            payload.write<uint64_t>(sorted_attrs.size());
+            for (const auto& attr : sorted_attrs) {
+                payload.write_string(attr.first);
+                payload.write_string(attr.second);
+            }
+            append(name, AttributeKind::FRAMEWORK_NODE_ATTRS, payload);
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::element::TypeVector>>(&adapter)) {
+            std::vector<std::string> types;
+            for (const auto& type : a->get()) {
+                types.push_back(ov::as_string(static_cast<ov::element::Type_t>(type)));
+            }
+            payload.write_strings(types);
+            append(name, AttributeKind::TYPE_VECTOR, payload);
+        } else {
+            throw ngraph_error("Unsupported attribute type for serialization: " + name);
+        }
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        Writer payload;
+        payload.write<uint8_t>(adapter.get() ? 1 : 0);
+        append(name, AttributeKind::BOOL, payload);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        Writer payload;
+        payload.append(adapter.get());
+        append(name, AttributeKind::STRING, payload);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        Writer payload;
+        payload.write(adapter.get());
+        append(name, AttributeKind::INT64, payload);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        Writer payload;
+        payload.write(adapter.get());
+        append(name, AttributeKind::DOUBLE, payload);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int>>& adapter) override {
+        Writer payload;
+        payload.write_vector(adapter.get());
+        append(name, AttributeKind::VEC_INT32, payload);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        Writer payload;
+        payload.write_vector(adapter.get());
+        append(name, AttributeKind::VEC_INT64, payload);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        Writer payload;
+        payload.write_vector(adapter.get());
+        append(name, AttributeKind::VEC_UINT64, payload);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        Writer payload;
+        payload.write_vector(adapter.get());
+        append(name, AttributeKind::VEC_FLOAT, payload);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        Writer payload;
+        payload.write_strings(adapter.get());
+        append(name, AttributeKind::VEC_STRING, payload);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<Function>>& adapter) override {
+        NGRAPH_CHECK(m_constant_writer, "Function type is unsupported for rt info serialization");
+        Writer payload;
+        serialize_function(payload, *adapter.get(), *m_constant_writer, m_custom_opsets);
+        append(name, AttributeKind::FUNCTION, payload);
+    }
+
+    uint64_t count() const {
+        return m_count;
+    }
+
+    const std::string& data() const {
+        return m_records.data();
+    }
+
+private:
+    void append(const std::string& name, AttributeKind kind, const Writer& payload) {
+        m_records.write_string(name);
+        m_records.write(kind);
+        m_records.write_string(payload.data());
+        ++m_count;
+    }
+
+    ConstantWriter* m_constant_writer;
+    const std::map<std::string, ngraph::OpSet>& m_custom_opsets;
+    Writer m_records;
+    uint64_t m_count = 0;
+};
+
+void write_attributes(Writer& out, const AttributeWriter& attributes) {
+    out.write(attributes.count());
+    out.append(attributes.data());
+}
+
+void write_runtime_info(Writer& out, const RTMap& rt_info) {
+    static const std::map<std::string, ngraph::OpSet> no_opsets;
+    Writer items;
+    uint64_t count = 0;
+    for (const auto& item : rt_info) {
+        AttributeWriter visitor(nullptr, no_opsets);
+        if (!item.second->visit_attributes(visitor)) {
+            continue;
+        }
+        items.write_string(item.second->get_type_info().name);
+        items.write_string(item.second->get_type_info().get_version());
+        write_attributes(items, visitor);
+        ++count;
+    }
+    out.write(count);
+    out.append(items.data());
+}
+
+void write_partial_shape(Writer& out, const ngraph::PartialShape& shape) {
+    if (shape.rank().is_dynamic()) {
+        out.write<int64_t>(-1);
+        return;
+    }
+    out.write<int64_t>(shape.rank().get_length());
+    for (const auto& d : shape) {
+        out.write<int64_t>(d.get_min_length());
+        out.write<int64_t>(d.get_max_length());
+    }
+}
+
+void serialize_function(Writer& out,
+                        const ngraph::Function& f,
+                        ConstantWriter& constant_writer,
+                        const std::map<std::string, ngraph::OpSet>& custom_opsets) {
+    NGRAPH_CHECK(!is_exec_graph(f), "Execution graph can not be serialized to binary IR");
+
+    const auto ordered_ops = f.get_ordered_ops();
+    std::unordered_map<const ngraph::Node*, uint64_t> node_ids;
+    for (const auto& node : ordered_ops) {
+        const auto id = static_cast<uint64_t>(node_ids.size());
+        node_ids[node.get()] = id;
+    }
+    const auto get_id = [&node_ids](const ngraph::Node* node) {
+        const auto found = node_ids.find(node);
+        NGRAPH_CHECK(found != node_ids.end(), "Internal error: node ", node, " is not found in the function");
+        return found->second;
+    };
+
+    out.write_string(f.get_friendly_name());
+    out.write<uint64_t>(ordered_ops.size());
+    for (const auto& node : ordered_ops) {
+        AttributeWriter visitor(&constant_writer, custom_opsets);
+        NGRAPH_CHECK(node->visit_attributes(visitor), "Visitor API is not supported in ", node);
+        // Legacy string runtime info is stored together with attributes, as in XML IR
+        for (const auto& rt_info_name : rt_info::list_of_names) {
+            const auto found = node->get_rt_info().find(rt_info_name);
+            if (found != node->get_rt_info().end()) {
+                if (auto v = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(found->second)) {
+                    auto value = v->get();
+                    visitor.on_attribute(rt_info_name, value);
+                }
+            }
+        }
+
+        if (const auto framework_node = ov::as_type<ov::op::util::FrameworkNode>(node.get())) {
+            out.write_string(framework_node->get_attrs().get_type_name());
+            out.write_string(framework_node->get_attrs().get_opset_name());
+        } else {
+            out.write_string(node->get_type_name());
+            out.write_string(get_opset_name(node.get(), custom_opsets));
+        }
+        out.write_string(node->get_friendly_name());
+
+        out.write<uint64_t>(node->get_input_size());
+        for (const auto& input : node->inputs()) {
+            const auto source = input.get_source_output();
+            out.write(get_id(source.get_node()));
+            out.write<uint64_t>(source.get_index());
+        }
+        out.write<uint64_t>(node->get_control_dependencies().size());
+        for (const auto& dependency : node->get_control_dependencies()) {
+            out.write(get_id(dependency.get()));
+        }
+        out.write<uint64_t>(node->get_output_size());
+        for (const auto& output : node->outputs()) {
+            out.write_string(ov::as_string(static_cast<ov::element::Type_t>(output.get_element_type())));
+            write_partial_shape(out, output.get_partial_shape());
+            const auto& names = output.get_tensor().get_names();
+            std::vector<std::string> sorted_names(names.begin(), names.end());
+            std::sort(sorted_names.begin(), sorted_names.end());
+            out.write_strings(sorted_names);
+        }
+
+        write_attributes(out, visitor);
+        write_runtime_info(out, node->get_rt_info());
+        for (const auto& input : node->inputs()) {
+            write_runtime_info(out, input.get_rt_info());
+        }
+        for (const auto& output : node->outputs()) {
+            write_runtime_info(out, output.get_rt_info());
+        }
+    }
+
+    const auto write_ids = [&](const std::vector<std::shared_ptr<ngraph::Node>>& nodes) {
+        out.write<uint64_t>(nodes.size());
+        for (const auto& node : nodes) {
+            out.write(get_id(node.get()));
+        }
+    };
+    write_ids({f.get_parameters().begin(), f.get_parameters().end()});
+    write_ids({f.get_results().begin(), f.get_results().end()});
+    write_ids({f.get_sinks().begin(), f.get_sinks().end()});
+}
+}  // namespace binary_ir
 }  // namespace
 
 namespace ov {
@@ -1080,7 +1479,7 @@ bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
         std::string name = "net";
         pugi::xml_document xml_doc;
         pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-        ConstantWriter constant_write_handler(bin_file);
+        ConstantWriter constant_write_handler(bin_file, true, m_align_constants);
         XmlSerializer visitor(net_node, name, m_custom_opsets, constant_write_handler, version);
         visitor.on_attribute(name, f);
 
@@ -1117,6 +1516,9 @@ bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
     return false;
 }
 
+constexpr size_t pass::Serialize::constant_alignment;
+constexpr size_t pass::Serialize::page_alignment;
+
 pass::Serialize::Serialize(std::ostream& xmlFile,
                            std::ostream& binFile,
                            std::map<std::string, ngraph::OpSet> custom_opsets,
@@ -1223,4 +1625,81 @@ bool pass::StreamSerialize::run_on_function(std::shared_ptr<ngraph::Function> f)
     // Return false because we didn't change nGraph Function
     return false;
 }
+
+const char pass::BinarySerialize::magic[8] = {'O', 'V', 'B', 'I', 'N', 'I', 'R', '\0'};
+constexpr uint32_t pass::BinarySerialize::format_version;
+constexpr uint64_t pass::BinarySerialize::alignment;
+
+pass::BinarySerialize::BinarySerialize(std::ostream& stream, std::map<std::string, ngraph::OpSet> custom_opsets)
+    : m_stream(&stream),
+      m_custom_opsets(std::move(custom_opsets)) {}
+
+pass::BinarySerialize::BinarySerialize(const std::string& path, std::map<std::string, ngraph::OpSet> custom_opsets)
+    : m_stream(nullptr),
+      m_path(path),
+      m_custom_opsets(std::move(custom_opsets)) {}
+
+bool pass::BinarySerialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    auto serializeFunc = [&](std::ostream& stream) {
+        auto version = static_cast<int64_t>(Serialize::Version::IR_V11);
+        auto& rt_info = f->get_rt_info();
+        if (rt_info.count("version")) {
+            auto version_var = std::dynamic_pointer_cast<VariantWrapper<int64_t>>(rt_info.at("version"));
+            version = version_var->get();
+        }
+        if (version != static_cast<int64_t>(Serialize::Version::IR_V10) &&
+            version != static_cast<int64_t>(Serialize::Version::IR_V11)) {
+            throw ngraph_error("Unsupported version");
+        }
+
+        DataHeader hdr = {};
+        std::copy(std::begin(magic), std::end(magic), hdr.magic);
+        hdr.format_version = format_version;
+        hdr.ir_version = static_cast<uint32_t>(version);
+
+        auto writeHeader = [&stream](const DataHeader& hdr) {
+            stream.write((const char*)&hdr, sizeof hdr);
+        };
+
+        // Header
+        const std::streamoff header_offset = stream.tellp();
+        writeHeader(hdr);
+
+        // Blobs are written while the model is encoded to the memory buffer
+        hdr.consts_offset = stream.tellp() - header_offset;
+        binary_ir::ConstantWriter constant_writer(stream, header_offset);
+        binary_ir::Writer model;
+        binary_ir::serialize_function(model, *f, constant_writer, m_custom_opsets);
+
+        // Model
+        hdr.model_offset = stream.tellp() - header_offset;
+        stream.write(model.data().data(), model.data().size());
+        const std::streamoff file_end = stream.tellp();
+
+        hdr.consts_size = hdr.model_offset - hdr.consts_offset;
+        hdr.model_size = model.data().size();
+
+        stream.seekp(header_offset);
+        writeHeader(hdr);
+        stream.seekp(file_end);
+        stream.flush();
+    };
+
+    if (m_stream) {
+        serializeFunc(*m_stream);
+    } else {
+        std::ofstream file(m_path, std::ios::out | std::ios::binary);
+        NGRAPH_CHECK(file, "Can't open binary IR file: \"" + m_path + "\"");
+        try {
+            serializeFunc(file);
+        } catch (...) {
+            file.close();
+            std::remove(m_path.c_str());
+            throw;
+        }
+    }
+
+    // Return false because we didn't change nGraph Function
+    return false;
+}
 }  // namespace ov
@@ -30,7 +30,7 @@ bool ngraph::pass::SmartReshape::run_on_function(std::shared_ptr<ngraph::Functio
     static_manager.register_pass<ngraph::pass::StridedSliceSqueeze>();
     static_manager.register_pass<ngraph::pass::ReshapeTo1D>();
     static_manager.register_pass<ngraph::pass::TransposeMatMul>();
-    static_manager.run_passes(f);
+    bool function_changed = static_manager.run_passes(f);
 
     ngraph::pass::Manager dynamic_manager;
     // function revalidation will cause "fake" dynamism due to ShapeOf ops insertions
@@ -38,6 +38,8 @@ bool ngraph::pass::SmartReshape::run_on_function(std::shared_ptr<ngraph::Functio
     dynamic_manager.set_per_pass_validation(false);
     dynamic_manager.register_pass<ngraph::pass::ReshapeAMatMul>();
     dynamic_manager.register_pass<ngraph::pass::ReshapeBMatMul>();
-    dynamic_manager.run_passes(f);
-    return true;
+    function_changed |= dynamic_manager.run_passes(f);
+    // the function is validated after the pass only if it was changed, so the reshape of an unchanged function
+    // revalidates just the nodes depending on the reshaped inputs
+    return function_changed;
 }
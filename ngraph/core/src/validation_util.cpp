@@ -8,6 +8,7 @@
 #include <ngraph/ops.hpp>
 #include <ngraph/rt_info.hpp>
 #include <numeric>
+#include <unordered_set>
 
 #include "ngraph/evaluator.hpp"
 #include "ngraph/op/concat.hpp"
@@ -1141,28 +1142,48 @@ void ngraph::evaluate_nodes(std::map<RawNodeOutput, HostTensorPtr>& value_map,
     }
 }
 
-bool ngraph::could_propagate(const Output<Node>& output, std::vector<Node*>& order) {
-    bool status = true;
-
-    std::deque<Node*> nodes_to_calculate = {output.get_node()};
-    order.push_back(output.get_node());
-
-    while (status && !nodes_to_calculate.empty()) {
-        auto current_node = nodes_to_calculate.front();
-        nodes_to_calculate.pop_front();
+namespace {
+// Collects the nodes the value of the output is computed from, each node once, consumers before their inputs.
+// Inputs for which `is_computed` returns true are not traversed. Returns false if some of the nodes are
+// neither a Constant nor a ShapeOf-based computation.
+template <typename IsComputed>
+bool collect_value_sources(const Output<Node>& output, std::vector<Node*>& order, IsComputed&& is_computed) {
+    std::unordered_set<Node*> visited;
+    std::vector<Node*> topological_order;
+    // the flag is set when the inputs of the node are already on the stack
+    std::vector<std::pair<Node*, bool>> nodes_to_calculate{{output.get_node(), false}};
+    while (!nodes_to_calculate.empty()) {
+        const auto current_node = nodes_to_calculate.back().first;
+        if (nodes_to_calculate.back().second) {
+            nodes_to_calculate.pop_back();
+            topological_order.push_back(current_node);
+            continue;
+        }
+        if (!visited.insert(current_node).second) {
+            nodes_to_calculate.pop_back();
+            continue;
+        }
+        nodes_to_calculate.back().second = true;
 
         if (current_node->inputs().empty() && !is_type<op::Constant>(current_node))
-            status = false;
-        else if (!is_type<op::v0::ShapeOf>(current_node) && !is_type<op::v3::ShapeOf>(current_node)) {
+            return false;
+        if (!is_type<op::v0::ShapeOf>(current_node) && !is_type<op::v3::ShapeOf>(current_node)) {
             // not a leaf, not a shape_of -- continue to search
             for (const auto& input_value : current_node->input_values()) {
-                const auto& input_node = input_value.get_node();
-                order.push_back(input_node);
-                nodes_to_calculate.push_front(input_node);
+                if (!is_computed(input_value) && !visited.count(input_value.get_node()))
+                    nodes_to_calculate.emplace_back(input_value.get_node(), false);
             }
         }
     }
-    return status;
+    order.insert(order.end(), topological_order.rbegin(), topological_order.rend());
+    return true;
+}
+}  // namespace
+
+bool ngraph::could_propagate(const Output<Node>& output, std::vector<Node*>& order) {
+    return collect_value_sources(output, order, [](const Output<Node>&) {
+        return false;
+    });
 }
 
 void propagate_rt_info(Node* node, const Output<Node>& final_port) {
@@ -1208,8 +1229,13 @@ HostTensorPtr evaluate_bound(const Output<Node>& output, bool is_upper) {
     if (!is_upper && output.get_tensor().get_lower_value() != nullptr)
         return output.get_tensor().get_lower_value();
 
+    // the values computed by the previous evaluations are reused, so each node is evaluated once
     std::vector<Node*> order;
-    if (could_propagate(output, order)) {
+    const auto bound_is_set = [is_upper](const Output<Node>& value) {
+        const auto& tensor = value.get_tensor();
+        return (is_upper ? tensor.get_upper_value() : tensor.get_lower_value()) != nullptr;
+    };
+    if (collect_value_sources(output, order, bound_is_set)) {
         reverse(order.begin(), order.end());
         for (const auto& node : order) {
             HostTensorVector outputs;
@@ -1227,8 +1253,14 @@ HostTensorPtr evaluate_bound(const Output<Node>& output, bool is_upper) {
                     if ((same_inputs || !is_upper) && node->get_output_tensor(i).get_lower_value() == nullptr)
                         node->get_output_tensor(i).set_lower_value(outputs[i]);
                 }
+                // the inputs are kept until the both bounds of the outputs are evaluated
+                const auto& node_outputs = node->outputs();
+                bool both_bounds_set =
+                    std::all_of(node_outputs.begin(), node_outputs.end(), [](const Output<Node>& out) {
+                        return out.get_tensor().get_lower_value() && out.get_tensor().get_upper_value();
+                    });
                 for (const auto& input : input_values)
-                    if (input.get_target_inputs().size() == 1)
+                    if (both_bounds_set && input.get_target_inputs().size() == 1)
                         input.get_tensor().invalidate_values();
                 propagate_rt_info(node, output);
             } else {
@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <binary_ir_frontend/utility.hpp>
+#include <frontend_manager/frontend_manager.hpp>
+#include <memory>
+#include <ngraph/ngraph.hpp>
+
+namespace ngraph {
+namespace frontend {
+class BINARY_IR_API InputModelBinaryIR : public InputModel {
+    friend class FrontEndBinaryIR;
+    class InputModelBinaryIRImpl;
+    std::shared_ptr<InputModelBinaryIRImpl> _impl;
+
+public:
+    /// \param data Content of the whole binary IR file, constants are created on top of it
+    InputModelBinaryIR(const ov::Weights& data, const ov::Extensions& extensions);
+
+    std::shared_ptr<Function> convert();
+};
+
+}  // namespace frontend
+}  // namespace ngraph
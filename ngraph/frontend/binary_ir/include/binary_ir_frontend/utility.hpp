@@ -0,0 +1,12 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+// Defined if we are building the plugin DLL (instead of using it)
+#ifdef binary_ir_ngraph_frontend_EXPORTS
+#    define BINARY_IR_API NGRAPH_HELPER_DLL_EXPORT
+#else
+#    define BINARY_IR_API NGRAPH_HELPER_DLL_IMPORT
+#endif  // binary_ir_ngraph_frontend_EXPORTS
@@ -0,0 +1,509 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "binary_deserializer.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
+#include <openvino/op/util/framework_node.hpp>
+#include <sstream>
+#include <transformations/rt_info/attributes.hpp>
+
+using namespace ov;
+using AttributeKind = ov::pass::BinarySerialize::AttributeKind;
+
+namespace {
+using SubGraphOp = ngraph::op::util::SubGraphOp;
+
+template <typename T>
+std::string join(const std::vector<T>& values) {
+    std::stringstream oss;
+    const char* s = "";
+    for (const auto& v : values) {
+        oss << s << v;
+        s = ",";
+    }
+    return oss.str();
+}
+
+// Converts attribute of the operation which is not found in loaded opsets to FrameworkNode attribute,
+// returns false for attributes which have no string representation
+bool attribute_to_string(const binary_ir::Attribute& attribute, std::string& value) {
+    binary_ir::Reader reader(attribute.data, attribute.size);
+    switch (attribute.kind) {
+    case AttributeKind::BOOL:
+        value = reader.read<uint8_t>() ? "true" : "false";
+        return true;
+    case AttributeKind::STRING:
+        value = std::string(attribute.data, attribute.size);
+        return true;
+    case AttributeKind::INT64:
+        value = std::to_string(reader.read<int64_t>());
+        return true;
+    case AttributeKind::DOUBLE: {
+        std::stringstream oss;
+        oss << reader.read<double>();
+        value = oss.str();
+        return true;
+    }
+    case AttributeKind::VEC_INT32:
+        value = join(reader.read_vector<int32_t>());
+        return true;
+    case AttributeKind::VEC_INT64:
+        value = join(reader.read_vector<int64_t>());
+        return true;
+    case AttributeKind::VEC_UINT64:
+        value = join(reader.read_vector<uint64_t>());
+        return true;
+    case AttributeKind::VEC_FLOAT:
+        value = join(reader.read_vector<float>());
+        return true;
+    case AttributeKind::VEC_STRING:
+    case AttributeKind::TYPE_VECTOR:
+        value = join(reader.read_strings());
+        return true;
+    default:
+        return false;
+    }
+}
+
+ngraph::element::Type read_element_type(binary_ir::Reader& reader) {
+    return ngraph::element::Type(ov::as_enum<ngraph::element::Type_t>(reader.read_string()));
+}
+
+ngraph::PartialShape read_partial_shape(binary_ir::Reader& reader) {
+    const auto rank = reader.read<int64_t>();
+    if (rank < 0) {
+        return ngraph::PartialShape::dynamic();
+    }
+    std::vector<ngraph::Dimension> dims;
+    for (int64_t i = 0; i < rank; ++i) {
+        const auto min = reader.read<int64_t>();
+        const auto max = reader.read<int64_t>();
+        dims.emplace_back(min, max);
+    }
+    return ngraph::PartialShape(dims);
+}
+}  // namespace
+
+binary_ir::Attributes binary_ir::read_attributes(Reader& reader) {
+    Attributes attributes;
+    const auto count = reader.read<uint64_t>();
+    for (uint64_t i = 0; i < count; ++i) {
+        auto name = reader.read_string();
+        const auto kind = reader.read<AttributeKind>();
+        const auto size = reader.read<uint64_t>();
+        const auto payload = reader.sub_reader(size);
+        attributes[std::move(name)] = {kind, payload.data(), payload.remaining()};
+    }
+    return attributes;
+}
+
+const binary_ir::Attribute* BinaryDeserializer::get_attribute(const std::string& name, AttributeKind kind) const {
+    const auto found = m_attributes.find(name);
+    if (found == m_attributes.end())
+        return nullptr;
+    OPENVINO_ASSERT(found->second.kind == kind,
+                    "Error binary IR reading. Attribute ",
+                    name,
+                    " has unexpected type ",
+                    static_cast<int>(found->second.kind));
+    return &found->second;
+}
+
+void BinaryDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& value) {
+    if (const auto attribute = get_attribute(name, AttributeKind::STRING))
+        value.set(std::string(attribute->data, attribute->size));
+}
+
+void BinaryDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& value) {
+    if (const auto attribute = get_attribute(name, AttributeKind::BOOL))
+        value.set(binary_ir::Reader(attribute->data, attribute->size).read<uint8_t>() != 0);
+}
+
+void BinaryDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& value) {
+    if (const auto attribute = get_attribute(name, AttributeKind::INT64))
+        value.set(binary_ir::Reader(attribute->data, attribute->size).read<int64_t>());
+}
+
+void BinaryDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<double>& value) {
+    if (const auto attribute = get_attribute(name, AttributeKind::DOUBLE))
+        value.set(binary_ir::Reader(attribute->data, attribute->size).read<double>());
+}
+
+void BinaryDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& value) {
+    if (const auto attribute = get_attribute(name, AttributeKind::VEC_INT32))
+        value.set(binary_ir::Reader(attribute->data, attribute->size).read_vector<int32_t>());
+}
+
+void BinaryDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& value) {
+    if (const auto attribute = get_attribute(name, AttributeKind::VEC_INT64))
+        value.set(binary_ir::Reader(attribute->data, attribute->size).read_vector<int64_t>());
+}
+
+void BinaryDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& value) {
+    if (const auto attribute = get_attribute(name, AttributeKind::VEC_UINT64))
+        value.set(binary_ir::Reader(attribute->data, attribute->size).read_vector<uint64_t>());
+}
+
+void BinaryDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& value) {
+    if (const auto attribute = get_attribute(name, AttributeKind::VEC_FLOAT))
+        value.set(binary_ir::Reader(attribute->data, attribute->size).read_vector<float>());
+}
+
+void BinaryDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& value) {
+    if (const auto attribute = get_attribute(name, AttributeKind::VEC_STRING))
+        value.set(binary_ir::Reader(attribute->data, attribute->size).read_strings());
+}
+
+void BinaryDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) {
+    using InputDescriptions = std::vector<std::shared_ptr<ngraph::op::util::MultiSubGraphOp::InputDescription>>;
+    using OutputDescriptions = std::vector<std::shared_ptr<ngraph::op::util::MultiSubGraphOp::OutputDescription>>;
+
+    if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(&adapter)) {
+        ov::op::util::FrameworkNodeAttrs node_attrs;
+        if (const auto attribute = get_attribute(name, AttributeKind::FRAMEWORK_NODE_ATTRS)) {
+            binary_ir::Reader reader(attribute->data, attribute->size);
+            node_attrs.set_type_name(reader.read_string());
+            node_attrs.set_opset_name(reader.read_string());
+            const auto count = reader.read<uint64_t>();
+            for (uint64_t i = 0; i < count; ++i) {
+                auto attr_name = reader.read_string();
+                node_attrs[attr_name] = reader.read_string();
+            }
+        } else if (m_framework_node_params) {
+            // The operation was serialized from the opset which is not loaded now
+            node_attrs.set_type_name(m_framework_node_params->type);
+            node_attrs.set_opset_name(m_framework_node_params->version);
+            for (const auto& attribute : m_attributes) {
+                std::string value;
+                if (attribute_to_string(attribute.second, value))
+                    node_attrs[attribute.first] = value;
+            }
+        } else {
+            return;
+        }
+        a->set(node_attrs);
+        return;
+    }
+
+    if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::set<std::string>>>(&adapter)) {
+        if (const auto attribute = get_attribute(name, AttributeKind::VEC_STRING)) {
+            const auto value = binary_ir::Reader(attribute->data, attribute->size).read_strings();
+            a->set({value.begin(), value.end()});
+        }
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<InputDescriptions>>(&adapter)) {
+        const auto attribute = get_attribute(name, AttributeKind::INPUT_DESCRIPTIONS);
+        if (!attribute)
+            return;
+        binary_ir::Reader reader(attribute->data, attribute->size);
+        InputDescriptions inputs;
+        const auto count = reader.read<uint64_t>();
+        for (uint64_t i = 0; i < count; ++i) {
+            const auto input_kind = reader.read<uint8_t>();
+            const auto input_index = reader.read<uint64_t>();
+            const auto body_parameter_index = reader.read<uint64_t>();
+            if (input_kind == 0) {
+                const auto start = reader.read<int64_t>();
+                const auto stride = reader.read<int64_t>();
+                const auto part_size = reader.read<int64_t>();
+                const auto end = reader.read<int64_t>();
+                const auto axis = reader.read<int64_t>();
+                inputs.push_back(std::make_shared<SubGraphOp::SliceInputDescription>(input_index,
+                                                                                     body_parameter_index,
+                                                                                     start,
+                                                                                     stride,
+                                                                                     part_size,
+                                                                                     end,
+                                                                                     axis));
+            } else if (input_kind == 1) {
+                const auto body_value_index = reader.read<uint64_t>();
+                inputs.push_back(std::make_shared<SubGraphOp::MergedInputDescription>(input_index,
+                                                                                      body_parameter_index,
+                                                                                      body_value_index));
+            } else if (input_kind == 2) {
+                inputs.push_back(
+                    std::make_shared<SubGraphOp::InvariantInputDescription>(input_index, body_parameter_index));
+            } else {
+                OPENVINO_UNREACHABLE("Unknown input description kind ", static_cast<int>(input_kind));
+            }
+        }
+        a->set(inputs);
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<OutputDescriptions>>(&adapter)) {
+        const auto attribute = get_attribute(name, AttributeKind::OUTPUT_DESCRIPTIONS);
+        if (!attribute)
+            return;
+        binary_ir::Reader reader(attribute->data, attribute->size);
+        OutputDescriptions outputs;
+        const auto count = reader.read<uint64_t>();
+        for (uint64_t i = 0; i < count; ++i) {
+            const auto output_kind = reader.read<uint8_t>();
+            const auto body_value_index = reader.read<uint64_t>();
+            const auto output_index = reader.read<uint64_t>();
+            if (output_kind == 0) {
+                const auto iteration = reader.read<int64_t>();
+                outputs.push_back(
+                    std::make_shared<SubGraphOp::BodyOutputDescription>(body_value_index, output_index, iteration));
+            } else if (output_kind == 1) {
+                const auto start = reader.read<int64_t>();
+                const auto stride = reader.read<int64_t>();
+                const auto part_size = reader.read<int64_t>();
+                const auto end = reader.read<int64_t>();
+                const auto axis = reader.read<int64_t>();
+                outputs.push_back(std::make_shared<SubGraphOp::ConcatOutputDescription>(body_value_index,
+                                                                                        output_index,
+                                                                                        start,
+                                                                                        stride,
+                                                                                        part_size,
+                                                                                        end,
+                                                                                        axis));
+            } else {
+                OPENVINO_UNREACHABLE("Unknown output description kind ", static_cast<int>(output_kind));
+            }
+        }
+        a->set(outputs);
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+        if (const auto attribute = get_attribute(name, AttributeKind::SPECIAL_BODY_PORTS)) {
+            binary_ir::Reader reader(attribute->data, attribute->size);
+            const auto current_iteration_input_idx = reader.read<int64_t>();
+            const auto body_condition_output_idx = reader.read<int64_t>();
+            a->set({current_iteration_input_idx, body_condition_output_idx});
+        }
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+        const auto attribute = get_attribute(name, AttributeKind::VARIABLE);
+        if (!attribute)
+            return;
+        const auto variable_id = binary_ir::Reader(attribute->data, attribute->size).read_string();
+        if (!m_variables.count(variable_id)) {
+            m_variables[variable_id] = std::make_shared<ngraph::Variable>(
+                ngraph::VariableInfo{ngraph::PartialShape::dynamic(), ngraph::element::dynamic, variable_id});
+        }
+        a->set(m_variables[variable_id]);
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+                   &adapter)) {
+        const auto attribute = get_attribute(name, AttributeKind::CONSTANT_DATA);
+        if (!attribute)
+            return;
+        binary_ir::Reader reader(attribute->data, attribute->size);
+        const auto offset = reader.read<uint64_t>();
+        const auto size = reader.read<uint64_t>();
+        OPENVINO_ASSERT(m_weights, "Empty weights data in binary IR");
+        OPENVINO_ASSERT(offset <= m_weights->size() && size <= m_weights->size() - offset,
+                        "Incorrect weights in binary IR!");
+
+        char* data = m_weights->get_ptr<char>() + offset;
+        auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+            data,
+            size,
+            m_weights);
+        a->set(buffer);
+    } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::element::TypeVector>>(&adapter)) {
+        if (const auto attribute = get_attribute(name, AttributeKind::TYPE_VECTOR)) {
+            ngraph::element::TypeVector types;
+            for (const auto& type : binary_ir::Reader(attribute->data, attribute->size).read_strings())
+                types.emplace_back(ov::as_enum<ngraph::element::Type_t>(type));
+            a->set(types);
+        }
+    } else {
+        OPENVINO_UNREACHABLE("Error binary IR reading. Attribute adapter can not be found for ", name, " parameter");
+    }
+}
+
+void BinaryDeserializer::on_adapter(const std::string& name,
+                                    ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) {
+    const auto attribute = get_attribute(name, AttributeKind::FUNCTION);
+    OPENVINO_ASSERT(attribute, "Error binary IR reading. Function ", name, " is not found");
+    binary_ir::Reader reader(attribute->data, attribute->size);
+    adapter.set(parse_function(reader));
+}
+
+std::shared_ptr<ngraph::Function> BinaryDeserializer::parse_function(binary_ir::Reader& reader) {
+    ngraph::ParameterVector parameters;
+    ngraph::ResultVector results;
+    ngraph::SinkVector sinks;
+    std::vector<std::shared_ptr<ngraph::Node>> nodes;
+
+    // attributes factory is created only for nodes which have runtime info
+    std::unique_ptr<ov::pass::Attributes> attrs_factory;
+    auto read_runtime_info = [&](ngraph::Node::RTMap* rt_info) {
+        const auto count = reader.read<uint64_t>();
+        for (uint64_t i = 0; i < count; ++i) {
+            const auto attribute_name = reader.read_string();
+            const auto attribute_version = reader.read_string();
+            const auto attributes = binary_ir::read_attributes(reader);
+            // runtime info of the port which is absent in the created node
+            if (!rt_info)
+                continue;
+            if (!attrs_factory)
+                attrs_factory.reset(new ov::pass::Attributes());
+            const auto& type_info = ov::DiscreteTypeInfo(attribute_name.c_str(), 0, attribute_version.c_str());
+            auto attr = attrs_factory->create_by_type_info(type_info);
+            OPENVINO_ASSERT(attr, "Attribute: ", attribute_name, " is not recognized");
+            BinaryDeserializer attribute_visitor(attributes, m_weights, m_opsets, m_variables);
+            OPENVINO_ASSERT(attr->visit_attributes(attribute_visitor),
+                            "VisitAttributes is not supported for: ",
+                            attribute_name,
+                            " attribute");
+            (*rt_info)[type_info] = std::shared_ptr<Variant>(attr);
+        }
+    };
+
+    const auto name = reader.read_string();
+    const auto node_count = reader.read<uint64_t>();
+    const auto get_node = [&nodes](uint64_t id) -> const std::shared_ptr<ngraph::Node>& {
+        OPENVINO_ASSERT(id < nodes.size(), "Attempt to access node ", id, " that not in graph.");
+        return nodes[id];
+    };
+
+    for (uint64_t node_id = 0; node_id < node_count; ++node_id) {
+        NodeParams params;
+        params.type = reader.read_string();
+        params.version = reader.read_string();
+        params.name = reader.read_string();
+
+        ngraph::OutputVector inputs;
+        const auto input_count = reader.read<uint64_t>();
+        for (uint64_t i = 0; i < input_count; ++i) {
+            const auto& producer = get_node(reader.read<uint64_t>());
+            const auto port = reader.read<uint64_t>();
+            OPENVINO_ASSERT(port < producer->get_output_size(),
+                            params.type,
+                            " layer ",
+                            params.name,
+                            " is inconsistent!");
+            inputs.push_back(producer->output(port));
+        }
+        ngraph::NodeVector control_dependencies;
+        const auto dependency_count = reader.read<uint64_t>();
+        for (uint64_t i = 0; i < dependency_count; ++i) {
+            control_dependencies.push_back(get_node(reader.read<uint64_t>()));
+        }
+        const auto output_count = reader.read<uint64_t>();
+        for (uint64_t i = 0; i < output_count; ++i) {
+            NodeParams::OutputPort port;
+            port.precision = read_element_type(reader);
+            port.shape = read_partial_shape(reader);
+            for (auto& tensor_name : reader.read_strings())
+                port.names.insert(std::move(tensor_name));
+            params.outputs.push_back(std::move(port));
+        }
+        const auto attributes = binary_ir::read_attributes(reader);
+
+        auto node = create_node(inputs, attributes, params);
+        for (const auto& dependency : control_dependencies) {
+            node->add_control_dependency(dependency);
+        }
+
+        read_runtime_info(&node->get_rt_info());
+        for (uint64_t i = 0; i < input_count; ++i) {
+            read_runtime_info(i < node->get_input_size() ? &node->input(i).get_rt_info() : nullptr);
+        }
+        for (uint64_t i = 0; i < output_count; ++i) {
+            read_runtime_info(i < node->get_output_size() ? &node->output(i).get_rt_info() : nullptr);
+        }
+        nodes.push_back(node);
+    }
+
+    const auto parameter_count = reader.read<uint64_t>();
+    for (uint64_t i = 0; i < parameter_count; ++i) {
+        const auto parameter = ov::as_type_ptr<ngraph::op::Parameter>(get_node(reader.read<uint64_t>()));
+        OPENVINO_ASSERT(parameter, "Function ", name, " has incorrect parameter with index ", i);
+        parameters.push_back(parameter);
+    }
+    const auto result_count = reader.read<uint64_t>();
+    for (uint64_t i = 0; i < result_count; ++i) {
+        const auto result = ov::as_type_ptr<ngraph::op::Result>(get_node(reader.read<uint64_t>()));
+        OPENVINO_ASSERT(result, "Function ", name, " has incorrect result with index ", i);
+        results.push_back(result);
+    }
+    const auto sink_count = reader.read<uint64_t>();
+    for (uint64_t i = 0; i < sink_count; ++i) {
+        const auto sink = std::dynamic_pointer_cast<ngraph::op::Sink>(get_node(reader.read<uint64_t>()));
+        OPENVINO_ASSERT(sink, "Function ", name, " has incorrect sink with index ", i);
+        sinks.push_back(sink);
+    }
+
+    return std::make_shared<ngraph::Function>(results, sinks, parameters, name);
+}
+
+std::shared_ptr<ngraph::Node> BinaryDeserializer::create_node(const ngraph::OutputVector& inputs,
+                                                              const binary_ir::Attributes& attributes,
+                                                              const NodeParams& params) {
+    // Check that inputs are correctly defined
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (ngraph::element::Type_t::undefined == inputs[i].get_element_type())
+            OPENVINO_UNREACHABLE(params.type,
+                                 " layer ",
+                                 params.name,
+                                 " has undefined element type for input with index ",
+                                 i,
+                                 "!");
+    }
+
+    std::shared_ptr<ngraph::Node> ngraphNode;
+
+    // Try to create operation from loaded opsets
+    auto opsetIt = m_opsets.find(params.version);
+    if (opsetIt != m_opsets.end()) {
+        const auto& opset = opsetIt->second;
+
+        ngraphNode = std::shared_ptr<ngraph::Node>(opset.create(params.type));
+        OPENVINO_ASSERT(ngraphNode,
+                        "Opset ",
+                        params.version,
+                        " doesn't contain the operation with type: ",
+                        params.type);
+        // Share Weights form constant blob
+        if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(ngraphNode)) {
+            constant->alloc_buffer_on_visit_attributes(false);
+        }
+        ngraphNode->set_arguments(inputs);
+        BinaryDeserializer visitor(attributes, m_weights, m_opsets, m_variables);
+
+        if (ngraphNode->visit_attributes(visitor)) {
+            ngraphNode->constructor_validate_and_infer_types();
+        }
+
+        // To be sure that all default values will be initialized:
+        ngraphNode = ngraphNode->clone_with_new_inputs(ngraphNode->input_values());
+    }
+
+    if (!ngraphNode && m_use_framework_node) {
+        ngraphNode = std::make_shared<ov::op::util::FrameworkNode>(inputs);
+        BinaryDeserializer visitor(attributes, m_weights, m_opsets, m_variables);
+        visitor.m_framework_node_params = &params;
+        ngraphNode->visit_attributes(visitor);
+
+        size_t index{0};
+        for (const auto& output_params : params.outputs) {
+            ngraphNode->set_output_type(index, output_params.precision, output_params.shape);
+            ++index;
+        }
+    }
+
+    OPENVINO_ASSERT(ngraphNode,
+                    "Cannot create ",
+                    params.type,
+                    " layer ",
+                    params.name,
+                    " from unsupported opset: ",
+                    params.version);
+
+    // Legacy runtime info is stored together with attributes
+    for (const auto& rt_info_name : {"PrimitivesPriority", "alt_width"}) {
+        const auto found = attributes.find(rt_info_name);
+        if (found != attributes.end() && found->second.kind == AttributeKind::STRING) {
+            ngraphNode->get_rt_info()[rt_info_name] = std::make_shared<::ngraph::VariantWrapper<std::string>>(
+                std::string(found->second.data, found->second.size));
+        }
+    }
+
+    ngraphNode->set_friendly_name(params.name);
+    for (size_t i = 0; i < params.outputs.size() && i < ngraphNode->get_output_size(); ++i) {
+        if (!params.outputs[i].names.empty())
+            ngraphNode->get_output_tensor(i).set_names(params.outputs[i].names);
+    }
+
+    return ngraphNode;
+}
@@ -0,0 +1,156 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstring>
+#include <frontend_manager/parameters.hpp>
+#include <memory>
+#include <ngraph/ngraph.hpp>
+#include <openvino/pass/serialize.hpp>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ov {
+namespace binary_ir {
+/// \brief Bounds checked sequential reader of values written by ov::pass::BinarySerialize
+class Reader {
+public:
+    Reader(const char* data, size_t size) : m_pos(data), m_end(data + size) {}
+
+    template <typename T>
+    T read() {
+        check(sizeof(T));
+        T value;
+        std::memcpy(&value, m_pos, sizeof(T));
+        m_pos += sizeof(T);
+        return value;
+    }
+
+    std::string read_string() {
+        const auto size = read<uint64_t>();
+        check(size);
+        std::string value(m_pos, size);
+        m_pos += size;
+        return value;
+    }
+
+    template <typename T>
+    std::vector<T> read_vector() {
+        const auto size = read<uint64_t>();
+        OPENVINO_ASSERT(size <= remaining() / sizeof(T), "Binary IR is corrupted: unexpected end of data");
+        std::vector<T> value(size);
+        std::memcpy(value.data(), m_pos, size * sizeof(T));
+        m_pos += size * sizeof(T);
+        return value;
+    }
+
+    std::vector<std::string> read_strings() {
+        const auto size = read<uint64_t>();
+        std::vector<std::string> value;
+        for (uint64_t i = 0; i < size; ++i) {
+            value.push_back(read_string());
+        }
+        return value;
+    }
+
+    /// \brief Returns reader of the next `size` bytes and skips them
+    Reader sub_reader(uint64_t size) {
+        check(size);
+        Reader reader(m_pos, size);
+        m_pos += size;
+        return reader;
+    }
+
+    const char* data() const {
+        return m_pos;
+    }
+
+    size_t remaining() const {
+        return m_end - m_pos;
+    }
+
+private:
+    void check(uint64_t size) const {
+        OPENVINO_ASSERT(size <= remaining(), "Binary IR is corrupted: unexpected end of data");
+    }
+
+    const char* m_pos;
+    const char* m_end;
+};
+
+struct Attribute {
+    ov::pass::BinarySerialize::AttributeKind kind;
+    const char* data;
+    size_t size;
+};
+using Attributes = std::unordered_map<std::string, Attribute>;
+
+/// \brief Reads attribute block: number of attributes and (name, kind, payload) records
+Attributes read_attributes(Reader& reader);
+}  // namespace binary_ir
+
+class BinaryDeserializer : public ngraph::AttributeVisitor {
+public:
+    explicit BinaryDeserializer(const binary_ir::Attributes& attributes,
+                                const ov::Weights& weights,
+                                const std::unordered_map<std::string, ngraph::OpSet>& opsets,
+                                std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables)
+        : m_attributes(attributes),
+          m_weights(weights),
+          m_opsets(opsets),
+          m_variables(variables) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& value) override;
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& value) override;
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& value) override;
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& value) override;
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& value) override;
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& value) override;
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& value) override;
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& value) override;
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& value) override;
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override;
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override;
+
+    void use_framework_node(bool flag) {
+        m_use_framework_node = flag;
+    }
+
+    /// \brief Decodes function written by ov::pass::BinarySerialize
+    std::shared_ptr<ngraph::Function> parse_function(binary_ir::Reader& reader);
+
+private:
+    struct NodeParams {
+        struct OutputPort {
+            ngraph::element::Type precision;
+            ngraph::PartialShape shape;
+            std::unordered_set<std::string> names;
+        };
+        std::string type;
+        std::string version;
+        std::string name;
+        std::vector<OutputPort> outputs;
+    };
+
+    /// \brief Returns payload of the attribute or nullptr if the attribute is not stored
+    const binary_ir::Attribute* get_attribute(const std::string& name,
+                                              ov::pass::BinarySerialize::AttributeKind kind) const;
+
+    std::shared_ptr<ngraph::Node> create_node(const ngraph::OutputVector& inputs,
+                                              const binary_ir::Attributes& attributes,
+                                              const NodeParams& params);
+
+    const binary_ir::Attributes& m_attributes;
+    const ov::Weights& m_weights;
+    const std::unordered_map<std::string, ngraph::OpSet>& m_opsets;
+    std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& m_variables;
+    bool m_use_framework_node{false};
+    // Set only for the visitor of the node which is decoded as FrameworkNode
+    const NodeParams* m_framework_node_params{nullptr};
+};
+}  // namespace ov
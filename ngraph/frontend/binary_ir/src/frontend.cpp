@@ -0,0 +1,142 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <binary_ir_frontend/frontend.hpp>
+#include <binary_ir_frontend/model.hpp>
+#include <binary_ir_frontend/utility.hpp>
+#include <cstring>
+#include <fstream>
+#include <ngraph/runtime/shared_buffer.hpp>
+#include <ngraph/variant.hpp>
+#include <openvino/pass/serialize.hpp>
+#include <openvino/util/file_util.hpp>
+#include <openvino/util/mmap_object.hpp>
+#include <vector>
+
+using namespace ngraph;
+
+namespace ngraph {
+namespace frontend {
+namespace {
+/**
+ * @brief Checks that model stream starts with binary IR signature
+ * @param model Models stream, its position is restored
+ */
+bool has_binary_ir_magic(std::istream& model) {
+    char magic[sizeof(ov::pass::BinarySerialize::magic)] = {};
+
+    const auto pos = model.tellg();
+    model.read(magic, sizeof(magic));
+    const bool read = static_cast<size_t>(model.gcount()) == sizeof(magic);
+    model.clear();
+    model.seekg(pos);
+
+    return read && std::memcmp(magic, ov::pass::BinarySerialize::magic, sizeof(magic)) == 0;
+}
+
+ov::Weights read_stream(std::istream& model) {
+    const auto pos = model.tellg();
+    model.seekg(0, model.end);
+    const auto size = static_cast<size_t>(model.tellg() - pos);
+    model.seekg(pos);
+
+    auto data = std::make_shared<runtime::AlignedBuffer>(size);
+    model.read(data->get_ptr<char>(), size);
+    if (static_cast<size_t>(model.gcount()) != size)
+        throw std::runtime_error("Failed to read binary IR from stream");
+    return data;
+}
+}  // namespace
+
+bool FrontEndBinaryIR::supported_impl(const std::vector<std::shared_ptr<Variant>>& variants) const {
+    std::ifstream local_model_stream;
+    std::istream* provided_model_stream = nullptr;
+
+    if (variants.empty() || variants.size() > 3) {
+        return false;
+    }
+
+    const auto& model_variant = variants[0];
+    if (ov::is_type<ov::VariantWrapper<std::string>>(model_variant)) {
+        const auto& path = ov::as_type_ptr<ov::VariantWrapper<std::string>>(model_variant)->get();
+        local_model_stream.open(path, std::ios::in | std::ifstream::binary);
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    } else if (ov::is_type<ov::VariantWrapper<std::wstring>>(model_variant)) {
+        const auto& path = ov::as_type_ptr<ov::VariantWrapper<std::wstring>>(model_variant)->get();
+        local_model_stream.open(path, std::ios::in | std::ifstream::binary);
+#endif
+    } else if (ov::is_type<ov::VariantWrapper<std::istream*>>(model_variant)) {
+        provided_model_stream = ov::as_type_ptr<ov::VariantWrapper<std::istream*>>(model_variant)->get();
+    } else if (ov::is_type<ov::VariantWrapper<std::istringstream*>>(model_variant)) {
+        provided_model_stream = ov::as_type_ptr<ov::VariantWrapper<std::istringstream*>>(model_variant)->get();
+    }
+
+    if (provided_model_stream) {
+        return has_binary_ir_magic(*provided_model_stream);
+    } else if (local_model_stream.is_open()) {
+        return has_binary_ir_magic(local_model_stream);
+    }
+    return false;
+}
+
+InputModel::Ptr FrontEndBinaryIR::load_impl(const std::vector<std::shared_ptr<Variant>>& variants) const {
+    ov::Weights data;
+    ov::Extensions extensions;
+
+    for (size_t variant_id = 1; variant_id < variants.size(); ++variant_id) {
+        const auto& variant = variants.at(variant_id);
+        if (ov::is_type<ov::ExtensionsVariant>(variant)) {
+            extensions = ov::as_type_ptr<ov::ExtensionsVariant>(variant)->get();
+        }
+    }
+
+    // Map model file instead of reading it: Constants are created on top of the mapped region
+    // without extra copies and pages are shared between processes which load the same model
+    auto map_file = [&data](const std::shared_ptr<ov::util::MappedMemory>& mapped_model) {
+        data = std::make_shared<runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(mapped_model->data(),
+                                                                                                 mapped_model->size(),
+                                                                                                 mapped_model);
+    };
+
+    const auto& model_variant = variants.at(0);
+    if (ov::is_type<ov::VariantWrapper<std::string>>(model_variant)) {
+        map_file(ov::util::load_mmap_object(ov::as_type_ptr<ov::VariantWrapper<std::string>>(model_variant)->get()));
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    } else if (ov::is_type<ov::VariantWrapper<std::wstring>>(model_variant)) {
+        map_file(ov::util::load_mmap_object(ov::as_type_ptr<ov::VariantWrapper<std::wstring>>(model_variant)->get()));
+#endif
+    } else if (ov::is_type<ov::VariantWrapper<std::istream*>>(model_variant)) {
+        data = read_stream(*ov::as_type_ptr<ov::VariantWrapper<std::istream*>>(model_variant)->get());
+    } else if (ov::is_type<ov::VariantWrapper<std::istringstream*>>(model_variant)) {
+        data = read_stream(*ov::as_type_ptr<ov::VariantWrapper<std::istringstream*>>(model_variant)->get());
+    } else {
+        return nullptr;
+    }
+
+    return std::make_shared<InputModelBinaryIR>(data, extensions);
+}
+
+std::shared_ptr<ngraph::Function> FrontEndBinaryIR::convert(InputModel::Ptr model) const {
+    auto binary_ir_model = std::dynamic_pointer_cast<InputModelBinaryIR>(model);
+    return binary_ir_model->convert();
+}
+
+std::string FrontEndBinaryIR::get_name() const {
+    return "binary_ir";
+}
+}  // namespace frontend
+}  // namespace ngraph
+
+extern "C" BINARY_IR_API ngraph::frontend::FrontEndVersion GetAPIVersion() {
+    return OV_FRONTEND_API_VERSION;
+}
+
+extern "C" BINARY_IR_API void* GetFrontEndData() {
+    frontend::FrontEndPluginInfo* res = new frontend::FrontEndPluginInfo();
+    res->m_name = "binary_ir";
+    res->m_creator = []() {
+        return std::make_shared<frontend::FrontEndBinaryIR>();
+    };
+    return res;
+}
@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "binary_ir_frontend/model.hpp"
+
+#include <binary_deserializer.hpp>
+#include <cstring>
+#include <openvino/pass/serialize.hpp>
+
+using namespace ngraph;
+
+namespace ngraph {
+namespace frontend {
+class InputModelBinaryIR::InputModelBinaryIRImpl {
+    ov::Weights m_data;
+    ov::Extensions m_extensions;
+
+public:
+    InputModelBinaryIRImpl(const ov::Weights& data, const ov::Extensions& extensions)
+        : m_data(data),
+          m_extensions(extensions) {}
+
+    std::shared_ptr<Function> convert();
+};
+
+InputModelBinaryIR::InputModelBinaryIR(const ov::Weights& data, const ov::Extensions& extensions) {
+    _impl = std::make_shared<InputModelBinaryIRImpl>(data, extensions);
+}
+
+std::shared_ptr<Function> InputModelBinaryIR::convert() {
+    return _impl->convert();
+}
+
+std::shared_ptr<Function> InputModelBinaryIR::InputModelBinaryIRImpl::convert() {
+    using DataHeader = ov::pass::BinarySerialize::DataHeader;
+
+    DataHeader hdr = {};
+    OPENVINO_ASSERT(m_data && m_data->size() >= sizeof(hdr), "Binary IR is corrupted: file is too small");
+    std::memcpy(&hdr, m_data->get_ptr(), sizeof(hdr));
+    OPENVINO_ASSERT(std::memcmp(hdr.magic, ov::pass::BinarySerialize::magic, sizeof(hdr.magic)) == 0,
+                    "File is not a binary IR");
+    OPENVINO_ASSERT(hdr.format_version <= ov::pass::BinarySerialize::format_version,
+                    "Binary IR format version ",
+                    hdr.format_version,
+                    " is not supported");
+    OPENVINO_ASSERT(hdr.model_offset <= m_data->size() && hdr.model_size <= m_data->size() - hdr.model_offset,
+                    "Binary IR is corrupted: model section is out of file bounds");
+
+    std::unordered_map<std::string, ngraph::OpSet> opsets;
+    std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>> variables;
+
+    // Load default opsets
+    opsets["opset1"] = ngraph::get_opset1();
+    opsets["opset2"] = ngraph::get_opset2();
+    opsets["opset3"] = ngraph::get_opset3();
+    opsets["opset4"] = ngraph::get_opset4();
+    opsets["opset5"] = ngraph::get_opset5();
+    opsets["opset6"] = ngraph::get_opset6();
+    opsets["opset7"] = ngraph::get_opset7();
+    opsets["opset8"] = ngraph::get_opset8();
+
+    // Load custom opsets
+    for (const auto& it : m_extensions) {
+        OPENVINO_ASSERT(opsets.find(it.first) == opsets.end(),
+                        "Cannot add opset with name: ",
+                        it.first,
+                        ". Opset with the same name already exists.");
+        opsets[it.first] = it.second;
+    }
+
+    // Constants data offsets are relative to the beginning of the file
+    const ov::binary_ir::Attributes no_attributes;
+    ov::BinaryDeserializer deserializer(no_attributes, m_data, opsets, variables);
+    deserializer.use_framework_node(opsets.count("framework_node_ext"));
+    ov::binary_ir::Reader reader(m_data->get_ptr<char>() + hdr.model_offset, hdr.model_size);
+    auto function = deserializer.parse_function(reader);
+    function->get_rt_info()["version"] = std::make_shared<ngraph::VariantWrapper<int64_t>>(hdr.ir_version);
+
+    return function;
+}
+}  // namespace frontend
+}  // namespace ngraph
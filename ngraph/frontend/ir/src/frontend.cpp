@@ -10,6 +10,7 @@
 #include <ir_frontend/utility.hpp>
 #include <ngraph/variant.hpp>
 #include <openvino/util/file_util.hpp>
+#include <openvino/util/mmap_object.hpp>
 #include <vector>
 
 using namespace ngraph;
@@ -174,27 +175,19 @@ InputModel::Ptr FrontEndIR::load_impl(const std::vector<std::shared_ptr<Variant>
     }
 
     if (!weights_path.empty()) {
-        std::ifstream bin_stream;
-        bin_stream.open(weights_path, std::ios::binary);
-        if (!bin_stream.is_open())
-#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-            IR_THROW("Weights file " + ov::util::wstring_to_string(weights_path) + " cannot be opened!");
-#else
-            IR_THROW("Weights file " + weights_path + " cannot be opened!");
-#endif
-
-        bin_stream.seekg(0, std::ios::end);
-        size_t file_size = bin_stream.tellg();
-        bin_stream.seekg(0, std::ios::beg);
-
-        auto aligned_weights_buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(file_size);
-        bin_stream.read(aligned_weights_buffer->get_ptr<char>(), aligned_weights_buffer->size());
-        bin_stream.close();
+        // Map weights file instead of reading it: Constants are created on top of the mapped region
+        // without extra copies and pages are shared between processes which load the same model
+        std::shared_ptr<ov::util::MappedMemory> mapped_weights;
+        try {
+            mapped_weights = ov::util::load_mmap_object(weights_path);
+        } catch (const std::exception& ex) {
+            IR_THROW(ex.what());
+        }
 
-        weights = std::make_shared<runtime::SharedBuffer<std::shared_ptr<runtime::AlignedBuffer>>>(
-            aligned_weights_buffer->get_ptr<char>(),
-            aligned_weights_buffer->size(),
-            aligned_weights_buffer);
+        weights = std::make_shared<runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+            mapped_weights->data(),
+            mapped_weights->size(),
+            mapped_weights);
     }
 
     return create_input_model();
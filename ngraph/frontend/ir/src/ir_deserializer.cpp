@@ -4,6 +4,8 @@
 
 #include <xml_parse_utils.h>
 
+#include <cerrno>
+#include <cstdlib>
 #include <ie_ngraph_utils.hpp>
 #include <ir_deserializer.hpp>
 #include <ngraph/op/util/framework_node.hpp>
@@ -17,6 +19,19 @@
 
 using namespace ov;
 
+namespace {
+/// \brief Parses dimension value, it is called for each dim of each port so stringstream is avoided
+bool parse_dimension(const pugi::char_t* str, int64_t& dim) {
+    char* end = nullptr;
+    errno = 0;
+    const long long value = std::strtoll(str, &end, 10);
+    if (end == str || errno == ERANGE)
+        return false;
+    dim = static_cast<int64_t>(value);
+    return true;
+}
+}  // namespace
+
 XmlDeserializer::IoMap XmlDeserializer::updated_io_map(const pugi::xml_node& node, const pugi::xml_node& body_node) {
     if (body_node.empty()) {
         IE_THROW() << "Missing body part.";
@@ -416,7 +431,7 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(const pugi::xm
         GenericLayerParams params;
     };
 
-    std::map<size_t /*layer-id*/, node_params> params;
+    std::unordered_map<size_t /*layer-id*/, node_params> params;
 
     std::vector<size_t /*layer-id*/> outputs;
     std::unordered_set<std::string> opName;
@@ -433,8 +448,8 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(const pugi::xm
         }
     }
 
-    std::map<size_t /*to-layer-id*/, std::vector<edge>> edges;
-    std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
+    std::unordered_map<size_t /*to-layer-id*/, std::vector<edge>> edges;
+    std::unordered_map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
 
     // Read all edges and store them for further usage
     FOREACH_CHILD (_ec, root.child("edges"), "edge") {
@@ -445,19 +460,29 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(const pugi::xm
         edges[toLayer].push_back({fromLayer, fromPort, toPort});
     }
 
-    // Run DFS starting from outputs to get nodes topological order
-    std::set<size_t> used;
+    // Run DFS starting from outputs to get nodes topological order.
+    // Explicit stack is used because depth of large IRs can exceed the call stack.
+    std::unordered_set<size_t> used;
     std::vector<size_t> order;
-    std::function<void(size_t)> dfs = [&edges, &order, &used, &dfs](const size_t id) {
-        if (used.count(id))
-            return;
-        used.insert(id);
-        for (auto& edge : edges[id]) {
-            dfs(edge.fromLayerId);
+    order.reserve(params.size());
+    std::vector<std::pair<size_t /*layer-id*/, size_t /*next edge index*/>> stack;
+    for (const auto& output : outputs) {
+        if (!used.insert(output).second)
+            continue;
+        stack.emplace_back(output, 0);
+        while (!stack.empty()) {
+            const size_t id = stack.back().first;
+            const auto& in_edges = edges[id];
+            if (stack.back().second < in_edges.size()) {
+                const size_t from_id = in_edges[stack.back().second++].fromLayerId;
+                if (used.insert(from_id).second)
+                    stack.emplace_back(from_id, 0);
+            } else {
+                order.push_back(id);
+                stack.pop_back();
+            }
         }
-        order.push_back(id);
-    };
-    std::for_each(outputs.begin(), outputs.end(), dfs);
+    }
 
     // OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphNodes");
 
@@ -547,8 +572,7 @@ GenericLayerParams XmlDeserializer::parseGenericParams(const pugi::xml_node& nod
         FOREACH_CHILD (node, parentNode, "dim") {
             int64_t dim = 0;
             const pugi::char_t* dimVal = node.child_value();
-            std::stringstream ss(dimVal);
-            if (!(ss >> dim) || dim < -1) {
+            if (!parse_dimension(dimVal, dim) || dim < -1) {
                 IE_THROW() << "dimension (" << dimVal << ") in node " << node.name()
                            << " must be greater or equal to -1: at offset " << node.offset_debug();
             }
@@ -707,10 +731,13 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(const std::vector<ngra
             ngraphNode->get_output_tensor(i).set_names(params.outputPorts[i].names);
     }
 
-    ov::pass::Attributes attrs_factory;
+    // attributes factory is created only for nodes which have runtime info
+    std::unique_ptr<ov::pass::Attributes> attrs_factory;
     auto set_runtime_info = [&attrs_factory](RTMap& rt_info, const pugi::xml_node& rt_attrs) {
         if (!rt_attrs)
             return;
+        if (!attrs_factory)
+            attrs_factory.reset(new ov::pass::Attributes());
         for (const auto& item : rt_attrs) {
             std::string attribute_name, attribute_version;
             if (!getStrAttribute(item, "name", attribute_name)) {
@@ -720,7 +747,7 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(const std::vector<ngra
                 IE_THROW() << "rt_info attribute: " << attribute_name << " has no \"version\" field";
             }
             const auto& type_info = ov::DiscreteTypeInfo(attribute_name.c_str(), 0, attribute_version.c_str());
-            if (auto attr = attrs_factory.create_by_type_info(type_info)) {
+            if (auto attr = attrs_factory->create_by_type_info(type_info)) {
                 RTInfoDeserializer attribute_visitor(item);
                 if (attr->visit_attributes(attribute_visitor)) {
                     rt_info[type_info] = std::shared_ptr<Variant>(attr);
@@ -91,34 +91,48 @@ Graph::Graph(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto)
 Graph::Graph(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto, std::unique_ptr<GraphCache>&& cache)
     : m_model{common::make_unique<Model>(model_proto)},
       m_cache{std::move(cache)} {
+    const auto& graph_proto = m_model->get_graph();
+    std::size_t cache_size = graph_proto.initializer_size() + graph_proto.input_size();
+    for (const auto& node_proto : graph_proto.node()) {
+        cache_size += node_proto.output_size();
+    }
+    m_cache->reserve(cache_size);
+
     std::map<std::string, Tensor> initializers;
-    // Process all initializers in the graph
+    // Process all initializers in the graph, Constant nodes are independent of each other so they are
+    // created in parallel and stored in cache in the model order
+    std::vector<Tensor> tensors;
     for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
         if (initializer_tensor.has_name()) {
-            Tensor tensor = Tensor{initializer_tensor};
-            std::shared_ptr<default_opset::Constant> ng_constant;
-            // For each initializer create a Constant node and store it in cache
-            try {
-                ng_constant = tensor.get_ng_constant();
-            } catch (const error::invalid_external_data&) {
-                // invalid external data makes initializers creation impossible
-                throw;
-            } catch (const ngraph::ngraph_error& exc) {
-                NGRAPH_WARN << "\nCould not create an nGraph Constant for initializer '" << initializer_tensor.name()
-                            << "'. \n"
-                            << "Constant with a 0 value was created, make sure connected input is "
-                               "optional.\n"
-                            << "Otherwise verify if the initializer contains a correct number of "
-                               "elements matching the initializer's shape. \n"
-                            << "Detailed error:\n"
-                            << exc.what();
-                ng_constant = default_opset::Constant::create(tensor.get_ng_type(), Shape{}, {0});
-            }
-
-            initializers.emplace(initializer_tensor.name(), tensor);
-            detail::add_provenance_tag_to_initializer(tensor, ng_constant);
-            m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constant));
+            tensors.emplace_back(initializer_tensor, model_proto);
+        }
+    }
+    std::vector<std::shared_ptr<default_opset::Constant>> ng_constants(tensors.size());
+    common::parallel_for(tensors.size(), [&](std::size_t i) {
+        const auto& tensor = tensors[i];
+        // For each initializer create a Constant node
+        try {
+            ng_constants[i] = tensor.get_ng_constant();
+        } catch (const error::invalid_external_data&) {
+            // invalid external data makes initializers creation impossible
+            throw;
+        } catch (const ngraph::ngraph_error& exc) {
+            NGRAPH_WARN << "\nCould not create an nGraph Constant for initializer '" << tensor.get_name()
+                        << "'. \n"
+                        << "Constant with a 0 value was created, make sure connected input is "
+                           "optional.\n"
+                        << "Otherwise verify if the initializer contains a correct number of "
+                           "elements matching the initializer's shape. \n"
+                        << "Detailed error:\n"
+                        << exc.what();
+            ng_constants[i] = default_opset::Constant::create(tensor.get_ng_type(), Shape{}, {0});
         }
+    });
+    for (std::size_t i = 0; i < tensors.size(); ++i) {
+        const auto& tensor = tensors[i];
+        initializers.emplace(tensor.get_name(), tensor);
+        detail::add_provenance_tag_to_initializer(tensor, ng_constants[i]);
+        m_cache->emplace_node(tensor.get_name(), std::move(ng_constants[i]));
     }
 
     // Process all ONNX graph inputs, convert them to nGraph nodes and store in cache
@@ -160,10 +174,21 @@ Graph::Graph(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto, std::uniqu
                  detail::to_string(unknown_operators));
 }
 
+std::vector<std::unique_ptr<Node>> Graph::decode_nodes() const {
+    // Decoding of a node (including parsing of its subgraphs) does not depend on other nodes,
+    // so it is done in parallel while the conversion keeps the model order
+    const auto& node_protos = m_model->get_graph().node();
+    std::vector<std::unique_ptr<Node>> nodes(node_protos.size());
+    common::parallel_for(nodes.size(), [&](std::size_t i) {
+        nodes[i] = common::make_unique<Node>(node_protos.Get(static_cast<int>(i)), *this);
+    });
+    return nodes;
+}
+
 void Graph::convert_to_ngraph_nodes() {
     // Process ONNX graph nodes, convert to nGraph nodes
-    for (const auto& node_proto : m_model->get_graph().node()) {
-        const Node node{node_proto, *this};
+    for (const auto& decoded_node : decode_nodes()) {
+        const Node& node = *decoded_node;
         if (node.has_subgraphs()) {
             const auto& subgraphs = node.get_subgraphs();
             for (auto& kv : subgraphs) {
@@ -203,8 +228,8 @@ std::shared_ptr<Function> Graph::convert() {
 
 void Graph::decode_to_framework_nodes() {
     // Process ONNX graph nodes, convert to nGraph nodes
-    for (const auto& node_proto : m_model->get_graph().node()) {
-        const Node node{node_proto, *this};
+    for (const auto& decoded_node : decode_nodes()) {
+        const Node& node = *decoded_node;
         std::shared_ptr<frontend::ONNXFrameworkNode> framework_node;
         if (node.has_subgraphs()) {
             const auto& subgraphs = node.get_subgraphs();
@@ -333,8 +358,8 @@ bool Subgraph::is_ng_node_in_cache(const std::string& name) const {
 }
 
 Output<ngraph::Node> Subgraph::get_ng_node_from_cache(const std::string& name) const {
-    if (m_cache->contains(name)) {
-        return m_cache->get_node(name);
+    if (const auto node = m_cache->find_node(name)) {
+        return *node;
     }
     return m_parent_graph->get_ng_node_from_cache(name);
 }
@@ -51,6 +51,7 @@ protected:
 protected:
     virtual void decode_to_framework_nodes();
     void convert_to_ngraph_nodes();
+    std::vector<std::unique_ptr<Node>> decode_nodes() const;
     void remove_dangling_parameters();
     std::shared_ptr<Function> create_function();
 
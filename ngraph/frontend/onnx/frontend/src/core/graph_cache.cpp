@@ -7,6 +7,10 @@
 
 namespace ngraph {
 namespace onnx_import {
+void GraphCache::reserve(std::size_t size) {
+    m_graph_cache_map.reserve(size);
+}
+
 void GraphCache::emplace_node(const std::string& name, Output<ngraph::Node>&& node) {
     m_graph_cache_map[name] = std::move(node);
 }
@@ -19,15 +23,20 @@ void GraphCache::remove_node(const std::string& name) {
 }
 
 Output<ngraph::Node> GraphCache::get_node(const std::string& name) const {
-    try {
-        return m_graph_cache_map.at(name);
-    } catch (const std::out_of_range&) {
+    const auto it = m_graph_cache_map.find(name);
+    if (it == m_graph_cache_map.end()) {
         throw ngraph_error(name + " node not found in graph cache");
     }
+    return it->second;
 }
 
 bool GraphCache::contains(const std::string& name) const {
     return (m_graph_cache_map.count(name) > 0);
 }
+
+const Output<ngraph::Node>* GraphCache::find_node(const std::string& name) const {
+    const auto it = m_graph_cache_map.find(name);
+    return it != m_graph_cache_map.end() ? &it->second : nullptr;
+}
 }  // namespace onnx_import
 }  // namespace ngraph
@@ -4,17 +4,25 @@
 
 #pragma once
 
-#include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include "ngraph/node.hpp"
 
 namespace ngraph {
 namespace onnx_import {
 /// \brief      GraphCache stores and provides access to ONNX graph initializers.
+///
+/// \note       The nodes are looked up by name for every input of every ONNX node,
+///             so they are kept in a hash map instead of an ordered one.
 class GraphCache {
 public:
+    /// \brief      Reserve the space for the given number of nodes.
+    ///
+    /// \param[in]  size       The expected number of nodes in the cache.
+    void reserve(std::size_t size);
+
     /// \brief      Add node to the cache or override the existing one.
     ///
     /// \note       GraphCache takes ownership of the node.
@@ -44,10 +52,17 @@ public:
     /// \return     true if the node named `name` exist in the cache, false otherwise.
     virtual bool contains(const std::string& name) const;
 
+    /// \brief      Find the node in the cache with a single lookup.
+    ///
+    /// \param[in]  name       The name of the node.
+    ///
+    /// \return     Pointer to the node named `name` or nullptr if there is no such node.
+    const Output<ngraph::Node>* find_node(const std::string& name) const;
+
     virtual ~GraphCache() = default;
 
 private:
-    std::map<std::string, Output<ngraph::Node>> m_graph_cache_map;
+    std::unordered_map<std::string, Output<ngraph::Node>> m_graph_cache_map;
 };
 }  // namespace onnx_import
 }  // namespace ngraph
@@ -7,10 +7,13 @@
 #include <onnx/onnx_pb.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <memory>
 #include <utility>
 #include <vector>
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "onnx_common/utils.hpp"
@@ -352,8 +355,13 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+    /// \param tensor       Tensor proto to be wrapped
+    /// \param model_proto  Owner of the tensor proto, when provided constants are created on top of
+    ///                     the tensor raw data without a copy and keep the model proto alive
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                    std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto = nullptr)
         : m_tensor_proto{&tensor},
+          m_model_proto{std::move(model_proto)},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
@@ -469,9 +477,36 @@ public:
     }
 
 private:
+    template <typename T>
+    bool can_share_data(const element::Type& type, const void* data, size_t size) const {
+        return size == shape_size(m_shape) * type.size() && reinterpret_cast<std::uintptr_t>(data) % alignof(T) == 0;
+    }
+
     template <typename T>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
-        auto constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+        if (m_tensor_proto->has_segment()) {
+            throw error::tensor::segments_unsupported{};
+        }
+        std::shared_ptr<ngraph::op::Constant> constant;
+        // External data is mapped and raw data is referenced in place, both are stored in the same layout as
+        // nGraph uses, so such constants are created without copying when the data is properly aligned
+        if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto)) {
+            auto buffer = detail::TensorExternalData(*m_tensor_proto).load_external_mmap_data();
+            if (can_share_data<T>(type, buffer->get_ptr(), buffer->size())) {
+                constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+            }
+        } else if (m_model_proto && m_tensor_proto->has_raw_data()) {
+            const auto& raw_data = m_tensor_proto->raw_data();
+            if (can_share_data<T>(type, raw_data.data(), raw_data.size())) {
+                using ProtoBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ONNX_NAMESPACE::ModelProto>>;
+                auto buffer =
+                    std::make_shared<ProtoBuffer>(const_cast<char*>(raw_data.data()), raw_data.size(), m_model_proto);
+                constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+            }
+        }
+        if (!constant) {
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+        }
         if (m_tensor_proto->has_name()) {
             constant->set_friendly_name(get_name());
         }
@@ -479,6 +514,7 @@ private:
     }
 
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
+    std::shared_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
     Shape m_shape;
 };
 
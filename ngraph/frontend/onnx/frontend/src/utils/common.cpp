@@ -6,6 +6,10 @@
 
 #include <onnx/onnx_pb.h>  // onnx types
 
+#include <atomic>
+#include <exception>
+#include <thread>
+
 #include "default_opset.hpp"
 #include "ngraph/graph_util.hpp"
 
@@ -121,6 +125,43 @@ template OutputVector handle_opset6_binary_op<default_opset::Divide>(const Node&
 template OutputVector handle_opset6_binary_op<default_opset::Multiply>(const Node& node);
 template OutputVector handle_opset6_binary_op<default_opset::Subtract>(const Node& node);
 
+void parallel_for(std::size_t work_amount, const std::function<void(std::size_t)>& func) {
+    // nested regions (e.g. subgraphs decoded by a worker) are not parallelized again
+    static thread_local bool in_parallel_region = false;
+    const std::size_t threads_num =
+        in_parallel_region ? 1 : std::min<std::size_t>(work_amount, std::max(1u, std::thread::hardware_concurrency()));
+
+    std::vector<std::exception_ptr> errors(work_amount);
+    std::atomic<std::size_t> next_work{0};
+    auto worker = [&]() {
+        const bool outer_region = in_parallel_region;
+        in_parallel_region = true;
+        for (std::size_t i = next_work++; i < work_amount; i = next_work++) {
+            try {
+                func(i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+        in_parallel_region = outer_region;
+    };
+
+    std::vector<std::thread> threads;
+    if (threads_num > 1) {
+        threads.reserve(threads_num - 1);
+        for (std::size_t i = 0; i < threads_num - 1; ++i)
+            threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads)
+        thread.join();
+
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
 }  // namespace  common
 }  // namespace onnx_import
 }  // namespace ngraph
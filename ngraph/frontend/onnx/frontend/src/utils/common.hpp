@@ -8,6 +8,7 @@
 #include <cmath>        // std::floor, std::min
 #include <cstddef>      // std::size_t
 #include <cstdint>      // std::int64_t
+#include <functional>   // std::function
 #include <iterator>     // std::begin, std::end
 #include <memory>       // std::shared_ptr, std::make_shared
 #include <type_traits>  // std::enable_if
@@ -124,6 +125,15 @@ std::unique_ptr<T> make_unique(Args&&... args) {
     return std::unique_ptr<T>(new T(std::forward<Args>(args)...));
 }
 
+/// \brief Calls func for every index in range [0, work_amount) using all available hardware threads.
+/// \note  Calls made from inside of func are executed sequentially in the calling thread.
+///        If any call throws, the exception of the lowest index is rethrown once all calls are done,
+///        so the reported error does not depend on scheduling.
+///
+/// \param work_amount Number of indices to process.
+/// \param func        Function called for each index, calls must be independent of each other.
+void parallel_for(std::size_t work_amount, const std::function<void(std::size_t)>& func);
+
 /// \brief Function that handles following ONNX operators: Add, Div, Mul, Sub
 ///        from opset 6.
 ///
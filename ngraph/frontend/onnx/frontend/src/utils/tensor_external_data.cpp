@@ -5,6 +5,8 @@
 #include "utils/tensor_external_data.hpp"
 
 #include <fstream>
+#include <map>
+#include <mutex>
 #include <sstream>
 
 #include "exceptions.hpp"
@@ -67,6 +69,46 @@ std::string TensorExternalData::load_external_data() const {
     return read_data;
 }
 
+std::shared_ptr<TensorExternalData::MappedBuffer> TensorExternalData::load_external_mmap_data() const {
+    // Tensors of one model usually share a single data file, reuse its mapping while any of them is alive
+    static std::mutex cache_mutex;
+    static std::map<std::string, std::weak_ptr<ov::util::MappedMemory>> cache;
+
+    std::shared_ptr<ov::util::MappedMemory> mapped;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        mapped = cache[m_data_location].lock();
+        if (!mapped) {
+            try {
+                NGRAPH_SUPPRESS_DEPRECATED_START
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+                mapped = ov::util::load_mmap_object(ov::util::string_to_wstring(m_data_location));
+#else
+                mapped = ov::util::load_mmap_object(m_data_location);
+#endif
+                NGRAPH_SUPPRESS_DEPRECATED_END
+            } catch (const std::exception&) {
+                cache.erase(m_data_location);
+                throw error::invalid_external_data{*this};
+            }
+            cache[m_data_location] = mapped;
+        }
+    }
+
+    if (m_offset < 0 || m_data_length < 0 || static_cast<size_t>(m_offset) > mapped->size())
+        throw error::invalid_external_data{*this};
+    // default value of m_data_length is 0 which means the rest of the file
+    const size_t data_length = m_data_length == 0 ? mapped->size() - m_offset : m_data_length;
+    if (m_offset + data_length > mapped->size())
+        throw error::invalid_external_data{*this};
+
+    if (m_sha1_digest != 0) {
+        NGRAPH_WARN << "SHA1 checksum is not supported";
+    }
+
+    return std::make_shared<MappedBuffer>(mapped->data() + m_offset, data_length, mapped);
+}
+
 std::string TensorExternalData::to_string() const {
     std::stringstream s;
     s << "ExternalDataInfo(";
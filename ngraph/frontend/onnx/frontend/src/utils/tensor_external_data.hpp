@@ -6,12 +6,17 @@
 
 #include <onnx/onnx_pb.h>
 
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
+    using MappedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>;
+
     TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor);
 
     /// \brief      Load external data from tensor passed to constructor
@@ -23,6 +28,16 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data() const;
 
+    /// \brief      Map external data from tensor passed to constructor into memory
+    ///
+    /// \note       The file is mapped once and the mapping is shared by all tensors
+    ///             stored in it, it is released together with the last buffer.
+    ///             If mapping the file fails or the data exceeds the file size,
+    ///             the invalid_external_data exception is thrown.
+    ///
+    /// \return     Buffer pointing to the external data inside of the mapped file
+    std::shared_ptr<MappedBuffer> load_external_mmap_data() const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
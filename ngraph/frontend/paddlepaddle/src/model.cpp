@@ -2,12 +2,19 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <cstring>
+#include <exception>
 #include <fstream>
+#include <functional>
 #include <ngraph/opsets/opset7.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
+#include <openvino/util/mmap_object.hpp>
 #include <paddlepaddle_frontend/exceptions.hpp>
 #include <paddlepaddle_frontend/model.hpp>
 #include <paddlepaddle_frontend/place.hpp>
 #include <queue>
+#include <thread>
 
 #include "decoder.hpp"
 #include "framework.pb.h"
@@ -51,7 +58,9 @@ public:
 private:
     void loadPlaces();
     template <typename T>
-    void loadConsts(const std::basic_string<T>& folder_with_weights, std::istream* weight_stream);
+    void loadConsts(const std::basic_string<T>& folder_with_weights,
+                    std::istream* weight_stream,
+                    const std::shared_ptr<ov::util::MappedMemory>& mapped_weights);
     std::vector<std::shared_ptr<OpPlacePDPD>> determine_cut_nodes() const;
 
     std::vector<std::shared_ptr<OpPlacePDPD>> m_op_places;
@@ -130,6 +139,66 @@ void InputModelPDPD::InputModelPDPDImpl::loadPlaces() {
 }
 
 namespace pdpd {
+using MappedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>;
+using VectorBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<std::vector<char>>>;
+
+void parallel_for(size_t work_amount, const std::function<void(size_t)>& func) {
+    const size_t threads_num = std::min<size_t>(work_amount, std::max(1u, std::thread::hardware_concurrency()));
+
+    std::vector<std::exception_ptr> errors(work_amount);
+    std::atomic<size_t> next_work{0};
+    auto worker = [&]() {
+        for (size_t i = next_work++; i < work_amount; i = next_work++) {
+            try {
+                func(i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    if (threads_num > 1) {
+        threads.reserve(threads_num - 1);
+        for (size_t i = 0; i < threads_num - 1; ++i)
+            threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads)
+        thread.join();
+
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
+// Skips the header of the tensor stored at `offset` of the mapped weights, returns pointer to its data or nullptr
+// if the data is out of the mapped region. `offset` is moved to the next tensor.
+char* map_tensor(const std::shared_ptr<ov::util::MappedMemory>& mapped, size_t& offset, size_t len) {
+    const size_t size = mapped->size();
+    uint32_t dims_len = 0;
+    if (offset + 16 + sizeof(dims_len) > size)
+        return nullptr;
+    std::memcpy(&dims_len, mapped->data() + offset + 16, sizeof(dims_len));
+    const size_t data_offset = offset + 16 + sizeof(dims_len) + dims_len;
+    if (data_offset + len > size)
+        return nullptr;
+    offset = data_offset + len;
+    return mapped->data() + data_offset;
+}
+
+// Mapped data is referenced in place when it is aligned for the element type, otherwise it is copied
+std::shared_ptr<opset7::Constant> make_mapped_constant(const element::Type& type,
+                                                       const Shape& shape,
+                                                       const std::shared_ptr<ov::util::MappedMemory>& mapped,
+                                                       char* data,
+                                                       size_t len) {
+    if (type.size() == 0 || reinterpret_cast<std::uintptr_t>(data) % type.size() != 0)
+        return opset7::Constant::create(type, shape, data);
+    return std::make_shared<opset7::Constant>(type, shape, std::make_shared<MappedBuffer>(data, len, mapped));
+}
+
 bool read_tensor(std::istream& is, char* data, size_t len) {
     std::vector<char> header(16);
     is.read(&header[0], 16);
@@ -158,16 +227,13 @@ std::basic_string<wchar_t> get_const_path(const std::basic_string<wchar_t>& fold
 #endif
 
 template <typename T>
-std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstream* weights_stream) {
+std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::basic_string<T>* weights_path) {
     std::string model_file{path};
     std::string ext = ".pdmodel";
     if (pdpd::endsWith(model_file, ext)) {
         std::string params_ext = ".pdiparams";
-        std::string weights_file{path};
-        weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_path = path;
+        weights_path->replace(weights_path->size() - ext.size(), ext.size(), params_ext);
     } else {
         model_file += pdpd::get_path_sep<T>() + "__model__";
     }
@@ -176,22 +242,32 @@ std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstr
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
 template <>
-std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path, std::ifstream* weights_stream) {
+std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path, std::wstring* weights_path) {
     std::wstring model_file{path};
     std::wstring ext = L".pdmodel";
     if (pdpd::endsWith(model_file, ext)) {
         std::wstring params_ext = L".pdiparams";
-        std::wstring weights_file{path};
-        weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_path = path;
+        weights_path->replace(weights_path->size() - ext.size(), ext.size(), params_ext);
     } else {
         model_file += pdpd::get_path_sep<wchar_t>() + L"__model__";
     }
     return model_file;
 }
 #endif
+
+template <typename T>
+std::shared_ptr<ov::util::MappedMemory> map_weights(const std::basic_string<T>& weights_path) {
+    if (weights_path.empty())
+        return nullptr;
+    try {
+        return ov::util::load_mmap_object(weights_path);
+    } catch (const std::runtime_error&) {
+        // Don't throw error if file isn't opened
+        // It may mean that model don't have constants
+        return nullptr;
+    }
+}
 }  // namespace pdpd
 
 std::vector<std::shared_ptr<OpPlacePDPD>> InputModelPDPD::InputModelPDPDImpl::get_op_places() const {
@@ -242,7 +318,15 @@ std::vector<std::shared_ptr<OpPlacePDPD>> InputModelPDPD::InputModelPDPDImpl::de
 
 template <typename T>
 void InputModelPDPD::InputModelPDPDImpl::loadConsts(const std::basic_string<T>& folder_with_weights,
-                                                    std::istream* weight_stream) {
+                                                    std::istream* weight_stream,
+                                                    const std::shared_ptr<ov::util::MappedMemory>& mapped_weights) {
+    struct ConstDesc {
+        std::string name;
+        element::Type type;
+        Shape shape;
+        size_t data_length;
+    };
+    std::vector<ConstDesc> descs;
     for (const auto& item : m_var_places) {
         const auto& var_desc = item.second->get_desc();
         const auto& name = item.first;
@@ -255,27 +339,65 @@ void InputModelPDPD::InputModelPDPDImpl::loadConsts(const std::basic_string<T>&
         const auto& tensor = var_desc.type().lod_tensor().tensor();
         Shape shape(tensor.dims().cbegin(), tensor.dims().cend());
         const auto& type = TYPE_MAP[tensor.data_type()];
-        const auto& data_length = shape_size(shape) * type.size();
-        std::vector<uint8_t> tensor_data(data_length);
-
-        bool read_succeed = false;
-        if (weight_stream) {
-            read_succeed = pdpd::read_tensor(*weight_stream, reinterpret_cast<char*>(&tensor_data[0]), data_length);
-        } else if (!folder_with_weights.empty()) {
-            std::ifstream is(pdpd::get_const_path(folder_with_weights, name), std::ios::in | std::ifstream::binary);
-            FRONT_END_GENERAL_CHECK(is && is.is_open(), "Cannot open file for constant value.");
-            read_succeed = pdpd::read_tensor(is, reinterpret_cast<char*>(&tensor_data[0]), data_length);
-        } else {
-            FRONT_END_GENERAL_CHECK(false, "Either folder with weights or stream must be provided.");
+        descs.push_back({name, type, shape, shape_size(shape) * type.size()});
+    }
+
+    // Mapped weights are not read until the constants are used, so the constants are created without copying;
+    // the tensors stored in separate files are mapped independently of each other in parallel
+    std::vector<std::shared_ptr<opset7::Constant>> constants(descs.size());
+    if (weight_stream) {
+        for (size_t i = 0; i < descs.size(); i++) {
+            const auto& desc = descs[i];
+            auto tensor_data = std::make_shared<std::vector<char>>(desc.data_length);
+            FRONT_END_GENERAL_CHECK(pdpd::read_tensor(*weight_stream, tensor_data->data(), desc.data_length),
+                                    "File containing constant with name ",
+                                    desc.name,
+                                    " wasn't successfully read.");
+            constants[i] = std::make_shared<opset7::Constant>(
+                desc.type,
+                desc.shape,
+                std::make_shared<pdpd::VectorBuffer>(tensor_data->data(), desc.data_length, tensor_data));
         }
-        FRONT_END_GENERAL_CHECK(read_succeed,
-                                "File containing constant with name ",
-                                name,
-                                " wasn't successfully read.");
-
-        auto const_node = opset7::Constant::create(type, shape, &tensor_data[0]);
-        const_node->set_friendly_name(name);
-        m_tensor_values[name] = const_node;
+    } else if (mapped_weights) {
+        // the tensors are stored one after another in the same order, only their headers are parsed here
+        std::vector<char*> tensor_data(descs.size());
+        size_t offset = 0;
+        for (size_t i = 0; i < descs.size(); i++) {
+            tensor_data[i] = pdpd::map_tensor(mapped_weights, offset, descs[i].data_length);
+            FRONT_END_GENERAL_CHECK(tensor_data[i],
+                                    "File containing constant with name ",
+                                    descs[i].name,
+                                    " wasn't successfully read.");
+        }
+        pdpd::parallel_for(descs.size(), [&](size_t i) {
+            const auto& desc = descs[i];
+            constants[i] =
+                pdpd::make_mapped_constant(desc.type, desc.shape, mapped_weights, tensor_data[i], desc.data_length);
+        });
+    } else {
+        FRONT_END_GENERAL_CHECK(descs.empty() || !folder_with_weights.empty(),
+                                "Either folder with weights or stream must be provided.");
+        pdpd::parallel_for(descs.size(), [&](size_t i) {
+            const auto& desc = descs[i];
+            std::shared_ptr<ov::util::MappedMemory> mapped;
+            try {
+                mapped = ov::util::load_mmap_object(pdpd::get_const_path(folder_with_weights, desc.name));
+            } catch (const std::runtime_error&) {
+                FRONT_END_GENERAL_CHECK(false, "Cannot open file for constant value.");
+            }
+            size_t offset = 0;
+            auto tensor_data = pdpd::map_tensor(mapped, offset, desc.data_length);
+            FRONT_END_GENERAL_CHECK(tensor_data,
+                                    "File containing constant with name ",
+                                    desc.name,
+                                    " wasn't successfully read.");
+            constants[i] = pdpd::make_mapped_constant(desc.type, desc.shape, mapped, tensor_data, desc.data_length);
+        });
+    }
+
+    for (size_t i = 0; i < descs.size(); i++) {
+        constants[i]->set_friendly_name(descs[i].name);
+        m_tensor_values[descs[i].name] = constants[i];
     }
 }
 
@@ -283,9 +405,8 @@ template <typename T>
 InputModelPDPD::InputModelPDPDImpl::InputModelPDPDImpl(const std::basic_string<T>& path, const InputModel& input_model)
     : m_fw_ptr{std::make_shared<ProgramDesc>()},
       m_input_model(input_model) {
-    std::string empty_str = "";
-    std::ifstream weights_stream;
-    std::ifstream pb_stream(pdpd::get_model_path<T>(path, &weights_stream), std::ios::in | std::ifstream::binary);
+    std::basic_string<T> weights_path;
+    std::ifstream pb_stream(pdpd::get_model_path<T>(path, &weights_path), std::ios::in | std::ifstream::binary);
 
     FRONT_END_GENERAL_CHECK(pb_stream && pb_stream.is_open(), "Model file doesn't exist");
     FRONT_END_GENERAL_CHECK(m_fw_ptr->ParseFromIstream(&pb_stream), "Model can't be parsed");
@@ -298,10 +419,10 @@ InputModelPDPD::InputModelPDPDImpl::InputModelPDPDImpl(const std::basic_string<T
         version >= 2000000 || version == 0,
         "[Frontend]Only Support Paddle greater than 2.0.0, current version " + std::to_string(version));
     loadPlaces();
-    if (weights_stream && weights_stream.is_open()) {
-        loadConsts(std::basic_string<T>{}, &weights_stream);
+    if (auto mapped_weights = pdpd::map_weights(weights_path)) {
+        loadConsts(std::basic_string<T>{}, nullptr, mapped_weights);
     } else {
-        loadConsts(path, nullptr);
+        loadConsts(path, nullptr, nullptr);
     }
 }
 
@@ -320,7 +441,7 @@ InputModelPDPD::InputModelPDPDImpl::InputModelPDPDImpl(const std::vector<std::is
         "[Frontend]Only Support Paddle greater than 2.0.0, current version " + std::to_string(version));
     loadPlaces();
     if (streams.size() > 1)
-        loadConsts(std::string(), streams[1]);
+        loadConsts(std::string(), streams[1], nullptr);
 }
 
 std::vector<Place::Ptr> InputModelPDPD::InputModelPDPDImpl::getInputs() const {
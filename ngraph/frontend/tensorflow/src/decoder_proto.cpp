@@ -27,52 +27,49 @@ const std::map<::tensorflow::DataType, ov::element::Type>& TYPE_MAP() {
 
 std::shared_ptr<ov::Variant> DecoderTFProto::get_attribute(const std::string& name,
                                                            const VariantTypeInfo& type_info) const {
-    auto attrs = decode_attribute_helper(name);
-    if (attrs.empty()) {
-        return nullptr;
-    }
+    const auto& attr = decode_attribute_helper(name);
 
     if (type_info == VariantWrapper<std::string>::get_type_info_static()) {
-        return std::make_shared<VariantWrapper<std::string>>(attrs[0].s());
+        return std::make_shared<VariantWrapper<std::string>>(attr.s());
     } else if (type_info == VariantWrapper<int64_t>::get_type_info_static()) {
-        return std::make_shared<VariantWrapper<int64_t>>(attrs[0].i());
+        return std::make_shared<VariantWrapper<int64_t>>(attr.i());
     } else if (type_info == VariantWrapper<std::vector<int64_t>>::get_type_info_static()) {
         std::vector<int64_t> longs;
-        longs.reserve(attrs[0].list().i_size());
-        for (size_t idx = 0; idx < attrs[0].list().i_size(); ++idx) {
-            longs.push_back(attrs[0].list().i(idx));
+        longs.reserve(attr.list().i_size());
+        for (size_t idx = 0; idx < attr.list().i_size(); ++idx) {
+            longs.push_back(attr.list().i(idx));
         }
         return std::make_shared<VariantWrapper<std::vector<int64_t>>>(longs);
     } else if (type_info == VariantWrapper<int32_t>::get_type_info_static()) {
-        return std::make_shared<VariantWrapper<int32_t>>(static_cast<int32_t>(attrs[0].i()));
+        return std::make_shared<VariantWrapper<int32_t>>(static_cast<int32_t>(attr.i()));
     } else if (type_info == VariantWrapper<std::vector<int32_t>>::get_type_info_static()) {
         std::vector<int32_t> ints;
-        ints.reserve(attrs[0].list().i_size());
-        for (size_t idx = 0; idx < attrs[0].list().i_size(); ++idx) {
-            ints.push_back(static_cast<int32_t>(attrs[0].list().i(idx)));
+        ints.reserve(attr.list().i_size());
+        for (size_t idx = 0; idx < attr.list().i_size(); ++idx) {
+            ints.push_back(static_cast<int32_t>(attr.list().i(idx)));
         }
         return std::make_shared<VariantWrapper<std::vector<int32_t>>>(ints);
     } else if (type_info == VariantWrapper<float>::get_type_info_static()) {
-        return std::make_shared<VariantWrapper<float>>(attrs[0].f());
+        return std::make_shared<VariantWrapper<float>>(attr.f());
     } else if (type_info == VariantWrapper<std::vector<float>>::get_type_info_static()) {
         std::vector<float> floats;
-        floats.reserve(attrs[0].list().i_size());
-        for (size_t idx = 0; idx < attrs[0].list().i_size(); ++idx) {
-            floats.push_back(attrs[0].list().f(idx));
+        floats.reserve(attr.list().i_size());
+        for (size_t idx = 0; idx < attr.list().i_size(); ++idx) {
+            floats.push_back(attr.list().f(idx));
         }
         return std::make_shared<VariantWrapper<std::vector<float>>>(floats);
     } else if (type_info == VariantWrapper<ov::element::Type>::get_type_info_static()) {
-        auto data_type = attrs[0].type();
+        auto data_type = attr.type();
         return std::make_shared<VariantWrapper<ov::element::Type>>(TYPE_MAP().at(data_type));
     } else if (type_info == VariantWrapper<bool>::get_type_info_static()) {
-        return std::make_shared<VariantWrapper<bool>>(attrs[0].b());
+        return std::make_shared<VariantWrapper<bool>>(attr.b());
     } else if (type_info == VariantWrapper<::tensorflow::DataType>::get_type_info_static()) {
-        return std::make_shared<VariantWrapper<::tensorflow::DataType>>(attrs[0].type());
+        return std::make_shared<VariantWrapper<::tensorflow::DataType>>(attr.type());
     } else if (type_info == VariantWrapper<::tensorflow::TensorProto>::get_type_info_static()) {
-        return std::make_shared<VariantWrapper<::tensorflow::TensorProto>>(attrs[0].tensor());
+        return std::make_shared<VariantWrapper<::tensorflow::TensorProto>>(attr.tensor());
     } else if (type_info == VariantWrapper<::ov::PartialShape>::get_type_info_static()) {
         std::vector<ov::Dimension> dims;
-        auto tf_shape = attrs[0].shape();
+        auto tf_shape = attr.shape();
         for (int i = 0; i < tf_shape.dim_size(); i++) {
             dims.push_back(tf_shape.dim(i).size());
         }
@@ -111,16 +108,47 @@ const std::string& DecoderTFProto::get_op_name() const {
     return m_node_def->name();
 }
 
-std::vector<::tensorflow::AttrValue> DecoderTFProto::decode_attribute_helper(const std::string& name) const {
-    auto attr_map = m_node_def->attr();
-    FRONT_END_GENERAL_CHECK(attr_map.contains(name),
+std::shared_ptr<DecoderTFProto::TensorContentBuffer> DecoderTFProto::get_tensor_content(const std::string& name,
+                                                                                         const ov::element::Type& type,
+                                                                                         ov::Shape& shape) const {
+    const auto& attr = decode_attribute_helper(name);
+    if (!attr.has_tensor()) {
+        return nullptr;
+    }
+    const auto& tensor = attr.tensor();
+    const auto type_it = TYPE_MAP().find(tensor.dtype());
+    if (type_it == TYPE_MAP().end() || type_it->second != type || type.size() == 0 || !tensor.has_tensor_shape() ||
+        tensor.tensor_shape().unknown_rank()) {
+        return nullptr;
+    }
+
+    ov::Shape tensor_shape;
+    for (const auto& dim : tensor.tensor_shape().dim()) {
+        if (dim.size() < 0) {
+            return nullptr;
+        }
+        tensor_shape.push_back(static_cast<size_t>(dim.size()));
+    }
+    const auto& content = tensor.tensor_content();
+    if (content.empty() || content.size() != ov::shape_size(tensor_shape) * type.size() ||
+        reinterpret_cast<std::uintptr_t>(content.data()) % type.size() != 0) {
+        return nullptr;
+    }
+
+    shape = tensor_shape;
+    return std::make_shared<TensorContentBuffer>(const_cast<char*>(content.data()), content.size(), m_node_def);
+}
+
+const ::tensorflow::AttrValue& DecoderTFProto::decode_attribute_helper(const std::string& name) const {
+    const auto& attr_map = m_node_def->attr();
+    const auto attr_it = attr_map.find(name);
+    FRONT_END_GENERAL_CHECK(attr_it != attr_map.end(),
                             "An error occurred while parsing the ",
                             name,
                             " attribute of ",
                             this->get_op_type(),
                             "node");
-    auto value = m_node_def->attr().at(name);
-    return {value};
+    return attr_it->second;
 }
 }  // namespace tf
 }  // namespace frontend
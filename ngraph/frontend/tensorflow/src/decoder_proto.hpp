@@ -5,6 +5,7 @@
 #pragma once
 
 #include <ngraph/ngraph.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
 #include <string>
 #include <tensorflow_frontend/decoder.hpp>
 #include <tensorflow_frontend/frontend.hpp>
@@ -21,7 +22,10 @@ namespace tf {
 
 class DecoderTFProto : public DecoderBase {
 public:
-    explicit DecoderTFProto(const ::tensorflow::NodeDef* node_def) : m_node_def(node_def) {}
+    /// Memory of the tensor content which keeps alive the node it belongs to
+    using TensorContentBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<const ::tensorflow::NodeDef>>;
+
+    explicit DecoderTFProto(const std::shared_ptr<const ::tensorflow::NodeDef>& node_def) : m_node_def(node_def) {}
 
     std::shared_ptr<ov::Variant> get_attribute(const std::string& name,
                                                const VariantTypeInfo& type_info) const override;
@@ -36,9 +40,19 @@ public:
 
     const std::string& get_op_name() const override;
 
+    /// \brief Returns the raw content of the tensor attribute to be referenced by a Constant without copying
+    /// \param name Name of the tensor attribute
+    /// \param type Expected element type of the tensor
+    /// \param shape Shape of the tensor, set if the content is returned
+    /// \return Buffer referencing the content or nullptr if the tensor values are not stored as a raw content of
+    /// the static shape or the content is not aligned for the element type
+    std::shared_ptr<TensorContentBuffer> get_tensor_content(const std::string& name,
+                                                            const ov::element::Type& type,
+                                                            ov::Shape& shape) const;
+
 private:
-    std::vector<::tensorflow::AttrValue> decode_attribute_helper(const std::string& name) const;
-    const ::tensorflow::NodeDef* m_node_def;
+    const ::tensorflow::AttrValue& decode_attribute_helper(const std::string& name) const;
+    std::shared_ptr<const ::tensorflow::NodeDef> m_node_def;
 };
 }  // namespace tf
 }  // namespace frontend
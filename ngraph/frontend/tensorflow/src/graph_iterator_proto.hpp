@@ -4,10 +4,16 @@
 
 #pragma once
 
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/wire_format_lite.h>
+
 #include <fstream>
 #include <tensorflow_frontend/decoder.hpp>
 #include <tensorflow_frontend/graph_iterator.hpp>
 
+#include <limits>
+
 #include "decoder_proto.hpp"
 #include "graph.pb.h"
 #include "node_def.pb.h"
@@ -16,21 +22,50 @@ namespace ov {
 namespace frontend {
 namespace tf {
 class GraphIteratorProto : public GraphIterator {
-    std::vector<const ::tensorflow::NodeDef*> m_nodes;
+    std::vector<std::shared_ptr<const ::tensorflow::NodeDef>> m_nodes;
     size_t node_index = 0;
-    std::shared_ptr<::tensorflow::GraphDef> m_graph_def;
+
+    /// Decodes the nodes of GraphDef one by one in the model order, so the graph is not limited by the protobuf
+    /// message size limit and only the nodes are kept in memory. The other GraphDef fields are skipped.
+    bool decode_nodes(std::istream& stream) {
+        using google::protobuf::internal::WireFormatLite;
+        google::protobuf::io::IstreamInputStream input(&stream);
+        while (true) {
+            // every field is read with its own coded stream, so the total bytes limit applies to a single node
+            google::protobuf::io::CodedInputStream coded(&input);
+            const auto tag = coded.ReadTag();
+            if (tag == 0) {
+                return coded.ConsumedEntireMessage();
+            }
+            if (WireFormatLite::GetTagFieldNumber(tag) != ::tensorflow::GraphDef::kNodeFieldNumber ||
+                WireFormatLite::GetTagWireType(tag) != WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+                if (!WireFormatLite::SkipField(&coded, tag)) {
+                    return false;
+                }
+                continue;
+            }
+
+            uint32_t length = 0;
+            if (!coded.ReadVarint32(&length) || length > static_cast<uint32_t>(std::numeric_limits<int>::max())) {
+                return false;
+            }
+            const auto limit = coded.PushLimit(static_cast<int>(length));
+            auto node = std::make_shared<::tensorflow::NodeDef>();
+            if (!node->ParseFromCodedStream(&coded) || !coded.ConsumedEntireMessage()) {
+                return false;
+            }
+            coded.PopLimit(limit);
+            m_nodes.push_back(node);
+        }
+    }
 
 public:
     template <typename T>
-    GraphIteratorProto(const std::basic_string<T>& path) : m_graph_def(std::make_shared<::tensorflow::GraphDef>()) {
+    GraphIteratorProto(const std::basic_string<T>& path) {
         std::ifstream pb_stream(path, std::ios::in | std::ifstream::binary);
 
         FRONT_END_GENERAL_CHECK(pb_stream && pb_stream.is_open(), "Model file does not exist");
-        FRONT_END_GENERAL_CHECK(m_graph_def->ParseFromIstream(&pb_stream), "Model cannot be parsed");
-
-        m_nodes.resize(m_graph_def->node_size());
-        for (size_t i = 0; i < m_nodes.size(); ++i)
-            m_nodes[i] = &m_graph_def->node(i);
+        FRONT_END_GENERAL_CHECK(decode_nodes(pb_stream), "Model cannot be parsed");
     }
 
     /// Set iterator to the start position
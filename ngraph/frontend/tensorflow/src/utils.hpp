@@ -272,7 +272,7 @@ static Status ValuesFromConstNode(const ::ov::frontend::DecoderBase* node,
     auto tensor_proto_var =
         node->get_attribute("value", ::ov::VariantWrapper<::tensorflow::TensorProto>::get_type_info_static());
     FRONT_END_GENERAL_CHECK(tensor_proto_var);
-    auto tensor_proto =
+    const auto& tensor_proto =
         std::dynamic_pointer_cast<::ov::VariantWrapper<::tensorflow::TensorProto>>(tensor_proto_var)->get();
 
     const tensorflow::TensorShapeProto& shape = tensor_proto.tensor_shape();
@@ -280,7 +280,7 @@ static Status ValuesFromConstNode(const ::ov::frontend::DecoderBase* node,
     TFTensorShapeToNGraphShape(shape, &pshape);
     *const_tensor_shape = pshape.get_shape();
     FRONT_END_GENERAL_CHECK(!pshape.is_dynamic(), "Dynamic shapes are not supported in ValuesFromConstNode function");
-    auto tensor_content = tensor_proto.tensor_content();
+    const auto& tensor_content = tensor_proto.tensor_content();
     std::vector<char> tensor_values_plain(tensor_content.begin(), tensor_content.end());
     const T* tensor_values = reinterpret_cast<const T*>(tensor_values_plain.data());
 
@@ -371,6 +371,14 @@ static Status MakeConstOp(const NodeContext& node, ov::element::Type et, ov::Out
     std::vector<VecT> const_values;
     ov::Shape ng_shape;
 
+    // raw tensor content of the proto model is referenced in place, the other representations are decoded to values
+    if (auto decoder = dynamic_cast<const DecoderTFProto*>(node.get_decoder())) {
+        if (auto buffer = decoder->get_tensor_content("value", et, ng_shape)) {
+            ng_node = ConstructNgNode<ov::opset8::Constant>(node.get_name(), et, ng_shape, buffer);
+            return Status::OK();
+        }
+    }
+
     TF_RETURN_IF_ERROR((ValuesFromConstNode<T, VecT>(node.get_decoder(), &ng_shape, &const_values)));
 
     ng_node = ConstructNgNode<ov::opset8::Constant>(node.get_name(), et, ng_shape, const_values);
@@ -3240,3 +3240,28 @@ TEST(constant_folding, constant_loop) {
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+TEST(constant_folding, independent_subgraphs_with_memory_limit) {
+    const size_t subgraphs_num = 16;
+    for (size_t memory_limit : {size_t{1}, size_t{1} << 30}) {
+        OutputVector results;
+        for (size_t i = 0; i < subgraphs_num; ++i) {
+            auto constant = op::Constant::create(element::f32, Shape{2, 2}, {1.0f * i, 2.0f, 3.0f, 4.0f});
+            auto add = make_shared<op::v1::Add>(constant, constant);
+            auto mul = make_shared<op::v1::Multiply>(add, constant);
+            results.push_back(mul);
+        }
+        auto f = make_shared<Function>(results, ParameterVector{});
+
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::ConstantFolding>(memory_limit);
+        pass_manager.run_passes(f);
+
+        EXPECT_EQ(count_ops_of_type<op::v1::Add>(f), 0);
+        EXPECT_EQ(count_ops_of_type<op::v1::Multiply>(f), 0);
+        for (size_t i = 0; i < subgraphs_num; ++i) {
+            const float first = 1.0f * i;
+            ASSERT_EQ(get_result_constant<float>(f, i), (vector<float>{2 * first * first, 8.0f, 18.0f, 32.0f}));
+        }
+    }
+}
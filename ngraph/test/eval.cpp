@@ -165,6 +165,25 @@ TEST(eval, evaluate_dynamic_range_sum) {
     ASSERT_EQ(cval, seq);
 }
 
+TEST(eval, evaluate_reuses_intermediate_memory) {
+    // the intermediate values share the evaluation arena, a value must stay intact till its last consumer
+    auto p = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto relu = make_shared<op::Relu>(p);
+    auto neg = make_shared<op::Negative>(relu);
+    auto abs = make_shared<op::Abs>(neg);
+    auto add1 = make_shared<op::v1::Add>(relu, abs);
+    auto add2 = make_shared<op::v1::Add>(add1, neg);
+    auto fun = make_shared<Function>(OutputVector{add2, add1}, ParameterVector{p});
+    auto result1 = make_shared<HostTensor>();
+    auto result2 = make_shared<HostTensor>();
+    for (int i = 0; i < 2; i++) {
+        ASSERT_TRUE(fun->evaluate({result1, result2},
+                                  {make_host_tensor<element::Type_t::f32>(Shape{4}, {1.0f, -2.0f, 3.0f, -4.0f})}));
+        EXPECT_EQ(read_vector<float>(result1), (vector<float>{1.0f, 0.0f, 3.0f, 0.0f}));
+        EXPECT_EQ(read_vector<float>(result2), (vector<float>{2.0f, 0.0f, 6.0f, 0.0f}));
+    }
+}
+
 TEST(eval, interpret_dynamic_range_sum) {
     auto p_start = make_shared<op::Parameter>(element::f32, PartialShape{});
     auto p_stop = make_shared<op::Parameter>(element::f32, PartialShape{});
@@ -767,3 +767,78 @@ TEST(function_reshape, TestReshapeWithInvalidShapesForTheSameTensor) {
     // both tensor names are specified, but have different shapes
     ASSERT_ANY_THROW(f->reshape({{"tensor1", ov::Shape({2, 500, 4})}, {"tensor2", ov::Shape({4, 250, 4})}}));
 }
+
+namespace {
+class ValidationCounter : public ov::op::Op {
+public:
+    OPENVINO_OP("ValidationCounter", "test_opset");
+
+    ValidationCounter() = default;
+    explicit ValidationCounter(const ov::Output<ov::Node>& arg) : ov::op::Op({arg}) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        ++validations;
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& inputs) const override {
+        return std::make_shared<ValidationCounter>(inputs.at(0));
+    }
+
+    size_t validations = 0;
+};
+}  // namespace
+
+TEST(function_reshape, ReshapeRevalidatesOnlyChangedBranch) {
+    auto changed = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 3, 22, 22});
+    changed->get_output_tensor(0).set_names({"changed"});
+    auto unchanged = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 3, 22, 22});
+    unchanged->get_output_tensor(0).set_names({"unchanged"});
+
+    auto changed_counter = std::make_shared<ValidationCounter>(changed);
+    auto unchanged_counter = std::make_shared<ValidationCounter>(unchanged);
+    // the output of the reduction keeps its shape, so the propagation stops there
+    auto axes = ov::op::v0::Constant::create(ov::element::i64, {4}, {0, 1, 2, 3});
+    auto reduce = std::make_shared<ov::op::v1::ReduceSum>(changed, axes, false);
+    auto reduce_counter = std::make_shared<ValidationCounter>(reduce);
+
+    auto f = std::make_shared<ov::Function>(ov::OutputVector{changed_counter, unchanged_counter, reduce_counter},
+                                            ov::ParameterVector{changed, unchanged});
+    f->validate_nodes_and_infer_types();
+    const size_t changed_validations = changed_counter->validations;
+    const size_t unchanged_validations = unchanged_counter->validations;
+    const size_t reduce_validations = reduce_counter->validations;
+
+    ASSERT_NO_THROW(f->reshape({{"changed", ov::Shape({2, 3, 22, 22})}}));
+
+    EXPECT_EQ(changed_counter->validations, changed_validations + 1);
+    EXPECT_EQ(unchanged_counter->validations, unchanged_validations);
+    EXPECT_EQ(reduce_counter->validations, reduce_validations);
+    EXPECT_EQ(f->output(0).get_partial_shape(), ov::PartialShape({2, 3, 22, 22}));
+    EXPECT_EQ(f->output(1).get_partial_shape(), ov::PartialShape({1, 3, 22, 22}));
+    EXPECT_EQ(f->output(2).get_partial_shape(), ov::PartialShape({}));
+}
+
+TEST(function_reshape, ReshapeRevalidatesNodesDependingOnShapeValues) {
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 3});
+    data->get_output_tensor(0).set_names({"data"});
+    auto other = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{ov::Dimension::dynamic()});
+
+    // the number of elements is computed from the data shape, the shapes of the intermediate tensors stay the same
+    auto shape_of = std::make_shared<ov::op::v3::ShapeOf>(data);
+    auto axis = ov::op::v0::Constant::create(ov::element::i64, {1}, {0});
+    auto numel = std::make_shared<ov::op::v1::ReduceProd>(shape_of, axis, true);
+    auto reshape = std::make_shared<ov::op::v1::Reshape>(other, numel, false);
+
+    auto f = std::make_shared<ov::Function>(ov::OutputVector{reshape}, ov::ParameterVector{data, other});
+    f->validate_nodes_and_infer_types();
+    ASSERT_EQ(f->output(0).get_partial_shape(), ov::PartialShape({6}));
+
+    data->set_partial_shape(ov::Shape{2, 4});
+    f->validate_nodes_and_infer_types(ov::ParameterVector{data});
+
+    EXPECT_EQ(numel->get_output_partial_shape(0), ov::PartialShape({1}));
+    EXPECT_EQ(f->output(0).get_partial_shape(), ov::PartialShape({8}));
+}
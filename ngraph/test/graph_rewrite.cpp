@@ -7,6 +7,8 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 #include <util/test_tools.hpp>
 
 NGRAPH_SUPPRESS_DEPRECATED_START
@@ -265,6 +267,58 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
 }
 
+TEST(GraphRewriteTest, TypeBasedAndUntypedMatcherPassOrder1) {
+    auto f = get_derived_function();
+
+    Anchor anchor;
+    anchor.add_matcher<TestPass>()->set_callback(get_callback());
+    anchor.add_matcher<TypeBasedTestPassDerived>()->set_callback(get_callback());
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 0);
+}
+
+TEST(GraphRewriteTest, TypeBasedAndUntypedMatcherPassOrder2) {
+    auto f = get_derived_function();
+
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedTestPassDerived>()->set_callback(get_callback());
+    anchor.add_matcher<TestPass>()->set_callback(get_callback());
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
+}
+
+class OrBasedTestPass : public ngraph::pass::MatcherPass {
+public:
+    OrBasedTestPass() : MatcherPass() {
+        auto multiply = pattern::wrap_type<opset3::Multiply>();
+        auto divide = pattern::wrap_type<opset3::Divide>();
+        auto root = std::make_shared<pattern::op::Or>(OutputVector{multiply, divide});
+        ngraph::graph_rewrite_callback callback = [](pattern::Matcher& m) {
+            auto relu = std::make_shared<ngraph::opset3::Relu>(m.get_match_root()->input_value(0));
+            ngraph::replace_node(m.get_match_root(), relu);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(root, "TestMatcher");
+        this->register_matcher(m, callback);
+    }
+};
+
+TEST(GraphRewriteTest, OrBasedMatcherPass) {
+    auto f = get_function();
+
+    Anchor anchor;
+    anchor.add_matcher<OrBasedTestPass>();
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+    ASSERT_EQ(count_ops_of_type<opset3::Divide>(f), 0);
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_function();
@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/mmap_object.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace std;
+
+TEST(mmap_object, map_file_content) {
+    const string path = "mmap_object_test.bin";
+    vector<char> content(12345);
+    for (size_t i = 0; i < content.size(); ++i) {
+        content[i] = static_cast<char>(i % 251);
+    }
+    {
+        ofstream out(path, ios::binary);
+        out.write(content.data(), content.size());
+    }
+
+    {
+        auto mapped = ov::util::load_mmap_object(path);
+        ASSERT_NE(nullptr, mapped);
+        ASSERT_EQ(content.size(), mapped->size());
+        EXPECT_EQ(content, vector<char>(mapped->data(), mapped->data() + mapped->size()));
+
+        // private mapping must be writable and must not change the file
+        mapped->data()[0] = 42;
+        EXPECT_EQ(42, mapped->data()[0]);
+    }
+
+    {
+        auto mapped = ov::util::load_mmap_object(path);
+        EXPECT_EQ(content[0], mapped->data()[0]);
+    }
+
+    remove(path.c_str());
+}
+
+TEST(mmap_object, map_empty_file) {
+    const string path = "mmap_object_empty_test.bin";
+    { ofstream out(path, ios::binary); }
+
+    auto mapped = ov::util::load_mmap_object(path);
+    EXPECT_EQ(0, mapped->size());
+
+    remove(path.c_str());
+}
+
+TEST(mmap_object, map_missing_file) {
+    EXPECT_THROW(ov::util::load_mmap_object("not_existing_file_for_mmap.bin"), std::runtime_error);
+}
@@ -120,3 +120,42 @@ TEST(node_input_output, input_set_argument) {
     EXPECT_EQ(add->input(0).get_shape(), Shape{3});
     EXPECT_EQ(add->input(1).get_shape(), Shape{1});
 }
+
+TEST(node_input_output, many_inputs_and_outputs) {
+    auto data = make_shared<op::Parameter>(element::f32, Shape{8, 2});
+    auto axis = op::Constant::create(element::i64, Shape{}, {0});
+    auto split = make_shared<op::v1::Split>(data, axis, 8);
+
+    OutputVector concat_inputs;
+    for (size_t i = 0; i < split->get_output_size(); ++i) {
+        concat_inputs.push_back(split->output(split->get_output_size() - i - 1));
+    }
+    auto concat = make_shared<op::Concat>(concat_inputs, 1);
+
+    ASSERT_EQ(concat->get_input_size(), 8);
+    for (size_t i = 0; i < concat->get_input_size(); ++i) {
+        EXPECT_EQ(concat->input(i).get_index(), i);
+        EXPECT_EQ(concat->input_value(i), split->output(7 - i));
+        const auto targets = split->output(7 - i).get_target_inputs();
+        ASSERT_EQ(targets.size(), 1);
+        EXPECT_EQ(*targets.begin(), concat->input(i));
+    }
+    EXPECT_EQ(concat->get_output_shape(0), (Shape{1, 16}));
+    EXPECT_THROW(concat->input(8), std::out_of_range);
+
+    auto z = make_shared<op::Parameter>(element::f32, Shape{1, 2});
+    concat->input(6).replace_source_output(z);
+    EXPECT_EQ(concat->input_value(6), z->output(0));
+    EXPECT_TRUE(split->output(1).get_target_inputs().empty());
+    EXPECT_EQ(z->output(0).get_target_inputs().size(), 1);
+
+    auto clone = concat->clone_with_new_inputs(concat->input_values());
+    for (size_t i = 0; i < clone->get_input_size(); ++i) {
+        EXPECT_EQ(clone->input_value(i), concat->input_value(i));
+    }
+    EXPECT_EQ(z->output(0).get_target_inputs().size(), 2);
+    clone.reset();
+    concat.reset();
+    EXPECT_TRUE(z->output(0).get_target_inputs().empty());
+    EXPECT_TRUE(split->output(0).get_target_inputs().empty());
+}
@@ -83,6 +83,22 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file) {
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_in_the_same_file_is_shared) {
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO,
+                             "onnx/external_data/external_data_two_tensors_data_in_the_same_file.onnx"));
+
+    std::vector<const char*> data_ptrs;
+    for (const auto& op : function->get_ops()) {
+        if (const auto constant = as_type_ptr<op::Constant>(op)) {
+            data_ptrs.push_back(constant->get_data_ptr<char>());
+        }
+    }
+    // both constants point to the single mapping of the external file (offsets 0 and 4096)
+    ASSERT_EQ(data_ptrs.size(), 2);
+    EXPECT_EQ(std::abs(data_ptrs[1] - data_ptrs[0]), 4096);
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception) {
     try {
         auto function = onnx_import::import_onnx_model(
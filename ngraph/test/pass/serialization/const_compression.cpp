@@ -207,3 +207,22 @@ TEST_F(SerializatioConstantCompressionTest, IdenticalConstantsDifferentTypesI32I
 
     ASSERT_TRUE(file_size(bin_1) == unique_const_count * ov::shape_size(shape) * sizeof(int32_t));
 }
+
+TEST_F(SerializatioConstantCompressionTest, AlignedConstants) {
+    auto A = ov::opset8::Constant::create(ov::element::i8, ov::Shape{3}, {1, 2, 3});
+    auto B = ov::opset8::Constant::create(ov::element::i8, ov::Shape{3}, {4, 5, 6});
+    auto C = ov::opset8::Constant::create(ov::element::f32, ov::Shape{1024}, std::vector<float>(1024, 1.f));
+    auto D = ov::opset8::Constant::create(ov::element::i8, ov::Shape{3}, {4, 5, 6});
+
+    auto ngraph_a = std::make_shared<ov::Function>(ov::NodeVector{A, B, C, D}, ov::ParameterVector{});
+
+    ov::pass::Serialize serializer(m_out_xml_path_1, m_out_bin_path_1);
+    serializer.set_align_constants(true);
+    serializer.run_on_function(ngraph_a);
+
+    std::ifstream xml_1(m_out_xml_path_1, std::ios::binary);
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    // A at 0, B at 64, C is not smaller than page so it is at 4096, D is the same as B
+    ASSERT_EQ(file_size(bin_1), 2 * ov::pass::Serialize::page_alignment);
+}
@@ -40,3 +40,43 @@ public:
     }
 };
 }  // namespace
+
+namespace {
+class InsertAbsPass : public pass::FunctionPass {
+public:
+    OPENVINO_RTTI("InsertAbsPass");
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override {
+        auto result = f->get_results().at(0);
+        auto abs = make_shared<op::Abs>(result->input_value(0));
+        result->input(0).replace_source_output(abs);
+        return true;
+    }
+};
+}  // namespace
+
+TEST(pass_manager, pass_statistics) {
+    auto graph = make_test_graph();
+    const size_t node_count = graph->get_ops().size();
+
+    pass::Manager pass_manager;
+    pass_manager.set_per_pass_statistics(true);
+    pass_manager.register_pass<InsertAbsPass>();
+    pass_manager.run_passes(graph);
+
+    // Validate pass registered after each pass is not reported
+    const auto& statistics = pass_manager.get_pass_statistics();
+    ASSERT_EQ(statistics.size(), 1);
+    EXPECT_NE(statistics[0].name.find("InsertAbsPass"), std::string::npos);
+    EXPECT_EQ(statistics[0].nodes_before, node_count);
+    EXPECT_EQ(statistics[0].nodes_after, node_count + 1);
+    EXPECT_GT(statistics[0].graph_size_after, statistics[0].graph_size_before);
+
+    std::stringstream log;
+    log << statistics[0];
+    EXPECT_NE(log.str().find("nodes " + std::to_string(node_count)), std::string::npos);
+
+    // disabled passes are skipped, statistics of the previous run are cleared
+    pass_manager.get_pass_config()->disable<InsertAbsPass>();
+    pass_manager.run_passes(graph);
+    EXPECT_TRUE(pass_manager.get_pass_statistics().empty());
+}
@@ -0,0 +1,125 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/gather.hpp"
+#include "ngraph/runtime/reference/matmul.hpp"
+#include "ngraph/runtime/reference/mean.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
+using namespace ngraph;
+using namespace ngraph::runtime;
+
+namespace {
+class ParallelThreadsGuard {
+public:
+    explicit ParallelThreadsGuard(size_t threads) : previous(reference::get_parallel_threads()) {
+        reference::set_parallel_threads(threads);
+    }
+    ~ParallelThreadsGuard() {
+        reference::set_parallel_threads(previous);
+    }
+
+private:
+    size_t previous;
+};
+
+std::vector<float> make_input(size_t size) {
+    std::vector<float> data(size);
+    for (size_t i = 0; i < size; i++)
+        data[i] = std::sin(i * 0.37f) * 3.f;
+    return data;
+}
+
+// the kernel is executed sequentially and by 4 threads, the results must be bit exact
+template <typename F>
+void check_bit_exact(size_t out_size, const F& kernel) {
+    std::vector<float> sequential(out_size), parallel(out_size);
+    {
+        ParallelThreadsGuard guard(1);
+        kernel(sequential.data());
+    }
+    {
+        ParallelThreadsGuard guard(4);
+        kernel(parallel.data());
+    }
+    for (size_t i = 0; i < out_size; i++)
+        ASSERT_EQ(sequential[i], parallel[i]) << "element " << i;
+}
+}  // namespace
+
+TEST(reference_parallel, parallel_for_covers_range_once) {
+    ParallelThreadsGuard guard(3);
+    std::vector<int> visits(10, 0);
+    reference::parallel_for(visits.size(), [&](size_t begin, size_t end) {
+        // the nested calls are executed sequentially
+        EXPECT_EQ(reference::get_parallel_threads(), 1);
+        for (size_t i = begin; i < end; i++)
+            visits[i]++;
+    });
+    EXPECT_EQ(visits, std::vector<int>(10, 1));
+}
+
+TEST(reference_parallel, parallel_for_rethrows) {
+    ParallelThreadsGuard guard(4);
+    EXPECT_THROW(reference::parallel_for(8,
+                                         [](size_t begin, size_t) {
+                                             if (begin > 0)
+                                                 throw std::runtime_error("error");
+                                         }),
+                 std::runtime_error);
+}
+
+TEST(reference_parallel, matmul) {
+    const auto a = make_input(3 * 7 * 9);
+    const auto b = make_input(3 * 9 * 5);
+    check_bit_exact(3 * 7 * 5, [&](float* out) {
+        reference::matmul(a.data(), b.data(), out, Shape{3, 7, 9}, Shape{3, 9, 5}, Shape{3, 7, 5}, false, false);
+    });
+    check_bit_exact(17 * 5, [&](float* out) {
+        reference::matmul(a.data(), b.data(), out, Shape{17, 9}, Shape{9, 5}, Shape{17, 5}, false, false);
+    });
+}
+
+TEST(reference_parallel, convolution) {
+    const auto data = make_input(2 * 3 * 7 * 7);
+    const auto filters = make_input(4 * 3 * 3 * 3);
+    check_bit_exact(2 * 4 * 5 * 5, [&](float* out) {
+        reference::convolution(data.data(),
+                               filters.data(),
+                               out,
+                               Shape{2, 3, 7, 7},
+                               Shape{4, 3, 3, 3},
+                               Shape{2, 4, 5, 5},
+                               Strides{1, 1},
+                               Strides{1, 1},
+                               CoordinateDiff{0, 0},
+                               CoordinateDiff{0, 0});
+    });
+}
+
+TEST(reference_parallel, gather) {
+    const auto data = make_input(5 * 6 * 7);
+    const std::vector<int64_t> indices{2, 0, -1};
+    check_bit_exact(5 * 3 * 7, [&](float* out) {
+        reference::gather(data.data(), indices.data(), out, Shape{5, 6, 7}, Shape{3}, Shape{5, 3, 7}, 1);
+    });
+}
+
+TEST(reference_parallel, reductions) {
+    const auto data = make_input(5 * 6 * 7);
+    check_bit_exact(5 * 7, [&](float* out) {
+        reference::sum(data.data(), out, Shape{5, 6, 7}, AxisSet{1});
+    });
+    check_bit_exact(6, [&](float* out) {
+        reference::sum(data.data(), out, Shape{5, 6, 7}, AxisSet{0, 2});
+    });
+    check_bit_exact(5, [&](float* out) {
+        reference::mean(data.data(), out, Shape{5, 6, 7}, AxisSet{1, 2});
+    });
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/small_vector.hpp"
+
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "openvino/core/partial_shape.hpp"
+
+using namespace ov;
+
+TEST(small_vector, inline_storage) {
+    SmallVector<int, 4> v{1, 2, 3};
+    ASSERT_EQ(v.size(), 3u);
+    ASSERT_EQ(v.capacity(), 4u);
+    v.push_back(4);
+    ASSERT_EQ(v.capacity(), 4u);
+    ASSERT_EQ(std::vector<int>(v.begin(), v.end()), (std::vector<int>{1, 2, 3, 4}));
+}
+
+TEST(small_vector, grow_to_heap) {
+    SmallVector<std::string, 2> v;
+    for (int i = 0; i < 10; i++)
+        v.push_back(std::to_string(i));
+    ASSERT_EQ(v.size(), 10u);
+    ASSERT_GE(v.capacity(), 10u);
+    for (int i = 0; i < 10; i++)
+        ASSERT_EQ(v[i], std::to_string(i));
+    ASSERT_EQ(v.back(), "9");
+    v.pop_back();
+    ASSERT_EQ(v.back(), "8");
+}
+
+TEST(small_vector, push_back_own_element) {
+    SmallVector<std::string, 2> v{"a", "b"};
+    v.push_back(v[0]);
+    ASSERT_EQ(v[2], "a");
+}
+
+TEST(small_vector, copy_and_move) {
+    for (size_t size : {2, 8}) {
+        SmallVector<std::shared_ptr<int>, 4> v;
+        for (size_t i = 0; i < size; i++)
+            v.push_back(std::make_shared<int>(static_cast<int>(i)));
+
+        SmallVector<std::shared_ptr<int>, 4> copy(v);
+        ASSERT_EQ(copy, v);
+        ASSERT_EQ(v[0].use_count(), 2);
+
+        SmallVector<std::shared_ptr<int>, 4> moved(std::move(copy));
+        ASSERT_TRUE(copy.empty());
+        ASSERT_EQ(moved, v);
+        ASSERT_EQ(v[0].use_count(), 2);
+
+        copy = moved;
+        ASSERT_EQ(v[0].use_count(), 3);
+        moved = std::move(copy);
+        ASSERT_EQ(v[0].use_count(), 2);
+        moved.clear();
+        ASSERT_EQ(v[0].use_count(), 1);
+    }
+}
+
+TEST(small_vector, resize) {
+    SmallVector<int, 2> v(3, 7);
+    ASSERT_EQ(std::vector<int>(v.begin(), v.end()), (std::vector<int>{7, 7, 7}));
+    v.resize(1);
+    ASSERT_EQ(v.size(), 1u);
+    v.resize(4);
+    ASSERT_EQ(std::vector<int>(v.begin(), v.end()), (std::vector<int>{7, 0, 0, 0}));
+    ASSERT_EQ(std::vector<int>(v.rbegin(), v.rend()), (std::vector<int>{0, 0, 0, 7}));
+}
+
+TEST(small_vector, partial_shape_high_rank) {
+    PartialShape ps{1, 2, 3, 4, 5, 6, 7, Dimension::dynamic()};
+    PartialShape copy = ps;
+    ASSERT_EQ(copy, ps);
+    ASSERT_EQ(copy.rank().get_length(), 8);
+    ASSERT_TRUE(copy[7].is_dynamic());
+    copy.resize(3);
+    ASSERT_EQ(copy, (PartialShape{1, 2, 3}));
+    ASSERT_EQ(std::vector<Dimension>(ps).size(), 8u);
+}
@@ -561,3 +561,16 @@ TEST(type_prop, reshape_to_scalar_3) {
         make_shared<op::v1::Reshape>(param, op::Constant::create(element::i64, {}, std::vector<int64_t>{100}), false),
         std::exception);
 }
+
+TEST(type_prop, reshape_pattern_with_shared_shape_subgraph) {
+    auto shape_source = make_shared<op::Parameter>(element::f32, PartialShape{Dimension(2, 4), 6});
+    Output<Node> pattern = make_shared<op::v3::ShapeOf>(shape_source);
+    // every level uses the previous one twice, the bounds are computed once for each of them
+    for (size_t i = 0; i < 64; ++i)
+        pattern = make_shared<op::v1::Maximum>(pattern, pattern);
+
+    auto param = make_shared<op::Parameter>(element::f32, PartialShape::dynamic());
+    auto r = make_shared<op::v1::Reshape>(param, pattern, false);
+    ASSERT_EQ(r->get_element_type(), element::f32);
+    ASSERT_EQ(r->get_output_partial_shape(0), (PartialShape{Dimension(2, 4), 6}));
+}
@@ -255,6 +255,25 @@ TEST(graph_util, clone_multiple_results) {
     auto copy = clone_function(*f);
 }
 
+TEST(graph_util, clone_function_shares_constant_data) {
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto weights = op::Constant::create(element::f32, Shape{2, 2}, {1, 2, 3, 4});
+    auto f = make_shared<Function>(NodeVector{make_shared<op::v1::Add>(A, weights)}, ParameterVector{A});
+
+    NodeMap node_map;
+    auto copy = clone_function(*f, node_map);
+    auto copied_weights = ov::as_type_ptr<op::Constant>(node_map.at(weights.get()));
+    ASSERT_NE(copied_weights, nullptr);
+    ASSERT_NE(copied_weights, weights);
+    // weights are immutable, so clones reference the same bytes instead of copying them
+    ASSERT_EQ(copied_weights->get_data_ptr(), weights->get_data_ptr());
+
+    // data stays valid when the original function is released
+    f.reset();
+    weights.reset();
+    ASSERT_EQ(copied_weights->cast_vector<float>(), (std::vector<float>{1, 2, 3, 4}));
+}
+
 TEST(graph_util, clone_function_variables_dynamic) {
     auto c_fp16 = make_shared<opset8::Constant>(element::f16, Shape{3}, std::vector<float>{0});
     auto variable = make_shared<Variable>(VariableInfo{PartialShape::dynamic(), element::dynamic, "var_1"});
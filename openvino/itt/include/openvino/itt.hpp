@@ -62,6 +62,35 @@ namespace openvino
             internal::threadName(name.c_str());
         }
 
+        /**
+         * @fn void startTrace()
+         * @ingroup ie_dev_profiling
+         * @brief Starts recording the annotated tasks by the built-in trace collector.
+         * @details The collector is available when built with ENABLE_PROFILING_TRACE, each thread records the tasks
+         *          to its own ring buffer of OPENVINO_TRACE_BUFFER_SIZE (16384 by default) tasks.
+         *          If the OPENVINO_TRACE_FILE environment variable is set, recording starts at the first task and
+         *          the tasks are dumped to the file at the process exit.
+         */
+        void startTrace();
+
+        /**
+         * @fn void stopTrace()
+         * @ingroup ie_dev_profiling
+         * @brief Stops recording the annotated tasks, the tasks recorded so far stay available for dumpTrace().
+         */
+        void stopTrace();
+
+        /**
+         * @fn bool dumpTrace(const char* path)
+         * @ingroup ie_dev_profiling
+         * @brief Appends the tasks recorded since the previous dump to the file in Chrome trace event JSON format
+         *        (can be opened with chrome://tracing or Perfetto UI).
+         * @details The file is rewritten if it has been written by another process.
+         * @param path [in] The trace file path
+         * @return false if the collector is not available or the file can't be written
+         */
+        bool dumpTrace(const char* path);
+
         inline handle_t handle(char const *name)
         {
             return internal::handle(name);
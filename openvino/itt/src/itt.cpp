@@ -9,11 +9,21 @@
 #include <ittnotify.h>
 #endif
 
+#ifdef ENABLE_PROFILING_TRACE
+#include "trace.hpp"
+#endif
+
+#if defined(ENABLE_PROFILING_ITT) || defined(ENABLE_PROFILING_TRACE)
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#endif
+
 namespace openvino {
 namespace itt {
 namespace internal {
 
-#ifdef ENABLE_PROFILING_ITT
+#if defined(ENABLE_PROFILING_ITT) || defined(ENABLE_PROFILING_TRACE)
 
 static size_t callStackDepth() {
     static const char *env = std::getenv("OPENVINO_TRACE_DEPTH");
@@ -23,29 +33,91 @@ static size_t callStackDepth() {
 
 static thread_local uint32_t call_stack_depth = 0;
 
+namespace {
+
+// Domains and handles keep the names for the built-in trace collector along with the ITT objects
+struct Domain {
+#ifdef ENABLE_PROFILING_ITT
+    __itt_domain* itt = nullptr;
+#endif
+    const char* name = nullptr;
+};
+
+struct Handle {
+#ifdef ENABLE_PROFILING_ITT
+    __itt_string_handle* itt = nullptr;
+#endif
+    const char* name = nullptr;
+};
+
+// The names are interned and never released, so the recorded tasks can refer them until the process exit
+template <typename T>
+T* intern(char const* name) {
+    static std::mutex mutex;
+    static auto objects = new std::unordered_map<std::string, T>();
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = objects->find(name);
+    if (it == objects->end()) {
+        it = objects->emplace(name, T{}).first;
+        it->second.name = it->first.c_str();
+    }
+    return &it->second;
+}
+
+}  // namespace
+
 domain_t domain(char const* name) {
-    return reinterpret_cast<domain_t>(__itt_domain_create(name));
+    auto d = intern<Domain>(name);
+#ifdef ENABLE_PROFILING_ITT
+    if (!d->itt)
+        d->itt = __itt_domain_create(name);
+#endif
+    return reinterpret_cast<domain_t>(d);
 }
 
 handle_t handle(char const* name) {
-    return reinterpret_cast<handle_t>(__itt_string_handle_create(name));
+    auto h = intern<Handle>(name);
+#ifdef ENABLE_PROFILING_ITT
+    if (!h->itt)
+        h->itt = __itt_string_handle_create(name);
+#endif
+    return reinterpret_cast<handle_t>(h);
 }
 
 void taskBegin(domain_t d, handle_t t) {
-    if (!callStackDepth() || call_stack_depth++ < callStackDepth())
-        __itt_task_begin(reinterpret_cast<__itt_domain*>(d),
+    if (!callStackDepth() || call_stack_depth++ < callStackDepth()) {
+        auto domain = reinterpret_cast<Domain*>(d);
+        auto handle = reinterpret_cast<Handle*>(t);
+#ifdef ENABLE_PROFILING_ITT
+        __itt_task_begin(domain->itt,
                         __itt_null,
                         __itt_null,
-                        reinterpret_cast<__itt_string_handle*>(t));
+                        handle->itt);
+#endif
+#ifdef ENABLE_PROFILING_TRACE
+        trace::taskBegin(domain->name, handle->name);
+#endif
+    }
 }
 
 void taskEnd(domain_t d) {
-    if (!callStackDepth() || --call_stack_depth < callStackDepth())
-        __itt_task_end(reinterpret_cast<__itt_domain*>(d));
+    if (!callStackDepth() || --call_stack_depth < callStackDepth()) {
+#ifdef ENABLE_PROFILING_ITT
+        __itt_task_end(reinterpret_cast<Domain*>(d)->itt);
+#endif
+#ifdef ENABLE_PROFILING_TRACE
+        trace::taskEnd();
+#endif
+    }
 }
 
 void threadName(const char* name) {
+#ifdef ENABLE_PROFILING_ITT
     __itt_thread_set_name(name);
+#endif
+#ifdef ENABLE_PROFILING_TRACE
+    trace::threadName(name);
+#endif
 }
 
 #else
@@ -60,7 +132,7 @@ void taskEnd(domain_t) { }
 
 void threadName(const char *) { }
 
-#endif  // ENABLE_PROFILING_ITT
+#endif  // ENABLE_PROFILING_ITT || ENABLE_PROFILING_TRACE
 
 }  // namespace internal
 }  // namespace itt
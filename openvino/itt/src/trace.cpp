@@ -0,0 +1,439 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/itt.hpp>
+
+#ifdef ENABLE_PROFILING_TRACE
+
+#include "trace.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <unistd.h>
+#    if defined(__linux__)
+#        include <sys/syscall.h>
+#    elif defined(__APPLE__)
+#        include <pthread.h>
+#    endif
+#endif
+
+namespace openvino {
+namespace itt {
+namespace internal {
+namespace trace {
+
+namespace {
+
+uint64_t now() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint64_t processId() {
+#ifdef _WIN32
+    return GetCurrentProcessId();
+#else
+    return static_cast<uint64_t>(getpid());
+#endif
+}
+
+uint64_t threadId() {
+#if defined(_WIN32)
+    return GetCurrentThreadId();
+#elif defined(__linux__)
+    return static_cast<uint64_t>(syscall(SYS_gettid));
+#elif defined(__APPLE__)
+    uint64_t id = 0;
+    pthread_threadid_np(nullptr, &id);
+    return id;
+#else
+    // keeps the value exactly representable by the double numbers of JSON readers
+    return std::hash<std::thread::id>()(std::this_thread::get_id()) & ((1ull << 53) - 1);
+#endif
+}
+
+// Distinguishes the process from the previous ones which had the same id, so their trace file is rewritten
+uint64_t processStartTime() {
+#if defined(_WIN32)
+    FILETIME creation = {}, exit = {}, kernel = {}, user = {};
+    if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+        return 0;
+    return (static_cast<uint64_t>(creation.dwHighDateTime) << 32) | creation.dwLowDateTime;
+#elif defined(__linux__)
+    std::ifstream stat("/proc/self/stat");
+    std::string content((std::istreambuf_iterator<char>(stat)), std::istreambuf_iterator<char>());
+    // the start time is the 22nd field, the 2nd one is the executable name which may contain spaces
+    auto pos = content.rfind(')');
+    for (int field = 2; pos != std::string::npos && field < 22; field++)
+        pos = content.find(' ', pos + 1);
+    return pos == std::string::npos ? 0 : std::strtoull(content.c_str() + pos + 1, nullptr, 10);
+#else
+    return 0;
+#endif
+}
+
+void appendEscaped(std::string& out, const char* str) {
+    for (; str && *str; str++) {
+        const auto c = *str;
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char code[8];
+            std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(c));
+            out += code;
+        } else {
+            out += c;
+        }
+    }
+}
+
+void appendMicroseconds(std::string& out, uint64_t ns) {
+    char value[32];
+    std::snprintf(value, sizeof(value), "%llu.%03u",
+                  static_cast<unsigned long long>(ns / 1000), static_cast<unsigned>(ns % 1000));
+    out += value;
+}
+
+struct Event {
+    std::atomic<const char*> domain;
+    std::atomic<const char*> task;
+    std::atomic<uint64_t> begin;
+    std::atomic<uint64_t> end;
+};
+
+struct OpenTask {
+    const char* domain;
+    const char* task;  // nullptr if the task was opened while the collection was off
+    uint64_t begin;
+};
+
+// Ring of the recorded tasks of one thread. The owner thread is the only writer: it fills the slot and publishes
+// it by incrementing the head, the oldest tasks are overwritten when the ring is full. The dumper copies the
+// published tasks and drops the ones which could be overwritten while it was copying them.
+struct ThreadBuffer {
+    ThreadBuffer(size_t capacity, uint64_t tid) : events(new Event[capacity]()), capacity(capacity), tid(tid) {}
+
+    void record(const OpenTask& task, uint64_t end) noexcept {
+        const auto h = head.load(std::memory_order_relaxed);
+        // the slot stores must not be seen by the dumper before the head of the overwritten event
+        std::atomic_thread_fence(std::memory_order_release);
+        auto& event = events[h % capacity];
+        event.domain.store(task.domain, std::memory_order_relaxed);
+        event.task.store(task.task, std::memory_order_relaxed);
+        event.begin.store(task.begin, std::memory_order_relaxed);
+        event.end.store(end, std::memory_order_relaxed);
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    std::unique_ptr<Event[]> events;
+    const size_t capacity;
+    const uint64_t tid;
+    std::atomic<uint64_t> head{0};
+    uint64_t tail = 0;  // number of the dumped events, guarded by Collector::mutex
+};
+
+#ifdef _WIN32
+
+class LockedFile {
+    HANDLE handle;
+
+public:
+    explicit LockedFile(const char* path) {
+        handle = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                             OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        OVERLAPPED overlapped = {};
+        if (handle != INVALID_HANDLE_VALUE && !LockFileEx(handle, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+            CloseHandle(handle);
+            handle = INVALID_HANDLE_VALUE;
+        }
+    }
+
+    ~LockedFile() {
+        if (handle != INVALID_HANDLE_VALUE) {
+            OVERLAPPED overlapped = {};
+            UnlockFileEx(handle, 0, MAXDWORD, MAXDWORD, &overlapped);
+            CloseHandle(handle);
+        }
+    }
+
+    bool isOpen() const { return handle != INVALID_HANDLE_VALUE; }
+
+    bool startsWith(const std::string& prefix) {
+        std::string content(prefix.size(), '\0');
+        DWORD read = 0;
+        return SetFilePointer(handle, 0, nullptr, FILE_BEGIN) != INVALID_SET_FILE_POINTER &&
+               ReadFile(handle, &content[0], static_cast<DWORD>(content.size()), &read, nullptr) &&
+               read == content.size() && content == prefix;
+    }
+
+    bool truncate() {
+        return SetFilePointer(handle, 0, nullptr, FILE_BEGIN) != INVALID_SET_FILE_POINTER && SetEndOfFile(handle);
+    }
+
+    bool append(const std::string& data) {
+        DWORD written = 0;
+        return SetFilePointer(handle, 0, nullptr, FILE_END) != INVALID_SET_FILE_POINTER &&
+               WriteFile(handle, data.data(), static_cast<DWORD>(data.size()), &written, nullptr) &&
+               written == data.size();
+    }
+};
+
+#else
+
+class LockedFile {
+    int fd;
+
+public:
+    explicit LockedFile(const char* path) {
+        fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (fd != -1 && flock(fd, LOCK_EX) != 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+
+    ~LockedFile() {
+        if (fd != -1)
+            close(fd);
+    }
+
+    bool isOpen() const { return fd != -1; }
+
+    bool startsWith(const std::string& prefix) {
+        std::string content(prefix.size(), '\0');
+        return pread(fd, &content[0], content.size(), 0) == static_cast<ssize_t>(content.size()) && content == prefix;
+    }
+
+    bool truncate() {
+        return ftruncate(fd, 0) == 0;
+    }
+
+    bool append(const std::string& data) {
+        if (lseek(fd, 0, SEEK_END) == -1)
+            return false;
+        for (size_t offset = 0; offset < data.size();) {
+            const auto written = write(fd, data.data() + offset, data.size() - offset);
+            if (written <= 0)
+                return false;
+            offset += static_cast<size_t>(written);
+        }
+        return true;
+    }
+};
+
+#endif
+
+// Every module linking the library statically has its own collector, so the collectors of a process append
+// their tasks to the same file. The file is written in the JSON Array Format of the trace event format which
+// doesn't require the closing bracket, the header makes the file recognizable as the trace of this process.
+class Collector {
+public:
+    Collector() {
+        const char* file = std::getenv("OPENVINO_TRACE_FILE");
+        if (file && *file) {
+            exitFile = file;
+            enabled = true;
+        }
+        const char* size = std::getenv("OPENVINO_TRACE_BUFFER_SIZE");
+        if (size)
+            capacity = std::max<size_t>(1, std::strtoul(size, nullptr, 10));
+        pid = std::to_string(processId());
+        header = "[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" + pid +
+                 ",\"args\":{\"name\":\"OpenVINO\",\"start\":" + std::to_string(processStartTime()) + "}},\n";
+    }
+
+    std::shared_ptr<ThreadBuffer> registerThread() {
+        auto buffer = std::make_shared<ThreadBuffer>(capacity, threadId());
+        std::lock_guard<std::mutex> lock(mutex);
+        buffers.push_back(buffer);
+        return buffer;
+    }
+
+    void setThreadName(const char* name) {
+        const auto tid = threadId();
+        std::lock_guard<std::mutex> lock(mutex);
+        threadNames[tid] = name;
+    }
+
+    bool dump(const char* path) {
+        std::string out;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto& buffer : buffers) {
+                appendEvents(out, *buffer);
+            }
+            const auto prefix = "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" + pid + ",\"tid\":";
+            for (auto& threadName : threadNames) {
+                out += prefix + std::to_string(threadName.first) + ",\"args\":{\"name\":\"";
+                appendEscaped(out, threadName.second.c_str());
+                out += "\"}},\n";
+            }
+        }
+        LockedFile file(path);
+        if (!file.isOpen())
+            return false;
+        if (!file.startsWith(header) && !(file.truncate() && file.append(header)))
+            return false;
+        return file.append(out);
+    }
+
+    std::string exitFile;
+    std::atomic_bool enabled{false};
+
+private:
+    void appendEvents(std::string& out, ThreadBuffer& buffer) {
+        struct EventCopy {
+            const char* domain;
+            const char* task;
+            uint64_t begin;
+            uint64_t end;
+        };
+        const auto head = buffer.head.load(std::memory_order_acquire);
+        const auto first = std::max(buffer.tail, head > buffer.capacity ? head - buffer.capacity : 0);
+        std::vector<EventCopy> copies;
+        copies.reserve(head - first);
+        for (auto i = first; i < head; i++) {
+            const auto& event = buffer.events[i % buffer.capacity];
+            copies.push_back({event.domain.load(std::memory_order_relaxed), event.task.load(std::memory_order_relaxed),
+                              event.begin.load(std::memory_order_relaxed), event.end.load(std::memory_order_relaxed)});
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const auto headAfterCopy = buffer.head.load(std::memory_order_relaxed);
+        buffer.tail = head;
+
+        const auto prefix = ",\"ph\":\"X\",\"pid\":" + pid + ",\"tid\":" + std::to_string(buffer.tid) + ",\"ts\":";
+        for (size_t i = 0; i < copies.size(); i++) {
+            // the slot could be reused by the owner thread while it was copied
+            if (first + i + buffer.capacity <= headAfterCopy)
+                continue;
+            const auto& copy = copies[i];
+            out += "{\"name\":\"";
+            appendEscaped(out, copy.task);
+            out += "\",\"cat\":\"";
+            appendEscaped(out, copy.domain);
+            out += "\"" + prefix;
+            appendMicroseconds(out, copy.begin);
+            out += ",\"dur\":";
+            appendMicroseconds(out, copy.end > copy.begin ? copy.end - copy.begin : 0);
+            out += "},\n";
+        }
+    }
+
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    std::map<uint64_t, std::string> threadNames;
+    size_t capacity = 16384;
+    std::string pid;
+    std::string header;
+};
+
+struct ExitDump {
+    explicit ExitDump(Collector& collector) : collector(collector) {}
+    ~ExitDump() {
+        collector.enabled = false;
+        collector.dump(collector.exitFile.c_str());
+    }
+    Collector& collector;
+};
+
+Collector& collector() {
+    // never destroyed as the threads may still record tasks while the process exits
+    static auto instance = new Collector();
+    static std::unique_ptr<ExitDump> exitDump(instance->exitFile.empty() ? nullptr : new ExitDump(*instance));
+    return *instance;
+}
+
+ThreadBuffer& threadBuffer() {
+    thread_local std::shared_ptr<ThreadBuffer> buffer = collector().registerThread();
+    return *buffer;
+}
+
+thread_local std::vector<OpenTask> openTasks;
+
+}  // namespace
+
+void taskBegin(const char* domain, const char* task) noexcept {
+    const bool enabled = collector().enabled.load(std::memory_order_relaxed);
+    if (!enabled && openTasks.empty())
+        return;
+    try {
+        openTasks.push_back({domain, enabled ? task : nullptr, enabled ? now() : 0});
+    } catch (...) {
+    }
+}
+
+void taskEnd() noexcept {
+    if (openTasks.empty())
+        return;
+    const auto task = openTasks.back();
+    openTasks.pop_back();
+    if (task.task == nullptr)
+        return;
+    try {
+        threadBuffer().record(task, now());
+    } catch (...) {
+    }
+}
+
+void threadName(const char* name) {
+    collector().setThreadName(name);
+}
+
+}  // namespace trace
+}  // namespace internal
+
+void startTrace() {
+    internal::trace::collector().enabled = true;
+}
+
+void stopTrace() {
+    internal::trace::collector().enabled = false;
+}
+
+bool dumpTrace(const char* path) {
+    return path != nullptr && internal::trace::collector().dump(path);
+}
+
+}  // namespace itt
+}  // namespace openvino
+
+#else
+
+namespace openvino {
+namespace itt {
+
+void startTrace() {}
+
+void stopTrace() {}
+
+bool dumpTrace(const char*) {
+    return false;
+}
+
+}  // namespace itt
+}  // namespace openvino
+
+#endif  // ENABLE_PROFILING_TRACE
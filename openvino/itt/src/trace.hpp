@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Internal API of the built-in collector of the annotated tasks
+ * @file trace.hpp
+ */
+
+#pragma once
+
+namespace openvino {
+namespace itt {
+namespace internal {
+namespace trace {
+
+/**
+ * @brief Opens the task on the calling thread, the names must stay valid until the process exit
+ */
+void taskBegin(const char* domain, const char* task) noexcept;
+
+/**
+ * @brief Closes the last opened task of the calling thread and records it if the collection is on
+ */
+void taskEnd() noexcept;
+
+/**
+ * @brief Sets the name of the calling thread shown in the trace
+ */
+void threadName(const char* name);
+
+}  // namespace trace
+}  // namespace internal
+}  // namespace itt
+}  // namespace openvino
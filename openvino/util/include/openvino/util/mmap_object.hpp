@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific file mapping objects
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "openvino/util/file_util.hpp"
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Private copy-on-write view of a file mapped into the process address space.
+ *
+ * The data can be patched by a consumer: a written page gets a private copy, the file itself is
+ * never changed, and untouched pages stay shared between all processes which map the same file.
+ */
+class MappedMemory {
+public:
+    /// \brief Pointer to the beginning of the mapped region
+    virtual char* data() noexcept = 0;
+    /// \brief Size of the mapped region in bytes
+    virtual size_t size() const noexcept = 0;
+    virtual ~MappedMemory() = default;
+};
+
+/**
+ * @brief Maps the whole file into memory
+ * @param path Path to a file
+ * @return A mapped memory object which keeps mapping alive, the mapping is released on destruction
+ * @throw std::runtime_error if the file cannot be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+/**
+ * @brief Maps the whole file into memory
+ * @param path Path to a file
+ * @return A mapped memory object which keeps mapping alive, the mapping is released on destruction
+ * @throw std::runtime_error if the file cannot be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,237 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/mmap_object.hpp"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+
+#    include <cerrno>
+#    include <cstring>
+#endif
+
+namespace ov {
+namespace util {
+
+#ifdef _WIN32
+
+class HandleHolder {
+    HANDLE m_handle = INVALID_HANDLE_VALUE;
+
+    void reset() noexcept {
+        if (m_handle != INVALID_HANDLE_VALUE && m_handle != nullptr) {
+            ::CloseHandle(m_handle);
+        }
+        m_handle = INVALID_HANDLE_VALUE;
+    }
+
+public:
+    explicit HandleHolder(HANDLE handle = INVALID_HANDLE_VALUE) noexcept : m_handle(handle) {}
+    HandleHolder(const HandleHolder&) = delete;
+    HandleHolder& operator=(const HandleHolder&) = delete;
+    HandleHolder& operator=(HANDLE handle) noexcept {
+        reset();
+        m_handle = handle;
+        return *this;
+    }
+    ~HandleHolder() {
+        reset();
+    }
+
+    HANDLE get() const noexcept {
+        return m_handle;
+    }
+};
+
+class MapHolder : public MappedMemory {
+public:
+    MapHolder() = default;
+
+    ~MapHolder() {
+        if (m_data) {
+            ::UnmapViewOfFile(m_data);
+        }
+    }
+
+    template <typename C>
+    void set(const std::basic_string<C>& path, HANDLE file) {
+        m_handle = file;
+        if (m_handle.get() == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Can not open file " + to_string(path) + " for mapping. Ensure that file exists.");
+        }
+
+        LARGE_INTEGER file_size_large;
+        if (::GetFileSizeEx(m_handle.get(), &file_size_large) == 0) {
+            throw std::runtime_error("Can not get file size for " + to_string(path));
+        }
+
+        m_size = static_cast<size_t>(file_size_large.QuadPart);
+        if (m_size == 0) {
+            return;
+        }
+
+        // PAGE_WRITECOPY / FILE_MAP_COPY keep pages shared until they are modified by the process
+        m_mapping = ::CreateFileMapping(m_handle.get(), nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (m_mapping.get() == nullptr) {
+            throw std::runtime_error("Can not create file mapping for " + to_string(path));
+        }
+
+        m_data = static_cast<char*>(::MapViewOfFile(m_mapping.get(), FILE_MAP_COPY, 0, 0, m_size));
+        if (m_data == nullptr) {
+            throw std::runtime_error("Can not create map view for " + to_string(path));
+        }
+    }
+
+    char* data() noexcept override {
+        return m_data;
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    static std::string to_string(const std::string& path) {
+        return path;
+    }
+#    ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+    static std::string to_string(const std::wstring& path) {
+        return wstring_to_string(path);
+    }
+#    endif
+
+    char* m_data = nullptr;
+    size_t m_size = 0;
+    HandleHolder m_handle;
+    HandleHolder m_mapping;
+};
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path,
+                ::CreateFileA(path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr));
+    return holder;
+}
+
+#    ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path,
+                ::CreateFileW(path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr));
+    return holder;
+}
+#    endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+#else  // _WIN32
+
+class HandleHolder {
+    int m_handle = -1;
+
+    void reset() noexcept {
+        if (m_handle != -1) {
+            ::close(m_handle);
+            m_handle = -1;
+        }
+    }
+
+public:
+    explicit HandleHolder(int handle = -1) noexcept : m_handle(handle) {}
+    HandleHolder(const HandleHolder&) = delete;
+    HandleHolder& operator=(const HandleHolder&) = delete;
+    ~HandleHolder() {
+        reset();
+    }
+
+    int get() const noexcept {
+        return m_handle;
+    }
+};
+
+class MapHolder : public MappedMemory {
+public:
+    MapHolder() = default;
+
+    ~MapHolder() {
+        if (m_data != MAP_FAILED && m_data != nullptr) {
+            ::munmap(m_data, m_size);
+        }
+    }
+
+    void set(const std::string& path) {
+        HandleHolder file(::open(path.c_str(), O_RDONLY));
+        if (file.get() == -1) {
+            throw std::runtime_error("Can not open file " + path + " for mapping. Ensure that file exists and has " +
+                                     "appropriate permissions: " + std::strerror(errno));
+        }
+
+        struct stat sb = {};
+        if (::fstat(file.get(), &sb) == -1) {
+            throw std::runtime_error("Can not get file size for " + path + ": " + std::strerror(errno));
+        }
+
+        m_size = static_cast<size_t>(sb.st_size);
+        if (m_size == 0) {
+            m_data = nullptr;
+            return;
+        }
+
+        // MAP_PRIVATE keeps pages shared with other processes until they are modified.
+        // The descriptor may be closed right after mmap, the mapping stays valid.
+        m_data = static_cast<char*>(::mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file.get(), 0));
+        if (m_data == MAP_FAILED) {
+            throw std::runtime_error("Can not create file mapping for " + path + ": " + std::strerror(errno));
+        }
+    }
+
+    char* data() noexcept override {
+        return m_data;
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    char* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path);
+    return holder;
+}
+
+#    ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    return load_mmap_object(wstring_to_string(path));
+}
+#    endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+#endif  // _WIN32
+
+}  // namespace util
+}  // namespace ov
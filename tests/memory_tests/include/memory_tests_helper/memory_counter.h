@@ -22,6 +22,10 @@ public:
   MemoryCounter(const std::string &mem_counter_name);
 };
 
+/// Resets the peak resident set size, so the next snapshot reports the peak
+/// reached after the reset. Has no effect when the system doesn't support it.
+void resetPeakMemory();
+
 #define MEMORY_SNAPSHOT(mem_counter_name) MemoryTest::MemoryCounter (#mem_counter_name);
 
 } // namespace MemoryTest
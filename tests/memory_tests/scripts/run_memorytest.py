@@ -12,6 +12,7 @@ collected statistics.
 
 import argparse
 import copy
+import json
 import logging
 import os
 import statistics
@@ -127,6 +128,12 @@ def cli_parser():
                         dest="stats_path",
                         type=Path,
                         help='path to a file to save aggregated statistics')
+    parser.add_argument('-f',
+                        dest="stats_format",
+                        choices=["yaml", "json"],
+                        default="yaml",
+                        help='format of a file with aggregated statistics. '
+                             'JSON keys are sorted, so files of different runs can be compared line by line')
 
     args = parser.parse_args()
 
@@ -145,7 +152,10 @@ if __name__ == "__main__":
     if args.stats_path:
         # Save aggregated results to a file
         with open(args.stats_path, "w") as file:
-            yaml.safe_dump(aggr_stats, file)
+            if args.stats_format == "json":
+                json.dump(aggr_stats, file, indent=4, sort_keys=True)
+            else:
+                yaml.safe_dump(aggr_stats, file)
         logging.info("Aggregated statistics saved to a file: '{}'".format(
             args.stats_path.resolve()))
     else:
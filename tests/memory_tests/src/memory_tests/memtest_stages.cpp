@@ -0,0 +1,140 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <inference_engine.hpp>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common_utils.h"
+#include "memory_tests_helper/memory_counter.h"
+#include "memory_tests_helper/utils.h"
+using namespace InferenceEngine;
+
+/// @brief Number of infer requests tracked separately
+static const size_t nireq = 2;
+
+/// @brief Cache directory used to measure the import of a cached network
+static const char cache_dir[] = "stages_cache";
+
+/**
+ * @brief Reads a whole file into a string
+ */
+static std::string readFile(const std::string &path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file.good())
+    throw std::runtime_error("Can't open file \"" + path + "\"");
+  std::stringstream content;
+  content << file.rdbuf();
+  return content.str();
+}
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ *
+ * The peak memory is reset before every stage, so vmhwm of a snapshot is the
+ * peak of its stage and vmrss is the steady memory after the stage.
+ */
+int runPipeline(const std::string &model, const std::string &device) {
+  auto pipeline = [](const std::string &model, const std::string &device) {
+    Core ie;
+    CNNNetwork cnnNetwork;
+    ExecutableNetwork exeNetwork;
+    std::vector<InferRequest> inferRequests(nireq);
+    size_t batchSize = 0;
+
+    if (MemoryTest::fileExt(model) != "xml")
+      throw std::logic_error("Only IR models are supported by the pipeline");
+
+    ie.GetVersions(device);
+    MEMORY_SNAPSHOT(load_plugin);
+
+    MemoryTest::resetPeakMemory();
+    const std::string xml = readFile(model);
+    MEMORY_SNAPSHOT(read_xml);
+
+    MemoryTest::resetPeakMemory();
+    Blob::Ptr weights;
+    const std::string binPath = model.substr(0, model.rfind('.')) + ".bin";
+    std::ifstream binFile(binPath, std::ios::binary | std::ios::ate);
+    if (binFile.good()) {
+      const size_t binSize = static_cast<size_t>(binFile.tellg());
+      binFile.seekg(0, std::ios::beg);
+      weights = make_shared_blob<uint8_t>({Precision::U8, {binSize}, Layout::C});
+      weights->allocate();
+      binFile.read(weights->buffer().as<char *>(), binSize);
+    }
+    MEMORY_SNAPSHOT(read_weights);
+
+    MemoryTest::resetPeakMemory();
+    cnnNetwork = ie.ReadNetwork(xml, weights);
+    batchSize = cnnNetwork.getBatchSize();
+    MEMORY_SNAPSHOT(parse_network);
+
+    // QueryNetwork runs the plugin transformations without the compilation
+    MemoryTest::resetPeakMemory();
+    ie.QueryNetwork(cnnNetwork, device);
+    MEMORY_SNAPSHOT(query_network);
+
+    MemoryTest::resetPeakMemory();
+    exeNetwork = ie.LoadNetwork(cnnNetwork, device);
+    MEMORY_SNAPSHOT(load_network);
+
+    {
+      // the network is exported to the cache unless the cache is already filled
+      MemoryTest::resetPeakMemory();
+      Core cacheCore;
+      cacheCore.SetConfig({{CONFIG_KEY(CACHE_DIR), cache_dir}});
+      cacheCore.LoadNetwork(model, device);
+      MEMORY_SNAPSHOT(load_network_to_cache);
+    }
+    {
+      MemoryTest::resetPeakMemory();
+      Core cacheCore;
+      cacheCore.SetConfig({{CONFIG_KEY(CACHE_DIR), cache_dir}});
+      auto cachedNetwork = cacheCore.LoadNetwork(model, device);
+      MEMORY_SNAPSHOT(import_network_from_cache);
+    }
+
+    batchSize = batchSize != 0 ? batchSize : 1;
+    const InferenceEngine::ConstInputsDataMap inputsInfo(exeNetwork.GetInputsInfo());
+    for (size_t i = 0; i < nireq; i++) {
+      const std::string suffix = "_" + std::to_string(i);
+      MemoryTest::resetPeakMemory();
+      inferRequests[i] = exeNetwork.CreateInferRequest();
+      fillBlobs(inferRequests[i], inputsInfo, batchSize);
+      MemoryTest::MemoryCounter("create_infer_request" + suffix);
+
+      MemoryTest::resetPeakMemory();
+      inferRequests[i].Infer();
+      MemoryTest::MemoryCounter("first_inference" + suffix);
+
+      MemoryTest::resetPeakMemory();
+      inferRequests[i].Infer();
+      MemoryTest::MemoryCounter("second_inference" + suffix);
+    }
+    MEMORY_SNAPSHOT(full_run);
+  };
+
+  try {
+    pipeline(model, device);
+  } catch (const InferenceEngine::Exception &iex) {
+    std::cerr
+        << "Inference Engine pipeline failed with Inference Engine exception:\n"
+        << iex.what();
+    return 1;
+  } catch (const std::exception &ex) {
+    std::cerr << "Inference Engine pipeline failed with exception:\n"
+              << ex.what();
+    return 2;
+  } catch (...) {
+    std::cerr << "Inference Engine pipeline failed\n";
+    return 3;
+  }
+  return 0;
+}
@@ -107,6 +107,15 @@ size_t getThreadsNum() {return getSystemDataByName((char*) "Threads:");}
 
 #endif
 
+void resetPeakMemory() {
+#ifndef _WIN32
+    // writing "5" to clear_refs resets VmHWM to the current VmRSS
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    if (clear_refs.good())
+        clear_refs << "5";
+#endif
+}
+
 
 MemoryCounter::MemoryCounter(const std::string &mem_counter_name) {
   name = mem_counter_name;
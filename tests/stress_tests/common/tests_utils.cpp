@@ -116,6 +116,44 @@ std::vector<MemLeaksTestCase> generateTestsParamsMemLeaks() {
     return tests_cases;
 }
 
+// Generate multi-model throughput test cases from config file with static test definition.
+std::vector<ThroughputTestCase> generateTestsParamsThroughput() {
+    std::vector<ThroughputTestCase> tests_cases;
+    const pugi::xml_document &test_config = Environment::Instance().getTestConfig();
+
+    pugi::xml_node cases;
+    cases = test_config.child("cases");
+
+    for (pugi::xml_node device = cases.first_child(); device; device = device.next_sibling()) {
+        std::string device_name = device.attribute("name").as_string("NULL");
+        int nireq = device.attribute("nireq").as_int(1);
+        int duration = device.attribute("duration").as_int(60);
+        long rss_drift_limit = device.attribute("rss_drift_limit").as_llong(0);
+
+        std::vector<std::map<std::string, std::string>> models;
+
+        for (pugi::xml_node model = device.first_child(); model; model = model.next_sibling()) {
+            std::string full_path = model.attribute("full_path").as_string();
+            std::string path = model.attribute("path").as_string();
+            if (full_path.empty() || path.empty())
+                throw std::logic_error(
+                        "One of the 'model' records from test config doesn't contain 'full_path' or 'path' attributes");
+            std::string name = model.attribute("name").as_string();
+            std::string precision = model.attribute("precision").as_string();
+            std::string threads = std::to_string(model.attribute("threads").as_int(1));
+            std::map<std::string, std::string> model_map{{"name", name},
+                                                         {"path", path},
+                                                         {"full_path", full_path},
+                                                         {"precision", precision},
+                                                         {"threads", threads}};
+            models.push_back(model_map);
+        }
+        tests_cases.push_back(ThroughputTestCase(nireq, duration, rss_drift_limit, device_name, models));
+    }
+
+    return tests_cases;
+}
+
 std::string getTestCaseName(const testing::TestParamInfo<TestCase> &obj) {
     return obj.param.test_case_name;
 }
@@ -124,6 +162,10 @@ std::string getTestCaseNameMemLeaks(const testing::TestParamInfo<MemLeaksTestCas
     return obj.param.test_case_name;
 }
 
+std::string getTestCaseNameThroughput(const testing::TestParamInfo<ThroughputTestCase> &obj) {
+    return obj.param.test_case_name;
+}
+
 void test_wrapper(const std::function<void(std::string, std::string, int)> &tests_pipeline, const TestCase &params) {
     tests_pipeline(params.model, params.device, params.numiters);
 }
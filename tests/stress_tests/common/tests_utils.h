@@ -70,6 +70,31 @@ public:
     }
 };
 
+class ThroughputTestCase : public TestCaseBase {
+public:
+    int nireq;
+    int duration;
+    long rss_drift_limit;
+    std::vector<std::map<std::string, std::string>> models;
+
+    ThroughputTestCase(int _nireq, int _duration, long _rss_drift_limit, std::string _device,
+                       std::vector<std::map<std::string, std::string>> _models) {
+        numprocesses = 1, numiters = 0, nireq = _nireq, duration = _duration, rss_drift_limit = _rss_drift_limit,
+        device = _device, models = _models;
+        // every model is inferred from its own threads
+        numthreads = 0;
+        for (auto &model : models)
+            numthreads += std::stoi(model["threads"]);
+        test_case_name = "Numthreads_" + std::to_string(numthreads) + "_Nireq_" + std::to_string(nireq) +
+                         "_Duration_" + std::to_string(duration) + "_Device_" + update_item_for_name(device);
+        for (int i = 0; i < models.size(); i++) {
+            test_case_name += "_Model" + std::to_string(i + 1) + "_" + update_item_for_name(models[i]["name"]) + "_" +
+                              update_item_for_name(models[i]["precision"]) + "_Threads_" + models[i]["threads"];
+            model_name += "\"" + models[i]["path"] + "\"" + (i < models.size() - 1 ? ", " : "");
+        }
+    }
+};
+
 class Environment {
 private:
     pugi::xml_document _test_config;
@@ -91,8 +116,10 @@ public:
 
 std::vector<TestCase> generateTestsParams(std::initializer_list<std::string> items);
 std::vector<MemLeaksTestCase> generateTestsParamsMemLeaks();
+std::vector<ThroughputTestCase> generateTestsParamsThroughput();
 std::string getTestCaseName(const testing::TestParamInfo<TestCase> &obj);
 std::string getTestCaseNameMemLeaks(const testing::TestParamInfo<MemLeaksTestCase> &obj);
+std::string getTestCaseNameThroughput(const testing::TestParamInfo<ThroughputTestCase> &obj);
 
 void runTest(const std::function<void(std::string, std::string, int)> &tests_pipeline, const TestCase &params);
 void _runTest(const std::function<void(std::string, std::string, int)> &tests_pipeline, const TestCase &params);
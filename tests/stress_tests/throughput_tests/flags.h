@@ -0,0 +1,34 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "../common/utils.h"
+
+#include <gflags/gflags.h>
+
+/// @brief message for help argument
+static const char help_message[] = "Print a usage message";
+
+/// @brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// @brief Declare flag for showing help message <br>
+DECLARE_bool(help);
+
+/// @brief message for test_config argument
+static const char test_conf_message[] = "Optional. Path to a test config with description about devices, models, "
+                                        "number of threads, infer requests and duration";
+
+/// @brief Define parameter for set test's configuration <br>
+/// test_conf is an optional parameter
+DEFINE_string(test_conf, OS_PATH_JOIN({"stress_tests_configs", "throughput_tests", "test_config.xml"}), test_conf_message);
+
+/// @brief message for stats_dir argument
+static const char stats_dir_message[] = "Optional. Path to an existing directory to write per-second statistics "
+                                        "of every test case to. Statistics aren't written if it isn't set";
+
+/// @brief Define parameter for set directory for statistics <br>
+/// stats_dir is an optional parameter
+DEFINE_string(stats_dir, "", stats_dir_message);
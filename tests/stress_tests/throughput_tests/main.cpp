@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "flags.h"
+#include "../common/utils.h"
+#include "../common/tests_utils.h"
+
+#include <gtest/gtest.h>
+#include <pugixml.hpp>
+
+#include <cstdlib>
+#include <iostream>
+
+
+static void showUsage() {
+    std::cout << "throughput_tests [OPTION]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "    -h, --help              " << help_message << std::endl;
+    std::cout << "    --test_conf <path>      " << test_conf_message << std::endl;
+    std::cout << "    --stats_dir <path>      " << stats_dir_message << std::endl;
+    std::cout << "Google Test options are passed to the test runner, see --gtest_help" << std::endl;
+}
+
+bool parseAndCheckCommandLine(int argc, char **argv) {
+    // ---------------------------Parsing and validating input arguments--------------------------------------
+    log_info("Parsing input parameters");
+
+    int new_argc = 0;
+    std::vector<char*> _argv;
+    for (int i = 0; i < argc; i++) {
+        if ("--gtest" != std::string(argv[i]).substr(0, 7)) {
+            _argv.push_back(argv[i]);
+            new_argc++;
+        }
+    }
+    char **new_argv = &_argv[0];
+    gflags::ParseCommandLineNonHelpFlags(&new_argc, &new_argv, true);
+
+    if (FLAGS_help || FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    pugi::xml_document config;
+    pugi::xml_parse_result result = config.load_file(FLAGS_test_conf.c_str());
+    if (!result) {
+        log_err("Exception while reading test config \"" << FLAGS_test_conf << "\": " << result.description());
+        return false;
+    }
+    return true;
+}
+
+
+int main(int argc, char **argv) {
+    if (!parseAndCheckCommandLine(argc, argv)) {
+        // the help request is not a failure, the wrong config is
+        return FLAGS_help || FLAGS_h ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    pugi::xml_document config;
+    config.load_file(FLAGS_test_conf.c_str());
+    Environment::Instance().setTestConfig(config);
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "../common/tests_utils.h"
+#include "tests_pipelines/tests_pipelines.h"
+
+#include <gflags/gflags.h>
+#include <gtest/gtest.h>
+
+DECLARE_string(stats_dir);
+
+class ThroughputTestSuite : public ::testing::TestWithParam<ThroughputTestCase> {};
+
+// tests_pipelines/tests_pipelines.cpp
+TEST_P(ThroughputTestSuite, async_inference) {
+    auto test_params = GetParam();
+    const std::string stats_path = FLAGS_stats_dir.empty() ? ""
+            : OS_PATH_JOIN({FLAGS_stats_dir, test_params.test_case_name + ".csv"});
+
+    log_info("Async inference of networks: " << test_params.model_name << " for \"" << test_params.device
+                                             << "\" device by " << test_params.numthreads << " threads with "
+                                             << test_params.nireq << " infer requests each for "
+                                             << test_params.duration << " seconds");
+    auto result = throughput_test_pipeline(test_params, stats_path);
+    EXPECT_EQ(result.first, TestStatus::TEST_OK) << result.second;
+}
+// tests_pipelines/tests_pipelines.cpp
+
+INSTANTIATE_TEST_SUITE_P(ThroughputTests, ThroughputTestSuite, ::testing::ValuesIn(generateTestsParamsThroughput()),
+                         getTestCaseNameThroughput);
@@ -0,0 +1,237 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "tests_pipelines.h"
+#include "common_utils.h"
+
+#include <math.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <inference_engine.hpp>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+using namespace InferenceEngine;
+
+// Latency histogram buckets grow by this factor, so percentiles are computed with 1% precision
+#define BUCKET_GROWTH 1.01
+// Latencies greater than this value in microseconds are counted in the last bucket
+#define MAX_LATENCY_US 1e9
+// Maximum number of seconds excluded from RSS drift computation. Real number is 10% of the test duration
+#define WARMUP_SECONDS 60
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+/**
+ * @brief Collects latencies into exponentially growing buckets, so the memory used for percentiles
+ * doesn't depend on the test duration and doesn't pollute RSS measurements
+ */
+class LatencyHistogram {
+public:
+    LatencyHistogram() : buckets(max_index() + 1, 0) {}
+
+    void add(double latency_us) {
+        buckets[index(latency_us)]++;
+        count++;
+    }
+
+    void merge(const LatencyHistogram &other) {
+        for (size_t i = 0; i < buckets.size(); i++)
+            buckets[i] += other.buckets[i];
+        count += other.count;
+    }
+
+    uint64_t size() const { return count; }
+
+    // Returns upper bound of the bucket containing the percentile in milliseconds
+    double percentile(double p) const {
+        if (count == 0)
+            return 0;
+        const auto rank = static_cast<uint64_t>(ceil(p / 100. * count));
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < buckets.size(); i++) {
+            cumulative += buckets[i];
+            if (cumulative >= rank)
+                return pow(BUCKET_GROWTH, i + 1) / 1000.;
+        }
+        return MAX_LATENCY_US / 1000.;
+    }
+
+private:
+    static size_t max_index() { return static_cast<size_t>(log(MAX_LATENCY_US) / log(BUCKET_GROWTH)); }
+
+    static size_t index(double latency_us) {
+        if (latency_us <= 1.)
+            return 0;
+        return std::min(static_cast<size_t>(log(latency_us) / log(BUCKET_GROWTH)), max_index());
+    }
+
+    std::vector<uint64_t> buckets;
+    uint64_t count = 0;
+};
+
+/**
+ * @brief Returns numbers of voluntary and involuntary context switches of the process
+ */
+std::pair<long, long> getContextSwitches() {
+#ifdef _WIN32
+    return {0, 0};
+#else
+    struct rusage usage {};
+    getrusage(RUSAGE_SELF, &usage);
+    return {usage.ru_nvcsw, usage.ru_nivcsw};
+#endif
+}
+
+/**
+ * @brief Keeps all infer requests of the thread busy until `stop` is set
+ */
+void infer_requests_loop(ExecutableNetwork network, size_t batch_size, int nireq, const std::atomic<bool> &stop,
+                         std::atomic<uint64_t> &completed, LatencyHistogram &histogram, std::string &error) {
+    try {
+        std::vector<InferRequest> requests(nireq);
+        std::vector<Clock::time_point> starts(nireq);
+        const ConstInputsDataMap inputs_info(network.GetInputsInfo());
+        for (auto &request : requests) {
+            request = network.CreateInferRequest();
+            fillBlobs(request, inputs_info, batch_size);
+        }
+
+        for (int i = 0; i < nireq; i++) {
+            starts[i] = Clock::now();
+            requests[i].StartAsync();
+        }
+        while (!stop) {
+            for (int i = 0; i < nireq && !stop; i++) {
+                requests[i].Wait(InferRequest::WaitMode::RESULT_READY);
+                histogram.add(std::chrono::duration<double, std::micro>(Clock::now() - starts[i]).count());
+                completed++;
+                starts[i] = Clock::now();
+                requests[i].StartAsync();
+            }
+        }
+        for (auto &request : requests)
+            request.Wait(InferRequest::WaitMode::RESULT_READY);
+    } catch (const std::exception &ex) {
+        error = ex.what();
+    } catch (...) {
+        error = "unknown exception";
+    }
+}
+
+}  // namespace
+
+TestResult throughput_test_pipeline(const ThroughputTestCase &params, const std::string &stats_path) {
+    if (params.duration <= 0)
+        return TestResult(TestStatus::TEST_FAILED, "Test failed: duration should be positive");
+
+    std::ofstream stats_file;
+    if (!stats_path.empty()) {
+        stats_file.open(stats_path);
+        if (!stats_file.good())
+            return TestResult(TestStatus::TEST_FAILED, "Test failed: can't open \"" + stats_path + "\" for writing");
+        stats_file << "second,throughput,vmrss,vmhwm,voluntary_ctx_switches,involuntary_ctx_switches\n";
+    }
+
+    // all networks share one Core, as in the multi-model applications
+    Core ie;
+    std::vector<ExecutableNetwork> networks;
+    std::vector<size_t> batch_sizes;
+    std::vector<int> network_ids;
+    auto models = params.models;
+    for (auto &model : models) {
+        CNNNetwork cnn_network = ie.ReadNetwork(model["full_path"]);
+        batch_sizes.push_back(cnn_network.getBatchSize() != 0 ? cnn_network.getBatchSize() : 1);
+        networks.push_back(ie.LoadNetwork(cnn_network, params.device));
+        for (int i = 0; i < std::stoi(model["threads"]); i++)
+            network_ids.push_back(static_cast<int>(networks.size()) - 1);
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> completed{0};
+    std::vector<LatencyHistogram> histograms(network_ids.size());
+    std::vector<std::string> errors(network_ids.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < network_ids.size(); i++) {
+        const int id = network_ids[i];
+        threads.emplace_back(infer_requests_loop, networks[id], batch_sizes[id], params.nireq, std::cref(stop),
+                             std::ref(completed), std::ref(histograms[i]), std::ref(errors[i]));
+    }
+
+    const int warmup_seconds = std::min(WARMUP_SECONDS, std::max(params.duration / 10, 1));
+    long ref_rss = -1, cur_rss = 0;
+    uint64_t min_throughput = std::numeric_limits<uint64_t>::max(), max_throughput = 0, prev_completed = 0;
+    const auto start_switches = getContextSwitches();
+    auto cur_switches = start_switches;
+
+    log_info("Warming up for " << warmup_seconds << " seconds");
+    log_info("second\tTHROUGHPUT\tVMRSS\tVMHWM\tVOLUNTARY_CS\tINVOLUNTARY_CS");
+    const auto start = Clock::now();
+    for (int second = 1; second <= params.duration; second++) {
+        std::this_thread::sleep_until(start + std::chrono::seconds(second));
+        const uint64_t cur_completed = completed;
+        const uint64_t throughput = cur_completed - prev_completed;
+        prev_completed = cur_completed;
+        cur_rss = static_cast<long>(getVmRSSInKB());
+        const long cur_hwm = static_cast<long>(getVmHWMInKB());
+        cur_switches = getContextSwitches();
+        const long voluntary = cur_switches.first - start_switches.first;
+        const long involuntary = cur_switches.second - start_switches.second;
+
+        if (second == warmup_seconds)
+            ref_rss = cur_rss;
+        if (second > warmup_seconds) {
+            min_throughput = std::min(min_throughput, throughput);
+            max_throughput = std::max(max_throughput, throughput);
+        }
+
+        log_info(second << "\t" << throughput << "\t" << cur_rss << "\t" << cur_hwm << "\t" << voluntary << "\t"
+                        << involuntary);
+        if (stats_file.is_open())
+            stats_file << second << "," << throughput << "," << cur_rss << "," << cur_hwm << "," << voluntary << ","
+                       << involuntary << "\n";
+    }
+    stop = true;
+    for (auto &thread : threads)
+        thread.join();
+
+    LatencyHistogram latencies;
+    for (auto &histogram : histograms)
+        latencies.merge(histogram);
+    for (auto &error : errors) {
+        if (!error.empty())
+            return TestResult(TestStatus::TEST_FAILED, "Test failed: inference failed with exception: " + error);
+    }
+
+    const auto measured_seconds = params.duration - warmup_seconds;
+    const long rss_drift = cur_rss - ref_rss;
+    log_info("Inferences: " << latencies.size() << ", average throughput: "
+                            << static_cast<double>(latencies.size()) / params.duration << " inferences/sec");
+    if (measured_seconds > 0)
+        log_info("Throughput after warm-up: min " << min_throughput << ", max " << max_throughput
+                                                  << " inferences/sec");
+    log_info("Latency: p50 " << latencies.percentile(50) << " ms, p99 " << latencies.percentile(99) << " ms, p99.9 "
+                             << latencies.percentile(99.9) << " ms");
+    log_info("Context switches: voluntary " << cur_switches.first - start_switches.first << ", involuntary "
+                                            << cur_switches.second - start_switches.second);
+    log_info("RSS drift after warm-up: " << rss_drift << " Kb");
+
+    if (params.rss_drift_limit > 0 && rss_drift > params.rss_drift_limit)
+        return TestResult(TestStatus::TEST_FAILED, "Test failed: RSS grown by " + std::to_string(rss_drift) +
+                                                   " Kb after warm-up, limit is " +
+                                                   std::to_string(params.rss_drift_limit) + " Kb");
+    return TestResult(TestStatus::TEST_OK, "");
+}
@@ -0,0 +1,21 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "../../common/tests_utils.h"
+#include "../../common/utils.h"
+
+#include <string>
+
+#include <inference_engine.hpp>
+
+// tests_pipelines/tests_pipelines.cpp
+/**
+ * @brief Infers the test case models from one Core by the asynchronous requests of many threads for the test case
+ * duration. Logs and writes to the `stats_path` file (if it isn't empty) the per-second throughput, latency
+ * percentiles, context switches and RSS. Fails if RSS drifts more than the test case limit after the warm-up.
+ */
+TestResult throughput_test_pipeline(const ThroughputTestCase &params, const std::string &stats_path);
+// tests_pipelines/tests_pipelines.cpp
@@ -11,6 +11,7 @@ collected statistics.
 # pylint: disable=redefined-outer-name
 
 import statistics
+import json
 import tempfile
 import logging
 import argparse
@@ -131,6 +132,12 @@ def cli_parser():
                         dest="stats_path",
                         type=Path,
                         help='path to a file to save aggregated statistics')
+    parser.add_argument('-f',
+                        dest="stats_format",
+                        choices=["yaml", "json"],
+                        default="yaml",
+                        help='format of a file with aggregated statistics. '
+                             'JSON keys are sorted, so files of different runs can be compared line by line')
 
     args = parser.parse_args()
 
@@ -148,7 +155,10 @@ if __name__ == "__main__":
     if args.stats_path:
         # Save aggregated results to a file
         with open(args.stats_path, "w") as file:
-            yaml.safe_dump(aggr_stats, file)
+            if args.stats_format == "json":
+                json.dump(aggr_stats, file, indent=4, sort_keys=True)
+            else:
+                yaml.safe_dump(aggr_stats, file)
         logging.info(f"Aggregated statistics saved to a file: '{args.stats_path.resolve()}'")
     else:
         logging.info("Aggregated statistics:")
@@ -0,0 +1,149 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <inference_engine.hpp>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common_utils.h"
+#include "timetests_helper/timer.h"
+#include "timetests_helper/utils.h"
+using namespace InferenceEngine;
+
+/// @brief Number of infer requests tracked separately
+static const size_t nireq = 2;
+
+/// @brief Cache directory used to measure the import of a cached network
+static const char cache_dir[] = "stages_cache";
+
+/**
+ * @brief Reads a whole file into a string
+ */
+static std::string readFile(const std::string &path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file.good())
+    throw std::runtime_error("Can't open file \"" + path + "\"");
+  std::stringstream content;
+  content << file.rdbuf();
+  return content.str();
+}
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ *
+ * Unlike timetest_infer the pipeline splits the network reading into the file
+ * reading and the parsing, measures the plugin transformations separately
+ * from the compilation, the import of the cached network and every infer
+ * request.
+ */
+int runPipeline(const std::string &model, const std::string &device) {
+  auto pipeline = [](const std::string &model, const std::string &device) {
+    Core ie;
+    CNNNetwork cnnNetwork;
+    ExecutableNetwork exeNetwork;
+    std::vector<InferRequest> inferRequests(nireq);
+    size_t batchSize = 0;
+
+    if (TimeTest::fileExt(model) != "xml")
+      throw std::logic_error("Only IR models are supported by the pipeline");
+
+    {
+      SCOPED_TIMER(load_plugin);
+      ie.GetVersions(device);
+    }
+    {
+      SCOPED_TIMER(read_network);
+      std::string xml;
+      Blob::Ptr weights;
+      {
+        SCOPED_TIMER(read_xml);
+        xml = readFile(model);
+      }
+      {
+        SCOPED_TIMER(read_weights);
+        const std::string binPath = model.substr(0, model.rfind('.')) + ".bin";
+        std::ifstream binFile(binPath, std::ios::binary | std::ios::ate);
+        if (binFile.good()) {
+          const size_t binSize = static_cast<size_t>(binFile.tellg());
+          binFile.seekg(0, std::ios::beg);
+          weights = make_shared_blob<uint8_t>({Precision::U8, {binSize}, Layout::C});
+          weights->allocate();
+          binFile.read(weights->buffer().as<char *>(), binSize);
+        }
+      }
+      {
+        SCOPED_TIMER(parse_network);
+        cnnNetwork = ie.ReadNetwork(xml, weights);
+        batchSize = cnnNetwork.getBatchSize();
+      }
+    }
+    {
+      // QueryNetwork runs the plugin transformations without the compilation
+      SCOPED_TIMER(query_network);
+      ie.QueryNetwork(cnnNetwork, device);
+    }
+    {
+      SCOPED_TIMER(load_network);
+      exeNetwork = ie.LoadNetwork(cnnNetwork, device);
+    }
+    {
+      // the network is exported to the cache unless the cache is already filled
+      SCOPED_TIMER(load_network_to_cache);
+      Core cacheCore;
+      cacheCore.SetConfig({{CONFIG_KEY(CACHE_DIR), cache_dir}});
+      cacheCore.LoadNetwork(model, device);
+    }
+    {
+      SCOPED_TIMER(import_network_from_cache);
+      Core cacheCore;
+      cacheCore.SetConfig({{CONFIG_KEY(CACHE_DIR), cache_dir}});
+      cacheCore.LoadNetwork(model, device);
+    }
+
+    batchSize = batchSize != 0 ? batchSize : 1;
+    const InferenceEngine::ConstInputsDataMap inputsInfo(exeNetwork.GetInputsInfo());
+    for (size_t i = 0; i < nireq; i++) {
+      const std::string suffix = "_" + std::to_string(i);
+      TimeTest::Timer request_timer("infer_request" + suffix);
+      {
+        TimeTest::Timer create_timer("create_infer_request" + suffix);
+        inferRequests[i] = exeNetwork.CreateInferRequest();
+      }
+      {
+        TimeTest::Timer fill_timer("fill_inputs" + suffix);
+        fillBlobs(inferRequests[i], inputsInfo, batchSize);
+      }
+      {
+        TimeTest::Timer infer_timer("first_inference" + suffix);
+        inferRequests[i].Infer();
+      }
+      {
+        TimeTest::Timer infer_timer("second_inference" + suffix);
+        inferRequests[i].Infer();
+      }
+    }
+  };
+
+  try {
+    pipeline(model, device);
+  } catch (const InferenceEngine::Exception &iex) {
+    std::cerr
+        << "Inference Engine pipeline failed with Inference Engine exception:\n"
+        << iex.what();
+    return 1;
+  } catch (const std::exception &ex) {
+    std::cerr << "Inference Engine pipeline failed with exception:\n"
+              << ex.what();
+    return 2;
+  } catch (...) {
+    std::cerr << "Inference Engine pipeline failed\n";
+    return 3;
+  }
+  return 0;
+}
@@ -0,0 +1,224 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdlib>
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <map>
+#include <string>
+
+#include <gflags/gflags.h>
+
+#include "inference_engine.hpp"
+#include <cldnn/cldnn_config.hpp>
+
+#include "samples/common.hpp"
+#include "samples/args_helper.hpp"
+
+static constexpr char help_message[] =
+                                             "Optional. Print the usage message.";
+
+static constexpr char model_message[] =
+                                             "Required. Path to the XML model.";
+
+static constexpr char targetDeviceMessage[] =
+                                             "Optional. Specify a GPU device for which kernels will be tuned. Default value: \"GPU\".\n"
+"                                             Use \"-d GPU.<id>\" format to select one of several GPU devices.";
+
+static constexpr char output_message[] =
+                                             "Optional. Path to the tuning cache file. Default value: \"<model_xml_file>_tuning.json\".\n"
+"                                             If the file exists, entries of other networks are kept and new ones are added to it.";
+
+static constexpr char retune_message[] =
+                                             "Optional. Tune again the kernels which already have an entry in the tuning cache file.";
+
+static constexpr char niter_message[] =
+                                             "Optional. Number of inferences executed with the tuned network to report its latency.\n"
+"                                             Default value: 10. Use 0 to skip the check.";
+
+static constexpr char log_level_message[] =
+                                             "Optional. Log level for InferenceEngine library.";
+
+static constexpr char config_message[] =
+                                             "Optional. Path to the configuration file.";
+
+static constexpr char inputs_precision_message[] =
+                                             "Optional. Specifies precision for all input layers of the network.";
+
+static constexpr char outputs_precision_message[] =
+                                             "Optional. Specifies precision for all output layers of the network.";
+
+static constexpr char iop_message[] =
+                                             "Optional. Specifies precision for input and output layers by name.\n"
+"                                             Example: -iop \"input:FP16, output:FP16\".\n"
+"                                             Notice that quotes are required.\n"
+"                                             Overwrites precision from ip and op options for specified layers.";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_string(m, "", model_message);
+DEFINE_string(d, "GPU", targetDeviceMessage);
+DEFINE_string(o, "", output_message);
+DEFINE_bool(retune, false, retune_message);
+DEFINE_uint32(niter, 10, niter_message);
+DEFINE_string(log_level, "", log_level_message);
+DEFINE_string(c, "", config_message);
+DEFINE_string(ip, "", inputs_precision_message);
+DEFINE_string(op, "", outputs_precision_message);
+DEFINE_string(iop, "", iop_message);
+
+static void showUsage() {
+    std::cout << "tuning_tool [OPTIONS]" << std::endl;
+    std::cout                                                                                      << std::endl;
+    std::cout << " Options:                                    "                                   << std::endl;
+    std::cout << "    -h                                       "   << help_message                 << std::endl;
+    std::cout << "    -m                           <value>     "   << model_message                << std::endl;
+    std::cout << "    -d                           <value>     "   << targetDeviceMessage          << std::endl;
+    std::cout << "    -o                           <value>     "   << output_message               << std::endl;
+    std::cout << "    -retune                                  "   << retune_message               << std::endl;
+    std::cout << "    -niter                       <value>     "   << niter_message                << std::endl;
+    std::cout << "    -c                           <value>     "   << config_message               << std::endl;
+    std::cout << "    -ip                          <value>     "   << inputs_precision_message     << std::endl;
+    std::cout << "    -op                          <value>     "   << outputs_precision_message    << std::endl;
+    std::cout << "    -iop                        \"<value>\"    "   << iop_message                << std::endl;
+    std::cout << std::endl;
+}
+
+static bool parseCommandLine(int* argc, char*** argv) {
+    gflags::ParseCommandLineNonHelpFlags(argc, argv, true);
+
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_m.empty()) {
+        throw std::invalid_argument("Path to model xml file is required");
+    }
+
+    if (FLAGS_d.find("GPU") != 0) {
+        throw std::invalid_argument("Kernels tuning is supported for GPU devices only");
+    }
+
+    if (1 < *argc) {
+        std::stringstream message;
+        message << "Unknown arguments: ";
+        for (auto arg = 1; arg < *argc; arg++) {
+            message << argv[arg];
+            if (arg < *argc) {
+                message << " ";
+            }
+        }
+        throw std::invalid_argument(message.str());
+    }
+
+    return true;
+}
+
+static std::map<std::string, std::string> parseConfigFile(char comment = '#') {
+    std::map<std::string, std::string> config;
+
+    std::ifstream file(FLAGS_c);
+    if (file.is_open()) {
+        std::string key, value;
+        while (file >> key >> value) {
+            if (key.empty() || key[0] == comment) {
+                continue;
+            }
+            config[key] = value;
+        }
+    }
+    return config;
+}
+
+std::string getFileNameFromPath(const std::string& path,
+#if defined(_WIN32)
+                                const std::string& sep = "\\") {
+#else
+                                const std::string& sep = "/") {
+#endif
+    const auto pos = path.rfind(sep);
+    if (std::string::npos == pos) {
+        return path;
+    } else {
+        return path.substr(pos + 1);
+    }
+}
+
+using TimeDiff = std::chrono::milliseconds;
+
+int main(int argc, char* argv[]) {
+    TimeDiff tuningTimeElapsed {0};
+
+    try {
+        std::cout << "Inference Engine: " << InferenceEngine::GetInferenceEngineVersion() << std::endl;
+        std::cout << std::endl;
+
+        if (!parseCommandLine(&argc, &argv)) {
+            return EXIT_SUCCESS;
+        }
+
+        InferenceEngine::Core ie;
+        if (!FLAGS_log_level.empty()) {
+            ie.SetConfig({{CONFIG_KEY(LOG_LEVEL), FLAGS_log_level}}, FLAGS_d);
+        }
+
+        auto network = ie.ReadNetwork(FLAGS_m);
+
+        processPrecision(network, FLAGS_ip, FLAGS_op, FLAGS_iop);
+
+        printInputAndOutputsInfo(network);
+
+        std::string outputName = FLAGS_o;
+        if (outputName.empty()) {
+            outputName = getFileNameFromPath(fileNameNoExt(FLAGS_m)) + "_tuning.json";
+        }
+
+        // Kernels of the network are measured by the plugin at LoadNetwork and the best ones are stored to the cache file
+        auto config = parseConfigFile();
+        IE_SUPPRESS_DEPRECATED_START
+        config[CONFIG_KEY(TUNING_MODE)] = FLAGS_retune ? CONFIG_VALUE(TUNING_RETUNE) : CONFIG_VALUE(TUNING_CREATE);
+        config[CONFIG_KEY(TUNING_FILE)] = outputName;
+        IE_SUPPRESS_DEPRECATED_END
+
+        std::cout << "Tuning kernels on " << ie.GetMetric(FLAGS_d, METRIC_KEY(FULL_DEVICE_NAME)).as<std::string>() << std::endl;
+
+        auto timeBeforeTuning = std::chrono::steady_clock::now();
+        ie.LoadNetwork(network, FLAGS_d, config);
+        tuningTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeTuning);
+
+        std::ifstream outputFile{outputName};
+        if (!outputFile.is_open()) {
+            std::cout << "Tuning cache file " << outputName << " was not created" << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::cout << "Tuning cache is written to " << outputName << std::endl;
+
+        if (FLAGS_niter > 0) {
+            // the same way the cache is used by applications: read-only, without tuning at runtime
+            IE_SUPPRESS_DEPRECATED_START
+            config[CONFIG_KEY(TUNING_MODE)] = CONFIG_VALUE(TUNING_USE_EXISTING);
+            IE_SUPPRESS_DEPRECATED_END
+            auto executableNetwork = ie.LoadNetwork(network, FLAGS_d, config);
+            auto inferRequest = executableNetwork.CreateInferRequest();
+            inferRequest.Infer();
+
+            auto timeBeforeInfer = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < FLAGS_niter; i++) {
+                inferRequest.Infer();
+            }
+            auto inferTimeElapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - timeBeforeInfer);
+            std::cout << "Average latency with the tuning cache: " << inferTimeElapsed.count() / 1000.0 / FLAGS_niter << " ms" << std::endl;
+        }
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    } catch (...) {
+        std::cerr << "Unknown/internal exception happened." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Done. Tuning time elapsed: " << tuningTimeElapsed.count() << " ms" << std::endl;
+    return EXIT_SUCCESS;
+}